@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include "ethtool-bitset.hpp"
+#include "ethtool-user.hpp"
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Dump the features of all devices (or their link modes with -m) with
+ * verbose bitsets, a nest and a name per bit decoded into generated
+ * objects, and with ETHTOOL_FLAG_COMPACT_BITSETS decoded into
+ * compact_bitset words. Both count the active bits, which have to agree.
+ *
+ *   ethtool-bitset -n 10000
+ *   ethtool-bitset -m
+ */
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+static size_t verbose_count(const ynl_cpp::ethtool_bitset& bs) {
+  size_t n = 0;
+
+  if (bs.bits) {
+    for (const auto& bit : bs.bits->bit) {
+      n += bs.nomask || bit.value;
+    }
+  }
+  return n;
+}
+
+template <typename Bitset>
+static size_t compact_count(const ynl_cpp::ethtool_bitset& bs) {
+  Bitset words;
+
+  if (!words.decode(bs)) {
+    return 0;
+  }
+  return words.count();
+}
+
+static ynl_cpp::result<size_t> features(ynl_cpp::ynl_socket& ys, bool compact) {
+  ynl_cpp::ethtool_features_get_req_dump req;
+  size_t n = 0;
+
+  req.header = compact ? ynl_cpp::ethtool_compact_header()
+                       : ynl_cpp::ethtool_header();
+  auto rsp = ynl_cpp::ethtool_features_get_dump_ex(ys, req);
+  if (!rsp) {
+    return std::unexpected(rsp.error());
+  }
+  for (const auto& dev : (*rsp)->objs) {
+    if (!dev.active) {
+      continue;
+    }
+    n += compact ? compact_count<ynl_cpp::feature_bitset>(*dev.active)
+                 : verbose_count(*dev.active);
+  }
+  return n;
+}
+
+static ynl_cpp::result<size_t>
+linkmodes(ynl_cpp::ynl_socket& ys, bool compact) {
+  ynl_cpp::ethtool_linkmodes_get_req_dump req;
+  size_t n = 0;
+
+  req.header = compact ? ynl_cpp::ethtool_compact_header()
+                       : ynl_cpp::ethtool_header();
+  auto rsp = ynl_cpp::ethtool_linkmodes_get_dump_ex(ys, req);
+  if (!rsp) {
+    return std::unexpected(rsp.error());
+  }
+  for (const auto& dev : (*rsp)->objs) {
+    if (!dev.ours) {
+      continue;
+    }
+    n += compact ? compact_count<ynl_cpp::linkmode_bitset>(*dev.ours)
+                 : verbose_count(*dev.ours);
+  }
+  return n;
+}
+
+int main(int argc, char** argv) {
+  unsigned int iters = 10000;
+  bool modes = false;
+  size_t bits[2] = {};
+  double ns[2] = {};
+  ynl_error yerr;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "mn:")) != -1) {
+    switch (opt) {
+      case 'm':
+        modes = true;
+        break;
+      case 'n':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0] << " [-m] [-n iters]" << std::endl;
+        return 1;
+    }
+  }
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_ethtool_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  for (int compact : {0, 1}) {
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < iters; i++) {
+      auto n = modes ? linkmodes(ys, compact) : features(ys, compact);
+      if (!n) {
+        std::cerr << "dump failed: " << n.error().message() << std::endl;
+        return 1;
+      }
+      bits[compact] = *n;
+    }
+    ns[compact] = elapsed_ns(start) / iters;
+  }
+
+  if (bits[0] != bits[1]) {
+    std::cerr << "bit counts disagree: " << bits[0] << " vs " << bits[1]
+              << std::endl;
+    return 2;
+  }
+
+  printf("%s, %zu bits set\n", modes ? "link modes" : "features", bits[0]);
+  printf("verbose %10.1f ns/dump\n", ns[0]);
+  printf("compact %10.1f ns/dump\n", ns[1]);
+  return 0;
+}
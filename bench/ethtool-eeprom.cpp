@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <net/if.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include "ethtool-eeprom.hpp"
+#include "ethtool-user.hpp"
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Poll the module memory of -p ports (the host's devices, repeated) the
+ * way DOM telemetry does: page by page with a round trip each, every
+ * half page every time, and with the module_eeprom_reader, which pipelines
+ * the requests and skips the static pages after the first read. Ports
+ * without a module cost one failing request either way.
+ *
+ *   ethtool-eeprom -p 64 -n 100
+ */
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+static const struct {
+  __u8 page;
+  __u32 offset;
+} halves[ynl_cpp::cmis_half_cnt] = {
+    {0x00, 0},
+    {0x00, 128},
+    {0x01, 128},
+    {0x02, 128},
+    {0x11, 128},
+};
+
+/* One module-eeprom-get round trip, into @buf */
+static bool read_half(
+    ynl_cpp::ynl_socket& ys,
+    __u32 ifindex,
+    unsigned int half,
+    std::array<__u8, ynl_cpp::cmis_half_len>& buf) {
+  struct ynl_sock* sock = ys;
+  struct ynl_req_state yrs = {};
+  struct nlmsghdr* nlh;
+  struct nlattr* nest;
+
+  nlh = ynl_gemsg_start_req(
+      sock, sock->family_id, ETHTOOL_MSG_MODULE_EEPROM_GET, 1);
+  nest = ynl_attr_nest_start(nlh, ETHTOOL_A_MODULE_EEPROM_HEADER);
+  ynl_attr_put_u32(nlh, ETHTOOL_A_HEADER_DEV_INDEX, ifindex);
+  ynl_attr_nest_end(nlh, nest);
+  ynl_attr_put_u32(nlh, ETHTOOL_A_MODULE_EEPROM_OFFSET, halves[half].offset);
+  ynl_attr_put_u32(nlh, ETHTOOL_A_MODULE_EEPROM_LENGTH, buf.size());
+  ynl_attr_put_u8(nlh, ETHTOOL_A_MODULE_EEPROM_PAGE, halves[half].page);
+  ynl_attr_put_u8(nlh, ETHTOOL_A_MODULE_EEPROM_BANK, 0);
+  ynl_attr_put_u8(nlh, ETHTOOL_A_MODULE_EEPROM_I2C_ADDRESS, 0x50);
+
+  yrs.yarg.ys = sock;
+  yrs.yarg.data = &buf;
+  yrs.cb = [](const struct nlmsghdr* rsp, struct ynl_parse_arg* yarg) -> int {
+    auto* dst = (std::array<__u8, ynl_cpp::cmis_half_len>*)yarg->data;
+    const struct nlattr* attr;
+
+    ynl_attr_for_each(attr, rsp, sizeof(struct genlmsghdr)) {
+      if (ynl_attr_type(attr) == ETHTOOL_A_MODULE_EEPROM_DATA &&
+          ynl_attr_data_len(attr) == dst->size()) {
+        memcpy(dst->data(), ynl_attr_data(attr), dst->size());
+      }
+    }
+    return YNL_PARSE_CB_OK;
+  };
+  yrs.rsp_cmd = ETHTOOL_MSG_MODULE_EEPROM_GET_REPLY;
+
+  return ynl_exec(sock, nlh, &yrs) >= 0;
+}
+
+static size_t
+read_paged(ynl_cpp::ynl_socket& ys, std::span<ynl_cpp::module_eeprom> mods) {
+  size_t requests = 0;
+
+  for (auto& mod : mods) {
+    mod.valid = 0;
+    for (unsigned int h = 0; h < ynl_cpp::cmis_half_cnt; h++) {
+      /* Only CMIS modules with paged memory have more than page 00h */
+      if (h > ynl_cpp::cmis_page_00h && (!mod.cmis() || mod.flat())) {
+        break;
+      }
+      requests++;
+      if (!read_half(ys, mod.ifindex, h, mod.mem[h])) {
+        break;
+      }
+      mod.valid |= 1U << h;
+    }
+  }
+  return requests;
+}
+
+int main(int argc, char** argv) {
+  struct if_nameindex *ifs, *ifp;
+  std::vector<__u32> ifindexes;
+  unsigned int iters = 100;
+  size_t ports = 64, valid;
+  ynl_error yerr;
+  double ns[2];
+  size_t reqs[2] = {};
+  int opt;
+
+  while ((opt = getopt(argc, argv, "p:n:")) != -1) {
+    switch (opt) {
+      case 'p':
+        ports = strtoul(optarg, nullptr, 0);
+        break;
+      case 'n':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0] << " [-p ports] [-n iters]"
+                  << std::endl;
+        return 1;
+    }
+  }
+
+  ifs = if_nameindex();
+  for (ifp = ifs; ifp && ifp->if_index; ifp++) {
+    ifindexes.push_back(ifp->if_index);
+  }
+  if_freenameindex(ifs);
+  if (ifindexes.empty()) {
+    std::cerr << "no network devices" << std::endl;
+    return 1;
+  }
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_ethtool_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  std::vector<ynl_cpp::module_eeprom> mods(ports);
+  for (size_t i = 0; i < ports; i++) {
+    mods[i].ifindex = ifindexes[i % ifindexes.size()];
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iters; i++) {
+    reqs[0] = read_paged(ys, mods);
+  }
+  ns[0] = elapsed_ns(start) / iters;
+
+  ynl_cpp::module_eeprom_reader reader;
+  for (auto& mod : mods) {
+    mod.valid = 0;
+  }
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iters; i++) {
+    auto ret = reader.read(ys, mods);
+    if (!ret) {
+      std::cerr << "read failed: " << ret.error().message() << std::endl;
+      return 1;
+    }
+  }
+  ns[1] = elapsed_ns(start) / iters;
+  reqs[1] = reader.requests();
+
+  valid = 0;
+  for (const auto& mod : mods) {
+    valid += !!mod.valid;
+  }
+
+  printf("%zu ports, %zu with a module\n", ports, valid);
+  printf("paged    %4zu requests %10.1f us/poll\n", reqs[0], ns[0] / 1e3);
+  printf("pipeline %4zu requests %10.1f us/poll\n", reqs[1], ns[1] / 1e3);
+  for (const auto& mod : mods) {
+    if (!mod.cmis()) {
+      continue;
+    }
+    printf(
+        "ifindex %-6u temp %.1f C vcc %.3f V rx0 %.1f uW bias0 %u uA\n",
+        mod.ifindex,
+        mod.temperature().value_or(0) / 256.0,
+        mod.vcc().value_or(0) / 10000.0,
+        mod.rx_power(0).value_or(0) / 10.0,
+        mod.tx_bias(0).value_or(0));
+  }
+  return 0;
+}
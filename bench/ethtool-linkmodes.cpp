@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <ynl.hpp>
+
+#include "ethtool-user.hpp"
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Compare a full ethtool linkmodes dump against one projected down to
+ * speed and duplex. The projected parser never descends into the
+ * "ours" / "peer" bitset nests, which dominate the reply.
+ */
+
+static int run(
+    ynl_cpp::ynl_socket& ys,
+    const char* name,
+    unsigned int iters,
+    const ynl_cpp::projection* proj) {
+  ynl_cpp::ethtool_linkmodes_get_req_dump req;
+  size_t objs = 0;
+
+  req.header = ynl_cpp::ethtool_header();
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iters; i++) {
+    auto rsp = ynl_cpp::ethtool_linkmodes_get_dump_ex(ys, req, proj);
+    if (!rsp) {
+      std::cerr << "dump failed: " << rsp.error().message() << std::endl;
+      return -1;
+    }
+    objs += (*rsp)->objs.size();
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  auto ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  printf(
+      "%-10s %8u dumps %8zu objs %10.1f ns/dump %10.1f ns/obj\n",
+      name,
+      iters,
+      objs,
+      (double)ns / iters,
+      objs ? (double)ns / objs : 0.0);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  constexpr ynl_cpp::projection proj{
+      ETHTOOL_A_LINKMODES_SPEED, ETHTOOL_A_LINKMODES_DUPLEX};
+  unsigned int iters = argc > 1 ? strtoul(argv[1], nullptr, 0) : 10000;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_ethtool_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  /* warm up */
+  if (run(ys, "warmup", iters / 10 + 1, nullptr)) {
+    return 2;
+  }
+  if (run(ys, "full", iters, nullptr) || run(ys, "projected", iters, &proj)) {
+    return 2;
+  }
+
+  return 0;
+}
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <net/if.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include "ethtool-rss.hpp"
+#include "ethtool-user.hpp"
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Rebalance -c RSS contexts of -s entry tables of device -d the way a load
+ * balancer does, with -p percent of the tables actually changing per round:
+ * writing every table with a round trip each, and with rss_tables, which
+ * compares against the tables it holds and pipelines the sets of the
+ * changed ones. The contexts are assumed, not read, so any device works;
+ * one without RSS support rejects every set, at the same cost each way.
+ *
+ *   ethtool-rss -d lo -c 256 -s 128 -p 5 -n 100
+ */
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+/* The full rss-set of @ctx, as sent without comparing */
+static ynl_cpp::ethtool_rss_set_req
+full_req(const ynl_cpp::rss_context& ctx) {
+  const __u8* table = (const __u8*)ctx.indir.data();
+  ynl_cpp::ethtool_rss_set_req req;
+
+  req.header.emplace().dev_index = ctx.ifindex;
+  if (ctx.context) {
+    req.context = ctx.context;
+  }
+  req.indir.assign(table, table + ctx.indir.size() * sizeof(__u32));
+  return req;
+}
+
+int main(int argc, char** argv) {
+  unsigned int iters = 100, pct = 5;
+  size_t contexts = 256, size = 128;
+  const char* dev = "lo";
+  __u32 ifindex;
+  ynl_error yerr;
+  double ns[3];
+  size_t sets;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "d:c:s:p:n:")) != -1) {
+    switch (opt) {
+      case 'd':
+        dev = optarg;
+        break;
+      case 'c':
+        contexts = strtoul(optarg, nullptr, 0);
+        break;
+      case 's':
+        size = strtoul(optarg, nullptr, 0);
+        break;
+      case 'p':
+        pct = strtoul(optarg, nullptr, 0);
+        break;
+      case 'n':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0]
+                  << " [-d dev] [-c contexts] [-s size] [-p pct] [-n iters]"
+                  << std::endl;
+        return 1;
+    }
+  }
+
+  ifindex = if_nametoindex(dev);
+  if (!ifindex) {
+    std::cerr << "no device " << dev << std::endl;
+    return 1;
+  }
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_ethtool_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  /* Round robin over 8 queues, the changed tables move entry 0 */
+  ynl_cpp::rss_tables tables;
+  std::vector<ynl_cpp::rss_context> wants(contexts);
+  for (size_t i = 0; i < contexts; i++) {
+    wants[i].ifindex = ifindex;
+    wants[i].context = i;
+    wants[i].indir.resize(size);
+    for (size_t e = 0; e < size; e++) {
+      wants[i].indir[e] = e % 8;
+    }
+    tables.assume(wants[i]);
+    if (i * 100 < contexts * pct) {
+      wants[i].indir[0] = 7;
+    }
+  }
+
+  /* One round trip per table, failures are expected and ignored */
+  std::vector<ynl_cpp::ethtool_rss_set_req> fulls;
+  for (const auto& want : wants) {
+    fulls.push_back(full_req(want));
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iters; i++) {
+    for (auto& req : fulls) {
+      ynl_cpp::ethtool_rss_set(ys, req);
+    }
+  }
+  ns[0] = elapsed_ns(start) / iters;
+
+  /* Failed sets aren't folded in, so every round sends the same ones */
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iters; i++) {
+    auto ret = tables.update(ys, wants);
+    if (!ret) {
+      std::cerr << "update failed: " << ret.error().message() << std::endl;
+      return 1;
+    }
+  }
+  ns[1] = elapsed_ns(start) / iters;
+  sets = tables.sets() / iters;
+
+  /* Change detection alone, nothing differs */
+  for (size_t i = 0; i < contexts; i++) {
+    wants[i].indir[0] = 0;
+  }
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iters; i++) {
+    if (!tables.update(ys, wants)) {
+      return 1;
+    }
+  }
+  ns[2] = elapsed_ns(start) / iters;
+
+  printf("%zu contexts of %zu entries, %zu changed\n", contexts, size, sets);
+  printf("full     %4zu sets %10.1f us/round\n", contexts, ns[0] / 1e3);
+  printf("diffed   %4zu sets %10.1f us/round\n", sets, ns[1] / 1e3);
+  printf(
+      "compare  %4u sets %10.1f us/round %6.1f ns/context\n",
+      0,
+      ns[2] / 1e3,
+      ns[2] / contexts);
+  return 0;
+}
@@ -0,0 +1,346 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include "ethtool-stats.hpp"
+#include "ethtool-user.hpp"
+
+#include <linux/genetlink.h>
+
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <map>
+
+/*
+ * Scrape the standard stats of a fleet of ports into the flat scraper
+ * records, and into per message heap objects the way a generic decoder
+ * does it: an object per reply, a list of groups, a map of counters. The
+ * generated ethtool_stats_get_rsp can't be used for the latter, it holds
+ * one group and one counter. Replies are synthetic, shaped like the
+ * kernel's with all groups of a NIC with RMON histograms, or come from
+ * live dumps of the host (-l).
+ *
+ *   ethtool-stats -n 1000    # replay 1k ports
+ *   ethtool-stats -l         # dump the host's devices
+ */
+
+static const size_t grp_cnt[__ETHTOOL_STATS_CNT] = {
+    __ETHTOOL_A_STATS_ETH_PHY_CNT,
+    __ETHTOOL_A_STATS_ETH_MAC_CNT,
+    __ETHTOOL_A_STATS_ETH_CTRL_CNT,
+    __ETHTOOL_A_STATS_RMON_CNT,
+    __ETHTOOL_A_STATS_PHY_CNT,
+};
+
+static const __u32 rmon_bkt[][2] = {
+    {0, 64},
+    {65, 127},
+    {128, 255},
+    {256, 511},
+    {512, 1023},
+    {1024, 1518},
+    {1519, 2047},
+    {2048, 4095},
+    {4096, 8191},
+    {8192, 10239},
+};
+
+static void put_hist(struct nlmsghdr* nlh, __u32 type, __u64 base) {
+  for (size_t b = 0; b < sizeof(rmon_bkt) / sizeof(rmon_bkt[0]); b++) {
+    struct nlattr* nest = ynl_attr_nest_start(nlh, type);
+
+    ynl_attr_put_u32(nlh, ETHTOOL_A_STATS_GRP_HIST_BKT_LOW, rmon_bkt[b][0]);
+    ynl_attr_put_u32(nlh, ETHTOOL_A_STATS_GRP_HIST_BKT_HI, rmon_bkt[b][1]);
+    ynl_attr_put_u64(nlh, ETHTOOL_A_STATS_GRP_HIST_VAL, base >> b);
+    ynl_attr_nest_end(nlh, nest);
+  }
+}
+
+static void put_port(std::vector<unsigned char>& buf, __u32 ifindex) {
+  unsigned char msg[4096] = {};
+  struct nlmsghdr* nlh = ynl_nlmsg_put_header(msg);
+  struct genlmsghdr* genl;
+  struct nlattr* nest;
+  char name[16];
+
+  nlh->nlmsg_type = 0x20;
+  nlh->nlmsg_flags = NLM_F_MULTI;
+  nlh->nlmsg_pid = sizeof(msg);
+  genl = (struct genlmsghdr*)ynl_nlmsg_put_extra_header(nlh, sizeof(*genl));
+  genl->cmd = ETHTOOL_MSG_STATS_GET_REPLY;
+  genl->version = 1;
+
+  snprintf(name, sizeof(name), "eth%u", ifindex);
+  nest = ynl_attr_nest_start(nlh, ETHTOOL_A_STATS_HEADER);
+  ynl_attr_put_u32(nlh, ETHTOOL_A_HEADER_DEV_INDEX, ifindex);
+  ynl_attr_put_str(nlh, ETHTOOL_A_HEADER_DEV_NAME, name);
+  ynl_attr_nest_end(nlh, nest);
+
+  for (__u32 id = 0; id < __ETHTOOL_STATS_CNT; id++) {
+    struct nlattr* grp = ynl_attr_nest_start(nlh, ETHTOOL_A_STATS_GRP);
+
+    ynl_attr_put_u32(nlh, ETHTOOL_A_STATS_GRP_ID, id);
+    for (__u32 c = 0; c < grp_cnt[id]; c++) {
+      nest = ynl_attr_nest_start(nlh, ETHTOOL_A_STATS_GRP_STAT);
+      ynl_attr_put_u64(nlh, c, ifindex * 1000ULL + c);
+      ynl_attr_nest_end(nlh, nest);
+    }
+    if (id == ETHTOOL_STATS_RMON) {
+      put_hist(nlh, ETHTOOL_A_STATS_GRP_HIST_RX, ifindex * 4096ULL);
+      put_hist(nlh, ETHTOOL_A_STATS_GRP_HIST_TX, ifindex * 2048ULL);
+    }
+    ynl_attr_nest_end(nlh, grp);
+  }
+  nlh->nlmsg_pid = 0;
+
+  buf.insert(buf.end(), msg, msg + nlh->nlmsg_len);
+}
+
+/* What the scraper replaces */
+struct generic_grp {
+  __u32 id{0};
+  std::map<__u32, __u64> stats;
+  std::vector<ynl_cpp::ethtool_stats_grp_hist> hist_rx;
+  std::vector<ynl_cpp::ethtool_stats_grp_hist> hist_tx;
+};
+
+struct generic_dev {
+  ynl_cpp::ethtool_header header;
+  std::list<generic_grp> grps;
+};
+
+static bool generic_hist(
+    std::vector<ynl_cpp::ethtool_stats_grp_hist>& hist,
+    const struct nlattr* nest) {
+  auto& bkt = hist.emplace_back();
+  const struct nlattr* attr;
+
+  ynl_attr_for_each_nested(attr, nest) {
+    switch (ynl_attr_type(attr)) {
+      case ETHTOOL_A_STATS_GRP_HIST_BKT_LOW:
+        bkt.hist_bkt_low = ynl_attr_get_u32(attr);
+        break;
+      case ETHTOOL_A_STATS_GRP_HIST_BKT_HI:
+        bkt.hist_bkt_hi = ynl_attr_get_u32(attr);
+        break;
+      case ETHTOOL_A_STATS_GRP_HIST_VAL:
+        bkt.hist_val = ynl_attr_get_u64(attr);
+        break;
+    }
+  }
+  return true;
+}
+
+static bool
+generic_add(std::list<generic_dev>& devs, const struct nlmsghdr* nlh) {
+  const struct nlattr *attr, *nattr, *stat;
+  auto& dev = devs.emplace_back();
+
+  ynl_attr_for_each(attr, nlh, sizeof(struct genlmsghdr)) {
+    if (ynl_attr_type(attr) == ETHTOOL_A_STATS_HEADER) {
+      ynl_attr_for_each_nested(nattr, attr) {
+        if (ynl_attr_type(nattr) == ETHTOOL_A_HEADER_DEV_INDEX) {
+          dev.header.dev_index = ynl_attr_get_u32(nattr);
+        } else if (ynl_attr_type(nattr) == ETHTOOL_A_HEADER_DEV_NAME) {
+          dev.header.dev_name = ynl_attr_get_str(nattr);
+        }
+      }
+      continue;
+    }
+    if (ynl_attr_type(attr) != ETHTOOL_A_STATS_GRP) {
+      continue;
+    }
+
+    auto& grp = dev.grps.emplace_back();
+    ynl_attr_for_each_nested(nattr, attr) {
+      switch (ynl_attr_type(nattr)) {
+        case ETHTOOL_A_STATS_GRP_ID:
+          grp.id = ynl_attr_get_u32(nattr);
+          break;
+        case ETHTOOL_A_STATS_GRP_STAT:
+          ynl_attr_for_each_nested(stat, nattr) {
+            if (ynl_attr_data_len(stat) == sizeof(__u64)) {
+              grp.stats[ynl_attr_type(stat)] = ynl_attr_get_u64(stat);
+            }
+          }
+          break;
+        case ETHTOOL_A_STATS_GRP_HIST_RX:
+          generic_hist(grp.hist_rx, nattr);
+          break;
+        case ETHTOOL_A_STATS_GRP_HIST_TX:
+          generic_hist(grp.hist_tx, nattr);
+          break;
+      }
+    }
+  }
+  return dev.header.dev_index.has_value();
+}
+
+template <typename F>
+static bool for_each_msg(const std::vector<unsigned char>& buf, F&& fn) {
+  for (size_t off = 0; off + NLMSG_HDRLEN <= buf.size();) {
+    const struct nlmsghdr* nlh = (const struct nlmsghdr*)&buf[off];
+
+    if (nlh->nlmsg_len < NLMSG_HDRLEN || off + nlh->nlmsg_len > buf.size() ||
+        !fn(nlh)) {
+      return false;
+    }
+    off += NLMSG_ALIGN(nlh->nlmsg_len);
+  }
+  return true;
+}
+
+static int replay(const std::vector<unsigned char>& buf, unsigned int iters) {
+  ynl_cpp::ethtool_stats_scraper scraper;
+  double best[2] = {};
+  __u64 sum[2] = {};
+
+  for (unsigned int i = 0; i <= iters; i++) {
+    std::list<generic_dev> devs;
+    double ns[2];
+    size_t n;
+
+    auto start = std::chrono::steady_clock::now();
+    scraper.clear();
+    if (!for_each_msg(buf, [&](const struct nlmsghdr* nlh) {
+          return scraper.add(nlh);
+        })) {
+      std::cerr << "malformed message" << std::endl;
+      return 2;
+    }
+    auto mid = std::chrono::steady_clock::now();
+    for_each_msg(buf, [&](const struct nlmsghdr* nlh) {
+      return generic_add(devs, nlh);
+    });
+    auto end = std::chrono::steady_clock::now();
+
+    ns[0] = std::chrono::duration_cast<std::chrono::nanoseconds>(mid - start)
+                .count();
+    ns[1] = std::chrono::duration_cast<std::chrono::nanoseconds>(end - mid)
+                .count();
+    n = scraper.size();
+
+    /* first pass grows the records, report it separately */
+    printf(
+        "%-8s %8zu ports flat %8.1f ns/port generic %8.1f ns/port\n",
+        i ? "replay" : "cold",
+        n,
+        n ? ns[0] / n : 0.0,
+        n ? ns[1] / n : 0.0);
+    for (int p = 0; i && n && p < 2; p++) {
+      if (!best[p] || ns[p] / n < best[p]) {
+        best[p] = ns[p] / n;
+      }
+    }
+
+    sum[0] = sum[1] = 0;
+    for (const auto& st : scraper.devs) {
+      sum[0] += st.eth_mac[ETHTOOL_A_STATS_ETH_MAC_5_RX_PKT];
+      sum[0] += st.rmon_rx.val[0];
+    }
+    for (const auto& dev : devs) {
+      for (const auto& grp : dev.grps) {
+        if (grp.id == ETHTOOL_STATS_ETH_MAC) {
+          sum[1] += grp.stats.at(ETHTOOL_A_STATS_ETH_MAC_5_RX_PKT);
+        } else if (grp.id == ETHTOOL_STATS_RMON) {
+          sum[1] += *grp.hist_rx.at(0).hist_val;
+        }
+      }
+    }
+    if (sum[0] != sum[1]) {
+      std::cerr << "counters disagree: " << sum[0] << " vs " << sum[1]
+                << std::endl;
+      return 2;
+    }
+  }
+
+  if (best[0] && best[1]) {
+    printf(
+        "dump %zu bytes, best flat %.2fM ports/s generic %.2fM ports/s\n",
+        buf.size(),
+        1e3 / best[0],
+        1e3 / best[1]);
+  }
+  return 0;
+}
+
+static int live(unsigned int iters) {
+  ynl_cpp::ethtool_stats_scraper scraper;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_ethtool_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  for (unsigned int i = 0; i <= iters; i++) {
+    auto start = std::chrono::steady_clock::now();
+    auto ret = scraper.scrape(ys);
+    auto end = std::chrono::steady_clock::now();
+
+    if (!ret) {
+      std::cerr << "scrape failed: " << ret.error().message() << std::endl;
+      return 1;
+    }
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                  .count();
+    printf(
+        "%-8s %8zu ports %10.3f ms\n",
+        i ? "scrape" : "cold",
+        scraper.size(),
+        ns / 1e6);
+  }
+
+  for (const auto& st : scraper.devs) {
+    printf(
+        "ifindex %-6u groups %#x rmon buckets %u/%u\n",
+        st.ifindex,
+        st.groups,
+        st.rmon_rx.n,
+        st.rmon_tx.n);
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  std::vector<unsigned char> buf;
+  unsigned int iters = 10;
+  bool do_live = false;
+  __u32 ports = 1000;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "ln:i:")) != -1) {
+    switch (opt) {
+      case 'l':
+        do_live = true;
+        break;
+      case 'n':
+        ports = strtoul(optarg, nullptr, 0);
+        break;
+      case 'i':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0] << " [-l | -n ports] [-i iters]"
+                  << std::endl;
+        return 1;
+    }
+  }
+
+  if (do_live) {
+    return live(iters);
+  }
+
+  buf.reserve((size_t)ports * 2048);
+  for (__u32 i = 0; i < ports; i++) {
+    put_port(buf, 1 + i);
+  }
+
+  return replay(buf, iters);
+}
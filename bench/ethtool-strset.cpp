@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include <linux/ethtool.h>
+
+#include "ethtool-strset.hpp"
+#include "ethtool-user.hpp"
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Resolve bit names of string set -s (link modes by default) of device -d
+ * (ifindex, only needed for per device sets) the way tools do it today, a
+ * strset-get decoded into generated objects per query, and through
+ * strset_cache. Also times filling the cache, which decodes straight into
+ * its arena, against decoding one reply into generated objects.
+ *
+ *   ethtool-strset -s 4 -n 100000
+ *   ethtool-strset -s 1 -d 2
+ */
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+static ynl_cpp::result<std::string>
+generic_name(ynl_cpp::ynl_socket& ys, __u32 ifindex, __u32 set, __u32 bit) {
+  ynl_cpp::ethtool_strset_get_req req;
+
+  req.header.emplace();
+  if (ynl_cpp::strset_cache::per_device(set)) {
+    req.header->dev_index = ifindex;
+  }
+  req.stringsets.emplace();
+  req.stringsets->stringset.emplace_back().id = set;
+
+  auto rsp = ynl_cpp::ethtool_strset_get_ex(ys, req);
+  if (!rsp) {
+    return std::unexpected(rsp.error());
+  }
+  for (const auto& ss : (*rsp)->stringsets->stringset) {
+    for (const auto& strings : ss.strings) {
+      for (const auto& str : strings.string) {
+        if (str.index == bit) {
+          return str.value;
+        }
+      }
+    }
+  }
+  return std::string();
+}
+
+int main(int argc, char** argv) {
+  unsigned int iters = 10000, set = ETH_SS_LINK_MODES, ifindex = 0;
+  ynl_cpp::strset_cache cache;
+  size_t len = 0, cache_len = 0;
+  double generic, cached, cold;
+  ynl_error yerr;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "s:d:n:")) != -1) {
+    switch (opt) {
+      case 's':
+        set = strtoul(optarg, nullptr, 0);
+        break;
+      case 'd':
+        ifindex = strtoul(optarg, nullptr, 0);
+        break;
+      case 'n':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0] << " [-s set] [-d ifindex] [-n iters]"
+                  << std::endl;
+        return 1;
+    }
+  }
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_ethtool_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  auto names = cache.get(ys, ifindex, set);
+  if (!names) {
+    std::cerr << "strset-get failed: " << names.error().message()
+              << std::endl;
+    return 1;
+  }
+  if (names->empty()) {
+    std::cerr << "string set " << set << " is empty" << std::endl;
+    return 1;
+  }
+  size_t count = names->size();
+
+  /* Generic path, one request per name, a tenth of the iterations */
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iters / 10 + 1; i++) {
+    auto name = generic_name(ys, ifindex, set, i % count);
+    if (!name) {
+      std::cerr << "strset-get failed: " << name.error().message()
+                << std::endl;
+      return 1;
+    }
+    len += name->size();
+  }
+  generic = elapsed_ns(start) / (iters / 10 + 1);
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iters; i++) {
+    auto name = cache.name(ys, ifindex, set, i % count);
+    if (!name) {
+      std::cerr << "lookup failed: " << name.error().message() << std::endl;
+      return 1;
+    }
+    cache_len += name->size();
+  }
+  cached = elapsed_ns(start) / iters;
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < iters / 10 + 1; i++) {
+    cache.clear();
+    if (!cache.get(ys, ifindex, set)) {
+      return 1;
+    }
+  }
+  cold = elapsed_ns(start) / (iters / 10 + 1);
+
+  if (!len || !cache_len) {
+    std::cerr << "no names" << std::endl;
+    return 2;
+  }
+
+  printf(
+      "set %u: %zu strings, %zu arena bytes, %zu fetches\n",
+      set,
+      count,
+      cache.arena_bytes(),
+      cache.fetches());
+  printf("name, strset-get per query %10.1f ns\n", generic);
+  printf("name, cached               %10.1f ns\n", cached);
+  printf("fill, cleared cache        %10.1f ns\n", cold);
+  return 0;
+}
@@ -0,0 +1,270 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <ynl-dyn.hpp>
+#include <ynl.hpp>
+
+#include "netdev-user.hpp"
+
+#include <linux/genetlink.h>
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Decode netdev replies with the family loaded at runtime from its spec
+ * blob (make -C generated/ blobs). Synthetic per-queue qstats-get replies
+ * are decoded into dyn_value trees, with walk(), and with a loop which
+ * knows the attribute types at compile time, for reference. With -l the
+ * host's netdevs are dumped through the runtime family and through the
+ * generated code.
+ *
+ *   netdev-dyn -s ../generated/netdev.ynlb -n 10000
+ *   netdev-dyn -s ../generated/netdev.ynlb -l
+ */
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+static void put_queue(std::vector<unsigned char>& buf, __u32 id) {
+  unsigned char msg[512] = {};
+  struct nlmsghdr* nlh = ynl_nlmsg_put_header(msg);
+  struct genlmsghdr* genl;
+
+  nlh->nlmsg_type = 0x20;
+  nlh->nlmsg_flags = NLM_F_MULTI;
+  nlh->nlmsg_pid = sizeof(msg);
+  genl = (struct genlmsghdr*)ynl_nlmsg_put_extra_header(nlh, sizeof(*genl));
+  genl->cmd = NETDEV_CMD_QSTATS_GET;
+  genl->version = 1;
+
+  ynl_attr_put_u32(nlh, NETDEV_A_QSTATS_IFINDEX, 1 + id / 64);
+  ynl_attr_put_u32(nlh, NETDEV_A_QSTATS_QUEUE_TYPE, NETDEV_QUEUE_TYPE_RX);
+  ynl_attr_put_u32(nlh, NETDEV_A_QSTATS_QUEUE_ID, id % 64);
+  ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_PACKETS, id * 100000ULL);
+  ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_BYTES, id * 140000000ULL);
+  ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_ALLOC_FAIL, id % 3);
+  ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_HW_DROPS, id % 5);
+  ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_CSUM_COMPLETE, id * 90000ULL);
+  ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_CSUM_NONE, id % 11);
+  ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_HW_GRO_PACKETS, id * 2000ULL);
+  ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_HW_GRO_BYTES, id * 2800000ULL);
+  nlh->nlmsg_pid = 0;
+
+  buf.insert(buf.end(), msg, msg + nlh->nlmsg_len);
+}
+
+/* Run @fn on each message of @buf, returns the sum it computed or -1 */
+template <typename F>
+static long long for_each_msg(const std::vector<unsigned char>& buf, F&& fn) {
+  long long sum = 0;
+
+  for (size_t off = 0; off + NLMSG_HDRLEN <= buf.size();) {
+    const struct nlmsghdr* nlh = (const struct nlmsghdr*)&buf[off];
+
+    if (nlh->nlmsg_len < NLMSG_HDRLEN || off + nlh->nlmsg_len > buf.size() ||
+        !fn(nlh, sum)) {
+      return -1;
+    }
+    off += NLMSG_ALIGN(nlh->nlmsg_len);
+  }
+  return sum;
+}
+
+template <typename F>
+static int run(
+    const char* what,
+    const std::vector<unsigned char>& buf,
+    unsigned int n,
+    unsigned int iters,
+    F&& fn) {
+  double best = 0;
+  long long sum = 0;
+
+  for (unsigned int i = 0; i < iters; i++) {
+    auto start = std::chrono::steady_clock::now();
+
+    sum = for_each_msg(buf, fn);
+    double per = elapsed_ns(start) / n;
+
+    if (sum < 0) {
+      std::cerr << what << ": malformed message" << std::endl;
+      return 2;
+    }
+    if (!best || per < best) {
+      best = per;
+    }
+  }
+  printf(
+      "%-8s %8u msgs %8.1f ns/msg  (rx-bytes sum %lld)\n",
+      what,
+      n,
+      best,
+      sum);
+  return 0;
+}
+
+static int replay(
+    const ynl_cpp::dyn_family& fam,
+    unsigned int n,
+    unsigned int iters) {
+  const ynl_cpp::dyn_op* op = fam.op("qstats-get");
+  const ynl_cpp::dyn_attr* rx_bytes;
+  std::vector<unsigned char> buf;
+  __u16 rx_bytes_type;
+
+  if (!op || !op->set || !(rx_bytes = op->set->find("rx-bytes"))) {
+    std::cerr << "no qstats-get in " << fam.name() << std::endl;
+    return 1;
+  }
+  rx_bytes_type = rx_bytes->type;
+
+  buf.reserve((size_t)n * 160);
+  for (__u32 i = 0; i < n; i++) {
+    put_queue(buf, i);
+  }
+
+  return run(
+             "static",
+             buf,
+             n,
+             iters,
+             [](const struct nlmsghdr* nlh, long long& sum) {
+               const struct nlattr* attr;
+
+               ynl_attr_for_each(attr, nlh, sizeof(struct genlmsghdr)) {
+                 if (ynl_attr_type(attr) == NETDEV_A_QSTATS_RX_BYTES) {
+                   sum += ynl_attr_get_uint(attr);
+                 }
+               }
+               return true;
+             }) ||
+      run("walk",
+          buf,
+          n,
+          iters,
+          [&](const struct nlmsghdr* nlh, long long& sum) {
+            return fam.walk(
+                *op,
+                nlh,
+                [&](const ynl_cpp::dyn_attr* spec, const struct nlattr* attr) {
+                  if (spec && spec->type == rx_bytes_type) {
+                    sum += ynl_attr_get_uint(attr);
+                  }
+                  return true;
+                });
+          }) ||
+      run("tree",
+          buf,
+          n,
+          iters,
+          [&](const struct nlmsghdr* nlh, long long& sum) {
+            ynl_cpp::dyn_value val;
+
+            if (!fam.decode(*op, nlh, val)) {
+              return false;
+            }
+            if (auto v = val.get("rx-bytes")) {
+              sum += v->num;
+            }
+            return true;
+          });
+}
+
+static int live(const ynl_cpp::dyn_family& fam, unsigned int iters) {
+  const ynl_cpp::dyn_op* op = fam.op("dev-get");
+  ynl_error yerr;
+
+  if (!op) {
+    std::cerr << "no dev-get in " << fam.name() << std::endl;
+    return 1;
+  }
+
+  ynl_cpp::ynl_socket ys(fam.family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  for (unsigned int i = 0; i < iters; i++) {
+    ynl_cpp::dyn_request req(fam, *op, true);
+
+    auto start = std::chrono::steady_clock::now();
+    auto devs = fam.dump(ys, req);
+    double dyn_ns = elapsed_ns(start);
+    if (!devs) {
+      std::cerr << "dump failed: " << devs.error().message() << std::endl;
+      return 1;
+    }
+
+    start = std::chrono::steady_clock::now();
+    auto rsp = ynl_cpp::netdev_dev_get_dump_ex(ys);
+    double gen_ns = elapsed_ns(start);
+    if (!rsp) {
+      std::cerr << "dump failed: " << rsp.error().message() << std::endl;
+      return 1;
+    }
+
+    printf(
+        "dump     %4zu devs dyn %8.1f us generated %8.1f us\n",
+        devs->size(),
+        dyn_ns / 1e3,
+        gen_ns / 1e3);
+  }
+
+  /* Errors from the kernel name the attribute, like the generated code */
+  ynl_cpp::dyn_request req(fam, *op);
+  req.put("ifindex", 0);
+  auto ret = fam.exec(ys, req);
+  if (!ret) {
+    printf("dev-get ifindex 0: %s\n", ret.error().message().c_str());
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  const char* spec = "../generated/netdev.ynlb";
+  unsigned int n = 10000, iters = 10;
+  bool do_live = false;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "s:ln:i:")) != -1) {
+    switch (opt) {
+      case 's':
+        spec = optarg;
+        break;
+      case 'l':
+        do_live = true;
+        break;
+      case 'n':
+        n = strtoul(optarg, nullptr, 0);
+        break;
+      case 'i':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0]
+                  << " [-s spec.ynlb] [-l | -n msgs] [-i iters]" << std::endl;
+        return 1;
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto fam = ynl_cpp::dyn_family::load(spec);
+  if (!fam) {
+    std::cerr << fam.error().message() << std::endl;
+    return 1;
+  }
+  printf("load     %s %.1f us\n", spec, elapsed_ns(start) / 1e3);
+
+  if (do_live) {
+    return live(**fam, iters);
+  }
+  return replay(**fam, n, iters);
+}
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include "netdev-napi.hpp"
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Tune many NAPIs at once. Synthetic NAPIs (-n, spread over -d devices,
+ * each serving an rx and a tx queue, every other one already tuned) time
+ * resolving the rules and encoding the batch. With -l the NAPIs of the
+ * host are switched between two settings (-D defer-hard-irqs values),
+ * once with a napi-set round trip per NAPI and once with apply(), and
+ * put back the way they were afterwards.
+ *
+ *   netdev-napi -n 512 -d 4
+ *   netdev-napi -l -D 0,100
+ */
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+static int synthetic(unsigned int n, unsigned int devs, unsigned int iters) {
+  ynl_cpp::napi_tuner tuner({
+      {.config = {.defer_hard_irqs = 100, .irq_suspend_timeout = 0}},
+      {.queue_type = NETDEV_QUEUE_TYPE_RX,
+       .config = {.gro_flush_timeout = 20000}},
+      {.ifindex = 2, .config = {.irq_suspend_timeout = 2000000}},
+  });
+  ynl_error yerr;
+  double best = 0;
+  size_t msgs = 0;
+
+  /* Only to encode, nothing is sent */
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_netdev_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  for (__u32 i = 0; i < n; i++) {
+    ynl_cpp::netdev_napi_get_rsp napi;
+    ynl_cpp::netdev_queue_get_rsp queue;
+
+    napi.id = 8192 + i;
+    napi.ifindex = 2 + i % devs;
+    napi.defer_hard_irqs = i % 2 ? 100 : 0;
+    napi.gro_flush_timeout = i % 2 ? 20000 : 0;
+    napi.irq_suspend_timeout = i % 2 && napi.ifindex != 2U ? 0 : 2000000;
+    tuner.add_napi(napi);
+
+    queue.napi_id = napi.id;
+    queue.type = NETDEV_QUEUE_TYPE_RX;
+    tuner.add_queue(queue);
+    queue.type = NETDEV_QUEUE_TYPE_TX;
+    tuner.add_queue(queue);
+  }
+
+  ynl_cpp::msg_batch batch(ys);
+  for (unsigned int i = 0; i < iters; i++) {
+    batch.clear();
+
+    auto start = std::chrono::steady_clock::now();
+    auto ret = tuner.plan(batch);
+    double ns = elapsed_ns(start);
+    if (!ret) {
+      std::cerr << "plan failed: " << ret.error().message() << std::endl;
+      return 1;
+    }
+    if (!best || ns < best) {
+      best = ns;
+    }
+    msgs = batch.size();
+  }
+
+  printf(
+      "plan     %6u napis %6zu msgs %8zu bytes %10.1f us %6.1f ns/napi\n",
+      n,
+      msgs,
+      batch.bytes(),
+      best / 1e3,
+      best / n);
+  return 0;
+}
+
+static int set_serial(
+    ynl_cpp::ynl_socket& ys,
+    const std::vector<ynl_cpp::napi_result>& napis,
+    __u32 defer) {
+  for (const auto& napi : napis) {
+    ynl_cpp::netdev_napi_set_req req;
+
+    req.id = napi.id;
+    req.defer_hard_irqs = defer;
+    auto ret = ynl_cpp::netdev_napi_set_ex(ys, req);
+    if (!ret) {
+      std::cerr << "napi " << napi.id << ": " << ret.error().message()
+                << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int live(__u32 from, __u32 to, unsigned int iters) {
+  ynl_cpp::napi_tuner orig({});
+  size_t failed = 0;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_netdev_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  auto ret = orig.load(ys);
+  if (!ret) {
+    std::cerr << "dump failed: " << ret.error().message() << std::endl;
+    return 1;
+  }
+  printf("%zu napis\n", orig.results.size());
+
+  for (unsigned int i = 0; i < iters; i++) {
+    ynl_cpp::napi_tuner tuner({{.config = {.defer_hard_irqs = to}}});
+
+    auto start = std::chrono::steady_clock::now();
+    if (set_serial(ys, orig.results, from)) {
+      return 1;
+    }
+    double serial_ns = elapsed_ns(start);
+
+    start = std::chrono::steady_clock::now();
+    ret = tuner.apply(ys);
+    double apply_ns = elapsed_ns(start);
+    if (!ret) {
+      std::cerr << "apply failed: " << ret.error().message() << std::endl;
+      return 1;
+    }
+    for (const auto& res : tuner.results) {
+      failed += res.err.has_value();
+    }
+
+    printf(
+        "serial %10.1f us  apply (dump + diff + batch) %10.1f us\n",
+        serial_ns / 1e3,
+        apply_ns / 1e3);
+  }
+  if (failed) {
+    printf("%zu napi-set failed\n", failed);
+  }
+
+  /* Put everything back */
+  for (const auto& napi : orig.results) {
+    ynl_cpp::netdev_napi_set_req req;
+
+    req.id = napi.id;
+    req.defer_hard_irqs = napi.current.defer_hard_irqs;
+    req.gro_flush_timeout = napi.current.gro_flush_timeout;
+    req.irq_suspend_timeout = napi.current.irq_suspend_timeout;
+    ynl_cpp::netdev_napi_set_ex(ys, req);
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  unsigned int n = 512, devs = 4, iters = 10;
+  __u32 from = 0, to = 100;
+  bool do_live = false;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "ln:d:D:i:")) != -1) {
+    switch (opt) {
+      case 'l':
+        do_live = true;
+        break;
+      case 'n':
+        n = strtoul(optarg, nullptr, 0);
+        break;
+      case 'd':
+        devs = strtoul(optarg, nullptr, 0);
+        break;
+      case 'D':
+        if (sscanf(optarg, "%u,%u", &from, &to) != 2) {
+          std::cerr << "-D takes two values, e.g. 0,100" << std::endl;
+          return 1;
+        }
+        break;
+      case 'i':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0]
+                  << " [-l [-D from,to] | -n napis -d devs] [-i iters]"
+                  << std::endl;
+        return 1;
+    }
+  }
+
+  if (do_live) {
+    return live(from, to, iters);
+  }
+  if (!devs) {
+    std::cerr << "need a device" << std::endl;
+    return 1;
+  }
+  return synthetic(n, devs, iters);
+}
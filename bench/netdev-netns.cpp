@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <ynl-netns.hpp>
+#include <ynl.hpp>
+
+#include "netdev-user.hpp"
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Dump the netdevs of many namespaces. Scratch namespaces are created for
+ * the run (-n), or the ones in /run/netns are used (-r). Compares entering
+ * each namespace and building a socket per dump, serially, with dumping
+ * through a netns_pool from -t threads, first with the sockets still to
+ * be created and then with the warm pool.
+ *
+ *   netdev-netns -n 200 -t 8
+ */
+
+static double elapsed_ms(std::chrono::steady_clock::time_point start) {
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+             .count() /
+      1e6;
+}
+
+static void report(const char* what, size_t nss, size_t devs, double ms) {
+  printf(
+      "%-8s %6zu netns %8zu devs %10.3f ms %8.1f us/netns\n",
+      what,
+      nss,
+      devs,
+      ms,
+      nss ? ms * 1e3 / nss : 0.0);
+}
+
+static int serial(const std::vector<ynl_cpp::netns>& nss) {
+  size_t devs = 0;
+  ynl_error yerr;
+
+  auto start = std::chrono::steady_clock::now();
+  for (const auto& ns : nss) {
+    ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_netdev_family(), ns.fd(), &yerr);
+    if (!ys) {
+      std::cerr << yerr.msg << std::endl;
+      return 1;
+    }
+
+    auto rsp = ynl_cpp::netdev_dev_get_dump_ex(ys);
+    if (!rsp) {
+      std::cerr << "dump failed: " << rsp.error().message() << std::endl;
+      return 1;
+    }
+    devs += (*rsp)->objs.size();
+  }
+  report("serial", nss.size(), devs, elapsed_ms(start));
+  return 0;
+}
+
+static int fanout(
+    ynl_cpp::netns_pool& pool,
+    const char* what,
+    const std::vector<ynl_cpp::netns>& nss,
+    unsigned int threads) {
+  size_t devs = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  auto rsps = ynl_cpp::for_each_netns(
+      pool,
+      nss,
+      [](ynl_cpp::ynl_socket& ys) {
+        return ynl_cpp::netdev_dev_get_dump_ex(ys);
+      },
+      threads);
+  double ms = elapsed_ms(start);
+
+  for (size_t i = 0; i < rsps.size(); i++) {
+    if (!rsps[i]) {
+      std::cerr << "netns " << nss[i].id() << ": "
+                << rsps[i].error().message() << std::endl;
+      return 1;
+    }
+    devs += (*rsps[i])->objs.size();
+  }
+  report(what, nss.size(), devs, ms);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  ynl_cpp::netns_pool pool(ynl_cpp::get_ynl_netdev_family());
+  std::vector<ynl_cpp::netns> nss;
+  unsigned int n = 100, threads = 0, iters = 5;
+  bool named = false;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:rt:i:")) != -1) {
+    switch (opt) {
+      case 'n':
+        n = strtoul(optarg, nullptr, 0);
+        break;
+      case 'r':
+        named = true;
+        break;
+      case 't':
+        threads = strtoul(optarg, nullptr, 0);
+        break;
+      case 'i':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0]
+                  << " [-n namespaces | -r] [-t threads] [-i iters]"
+                  << std::endl;
+        return 1;
+    }
+  }
+
+  if (named) {
+    auto ret = ynl_cpp::named_netns();
+    if (!ret) {
+      std::cerr << ret.error().message() << std::endl;
+      return 1;
+    }
+    nss = std::move(*ret);
+  } else {
+    for (unsigned int i = 0; i < n; i++) {
+      auto ns = ynl_cpp::netns::create();
+      if (!ns) {
+        std::cerr << ns.error().message() << std::endl;
+        return 1;
+      }
+      nss.push_back(std::move(*ns));
+    }
+  }
+
+  if (serial(nss) || fanout(pool, "cold", nss, threads)) {
+    return 1;
+  }
+  for (unsigned int i = 0; i < iters; i++) {
+    if (fanout(pool, "pool", nss, threads)) {
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include "netdev-qstats.hpp"
+
+#include <linux/genetlink.h>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <tuple>
+
+/*
+ * Per-queue qstats deltas and per-device sums, from synthetic dumps of
+ * -d devices with -q rx and -q tx queues each (10240 queues by default),
+ * or from live dumps of the host (-l). With -c every other sample drops
+ * the last queue of each device, forcing queues to be matched by key.
+ * For reference the same is computed the way a consumer without the
+ * sampler would, with a map keyed by (ifindex, type, id).
+ *
+ *   netdev-qstats -d 40 -q 128
+ *   netdev-qstats -l -I 1000
+ */
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+static void put_queue(
+    std::vector<unsigned char>& buf,
+    __u32 ifindex,
+    __u32 type,
+    __u32 id,
+    __u64 seq) {
+  unsigned char msg[512] = {};
+  struct nlmsghdr* nlh = ynl_nlmsg_put_header(msg);
+  struct genlmsghdr* genl;
+  __u64 pkts = (id + 1) * 1000 * seq;
+
+  nlh->nlmsg_type = 0x20;
+  nlh->nlmsg_flags = NLM_F_MULTI;
+  nlh->nlmsg_pid = sizeof(msg);
+  genl = (struct genlmsghdr*)ynl_nlmsg_put_extra_header(nlh, sizeof(*genl));
+  genl->cmd = NETDEV_CMD_QSTATS_GET;
+  genl->version = 1;
+
+  ynl_attr_put_u32(nlh, NETDEV_A_QSTATS_IFINDEX, ifindex);
+  ynl_attr_put_u32(nlh, NETDEV_A_QSTATS_QUEUE_TYPE, type);
+  ynl_attr_put_u32(nlh, NETDEV_A_QSTATS_QUEUE_ID, id);
+  if (type == NETDEV_QUEUE_TYPE_RX) {
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_PACKETS, pkts);
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_BYTES, pkts * 1400);
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_ALLOC_FAIL, seq % 3);
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_HW_DROPS, seq / 2);
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_CSUM_UNNECESSARY, pkts - seq);
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_HW_GRO_PACKETS, pkts / 8);
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_HW_GRO_BYTES, pkts * 175);
+  } else {
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_TX_PACKETS, pkts);
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_TX_BYTES, pkts * 1400);
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_TX_NEEDS_CSUM, pkts);
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_TX_HW_GSO_PACKETS, pkts / 16);
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_TX_STOP, seq % 5);
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_TX_WAKE, seq % 5);
+  }
+  nlh->nlmsg_pid = 0;
+
+  buf.insert(buf.end(), msg, msg + nlh->nlmsg_len);
+}
+
+static void put_dump(
+    std::vector<unsigned char>& buf,
+    unsigned int devs,
+    unsigned int queues,
+    __u64 seq,
+    bool churn) {
+  /* drop the last queue every other sample */
+  unsigned int n = churn && seq % 2 ? queues - 1 : queues;
+
+  for (__u32 d = 0; d < devs; d++) {
+    for (__u32 type : {NETDEV_QUEUE_TYPE_RX, NETDEV_QUEUE_TYPE_TX}) {
+      for (__u32 q = 0; q < n; q++) {
+        put_queue(buf, 2 + d, type, q, seq);
+      }
+    }
+  }
+}
+
+template <typename F>
+static bool for_each_msg(const std::vector<unsigned char>& buf, F&& fn) {
+  for (size_t off = 0; off + NLMSG_HDRLEN <= buf.size();) {
+    const struct nlmsghdr* nlh = (const struct nlmsghdr*)&buf[off];
+
+    if (nlh->nlmsg_len < NLMSG_HDRLEN || off + nlh->nlmsg_len > buf.size() ||
+        !fn(nlh)) {
+      return false;
+    }
+    off += NLMSG_ALIGN(nlh->nlmsg_len);
+  }
+  return true;
+}
+
+/* What the sampler replaces: a map of counters and a pass for the sums */
+struct map_sampler {
+  using key = std::tuple<__u32, __u32, __u32>;
+  std::map<key, std::array<__u64, ynl_cpp::qstats_counters>> last;
+  std::map<key, std::array<__u64, ynl_cpp::qstats_counters>> delta;
+  std::map<__u32, std::array<__u64, ynl_cpp::qstats_counters>> dev;
+
+  bool add(const struct nlmsghdr* nlh) {
+    std::array<__u64, ynl_cpp::qstats_counters> val{};
+    __u32 ifindex = 0, type = 0, id = 0;
+    const struct nlattr* attr;
+
+    ynl_attr_for_each(attr, nlh, sizeof(struct genlmsghdr)) {
+      unsigned int t = ynl_attr_type(attr);
+
+      if (t == NETDEV_A_QSTATS_IFINDEX) {
+        ifindex = ynl_attr_get_u32(attr);
+      } else if (t == NETDEV_A_QSTATS_QUEUE_TYPE) {
+        type = ynl_attr_get_u32(attr);
+      } else if (t == NETDEV_A_QSTATS_QUEUE_ID) {
+        id = ynl_attr_get_u32(attr);
+      } else if (t >= NETDEV_A_QSTATS_RX_PACKETS && t <= NETDEV_A_QSTATS_MAX) {
+        val[ynl_cpp::qstats_col(t)] = ynl_attr_get_uint(attr);
+      }
+    }
+
+    key k{ifindex, type, id};
+    auto& d = delta[k];
+    auto it = last.find(k);
+    for (unsigned int c = 0; c < ynl_cpp::qstats_counters; c++) {
+      __u64 then = it == last.end() ? val[c] : it->second[c];
+
+      d[c] = val[c] < then ? val[c] : val[c] - then;
+    }
+    last[k] = val;
+    return true;
+  }
+
+  void aggregate() {
+    dev.clear();
+    for (auto& [k, d] : delta) {
+      auto& sum = dev[std::get<0>(k)];
+
+      for (unsigned int c = 0; c < ynl_cpp::qstats_counters; c++) {
+        sum[c] += d[c];
+      }
+    }
+  }
+};
+
+static int replay(
+    unsigned int devs,
+    unsigned int queues,
+    unsigned int iters,
+    bool churn) {
+  std::vector<std::vector<unsigned char>> dumps(iters + 1);
+  ynl_cpp::qstats_sampler qs;
+  map_sampler ms;
+  double best_add = 0, best_fin = 0, best_map = 0;
+  size_t n = (size_t)devs * queues * 2;
+
+  for (unsigned int i = 0; i <= iters; i++) {
+    dumps[i].reserve(n * 160);
+    put_dump(dumps[i], devs, queues, i + 1, churn);
+  }
+  qs.reserve(n);
+
+  for (unsigned int i = 0; i <= iters; i++) {
+    auto start = std::chrono::steady_clock::now();
+
+    qs.begin();
+    if (!for_each_msg(dumps[i], [&](auto* nlh) { return qs.add(nlh); })) {
+      std::cerr << "malformed message" << std::endl;
+      return 2;
+    }
+    double add_ns = elapsed_ns(start);
+
+    start = std::chrono::steady_clock::now();
+    qs.finish();
+    double fin_ns = elapsed_ns(start);
+
+    start = std::chrono::steady_clock::now();
+    ms.delta.clear();
+    for_each_msg(dumps[i], [&](auto* nlh) { return ms.add(nlh); });
+    ms.aggregate();
+    double map_ns = elapsed_ns(start);
+
+    /* first sample has no deltas, and the map fills up */
+    if (!i) {
+      continue;
+    }
+    if (!best_add || add_ns + fin_ns < best_add + best_fin) {
+      best_add = add_ns;
+      best_fin = fin_ns;
+    }
+    if (!best_map || map_ns < best_map) {
+      best_map = map_ns;
+    }
+  }
+
+  /* with churn the map keeps stale counters of queues which came back */
+  unsigned int rx_bytes = ynl_cpp::qstats_col(NETDEV_A_QSTATS_RX_BYTES);
+  if (!churn &&
+      qs.dev_delta[rx_bytes][0] != ms.dev[qs.dev_ifindex[0]][rx_bytes]) {
+    std::cerr << "sampler and map disagree" << std::endl;
+    return 2;
+  }
+
+  printf(
+      "sampler  %6zu queues decode %8.1f us diff+sum %8.1f us "
+      "%6.1f ns/queue\n",
+      qs.cur().size(),
+      best_add / 1e3,
+      best_fin / 1e3,
+      (best_add + best_fin) / qs.cur().size());
+  printf(
+      "map      %6zu queues %32.1f us %6.1f ns/queue\n",
+      ms.delta.size(),
+      best_map / 1e3,
+      best_map / ms.delta.size());
+  printf(
+      "dev %u rx-bytes delta %llu, %zu queues removed, %zu devs\n",
+      qs.dev_ifindex[0],
+      (unsigned long long)qs.dev_delta[rx_bytes][0],
+      qs.removed.size(),
+      qs.dev_ifindex.size());
+  return 0;
+}
+
+static int live(unsigned int iters, unsigned int interval_ms) {
+  ynl_cpp::qstats_sampler qs;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_netdev_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  for (unsigned int i = 0; i <= iters; i++) {
+    auto start = std::chrono::steady_clock::now();
+    auto ret = qs.sample(ys);
+    double ns = elapsed_ns(start);
+
+    if (!ret) {
+      std::cerr << "sample failed: " << ret.error().message() << std::endl;
+      return 1;
+    }
+    printf(
+        "sample   %6zu queues %10.1f us\n", qs.cur().size(), ns / 1e3);
+    if (i) {
+      for (size_t d = 0; d < qs.dev_ifindex.size(); d++) {
+        double secs = qs.interval();
+
+        printf(
+            "  ifindex %-6u rx %12.0f B/s tx %12.0f B/s\n",
+            qs.dev_ifindex[d],
+            qs.dev_delta[ynl_cpp::qstats_col(NETDEV_A_QSTATS_RX_BYTES)][d] /
+                secs,
+            qs.dev_delta[ynl_cpp::qstats_col(NETDEV_A_QSTATS_TX_BYTES)][d] /
+                secs);
+      }
+    }
+    if (i < iters) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  unsigned int devs = 40, queues = 128, iters = 10, interval_ms = 1000;
+  bool do_live = false, churn = false;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "ld:q:ci:I:")) != -1) {
+    switch (opt) {
+      case 'l':
+        do_live = true;
+        break;
+      case 'd':
+        devs = strtoul(optarg, nullptr, 0);
+        break;
+      case 'q':
+        queues = strtoul(optarg, nullptr, 0);
+        break;
+      case 'c':
+        churn = true;
+        break;
+      case 'i':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      case 'I':
+        interval_ms = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0]
+                  << " [-l [-I ms] | -d devs -q queues [-c]] [-i iters]"
+                  << std::endl;
+        return 1;
+    }
+  }
+
+  if (do_live) {
+    return live(iters, interval_ms);
+  }
+  if (!devs || queues < 2) {
+    std::cerr << "need a device and 2 queues" << std::endl;
+    return 1;
+  }
+  return replay(devs, queues, iters, churn);
+}
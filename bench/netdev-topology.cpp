@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include "netdev-topology.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <tuple>
+
+/*
+ * Build the queue / NAPI / IRQ map of synthetic devices (-d devices with
+ * -q combined channels, an rx and a tx queue per NAPI) and time building
+ * it, rebuilding one device, and lookups by queue, NAPI id and IRQ. For
+ * reference, the lookup a scheduler would otherwise do: a std::map from
+ * queue to NAPI, then from NAPI to IRQ. With -l the host's map is loaded
+ * and printed.
+ *
+ *   netdev-topology -d 8 -q 512
+ *   netdev-topology -l
+ */
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start) {
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+static void add_dev(ynl_cpp::napi_topology& topo, __u32 d, unsigned int q) {
+  for (__u32 i = 0; i < q; i++) {
+    ynl_cpp::netdev_napi_get_rsp napi;
+    ynl_cpp::netdev_queue_get_rsp queue;
+
+    napi.id = 8192 + d * q + i;
+    napi.ifindex = 2 + d;
+    napi.irq = 64 + d * q + i;
+    topo.add_napi(napi);
+
+    queue.ifindex = napi.ifindex;
+    queue.id = i;
+    queue.napi_id = napi.id;
+    queue.type = NETDEV_QUEUE_TYPE_RX;
+    topo.add_queue(queue);
+    queue.type = NETDEV_QUEUE_TYPE_TX;
+    topo.add_queue(queue);
+  }
+}
+
+static int synthetic(unsigned int devs, unsigned int q, unsigned int iters) {
+  std::map<std::tuple<__u32, __u32, __u32>, __u32> queue_napi;
+  std::map<__u32, __u32> napi_irq;
+  ynl_cpp::napi_topology topo;
+  double build = 0, rebuild = 0, lookup = 0, map_lookup = 0;
+  size_t n = (size_t)devs * q * 2;
+  __u64 sum = 0, map_sum = 0;
+
+  /* the IRQs are made up, nothing to read from procfs */
+  topo.annotate = nullptr;
+
+  for (__u32 d = 0; d < devs; d++) {
+    for (__u32 i = 0; i < q; i++) {
+      for (__u32 type : {0, 1}) {
+        queue_napi[{2 + d, type, i}] = 8192 + d * q + i;
+      }
+      napi_irq[8192 + d * q + i] = 64 + d * q + i;
+    }
+  }
+
+  for (unsigned int it = 0; it < iters; it++) {
+    auto start = std::chrono::steady_clock::now();
+    topo.begin();
+    for (__u32 d = 0; d < devs; d++) {
+      add_dev(topo, d, q);
+    }
+    topo.build();
+    double ns = elapsed_ns(start);
+    if (!build || ns < build) {
+      build = ns;
+    }
+
+    start = std::chrono::steady_clock::now();
+    topo.begin(2);
+    add_dev(topo, 0, q);
+    topo.build();
+    ns = elapsed_ns(start);
+    if (!rebuild || ns < rebuild) {
+      rebuild = ns;
+    }
+
+    /* queue -> IRQ, the scheduler's question */
+    start = std::chrono::steady_clock::now();
+    sum = 0;
+    for (__u32 d = 0; d < devs; d++) {
+      for (__u32 i = 0; i < q; i++) {
+        auto row = topo.find_queue(2 + d, (d + i) % 2, i);
+
+        if (row && topo.queues.napi[*row] != topo.none) {
+          sum += topo.napis.irq[topo.queues.napi[*row]];
+        }
+      }
+    }
+    ns = elapsed_ns(start);
+    if (!lookup || ns < lookup) {
+      lookup = ns;
+    }
+
+    start = std::chrono::steady_clock::now();
+    map_sum = 0;
+    for (__u32 d = 0; d < devs; d++) {
+      for (__u32 i = 0; i < q; i++) {
+        auto qit = queue_napi.find({2 + d, (d + i) % 2, i});
+
+        if (qit != queue_napi.end()) {
+          auto nit = napi_irq.find(qit->second);
+
+          if (nit != napi_irq.end()) {
+            map_sum += nit->second;
+          }
+        }
+      }
+    }
+    ns = elapsed_ns(start);
+    if (!map_lookup || ns < map_lookup) {
+      map_lookup = ns;
+    }
+  }
+
+  if (sum != map_sum || topo.queues.ifindex.size() != n) {
+    std::cerr << "lookups disagree" << std::endl;
+    return 2;
+  }
+
+  size_t lookups = (size_t)devs * q;
+  printf(
+      "build    %6zu queues %6zu napis %10.1f us\n",
+      n,
+      topo.napis.id.size(),
+      build / 1e3);
+  printf("rebuild  1 of %u devs %17.1f us\n", devs, rebuild / 1e3);
+  printf(
+      "lookup   queue -> irq %8.1f ns, std::map %8.1f ns\n",
+      lookup / lookups,
+      map_lookup / lookups);
+  return 0;
+}
+
+static int live() {
+  ynl_cpp::napi_topology topo;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_netdev_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto ret = topo.load(ys);
+  double ns = elapsed_ns(start);
+  if (!ret) {
+    std::cerr << "load failed: " << ret.error().message() << std::endl;
+    return 1;
+  }
+  printf(
+      "load %zu devs %zu queues %zu napis %.1f us\n",
+      topo.devs.ifindex.size(),
+      topo.queues.ifindex.size(),
+      topo.napis.id.size(),
+      ns / 1e3);
+
+  for (size_t n = 0; n < topo.napis.id.size(); n++) {
+    printf(
+        "napi %-6u ifindex %-4u irq %-5d node %-2d cpu %-3d queues",
+        topo.napis.id[n],
+        topo.napis.ifindex[n],
+        (int)topo.napis.irq[n],
+        topo.napis.where[n].numa_node,
+        topo.napis.where[n].cpu);
+    for (__u32 i = topo.napis.queue_off[n]; i < topo.napis.queue_off[n + 1];
+         i++) {
+      __u32 row = topo.queues.row[i];
+
+      printf(
+          " %s%u",
+          topo.queues.type[row] == NETDEV_QUEUE_TYPE_RX ? "rx" : "tx",
+          topo.queues.id[row]);
+    }
+    printf("\n");
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  unsigned int devs = 8, q = 512, iters = 10;
+  bool do_live = false;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "ld:q:i:")) != -1) {
+    switch (opt) {
+      case 'l':
+        do_live = true;
+        break;
+      case 'd':
+        devs = strtoul(optarg, nullptr, 0);
+        break;
+      case 'q':
+        q = strtoul(optarg, nullptr, 0);
+        break;
+      case 'i':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0]
+                  << " [-l | -d devs -q channels] [-i iters]" << std::endl;
+        return 1;
+    }
+  }
+
+  if (do_live) {
+    return live();
+  }
+  return synthetic(devs, q, iters);
+}
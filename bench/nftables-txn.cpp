@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <arpa/inet.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include "nftables-txn.hpp"
+
+#include <linux/netfilter.h>
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Load IPv4 addresses into an nftables set. Either only encode the
+ * transaction, or (-l) commit it to the kernel, in a scratch table which
+ * is deleted at the end. The live run also commits a number of elements
+ * one transaction each (-b), the way a naive client would.
+ *
+ *   nftables-txn -n 50000        # encode 50k elements
+ *   nftables-txn -l -n 50000     # commit them in one transaction
+ */
+
+#define BENCH_TABLE "ynl_bench"
+#define BENCH_SET "addrs"
+
+static std::vector<ynl_cpp::nftables_setelem_attrs> make_elems(__u32 n,
+                                                               __u32 base) {
+  std::vector<ynl_cpp::nftables_setelem_attrs> elems(n);
+
+  for (__u32 i = 0; i < n; i++) {
+    __be32 addr = htonl(0x0a000000 + base + i);
+
+    elems[i].key.emplace();
+    elems[i].key->value.assign((__u8*)&addr, (__u8*)&addr + sizeof(addr));
+  }
+  return elems;
+}
+
+static double elapsed_ms(std::chrono::steady_clock::time_point start) {
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+             .count() /
+      1e6;
+}
+
+static int encode(const std::vector<ynl_cpp::nftables_setelem_attrs>& elems,
+                  unsigned int iters) {
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_nftables_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  ynl_cpp::nft_transaction txn(ys);
+  for (unsigned int i = 0; i <= iters; i++) {
+    auto start = std::chrono::steady_clock::now();
+
+    txn.clear();
+    auto msgs = txn.add_setelems(NFPROTO_IPV4, BENCH_TABLE, BENCH_SET, elems);
+    double ms = elapsed_ms(start);
+
+    if (!msgs) {
+      std::cerr << "encode failed: " << msgs.error().message() << std::endl;
+      return 1;
+    }
+    printf(
+        "%-8s %8zu elems %4zu msgs %8zu bytes %8.2f ms %6.1f ns/elem\n",
+        i ? "encode" : "cold",
+        elems.size(),
+        *msgs,
+        txn.batch().bytes(),
+        ms,
+        ms * 1e6 / elems.size());
+  }
+  return 0;
+}
+
+static int commit(ynl_cpp::nft_transaction& txn, const char* what) {
+  auto failed = txn.commit();
+
+  if (!failed) {
+    std::cerr << what << ": " << failed.error().message() << std::endl;
+    return -1;
+  }
+  for (const auto& f : *failed) {
+    std::cerr << what << ": message " << f.index << " elem "
+              << (ssize_t)txn.failed_elem(f) << ": " << f.err.message()
+              << std::endl;
+  }
+  return failed->empty() ? 0 : -1;
+}
+
+static int live(const std::vector<ynl_cpp::nftables_setelem_attrs>& elems,
+                __u32 singles) {
+  ynl_cpp::nftables_newtable_req table;
+  ynl_cpp::nftables_newset_req set;
+  ynl_cpp::nftables_deltable_req del;
+  int ret = 0;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_nftables_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  table._nlmsg_flags = NLM_F_CREATE;
+  table._hdr.nfgen_family = NFPROTO_IPV4;
+  table.name = BENCH_TABLE;
+
+  set._nlmsg_flags = NLM_F_CREATE;
+  set._hdr.nfgen_family = NFPROTO_IPV4;
+  set.table = BENCH_TABLE;
+  set.name = BENCH_SET;
+  set.key_type = htonl(7); /* ipv4_addr in nft(8) terms */
+  set.key_len = htonl(sizeof(__be32));
+  set.id = htonl(1);
+
+  ynl_cpp::nft_transaction txn(ys);
+  ynl_cpp::nftables_newtable_batch(txn.batch(), table);
+  ynl_cpp::nftables_newset_batch(txn.batch(), set);
+
+  auto start = std::chrono::steady_clock::now();
+  auto msgs = txn.add_setelems(NFPROTO_IPV4, BENCH_TABLE, BENCH_SET, elems);
+  if (!msgs) {
+    std::cerr << "encode failed: " << msgs.error().message() << std::endl;
+    return 1;
+  }
+  if (commit(txn, "batched")) {
+    ret = 1;
+  } else {
+    double ms = elapsed_ms(start);
+
+    printf(
+        "%-8s %8zu elems %4zu msgs %8.2f ms %8.0f elems/s\n",
+        "batched",
+        elems.size(),
+        *msgs,
+        ms,
+        elems.size() * 1e3 / ms);
+  }
+
+  if (!ret && singles) {
+    auto single = make_elems(singles, elems.size());
+
+    start = std::chrono::steady_clock::now();
+    for (__u32 i = 0; i < singles; i++) {
+      txn.clear();
+      txn.add_setelems(
+          NFPROTO_IPV4, BENCH_TABLE, BENCH_SET, std::span(&single[i], 1));
+      if (commit(txn, "single")) {
+        ret = 1;
+        break;
+      }
+    }
+    if (!ret) {
+      double ms = elapsed_ms(start);
+
+      printf(
+          "%-8s %8u elems %4u msgs %8.2f ms %8.0f elems/s\n",
+          "single",
+          singles,
+          singles,
+          ms,
+          singles * 1e3 / ms);
+    }
+  }
+
+  del._hdr.nfgen_family = NFPROTO_IPV4;
+  del.name = BENCH_TABLE;
+  txn.clear();
+  ynl_cpp::nftables_deltable_batch(txn.batch(), del);
+  if (commit(txn, "cleanup")) {
+    ret = 1;
+  }
+  return ret;
+}
+
+int main(int argc, char** argv) {
+  __u32 n = 50000, singles = 1000;
+  unsigned int iters = 10;
+  bool do_live = false;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "ln:b:i:")) != -1) {
+    switch (opt) {
+      case 'l':
+        do_live = true;
+        break;
+      case 'n':
+        n = strtoul(optarg, nullptr, 0);
+        break;
+      case 'b':
+        singles = strtoul(optarg, nullptr, 0);
+        break;
+      case 'i':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0]
+                  << " [-l] [-n elems] [-b single elems] [-i iters]"
+                  << std::endl;
+        return 1;
+    }
+  }
+
+  auto elems = make_elems(n, 0);
+  if (do_live) {
+    return live(elems, singles);
+  }
+  return encode(elems, iters);
+}
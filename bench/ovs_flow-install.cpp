@@ -0,0 +1,230 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include "ovs_datapath-user.hpp"
+#include "ovs_flow-batch.hpp"
+
+#include <linux/genetlink.h>
+#include <linux/openvswitch.h>
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Install and remove exact match TCP flows on a scratch datapath created
+ * with ovs_datapath_new(), deleted at the end. Flows are generated as a
+ * dump snapshot and replayed with ovs_flow_batch, as after a failover.
+ * A number of flows (-b) is also installed one send() per flow.
+ *
+ *   ovs_flow-install -n 100000        # 100k flows, pipelined
+ *   ovs_flow-install -n 10000 -b 10000
+ */
+
+#define BENCH_DP "ynl-bench"
+
+static void put_key(struct nlmsghdr* nlh, __u16 type, __u32 i, bool mask) {
+  struct ovs_key_ethernet eth = {};
+  struct ovs_key_ipv4 ip = {};
+  struct ovs_key_tcp tcp = {};
+  struct nlattr* nest;
+
+  memset(&eth, mask ? 0xff : 0x02, sizeof(eth));
+  ip.ipv4_src = mask ? ~0U : htonl(0x0a000000 | i);
+  ip.ipv4_dst = mask ? ~0U : htonl(0x0b000000);
+  ip.ipv4_proto = mask ? 0xff : IPPROTO_TCP;
+  ip.ipv4_ttl = mask ? 0 : 64;
+  tcp.tcp_src = mask ? 0xffff : htons(1024 + i % 50000);
+  tcp.tcp_dst = mask ? 0xffff : htons(443);
+
+  nest = ynl_attr_nest_start(nlh, type);
+  ynl_attr_put_u32(nlh, OVS_KEY_ATTR_RECIRC_ID, mask ? ~0U : 0);
+  ynl_attr_put_u32(nlh, OVS_KEY_ATTR_IN_PORT, mask ? ~0U : 0);
+  ynl_attr_put(nlh, OVS_KEY_ATTR_ETHERNET, &eth, sizeof(eth));
+  ynl_attr_put_u16(nlh, OVS_KEY_ATTR_ETHERTYPE, mask ? 0xffff : htons(0x0800));
+  ynl_attr_put(nlh, OVS_KEY_ATTR_IPV4, &ip, sizeof(ip));
+  ynl_attr_put(nlh, OVS_KEY_ATTR_TCP, &tcp, sizeof(tcp));
+  ynl_attr_nest_end(nlh, nest);
+}
+
+/* Fill @table with @n flows, the way a dump of them would */
+static bool make_flows(ynl_cpp::ovs_flow_table& table, __u32 n) {
+  table.reserve(n, (size_t)n * 200);
+  for (__u32 i = 0; i < n; i++) {
+    unsigned char msg[512] = {};
+    struct nlmsghdr* nlh = ynl_nlmsg_put_header(msg);
+    struct genlmsghdr* gehdr;
+    struct nlattr* nest;
+    __u32 ufid[4];
+
+    nlh->nlmsg_pid = sizeof(msg);
+    gehdr = (struct genlmsghdr*)ynl_nlmsg_put_extra_header(nlh, sizeof(*gehdr));
+    gehdr->cmd = OVS_FLOW_CMD_GET;
+    ynl_nlmsg_put_extra_header(nlh, sizeof(struct ovs_header));
+
+    put_key(nlh, OVS_FLOW_ATTR_KEY, i, false);
+    ufid[0] = i;
+    ufid[1] = i * 0x9e3779b9;
+    ufid[2] = ~i;
+    ufid[3] = 0x5a5a5a5a;
+    ynl_attr_put(nlh, OVS_FLOW_ATTR_UFID, ufid, sizeof(ufid));
+    put_key(nlh, OVS_FLOW_ATTR_MASK, i, true);
+    /* output to the datapath's local port */
+    nest = ynl_attr_nest_start(nlh, OVS_FLOW_ATTR_ACTIONS);
+    ynl_attr_put_u32(nlh, OVS_ACTION_ATTR_OUTPUT, OVSP_LOCAL);
+    ynl_attr_nest_end(nlh, nest);
+    nlh->nlmsg_pid = 0;
+
+    if (!table.add(nlh)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static double elapsed_ms(std::chrono::steady_clock::time_point start) {
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+             .count() /
+      1e6;
+}
+
+static int report(
+    const char* what,
+    ynl_cpp::ovs_flow_batch& fb,
+    std::chrono::steady_clock::time_point start,
+    double encode_ms) {
+  size_t n = fb.size(), failed = 0;
+  double ms;
+
+  auto status = fb.send();
+  ms = elapsed_ms(start);
+  if (!status) {
+    std::cerr << what << ": " << status.error().message() << std::endl;
+    return 1;
+  }
+  for (size_t i = 0; i < status->size(); i++) {
+    if ((*status)[i] && !failed++) {
+      std::cerr << what << ": flow " << i << ": " << strerror((*status)[i])
+                << std::endl;
+    }
+  }
+  printf(
+      "%-8s %8zu flows %6zu failed %8.2f ms (encode %6.2f) %9.0f flows/s\n",
+      what,
+      n,
+      failed,
+      ms,
+      encode_ms,
+      n * 1e3 / ms);
+  return failed ? 1 : 0;
+}
+
+static int
+run(ynl_cpp::ynl_socket& ys, int dp_ifindex, __u32 n, __u32 singles) {
+  ynl_cpp::ovs_flow_batch fb(ys, dp_ifindex);
+  ynl_cpp::ovs_flow_table flows;
+  int ret;
+
+  if (!make_flows(flows, n + singles)) {
+    std::cerr << "failed to build flows" << std::endl;
+    return 1;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (__u32 i = 0; i < n; i++) {
+    fb.add_new(flows, i, NLM_F_CREATE | NLM_F_EXCL);
+  }
+  ret = report("install", fb, start, elapsed_ms(start));
+  if (ret) {
+    return ret;
+  }
+
+  start = std::chrono::steady_clock::now();
+  for (__u32 i = 0; i < singles; i++) {
+    fb.clear();
+    fb.add_new(flows, n + i, NLM_F_CREATE | NLM_F_EXCL);
+    auto status = fb.send();
+    if (!status || (*status)[0]) {
+      std::cerr << "single: flow " << i << " failed" << std::endl;
+      return 1;
+    }
+  }
+  if (singles) {
+    double ms = elapsed_ms(start);
+
+    printf(
+        "%-8s %8u flows %6u failed %8.2f ms %24.0f flows/s\n",
+        "single",
+        singles,
+        0,
+        ms,
+        singles * 1e3 / ms);
+  }
+
+  fb.clear();
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < flows.size(); i++) {
+    fb.add_del(flows.ufid[i], flows.ufid_len[i]);
+  }
+  return report("delete", fb, start, elapsed_ms(start));
+}
+
+int main(int argc, char** argv) {
+  ynl_cpp::ovs_datapath_new_req dp_new;
+  ynl_cpp::ovs_datapath_del_req dp_del;
+  __u32 n = 100000, singles = 0;
+  int opt, ret, dp_ifindex;
+  ynl_error yerr;
+
+  while ((opt = getopt(argc, argv, "n:b:")) != -1) {
+    switch (opt) {
+      case 'n':
+        n = strtoul(optarg, nullptr, 0);
+        break;
+      case 'b':
+        singles = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0] << " [-n flows] [-b single flows]"
+                  << std::endl;
+        return 1;
+    }
+  }
+
+  ynl_cpp::ynl_socket dp_ys(ynl_cpp::get_ynl_ovs_datapath_family(), &yerr);
+  if (!dp_ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_ovs_flow_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  dp_new.name = BENCH_DP;
+  dp_new.upcall_pid = 0;
+  auto created = ynl_cpp::ovs_datapath_new_ex(dp_ys, dp_new);
+  if (!created) {
+    std::cerr << "datapath: " << created.error().message() << std::endl;
+    return 1;
+  }
+
+  dp_ifindex = if_nametoindex(BENCH_DP);
+  ret = dp_ifindex ? run(ys, dp_ifindex, n, singles) : 1;
+
+  dp_del.name = BENCH_DP;
+  if (ynl_cpp::ovs_datapath_del(dp_ys, dp_del)) {
+    std::cerr << "failed to delete datapath " BENCH_DP << std::endl;
+    ret = 1;
+  }
+  return ret;
+}
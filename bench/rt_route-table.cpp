@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <arpa/inet.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include "rt_route-table.hpp"
+
+#include <linux/rtnetlink.h>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+/*
+ * Replay a getroute dump into the columnar route table. The dump is
+ * either captured from the host (-c), loaded from a capture (-r) or
+ * synthesized: full table sized IPv4 /24s with every 8th route ECMP.
+ *
+ *   rt_route-table -c routes.bin   # capture the host's routes
+ *   rt_route-table -r routes.bin   # replay a capture
+ *   rt_route-table -n 1000000      # replay synthetic routes
+ */
+
+static void put_route(std::vector<unsigned char>& buf, __u32 i) {
+  unsigned char msg[256] = {};
+  struct nlmsghdr* nlh = ynl_nlmsg_put_header(msg);
+  struct rtmsg* rtm;
+  __u32 dst = htonl(0x0a000000 + (i << 8));
+
+  nlh->nlmsg_type = RTM_NEWROUTE;
+  nlh->nlmsg_flags = NLM_F_MULTI;
+  nlh->nlmsg_pid = sizeof(msg);
+
+  rtm = (struct rtmsg*)ynl_nlmsg_put_extra_header(nlh, sizeof(*rtm));
+  rtm->rtm_family = AF_INET;
+  rtm->rtm_dst_len = 24;
+  rtm->rtm_table = RT_TABLE_MAIN;
+  rtm->rtm_protocol = RTPROT_BGP;
+  rtm->rtm_scope = RT_SCOPE_UNIVERSE;
+  rtm->rtm_type = RTN_UNICAST;
+
+  ynl_attr_put_u32(nlh, RTA_TABLE, RT_TABLE_MAIN);
+  ynl_attr_put(nlh, RTA_DST, &dst, sizeof(dst));
+  ynl_attr_put_u32(nlh, RTA_PRIORITY, 20);
+  if (i % 8) {
+    __u32 gw = htonl(0xc0a80001 + i % 4);
+
+    ynl_attr_put(nlh, RTA_GATEWAY, &gw, sizeof(gw));
+    ynl_attr_put_u32(nlh, RTA_OIF, 2 + i % 4);
+  } else {
+    struct nlattr* mp = ynl_attr_nest_start(nlh, RTA_MULTIPATH);
+
+    for (__u32 j = 0; j < 2; j++) {
+      struct rtnexthop* rtnh;
+      __u32 gw = htonl(0xc0a80001 + j);
+
+      rtnh = (struct rtnexthop*)ynl_nlmsg_put_extra_header(nlh, sizeof(*rtnh));
+      ynl_attr_put(nlh, RTA_GATEWAY, &gw, sizeof(gw));
+      rtnh->rtnh_len = (unsigned char*)ynl_nlmsg_end_addr(nlh) -
+          (unsigned char*)rtnh;
+      rtnh->rtnh_ifindex = 2 + j;
+    }
+    ynl_attr_nest_end(nlh, mp);
+  }
+  nlh->nlmsg_pid = 0;
+
+  buf.insert(buf.end(), msg, msg + nlh->nlmsg_len);
+}
+
+static int capture(const char* path) {
+  std::vector<unsigned char> buf;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_rt_route_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  ynl_cpp::rt_route_getroute_req_dump req;
+  auto tmpl = ynl_cpp::rt_route_getroute_dump_prepare(ys, req);
+  if (!tmpl) {
+    std::cerr << tmpl.error().message() << std::endl;
+    return 1;
+  }
+  auto ret = ynl_cpp::dump_raw(
+      ys,
+      ynl_msg_reuse(ys, tmpl->nlh()),
+      RTM_NEWROUTE,
+      [&buf](const struct nlmsghdr* nlh) {
+        buf.insert(
+            buf.end(),
+            (const unsigned char*)nlh,
+            (const unsigned char*)nlh + NLMSG_ALIGN(nlh->nlmsg_len));
+        return true;
+      });
+  if (!ret) {
+    std::cerr << "dump failed: " << ret.error().message() << std::endl;
+    return 1;
+  }
+
+  std::ofstream(path, std::ios::binary)
+      .write((const char*)buf.data(), buf.size());
+  printf("captured %zu bytes to %s\n", buf.size(), path);
+  return 0;
+}
+
+static int replay(const std::vector<unsigned char>& buf, unsigned int iters) {
+  ynl_cpp::route_table table;
+  size_t bytes;
+
+  for (unsigned int i = 0; i <= iters; i++) {
+    auto start = std::chrono::steady_clock::now();
+
+    table.clear();
+    for (size_t off = 0; off + NLMSG_HDRLEN <= buf.size();) {
+      const struct nlmsghdr* nlh = (const struct nlmsghdr*)&buf[off];
+
+      if (nlh->nlmsg_len < NLMSG_HDRLEN || off + nlh->nlmsg_len > buf.size() ||
+          !table.add(nlh)) {
+        std::cerr << "malformed message at offset " << off << std::endl;
+        return 2;
+      }
+      off += NLMSG_ALIGN(nlh->nlmsg_len);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                  .count();
+    /* first pass grows the table, report it separately */
+    printf(
+        "%-8s %8zu routes %8zu nexthops %10.2f ms %8.1f ns/route\n",
+        i ? "replay" : "cold",
+        table.size(),
+        table.nh_pool.size(),
+        ns / 1e6,
+        table.size() ? (double)ns / table.size() : 0.0);
+  }
+
+  bytes = table.size() *
+          (5 * sizeof(__u8) + 5 * sizeof(__u32) +
+           2 * sizeof(ynl_cpp::route_addr)) +
+      table.nh_pool.size() * sizeof(ynl_cpp::route_nexthop) +
+      table.metric_pool.size() * sizeof(ynl_cpp::route_metric);
+  printf(
+      "dump %zu bytes, table %zu bytes (%.1f bytes/route)\n",
+      buf.size(),
+      bytes,
+      table.size() ? (double)bytes / table.size() : 0.0);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  std::vector<unsigned char> buf;
+  unsigned int iters = 10;
+  __u32 routes = 1000000;
+  const char* path = nullptr;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "c:r:n:i:")) != -1) {
+    switch (opt) {
+      case 'c':
+        return capture(optarg);
+      case 'r':
+        path = optarg;
+        break;
+      case 'n':
+        routes = strtoul(optarg, nullptr, 0);
+        break;
+      case 'i':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0]
+                  << " [-c capture | -r capture | -n routes] [-i iters]"
+                  << std::endl;
+        return 1;
+    }
+  }
+
+  if (path) {
+    std::ifstream in(path, std::ios::binary);
+
+    if (!in) {
+      std::cerr << "can't open " << path << std::endl;
+      return 1;
+    }
+    buf.assign(
+        std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  } else {
+    buf.reserve((size_t)routes * 80);
+    for (__u32 i = 0; i < routes; i++) {
+      put_route(buf, i);
+    }
+  }
+
+  return replay(buf, iters);
+}
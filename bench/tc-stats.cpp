@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <ynl.hpp>
+
+#include "tc-stats.hpp"
+
+#include <linux/rtnetlink.h>
+
+#include <chrono>
+#include <iostream>
+
+/*
+ * Collect qdisc and class counters into the columnar stats table. Either
+ * from synthetic dumps, shaped like what the kernel sends for HTB classes
+ * (options, xstats and both stats formats), spread over a number of
+ * devices, or from live dumps of the host (-l).
+ *
+ *   tc-stats -n 50000 -d 16   # replay 50k synthetic classes on 16 devices
+ *   tc-stats -l               # dump the host's qdiscs and classes
+ */
+
+static void put_class(std::vector<unsigned char>& buf, __u32 dev, __u32 i) {
+  unsigned char msg[512] = {};
+  struct nlmsghdr* nlh = ynl_nlmsg_put_header(msg);
+  unsigned char opts[76] = {}, xstats[20] = {};
+  struct ynl_cpp::gnet_stats_basic basic = {};
+  struct ynl_cpp::gnet_stats_queue queue = {};
+  struct ynl_cpp::gnet_stats_rate_est rate = {};
+  struct ynl_cpp::tc_stats st = {};
+  struct ynl_cpp::tcmsg* tcm;
+  struct nlattr* nest;
+
+  nlh->nlmsg_type = RTM_NEWTCLASS;
+  nlh->nlmsg_flags = NLM_F_MULTI;
+  nlh->nlmsg_pid = sizeof(msg);
+
+  tcm = (struct ynl_cpp::tcmsg*)ynl_nlmsg_put_extra_header(nlh, sizeof(*tcm));
+  tcm->family = AF_UNSPEC;
+  tcm->ifindex = dev;
+  tcm->handle = 0x10000 | (i + 1);
+  tcm->parent = 0x10000;
+
+  basic.bytes = st.bytes = (__u64)i * 1500 * 1000;
+  basic.packets = st.packets = i * 1000;
+  queue.drops = st.drops = i % 7;
+  queue.overlimits = st.overlimits = i % 13;
+  rate.bps = st.bps = i * 100;
+  rate.pps = st.pps = i;
+
+  ynl_attr_put_str(nlh, ynl_cpp::TC_A_TC_ATTRS_KIND, "htb");
+  ynl_attr_put(nlh, ynl_cpp::TC_A_TC_ATTRS_OPTIONS, opts, sizeof(opts));
+  nest = ynl_attr_nest_start(nlh, ynl_cpp::TC_A_TC_ATTRS_STATS2);
+  ynl_attr_put(nlh, ynl_cpp::TC_A_TCA_STATS_ATTRS_BASIC, &basic, sizeof(basic));
+  ynl_attr_put(
+      nlh, ynl_cpp::TC_A_TCA_STATS_ATTRS_RATE_EST, &rate, sizeof(rate));
+  ynl_attr_put(nlh, ynl_cpp::TC_A_TCA_STATS_ATTRS_QUEUE, &queue, sizeof(queue));
+  ynl_attr_put(nlh, ynl_cpp::TC_A_TCA_STATS_ATTRS_APP, xstats, sizeof(xstats));
+  ynl_attr_nest_end(nlh, nest);
+  ynl_attr_put(nlh, ynl_cpp::TC_A_TC_ATTRS_STATS, &st, sizeof(st));
+  ynl_attr_put(nlh, ynl_cpp::TC_A_TC_ATTRS_XSTATS, xstats, sizeof(xstats));
+  nlh->nlmsg_pid = 0;
+
+  buf.insert(buf.end(), msg, msg + nlh->nlmsg_len);
+}
+
+static int replay(const std::vector<unsigned char>& buf, unsigned int iters) {
+  ynl_cpp::tc_stats_table table;
+  double best = 0;
+
+  for (unsigned int i = 0; i <= iters; i++) {
+    auto start = std::chrono::steady_clock::now();
+
+    table.clear();
+    for (size_t off = 0; off + NLMSG_HDRLEN <= buf.size();) {
+      const struct nlmsghdr* nlh = (const struct nlmsghdr*)&buf[off];
+
+      if (nlh->nlmsg_len < NLMSG_HDRLEN || off + nlh->nlmsg_len > buf.size() ||
+          !table.add(nlh)) {
+        std::cerr << "malformed message at offset " << off << std::endl;
+        return 2;
+      }
+      off += NLMSG_ALIGN(nlh->nlmsg_len);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                  .count();
+    double per = table.size() ? (double)ns / table.size() : 0.0;
+
+    /* first pass grows the table, report it separately */
+    printf(
+        "%-8s %8zu classes %10.2f ms %8.1f ns/class\n",
+        i ? "replay" : "cold",
+        table.size(),
+        ns / 1e6,
+        per);
+    if (i && (!best || per < best)) {
+      best = per;
+    }
+  }
+
+  if (best) {
+    printf(
+        "dump %zu bytes, best %.1fM classes/s decoded\n",
+        buf.size(),
+        1e3 / best);
+  }
+  return 0;
+}
+
+static int live(unsigned int iters) {
+  ynl_cpp::tc_stats_table table;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_tc_family(), &yerr);
+  if (!ys) {
+    std::cerr << yerr.msg << std::endl;
+    return 1;
+  }
+
+  for (unsigned int i = 0; i <= iters; i++) {
+    auto start = std::chrono::steady_clock::now();
+    auto ret = table.dump(ys);
+    auto end = std::chrono::steady_clock::now();
+
+    if (!ret) {
+      std::cerr << "dump failed: " << ret.error().message() << std::endl;
+      return 1;
+    }
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                  .count();
+    printf(
+        "%-8s %8zu objects %10.2f ms %8.1f ns/object\n",
+        i ? "dump" : "cold",
+        table.size(),
+        ns / 1e6,
+        table.size() ? (double)ns / table.size() : 0.0);
+  }
+
+  for (size_t i = 0; i < table.size(); i++) {
+    printf(
+        "%-6s %-8s dev %u %x:%x parent %x:%x bytes %llu pkts %llu drops %u\n",
+        table.msg_type[i] == RTM_NEWQDISC ? "qdisc" : "class",
+        table.kinds[table.kind[i]].c_str(),
+        table.ifindex[i],
+        table.handle[i] >> 16,
+        table.handle[i] & 0xffff,
+        table.parent[i] >> 16,
+        table.parent[i] & 0xffff,
+        (unsigned long long)table.bytes[i],
+        (unsigned long long)table.packets[i],
+        table.drops[i]);
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  std::vector<unsigned char> buf;
+  unsigned int iters = 10;
+  __u32 classes = 50000, devs = 16;
+  bool do_live = false;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "ln:d:i:")) != -1) {
+    switch (opt) {
+      case 'l':
+        do_live = true;
+        break;
+      case 'n':
+        classes = strtoul(optarg, nullptr, 0);
+        break;
+      case 'd':
+        devs = strtoul(optarg, nullptr, 0);
+        break;
+      case 'i':
+        iters = strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        std::cerr << "usage: " << argv[0]
+                  << " [-l | -n classes -d devices] [-i iters]" << std::endl;
+        return 1;
+    }
+  }
+
+  if (do_live) {
+    return live(iters);
+  }
+
+  if (!devs) {
+    devs = 1;
+  }
+  buf.reserve((size_t)classes * 256);
+  for (__u32 i = 0; i < classes; i++) {
+    put_class(buf, 2 + i % devs, i / devs);
+  }
+
+  return replay(buf, iters);
+}
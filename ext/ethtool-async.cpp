@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "ethtool-async.hpp"
+
+#include <errno.h>
+
+#include <utility>
+
+namespace ynl_cpp {
+
+result<void> ethtool_async_ops::start() {
+  struct ynl_error yerr;
+
+  monitor_ys_ = std::make_unique<ynl_socket>(get_ynl_ethtool_family(), &yerr);
+  if (!*monitor_ys_) {
+    return std::unexpected(error(yerr));
+  }
+  request_ys_ = std::make_unique<ynl_socket>(get_ynl_ethtool_family(), &yerr);
+  if (!*request_ys_) {
+    return std::unexpected(error(yerr));
+  }
+
+  if (ynl_subscribe(*monitor_ys_, "monitor") < 0) {
+    return std::unexpected(error(*monitor_ys_));
+  }
+  return {};
+}
+
+int ethtool_async_ops::monitor_fd() {
+  return ynl_socket_get_fd(*monitor_ys_);
+}
+
+int ethtool_async_ops::request_fd() {
+  return ynl_socket_get_fd(*request_ys_);
+}
+
+result<ethtool_async_op>
+ethtool_async_ops::cable_test(__u32 ifindex, cable_test_cb cb) {
+  ethtool_cable_test_act_req req;
+
+  req.header.emplace().dev_index = ifindex;
+
+  /* The started event is multicast before the request is acked */
+  cable_tests_.insert_or_assign(ifindex, std::move(cb));
+  auto ret = ethtool_cable_test_act_ex(*request_ys_, req);
+  if (!ret) {
+    cable_tests_.erase(ifindex);
+    return std::unexpected(ret.error());
+  }
+  return ethtool_async_op{ethtool_async_cable_test, ifindex};
+}
+
+result<ethtool_async_op> ethtool_async_ops::module_fw_flash(
+    __u32 ifindex,
+    std::string_view file_name,
+    std::optional<__u32> password,
+    fw_flash_cb cb) {
+  ethtool_module_fw_flash_act_req req;
+
+  req.header.emplace().dev_index = ifindex;
+  req.file_name = file_name;
+  req.password = password;
+
+  auto ret = ethtool_module_fw_flash_act_ex(*request_ys_, req);
+  if (!ret) {
+    return std::unexpected(ret.error());
+  }
+  /* Events which raced the ack wait in the queue of the request socket */
+  fw_flashes_.insert_or_assign(ifindex, std::move(cb));
+  return ethtool_async_op{ethtool_async_fw_flash, ifindex};
+}
+
+/*
+ * The generated cable test notification stops at the status, decode the
+ * per pair results from ETHTOOL_A_CABLE_TEST_NTF_NEST here.
+ */
+bool ethtool_async_ops::cable_test_ntf(
+    const struct nlmsghdr* nlh,
+    size_t& calls) {
+  const struct genlmsghdr* gehdr =
+      (const struct genlmsghdr*)ynl_nlmsg_data(nlh);
+  const struct nlattr *attr, *nest, *field;
+  cable_test_event ev;
+
+  if (gehdr->cmd != ETHTOOL_MSG_CABLE_TEST_NTF) {
+    return true;
+  }
+
+  ynl_attr_for_each(attr, nlh, sizeof(struct genlmsghdr)) {
+    switch (ynl_attr_type(attr)) {
+      case ETHTOOL_A_CABLE_TEST_NTF_HEADER:
+        ynl_attr_for_each_nested(field, attr) {
+          if (ynl_attr_type(field) == ETHTOOL_A_HEADER_DEV_INDEX) {
+            ev.ifindex = ynl_attr_get_u32(field);
+          }
+        }
+        break;
+      case ETHTOOL_A_CABLE_TEST_NTF_STATUS:
+        ev.status = ynl_attr_get_u8(attr);
+        break;
+      case ETHTOOL_A_CABLE_TEST_NTF_NEST:
+        ynl_attr_for_each_nested(nest, attr) {
+          unsigned int type = ynl_attr_type(nest);
+          std::optional<__u8> pair;
+          std::optional<__u32> val;
+
+          if (type != ETHTOOL_A_CABLE_NEST_RESULT &&
+              type != ETHTOOL_A_CABLE_NEST_FAULT_LENGTH) {
+            continue;
+          }
+          /* Both nests put the pair first and the value second */
+          ynl_attr_for_each_nested(field, nest) {
+            if (ynl_attr_type(field) == ETHTOOL_A_CABLE_RESULT_PAIR) {
+              pair = ynl_attr_get_u8(field);
+            } else if (
+                type == ETHTOOL_A_CABLE_NEST_RESULT &&
+                ynl_attr_type(field) == ETHTOOL_A_CABLE_RESULT_CODE) {
+              val = ynl_attr_get_u8(field);
+            } else if (
+                type == ETHTOOL_A_CABLE_NEST_FAULT_LENGTH &&
+                ynl_attr_type(field) == ETHTOOL_A_CABLE_FAULT_LENGTH_CM) {
+              val = ynl_attr_get_u32(field);
+            }
+          }
+          if (!pair || !val || *pair >= cable_pairs) {
+            return false;
+          }
+          if (type == ETHTOOL_A_CABLE_NEST_RESULT) {
+            ev.code[*pair] = *val;
+          } else {
+            ev.fault_cm[*pair] = *val;
+          }
+        }
+        break;
+    }
+  }
+
+  auto it = cable_tests_.find(ev.ifindex);
+  if (it == cable_tests_.end()) {
+    return true;
+  }
+  if (ev.done()) {
+    /* The callback may start the next test of the port */
+    auto cb = std::move(it->second);
+
+    cable_tests_.erase(it);
+    cb(ev);
+  } else {
+    it->second(ev);
+  }
+  calls++;
+  return true;
+}
+
+result<size_t> ethtool_async_ops::process() {
+  struct ynl_ntf_base_type* ntf;
+  std::optional<error> lost;
+  size_t calls = 0;
+
+  auto ret = ntf_raw(*monitor_ys_, [&](const struct nlmsghdr* nlh) {
+    return cable_test_ntf(nlh, calls);
+  });
+  if (!ret) {
+    if (ret.error().sys_errno() != ENOBUFS) {
+      return std::unexpected(ret.error());
+    }
+    /* Completions may be gone, end every test rather than wait forever */
+    cable_test_event ev;
+
+    ev.err = ret.error();
+    for (auto& [ifindex, cb] : std::exchange(cable_tests_, {})) {
+      ev.ifindex = ifindex;
+      cb(ev);
+      calls++;
+    }
+  }
+
+  if (ynl_ntf_check(*request_ys_) < 0) {
+    if (((struct ynl_sock*)*request_ys_)->err.code != ENOBUFS) {
+      return std::unexpected(error(*request_ys_));
+    }
+    lost = error(*request_ys_);
+  }
+  while ((ntf = ynl_ntf_dequeue(*request_ys_))) {
+    auto& rsp = ((ethtool_module_fw_flash_ntf*)ntf)->obj;
+    fw_flash_event ev;
+
+    if (ntf->cmd != ETHTOOL_MSG_MODULE_FW_FLASH_NTF || !rsp.header ||
+        !rsp.header->dev_index) {
+      ynl_ntf_free(ntf);
+      continue;
+    }
+    ev.ifindex = *rsp.header->dev_index;
+    ev.status = rsp.status.value_or(ev.status);
+    ev.msg = rsp.status_msg;
+    ev.done = rsp.done.value_or(0);
+    ev.total = rsp.total.value_or(0);
+
+    auto it = fw_flashes_.find(ev.ifindex);
+    if (it != fw_flashes_.end()) {
+      if (ev.finished()) {
+        auto cb = std::move(it->second);
+
+        fw_flashes_.erase(it);
+        cb(ev);
+      } else {
+        it->second(ev);
+      }
+      calls++;
+    }
+    ynl_ntf_free(ntf);
+  }
+
+  if (lost) {
+    fw_flash_event ev;
+
+    ev.err = lost;
+    for (auto& [ifindex, cb] : std::exchange(fw_flashes_, {})) {
+      ev.ifindex = ifindex;
+      cb(ev);
+      calls++;
+    }
+  }
+  return calls;
+}
+
+bool ethtool_async_ops::pending(const ethtool_async_op& op) const {
+  if (op.kind == ethtool_async_cable_test) {
+    return cable_tests_.contains(op.ifindex);
+  }
+  return fw_flashes_.contains(op.ifindex);
+}
+
+void ethtool_async_ops::cancel(const ethtool_async_op& op) {
+  if (op.kind == ethtool_async_cable_test) {
+    cable_tests_.erase(op.ifindex);
+  } else {
+    fw_flashes_.erase(op.ifindex);
+  }
+}
+
+} // namespace ynl_cpp
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_ETHTOOL_ASYNC_H
+#define __YNL_CPP_ETHTOOL_ASYNC_H 1
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+#include <ynl.hpp>
+
+#include "ethtool-user.hpp"
+
+namespace ynl_cpp {
+
+/* Twisted pairs A - D, ETHTOOL_A_CABLE_PAIR_* */
+inline constexpr unsigned int cable_pairs = 4;
+
+/**
+ * struct cable_test_event - progress of a cable test
+ *
+ * Started, then completed with a result per pair. @code is an
+ * ETHTOOL_A_CABLE_RESULT_CODE_* value, @fault_cm the distance to the
+ * fault, if the PHY can tell. @err is set when the test can't be followed
+ * any more (notifications were lost), the op is finished then too.
+ */
+struct cable_test_event {
+  __u32 ifindex{0};
+  /* ETHTOOL_A_CABLE_TEST_NTF_STATUS_* */
+  __u8 status{0};
+  std::array<std::optional<__u8>, cable_pairs> code{};
+  std::array<std::optional<__u32>, cable_pairs> fault_cm{};
+  std::optional<error> err{};
+
+  bool done() const {
+    return err || status == ETHTOOL_A_CABLE_TEST_NTF_STATUS_COMPLETED;
+  }
+};
+
+/**
+ * struct fw_flash_event - progress of a module firmware flash
+ *
+ * @msg is the driver's status message, valid during the callback only.
+ * @done and @total count the work (usually bytes) of the flash so far.
+ */
+struct fw_flash_event {
+  __u32 ifindex{0};
+  ethtool_module_fw_flash_status status{};
+  std::string_view msg{};
+  __u64 done{0};
+  __u64 total{0};
+  std::optional<error> err{};
+
+  bool finished() const {
+    return err || status == ETHTOOL_MODULE_FW_FLASH_STATUS_COMPLETED ||
+        status == ETHTOOL_MODULE_FW_FLASH_STATUS_ERROR;
+  }
+};
+
+enum ethtool_async_kind {
+  ethtool_async_cable_test,
+  ethtool_async_fw_flash,
+};
+
+/* Handle of a running op, the kernel runs one of each kind per port */
+struct ethtool_async_op {
+  ethtool_async_kind kind;
+  __u32 ifindex;
+};
+
+/**
+ * class ethtool_async_ops - cable tests and module flashes without polling
+ *
+ * Starting an op only sends its action request; progress and completion
+ * come back as notifications and are handed to the op's callback by
+ * process(), with the op forgotten before its last event is delivered.
+ * Any number of ports may run ops at once, from one event loop: add both
+ * fds to poll() / epoll and call process() when either is readable.
+ *
+ * Two sockets are needed. Cable test events are multicast on the
+ * "monitor" group, and carry the per pair results which the generated
+ * notification type doesn't hold, so they are decoded raw from a
+ * subscribed socket. Flash events are unicast to the socket which sent
+ * the request, so flashes are started from a second socket and its
+ * notifications, queued while requests are in flight too, parsed by the
+ * generated code.
+ *
+ * Callbacks may start new ops, but must not cancel() the op they are
+ * called for.
+ *
+ * Not thread safe.
+ */
+class ethtool_async_ops {
+ public:
+  using cable_test_cb = std::function<void(const cable_test_event&)>;
+  using fw_flash_cb = std::function<void(const fw_flash_event&)>;
+
+  result<void> start();
+  /* "monitor" subscriber and request socket, for poll() / epoll */
+  int monitor_fd();
+  int request_fd();
+
+  result<ethtool_async_op> cable_test(__u32 ifindex, cable_test_cb cb);
+  result<ethtool_async_op> module_fw_flash(
+      __u32 ifindex,
+      std::string_view file_name,
+      std::optional<__u32> password,
+      fw_flash_cb cb);
+
+  /* Deliver pending events, returns the number of callbacks made */
+  result<size_t> process();
+
+  bool pending(const ethtool_async_op& op) const;
+  /* Stop following @op, the kernel carries on with it */
+  void cancel(const ethtool_async_op& op);
+  size_t pending() const {
+    return cable_tests_.size() + fw_flashes_.size();
+  }
+
+ private:
+  bool cable_test_ntf(const struct nlmsghdr* nlh, size_t& calls);
+
+  std::unique_ptr<ynl_socket> monitor_ys_;
+  std::unique_ptr<ynl_socket> request_ys_;
+  std::unordered_map<__u32, cable_test_cb> cable_tests_;
+  std::unordered_map<__u32, fw_flash_cb> fw_flashes_;
+};
+
+} // namespace ynl_cpp
+
+#endif
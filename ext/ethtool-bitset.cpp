@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "ethtool-bitset.hpp"
+
+#include <string.h>
+
+#include <algorithm>
+
+namespace ynl_cpp {
+
+ethtool_header ethtool_compact_header(__u32 ifindex) {
+  ethtool_header hdr;
+
+  if (ifindex) {
+    hdr.dev_index = ifindex;
+  }
+  hdr.flags = ETHTOOL_FLAG_COMPACT_BITSETS;
+  return hdr;
+}
+
+/* Copy the words of a compact value / mask, true if bits didn't fit */
+static bool
+bitset_copy_words(std::span<__u32> words, const void* data, size_t len) {
+  const __u8* bytes = (const __u8*)data;
+  size_t n = std::min(len, words.size_bytes());
+
+  std::fill(words.begin(), words.end(), 0);
+  memcpy(words.data(), bytes, n);
+  return std::any_of(
+      bytes + n, bytes + len, [](__u8 byte) { return byte != 0; });
+}
+
+static bool bitset_set_bit(std::span<__u32> words, __u32 bit) {
+  if (bit / 32 >= words.size()) {
+    return false;
+  }
+  words[bit / 32] |= 1U << (bit % 32);
+  return true;
+}
+
+bool ethtool_bitset_decode(
+    const ethtool_bitset& bs,
+    std::span<__u32> value,
+    std::span<__u32> mask,
+    __u32& size,
+    bool& nomask,
+    bool& truncated) {
+  size = bs.size.value_or(0);
+  nomask = bs.nomask;
+
+  if (!bs.bits) {
+    truncated = bitset_copy_words(value, bs.value.data(), bs.value.size());
+    truncated |= bitset_copy_words(mask, bs.mask.data(), bs.mask.size());
+    return true;
+  }
+
+  /* Verbose, a nest per bit: set bits only, or the mask with values */
+  truncated = false;
+  std::fill(value.begin(), value.end(), 0);
+  std::fill(mask.begin(), mask.end(), 0);
+  for (const auto& bit : bs.bits->bit) {
+    if (!bit.index) {
+      return false;
+    }
+    if (nomask || bit.value) {
+      truncated |= !bitset_set_bit(value, *bit.index);
+    }
+    if (!nomask) {
+      truncated |= !bitset_set_bit(mask, *bit.index);
+    }
+  }
+  return true;
+}
+
+bool ethtool_bitset_decode(
+    const struct nlattr* nest,
+    std::span<__u32> value,
+    std::span<__u32> mask,
+    __u32& size,
+    bool& nomask,
+    bool& truncated) {
+  const struct nlattr *attr, *bit, *battr;
+
+  size = 0;
+  nomask = false;
+  truncated = false;
+  std::fill(value.begin(), value.end(), 0);
+  std::fill(mask.begin(), mask.end(), 0);
+
+  ynl_attr_for_each_nested(attr, nest) {
+    switch (ynl_attr_type(attr)) {
+      case ETHTOOL_A_BITSET_NOMASK:
+        nomask = true;
+        break;
+      case ETHTOOL_A_BITSET_SIZE:
+        size = ynl_attr_get_u32(attr);
+        break;
+      case ETHTOOL_A_BITSET_VALUE:
+        truncated |= bitset_copy_words(
+            value, ynl_attr_data(attr), ynl_attr_data_len(attr));
+        break;
+      case ETHTOOL_A_BITSET_MASK:
+        truncated |= bitset_copy_words(
+            mask, ynl_attr_data(attr), ynl_attr_data_len(attr));
+        break;
+      case ETHTOOL_A_BITSET_BITS:
+        ynl_attr_for_each_nested(bit, attr) {
+          std::optional<__u32> index;
+          bool on = false;
+
+          ynl_attr_for_each_nested(battr, bit) {
+            if (ynl_attr_type(battr) == ETHTOOL_A_BITSET_BIT_INDEX) {
+              index = ynl_attr_get_u32(battr);
+            } else if (ynl_attr_type(battr) == ETHTOOL_A_BITSET_BIT_VALUE) {
+              on = true;
+            }
+          }
+          if (!index) {
+            return false;
+          }
+          /* NOMASK comes first, the kernel puts it before the bits */
+          if (nomask || on) {
+            truncated |= !bitset_set_bit(value, *index);
+          }
+          if (!nomask) {
+            truncated |= !bitset_set_bit(mask, *index);
+          }
+        }
+        break;
+    }
+  }
+  return true;
+}
+
+} // namespace ynl_cpp
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_ETHTOOL_BITSET_H
+#define __YNL_CPP_ETHTOOL_BITSET_H 1
+
+#include <array>
+#include <span>
+
+#include <ynl.hpp>
+
+#include <linux/ethtool.h>
+#include <linux/ethtool_netlink.h>
+
+#include "ethtool-strset.hpp"
+#include "ethtool-user.hpp"
+
+namespace ynl_cpp {
+
+/* Request header asking for compact bitsets in the reply */
+ethtool_header ethtool_compact_header(__u32 ifindex = 0);
+
+/*
+ * Decode a bitset into @value / @mask words, compact or not. Fails if the
+ * bitset is malformed. Bits set past the end of the words are dropped and
+ * flagged in @truncated: kernels newer than the headers know more bits.
+ */
+bool ethtool_bitset_decode(
+    const ethtool_bitset& bs,
+    std::span<__u32> value,
+    std::span<__u32> mask,
+    __u32& size,
+    bool& nomask,
+    bool& truncated);
+bool ethtool_bitset_decode(
+    const struct nlattr* nest,
+    std::span<__u32> value,
+    std::span<__u32> mask,
+    __u32& size,
+    bool& nomask,
+    bool& truncated);
+
+/**
+ * class compact_bitset - ethtool bitset as fixed size words
+ *
+ * Replies to requests carrying ETHTOOL_FLAG_COMPACT_BITSETS (see
+ * ethtool_compact_header()) hold bitsets as value and mask words rather
+ * than a nest per bit with its name. decode() copies the words into
+ * arrays sized for @Bits, so testing and walking bits needs neither
+ * allocations nor names. Names are resolved through a strset_cache only
+ * when asked for, for_each_name(). Verbose bitsets decode too, their
+ * names are ignored.
+ *
+ * Without nomask, the mask tells which bits the set covers (e.g. the
+ * features the device can change) and the value which of them are on.
+ *
+ * Bits past @Bits, e.g. link modes added after the headers this was built
+ * with, are dropped and set truncated.
+ */
+template <size_t Bits>
+class compact_bitset {
+ public:
+  static constexpr size_t words_n = (Bits + 31) / 32;
+
+  /* number of bits of the set, as reported */
+  __u32 size{0};
+  bool nomask{false};
+  /* the set had bits past @Bits, which were dropped */
+  bool truncated{false};
+  std::array<__u32, words_n> value{};
+  std::array<__u32, words_n> mask{};
+
+  bool decode(const ethtool_bitset& bs) {
+    if (!ethtool_bitset_decode(bs, value, mask, size, nomask, truncated)) {
+      return false;
+    }
+    trim();
+    return true;
+  }
+  bool decode(const struct nlattr* nest) {
+    if (!ethtool_bitset_decode(nest, value, mask, size, nomask, truncated)) {
+      return false;
+    }
+    trim();
+    return true;
+  }
+
+  bool test(__u32 bit) const {
+    return bit < Bits && (value[bit / 32] & (1U << (bit % 32)));
+  }
+  bool covers(__u32 bit) const {
+    return bit < Bits && (mask[bit / 32] & (1U << (bit % 32)));
+  }
+  void set(__u32 bit, bool on = true) {
+    if (bit >= Bits) {
+      return;
+    }
+    if (on) {
+      value[bit / 32] |= 1U << (bit % 32);
+    } else {
+      value[bit / 32] &= ~(1U << (bit % 32));
+    }
+    mask[bit / 32] |= 1U << (bit % 32);
+  }
+
+  size_t count() const {
+    size_t n = 0;
+
+    for (__u32 w : value) {
+      n += __builtin_popcount(w);
+    }
+    return n;
+  }
+
+  /* Calls fn(__u32 bit) for every bit set in the value */
+  template <typename F>
+  void for_each(F&& fn) const {
+    for (size_t w = 0; w < words_n; w++) {
+      for (__u32 bits = value[w]; bits; bits &= bits - 1) {
+        fn((__u32)(w * 32 + __builtin_ctz(bits)));
+      }
+    }
+  }
+
+  /* Calls fn(__u32 bit, std::string_view name) for every bit set */
+  template <typename F>
+  result<void> for_each_name(
+      strset_cache& strs,
+      ynl_socket& ys,
+      __u32 ifindex,
+      __u32 set,
+      F&& fn) const {
+    return strs.for_each_bit(ys, ifindex, set, value, fn);
+  }
+
+  /*
+   * As a compact bitset for a request, which changes the bits under the
+   * mask. Clear the mask of a decoded bitset first to change only the
+   * bits passed to set().
+   */
+  ethtool_bitset encode() const {
+    __u32 nbits = size && size < Bits ? size : Bits;
+    const __u8* v = (const __u8*)value.data();
+    const __u8* m = (const __u8*)mask.data();
+    size_t len = (nbits + 31) / 32 * 4;
+    ethtool_bitset bs;
+
+    bs.size = nbits;
+    bs.value.assign(v, v + len);
+    bs.mask.assign(m, m + len);
+    return bs;
+  }
+
+ private:
+  /* Drop the bits of the last word past @Bits */
+  void trim() {
+    if constexpr (Bits % 32) {
+      __u32 tail = ~0U << (Bits % 32);
+
+      truncated |= ((value[words_n - 1] | mask[words_n - 1]) & tail) != 0;
+      value[words_n - 1] &= ~tail;
+      mask[words_n - 1] &= ~tail;
+    }
+  }
+};
+
+using linkmode_bitset = compact_bitset<__ETHTOOL_LINK_MODE_MASK_NBITS>;
+/* netdev features are a 64 bit mask in the kernel */
+using feature_bitset = compact_bitset<64>;
+
+} // namespace ynl_cpp
+
+#endif
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "ethtool-eeprom.hpp"
+
+#include <string.h>
+
+namespace ynl_cpp {
+
+#define CMIS_I2C_ADDRESS 0x50
+
+/* SFF-8024 identifiers of modules managed with CMIS */
+#define SFF8024_ID_QSFP_DD 0x18
+#define SFF8024_ID_OSFP 0x19
+#define SFF8024_ID_DSFP 0x1b
+#define SFF8024_ID_QSFP_PLUS_CMIS 0x1e
+#define SFF8024_ID_SFP_DD_CMIS 0x1f
+#define SFF8024_ID_SFP_PLUS_CMIS 0x20
+
+/* Lower page */
+#define CMIS_FLAT_MEM_OFFSET 0x02
+#define CMIS_FLAT_MEM 0x80
+#define CMIS_TEMP_OFFSET 0x0e
+#define CMIS_VCC_OFFSET 0x10
+/* Page 01h, offsets within the upper half */
+#define CMIS_TX_BIAS_MUL_OFFSET (0xa0 - 0x80)
+#define CMIS_TX_BIAS_MUL_MASK 0x18
+#define CMIS_TX_BIAS_MUL_SHIFT 3
+/* Page 11h, offsets within the upper half */
+#define CMIS_TX_PWR_OFFSET (0x9a - 0x80)
+#define CMIS_TX_BIAS_OFFSET (0xaa - 0x80)
+#define CMIS_RX_PWR_OFFSET (0xba - 0x80)
+
+/* Where each cached half lives, and whether CMIS lets it change */
+static const struct {
+  __u8 page;
+  __u32 offset;
+  bool dynamic;
+} cmis_halves[cmis_half_cnt] = {
+    {0x00, 0, true},              /* cmis_lower */
+    {0x00, cmis_half_len, false}, /* cmis_page_00h */
+    {0x01, cmis_half_len, false}, /* cmis_page_01h */
+    {0x02, cmis_half_len, false}, /* cmis_page_02h */
+    {0x11, cmis_half_len, true},  /* cmis_page_11h */
+};
+
+/* Multi byte fields are big endian */
+static __u16 cmis_u16(const __u8* p) {
+  return p[0] << 8 | p[1];
+}
+
+std::optional<__u8> module_eeprom::identifier() const {
+  if (!has(cmis_lower)) {
+    return std::nullopt;
+  }
+  return mem[cmis_lower][0];
+}
+
+bool module_eeprom::cmis() const {
+  switch (identifier().value_or(0)) {
+    case SFF8024_ID_QSFP_DD:
+    case SFF8024_ID_OSFP:
+    case SFF8024_ID_DSFP:
+    case SFF8024_ID_QSFP_PLUS_CMIS:
+    case SFF8024_ID_SFP_DD_CMIS:
+    case SFF8024_ID_SFP_PLUS_CMIS:
+      return true;
+  }
+  return false;
+}
+
+bool module_eeprom::flat() const {
+  return has(cmis_lower) &&
+      (mem[cmis_lower][CMIS_FLAT_MEM_OFFSET] & CMIS_FLAT_MEM);
+}
+
+std::optional<__s16> module_eeprom::temperature() const {
+  if (!cmis()) {
+    return std::nullopt;
+  }
+  return (__s16)cmis_u16(&mem[cmis_lower][CMIS_TEMP_OFFSET]);
+}
+
+std::optional<__u16> module_eeprom::vcc() const {
+  if (!cmis()) {
+    return std::nullopt;
+  }
+  return cmis_u16(&mem[cmis_lower][CMIS_VCC_OFFSET]);
+}
+
+std::optional<__u16> module_eeprom::tx_power(unsigned int lane) const {
+  if (!cmis() || !has(cmis_page_11h) || lane >= cmis_lanes) {
+    return std::nullopt;
+  }
+  return cmis_u16(&mem[cmis_page_11h][CMIS_TX_PWR_OFFSET + lane * 2]);
+}
+
+std::optional<__u16> module_eeprom::rx_power(unsigned int lane) const {
+  if (!cmis() || !has(cmis_page_11h) || lane >= cmis_lanes) {
+    return std::nullopt;
+  }
+  return cmis_u16(&mem[cmis_page_11h][CMIS_RX_PWR_OFFSET + lane * 2]);
+}
+
+std::optional<__u32> module_eeprom::tx_bias(unsigned int lane) const {
+  unsigned int shift;
+  __u32 bias;
+
+  if (!cmis() || !has(cmis_page_11h) || !has(cmis_page_01h) ||
+      lane >= cmis_lanes) {
+    return std::nullopt;
+  }
+  /* 2 uA units, times the multiplier the module advertises */
+  shift = mem[cmis_page_01h][CMIS_TX_BIAS_MUL_OFFSET] & CMIS_TX_BIAS_MUL_MASK;
+  shift >>= CMIS_TX_BIAS_MUL_SHIFT;
+  bias = cmis_u16(&mem[cmis_page_11h][CMIS_TX_BIAS_OFFSET + lane * 2]);
+  return bias * 2 << shift;
+}
+
+/* Whether @mod has @half at all, going by its lower page */
+static bool module_has_half(const module_eeprom& mod, unsigned int half) {
+  if (half == cmis_lower || half == cmis_page_00h) {
+    return true;
+  }
+  return mod.cmis() && !mod.flat();
+}
+
+module_eeprom_reader::module_eeprom_reader(size_t window)
+    : window_(window) {}
+
+bool module_eeprom_reader::plan(std::span<module_eeprom> mods) {
+  slots_.clear();
+
+  for (size_t i = 0; i < mods.size(); i++) {
+    module_eeprom& mod = mods[i];
+
+    /*
+     * The lower page first, then what it says the module has, so the
+     * first read of a module takes two rounds, later reads one.
+     */
+    for (unsigned int h = 0; h < cmis_half_cnt; h++) {
+      if (asked_[i] & (1U << h)) {
+        continue;
+      }
+      if (h != cmis_lower) {
+        if (!mod.has(cmis_lower) || !module_has_half(mod, h)) {
+          continue;
+        }
+        if (!cmis_halves[h].dynamic && mod.has((cmis_half)h)) {
+          continue;
+        }
+      }
+      asked_[i] |= 1U << h;
+      slots_.push_back({i, (cmis_half)h});
+    }
+  }
+  return !slots_.empty();
+}
+
+result<void> module_eeprom_reader::round(std::span<module_eeprom> mods) {
+  msg_batch& batch = *batch_;
+
+  batch.clear();
+  for (const auto& s : slots_) {
+    struct nlmsghdr* nlh =
+        batch.gemsg_start(ETHTOOL_MSG_MODULE_EEPROM_GET, ETHTOOL_GENL_VERSION);
+    const auto& where = cmis_halves[s.half];
+    struct nlattr* nest;
+
+    /* The generated request lacks the attributes selecting the page */
+    nest = ynl_attr_nest_start(nlh, ETHTOOL_A_MODULE_EEPROM_HEADER);
+    ynl_attr_put_u32(nlh, ETHTOOL_A_HEADER_DEV_INDEX, mods[s.mod].ifindex);
+    ynl_attr_nest_end(nlh, nest);
+    ynl_attr_put_u32(nlh, ETHTOOL_A_MODULE_EEPROM_OFFSET, where.offset);
+    ynl_attr_put_u32(nlh, ETHTOOL_A_MODULE_EEPROM_LENGTH, cmis_half_len);
+    ynl_attr_put_u8(nlh, ETHTOOL_A_MODULE_EEPROM_PAGE, where.page);
+    ynl_attr_put_u8(nlh, ETHTOOL_A_MODULE_EEPROM_BANK, 0);
+    ynl_attr_put_u8(nlh, ETHTOOL_A_MODULE_EEPROM_I2C_ADDRESS, CMIS_I2C_ADDRESS);
+    auto idx = batch.msg_end(nlh, &ethtool_module_eeprom_nest);
+    if (!idx) {
+      return std::unexpected(idx.error());
+    }
+  }
+  requests_ += slots_.size();
+
+  auto failures = batch.send_recv(
+      [&](size_t i, const struct nlmsghdr* nlh) {
+        module_eeprom& mod = mods[slots_[i].mod];
+        cmis_half half = slots_[i].half;
+        const struct nlattr* attr;
+
+        ynl_attr_for_each(attr, nlh, sizeof(struct genlmsghdr)) {
+          if (ynl_attr_type(attr) != ETHTOOL_A_MODULE_EEPROM_DATA) {
+            continue;
+          }
+          if (ynl_attr_data_len(attr) != cmis_half_len) {
+            return false;
+          }
+          /* A different module was plugged in, static pages are stale */
+          if (half == cmis_lower && mod.has(cmis_lower) &&
+              mod.mem[cmis_lower][0] != *(const __u8*)ynl_attr_data(attr)) {
+            mod.invalidate();
+          }
+          memcpy(mod.mem[half].data(), ynl_attr_data(attr), cmis_half_len);
+          mod.valid |= 1U << half;
+          return true;
+        }
+        return false;
+      },
+      window_);
+  if (!failures) {
+    return std::unexpected(failures.error());
+  }
+
+  for (const auto& f : *failures) {
+    module_eeprom& mod = mods[slots_[f.index].mod];
+
+    /* No module, or it doesn't answer: forget it. Missing pages stay so */
+    if (slots_[f.index].half == cmis_lower) {
+      mod.valid = 0;
+    } else {
+      mod.valid &= ~(1U << slots_[f.index].half);
+    }
+    mod.err = f.err;
+  }
+  return {};
+}
+
+result<void>
+module_eeprom_reader::read(ynl_socket& ys, std::span<module_eeprom> mods) {
+  if (!batch_ || batch_ys_ != (struct ynl_sock*)ys) {
+    batch_.emplace(ys);
+    batch_ys_ = ys;
+  }
+
+  requests_ = 0;
+  asked_.assign(mods.size(), 0);
+  for (auto& mod : mods) {
+    mod.err.reset();
+  }
+
+  while (plan(mods)) {
+    auto ret = round(mods);
+    if (!ret) {
+      return ret;
+    }
+  }
+  return {};
+}
+
+} // namespace ynl_cpp
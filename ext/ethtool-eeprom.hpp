@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_ETHTOOL_EEPROM_H
+#define __YNL_CPP_ETHTOOL_EEPROM_H 1
+
+#include <array>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "ethtool-user.hpp"
+
+namespace ynl_cpp {
+
+/* Module memory is read in halves of a 256 byte page */
+inline constexpr size_t cmis_half_len = 128;
+inline constexpr unsigned int cmis_lanes = 8;
+
+/* Half pages a module_eeprom caches, see cmis_halves in the .cpp */
+enum cmis_half {
+  /* page 00h bytes 0-127: identifier, state, module monitors */
+  cmis_lower,
+  /* page 00h upper: vendor, part number, serial */
+  cmis_page_00h,
+  /* page 01h: advertising, monitor scaling */
+  cmis_page_01h,
+  /* page 02h: monitor thresholds */
+  cmis_page_02h,
+  /* page 11h, bank 0: lane states and monitors */
+  cmis_page_11h,
+  cmis_half_cnt,
+};
+
+/**
+ * struct module_eeprom - cached memory of the module (optics) of a port
+ *
+ * Owned by the caller, one per port, and filled in place by a
+ * module_eeprom_reader. Accessors decode the common CMIS DOM (digital
+ * optical monitoring) fields straight from the cached bytes. They return
+ * nothing unless the module is CMIS, has paged memory where needed and
+ * the half pages were read.
+ */
+struct module_eeprom {
+  __u32 ifindex{0};
+  /* 1 << cmis_half of the halves holding data */
+  __u32 valid{0};
+  /* error of the last read, if the module couldn't be read at all */
+  std::optional<error> err{};
+  std::array<std::array<__u8, cmis_half_len>, cmis_half_cnt> mem{};
+
+  bool has(cmis_half half) const {
+    return valid & (1U << half);
+  }
+  const __u8* half(cmis_half half) const {
+    return has(half) ? mem[half].data() : nullptr;
+  }
+  /* SFF-8024 identifier, lower page byte 0 */
+  std::optional<__u8> identifier() const;
+  bool cmis() const;
+  /* Only page 00h exists */
+  bool flat() const;
+  /* Forget the static pages, e.g. after the module was replaced */
+  void invalidate() {
+    valid &= 1U << cmis_lower;
+  }
+
+  /* Module temperature, in 1/256 degrees C */
+  std::optional<__s16> temperature() const;
+  /* Supply voltage, in 100 uV */
+  std::optional<__u16> vcc() const;
+  /* Per lane (0 - 7) optical power, in 0.1 uW, and tx bias in uA */
+  std::optional<__u16> tx_power(unsigned int lane) const;
+  std::optional<__u16> rx_power(unsigned int lane) const;
+  std::optional<__u32> tx_bias(unsigned int lane) const;
+};
+
+/**
+ * class module_eeprom_reader - read module memory of many ports at once
+ *
+ * read() sends the module-eeprom-get request of every half page wanted
+ * for all ports as one pipelined msg_batch, and copies each reply into
+ * its module_eeprom. Pages 00h upper, 01h and 02h are static in CMIS and
+ * are only read once per module (or after invalidate()). The lower page
+ * and page 11h hold the monitors and are read every time, so steady state
+ * DOM polling costs two requests per port.
+ *
+ * The first read of a port learns from the lower page whether the module
+ * has paged memory, and only then asks for the upper pages, in a second
+ * round. A port whose lower page can't be read gets err set and its cache
+ * dropped; a half page which fails sets err and stays invalid.
+ */
+class module_eeprom_reader {
+ public:
+  explicit module_eeprom_reader(size_t window = 64);
+
+  result<void> read(ynl_socket& ys, std::span<module_eeprom> mods);
+
+  /* Requests sent by the last read() */
+  size_t requests() const {
+    return requests_;
+  }
+
+ private:
+  /* half pages of @mods to ask for in this round */
+  struct slot {
+    size_t mod;
+    cmis_half half;
+  };
+
+  bool plan(std::span<module_eeprom> mods);
+  result<void> round(std::span<module_eeprom> mods);
+
+  size_t window_;
+  size_t requests_{0};
+  std::vector<slot> slots_;
+  /* per port, 1 << cmis_half of the halves asked for by this read */
+  std::vector<__u32> asked_;
+  /* the batch, kept for its buffer while the socket stays the same */
+  std::optional<msg_batch> batch_;
+  struct ynl_sock* batch_ys_{nullptr};
+};
+
+} // namespace ynl_cpp
+
+#endif
@@ -0,0 +1,303 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "ethtool-rss.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace ynl_cpp {
+
+/*
+ * Tables are compared as they are, a few KiB at most. memcmp() is
+ * vectorized by libc and stops at the first difference.
+ */
+template <typename T>
+static bool
+rss_array_equal(const std::vector<T>& want, const std::vector<T>& cur) {
+  return want.size() == cur.size() &&
+      !memcmp(want.data(), cur.data(), want.size() * sizeof(T));
+}
+
+rss_tables::rss_tables(size_t window) : window_(window) {}
+
+msg_batch& rss_tables::batch_for(ynl_socket& ys) {
+  if (!batch_ || batch_ys_ != (struct ynl_sock*)ys) {
+    batch_.emplace(ys);
+    batch_ys_ = ys;
+  }
+  return *batch_;
+}
+
+/* Decode an rss-get reply straight into the held context */
+bool rss_tables::parse(const struct nlmsghdr* nlh) {
+  const struct nlattr *attr, *field;
+  __u32 ifindex = 0, context = 0;
+
+  ynl_attr_for_each(attr, nlh, sizeof(struct genlmsghdr)) {
+    if (ynl_attr_type(attr) == ETHTOOL_A_RSS_HEADER) {
+      ynl_attr_for_each_nested(field, attr) {
+        if (ynl_attr_type(field) == ETHTOOL_A_HEADER_DEV_INDEX) {
+          ifindex = ynl_attr_get_u32(field);
+        }
+      }
+    } else if (ynl_attr_type(attr) == ETHTOOL_A_RSS_CONTEXT) {
+      context = ynl_attr_get_u32(attr);
+    }
+  }
+  if (!ifindex) {
+    return false;
+  }
+
+  rss_context& ctx = held_[key(ifindex, context)];
+
+  ctx.ifindex = ifindex;
+  ctx.context = context;
+  ctx.hfunc.reset();
+  ctx.input_xfrm.reset();
+  ctx.indir.clear();
+  ctx.hkey.clear();
+  ynl_attr_for_each(attr, nlh, sizeof(struct genlmsghdr)) {
+    size_t len = ynl_attr_data_len(attr);
+
+    switch (ynl_attr_type(attr)) {
+      case ETHTOOL_A_RSS_HFUNC:
+        ctx.hfunc = ynl_attr_get_u32(attr);
+        break;
+      case ETHTOOL_A_RSS_INPUT_XFRM:
+        ctx.input_xfrm = ynl_attr_get_u32(attr);
+        break;
+      case ETHTOOL_A_RSS_INDIR:
+        if (len % sizeof(__u32)) {
+          return false;
+        }
+        ctx.indir.resize(len / sizeof(__u32));
+        memcpy(ctx.indir.data(), ynl_attr_data(attr), len);
+        break;
+      case ETHTOOL_A_RSS_HKEY:
+        ctx.hkey.assign(
+            (const __u8*)ynl_attr_data(attr),
+            (const __u8*)ynl_attr_data(attr) + len);
+        break;
+    }
+  }
+  return true;
+}
+
+result<void> rss_tables::refresh(ynl_socket& ys) {
+  struct ynl_sock* sock = ys;
+  struct nlmsghdr* nlh;
+
+  held_.clear();
+  /* No header, so all contexts of all devices */
+  nlh = ynl_gemsg_start_dump(
+      sock, sock->family_id, ETHTOOL_MSG_RSS_GET, ETHTOOL_GENL_VERSION);
+  sock->req_policy = &ethtool_rss_nest;
+  sock->req_hdr_len = sizeof(struct genlmsghdr);
+  return dump_raw(
+      sock, nlh, ETHTOOL_MSG_RSS_GET_REPLY, [this](const struct nlmsghdr* rsp) {
+        return parse(rsp);
+      });
+}
+
+void rss_tables::assume(const rss_context& ctx) {
+  held_[key(ctx.ifindex, ctx.context)] = ctx;
+}
+
+void rss_tables::forget(__u32 ifindex) {
+  std::erase_if(
+      held_, [ifindex](const auto& it) { return it.first >> 32 == ifindex; });
+}
+
+const rss_context* rss_tables::find(__u32 ifindex, __u32 context) const {
+  auto it = held_.find(key(ifindex, context));
+
+  return it == held_.end() ? nullptr : &it->second;
+}
+
+/* Read the contexts of @wants which aren't held yet, with one batch */
+result<std::vector<msg_batch::failure>>
+rss_tables::fetch(ynl_socket& ys, std::span<const rss_context> wants) {
+  msg_batch& batch = batch_for(ys);
+
+  batch.clear();
+  pending_.clear();
+  for (size_t i = 0; i < wants.size(); i++) {
+    if (held_.contains(key(wants[i].ifindex, wants[i].context))) {
+      continue;
+    }
+
+    struct nlmsghdr* nlh =
+        batch.gemsg_start(ETHTOOL_MSG_RSS_GET, ETHTOOL_GENL_VERSION);
+    struct nlattr* nest;
+
+    nest = ynl_attr_nest_start(nlh, ETHTOOL_A_RSS_HEADER);
+    ynl_attr_put_u32(nlh, ETHTOOL_A_HEADER_DEV_INDEX, wants[i].ifindex);
+    ynl_attr_nest_end(nlh, nest);
+    if (wants[i].context) {
+      ynl_attr_put_u32(nlh, ETHTOOL_A_RSS_CONTEXT, wants[i].context);
+    }
+    auto idx = batch.msg_end(nlh, &ethtool_rss_nest);
+    if (!idx) {
+      return std::unexpected(idx.error());
+    }
+    pending_.push_back(i);
+  }
+  if (pending_.empty()) {
+    return {};
+  }
+
+  auto failures = batch.send_recv(
+      [this](size_t, const struct nlmsghdr* nlh) { return parse(nlh); },
+      window_);
+  if (!failures) {
+    return failures;
+  }
+  for (auto& f : *failures) {
+    f.index = pending_[f.index];
+  }
+  return failures;
+}
+
+/*
+ * Add the rss-set of the attributes of @want which differ from the held
+ * context, returns false (and adds nothing) if none do.
+ */
+result<bool> rss_tables::encode(msg_batch& batch, const rss_context& want) {
+  const rss_context& cur = held_.at(key(want.ifindex, want.context));
+  bool hfunc = want.hfunc && want.hfunc != cur.hfunc;
+  bool xfrm = want.input_xfrm && want.input_xfrm != cur.input_xfrm;
+  bool indir = !want.indir.empty() && !rss_array_equal(want.indir, cur.indir);
+  bool hkey = !want.hkey.empty() && !rss_array_equal(want.hkey, cur.hkey);
+
+  /* The device would reject it, or worse, take a prefix */
+  if (indir && !cur.indir.empty() && want.indir.size() != cur.indir.size()) {
+    struct ynl_error yerr = {};
+
+    yerr.code = (enum ynl_error_code)EINVAL;
+    snprintf(
+        yerr.msg,
+        sizeof(yerr.msg),
+        "Indirection table of %zu entries, the device has %zu",
+        want.indir.size(),
+        cur.indir.size());
+    return std::unexpected(error(yerr));
+  }
+  if (!hfunc && !xfrm && !indir && !hkey) {
+    return false;
+  }
+
+  /* Reused, so the arrays keep their buffers from one set to the next */
+  ethtool_rss_set_req& req = set_req_;
+  const __u8* table = (const __u8*)want.indir.data();
+
+  req.header.emplace().dev_index = want.ifindex;
+  req.context.reset();
+  if (want.context) {
+    req.context = want.context;
+  }
+  req.hfunc = hfunc ? want.hfunc : std::nullopt;
+  req.input_xfrm = xfrm ? want.input_xfrm : std::nullopt;
+  req.indir.clear();
+  if (indir) {
+    req.indir.assign(table, table + want.indir.size() * sizeof(__u32));
+  }
+  req.hkey.clear();
+  if (hkey) {
+    req.hkey.assign(want.hkey.begin(), want.hkey.end());
+  }
+
+  auto idx = ethtool_rss_set_batch(batch, req);
+  if (!idx) {
+    return std::unexpected(idx.error());
+  }
+  return true;
+}
+
+/* @want was applied, fold it into the held context */
+void rss_tables::commit(const rss_context& want) {
+  rss_context& cur = held_.at(key(want.ifindex, want.context));
+
+  if (want.hfunc) {
+    cur.hfunc = want.hfunc;
+  }
+  if (want.input_xfrm) {
+    cur.input_xfrm = want.input_xfrm;
+  }
+  if (!want.indir.empty()) {
+    cur.indir = want.indir;
+  }
+  if (!want.hkey.empty()) {
+    cur.hkey = want.hkey;
+  }
+}
+
+result<std::vector<msg_batch::failure>>
+rss_tables::update(ynl_socket& ys, std::span<const rss_context> wants) {
+  auto failures = fetch(ys, wants);
+  if (!failures) {
+    return failures;
+  }
+
+  failed_.assign(wants.size(), false);
+  for (const auto& f : *failures) {
+    failed_[f.index] = true;
+  }
+
+  msg_batch& batch = batch_for(ys);
+
+  batch.clear();
+  pending_.clear();
+  for (size_t i = 0; i < wants.size(); i++) {
+    if (failed_[i]) {
+      continue;
+    }
+    auto ret = encode(batch, wants[i]);
+    if (!ret) {
+      return std::unexpected(ret.error());
+    }
+    if (*ret) {
+      pending_.push_back(i);
+    } else {
+      unchanged_++;
+    }
+  }
+  if (pending_.empty()) {
+    return failures;
+  }
+
+  auto sets = batch.send();
+  if (!sets) {
+    /* Which sets were applied is unknown, read them again next time */
+    for (size_t i : pending_) {
+      held_.erase(key(wants[i].ifindex, wants[i].context));
+    }
+    return std::unexpected(sets.error());
+  }
+  sets_ += pending_.size();
+
+  for (auto& f : *sets) {
+    f.index = pending_[f.index];
+    failed_[f.index] = true;
+    failures->push_back(std::move(f));
+  }
+  for (size_t i : pending_) {
+    if (!failed_[i]) {
+      commit(wants[i]);
+    }
+  }
+  return failures;
+}
+
+result<bool> rss_tables::update(ynl_socket& ys, const rss_context& want) {
+  size_t sent = sets_;
+
+  auto failures = update(ys, std::span(&want, 1));
+  if (!failures) {
+    return std::unexpected(failures.error());
+  }
+  if (!failures->empty()) {
+    return std::unexpected(failures->front().err);
+  }
+  return sets_ != sent;
+}
+
+} // namespace ynl_cpp
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_ETHTOOL_RSS_H
+#define __YNL_CPP_ETHTOOL_RSS_H 1
+
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "ethtool-user.hpp"
+
+namespace ynl_cpp {
+
+/**
+ * struct rss_context - RSS configuration of one context of a device
+ *
+ * Context 0 is the device's default one. As a wanted configuration, unset
+ * @hfunc / @input_xfrm and empty @indir / @hkey leave the current value.
+ * @indir holds the queue of every indirection table entry, it has to have
+ * the size of the device's table, update() fails with EINVAL before
+ * sending any set if it doesn't.
+ */
+struct rss_context {
+  __u32 ifindex{0};
+  __u32 context{0};
+  /* ETH_RSS_HASH_* bit of the hash function */
+  std::optional<__u32> hfunc{};
+  /* RXH_XFRM_* */
+  std::optional<__u32> input_xfrm{};
+  std::vector<__u32> indir{};
+  std::vector<__u8> hkey{};
+};
+
+/**
+ * class rss_tables - RSS configurations held to update them minimally
+ *
+ * Holds the current configuration of each (device, context), as read by
+ * refresh() or written through the table. update() compares a wanted
+ * configuration with the held one on the raw arrays, with no decoding or
+ * intermediate objects. It sends one rss-set message carrying only the
+ * attributes that differ, or nothing if none do. The bulk update() does
+ * this for many contexts of many devices with one pipelined msg_batch.
+ * It first fetches, also pipelined, the contexts not held yet.
+ *
+ * A failed set leaves the held configuration as it was. Changes made by
+ * others are not followed, refresh() or forget() them.
+ *
+ * Not thread safe.
+ */
+class rss_tables {
+ public:
+  explicit rss_tables(size_t window = 64);
+
+  /* Re-read the contexts of all devices, dropping anything else held */
+  result<void> refresh(ynl_socket& ys);
+  /* Record @ctx as current, e.g. when it was set by other means */
+  void assume(const rss_context& ctx);
+  void forget(__u32 ifindex);
+
+  const rss_context* find(__u32 ifindex, __u32 context) const;
+
+  /* Apply @want, returns whether a message had to be sent */
+  result<bool> update(ynl_socket& ys, const rss_context& want);
+  /*
+   * Apply all of @wants, which must name different contexts. Failures
+   * index @wants, the contexts which failed keep their configuration.
+   */
+  result<std::vector<msg_batch::failure>>
+  update(ynl_socket& ys, std::span<const rss_context> wants);
+
+  /* rss-set messages sent and skipped as unchanged, since construction */
+  size_t sets() const {
+    return sets_;
+  }
+  size_t unchanged() const {
+    return unchanged_;
+  }
+
+ private:
+  static __u64 key(__u32 ifindex, __u32 context) {
+    return ((__u64)ifindex << 32) | context;
+  }
+
+  msg_batch& batch_for(ynl_socket& ys);
+  bool parse(const struct nlmsghdr* nlh);
+  result<std::vector<msg_batch::failure>>
+  fetch(ynl_socket& ys, std::span<const rss_context> wants);
+  result<bool> encode(msg_batch& batch, const rss_context& want);
+  void commit(const rss_context& want);
+
+  size_t window_;
+  std::unordered_map<__u64, rss_context> held_;
+  size_t sets_{0};
+  size_t unchanged_{0};
+  /* indexes into the wants of the current update */
+  std::vector<size_t> pending_;
+  std::vector<bool> failed_;
+  ethtool_rss_set_req set_req_;
+  /* the batch, kept for its buffer while the socket stays the same */
+  std::optional<msg_batch> batch_;
+  struct ynl_sock* batch_ys_{nullptr};
+};
+
+} // namespace ynl_cpp
+
+#endif
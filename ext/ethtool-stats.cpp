@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "ethtool-stats.hpp"
+
+#include <algorithm>
+
+namespace ynl_cpp {
+
+size_t ethtool_stats_hash::operator()(__u32 ifindex) const {
+  __u64 h = ifindex * 0x9e3779b97f4a7c15ULL;
+
+  return h ^ (h >> 29);
+}
+
+ethtool_stats_scraper::ethtool_stats_scraper(__u32 groups)
+    : groups_(groups), index_(256) {}
+
+void ethtool_stats_scraper::reserve(size_t n) {
+  devs.reserve(n);
+
+  index_.reserve(size(), n, [this](size_t i) { return devs[i].ifindex; });
+}
+
+void ethtool_stats_scraper::clear() {
+  devs.clear();
+  index_.clear();
+}
+
+std::optional<size_t> ethtool_stats_scraper::find(__u32 ifindex) const {
+  return index_.find(ifindex, [this](size_t i) { return devs[i].ifindex; });
+}
+
+static bool
+ethtool_stats_hist(ethtool_rmon_hist& hist, const struct nlattr* nest) {
+  const struct nlattr* attr;
+  __u32 low = 0, high = 0;
+  __u64 val = 0;
+
+  ynl_attr_for_each_nested(attr, nest) {
+    switch (ynl_attr_type(attr)) {
+      case ETHTOOL_A_STATS_GRP_HIST_BKT_LOW:
+        low = ynl_attr_get_u32(attr);
+        break;
+      case ETHTOOL_A_STATS_GRP_HIST_BKT_HI:
+        high = ynl_attr_get_u32(attr);
+        break;
+      case ETHTOOL_A_STATS_GRP_HIST_VAL:
+        if (ynl_attr_data_len(attr) != sizeof(__u64)) {
+          return false;
+        }
+        val = ynl_attr_get_u64(attr);
+        break;
+    }
+  }
+  /* More buckets than the kernel has today, keep the ones which fit */
+  if (hist.n < ethtool_rmon_hist_max) {
+    hist.low[hist.n] = low;
+    hist.high[hist.n] = high;
+    hist.val[hist.n] = val;
+    hist.n++;
+  }
+  return true;
+}
+
+bool ethtool_stats_scraper::add_grp(
+    ethtool_std_stats& st, const struct nlattr* grp) {
+  const struct nlattr *attr, *stat;
+  __u64* vals = nullptr;
+  bool any = false;
+  size_t n = 0;
+  __u32 id = 0;
+
+  /* The id comes first, everything else depends on it */
+  ynl_attr_for_each_nested(attr, grp) {
+    if (ynl_attr_type(attr) != ETHTOOL_A_STATS_GRP_ID) {
+      continue;
+    }
+    id = ynl_attr_get_u32(attr);
+    switch (id) {
+      case ETHTOOL_STATS_ETH_PHY:
+        vals = st.eth_phy;
+        n = __ETHTOOL_A_STATS_ETH_PHY_CNT;
+        break;
+      case ETHTOOL_STATS_ETH_MAC:
+        vals = st.eth_mac;
+        n = __ETHTOOL_A_STATS_ETH_MAC_CNT;
+        break;
+      case ETHTOOL_STATS_ETH_CTRL:
+        vals = st.eth_ctrl;
+        n = __ETHTOOL_A_STATS_ETH_CTRL_CNT;
+        break;
+      case ETHTOOL_STATS_RMON:
+        vals = st.rmon;
+        n = __ETHTOOL_A_STATS_RMON_CNT;
+        break;
+      case ETHTOOL_STATS_PHY:
+        vals = st.phy;
+        n = __ETHTOOL_A_STATS_PHY_CNT;
+        break;
+      default:
+        /* a group newer than us */
+        return true;
+    }
+    break;
+  }
+  if (!vals) {
+    return false;
+  }
+
+  ynl_attr_for_each_nested(attr, grp) {
+    switch (ynl_attr_type(attr)) {
+      case ETHTOOL_A_STATS_GRP_STAT:
+        /* one counter per nest, its attr type is the counter id */
+        ynl_attr_for_each_nested(stat, attr) {
+          if (ynl_attr_data_len(stat) != sizeof(__u64)) {
+            continue; /* padding */
+          }
+          if (ynl_attr_type(stat) < n) {
+            vals[ynl_attr_type(stat)] = ynl_attr_get_u64(stat);
+            any = true;
+          }
+        }
+        break;
+      case ETHTOOL_A_STATS_GRP_HIST_RX:
+        if (!ethtool_stats_hist(st.rmon_rx, attr)) {
+          return false;
+        }
+        any = true;
+        break;
+      case ETHTOOL_A_STATS_GRP_HIST_TX:
+        if (!ethtool_stats_hist(st.rmon_tx, attr)) {
+          return false;
+        }
+        any = true;
+        break;
+    }
+  }
+  /* The kernel sends every group asked for, even if it has no counters */
+  if (any) {
+    st.groups |= 1U << id;
+  }
+  return true;
+}
+
+bool ethtool_stats_scraper::add(const struct nlmsghdr* nlh) {
+  const struct nlattr *attr, *hattr;
+  std::optional<__u32> ifindex;
+  ethtool_std_stats* st;
+
+  ynl_attr_for_each(attr, nlh, sizeof(struct genlmsghdr)) {
+    if (ynl_attr_type(attr) != ETHTOOL_A_STATS_HEADER) {
+      continue;
+    }
+    ynl_attr_for_each_nested(hattr, attr) {
+      if (ynl_attr_type(hattr) == ETHTOOL_A_HEADER_DEV_INDEX) {
+        ifindex = ynl_attr_get_u32(hattr);
+      }
+    }
+  }
+  if (!ifindex) {
+    return false;
+  }
+
+  if (auto row = find(*ifindex)) {
+    st = &devs[*row];
+  } else {
+    st = &devs.emplace_back();
+    st->ifindex = *ifindex;
+    index_.add(size(), devs.capacity(), [this](size_t i) {
+      return devs[i].ifindex;
+    });
+  }
+  st->groups = 0;
+  std::ranges::fill(st->eth_phy, ethtool_stat_not_set);
+  std::ranges::fill(st->eth_mac, ethtool_stat_not_set);
+  std::ranges::fill(st->eth_ctrl, ethtool_stat_not_set);
+  std::ranges::fill(st->rmon, ethtool_stat_not_set);
+  std::ranges::fill(st->phy, ethtool_stat_not_set);
+  st->rmon_rx.n = 0;
+  st->rmon_tx.n = 0;
+
+  ynl_attr_for_each(attr, nlh, sizeof(struct genlmsghdr)) {
+    if (ynl_attr_type(attr) == ETHTOOL_A_STATS_GRP && !add_grp(*st, attr)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+result<void> ethtool_stats_scraper::scrape(ynl_socket& ys) {
+  if (!tmpl_ || tmpl_ys_ != (struct ynl_sock*)ys) {
+    ethtool_stats_get_req_dump req;
+
+    req.header.emplace();
+    req.groups.emplace();
+    req.groups->nomask = true;
+    req.groups->size = __ETHTOOL_STATS_CNT;
+    req.groups->value.assign(
+        (const __u8*)&groups_, (const __u8*)&groups_ + sizeof(groups_));
+
+    auto tmpl = ethtool_stats_get_dump_prepare(ys, req);
+    if (!tmpl) {
+      return std::unexpected(tmpl.error());
+    }
+    tmpl_ = std::move(*tmpl);
+    tmpl_ys_ = ys;
+  }
+
+  clear();
+  return dump_raw(
+      ys,
+      ynl_msg_reuse(ys, tmpl_->nlh()),
+      ETHTOOL_MSG_STATS_GET_REPLY,
+      [this](const struct nlmsghdr* nlh) { return add(nlh); });
+}
+
+} // namespace ynl_cpp
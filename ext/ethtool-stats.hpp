@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_ETHTOOL_STATS_H
+#define __YNL_CPP_ETHTOOL_STATS_H 1
+
+#include <optional>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "ethtool-user.hpp"
+#include "ynl-row-index.hpp"
+
+namespace ynl_cpp {
+
+/* Counters the device doesn't report */
+inline constexpr __u64 ethtool_stat_not_set = ~0ULL;
+/* ETHTOOL_RMON_HIST_MAX of the kernel */
+inline constexpr size_t ethtool_rmon_hist_max = 10;
+
+/* RMON packet size histogram, bucket i counts sizes [low[i], high[i]] */
+struct ethtool_rmon_hist {
+  __u32 n;
+  __u32 low[ethtool_rmon_hist_max];
+  __u32 high[ethtool_rmon_hist_max];
+  __u64 val[ethtool_rmon_hist_max];
+};
+
+/*
+ * Standard stats of one device. Counters are indexed by their attribute,
+ * e.g. eth_mac[ETHTOOL_A_STATS_ETH_MAC_5_RX_PKT], and hold
+ * ethtool_stat_not_set if the driver doesn't have them.
+ */
+struct ethtool_std_stats {
+  __u32 ifindex;
+  /* 1 << ETHTOOL_STATS_* of the groups with at least one counter */
+  __u32 groups;
+  __u64 eth_phy[__ETHTOOL_A_STATS_ETH_PHY_CNT];
+  __u64 eth_mac[__ETHTOOL_A_STATS_ETH_MAC_CNT];
+  __u64 eth_ctrl[__ETHTOOL_A_STATS_ETH_CTRL_CNT];
+  __u64 rmon[__ETHTOOL_A_STATS_RMON_CNT];
+  __u64 phy[__ETHTOOL_A_STATS_PHY_CNT];
+  ethtool_rmon_hist rmon_rx;
+  ethtool_rmon_hist rmon_tx;
+};
+
+struct ethtool_stats_hash {
+  size_t operator()(__u32 ifindex) const;
+};
+
+/**
+ * class ethtool_stats_scraper - standard stats of all devices, flat
+ *
+ * scrape() asks for the chosen stats groups (IEEE 802.3 PHY, MAC and MAC
+ * control, RMON, PHY) of every device with one stats-get dump, and decodes
+ * each reply straight into an ethtool_std_stats record, histogram buckets
+ * included. The generated parser can't: the reply carries a nest per
+ * group and a nest per counter. The request is encoded once and reused,
+ * records are overwritten in place, so steady state scrapes don't
+ * allocate.
+ *
+ * Device i is devs[i], devices are indexed by ifindex, see find().
+ */
+class ethtool_stats_scraper {
+ public:
+  /* @groups: 1 << ETHTOOL_STATS_* */
+  explicit ethtool_stats_scraper(
+      __u32 groups = (1U << __ETHTOOL_STATS_CNT) - 1);
+
+  size_t size() const {
+    return devs.size();
+  }
+
+  /* Preallocate room for @n devices */
+  void reserve(size_t n);
+
+  /* Forget all devices, memory is kept for the next scrape */
+  void clear();
+
+  /* Decode one stats-get reply, false if malformed */
+  bool add(const struct nlmsghdr* nlh);
+
+  std::optional<size_t> find(__u32 ifindex) const;
+
+  /* Replace the contents with the stats of all devices */
+  result<void> scrape(ynl_socket& ys);
+
+  std::vector<ethtool_std_stats> devs;
+
+ private:
+  bool add_grp(ethtool_std_stats& st, const struct nlattr* grp);
+
+  __u32 groups_;
+  /* the request, encoded by the first scrape() on a socket */
+  std::optional<request_template> tmpl_;
+  struct ynl_sock* tmpl_ys_{nullptr};
+
+  /* a few devices per host, the index starts small */
+  row_index<__u32, ethtool_stats_hash> index_;
+};
+
+} // namespace ynl_cpp
+
+#endif
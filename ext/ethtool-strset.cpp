@@ -0,0 +1,318 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "ethtool-strset.hpp"
+
+#include <errno.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include <linux/ethtool.h>
+
+#include "netdev-user.hpp"
+
+namespace ynl_cpp {
+
+#define STRSET_MIN_SLOTS 1024
+
+strset_cache::strset_cache() {
+  interned_.resize(STRSET_MIN_SLOTS);
+}
+
+bool strset_cache::per_device(__u32 set) {
+  switch (set) {
+    case ETH_SS_TEST:
+    case ETH_SS_STATS:
+    case ETH_SS_PRIV_FLAGS:
+    case ETH_SS_PHY_STATS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::string_view strset_cache::intern(const char* str, size_t len) {
+  size_t mask = interned_.size() - 1;
+  std::string_view s(str, len);
+  size_t i;
+
+  if (!len) {
+    return {};
+  }
+  for (i = std::hash<std::string_view>()(s);; i++) {
+    const auto& slot = interned_[i & mask];
+
+    if (slot.empty()) {
+      break;
+    }
+    if (slot == s) {
+      return slot;
+    }
+  }
+
+  if (chunk_used_ + len + 1 > chunk_size) {
+    /* strings longer than a chunk get one of their own */
+    chunks_.emplace_back(new char[std::max(len + 1, chunk_size)]);
+    chunk_used_ = 0;
+  }
+  char* dst = chunks_.back().get() + chunk_used_;
+  memcpy(dst, str, len);
+  dst[len] = '\0';
+  chunk_used_ += len + 1;
+  arena_used_ += len + 1;
+
+  interned_[i & mask] = {dst, len};
+  if (++interned_n_ * 2 > interned_.size()) {
+    std::vector<std::string_view> old(interned_.size() * 2);
+
+    old.swap(interned_);
+    mask = interned_.size() - 1;
+    for (const auto& v : old) {
+      if (v.empty()) {
+        continue;
+      }
+      i = std::hash<std::string_view>()(v);
+      while (!interned_[i & mask].empty()) {
+        i++;
+      }
+      interned_[i & mask] = v;
+    }
+  }
+  return {dst, len};
+}
+
+bool strset_cache::parse(const struct nlmsghdr* nlh, __u32 ifindex) {
+  const struct nlattr *sets, *set, *attr;
+
+  ynl_attr_for_each(sets, nlh, sizeof(struct genlmsghdr)) {
+    if (ynl_attr_type(sets) != ETHTOOL_A_STRSET_STRINGSETS) {
+      continue;
+    }
+    ynl_attr_for_each_nested(set, sets) {
+      const struct nlattr* strings = nullptr;
+      std::optional<__u32> id;
+      __u32 count = 0;
+
+      if (ynl_attr_type(set) != ETHTOOL_A_STRINGSETS_STRINGSET) {
+        continue;
+      }
+      ynl_attr_for_each_nested(attr, set) {
+        switch (ynl_attr_type(attr)) {
+          case ETHTOOL_A_STRINGSET_ID:
+            id = ynl_attr_get_u32(attr);
+            break;
+          case ETHTOOL_A_STRINGSET_COUNT:
+            count = ynl_attr_get_u32(attr);
+            break;
+          case ETHTOOL_A_STRINGSET_STRINGS:
+            strings = attr;
+            break;
+        }
+      }
+      if (!id) {
+        return false;
+      }
+
+      auto& names = sets_[key(per_device(*id) ? ifindex : 0, *id)];
+      names.assign(count, {});
+      if (!strings) {
+        continue;
+      }
+      ynl_attr_for_each_nested(attr, strings) {
+        const struct nlattr* str;
+        const char* value = nullptr;
+        size_t len = 0;
+        __u32 index = ~0U;
+
+        ynl_attr_for_each_nested(str, attr) {
+          if (ynl_attr_type(str) == ETHTOOL_A_STRING_INDEX) {
+            index = ynl_attr_get_u32(str);
+          } else if (ynl_attr_type(str) == ETHTOOL_A_STRING_VALUE) {
+            value = ynl_attr_get_str(str);
+            len = strnlen(value, ynl_attr_data_len(str));
+          }
+        }
+        if (index >= names.size() || !value) {
+          return false;
+        }
+        names[index] = intern(value, len);
+      }
+    }
+  }
+  return true;
+}
+
+result<void> strset_cache::fetch(
+    ynl_socket& ys,
+    __u32 ifindex,
+    std::initializer_list<__u32> sets) {
+  struct ynl_req_state yrs = {};
+  ethtool_strset_get_req req;
+  struct arg {
+    strset_cache* cache;
+    __u32 ifindex;
+  } arg = {this, ifindex};
+  bool need_dev = false;
+
+  req.stringsets.emplace();
+  for (__u32 set : sets) {
+    if (!sets_.contains(key(per_device(set) ? ifindex : 0, set))) {
+      auto& ss = req.stringsets->stringset.emplace_back();
+
+      ss.id = set;
+      need_dev |= per_device(set);
+    }
+  }
+  if (req.stringsets->stringset.empty()) {
+    return {};
+  }
+  req.header.emplace();
+  if (need_dev) {
+    req.header->dev_index = ifindex;
+  }
+
+  auto tmpl = ethtool_strset_get_prepare(ys, req);
+  if (!tmpl) {
+    return std::unexpected(tmpl.error());
+  }
+
+  yrs.yarg.ys = ys;
+  yrs.yarg.data = &arg;
+  yrs.cb = [](const struct nlmsghdr* nlh, struct ynl_parse_arg* yarg) -> int {
+    auto* a = (struct arg*)yarg->data;
+
+    if (!a->cache->parse(nlh, a->ifindex)) {
+      return ynl_error_parse(yarg, "malformed string set");
+    }
+    return YNL_PARSE_CB_OK;
+  };
+  yrs.rsp_cmd = ETHTOOL_MSG_STRSET_GET_REPLY;
+
+  fetches_++;
+  if (ynl_exec(ys, ynl_msg_reuse(ys, tmpl->nlh()), &yrs) < 0) {
+    return std::unexpected(error(ys));
+  }
+  return {};
+}
+
+const std::vector<std::string_view>*
+strset_cache::find(__u32 ifindex, __u32 set) const {
+  auto it = sets_.find(key(per_device(set) ? ifindex : 0, set));
+
+  return it == sets_.end() ? nullptr : &it->second;
+}
+
+result<std::span<const std::string_view>>
+strset_cache::get(ynl_socket& ys, __u32 ifindex, __u32 set) {
+  if (auto* names = find(ifindex, set)) {
+    return *names;
+  }
+
+  auto ret = fetch(ys, ifindex, {set});
+  if (!ret) {
+    return std::unexpected(ret.error());
+  }
+  /* A set the kernel doesn't know comes back empty, cache that too */
+  return sets_[key(per_device(set) ? ifindex : 0, set)];
+}
+
+result<std::string_view>
+strset_cache::name(ynl_socket& ys, __u32 ifindex, __u32 set, __u32 bit) {
+  auto names = get(ys, ifindex, set);
+  if (!names) {
+    return std::unexpected(names.error());
+  }
+  return bit < names->size() ? (*names)[bit] : std::string_view();
+}
+
+void strset_cache::invalidate(__u32 ifindex) {
+  std::erase_if(sets_, [&](const auto& it) {
+    return it.first >> 32 == ifindex;
+  });
+}
+
+void strset_cache::clear() {
+  sets_.clear();
+}
+
+result<void> strset_cache::start() {
+  struct ynl_error yerr;
+
+  ethtool_ys_ = std::make_unique<ynl_socket>(get_ynl_ethtool_family(), &yerr);
+  if (!*ethtool_ys_) {
+    return std::unexpected(error(yerr));
+  }
+  netdev_ys_ = std::make_unique<ynl_socket>(get_ynl_netdev_family(), &yerr);
+  if (!*netdev_ys_) {
+    return std::unexpected(error(yerr));
+  }
+
+  if (ynl_subscribe(*ethtool_ys_, "monitor") < 0) {
+    return std::unexpected(error(*ethtool_ys_));
+  }
+  if (ynl_subscribe(*netdev_ys_, "mgmt") < 0) {
+    return std::unexpected(error(*netdev_ys_));
+  }
+
+  /* Anything cached so far may predate the subscriptions */
+  std::erase_if(sets_, [](const auto& it) { return it.first >> 32; });
+  return {};
+}
+
+int strset_cache::ethtool_fd() {
+  return ynl_socket_get_fd(*ethtool_ys_);
+}
+
+int strset_cache::netdev_fd() {
+  return ynl_socket_get_fd(*netdev_ys_);
+}
+
+result<size_t> strset_cache::poll() {
+  std::vector<__u32> gone;
+  struct ynl_ntf_base_type* ntf;
+  bool overflow = false;
+
+  for (struct ynl_sock* ys : {(struct ynl_sock*)*ethtool_ys_,
+                              (struct ynl_sock*)*netdev_ys_}) {
+    if (ynl_ntf_check(ys) < 0) {
+      if (ys->err.code != ENOBUFS) {
+        return std::unexpected(error(ys));
+      }
+      overflow = true;
+    }
+  }
+
+  while ((ntf = ynl_ntf_dequeue(*ethtool_ys_))) {
+    const std::optional<ethtool_header>* hdr = nullptr;
+
+    if (ntf->cmd == ETHTOOL_MSG_CHANNELS_NTF) {
+      hdr = &((ethtool_channels_get_ntf*)ntf)->obj.header;
+    } else if (ntf->cmd == ETHTOOL_MSG_PRIVFLAGS_NTF) {
+      hdr = &((ethtool_privflags_get_ntf*)ntf)->obj.header;
+    }
+    if (hdr && *hdr && (*hdr)->dev_index) {
+      gone.push_back(*(*hdr)->dev_index);
+    }
+    ynl_ntf_free(ntf);
+  }
+  while ((ntf = ynl_ntf_dequeue(*netdev_ys_))) {
+    auto* rsp = (netdev_dev_get_ntf*)ntf;
+
+    if (ntf->cmd != NETDEV_CMD_DEV_CHANGE_NTF && rsp->obj.ifindex) {
+      gone.push_back(*rsp->obj.ifindex);
+    }
+    ynl_ntf_free(ntf);
+  }
+
+  size_t n = sets_.size();
+
+  /* Some notifications were lost, drop every device */
+  if (overflow) {
+    std::erase_if(sets_, [](const auto& it) { return it.first >> 32; });
+  }
+  for (__u32 ifindex : gone) {
+    invalidate(ifindex);
+  }
+  return n - sets_.size();
+}
+
+} // namespace ynl_cpp
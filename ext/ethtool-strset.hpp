@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_ETHTOOL_STRSET_H
+#define __YNL_CPP_ETHTOOL_STRSET_H 1
+
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "ethtool-user.hpp"
+
+namespace ynl_cpp {
+
+/**
+ * class strset_cache - ethtool string sets, fetched once
+ *
+ * Stats, private flags, features, link modes and most other ethtool
+ * bitsets are only numbers on the wire, their names come from string sets
+ * (ETH_SS_*). The cache fetches a set on first use and keeps it keyed by
+ * (ifindex, set id). Sets which don't depend on the device (link modes,
+ * features, ...) are kept once for all devices, see per_device().
+ *
+ * Strings are decoded straight from the reply into an arena of fixed
+ * size chunks and interned, so the ports of a NIC share one copy of
+ * their stats names. Views into the arena stay valid until the cache is
+ * destroyed, across invalidations.
+ *
+ * After start() the cache follows notifications: per device sets are
+ * dropped when the device changes its channels or private flags (which
+ * renames or renumbers driver stats) and when the device is registered
+ * or unregistered (driver reload, ifindex reuse). Other reconfigurations
+ * a driver may reflect in its stats are not notified, invalidate() drops
+ * the sets of a device on demand.
+ *
+ * Not thread safe.
+ */
+class strset_cache {
+ public:
+  strset_cache();
+
+  /* Whether the strings of @set depend on the device */
+  static bool per_device(__u32 set);
+
+  /* Names of string set @set of device @ifindex, fetched if not cached */
+  result<std::span<const std::string_view>>
+  get(ynl_socket& ys, __u32 ifindex, __u32 set);
+  /* Fetch the sets of @sets which are not cached yet, in one request */
+  result<void>
+  fetch(ynl_socket& ys, __u32 ifindex, std::initializer_list<__u32> sets);
+  /* Cached names only, never a round trip */
+  const std::vector<std::string_view>* find(__u32 ifindex, __u32 set) const;
+
+  /* Name of bit @bit of @set, empty if the set is shorter */
+  result<std::string_view>
+  name(ynl_socket& ys, __u32 ifindex, __u32 set, __u32 bit);
+
+  /*
+   * Resolve the bits set in a compact bitset value (ETHTOOL_A_BITSET_VALUE,
+   * 32 bit words) to their names, calling fn(__u32 bit, std::string_view
+   * name) for each. Bits past the end of the set get an empty name.
+   */
+  template <typename F>
+  result<void> for_each_bit(
+      ynl_socket& ys,
+      __u32 ifindex,
+      __u32 set,
+      std::span<const __u32> words,
+      F&& fn) {
+    auto names = get(ys, ifindex, set);
+    if (!names) {
+      return std::unexpected(names.error());
+    }
+    for (size_t w = 0; w < words.size(); w++) {
+      for (__u32 bits = words[w]; bits; bits &= bits - 1) {
+        __u32 bit = w * 32 + __builtin_ctz(bits);
+
+        fn(bit, bit < names->size() ? (*names)[bit] : std::string_view());
+      }
+    }
+    return {};
+  }
+
+  /* Drop the per device sets of @ifindex */
+  void invalidate(__u32 ifindex);
+  /* Drop all sets, the arena is kept */
+  void clear();
+
+  /* Follow the notifications which invalidate sets */
+  result<void> start();
+  /* ethtool and netdev notification sockets, for poll() / epoll */
+  int ethtool_fd();
+  int netdev_fd();
+  /* Apply pending notifications, returns the number of sets dropped */
+  result<size_t> poll();
+
+  /* Number of string set requests sent */
+  size_t fetches() const {
+    return fetches_;
+  }
+  /* Bytes of strings held, after interning */
+  size_t arena_bytes() const {
+    return arena_used_;
+  }
+
+ private:
+  static constexpr size_t chunk_size = 64 * 1024;
+
+  static __u64 key(__u32 ifindex, __u32 set) {
+    return ((__u64)ifindex << 32) | set;
+  }
+
+  std::string_view intern(const char* str, size_t len);
+  bool parse(const struct nlmsghdr* nlh, __u32 ifindex);
+
+  std::unordered_map<__u64, std::vector<std::string_view>> sets_;
+
+  /* string arena, chunks never move */
+  std::vector<std::unique_ptr<char[]>> chunks_;
+  size_t chunk_used_{chunk_size};
+  size_t arena_used_{0};
+  /* open addressing over interned strings, empty view when free */
+  std::vector<std::string_view> interned_;
+  size_t interned_n_{0};
+
+  size_t fetches_{0};
+
+  std::unique_ptr<ynl_socket> ethtool_ys_;
+  std::unique_ptr<ynl_socket> netdev_ys_;
+};
+
+} // namespace ynl_cpp
+
+#endif
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "netdev-napi.hpp"
+
+#include <algorithm>
+
+namespace ynl_cpp {
+
+static unsigned int napi_rule_rank(const napi_rule& rule) {
+  return (rule.ifindex ? 2 : 0) + (rule.queue_type ? 1 : 0);
+}
+
+napi_tuner::napi_tuner(std::vector<napi_rule> rules)
+    : rules_(std::move(rules)) {
+  /* Apply the general rules first, so the specific ones override them */
+  std::stable_sort(
+      rules_.begin(), rules_.end(), [](const auto& a, const auto& b) {
+        return napi_rule_rank(a) < napi_rule_rank(b);
+      });
+}
+
+bool napi_tuner::needs_queues() const {
+  return std::any_of(rules_.begin(), rules_.end(), [](const auto& rule) {
+    return rule.queue_type.has_value();
+  });
+}
+
+napi_config napi_tuner::resolve(__u32 ifindex, __u8 queue_types) const {
+  napi_config cfg;
+
+  for (const auto& rule : rules_) {
+    if ((rule.ifindex && *rule.ifindex != ifindex) ||
+        (rule.queue_type && !(queue_types & (1 << *rule.queue_type)))) {
+      continue;
+    }
+    if (rule.config.defer_hard_irqs) {
+      cfg.defer_hard_irqs = rule.config.defer_hard_irqs;
+    }
+    if (rule.config.gro_flush_timeout) {
+      cfg.gro_flush_timeout = rule.config.gro_flush_timeout;
+    }
+    if (rule.config.irq_suspend_timeout) {
+      cfg.irq_suspend_timeout = rule.config.irq_suspend_timeout;
+    }
+  }
+  return cfg;
+}
+
+void napi_tuner::add_napi(const netdev_napi_get_rsp& napi) {
+  napi_result& res = results.emplace_back();
+
+  res.id = napi.id.value_or(0);
+  res.ifindex = napi.ifindex.value_or(0);
+  res.current.defer_hard_irqs = napi.defer_hard_irqs;
+  res.current.gro_flush_timeout = napi.gro_flush_timeout;
+  res.current.irq_suspend_timeout = napi.irq_suspend_timeout;
+}
+
+void napi_tuner::add_queue(const netdev_queue_get_rsp& queue) {
+  /* Queues without a NAPI (or the id) can't be tuned through one */
+  if (!queue.napi_id || !queue.type) {
+    return;
+  }
+  queue_types_[*queue.napi_id] |= 1 << *queue.type;
+}
+
+result<void> napi_tuner::load(ynl_socket& ys) {
+  netdev_napi_get_req_dump req;
+
+  results.clear();
+  queue_types_.clear();
+
+  auto napis = netdev_napi_get_dump_ex(ys, req);
+  if (!napis) {
+    return std::unexpected(napis.error());
+  }
+  results.reserve((*napis)->objs.size());
+  for (const auto& napi : (*napis)->objs) {
+    add_napi(napi);
+  }
+
+  if (!needs_queues()) {
+    return {};
+  }
+
+  netdev_queue_get_req_dump qreq;
+  auto queues = netdev_queue_get_dump_ex(ys, qreq);
+  if (!queues) {
+    return std::unexpected(queues.error());
+  }
+  for (const auto& queue : (*queues)->objs) {
+    add_queue(queue);
+  }
+  return {};
+}
+
+result<void> napi_tuner::plan(msg_batch& batch) {
+  batch_rows_.clear();
+
+  for (size_t i = 0; i < results.size(); i++) {
+    napi_result& res = results[i];
+    auto it = queue_types_.find(res.id);
+    napi_config want =
+        resolve(res.ifindex, it == queue_types_.end() ? 0 : it->second);
+    netdev_napi_set_req req;
+
+    res.change = {};
+    res.err.reset();
+    if (want.defer_hard_irqs &&
+        want.defer_hard_irqs != res.current.defer_hard_irqs) {
+      res.change.defer_hard_irqs = want.defer_hard_irqs;
+    }
+    if (want.gro_flush_timeout &&
+        want.gro_flush_timeout != res.current.gro_flush_timeout) {
+      res.change.gro_flush_timeout = want.gro_flush_timeout;
+    }
+    if (want.irq_suspend_timeout &&
+        want.irq_suspend_timeout != res.current.irq_suspend_timeout) {
+      res.change.irq_suspend_timeout = want.irq_suspend_timeout;
+    }
+    if (res.change.empty()) {
+      continue;
+    }
+
+    req.id = res.id;
+    req.defer_hard_irqs = res.change.defer_hard_irqs;
+    req.gro_flush_timeout = res.change.gro_flush_timeout;
+    req.irq_suspend_timeout = res.change.irq_suspend_timeout;
+    auto idx = netdev_napi_set_batch(batch, req);
+    if (!idx) {
+      return std::unexpected(idx.error());
+    }
+    batch_rows_[*idx] = i;
+  }
+  return {};
+}
+
+void napi_tuner::record(std::span<const msg_batch::failure> failures) {
+  for (const auto& f : failures) {
+    auto it = batch_rows_.find(f.index);
+
+    if (it != batch_rows_.end()) {
+      results[it->second].err = f.err;
+    }
+  }
+}
+
+result<void> napi_tuner::apply(ynl_socket& ys) {
+  msg_batch batch(ys);
+
+  auto ret = load(ys);
+  if (!ret) {
+    return ret;
+  }
+  ret = plan(batch);
+  if (!ret) {
+    return ret;
+  }
+  if (!batch.size()) {
+    return {};
+  }
+
+  auto failures = batch.send();
+  if (!failures) {
+    return std::unexpected(failures.error());
+  }
+  record(*failures);
+  return {};
+}
+
+} // namespace ynl_cpp
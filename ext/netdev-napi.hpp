@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_NETDEV_NAPI_H
+#define __YNL_CPP_NETDEV_NAPI_H 1
+
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "netdev-user.hpp"
+
+namespace ynl_cpp {
+
+/* NAPI settings, unset fields are left alone */
+struct napi_config {
+  std::optional<__u32> defer_hard_irqs{};
+  std::optional<__u64> gro_flush_timeout{};
+  std::optional<__u64> irq_suspend_timeout{};
+
+  bool empty() const {
+    return !defer_hard_irqs && !gro_flush_timeout && !irq_suspend_timeout;
+  }
+};
+
+/*
+ * Settings for the NAPIs of device @ifindex and / or the NAPIs serving
+ * queues of type @queue_type, a rule without either applies to all NAPIs.
+ */
+struct napi_rule {
+  std::optional<__u32> ifindex{};
+  std::optional<netdev_queue_type> queue_type{};
+  napi_config config{};
+};
+
+struct napi_result {
+  __u32 id;
+  __u32 ifindex;
+  /* settings before the change, as dumped */
+  napi_config current;
+  /* settings which differed from the rules and were sent */
+  napi_config change;
+  /* set if the kernel rejected the change */
+  std::optional<error> err;
+
+  bool changed() const {
+    return !change.empty() && !err;
+  }
+};
+
+/**
+ * class napi_tuner - apply NAPI settings to many NAPI instances at once
+ *
+ * Resolves a list of rules against the current settings of every NAPI
+ * (one napi-get dump, plus a queue-get dump if a rule matches on queue
+ * type) and sends only the napi-set messages needed, pipelined in one
+ * msg_batch, each carrying only the settings which differ:
+ *
+ *   ynl_cpp::napi_tuner tuner({
+ *       {.config = {.defer_hard_irqs = 100}},
+ *       {.ifindex = 3, .config = {.gro_flush_timeout = 20000}},
+ *   });
+ *   tuner.apply(ys);
+ *
+ * More specific rules take precedence, field by field: rules for all
+ * NAPIs, then by queue type, then by device, then by device and queue
+ * type. Among rules equally specific the later one wins, which also
+ * decides for NAPIs serving both rx and tx queues.
+ *
+ * apply() leaves one napi_result per NAPI in results. A NAPI which
+ * couldn't be changed fails only its own result, not the call.
+ */
+class napi_tuner {
+ public:
+  explicit napi_tuner(std::vector<napi_rule> rules);
+
+  /* Diff against the current settings, change what differs */
+  result<void> apply(ynl_socket& ys);
+
+  /* apply() in steps, for state from elsewhere or dry runs */
+  result<void> load(ynl_socket& ys);
+  void add_napi(const netdev_napi_get_rsp& napi);
+  void add_queue(const netdev_queue_get_rsp& queue);
+  /* Encode the napi-set messages needed into @batch */
+  result<void> plan(msg_batch& batch);
+  /* Record the failures of sending @batch */
+  void record(std::span<const msg_batch::failure> failures);
+
+  /* Settings the rules want for a NAPI */
+  napi_config resolve(__u32 ifindex, __u8 queue_types) const;
+
+  std::vector<napi_result> results;
+
+ private:
+  bool needs_queues() const;
+
+  std::vector<napi_rule> rules_;
+  /* NAPI id -> 1 << queue type of the queues it serves */
+  std::unordered_map<__u32, __u8> queue_types_;
+  /* message of the batch -> row of results */
+  std::unordered_map<size_t, size_t> batch_rows_;
+};
+
+} // namespace ynl_cpp
+
+#endif
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "netdev-page-pool.hpp"
+
+#include <errno.h>
+
+#include <vector>
+
+namespace ynl_cpp {
+
+static double page_pool_ratio(__u64 recycled, __u64 released) {
+  if (!recycled && !released) {
+    return -1;
+  }
+  return (double)recycled / (recycled + released);
+}
+
+double page_pool_counters::recycle_ratio() const {
+  return page_pool_ratio(
+      recycle_cached + recycle_ring,
+      recycle_ring_full + recycle_released_refcnt);
+}
+
+double page_pool_entry::recent_recycle_ratio() const {
+  /* Counters only go up, unless the pool was replaced under the same id */
+  if (stats.recycle_cached < prev_stats.recycle_cached ||
+      stats.recycle_ring < prev_stats.recycle_ring ||
+      stats.recycle_ring_full < prev_stats.recycle_ring_full ||
+      stats.recycle_released_refcnt < prev_stats.recycle_released_refcnt) {
+    return stats.recycle_ratio();
+  }
+  return page_pool_ratio(
+      stats.recycle_cached - prev_stats.recycle_cached +
+          stats.recycle_ring - prev_stats.recycle_ring,
+      stats.recycle_ring_full - prev_stats.recycle_ring_full +
+          stats.recycle_released_refcnt - prev_stats.recycle_released_refcnt);
+}
+
+result<void> page_pool_monitor::start() {
+  auto ret = ntf_.open(get_ynl_netdev_family(), "page-pool");
+  if (!ret) {
+    return ret;
+  }
+  return resync();
+}
+
+int page_pool_monitor::fd() {
+  return ntf_.fd();
+}
+
+const page_pool_entry* page_pool_monitor::find(__u64 id) const {
+  auto it = pools_.find(id);
+
+  return it == pools_.end() ? nullptr : &it->second;
+}
+
+void page_pool_monitor::update(const netdev_page_pool_get_rsp& rsp) {
+  if (!rsp.id) {
+    return;
+  }
+
+  auto [it, inserted] = pools_.try_emplace(*rsp.id);
+  page_pool_entry& pp = it->second;
+
+  if (inserted) {
+    pp = {};
+    pp.id = *rsp.id;
+  }
+  /* The kernel leaves out what doesn't apply, e.g. ifindex once detached */
+  pp.ifindex = rsp.ifindex.value_or(0);
+  pp.napi_id = rsp.napi_id.value_or(0);
+  pp.inflight = rsp.inflight.value_or(0);
+  pp.inflight_mem = rsp.inflight_mem.value_or(0);
+  pp.detach_time = rsp.detach_time.value_or(0);
+  pp.dmabuf = rsp.dmabuf.value_or(0);
+}
+
+result<void> page_pool_monitor::dump_stats(ynl_socket& ys) {
+  auto rsp = netdev_page_pool_stats_get_dump_ex(ys);
+
+  if (!rsp) {
+    /* Kernel built without CONFIG_PAGE_POOL_STATS, don't ask again */
+    if (rsp.error().sys_errno() == EOPNOTSUPP) {
+      stats_ = false;
+      return {};
+    }
+    return std::unexpected(rsp.error());
+  }
+
+  for (const auto& st : (*rsp)->objs) {
+    if (!st.info || !st.info->id) {
+      continue;
+    }
+    /* Created since the last notifications were read, wait for those */
+    auto it = pools_.find(*st.info->id);
+    if (it == pools_.end()) {
+      continue;
+    }
+
+    page_pool_entry& pp = it->second;
+    pp.prev_stats = pp.has_stats ? pp.stats : page_pool_counters{};
+    pp.stats = {
+        .alloc_fast = st.alloc_fast.value_or(0),
+        .alloc_slow = st.alloc_slow.value_or(0),
+        .alloc_slow_high_order = st.alloc_slow_high_order.value_or(0),
+        .alloc_empty = st.alloc_empty.value_or(0),
+        .alloc_refill = st.alloc_refill.value_or(0),
+        .alloc_waive = st.alloc_waive.value_or(0),
+        .recycle_cached = st.recycle_cached.value_or(0),
+        .recycle_cache_full = st.recycle_cache_full.value_or(0),
+        .recycle_ring = st.recycle_ring.value_or(0),
+        .recycle_ring_full = st.recycle_ring_full.value_or(0),
+        .recycle_released_refcnt = st.recycle_released_refcnt.value_or(0),
+    };
+    pp.has_stats = true;
+  }
+  return {};
+}
+
+result<void> page_pool_monitor::refresh() {
+  return refresh(ntf_.dump_socket());
+}
+
+result<void> page_pool_monitor::refresh(ynl_socket& ys) {
+  std::vector<__u64> detached;
+
+  if (stats_) {
+    auto ret = dump_stats(ys);
+    if (!ret) {
+      return ret;
+    }
+  }
+
+  /* Nothing notifies in-flight pages draining, ask for each pool */
+  for (const auto& [id, pp] : pools_) {
+    if (pp.detach_time) {
+      detached.push_back(id);
+    }
+  }
+  for (__u64 id : detached) {
+    netdev_page_pool_get_req req;
+
+    req.id = id;
+    auto rsp = netdev_page_pool_get_ex(ys, req);
+    if (!rsp) {
+      /* All pages came back and the pool is gone */
+      if (rsp.error().sys_errno() == ENOENT) {
+        pools_.erase(id);
+        continue;
+      }
+      return std::unexpected(rsp.error());
+    }
+    update(**rsp);
+  }
+  return {};
+}
+
+result<void> page_pool_monitor::resync() {
+  return load(ntf_.dump_socket());
+}
+
+result<void> page_pool_monitor::load(ynl_socket& ys) {
+  std::unordered_map<__u64, page_pool_entry> old;
+
+  auto rsp = netdev_page_pool_get_dump_ex(ys);
+  if (!rsp) {
+    return std::unexpected(rsp.error());
+  }
+
+  /* Start over, keeping the counters of the pools which are still there */
+  old.swap(pools_);
+  for (const auto& pp : (*rsp)->objs) {
+    update(pp);
+  }
+  for (auto& [id, pp] : pools_) {
+    auto it = old.find(id);
+
+    if (it != old.end() && it->second.has_stats) {
+      pp.has_stats = true;
+      pp.stats = it->second.stats;
+      pp.prev_stats = it->second.prev_stats;
+    }
+  }
+  resyncs_++;
+
+  if (stats_) {
+    return dump_stats(ys);
+  }
+  return {};
+}
+
+result<size_t> page_pool_monitor::poll() {
+  return ntf_.poll(
+      [this](struct ynl_ntf_base_type* ntf) {
+        auto* rsp = (netdev_page_pool_get_ntf*)ntf;
+
+        apply(rsp->obj, ntf->cmd == NETDEV_CMD_PAGE_POOL_DEL_NTF);
+        return true;
+      },
+      [this]() { return resync(); });
+}
+
+void page_pool_monitor::apply(const netdev_page_pool_get_rsp& pool, bool del) {
+  if (!del) {
+    update(pool);
+  } else if (pool.id) {
+    pools_.erase(*pool.id);
+  }
+}
+
+} // namespace ynl_cpp
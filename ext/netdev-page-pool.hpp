@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_NETDEV_PAGE_POOL_H
+#define __YNL_CPP_NETDEV_PAGE_POOL_H 1
+
+#include <unordered_map>
+
+#include <ynl.hpp>
+
+#include "netdev-user.hpp"
+#include "ynl-ntf-mirror.hpp"
+
+namespace ynl_cpp {
+
+/* struct page_pool_stats, zero without CONFIG_PAGE_POOL_STATS */
+struct page_pool_counters {
+  __u64 alloc_fast;
+  __u64 alloc_slow;
+  __u64 alloc_slow_high_order;
+  __u64 alloc_empty;
+  __u64 alloc_refill;
+  __u64 alloc_waive;
+  __u64 recycle_cached;
+  __u64 recycle_cache_full;
+  __u64 recycle_ring;
+  __u64 recycle_ring_full;
+  __u64 recycle_released_refcnt;
+
+  /*
+   * Share of the pages returned to the pool which were recycled (into
+   * the cache or the ring), rather than released because the ring was
+   * full or the page still had other references. -1 if none returned.
+   */
+  double recycle_ratio() const;
+};
+
+struct page_pool_entry {
+  __u64 id;
+  /* 0 once the netdev is gone */
+  __u32 ifindex;
+  __u64 napi_id;
+  __u64 inflight;
+  __u64 inflight_mem;
+  /* CLOCK_BOOTTIME seconds at which the netdev went away, 0 if attached */
+  __u64 detach_time;
+  __u32 dmabuf;
+
+  bool has_stats;
+  page_pool_counters stats;
+  /* stats as of the refresh before, for ratios over an interval */
+  page_pool_counters prev_stats;
+
+  /* Detached from its netdev with pages still out, likely a leak */
+  bool leaking() const {
+    return detach_time && inflight;
+  }
+
+  /* recycle_ratio() of what happened between the last two refreshes */
+  double recent_recycle_ratio() const;
+};
+
+/**
+ * class page_pool_monitor - page pool state, kept current by notifications
+ *
+ * Seeded with a page-pool-get dump and a page-pool-stats-get dump, then
+ * updated from the page-pool add / change / del notifications, so pools
+ * appearing, moving to another NAPI or getting detached from their netdev
+ * are tracked without dumping. If the notification socket overflows
+ * (ENOBUFS) the state is resynchronized with a fresh dump.
+ *
+ * Counters are not notified. refresh() updates them with one stats dump,
+ * plus a page-pool-get of each detached pool to follow how its in-flight
+ * pages drain; the state of attached pools comes from the notifications.
+ *
+ * Not thread safe, one thread drives the monitor and reads it.
+ */
+class page_pool_monitor {
+ public:
+  /* Open the sockets, subscribe to notifications and load the pools */
+  result<void> start();
+
+  /* Notification socket fd, for poll() / epoll integration */
+  int fd();
+
+  /*
+   * Apply all pending notifications without blocking, resyncing on
+   * overflow. Returns the number of notifications applied.
+   */
+  result<size_t> poll();
+
+  /* Update the counters, and in-flight pages of detached pools */
+  result<void> refresh();
+  /* refresh() with requests on @ys */
+  result<void> refresh(ynl_socket& ys);
+
+  /* Reload everything with dumps, dropping pools which disappeared */
+  result<void> resync();
+  /* resync() with dumps on @ys */
+  result<void> load(ynl_socket& ys);
+
+  /* Apply one page-pool notification, as poll() does */
+  void apply(const netdev_page_pool_get_rsp& pool, bool del);
+
+  const page_pool_entry* find(__u64 id) const;
+
+  /* Calls fn(const page_pool_entry&) for every pool */
+  template <typename F>
+  void for_each(F&& fn) const {
+    for (const auto& [id, pp] : pools_) {
+      fn(pp);
+    }
+  }
+
+  /* Calls fn(const page_pool_entry&) for every leaking() pool */
+  template <typename F>
+  void for_each_leak(F&& fn) const {
+    for (const auto& [id, pp] : pools_) {
+      if (pp.leaking()) {
+        fn(pp);
+      }
+    }
+  }
+
+  size_t size() const {
+    return pools_.size();
+  }
+
+  /* Whether the kernel reports counters (CONFIG_PAGE_POOL_STATS) */
+  bool has_stats() const {
+    return stats_;
+  }
+
+  /* Number of dumps done so far, including the initial one */
+  __u64 resyncs() const {
+    return resyncs_;
+  }
+
+ private:
+  void update(const netdev_page_pool_get_rsp& rsp);
+  result<void> dump_stats(ynl_socket& ys);
+
+  ntf_mirror ntf_;
+
+  std::unordered_map<__u64, page_pool_entry> pools_;
+  bool stats_{true};
+  __u64 resyncs_{0};
+};
+
+} // namespace ynl_cpp
+
+#endif
@@ -0,0 +1,387 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "netdev-qstats.hpp"
+
+#include <algorithm>
+
+#include <linux/genetlink.h>
+
+namespace ynl_cpp {
+
+static_assert(qstats_counters <= 32, "qstats_sample::present is a __u32");
+
+/* Generic vectors, 128 bit is what all targets have (SSE2, NEON) */
+typedef __u64 qstats_vec __attribute__((vector_size(16)));
+#define QSTATS_VEC_LEN (sizeof(qstats_vec) / sizeof(__u64))
+
+static qstats_vec qstats_load(const __u64* p) {
+  qstats_vec v;
+
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static void qstats_store(__u64* p, qstats_vec v) {
+  memcpy(p, &v, sizeof(v));
+}
+
+/*
+ * out[i] = cur[i] - prev[i], or cur[i] where the counter went backwards.
+ * Returns true if any did.
+ */
+static bool
+qstats_diff(const __u64* cur, const __u64* prev, __u64* out, size_t n) {
+  qstats_vec back_any = {};
+  bool reset = false;
+  size_t i = 0;
+
+  for (; i + QSTATS_VEC_LEN <= n; i += QSTATS_VEC_LEN) {
+    qstats_vec c = qstats_load(cur + i);
+    qstats_vec p = qstats_load(prev + i);
+    qstats_vec back = (qstats_vec)(c < p);
+
+    qstats_store(out + i, ((c - p) & ~back) | (c & back));
+    back_any |= back;
+  }
+  for (; i < n; i++) {
+    reset |= cur[i] < prev[i];
+    out[i] = cur[i] < prev[i] ? cur[i] : cur[i] - prev[i];
+  }
+  for (size_t l = 0; l < QSTATS_VEC_LEN; l++) {
+    reset |= back_any[l] != 0;
+  }
+  return reset;
+}
+
+static __u64 qstats_sum(const __u64* p, size_t n) {
+  qstats_vec acc = {};
+  __u64 sum = 0;
+  size_t i = 0;
+
+  for (; i + QSTATS_VEC_LEN <= n; i += QSTATS_VEC_LEN) {
+    acc += qstats_load(p + i);
+  }
+  for (; i < n; i++) {
+    sum += p[i];
+  }
+  for (size_t l = 0; l < QSTATS_VEC_LEN; l++) {
+    sum += acc[l];
+  }
+  return sum;
+}
+
+size_t qstats_key_hash::operator()(const qstats_key& key) const {
+  __u64 h = (((__u64)key.ifindex << 32) | key.id) ^ ((__u64)key.type << 24);
+
+  h *= 0x9e3779b97f4a7c15ULL;
+  return h ^ (h >> 29);
+}
+
+void qstats_sample::reserve(size_t queues) {
+  ifindex.reserve(queues);
+  queue_type.reserve(queues);
+  queue_id.reserve(queues);
+  present.reserve(queues);
+  for (auto& col : val) {
+    col.reserve(queues);
+  }
+}
+
+void qstats_sample::clear() {
+  ifindex.clear();
+  queue_type.clear();
+  queue_id.clear();
+  present.clear();
+  present_any = 0;
+  for (auto& col : val) {
+    col.clear();
+  }
+}
+
+std::optional<size_t>
+qstats_sample::find(__u32 ifidx, __u32 type, __u32 id) const {
+  return index_.find({ifidx, type, id}, [this](size_t i) { return key(i); });
+}
+
+void qstats_sample::build_index() {
+  index_.rebuild(size(), size(), [this](size_t i) { return key(i); });
+}
+
+void qstats_sampler::reserve(size_t queues) {
+  for (auto& buf : bufs_) {
+    buf.reserve(queues);
+  }
+  for (auto& col : delta) {
+    col.reserve(queues);
+  }
+  flags.reserve(queues);
+}
+
+void qstats_sampler::begin() {
+  next().clear();
+}
+
+bool qstats_sampler::add(const struct nlmsghdr* nlh) {
+  qstats_sample& s = next();
+  __u32 ifidx = 0, type = 0, id = 0, present = 0;
+  __u64 val[qstats_counters] = {};
+  const struct nlattr* attr;
+  unsigned int keys = 0;
+
+  if (nlh->nlmsg_len < NLMSG_HDRLEN + sizeof(struct genlmsghdr)) {
+    return false;
+  }
+
+  ynl_attr_for_each(attr, nlh, sizeof(struct genlmsghdr)) {
+    unsigned int type_attr = ynl_attr_type(attr);
+    unsigned int len = ynl_attr_data_len(attr);
+
+    switch (type_attr) {
+      case NETDEV_A_QSTATS_IFINDEX:
+      case NETDEV_A_QSTATS_QUEUE_TYPE:
+      case NETDEV_A_QSTATS_QUEUE_ID: {
+        __u32 v;
+
+        if (len < sizeof(__u32)) {
+          return false;
+        }
+        v = ynl_attr_get_u32(attr);
+        if (type_attr == NETDEV_A_QSTATS_IFINDEX) {
+          ifidx = v;
+        } else if (type_attr == NETDEV_A_QSTATS_QUEUE_TYPE) {
+          type = v;
+        } else {
+          id = v;
+        }
+        keys |= 1 << type_attr;
+        break;
+      }
+      default:
+        /* counters are uint, newer ones are picked up once in the uapi */
+        if (type_attr < NETDEV_A_QSTATS_RX_PACKETS ||
+            type_attr > NETDEV_A_QSTATS_MAX) {
+          break;
+        }
+        if (len != sizeof(__u32) && len != sizeof(__u64)) {
+          return false;
+        }
+        val[qstats_col(type_attr)] = ynl_attr_get_uint(attr);
+        present |= 1U << qstats_col(type_attr);
+        break;
+    }
+  }
+
+  /* Device scoped stats have no queue, they don't belong here */
+  if (keys !=
+      ((1 << NETDEV_A_QSTATS_IFINDEX) | (1 << NETDEV_A_QSTATS_QUEUE_TYPE) |
+       (1 << NETDEV_A_QSTATS_QUEUE_ID))) {
+    return false;
+  }
+
+  s.ifindex.push_back(ifidx);
+  s.queue_type.push_back(type);
+  s.queue_id.push_back(id);
+  s.present.push_back(present);
+  s.present_any |= present;
+  for (unsigned int c = 0; c < qstats_counters; c++) {
+    s.val[c].push_back(val[c]);
+  }
+  return true;
+}
+
+bool qstats_sampler::same_queues() const {
+  const qstats_sample& c = cur();
+  const qstats_sample& p = prev();
+  size_t n = c.size();
+
+  return n == p.size() &&
+      !memcmp(c.ifindex.data(), p.ifindex.data(), n * sizeof(__u32)) &&
+      !memcmp(c.queue_type.data(), p.queue_type.data(), n * sizeof(__u32)) &&
+      !memcmp(c.queue_id.data(), p.queue_id.data(), n * sizeof(__u32));
+}
+
+void qstats_sampler::diff_same() {
+  const qstats_sample& c = cur();
+  const qstats_sample& p = prev();
+  size_t n = c.size();
+
+  for (unsigned int col = 0; col < qstats_counters; col++) {
+    /* Counters the driver doesn't have, nothing to subtract */
+    if (!((c.present_any | p.present_any) & (1U << col))) {
+      std::fill(delta[col].begin(), delta[col].end(), 0);
+      continue;
+    }
+    if (!qstats_diff(
+            c.val[col].data(), p.val[col].data(), delta[col].data(), n)) {
+      continue;
+    }
+    /* Rare, find the rows which were reset */
+    for (size_t i = 0; i < n; i++) {
+      if (c.val[col][i] < p.val[col][i]) {
+        flags[i] |= QSTATS_RESET;
+      }
+    }
+  }
+}
+
+void qstats_sampler::diff_match() {
+  const qstats_sample& c = cur();
+  const qstats_sample& p = prev();
+  std::vector<bool> matched(p.size());
+
+  /* Match the rows first, then go column by column like diff_same() */
+  match_.resize(c.size());
+  for (size_t i = 0; i < c.size(); i++) {
+    auto row = p.find(c.ifindex[i], c.queue_type[i], c.queue_id[i]);
+
+    if (row) {
+      match_[i] = *row;
+      matched[*row] = true;
+    } else {
+      match_[i] = c.size() + p.size();
+      flags[i] |= QSTATS_NEW;
+    }
+  }
+
+  for (unsigned int col = 0; col < qstats_counters; col++) {
+    const __u64* now = c.val[col].data();
+    const __u64* then = p.val[col].data();
+    __u64* d = delta[col].data();
+
+    if (!((c.present_any | p.present_any) & (1U << col))) {
+      std::fill(delta[col].begin(), delta[col].end(), 0);
+      continue;
+    }
+    for (size_t i = 0; i < c.size(); i++) {
+      if (flags[i] & QSTATS_NEW) {
+        d[i] = 0;
+      } else if (now[i] < then[match_[i]]) {
+        flags[i] |= QSTATS_RESET;
+        d[i] = now[i];
+      } else {
+        d[i] = now[i] - then[match_[i]];
+      }
+    }
+  }
+
+  for (size_t i = 0; i < p.size(); i++) {
+    if (!matched[i]) {
+      removed.push_back(i);
+    }
+  }
+}
+
+void qstats_sampler::aggregate() {
+  const qstats_sample& c = cur();
+
+  runs_.clear();
+  dev_ifindex.clear();
+  for (size_t i = 0; i < c.size();) {
+    size_t end = i + 1;
+
+    while (end < c.size() && c.ifindex[end] == c.ifindex[i] &&
+           c.queue_type[end] == c.queue_type[i]) {
+      end++;
+    }
+    runs_.emplace_back(i, end);
+    i = end;
+  }
+
+  /* Dumps are grouped by device, so most lookups hit the last one */
+  std::vector<size_t> run_dev(runs_.size());
+  for (size_t r = 0; r < runs_.size(); r++) {
+    __u32 ifidx = c.ifindex[runs_[r].first];
+    size_t d = dev_ifindex.size();
+
+    if (d && dev_ifindex.back() == ifidx) {
+      d--;
+    } else {
+      auto it = std::find(dev_ifindex.begin(), dev_ifindex.end(), ifidx);
+
+      d = it - dev_ifindex.begin();
+      if (it == dev_ifindex.end()) {
+        dev_ifindex.push_back(ifidx);
+      }
+    }
+    run_dev[r] = d;
+  }
+
+  for (unsigned int col = 0; col < qstats_counters; col++) {
+    const __u64* d = delta[col].data();
+
+    dev_delta[col].assign(dev_ifindex.size(), 0);
+    type_delta[NETDEV_QUEUE_TYPE_RX][col] = 0;
+    type_delta[NETDEV_QUEUE_TYPE_TX][col] = 0;
+    /* A counter missing from the sample has zero deltas */
+    if (!(c.present_any & (1U << col))) {
+      continue;
+    }
+    for (size_t r = 0; r < runs_.size(); r++) {
+      auto [start, end] = runs_[r];
+      __u64 sum = qstats_sum(d + start, end - start);
+      __u32 type = c.queue_type[start];
+
+      dev_delta[col][run_dev[r]] += sum;
+      if (type < type_delta.size()) {
+        type_delta[type][col] += sum;
+      }
+    }
+  }
+}
+
+void qstats_sampler::finish(std::chrono::steady_clock::time_point when) {
+  size_t n;
+
+  next().when = when;
+  cur_ = !cur_;
+  samples_++;
+
+  n = cur().size();
+  removed.clear();
+  flags.assign(n, 0);
+  for (auto& col : delta) {
+    col.resize(n);
+  }
+
+  if (samples_ == 1) {
+    flags.assign(n, QSTATS_NEW);
+    for (auto& col : delta) {
+      std::fill(col.begin(), col.end(), 0);
+    }
+    bufs_[cur_].build_index();
+  } else if (same_queues()) {
+    diff_same();
+    /* Same rows, same index, copying is cheaper than hashing */
+    bufs_[cur_].index_ = prev().index_;
+  } else {
+    diff_match();
+    bufs_[cur_].build_index();
+  }
+  aggregate();
+}
+
+result<void> qstats_sampler::sample(ynl_socket& ys, __u32 ifindex) {
+  netdev_qstats_get_req_dump req;
+
+  req.scope = NETDEV_QSTATS_SCOPE_QUEUE;
+  if (ifindex) {
+    req.ifindex = ifindex;
+  }
+  auto tmpl = netdev_qstats_get_dump_prepare(ys, req);
+  if (!tmpl) {
+    return std::unexpected(tmpl.error());
+  }
+
+  begin();
+  auto ret = dump_raw(
+      ys,
+      ynl_msg_reuse(ys, tmpl->nlh()),
+      NETDEV_CMD_QSTATS_GET,
+      [this](const struct nlmsghdr* nlh) { return add(nlh); });
+  if (!ret) {
+    return ret;
+  }
+  finish();
+  return {};
+}
+
+} // namespace ynl_cpp
@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_NETDEV_QSTATS_H
+#define __YNL_CPP_NETDEV_QSTATS_H 1
+
+#include <array>
+#include <chrono>
+#include <optional>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "netdev-user.hpp"
+#include "ynl-row-index.hpp"
+
+namespace ynl_cpp {
+
+/* Counters are kept in columns, counter NETDEV_A_QSTATS_x in qstats_col(x) */
+inline constexpr unsigned int qstats_counters =
+    NETDEV_A_QSTATS_MAX - NETDEV_A_QSTATS_RX_PACKETS + 1;
+
+constexpr unsigned int qstats_col(unsigned int attr) {
+  return attr - NETDEV_A_QSTATS_RX_PACKETS;
+}
+
+struct qstats_key {
+  __u32 ifindex;
+  __u32 type;
+  __u32 id;
+
+  bool operator==(const qstats_key&) const = default;
+};
+
+struct qstats_key_hash {
+  size_t operator()(const qstats_key& key) const;
+};
+
+/**
+ * struct qstats_sample - per-queue counters from one qstats dump
+ *
+ * Queue i is described by entry i of each column, in the order of the
+ * dump (by device, rx queues before tx queues). Counters the driver
+ * doesn't report are zero, with their bit clear in @present.
+ */
+struct qstats_sample {
+  size_t size() const {
+    return ifindex.size();
+  }
+
+  void reserve(size_t queues);
+  void clear();
+
+  /* Row of a queue, @type is NETDEV_QUEUE_TYPE_* */
+  std::optional<size_t> find(__u32 ifindex, __u32 type, __u32 id) const;
+
+  std::vector<__u32> ifindex;
+  std::vector<__u32> queue_type;
+  std::vector<__u32> queue_id;
+  /* bit qstats_col(x) set if the driver reported NETDEV_A_QSTATS_x */
+  std::vector<__u32> present;
+  /* counters reported for any of the queues */
+  __u32 present_any{0};
+  std::array<std::vector<__u64>, qstats_counters> val;
+  std::chrono::steady_clock::time_point when;
+
+  /* private: */
+  qstats_key key(size_t i) const {
+    return {ifindex[i], queue_type[i], queue_id[i]};
+  }
+  void build_index();
+
+  row_index<qstats_key, qstats_key_hash> index_;
+};
+
+/**
+ * class qstats_sampler - per-queue deltas and rates of netdev qstats
+ *
+ * Each sample() dumps the queue scoped counters into the spare of two
+ * sample buffers, so steady state sampling doesn't allocate, and compares
+ * it with the previous sample:
+ *
+ *   ynl_cpp::qstats_sampler qs;
+ *   qs.sample(ys);
+ *   ...
+ *   qs.sample(ys);
+ *   auto rx = qs.rate(ynl_cpp::qstats_col(NETDEV_A_QSTATS_RX_BYTES), row);
+ *
+ * When the set of queues didn't change between the samples (the common
+ * case) deltas are computed column by column with vector instructions,
+ * otherwise queues are matched by (ifindex, type, id). Queues which are
+ * new have zero deltas and QSTATS_NEW set, queues which went away are
+ * listed in removed. A counter which went backwards was reset (e.g. by
+ * a reconfiguration), its delta is the new value and QSTATS_RESET is set.
+ *
+ * Deltas are also summed per device and per queue type.
+ */
+class qstats_sampler {
+ public:
+  enum : __u8 {
+    QSTATS_NEW = 1,
+    QSTATS_RESET = 2,
+  };
+
+  /* Preallocate room for @queues queues */
+  void reserve(size_t queues);
+
+  /* Take a sample of all devices, or of device @ifindex */
+  result<void> sample(ynl_socket& ys, __u32 ifindex = 0);
+
+  /*
+   * sample() in steps, for messages from elsewhere: begin(), add() each
+   * qstats-get reply, false if malformed, then finish().
+   */
+  void begin();
+  bool add(const struct nlmsghdr* nlh);
+  void finish(
+      std::chrono::steady_clock::time_point when =
+          std::chrono::steady_clock::now());
+
+  const qstats_sample& cur() const {
+    return bufs_[cur_];
+  }
+
+  const qstats_sample& prev() const {
+    return bufs_[!cur_];
+  }
+
+  /* Samples taken, deltas are meaningful from the second one */
+  size_t samples() const {
+    return samples_;
+  }
+
+  /* Seconds between the last two samples */
+  double interval() const {
+    return std::chrono::duration<double>(cur().when - prev().when).count();
+  }
+
+  /* Per second rate of counter @col of row @row of cur() */
+  double rate(unsigned int col, size_t row) const {
+    double secs = interval();
+
+    return secs > 0 ? delta[col][row] / secs : 0.0;
+  }
+
+  /* Per row of cur() */
+  std::array<std::vector<__u64>, qstats_counters> delta;
+  std::vector<__u8> flags;
+  /* Rows of prev() without a match in cur() */
+  std::vector<size_t> removed;
+
+  /* Sums of delta per device, in order of appearance in the dump */
+  std::vector<__u32> dev_ifindex;
+  std::array<std::vector<__u64>, qstats_counters> dev_delta;
+  /* Sums of delta per queue type, NETDEV_QUEUE_TYPE_RX and _TX */
+  std::array<std::array<__u64, qstats_counters>, 2> type_delta{};
+
+ private:
+  qstats_sample& next() {
+    return bufs_[!cur_];
+  }
+
+  bool same_queues() const;
+  void diff_same();
+  void diff_match();
+  void aggregate();
+
+  qstats_sample bufs_[2];
+  unsigned int cur_{0};
+  size_t samples_{0};
+  /* row of prev() of each row of cur(), while matching */
+  std::vector<size_t> match_;
+  /* runs of rows of one device and queue type, as [start, end) */
+  std::vector<std::pair<size_t, size_t>> runs_;
+};
+
+} // namespace ynl_cpp
+
+#endif
@@ -0,0 +1,351 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "netdev-topology.hpp"
+
+#include <errno.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <tuple>
+
+namespace ynl_cpp {
+
+size_t topology_queue_key_hash::operator()(
+    const topology_queue_key& key) const {
+  __u64 h = (((__u64)key.ifindex << 32) | key.id) ^ ((__u64)key.type << 24);
+
+  h *= 0x9e3779b97f4a7c15ULL;
+  return h ^ (h >> 29);
+}
+
+size_t topology_id_hash::operator()(__u32 id) const {
+  __u64 h = id * 0x9e3779b97f4a7c15ULL;
+
+  return h ^ (h >> 29);
+}
+
+static int topology_read_int(const char* path) {
+  FILE* f = fopen(path, "r");
+  int val = -1;
+
+  if (!f) {
+    return -1;
+  }
+  if (fscanf(f, "%d", &val) != 1) {
+    val = -1;
+  }
+  fclose(f);
+  return val;
+}
+
+void napi_placement_from_irq(__u32 irq, napi_placement& where) {
+  char path[64];
+
+  snprintf(path, sizeof(path), "/proc/irq/%u/node", irq);
+  where.numa_node = topology_read_int(path);
+  /* a list like "2-3,8", the first CPU is enough to place a poller */
+  snprintf(path, sizeof(path), "/proc/irq/%u/effective_affinity_list", irq);
+  where.cpu = topology_read_int(path);
+}
+
+/* A few hundred queues per host, the indexes start small */
+napi_topology::napi_topology()
+    : annotate(napi_placement_from_irq),
+      queue_idx_(64),
+      napi_idx_(64),
+      irq_idx_(64),
+      dev_idx_(64) {
+  build();
+}
+
+/*
+ * Rows [0, sorted) are left in order by the previous build(), only the
+ * rows added since need sorting before the two runs are merged.
+ */
+template <typename T, typename Less>
+static void topology_sort(std::vector<T>& recs, size_t sorted, Less less) {
+  auto mid = recs.begin() + sorted;
+
+  if (!std::is_sorted(mid, recs.end(), less)) {
+    std::sort(mid, recs.end(), less);
+  }
+  if (sorted && mid != recs.end() && less(*mid, *(mid - 1))) {
+    std::inplace_merge(recs.begin(), mid, recs.end(), less);
+  }
+}
+
+void napi_topology::begin(__u32 ifindex) {
+  if (!ifindex) {
+    queue_recs_.clear();
+    napi_recs_.clear();
+  } else {
+    std::erase_if(
+        queue_recs_, [&](const auto& q) { return q.ifindex == ifindex; });
+    std::erase_if(
+        napi_recs_, [&](const auto& n) { return n.ifindex == ifindex; });
+  }
+  queue_sorted_ = queue_recs_.size();
+  napi_sorted_ = napi_recs_.size();
+}
+
+void napi_topology::add_queue(const netdev_queue_get_rsp& queue) {
+  if (!queue.ifindex || !queue.type || !queue.id) {
+    return;
+  }
+  queue_recs_.push_back({
+      .ifindex = *queue.ifindex,
+      .type = (__u32)*queue.type,
+      .id = *queue.id,
+      .napi_id = queue.napi_id.value_or(0),
+  });
+}
+
+void napi_topology::add_napi(const netdev_napi_get_rsp& napi) {
+  if (!napi.id || !napi.ifindex) {
+    return;
+  }
+  napi_recs_.push_back({
+      .id = *napi.id,
+      .ifindex = *napi.ifindex,
+      .irq = napi.irq.value_or(none),
+      .pid = napi.pid.value_or(none),
+      .where = {},
+      .placed = false,
+  });
+}
+
+void napi_topology::build() {
+  topology_sort(queue_recs_, queue_sorted_, [](const auto& a, const auto& b) {
+    return std::tie(a.ifindex, a.type, a.id) <
+        std::tie(b.ifindex, b.type, b.id);
+  });
+  topology_sort(napi_recs_, napi_sorted_, [](const auto& a, const auto& b) {
+    return std::tie(a.ifindex, a.id) < std::tie(b.ifindex, b.id);
+  });
+  queue_sorted_ = queue_recs_.size();
+  napi_sorted_ = napi_recs_.size();
+
+  /* NAPIs */
+  napis.id.clear();
+  napis.ifindex.clear();
+  napis.irq.clear();
+  napis.pid.clear();
+  napis.where.clear();
+  for (size_t i = 0; i < napi_recs_.size(); i++) {
+    auto& n = napi_recs_[i];
+
+    if (!n.placed && n.irq != none && annotate) {
+      annotate(n.irq, n.where);
+    }
+    n.placed = true;
+
+    napis.id.push_back(n.id);
+    napis.ifindex.push_back(n.ifindex);
+    napis.irq.push_back(n.irq);
+    napis.pid.push_back(n.pid);
+    napis.where.push_back(n.where);
+  }
+  napi_idx_.rebuild(
+      napis.id.size(), 0, [this](size_t i) { return napis.id[i]; });
+  /* NAPIs without an IRQ share the key none, find_irq() skips it */
+  irq_idx_.rebuild(
+      napis.irq.size(), 0, [this](size_t i) { return napis.irq[i]; });
+
+  /* Queues, and how many each NAPI has */
+  queues.ifindex.clear();
+  queues.type.clear();
+  queues.id.clear();
+  queues.napi.clear();
+  napis.queue_off.assign(napi_recs_.size() + 1, 0);
+  for (size_t i = 0; i < queue_recs_.size(); i++) {
+    const auto& q = queue_recs_[i];
+    __u32 napi = none;
+
+    if (q.napi_id) {
+      if (auto row = find_napi(q.napi_id)) {
+        napi = *row;
+        napis.queue_off[napi + 1]++;
+      }
+    }
+    queues.ifindex.push_back(q.ifindex);
+    queues.type.push_back(q.type);
+    queues.id.push_back(q.id);
+    queues.napi.push_back(napi);
+  }
+  queue_idx_.rebuild(
+      queues.id.size(), 0, [this](size_t i) { return queue_key(i); });
+
+  /* Queue rows grouped by NAPI, counts to offsets then fill */
+  for (size_t n = 0; n < napi_recs_.size(); n++) {
+    napis.queue_off[n + 1] += napis.queue_off[n];
+  }
+  queues.row.assign(napis.queue_off.back(), 0);
+  std::vector<__u32> fill(
+      napis.queue_off.begin(), napis.queue_off.end() - 1);
+  for (size_t i = 0; i < queue_recs_.size(); i++) {
+    if (queues.napi[i] != none) {
+      queues.row[fill[queues.napi[i]]++] = i;
+    }
+  }
+
+  /* Devices, both row sets are sorted by ifindex */
+  devs.ifindex.clear();
+  devs.queue_begin.clear();
+  devs.queue_end.clear();
+  devs.napi_begin.clear();
+  devs.napi_end.clear();
+  size_t q = 0, n = 0;
+  while (q < queue_recs_.size() || n < napi_recs_.size()) {
+    __u32 ifindex = std::min(
+        q < queue_recs_.size() ? queue_recs_[q].ifindex : none,
+        n < napi_recs_.size() ? napi_recs_[n].ifindex : none);
+
+    devs.ifindex.push_back(ifindex);
+    devs.queue_begin.push_back(q);
+    while (q < queue_recs_.size() && queue_recs_[q].ifindex == ifindex) {
+      q++;
+    }
+    devs.queue_end.push_back(q);
+    devs.napi_begin.push_back(n);
+    while (n < napi_recs_.size() && napi_recs_[n].ifindex == ifindex) {
+      n++;
+    }
+    devs.napi_end.push_back(n);
+  }
+  dev_idx_.rebuild(
+      devs.ifindex.size(), 0, [this](size_t d) { return devs.ifindex[d]; });
+}
+
+std::optional<size_t>
+napi_topology::find_queue(__u32 ifindex, __u32 type, __u32 id) const {
+  return queue_idx_.find(
+      {ifindex, type, id}, [this](size_t i) { return queue_key(i); });
+}
+
+std::optional<size_t> napi_topology::find_napi(__u32 napi_id) const {
+  return napi_idx_.find(napi_id, [this](size_t i) { return napis.id[i]; });
+}
+
+std::optional<size_t> napi_topology::find_irq(__u32 irq) const {
+  if (irq == none) {
+    return std::nullopt;
+  }
+  return irq_idx_.find(irq, [this](size_t i) { return napis.irq[i]; });
+}
+
+std::optional<size_t> napi_topology::find_dev(__u32 ifindex) const {
+  return dev_idx_.find(ifindex, [this](size_t d) { return devs.ifindex[d]; });
+}
+
+result<void> napi_topology::dump(ynl_socket& ys, __u32 ifindex) {
+  netdev_queue_get_req_dump qreq;
+  netdev_napi_get_req_dump nreq;
+
+  if (ifindex) {
+    qreq.ifindex = ifindex;
+    nreq.ifindex = ifindex;
+  }
+
+  auto qs = netdev_queue_get_dump_ex(ys, qreq);
+  if (!qs) {
+    return std::unexpected(qs.error());
+  }
+  auto ns = netdev_napi_get_dump_ex(ys, nreq);
+  if (!ns) {
+    return std::unexpected(ns.error());
+  }
+
+  begin(ifindex);
+  for (const auto& q : (*qs)->objs) {
+    add_queue(q);
+  }
+  for (const auto& n : (*ns)->objs) {
+    add_napi(n);
+  }
+  build();
+  return {};
+}
+
+result<void> napi_topology::load(ynl_socket& ys) {
+  return dump(ys, 0);
+}
+
+result<void> napi_topology::start() {
+  auto ret = ntf_.open(get_ynl_netdev_family(), "mgmt");
+  if (!ret) {
+    return ret;
+  }
+  return load(ntf_.dump_socket());
+}
+
+int napi_topology::fd() {
+  return ntf_.fd();
+}
+
+result<void> napi_topology::refresh(__u32 ifindex) {
+  auto ret = dump(ntf_.dump_socket(), ifindex);
+
+  /* Gone since, the del notification is on its way */
+  if (!ret && ret.error().sys_errno() == ENODEV) {
+    begin(ifindex);
+    build();
+    return {};
+  }
+  return ret;
+}
+
+result<size_t> napi_topology::poll() {
+  /* (ifindex, gone) of each device, the last event of a device wins */
+  std::vector<std::pair<__u32, bool>> devs_seen;
+  bool reloaded = false, any_gone = false;
+
+  auto polled = ntf_.poll(
+      [&](struct ynl_ntf_base_type* ntf) {
+        auto* rsp = (netdev_dev_get_ntf*)ntf;
+        bool del = ntf->cmd == NETDEV_CMD_DEV_DEL_NTF;
+
+        if (!rsp->obj.ifindex) {
+          return false;
+        }
+        auto it = std::find_if(
+            devs_seen.begin(), devs_seen.end(), [&](const auto& dev) {
+              return dev.first == *rsp->obj.ifindex;
+            });
+        if (it != devs_seen.end()) {
+          it->second = del;
+        } else {
+          devs_seen.emplace_back(*rsp->obj.ifindex, del);
+        }
+        return true;
+      },
+      [&]() {
+        reloaded = true;
+        return load(ntf_.dump_socket());
+      });
+  if (!polled) {
+    return std::unexpected(polled.error());
+  }
+  if (reloaded) {
+    return devs.ifindex.size();
+  }
+
+  for (const auto& [ifindex, gone] : devs_seen) {
+    if (gone) {
+      begin(ifindex);
+      any_gone = true;
+    }
+  }
+  if (any_gone) {
+    build();
+  }
+  for (const auto& [ifindex, gone] : devs_seen) {
+    if (!gone) {
+      auto ret = refresh(ifindex);
+      if (!ret) {
+        return std::unexpected(ret.error());
+      }
+    }
+  }
+  return devs_seen.size();
+}
+
+} // namespace ynl_cpp
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_NETDEV_TOPOLOGY_H
+#define __YNL_CPP_NETDEV_TOPOLOGY_H 1
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "netdev-user.hpp"
+#include "ynl-ntf-mirror.hpp"
+#include "ynl-row-index.hpp"
+
+namespace ynl_cpp {
+
+/* Placement of a NAPI, -1 where unknown */
+struct napi_placement {
+  int numa_node{-1};
+  int cpu{-1};
+};
+
+struct topology_queue_key {
+  __u32 ifindex;
+  __u32 type;
+  __u32 id;
+
+  bool operator==(const topology_queue_key&) const = default;
+};
+
+struct topology_queue_key_hash {
+  size_t operator()(const topology_queue_key& key) const;
+};
+
+/* NAPI ids, IRQs and ifindexes */
+struct topology_id_hash {
+  size_t operator()(__u32 id) const;
+};
+
+/*
+ * Placement from procfs: the NUMA node and the first CPU of the effective
+ * affinity of the NAPI's IRQ. A default for napi_topology::annotate.
+ */
+void napi_placement_from_irq(__u32 irq, napi_placement& where);
+
+/**
+ * class napi_topology - queue to NAPI to IRQ map of the netdevs
+ *
+ * Joins a queue-get dump (the NAPI of each queue) with a napi-get dump
+ * (IRQ and thread of each NAPI) into flat arrays. Queue i is described by
+ * entry i of each column of queues, ordered by device, type and id, NAPIs
+ * likewise by device and id. Rows link to each other by index:
+ * queues.napi of a queue and the queues.row[napis.queue_off[n] ..
+ * napis.queue_off[n + 1]) of NAPI n. Devices hold the ranges of their
+ * rows. Hash indexes find queues, NAPIs (by id or IRQ) and devices in
+ * O(1).
+ *
+ * The annotate hook fills in the placement of each NAPI when it is first
+ * seen, napi_placement_from_irq() unless replaced.
+ *
+ * After start() the map follows the netdev notifications: devices which
+ * appear or change are re-dumped on their own by poll(), devices which
+ * go away are dropped. Not every queue reconfiguration is notified,
+ * refresh() re-dumps a device on demand. Rows are renumbered by each
+ * update, the ids are stable.
+ *
+ * Not thread safe, one thread drives the map and reads it.
+ */
+class napi_topology {
+ public:
+  static constexpr __u32 none = ~0U;
+
+  napi_topology();
+
+  /* Snapshot all devices */
+  result<void> load(ynl_socket& ys);
+
+  /* Snapshot, then follow the notifications */
+  result<void> start();
+  int fd();
+  /* Apply pending notifications, returns the number of devices updated */
+  result<size_t> poll();
+  /* Re-dump one device, on the start() sockets */
+  result<void> refresh(__u32 ifindex);
+
+  /* Rows of device @ifindex are replaced by what is added next */
+  void begin(__u32 ifindex = 0);
+  void add_queue(const netdev_queue_get_rsp& queue);
+  void add_napi(const netdev_napi_get_rsp& napi);
+  /* Sort, link and index, after all the adds */
+  void build();
+
+  std::optional<size_t> find_queue(__u32 ifindex, __u32 type, __u32 id) const;
+  std::optional<size_t> find_napi(__u32 napi_id) const;
+  std::optional<size_t> find_irq(__u32 irq) const;
+  std::optional<size_t> find_dev(__u32 ifindex) const;
+
+  std::function<void(__u32 irq, napi_placement& where)> annotate;
+
+  struct {
+    std::vector<__u32> ifindex;
+    std::vector<__u32> type;
+    std::vector<__u32> id;
+    /* row of the NAPI, none if the queue has none */
+    std::vector<__u32> napi;
+    /* queue rows grouped by NAPI, see napis.queue_off */
+    std::vector<__u32> row;
+  } queues;
+
+  struct {
+    std::vector<__u32> id;
+    std::vector<__u32> ifindex;
+    /* none if the NAPI has no IRQ / thread */
+    std::vector<__u32> irq;
+    std::vector<__u32> pid;
+    std::vector<napi_placement> where;
+    /* size + 1 entries */
+    std::vector<__u32> queue_off;
+  } napis;
+
+  struct {
+    std::vector<__u32> ifindex;
+    /* [begin, end) rows of queues and napis */
+    std::vector<__u32> queue_begin;
+    std::vector<__u32> queue_end;
+    std::vector<__u32> napi_begin;
+    std::vector<__u32> napi_end;
+  } devs;
+
+ private:
+  struct queue_rec {
+    __u32 ifindex;
+    __u32 type;
+    __u32 id;
+    __u32 napi_id;
+  };
+
+  struct napi_rec {
+    __u32 id;
+    __u32 ifindex;
+    __u32 irq;
+    __u32 pid;
+    napi_placement where;
+    bool placed;
+  };
+
+  result<void> dump(ynl_socket& ys, __u32 ifindex);
+
+  std::vector<queue_rec> queue_recs_;
+  std::vector<napi_rec> napi_recs_;
+  /* rows still in order since the last build() */
+  size_t queue_sorted_{0};
+  size_t napi_sorted_{0};
+
+  topology_queue_key queue_key(size_t i) const {
+    return {queues.ifindex[i], queues.type[i], queues.id[i]};
+  }
+
+  row_index<topology_queue_key, topology_queue_key_hash> queue_idx_;
+  row_index<__u32, topology_id_hash> napi_idx_;
+  row_index<__u32, topology_id_hash> irq_idx_;
+  row_index<__u32, topology_id_hash> dev_idx_;
+
+  ntf_mirror ntf_;
+};
+
+} // namespace ynl_cpp
+
+#endif
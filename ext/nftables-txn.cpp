@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "nftables-txn.hpp"
+
+#include <arpa/inet.h>
+#include <stdint.h>
+#include <sys/socket.h>
+
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netfilter/nfnetlink.h>
+
+#include <algorithm>
+
+namespace ynl_cpp {
+
+#define NFT_TXN_MSG(cmd) (NFNL_SUBSYS_NFTABLES << 8 | (cmd))
+
+static struct nlmsghdr* nft_msg_start(
+    msg_batch& batch,
+    __u16 type,
+    __u16 flags,
+    __u8 family,
+    __u16 res_id) {
+  struct nlmsghdr* nlh = batch.msg_start(type, flags);
+  struct nfgenmsg nfg = {};
+
+  nfg.nfgen_family = family;
+  nfg.version = NFNETLINK_V0;
+  nfg.res_id = htons(res_id);
+  memcpy(ynl_nlmsg_put_extra_header(nlh, sizeof(nfg)), &nfg, sizeof(nfg));
+
+  return nlh;
+}
+
+nft_transaction::nft_transaction(ynl_socket& ys) : batch_(ys) {
+  begin();
+}
+
+void nft_transaction::begin() {
+  struct nlmsghdr* nlh;
+
+  nlh = nft_msg_start(
+      batch_, NFNL_MSG_BATCH_BEGIN, 0, AF_UNSPEC, NFNL_SUBSYS_NFTABLES);
+  /* Patched in by commit(), 0 disables the check */
+  ynl_attr_put_u32(nlh, NFTABLES_A_BATCH_ATTRS_GENID, 0);
+  batch_.msg_end(nlh, nullptr);
+}
+
+void nft_transaction::clear() {
+  batch_.clear();
+  elem_msgs_.clear();
+  n_elems_ = 0;
+  begin();
+}
+
+result<size_t> nft_transaction::add_setelems(
+    __u8 family,
+    const std::string& table,
+    const std::string& set,
+    std::span<const nftables_setelem_attrs> elems,
+    __u16 flags) {
+  size_t i = 0, n_msgs = 0;
+
+  while (i < elems.size()) {
+    struct nlmsghdr* nlh;
+    struct nlattr* nest;
+    size_t first = i;
+
+    nlh = nft_msg_start(
+        batch_, NFT_TXN_MSG(NFT_MSG_NEWSETELEM), flags, family, 0);
+    /* The elements nest has a 16 bit length, stop filling well before */
+    nlh->nlmsg_pid = UINT16_MAX;
+
+    ynl_attr_put_str(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_TABLE, table.c_str());
+    ynl_attr_put_str(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_SET, set.c_str());
+    nest = ynl_attr_nest_start(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_ELEMENTS);
+    for (; i < elems.size(); i++) {
+      __u32 len = nlh->nlmsg_len;
+
+      nftables_setelem_attrs_put(
+          nlh, NFTABLES_A_SETELEM_LIST_ELEM_ATTRS_ELEM, elems[i]);
+      /* Doesn't fit, unless it's the only one leave it for the next msg */
+      if (nlh->nlmsg_pid == YNL_MSG_OVERFLOW && i != first) {
+        nlh->nlmsg_len = len;
+        nlh->nlmsg_pid = UINT16_MAX;
+        break;
+      }
+    }
+    ynl_attr_nest_end(nlh, nest);
+
+    auto idx = batch_.msg_end(
+        nlh, &nftables_setelem_list_attrs_nest, sizeof(struct nfgenmsg));
+    if (!idx) {
+      return std::unexpected(idx.error());
+    }
+    elem_msgs_.push_back({*idx, n_elems_ + first});
+    n_msgs++;
+  }
+
+  n_elems_ += elems.size();
+  return n_msgs;
+}
+
+size_t nft_transaction::failed_elem(const msg_batch::failure& f) {
+  const struct nlattr *attr, *elem;
+  struct nlmsghdr* nlh;
+  size_t k;
+
+  auto it = std::lower_bound(
+      elem_msgs_.begin(),
+      elem_msgs_.end(),
+      std::make_pair(f.index, (size_t)0));
+  if (it == elem_msgs_.end() || it->first != f.index || !f.err.attr_offs()) {
+    return SIZE_MAX;
+  }
+
+  nlh = batch_.msg(f.index);
+  ynl_attr_for_each(attr, nlh, sizeof(struct nfgenmsg)) {
+    if (ynl_attr_type(attr) != NFTABLES_A_SETELEM_LIST_ATTRS_ELEMENTS) {
+      continue;
+    }
+
+    k = 0;
+    ynl_attr_for_each_nested(elem, attr) {
+      size_t start = (const char*)elem - (const char*)nlh;
+
+      if (f.err.attr_offs() >= start &&
+          f.err.attr_offs() < start + elem->nla_len) {
+        return it->second + k;
+      }
+      k++;
+    }
+  }
+
+  return SIZE_MAX;
+}
+
+result<std::vector<msg_batch::failure>> nft_transaction::commit(__u32 genid) {
+  const struct nlattr* attr;
+  struct nlmsghdr* nlh;
+  size_t end;
+
+  ynl_attr_for_each(attr, batch_.msg(0), sizeof(struct nfgenmsg)) {
+    if (ynl_attr_type(attr) == NFTABLES_A_BATCH_ATTRS_GENID) {
+      __be32 val = htonl(genid);
+
+      memcpy(ynl_attr_data(attr), &val, sizeof(val));
+    }
+  }
+
+  nlh = nft_msg_start(
+      batch_, NFNL_MSG_BATCH_END, 0, AF_UNSPEC, NFNL_SUBSYS_NFTABLES);
+  auto idx = batch_.msg_end(nlh, nullptr);
+  if (!idx) {
+    return std::unexpected(idx.error());
+  }
+  end = *idx;
+
+  /* nfnetlink only treats the messages of one send() as a batch */
+  auto ret = batch_.send(true);
+  /* Only framed for this send, a retry or more messages come after */
+  batch_.pop_back();
+  if (!ret) {
+    return ret;
+  }
+
+  /* Framing errors (e.g. genid mismatch) fail the whole call */
+  for (const auto& f : *ret) {
+    if (f.index == 0 || f.index == end) {
+      return std::unexpected(f.err);
+    }
+  }
+  return ret;
+}
+
+} // namespace ynl_cpp
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_NFTABLES_TXN_H
+#define __YNL_CPP_NFTABLES_TXN_H 1
+
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "nftables-user.hpp"
+
+namespace ynl_cpp {
+
+/**
+ * class nft_transaction - atomic nftables ruleset update
+ *
+ * Messages added with the generated nftables_*_batch() calls, e.g.
+ * nftables_newrule_batch(txn.batch(), req), are framed by a batch-begin
+ * and a batch-end message and sent to the kernel with a single send().
+ * The kernel applies all of them or, if any of them fails, none.
+ *
+ * Only failing messages are answered, so commit() costs one send() and
+ * draining the errors no matter how many messages the transaction holds.
+ * Failures are reported by the message index the *_batch() call returned.
+ *
+ *   ynl_cpp::nft_transaction txn(ys);
+ *   nftables_newtable_batch(txn.batch(), table);
+ *   txn.add_setelems(NFPROTO_INET, "filter", "blocklist", elems);
+ *   auto failed = txn.commit();
+ */
+class nft_transaction {
+ public:
+  explicit nft_transaction(ynl_socket& ys);
+
+  msg_batch& batch() {
+    return batch_;
+  }
+
+  /* Drop all messages, to build a new transaction */
+  void clear();
+
+  /*
+   * Add @elems to @set, packing as many elements per newsetelem message as
+   * fit. Elements are encoded in place, without building requests.
+   * Returns the number of messages used.
+   */
+  result<size_t> add_setelems(
+      __u8 family,
+      const std::string& table,
+      const std::string& set,
+      std::span<const nftables_setelem_attrs> elems,
+      __u16 flags = NLM_F_CREATE);
+
+  /*
+   * Element which caused @f, if the kernel pointed at one, else SIZE_MAX.
+   * Elements are numbered across all add_setelems() calls, in order.
+   */
+  size_t failed_elem(const msg_batch::failure& f);
+
+  /*
+   * Send the transaction. @genid, if not 0, makes the kernel reject it
+   * with ERESTART if the ruleset generation changed in the meantime.
+   * The messages are kept until clear(), for failed_elem() and to commit
+   * them again, e.g. with a new @genid after ERESTART.
+   */
+  result<std::vector<msg_batch::failure>> commit(__u32 genid = 0);
+
+ private:
+  void begin();
+
+  msg_batch batch_;
+  /* (message index, number of its first element) of setelem messages */
+  std::vector<std::pair<size_t, size_t>> elem_msgs_;
+  size_t n_elems_{0};
+};
+
+} // namespace ynl_cpp
+
+#endif
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "ovs_flow-batch.hpp"
+
+#include <stdio.h>
+
+#include <linux/openvswitch.h>
+
+namespace ynl_cpp {
+
+ovs_flow_batch::ovs_flow_batch(ynl_socket& ys, int dp_ifindex)
+    : batch_(ys), dp_ifindex_(dp_ifindex) {}
+
+struct nlmsghdr* ovs_flow_batch::msg_start(__u8 cmd, __u16 flags) {
+  struct nlmsghdr* nlh = batch_.gemsg_start(cmd, OVS_FLOW_VERSION);
+  struct ovs_header ovsh = {};
+
+  nlh->nlmsg_flags |= flags;
+  ovsh.dp_ifindex = dp_ifindex_;
+  memcpy(ynl_nlmsg_put_extra_header(nlh, sizeof(ovsh)), &ovsh, sizeof(ovsh));
+
+  return nlh;
+}
+
+/* Nest payloads are attribute streams already, copy them in one go */
+static void ovs_flow_put_nest(
+    struct nlmsghdr* nlh,
+    unsigned int type,
+    std::span<const __u8> attrs) {
+  ynl_attr_put(nlh, type | NLA_F_NESTED, attrs.data(), attrs.size());
+}
+
+result<size_t> ovs_flow_batch::add_new(
+    std::span<const __u8> key,
+    std::span<const __u8> mask,
+    std::span<const __u8> actions,
+    const ovs_ufid* ufid,
+    __u8 ufid_len,
+    __u16 flags) {
+  struct nlmsghdr* nlh;
+
+  nlh = msg_start(OVS_FLOW_CMD_NEW, flags);
+  ovs_flow_put_nest(nlh, OVS_FLOW_ATTR_KEY, key);
+  if (ufid) {
+    ynl_attr_put(nlh, OVS_FLOW_ATTR_UFID, ufid->bytes, ufid_len);
+  }
+  /* No mask means exact match, an empty one would wildcard everything */
+  if (!mask.empty()) {
+    ovs_flow_put_nest(nlh, OVS_FLOW_ATTR_MASK, mask);
+  }
+  /* Actions are mandatory, empty means drop */
+  ovs_flow_put_nest(nlh, OVS_FLOW_ATTR_ACTIONS, actions);
+
+  return batch_.msg_end(nlh, &ovs_flow_flow_attrs_nest);
+}
+
+result<size_t>
+ovs_flow_batch::add_new(const ovs_flow_table& table, size_t i, __u16 flags) {
+  return add_new(
+      table.key(i),
+      table.mask(i),
+      table.actions(i),
+      table.ufid_len[i] ? &table.ufid[i] : nullptr,
+      table.ufid_len[i],
+      flags);
+}
+
+result<size_t> ovs_flow_batch::add_del(const ovs_ufid& ufid, __u8 ufid_len) {
+  struct nlmsghdr* nlh;
+
+  nlh = msg_start(OVS_FLOW_CMD_DEL, 0);
+  ynl_attr_put(nlh, OVS_FLOW_ATTR_UFID, ufid.bytes, ufid_len);
+  /* Only matters if someone listens, skip what they don't need */
+  ynl_attr_put_u32(
+      nlh,
+      OVS_FLOW_ATTR_UFID_FLAGS,
+      OVS_UFID_F_OMIT_KEY | OVS_UFID_F_OMIT_MASK | OVS_UFID_F_OMIT_ACTIONS);
+
+  return batch_.msg_end(nlh, &ovs_flow_flow_attrs_nest);
+}
+
+result<size_t> ovs_flow_batch::add_del(std::span<const __u8> key) {
+  struct nlmsghdr* nlh;
+
+  /* A delete without key nor UFID flushes the whole datapath */
+  if (key.empty()) {
+    struct ynl_error yerr = {};
+
+    yerr.code = (enum ynl_error_code)EINVAL;
+    snprintf(yerr.msg, sizeof(yerr.msg), "Empty flow key");
+    return std::unexpected(error(yerr));
+  }
+
+  nlh = msg_start(OVS_FLOW_CMD_DEL, 0);
+  ovs_flow_put_nest(nlh, OVS_FLOW_ATTR_KEY, key);
+
+  return batch_.msg_end(nlh, &ovs_flow_flow_attrs_nest);
+}
+
+result<std::vector<int>> ovs_flow_batch::send() {
+  std::vector<int> status(size(), 0);
+
+  auto failed = batch_.send();
+  if (!failed) {
+    return std::unexpected(failed.error());
+  }
+  for (const auto& f : *failed) {
+    status[f.index] = f.err.sys_errno() ?: EINVAL;
+  }
+  return status;
+}
+
+} // namespace ynl_cpp
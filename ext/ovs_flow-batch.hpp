@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_OVS_FLOW_BATCH_H
+#define __YNL_CPP_OVS_FLOW_BATCH_H 1
+
+#include <span>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "ovs_flow-table.hpp"
+#include "ovs_flow-user.hpp"
+
+namespace ynl_cpp {
+
+/**
+ * class ovs_flow_batch - bulk flow installation and removal
+ *
+ * Encodes OVS_FLOW_CMD_NEW / OVS_FLOW_CMD_DEL messages for one datapath
+ * straight from raw key, mask and actions attribute streams, e.g. the
+ * pools of an ovs_flow_table snapshot being replayed after a failover,
+ * without building generated request objects. send() pipelines them, as
+ * many messages per send() as the socket send buffer takes, without
+ * waiting for an ACK in between, and reports an outcome per flow.
+ *
+ *   ynl_cpp::ovs_flow_batch fb(ys, dp_ifindex);
+ *   for (size_t i = 0; i < snap.size(); i++)
+ *     fb.add_new(snap, i);
+ *   auto status = fb.send();
+ */
+class ovs_flow_batch {
+ public:
+  ovs_flow_batch(ynl_socket& ys, int dp_ifindex);
+
+  /* Number of queued flow operations */
+  size_t size() const {
+    return batch_.size();
+  }
+
+  msg_batch& batch() {
+    return batch_;
+  }
+
+  /* Drop all queued operations */
+  void clear() {
+    batch_.clear();
+  }
+
+  /*
+   * Queue installing a flow, @ufid of @ufid_len bytes if given. Without
+   * NLM_F_EXCL in @flags an existing flow gets its actions replaced.
+   * Returns the index of the flow in the batch.
+   */
+  result<size_t> add_new(
+      std::span<const __u8> key,
+      std::span<const __u8> mask,
+      std::span<const __u8> actions,
+      const ovs_ufid* ufid = nullptr,
+      __u8 ufid_len = 16,
+      __u16 flags = 0);
+
+  /* Queue installing flow @i of @table, as it was dumped */
+  result<size_t>
+  add_new(const ovs_flow_table& table, size_t i, __u16 flags = 0);
+
+  /* Queue removing the flow with @ufid, or the one matching @key */
+  result<size_t> add_del(const ovs_ufid& ufid, __u8 ufid_len = 16);
+  result<size_t> add_del(std::span<const __u8> key);
+
+  /*
+   * Send all queued operations. Entry i of the result is 0 if operation
+   * i succeeded, its errno otherwise. batch().send() has the extack
+   * details of failures instead.
+   */
+  result<std::vector<int>> send();
+
+ private:
+  struct nlmsghdr* msg_start(__u8 cmd, __u16 flags);
+
+  msg_batch batch_;
+  int dp_ifindex_;
+};
+
+} // namespace ynl_cpp
+
+#endif
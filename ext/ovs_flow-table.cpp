@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "ovs_flow-table.hpp"
+
+#include <linux/genetlink.h>
+#include <linux/openvswitch.h>
+
+namespace ynl_cpp {
+
+#define OVS_FLOW_HDRLEN (GENL_HDRLEN + sizeof(struct ovs_header))
+
+size_t ovs_ufid_key_hash::operator()(const ovs_ufid_key& key) const {
+  __u64 a, b, h;
+
+  memcpy(&a, key.ufid.bytes, sizeof(a));
+  memcpy(&b, key.ufid.bytes + sizeof(a), sizeof(b));
+  h = (a ^ key.len) * 0x9e3779b97f4a7c15ULL;
+  h = (h ^ b) * 0xbf58476d1ce4e5b9ULL;
+  return h ^ (h >> 31);
+}
+
+void ovs_flow_table::reserve(size_t flows, size_t nest_bytes) {
+  ufid_len.reserve(flows);
+  ufid.reserve(flows);
+  packets.reserve(flows);
+  bytes.reserve(flows);
+  used.reserve(flows);
+  tcp_flags.reserve(flows);
+  key_off.reserve(flows + 1);
+  mask_off.reserve(flows + 1);
+  actions_off.reserve(flows + 1);
+  /* keys and masks are about the same size, actions tend to be short */
+  key_pool.reserve(nest_bytes * 4 / 9);
+  mask_pool.reserve(nest_bytes * 4 / 9);
+  actions_pool.reserve(nest_bytes / 9);
+
+  index_.reserve(size(), flows, [this](size_t i) { return index_key(i); });
+}
+
+void ovs_flow_table::clear() {
+  ufid_len.clear();
+  ufid.clear();
+  packets.clear();
+  bytes.clear();
+  used.clear();
+  tcp_flags.clear();
+  key_off.resize(1);
+  key_pool.clear();
+  mask_off.resize(1);
+  mask_pool.clear();
+  actions_off.resize(1);
+  actions_pool.clear();
+  index_.clear();
+}
+
+void ovs_flow_table::pop_back() {
+  ufid_len.pop_back();
+  ufid.pop_back();
+  packets.pop_back();
+  bytes.pop_back();
+  used.pop_back();
+  tcp_flags.pop_back();
+  key_pool.resize(key_off.back());
+  mask_pool.resize(mask_off.back());
+  actions_pool.resize(actions_off.back());
+}
+
+std::optional<size_t>
+ovs_flow_table::find(const ovs_ufid& id, __u8 len) const {
+  if (!len) {
+    return std::nullopt;
+  }
+  return index_.find({id, len}, [this](size_t i) { return index_key(i); });
+}
+
+static void
+ovs_flow_put_nest(std::vector<__u8>& pool, const struct nlattr* attr) {
+  const __u8* data = (const __u8*)ynl_attr_data(attr);
+
+  pool.insert(pool.end(), data, data + ynl_attr_data_len(attr));
+}
+
+bool ovs_flow_table::add(const struct nlmsghdr* nlh) {
+  const struct nlattr* attr;
+  size_t i = size();
+
+  if (nlh->nlmsg_len < NLMSG_HDRLEN + OVS_FLOW_HDRLEN) {
+    return false;
+  }
+
+  ufid_len.push_back(0);
+  ufid.push_back({});
+  packets.push_back(0);
+  bytes.push_back(0);
+  used.push_back(0);
+  tcp_flags.push_back(0);
+
+  ynl_attr_for_each(attr, nlh, OVS_FLOW_HDRLEN) {
+    unsigned int len = ynl_attr_data_len(attr);
+    bool ok = true;
+
+    switch (ynl_attr_type(attr)) {
+      case OVS_FLOW_ATTR_KEY:
+        ovs_flow_put_nest(key_pool, attr);
+        break;
+      case OVS_FLOW_ATTR_MASK:
+        ovs_flow_put_nest(mask_pool, attr);
+        break;
+      case OVS_FLOW_ATTR_ACTIONS:
+        ovs_flow_put_nest(actions_pool, attr);
+        break;
+      case OVS_FLOW_ATTR_STATS: {
+        struct ovs_flow_stats st;
+
+        ok = len >= sizeof(st);
+        if (ok) {
+          memcpy(&st, ynl_attr_data(attr), sizeof(st));
+          packets[i] = st.n_packets;
+          bytes[i] = st.n_bytes;
+        }
+        break;
+      }
+      case OVS_FLOW_ATTR_USED:
+        ok = len == sizeof(__u64);
+        if (ok) {
+          used[i] = ynl_attr_get_u64(attr);
+        }
+        break;
+      case OVS_FLOW_ATTR_TCP_FLAGS:
+        ok = len >= sizeof(__u8);
+        if (ok) {
+          tcp_flags[i] = ynl_attr_get_u8(attr);
+        }
+        break;
+      case OVS_FLOW_ATTR_UFID:
+        ok = len && len <= sizeof(ufid[i].bytes);
+        if (ok) {
+          memcpy(ufid[i].bytes, ynl_attr_data(attr), len);
+          ufid_len[i] = len;
+        }
+        break;
+    }
+    if (!ok) {
+      pop_back();
+      return false;
+    }
+  }
+
+  /* Offsets are 32 bit, that's 4G of keys, masks or actions */
+  if (key_pool.size() > UINT32_MAX || mask_pool.size() > UINT32_MAX ||
+      actions_pool.size() > UINT32_MAX) {
+    pop_back();
+    return false;
+  }
+  key_off.push_back(key_pool.size());
+  mask_off.push_back(mask_pool.size());
+  actions_off.push_back(actions_pool.size());
+
+  /*
+   * A re-dumped flow replaces its older row. Flows without a UFID share
+   * the zero key, find() never looks it up.
+   */
+  index_.add(size(), packets.capacity(), [this](size_t r) {
+    return index_key(r);
+  });
+  return true;
+}
+
+result<void>
+ovs_flow_table::dump(ynl_socket& ys, int dp_ifindex, __u32 ufid_flags) {
+  ovs_flow_get_req_dump req;
+
+  req._hdr.dp_ifindex = dp_ifindex;
+  if (ufid_flags) {
+    req.ufid_flags = ufid_flags;
+  }
+  auto tmpl = ovs_flow_get_dump_prepare(ys, req);
+  if (!tmpl) {
+    return std::unexpected(tmpl.error());
+  }
+
+  clear();
+  return dump_raw(
+      ys,
+      ynl_msg_reuse(ys, tmpl->nlh()),
+      OVS_FLOW_CMD_GET,
+      [this](const struct nlmsghdr* nlh) { return add(nlh); });
+}
+
+} // namespace ynl_cpp
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_OVS_FLOW_TABLE_H
+#define __YNL_CPP_OVS_FLOW_TABLE_H 1
+
+#include <string.h>
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "ovs_flow-user.hpp"
+#include "ynl-row-index.hpp"
+
+namespace ynl_cpp {
+
+/* Shorter UFIDs occupy the first ufid_len bytes, the rest is zeroed */
+struct ovs_ufid {
+  __u8 bytes[16];
+};
+
+struct ovs_ufid_key {
+  ovs_ufid ufid;
+  __u8 len;
+
+  bool operator==(const ovs_ufid_key& o) const {
+    return len == o.len && !memcmp(ufid.bytes, o.ufid.bytes, sizeof(ufid));
+  }
+};
+
+struct ovs_ufid_key_hash {
+  size_t operator()(const ovs_ufid_key& key) const;
+};
+
+/**
+ * class ovs_flow_table - columnar snapshot of the flows of a datapath
+ *
+ * Decodes the messages of an OVS_FLOW_CMD_GET dump straight into one
+ * array per field. Statistics, last use and TCP flags are decoded, the
+ * key, mask and actions nests are copied verbatim into shared pools, to
+ * be walked with ynl_attr_for_each_payload() when needed. Their
+ * key_off / mask_off / actions_off columns hold size() + 1 offsets.
+ *
+ * Flows installed with a UFID are indexed by it, see find(). Dumping
+ * with OVS_UFID_F_OMIT_* flags leaves the corresponding nests out of
+ * the replies for such flows, which makes stats-only scrapes of large
+ * datapaths several times cheaper for the kernel and for us.
+ */
+class ovs_flow_table {
+ public:
+  size_t size() const {
+    return packets.size();
+  }
+
+  /* Preallocate room for @flows flows, with @nest_bytes of key/mask/acts */
+  void reserve(size_t flows, size_t nest_bytes = 0);
+
+  /* Forget all flows, memory is kept for the next snapshot */
+  void clear();
+
+  /* Decode one OVS_FLOW_CMD_GET reply, false if it's malformed */
+  bool add(const struct nlmsghdr* nlh);
+
+  /* Row of the flow with @ufid of @len bytes */
+  std::optional<size_t> find(const ovs_ufid& ufid, __u8 len = 16) const;
+
+  /*
+   * Replace the contents with a fresh dump of datapath @dp_ifindex.
+   * @ufid_flags (OVS_UFID_F_OMIT_KEY / _MASK / _ACTIONS) are passed on.
+   */
+  result<void> dump(ynl_socket& ys, int dp_ifindex, __u32 ufid_flags = 0);
+
+  std::span<const __u8> key(size_t i) const {
+    return {key_pool.data() + key_off[i], key_off[i + 1] - key_off[i]};
+  }
+
+  std::span<const __u8> mask(size_t i) const {
+    return {mask_pool.data() + mask_off[i], mask_off[i + 1] - mask_off[i]};
+  }
+
+  std::span<const __u8> actions(size_t i) const {
+    return {
+        actions_pool.data() + actions_off[i],
+        actions_off[i + 1] - actions_off[i]};
+  }
+
+  /* 0 if the flow has no UFID */
+  std::vector<__u8> ufid_len;
+  std::vector<ovs_ufid> ufid;
+
+  /* stats, zero until the flow matched a packet */
+  std::vector<__u64> packets;
+  std::vector<__u64> bytes;
+  /* msecs of monotonic time of the last packet, 0 if none */
+  std::vector<__u64> used;
+  std::vector<__u8> tcp_flags;
+
+  /* Attribute streams, without the nest header */
+  std::vector<__u32> key_off{0};
+  std::vector<__u8> key_pool;
+  std::vector<__u32> mask_off{0};
+  std::vector<__u8> mask_pool;
+  std::vector<__u32> actions_off{0};
+  std::vector<__u8> actions_pool;
+
+ private:
+  void pop_back();
+  ovs_ufid_key index_key(size_t i) const {
+    return {ufid[i], ufid_len[i]};
+  }
+
+  row_index<ovs_ufid_key, ovs_ufid_key_hash> index_;
+};
+
+} // namespace ynl_cpp
+
+#endif
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "rt_link-stats.hpp"
+
+#include <linux/rtnetlink.h>
+
+namespace ynl_cpp {
+
+size_t link_stats_hash::operator()(__u32 ifindex) const {
+  __u64 h = ifindex * 0x9e3779b97f4a7c15ULL;
+
+  return h ^ (h >> 29);
+}
+
+void link_stats_table::reserve(size_t links) {
+  ifindex.reserve(links);
+  stats.reserve(links);
+
+  index_.reserve(size(), links, [this](size_t i) { return ifindex[i]; });
+}
+
+void link_stats_table::clear() {
+  ifindex.clear();
+  stats.clear();
+  index_.clear();
+}
+
+std::optional<size_t> link_stats_table::find(__u32 ifidx) const {
+  return index_.find(ifidx, [this](size_t i) { return ifindex[i]; });
+}
+
+bool link_stats_table::put_stats(__u32 ifidx, const struct nlattr* attr) {
+  unsigned int len = ynl_attr_data_len(attr);
+  struct rtnl_link_stats64* st;
+
+  /* Older kernels send a shorter struct, all of them have the basics */
+  if (len < offsetof(struct rtnl_link_stats64, rx_length_errors)) {
+    return false;
+  }
+
+  if (auto row = find(ifidx)) {
+    st = &stats[*row];
+  } else {
+    ifindex.push_back(ifidx);
+    st = &stats.emplace_back();
+    index_.add(size(), ifindex.capacity(), [this](size_t i) {
+      return ifindex[i];
+    });
+  }
+
+  if (len < sizeof(*st)) {
+    memset(st, 0, sizeof(*st));
+  }
+  memcpy(st, ynl_attr_data(attr), std::min<size_t>(len, sizeof(*st)));
+  return true;
+}
+
+bool link_stats_table::add(const struct nlmsghdr* nlh) {
+  const struct nlattr* attr;
+  unsigned int hdr_len;
+  __u16 stats_type;
+  __u32 ifidx;
+
+  switch (nlh->nlmsg_type) {
+    case RTM_NEWSTATS: {
+      const struct if_stats_msg* ifsm;
+
+      hdr_len = sizeof(*ifsm);
+      if (nlh->nlmsg_len < NLMSG_HDRLEN + hdr_len) {
+        return false;
+      }
+      ifsm = (const struct if_stats_msg*)ynl_nlmsg_data(nlh);
+      ifidx = ifsm->ifindex;
+      stats_type = IFLA_STATS_LINK_64;
+      break;
+    }
+    case RTM_NEWLINK: {
+      const struct ifinfomsg* ifi;
+
+      hdr_len = sizeof(*ifi);
+      if (nlh->nlmsg_len < NLMSG_HDRLEN + hdr_len) {
+        return false;
+      }
+      ifi = (const struct ifinfomsg*)ynl_nlmsg_data(nlh);
+      ifidx = ifi->ifi_index;
+      stats_type = IFLA_STATS64;
+      break;
+    }
+    default:
+      return false;
+  }
+
+  ynl_attr_for_each(attr, nlh, hdr_len) {
+    if (ynl_attr_type(attr) == stats_type) {
+      return put_stats(ifidx, attr);
+    }
+  }
+  /* No counters (e.g. filtered out), nothing to record */
+  return true;
+}
+
+result<void> link_stats_table::dump(ynl_socket& ys) {
+  rt_link_getstats_req_dump req;
+
+  /* IFLA_STATS_FILTER_BIT() */
+  req._hdr.filter_mask = 1U << (IFLA_STATS_LINK_64 - 1);
+  auto tmpl = rt_link_getstats_dump_prepare(ys, req);
+  if (!tmpl) {
+    return std::unexpected(tmpl.error());
+  }
+
+  clear();
+  return dump_raw(
+      ys,
+      ynl_msg_reuse(ys, tmpl->nlh()),
+      RTM_NEWSTATS,
+      [this](const struct nlmsghdr* nlh) { return add(nlh); });
+}
+
+} // namespace ynl_cpp
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_RT_LINK_STATS_H
+#define __YNL_CPP_RT_LINK_STATS_H 1
+
+#include <optional>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "rt_link-user.hpp"
+#include "ynl-row-index.hpp"
+
+namespace ynl_cpp {
+
+struct link_stats_hash {
+  size_t operator()(__u32 ifindex) const;
+};
+
+/**
+ * class link_stats_table - snapshot of the 64 bit counters of all links
+ *
+ * dump() uses RTM_GETSTATS with a filter mask of IFLA_STATS_LINK_64 only,
+ * so the kernel sends one small message per link, none of the link info,
+ * kind specific nests or VF lists a getlink dump would carry. Each reply
+ * is one memcpy() of struct rtnl_link_stats64 into the stats column.
+ *
+ * add() also takes RTM_NEWLINK messages (IFLA_STATS64), e.g. link
+ * notifications. Link i is described by entry i of each column, links
+ * are indexed by ifindex, see find().
+ */
+class link_stats_table {
+ public:
+  size_t size() const {
+    return ifindex.size();
+  }
+
+  /* Preallocate room for @links links */
+  void reserve(size_t links);
+
+  /* Forget all links, memory is kept for the next snapshot */
+  void clear();
+
+  /*
+   * Decode one RTM_NEWSTATS or RTM_NEWLINK message, false if malformed.
+   * A link seen before has its row updated in place.
+   */
+  bool add(const struct nlmsghdr* nlh);
+
+  std::optional<size_t> find(__u32 ifindex) const;
+
+  /* Replace the contents with the counters of all links */
+  result<void> dump(ynl_socket& ys);
+
+  std::vector<__u32> ifindex;
+  /* Counters the kernel doesn't have are left zeroed */
+  std::vector<struct rtnl_link_stats64> stats;
+
+ private:
+  bool put_stats(__u32 ifidx, const struct nlattr* attr);
+
+  row_index<__u32, link_stats_hash> index_;
+};
+
+} // namespace ynl_cpp
+
+#endif
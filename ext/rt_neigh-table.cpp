@@ -0,0 +1,400 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "rt_neigh-table.hpp"
+
+#include <stddef.h>
+#include <sys/socket.h>
+
+#include <linux/rtnetlink.h>
+
+namespace ynl_cpp {
+
+static_assert(sizeof(neigh_entry) % sizeof(__u64) == 0);
+
+#define NEIGH_TABLE_MIN_SLOTS 1024
+#define NEIGH_TABLE_RCVBUF (8 << 20)
+
+static bool neigh_key_eq(const neigh_entry& a, const neigh_entry& b) {
+  return a.ifindex == b.ifindex && a.family == b.family &&
+      !memcmp(a.dst, b.dst, sizeof(a.dst));
+}
+
+static bool neigh_addr_get(
+    __u8* dst,
+    size_t size,
+    const void* data,
+    size_t len,
+    __u8* len_out) {
+  if (len > size) {
+    return false;
+  }
+  memcpy(dst, data, len);
+  if (len_out) {
+    *len_out = len;
+  }
+  return true;
+}
+
+/*
+ * Entries are keyed by their network address. AF_BRIDGE FDB entries have
+ * none (NDA_DST is the VXLAN remote, if any) and would all collapse into
+ * one, so only IPv4 / IPv6 neighbours are held.
+ */
+static bool neigh_family_ok(__u8 family) {
+  return family == AF_INET || family == AF_INET6;
+}
+
+static bool neigh_entry_from_msg(const struct nlmsghdr* nlh, neigh_entry* e) {
+  const struct nlattr* attr;
+  const struct ndmsg* ndm;
+
+  if (nlh->nlmsg_len < NLMSG_HDRLEN + sizeof(*ndm)) {
+    return false;
+  }
+  ndm = (const struct ndmsg*)ynl_nlmsg_data(nlh);
+
+  *e = {};
+  e->family = ndm->family;
+  e->ifindex = ndm->ifindex;
+  e->state = ndm->state;
+  e->flags = ndm->flags;
+  e->type = ndm->type;
+
+  ynl_attr_for_each(attr, nlh, sizeof(*ndm)) {
+    unsigned int type = ynl_attr_type(attr);
+    unsigned int len = ynl_attr_data_len(attr);
+
+    if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_DST &&
+        !neigh_addr_get(
+            e->dst, sizeof(e->dst), ynl_attr_data(attr), len, nullptr)) {
+      return false;
+    } else if (
+        type == RT_NEIGH_A_NEIGHBOUR_ATTRS_LLADDR &&
+        !neigh_addr_get(
+            e->lladdr,
+            sizeof(e->lladdr),
+            ynl_attr_data(attr),
+            len,
+            &e->lladdr_len)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static bool neigh_entry_from_rsp(
+    const rt_neigh_getneigh_rsp& rsp,
+    neigh_entry* e) {
+  *e = {};
+  e->family = rsp._hdr.family;
+  e->ifindex = rsp._hdr.ifindex;
+  e->state = rsp._hdr.state;
+  e->flags = rsp._hdr.flags;
+  e->type = rsp._hdr.type;
+
+  return neigh_family_ok(e->family) &&
+      neigh_addr_get(
+             e->dst, sizeof(e->dst), rsp.dst.data(), rsp.dst.size(), nullptr) &&
+      neigh_addr_get(
+             e->lladdr,
+             sizeof(e->lladdr),
+             rsp.lladdr.data(),
+             rsp.lladdr.size(),
+             &e->lladdr_len);
+}
+
+neigh_table::neigh_table() {
+  auto tbl = std::make_unique<struct slots>();
+
+  tbl->mask = NEIGH_TABLE_MIN_SLOTS - 1;
+  tbl->entries.reset(new slot[NEIGH_TABLE_MIN_SLOTS]());
+  tbl_.store(tbl.get(), std::memory_order_release);
+  tables_.push_back(std::move(tbl));
+}
+
+neigh_table::~neigh_table() = default;
+
+bool neigh_table::read_slot(const struct slot& s, neigh_entry* e) {
+  __u64 words[n_words];
+  __u32 seq;
+
+  do {
+    seq = s.seq.load(std::memory_order_acquire);
+    if (seq & 1) {
+      continue;
+    }
+    for (size_t i = 0; i < n_words; i++) {
+      words[i] = s.words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while ((seq & 1) || seq != s.seq.load(std::memory_order_relaxed));
+
+  memcpy(e, words, sizeof(*e));
+  return e->family;
+}
+
+void neigh_table::write_slot(struct slot& s, const neigh_entry& e) {
+  __u32 seq = s.seq.load(std::memory_order_relaxed);
+  __u64 words[n_words];
+
+  memcpy(words, &e, sizeof(e));
+
+  s.seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  for (size_t i = 0; i < n_words; i++) {
+    s.words[i].store(words[i], std::memory_order_relaxed);
+  }
+  s.seq.store(seq + 2, std::memory_order_release);
+}
+
+__u32 neigh_table::read_begin(const struct slots* tbl) {
+  __u32 seq;
+
+  while ((seq = tbl->seq.load(std::memory_order_acquire)) & 1) {
+  }
+  return seq;
+}
+
+bool neigh_table::read_retry(const struct slots* tbl, __u32 seq) {
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return seq != tbl->seq.load(std::memory_order_relaxed);
+}
+
+size_t neigh_table::hash(__u32 ifindex, __u8 family, const __u8* dst) {
+  __u64 a, b, h;
+
+  memcpy(&a, dst, sizeof(a));
+  memcpy(&b, dst + sizeof(a), sizeof(b));
+
+  h = ((__u64)ifindex << 8 | family) * 0x9e3779b97f4a7c15ULL;
+  h = (h ^ a) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ b) * 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
+/* Slot holding @key, or the empty slot terminating its probe sequence */
+struct neigh_table::slot* neigh_table::find(
+    const struct slots* tbl,
+    const neigh_entry& key) const {
+  size_t i = hash(key.ifindex, key.family, key.dst);
+  neigh_entry e;
+
+  for (;; i++) {
+    struct slot& s = tbl->entries[i & tbl->mask];
+
+    if (!read_slot(s, &e) || neigh_key_eq(e, key)) {
+      return &s;
+    }
+  }
+}
+
+std::optional<neigh_entry>
+neigh_table::lookup(__u32 ifindex, __u8 family, const void* dst) const {
+  const struct slots* tbl = tbl_.load(std::memory_order_acquire);
+  neigh_entry key = {};
+  neigh_entry e;
+  bool found;
+  __u32 seq;
+
+  key.ifindex = ifindex;
+  key.family = family;
+  memcpy(key.dst, dst, family == AF_INET ? 4 : sizeof(key.dst));
+
+  do {
+    seq = read_begin(tbl);
+    found = read_slot(*find(tbl, key), &e);
+  } while (read_retry(tbl, seq));
+
+  if (!found || e.deleted) {
+    return std::nullopt;
+  }
+  return e;
+}
+
+/*
+ * Drop the tombstones. If the live entries fit in a quarter of the table
+ * they are rehashed in place, otherwise into a table at least twice the
+ * size, so only tables which were outgrown are retired.
+ */
+void neigh_table::rehash() {
+  struct slots* old = tbl_.load(std::memory_order_relaxed);
+  std::vector<std::pair<neigh_entry, __u32>> live;
+  struct slots* tbl = old;
+  size_t n = old->mask + 1;
+  __u32 seq = 0;
+
+  while (n < live_.load(std::memory_order_relaxed) * 4) {
+    n *= 2;
+  }
+
+  /* Readers check the horizon after the table, or its sequence counter */
+  horizon_.store(
+      generation_.load(std::memory_order_relaxed), std::memory_order_release);
+
+  live.reserve(live_.load(std::memory_order_relaxed));
+  for (size_t i = 0; i <= old->mask; i++) {
+    neigh_entry e;
+
+    if (read_slot(old->entries[i], &e) && !e.deleted) {
+      live.emplace_back(e, old->entries[i].seen);
+    }
+  }
+
+  if (n > old->mask + 1) {
+    auto grown = std::make_unique<struct slots>();
+
+    grown->mask = n - 1;
+    grown->entries.reset(new slot[n]());
+    tbl = grown.get();
+    tables_.push_back(std::move(grown));
+  } else {
+    seq = old->seq.load(std::memory_order_relaxed);
+    old->seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i <= old->mask; i++) {
+      neigh_entry e;
+
+      if (read_slot(old->entries[i], &e)) {
+        write_slot(old->entries[i], {});
+      }
+      old->entries[i].seen = 0;
+    }
+  }
+
+  used_ = 0;
+  for (const auto& [e, seen] : live) {
+    struct slot* s = find(tbl, e);
+
+    write_slot(*s, e);
+    s->seen = seen;
+    used_++;
+  }
+
+  if (tbl == old) {
+    old->seq.store(seq + 2, std::memory_order_release);
+  } else {
+    tbl_.store(tbl, std::memory_order_release);
+  }
+}
+
+void neigh_table::update(neigh_entry& e, bool del) {
+  struct slot* s = find(tbl_.load(std::memory_order_relaxed), e);
+  __u64 gen = generation_.load(std::memory_order_relaxed) + 1;
+  bool found, was_live;
+  neigh_entry old;
+
+  found = read_slot(*s, &old);
+  was_live = found && !old.deleted;
+  s->seen = seen_;
+
+  if (del) {
+    if (!was_live) {
+      return;
+    }
+    e = old;
+    e.deleted = 1;
+  } else if (
+      was_live && !memcmp(&old, &e, offsetof(neigh_entry, generation))) {
+    return;
+  }
+
+  e.generation = gen;
+  write_slot(*s, e);
+  generation_.store(gen, std::memory_order_release);
+
+  if (del) {
+    live_.fetch_sub(1, std::memory_order_relaxed);
+  } else if (!was_live) {
+    live_.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (!found && ++used_ * 2 > tbl_.load(std::memory_order_relaxed)->mask) {
+    rehash();
+  }
+}
+
+result<void> neigh_table::start() {
+  auto ret = ntf_.open(
+      get_ynl_rt_neigh_family(), "rtnlgrp-neigh", NEIGH_TABLE_RCVBUF);
+  if (!ret) {
+    return ret;
+  }
+  return resync();
+}
+
+int neigh_table::fd() {
+  return ntf_.fd();
+}
+
+result<void> neigh_table::resync() {
+  const struct slots* tbl;
+  rt_neigh_getneigh_req_dump req;
+  neigh_entry e;
+
+  auto tmpl = rt_neigh_getneigh_dump_prepare(ntf_.dump_socket(), req);
+  if (!tmpl) {
+    return std::unexpected(tmpl.error());
+  }
+
+  seen_++;
+  auto ret = dump_raw(
+      ntf_.dump_socket(),
+      ynl_msg_reuse(ntf_.dump_socket(), tmpl->nlh()),
+      RTM_NEWNEIGH,
+      [this](const struct nlmsghdr* nlh) {
+        neigh_entry n;
+
+        if (!neigh_entry_from_msg(nlh, &n)) {
+          return false;
+        }
+        if (neigh_family_ok(n.family)) {
+          update(n, false);
+        }
+        return true;
+      });
+  if (!ret) {
+    return ret;
+  }
+
+  /* Sweep entries which were not in the dump, deletions never grow */
+  tbl = tbl_.load(std::memory_order_relaxed);
+  for (size_t i = 0; i <= tbl->mask; i++) {
+    if (read_slot(tbl->entries[i], &e) && !e.deleted &&
+        tbl->entries[i].seen != seen_) {
+      update(e, true);
+    }
+  }
+
+  resyncs_.fetch_add(1, std::memory_order_relaxed);
+  return {};
+}
+
+result<size_t> neigh_table::poll() {
+  return ntf_.poll(
+      [this](struct ynl_ntf_base_type* ntf) {
+        auto* rsp = (rt_neigh_getneigh_ntf*)ntf;
+
+        return apply(rsp->obj, ntf->cmd == RTM_DELNEIGH);
+      },
+      [this]() { return resync(); });
+}
+
+bool neigh_table::apply(const rt_neigh_getneigh_rsp& neigh, bool del) {
+  neigh_entry e;
+
+  if (!neigh_entry_from_rsp(neigh, &e)) {
+    return false;
+  }
+  update(e, del);
+  return true;
+}
+
+size_t neigh_table::footprint() const {
+  size_t bytes = 0;
+
+  for (const auto& tbl : tables_) {
+    bytes += sizeof(*tbl) + (tbl->mask + 1) * sizeof(struct slot);
+  }
+  return bytes;
+}
+
+} // namespace ynl_cpp
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_RT_NEIGH_TABLE_H
+#define __YNL_CPP_RT_NEIGH_TABLE_H 1
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "rt_neigh-user.hpp"
+#include "ynl-ntf-mirror.hpp"
+
+namespace ynl_cpp {
+
+struct neigh_entry {
+  __u8 dst[16]; /* IPv4 addresses occupy the first 4 bytes */
+  __u32 ifindex;
+  __u16 state; /* NUD_* */
+  __u8 family;
+  __u8 type;
+  __u8 flags;
+  __u8 lladdr_len;
+  __u8 deleted;
+  __u8 pad;
+  __u8 lladdr[20];
+  /* table generation at which the entry last changed */
+  __u64 generation;
+};
+
+/**
+ * class neigh_table - neighbour table mirror, kept current by notifications
+ *
+ * Seeded with a getneigh dump and updated from RTM_NEWNEIGH / RTM_DELNEIGH
+ * notifications. If the notification socket overflows (ENOBUFS) the table
+ * is resynchronized with a fresh dump, entries missing from it are deleted.
+ * Only IPv4 and IPv6 neighbours are held, bridge FDB entries are skipped.
+ *
+ * Entries are hashed by (ifindex, family, dst) in an open addressing table.
+ * One thread drives the table with start() and poll(), any number of
+ * threads may concurrently call the const query methods. Queries don't
+ * take locks, each slot is guarded by a sequence counter and readers retry
+ * if they raced with an update. Once tombstones and entries fill half the
+ * table it is rehashed: in place, under a table wide sequence counter
+ * readers also retry on, if the entries fit, else into a table twice the
+ * size. Tables outgrown that way are retired, not freed, until the
+ * neigh_table is destroyed, so the memory overhead of growing is bounded
+ * to 2x.
+ *
+ * Every change bumps the table generation and stamps the entry with it.
+ * Deleted entries stay around as tombstones (deleted == 1) until the next
+ * rehash, so consumers can fetch deltas with changes_since().
+ */
+class neigh_table {
+ public:
+  neigh_table();
+  ~neigh_table();
+
+  neigh_table(const neigh_table&) = delete;
+  neigh_table& operator=(const neigh_table&) = delete;
+
+  /* Writer side */
+
+  /* Open the sockets, subscribe to notifications and load the table */
+  result<void> start();
+
+  /* Notification socket fd, for poll() / epoll integration */
+  int fd();
+
+  /*
+   * Apply all pending notifications without blocking, resyncing on
+   * overflow. Returns the number of notifications applied.
+   */
+  result<size_t> poll();
+
+  /* Reload the table with a dump, deleting entries which disappeared */
+  result<void> resync();
+
+  /*
+   * Apply one neighbour as a notification would, returns false if it
+   * isn't one the table holds
+   */
+  bool apply(const rt_neigh_getneigh_rsp& neigh, bool del);
+
+  /* Bytes of the current table and of the retired ones */
+  size_t footprint() const;
+
+  /* Reader side, safe to call from any thread */
+
+  std::optional<neigh_entry>
+  lookup(__u32 ifindex, __u8 family, const void* dst) const;
+
+  /* Calls fn(const neigh_entry&) for every live entry */
+  template <typename F>
+  void for_each(F&& fn) const {
+    const struct slots* tbl = tbl_.load(std::memory_order_acquire);
+
+    for (const auto& e :
+         collect(tbl, [](const neigh_entry& n) { return !n.deleted; })) {
+      fn(e);
+    }
+  }
+
+  /*
+   * Calls fn(const neigh_entry&) for every entry, including deleted ones,
+   * which changed after generation @gen. Returns the generation to pass
+   * to the next call, or nothing (without calling fn) if tombstones from
+   * after @gen have already been dropped; the caller then has to start
+   * over with for_each().
+   */
+  template <typename F>
+  std::optional<__u64> changes_since(__u64 gen, F&& fn) const {
+    /* all changes up to this generation are in the table loaded below */
+    __u64 now = generation_.load(std::memory_order_acquire);
+    const struct slots* tbl = tbl_.load(std::memory_order_acquire);
+    auto changed = collect(
+        tbl, [gen](const neigh_entry& n) { return n.generation > gen; });
+
+    /* stored before any tombstone it covers is dropped */
+    if (gen < horizon_.load(std::memory_order_acquire)) {
+      return std::nullopt;
+    }
+    for (const auto& e : changed) {
+      fn(e);
+    }
+    return now;
+  }
+
+  __u64 generation() const {
+    return generation_.load(std::memory_order_acquire);
+  }
+
+  size_t size() const {
+    return live_.load(std::memory_order_relaxed);
+  }
+
+  /* Number of dumps done so far, including the initial one */
+  __u64 resyncs() const {
+    return resyncs_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr size_t n_words = sizeof(neigh_entry) / sizeof(__u64);
+
+  struct slot {
+    std::atomic<__u32> seq;
+    /* resync mark, only accessed by the writer */
+    __u32 seen;
+    std::atomic<__u64> words[n_words];
+  };
+
+  struct slots {
+    /* odd while the entries move around in place */
+    std::atomic<__u32> seq{0};
+    size_t mask;
+    std::unique_ptr<slot[]> entries;
+  };
+
+  static bool read_slot(const struct slot& s, neigh_entry* e);
+  static void write_slot(struct slot& s, const neigh_entry& e);
+  static size_t hash(__u32 ifindex, __u8 family, const __u8* dst);
+
+  static __u32 read_begin(const struct slots* tbl);
+  static bool read_retry(const struct slots* tbl, __u32 seq);
+
+  /*
+   * Entries matching @pred, copied out first so that a scan which raced
+   * with a rehash in place starts over without calling anyone twice
+   */
+  template <typename P>
+  static std::vector<neigh_entry> collect(const struct slots* tbl, P&& pred) {
+    std::vector<neigh_entry> out;
+    neigh_entry e;
+    __u32 seq;
+
+    do {
+      seq = read_begin(tbl);
+      out.clear();
+      for (size_t i = 0; i <= tbl->mask; i++) {
+        if (read_slot(tbl->entries[i], &e) && pred(e)) {
+          out.push_back(e);
+        }
+      }
+    } while (read_retry(tbl, seq));
+    return out;
+  }
+
+  struct slot* find(const struct slots* tbl, const neigh_entry& key) const;
+  void rehash();
+  void update(neigh_entry& e, bool del);
+
+  ntf_mirror ntf_;
+
+  std::atomic<struct slots*> tbl_;
+  std::vector<std::unique_ptr<struct slots>> tables_;
+  size_t used_{0};
+  __u32 seen_{0};
+
+  std::atomic<__u64> generation_{0};
+  std::atomic<__u64> horizon_{0};
+  std::atomic<size_t> live_{0};
+  std::atomic<__u64> resyncs_{0};
+};
+
+} // namespace ynl_cpp
+
+#endif
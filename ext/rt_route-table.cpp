@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "rt_route-table.hpp"
+
+#include <linux/rtnetlink.h>
+#include <string.h>
+
+namespace ynl_cpp {
+
+void route_table::reserve(size_t routes, size_t nexthops) {
+  family.reserve(routes);
+  dst_len.reserve(routes);
+  protocol.reserve(routes);
+  scope.reserve(routes);
+  type.reserve(routes);
+  table.reserve(routes);
+  dst.reserve(routes);
+  gateway.reserve(routes);
+  oif.reserve(routes);
+  priority.reserve(routes);
+  nh_off.reserve(routes + 1);
+  nh_pool.reserve(routes * nexthops);
+  metric_off.reserve(routes + 1);
+}
+
+void route_table::clear() {
+  family.clear();
+  dst_len.clear();
+  protocol.clear();
+  scope.clear();
+  type.clear();
+  table.clear();
+  dst.clear();
+  gateway.clear();
+  oif.clear();
+  priority.clear();
+  nh_off.resize(1);
+  nh_pool.clear();
+  metric_off.resize(1);
+  metric_pool.clear();
+}
+
+void route_table::pop_back() {
+  family.pop_back();
+  dst_len.pop_back();
+  protocol.pop_back();
+  scope.pop_back();
+  type.pop_back();
+  table.pop_back();
+  dst.pop_back();
+  gateway.pop_back();
+  oif.pop_back();
+  priority.pop_back();
+  nh_pool.resize(nh_off.back());
+  metric_pool.resize(metric_off.back());
+}
+
+static bool route_addr_get(struct route_addr* addr, const struct nlattr* attr) {
+  unsigned int len = ynl_attr_data_len(attr);
+
+  if (len > sizeof(addr->bytes)) {
+    return false;
+  }
+  memcpy(addr->bytes, ynl_attr_data(attr), len);
+  return true;
+}
+
+static bool route_nexthops_get(
+    std::vector<route_nexthop>& pool,
+    const struct nlattr* mp) {
+  const unsigned char* pos = (const unsigned char*)ynl_attr_data(mp);
+  size_t rem = ynl_attr_data_len(mp);
+
+  while (rem >= sizeof(struct rtnexthop)) {
+    const struct rtnexthop* rtnh = (const struct rtnexthop*)pos;
+    const unsigned char* data = (const unsigned char*)RTNH_DATA(rtnh);
+    const struct nlattr* attr;
+
+    if (rtnh->rtnh_len < sizeof(*rtnh) || rtnh->rtnh_len > rem) {
+      return false;
+    }
+
+    struct route_nexthop& nh = pool.emplace_back();
+    nh.oif = rtnh->rtnh_ifindex;
+    nh.weight = rtnh->rtnh_hops + 1;
+    nh.flags = rtnh->rtnh_flags;
+
+    ynl_attr_for_each_payload(data, rtnh->rtnh_len - RTNH_LENGTH(0), attr) {
+      if (ynl_attr_type(attr) == RT_ROUTE_A_ROUTE_ATTRS_RTA_GATEWAY &&
+          !route_addr_get(&nh.gateway, attr)) {
+        return false;
+      }
+    }
+
+    size_t step = RTNH_ALIGN(rtnh->rtnh_len);
+
+    if (step >= rem) {
+      break;
+    }
+    pos += step;
+    rem -= step;
+  }
+
+  return true;
+}
+
+static void route_metrics_get(
+    std::vector<route_metric>& pool,
+    const struct nlattr* nest) {
+  const struct nlattr* attr;
+
+  ynl_attr_for_each_nested(attr, nest) {
+    /*
+     * All metrics but the congestion control name are u32, which may be
+     * 4 bytes long too ("bbr")
+     */
+    if (ynl_attr_type(attr) != RTAX_CC_ALGO &&
+        ynl_attr_data_len(attr) == sizeof(__u32)) {
+      pool.push_back({(__u16)ynl_attr_type(attr), ynl_attr_get_u32(attr)});
+    }
+  }
+}
+
+bool route_table::add(const struct nlmsghdr* nlh) {
+  const struct nlattr* attr;
+  const struct rtmsg* rtm;
+  size_t i = size();
+
+  if (nlh->nlmsg_len < NLMSG_HDRLEN + sizeof(*rtm)) {
+    return false;
+  }
+  rtm = (const struct rtmsg*)ynl_nlmsg_data(nlh);
+
+  family.push_back(rtm->rtm_family);
+  dst_len.push_back(rtm->rtm_dst_len);
+  protocol.push_back(rtm->rtm_protocol);
+  scope.push_back(rtm->rtm_scope);
+  type.push_back(rtm->rtm_type);
+  table.push_back(rtm->rtm_table);
+  dst.push_back({});
+  gateway.push_back({});
+  oif.push_back(0);
+  priority.push_back(0);
+
+  ynl_attr_for_each(attr, nlh, sizeof(*rtm)) {
+    unsigned int len = ynl_attr_data_len(attr);
+    bool ok = true;
+
+    switch (ynl_attr_type(attr)) {
+      case RT_ROUTE_A_ROUTE_ATTRS_RTA_DST:
+        ok = route_addr_get(&dst[i], attr);
+        break;
+      case RT_ROUTE_A_ROUTE_ATTRS_RTA_GATEWAY:
+        ok = route_addr_get(&gateway[i], attr);
+        break;
+      case RT_ROUTE_A_ROUTE_ATTRS_RTA_OIF:
+        ok = len == sizeof(__u32);
+        oif[i] = ok ? ynl_attr_get_u32(attr) : 0;
+        break;
+      case RT_ROUTE_A_ROUTE_ATTRS_RTA_PRIORITY:
+        ok = len == sizeof(__u32);
+        priority[i] = ok ? ynl_attr_get_u32(attr) : 0;
+        break;
+      case RT_ROUTE_A_ROUTE_ATTRS_RTA_TABLE:
+        ok = len == sizeof(__u32);
+        table[i] = ok ? ynl_attr_get_u32(attr) : 0;
+        break;
+      case RT_ROUTE_A_ROUTE_ATTRS_RTA_MULTIPATH:
+        ok = route_nexthops_get(nh_pool, attr);
+        break;
+      case RT_ROUTE_A_ROUTE_ATTRS_RTA_METRICS:
+        route_metrics_get(metric_pool, attr);
+        break;
+    }
+    if (!ok) {
+      pop_back();
+      return false;
+    }
+  }
+
+  nh_off.push_back(nh_pool.size());
+  metric_off.push_back(metric_pool.size());
+  return true;
+}
+
+result<void> route_table::dump(ynl_socket& ys, __u8 af) {
+  struct ynl_sock* sock = ys;
+  struct nlmsghdr* nlh;
+  struct rtmsg* rtm;
+
+  nlh = ynl_msg_start_dump(sock, RTM_GETROUTE);
+  rtm = (struct rtmsg*)ynl_nlmsg_put_extra_header(nlh, sizeof(*rtm));
+  memset(rtm, 0, sizeof(*rtm));
+  rtm->rtm_family = af;
+  sock->req_policy = &rt_route_route_attrs_nest;
+  sock->req_hdr_len = sizeof(struct rtmsg);
+
+  clear();
+  return dump_raw(
+      ys,
+      nlh,
+      RTM_NEWROUTE,
+      [this](const struct nlmsghdr* rsp) { return add(rsp); });
+}
+
+} // namespace ynl_cpp
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_RT_ROUTE_TABLE_H
+#define __YNL_CPP_RT_ROUTE_TABLE_H 1
+
+#include <span>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "rt_route-user.hpp"
+
+namespace ynl_cpp {
+
+/* IPv4 addresses occupy the first 4 bytes, the rest is zeroed */
+struct route_addr {
+  __u8 bytes[16];
+};
+
+struct route_nexthop {
+  struct route_addr gateway;
+  __u32 oif;
+  __u16 weight;
+  __u8 flags;
+};
+
+struct route_metric {
+  __u16 type;
+  __u32 value;
+};
+
+/**
+ * class route_table - columnar snapshot of the routing tables
+ *
+ * Routes are decoded straight from the RTM_NEWROUTE messages of a
+ * getroute dump into one array per field, there is no per-route object
+ * and no per-route allocation once the table has been reserve()d.
+ * Route i is described by entry i of each column. Multipath nexthops and
+ * metrics live in shared pools, the nh_off / metric_off columns hold
+ * size() + 1 offsets into them.
+ *
+ * Single path routes have their gateway and oif in the route columns
+ * and no entries in the nexthop pool, multipath routes the opposite.
+ */
+class route_table {
+ public:
+  size_t size() const {
+    return family.size();
+  }
+
+  /* Preallocate room for @routes routes, each with @nexthops nexthops */
+  void reserve(size_t routes, size_t nexthops = 0);
+
+  /* Forget all routes, memory is kept for the next snapshot */
+  void clear();
+
+  /* Decode one RTM_NEWROUTE message, false if it's malformed */
+  bool add(const struct nlmsghdr* nlh);
+
+  /*
+   * Replace the contents with a fresh dump of the routes of @af (AF_UNSPEC
+   * for all), streaming the dump without building a generated reply list.
+   */
+  result<void> dump(ynl_socket& ys, __u8 af = 0);
+
+  std::span<const route_nexthop> nexthops(size_t i) const {
+    return {nh_pool.data() + nh_off[i], nh_off[i + 1] - nh_off[i]};
+  }
+
+  std::span<const route_metric> metrics(size_t i) const {
+    return {
+        metric_pool.data() + metric_off[i],
+        metric_off[i + 1] - metric_off[i]};
+  }
+
+  /* rtmsg fields */
+  std::vector<__u8> family;
+  std::vector<__u8> dst_len;
+  std::vector<__u8> protocol;
+  std::vector<__u8> scope;
+  std::vector<__u8> type;
+  /* RTA_TABLE, falls back to rtm_table */
+  std::vector<__u32> table;
+
+  std::vector<route_addr> dst;
+  std::vector<route_addr> gateway;
+  std::vector<__u32> oif;
+  std::vector<__u32> priority;
+
+  std::vector<__u32> nh_off{0};
+  std::vector<route_nexthop> nh_pool;
+  std::vector<__u32> metric_off{0};
+  std::vector<route_metric> metric_pool;
+
+ private:
+  void pop_back();
+};
+
+} // namespace ynl_cpp
+
+#endif
@@ -0,0 +1,347 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "tc-stats.hpp"
+
+#include <algorithm>
+
+#include <linux/rtnetlink.h>
+
+namespace ynl_cpp {
+
+size_t tc_stats_key_hash::operator()(const tc_stats_key& key) const {
+  __u64 h;
+
+  h = ((__u64)key.ifindex << 32 | key.handle) * 0x9e3779b97f4a7c15ULL;
+  h = (h ^ ((__u64)key.parent << 16 | key.type)) * 0xbf58476d1ce4e5b9ULL;
+  return h ^ (h >> 31);
+}
+
+void tc_stats_table::reserve(size_t objs) {
+  msg_type.reserve(objs);
+  kind.reserve(objs);
+  ifindex.reserve(objs);
+  handle.reserve(objs);
+  parent.reserve(objs);
+  bytes.reserve(objs);
+  packets.reserve(objs);
+  hw_bytes.reserve(objs);
+  hw_packets.reserve(objs);
+  qlen.reserve(objs);
+  backlog.reserve(objs);
+  drops.reserve(objs);
+  requeues.reserve(objs);
+  overlimits.reserve(objs);
+  bps.reserve(objs);
+  pps.reserve(objs);
+
+  index_.reserve(size(), objs, [this](size_t i) { return key(i); });
+}
+
+void tc_stats_table::clear() {
+  msg_type.clear();
+  kind.clear();
+  ifindex.clear();
+  handle.clear();
+  parent.clear();
+  bytes.clear();
+  packets.clear();
+  hw_bytes.clear();
+  hw_packets.clear();
+  qlen.clear();
+  backlog.clear();
+  drops.clear();
+  requeues.clear();
+  overlimits.clear();
+  bps.clear();
+  pps.clear();
+  index_.clear();
+}
+
+void tc_stats_table::pop_back() {
+  msg_type.pop_back();
+  kind.pop_back();
+  ifindex.pop_back();
+  handle.pop_back();
+  parent.pop_back();
+  bytes.pop_back();
+  packets.pop_back();
+  hw_bytes.pop_back();
+  hw_packets.pop_back();
+  qlen.pop_back();
+  backlog.pop_back();
+  drops.pop_back();
+  requeues.pop_back();
+  overlimits.pop_back();
+  bps.pop_back();
+  pps.pop_back();
+}
+
+void tc_stats_table::move_row(size_t to, size_t from) {
+  msg_type[to] = msg_type[from];
+  kind[to] = kind[from];
+  ifindex[to] = ifindex[from];
+  handle[to] = handle[from];
+  parent[to] = parent[from];
+  bytes[to] = bytes[from];
+  packets[to] = packets[from];
+  hw_bytes[to] = hw_bytes[from];
+  hw_packets[to] = hw_packets[from];
+  qlen[to] = qlen[from];
+  backlog[to] = backlog[from];
+  drops[to] = drops[from];
+  requeues[to] = requeues[from];
+  overlimits[to] = overlimits[from];
+  bps[to] = bps[from];
+  pps[to] = pps[from];
+}
+
+void tc_stats_table::begin(__u32 dev) {
+  size_t kept = 0;
+
+  for (size_t i = 0; i < size(); i++) {
+    if (ifindex[i] == dev) {
+      continue;
+    }
+    if (kept != i) {
+      move_row(kept, i);
+    }
+    kept++;
+  }
+  if (kept == size()) {
+    return;
+  }
+  while (size() > kept) {
+    pop_back();
+  }
+  index_.rebuild(
+      size(), msg_type.capacity(), [this](size_t i) { return key(i); });
+}
+
+std::optional<size_t>
+tc_stats_table::find(__u16 type, __u32 ifidx, __u32 hndl, __u32 prnt) const {
+  return index_.find(
+      {type, ifidx, hndl, prnt}, [this](size_t i) { return key(i); });
+}
+
+bool tc_stats_table::put_kind(size_t i, const struct nlattr* attr) {
+  const char* str = (const char*)ynl_attr_data(attr);
+  size_t len = strnlen(str, ynl_attr_data_len(attr));
+
+  /* Only a handful of kinds in practice, most recent first */
+  for (size_t k = kinds.size(); k--;) {
+    if (kinds[k].size() == len && !memcmp(kinds[k].data(), str, len)) {
+      kind[i] = k;
+      return true;
+    }
+  }
+  if (kinds.size() > UINT16_MAX) {
+    return false;
+  }
+  kind[i] = kinds.size();
+  kinds.emplace_back(str, len);
+  return true;
+}
+
+bool tc_stats_table::put_stats2(size_t i, const struct nlattr* nest) {
+  /* pkt64 follows the basic or basic-hw attribute it extends */
+  __u64* last_packets = nullptr;
+  const struct nlattr* attr;
+  bool rate64 = false;
+
+  ynl_attr_for_each_nested(attr, nest) {
+    const void* data = ynl_attr_data(attr);
+    unsigned int len = ynl_attr_data_len(attr);
+
+    switch (ynl_attr_type(attr)) {
+      case TC_A_TCA_STATS_ATTRS_BASIC:
+      case TC_A_TCA_STATS_ATTRS_BASIC_HW: {
+        bool hw = ynl_attr_type(attr) == TC_A_TCA_STATS_ATTRS_BASIC_HW;
+        struct gnet_stats_basic b;
+
+        if (len < sizeof(b)) {
+          return false;
+        }
+        memcpy(&b, data, sizeof(b));
+        (hw ? hw_bytes : bytes)[i] = b.bytes;
+        last_packets = &(hw ? hw_packets : packets)[i];
+        *last_packets = b.packets;
+        break;
+      }
+      case TC_A_TCA_STATS_ATTRS_PKT64:
+        if (len != sizeof(__u64) || !last_packets) {
+          return false;
+        }
+        *last_packets = ynl_attr_get_u64(attr);
+        break;
+      case TC_A_TCA_STATS_ATTRS_QUEUE: {
+        struct gnet_stats_queue q;
+
+        if (len < sizeof(q)) {
+          return false;
+        }
+        memcpy(&q, data, sizeof(q));
+        qlen[i] = q.qlen;
+        backlog[i] = q.backlog;
+        drops[i] = q.drops;
+        requeues[i] = q.requeues;
+        overlimits[i] = q.overlimits;
+        break;
+      }
+      case TC_A_TCA_STATS_ATTRS_RATE_EST: {
+        struct gnet_stats_rate_est r;
+
+        if (len < sizeof(r)) {
+          return false;
+        }
+        if (!rate64) {
+          memcpy(&r, data, sizeof(r));
+          bps[i] = r.bps;
+          pps[i] = r.pps;
+        }
+        break;
+      }
+      case TC_A_TCA_STATS_ATTRS_RATE_EST64: {
+        struct gnet_stats_rate_est64 r;
+
+        if (len < sizeof(r)) {
+          return false;
+        }
+        memcpy(&r, data, sizeof(r));
+        bps[i] = r.bps;
+        pps[i] = r.pps;
+        rate64 = true;
+        break;
+      }
+    }
+  }
+
+  return true;
+}
+
+bool tc_stats_table::add(const struct nlmsghdr* nlh) {
+  const struct nlattr* compat = nullptr;
+  const struct nlattr* attr;
+  const struct tcmsg* tcm;
+  bool stats2 = false;
+  size_t i = size();
+
+  if (nlh->nlmsg_len < NLMSG_HDRLEN + sizeof(*tcm)) {
+    return false;
+  }
+  tcm = (const struct tcmsg*)ynl_nlmsg_data(nlh);
+
+  msg_type.push_back(nlh->nlmsg_type);
+  kind.push_back(0);
+  ifindex.push_back(tcm->ifindex);
+  handle.push_back(tcm->handle);
+  parent.push_back(tcm->parent);
+  bytes.push_back(0);
+  packets.push_back(0);
+  hw_bytes.push_back(0);
+  hw_packets.push_back(0);
+  qlen.push_back(0);
+  backlog.push_back(0);
+  drops.push_back(0);
+  requeues.push_back(0);
+  overlimits.push_back(0);
+  bps.push_back(0);
+  pps.push_back(0);
+
+  ynl_attr_for_each(attr, nlh, sizeof(*tcm)) {
+    bool ok = true;
+
+    switch (ynl_attr_type(attr)) {
+      case TC_A_TC_ATTRS_KIND:
+        ok = put_kind(i, attr);
+        break;
+      case TC_A_TC_ATTRS_STATS2:
+        ok = put_stats2(i, attr);
+        stats2 = true;
+        break;
+      case TC_A_TC_ATTRS_STATS:
+        compat = attr;
+        break;
+    }
+    if (!ok) {
+      pop_back();
+      return false;
+    }
+  }
+
+  /* The kernel sends both, the legacy struct only for old userspace */
+  if (compat && !stats2) {
+    struct tc_stats st = {};
+    unsigned int len = ynl_attr_data_len(compat);
+
+    if (len < offsetof(struct tc_stats, backlog) + sizeof(st.backlog)) {
+      pop_back();
+      return false;
+    }
+    memcpy(&st, ynl_attr_data(compat), std::min<size_t>(len, sizeof(st)));
+    bytes[i] = st.bytes;
+    packets[i] = st.packets;
+    drops[i] = st.drops;
+    overlimits[i] = st.overlimits;
+    bps[i] = st.bps;
+    pps[i] = st.pps;
+    qlen[i] = st.qlen;
+    backlog[i] = st.backlog;
+  }
+
+  /* A re-dumped object overwrites its older row */
+  auto old = index_.find(key(i), [this](size_t r) { return key(r); });
+  if (old) {
+    move_row(*old, i);
+    pop_back();
+    return true;
+  }
+  index_.add(size(), msg_type.capacity(), [this](size_t r) { return key(r); });
+  return true;
+}
+
+result<void> tc_stats_table::dump(ynl_socket& ys, bool classes) {
+  tc_getqdisc_req_dump qreq;
+  tc_gettclass_req_dump creq;
+  std::vector<__u32> devs;
+
+  auto qtmpl = tc_getqdisc_dump_prepare(ys, qreq);
+  if (!qtmpl) {
+    return std::unexpected(qtmpl.error());
+  }
+
+  clear();
+  auto ret = dump_raw(
+      ys,
+      ynl_msg_reuse(ys, qtmpl->nlh()),
+      RTM_NEWQDISC,
+      [this](const struct nlmsghdr* nlh) { return add(nlh); });
+  if (!ret || !classes) {
+    return ret;
+  }
+
+  auto ctmpl = tc_gettclass_dump_prepare(ys, creq);
+  if (!ctmpl) {
+    return std::unexpected(ctmpl.error());
+  }
+
+  devs.assign(ifindex.begin(), ifindex.end());
+  std::sort(devs.begin(), devs.end());
+  devs.erase(std::unique(devs.begin(), devs.end()), devs.end());
+
+  for (__u32 dev : devs) {
+    auto* tcm = (struct tcmsg*)ynl_nlmsg_data(ctmpl->nlh());
+
+    tcm->ifindex = dev;
+    ret = dump_raw(
+        ys,
+        ynl_msg_reuse(ys, ctmpl->nlh()),
+        RTM_NEWTCLASS,
+        [this](const struct nlmsghdr* nlh) { return add(nlh); });
+    if (!ret) {
+      return ret;
+    }
+  }
+
+  return {};
+}
+
+} // namespace ynl_cpp
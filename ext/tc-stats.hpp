@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_TC_STATS_H
+#define __YNL_CPP_TC_STATS_H 1
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include "tc-user.hpp"
+#include "ynl-row-index.hpp"
+
+namespace ynl_cpp {
+
+struct tc_stats_key {
+  __u16 type;
+  __u32 ifindex;
+  __u32 handle;
+  __u32 parent;
+
+  bool operator==(const tc_stats_key&) const = default;
+};
+
+struct tc_stats_key_hash {
+  size_t operator()(const tc_stats_key& key) const;
+};
+
+/**
+ * class tc_stats_table - columnar snapshot of qdisc and class counters
+ *
+ * Decodes RTM_NEWQDISC / RTM_NEWTCLASS messages straight into one array
+ * per counter, looking only at the kind and the statistics: the
+ * TCA_STATS2 nest (basic, basic-hw, pkt64, queue, rate-est, rate-est64),
+ * or the legacy TCA_STATS struct if a message has no TCA_STATS2. Options
+ * and xstats are skipped without being validated or copied.
+ *
+ * Object i is described by entry i of each column. Objects are indexed by
+ * (msg_type, ifindex, handle, parent), so a counter can be found with
+ * find() without scanning. Handles alone don't tell objects apart: the
+ * children mq and mqprio create per queue all have handle 0: and differ
+ * only in their parent. The message type keeps qdiscs and classes apart.
+ *
+ * A re-dumped object overwrites its row. Objects a re-dump no longer
+ * reports stay until begin() drops the rows of their device.
+ */
+class tc_stats_table {
+ public:
+  size_t size() const {
+    return msg_type.size();
+  }
+
+  /* Preallocate room for @objs qdiscs and classes */
+  void reserve(size_t objs);
+
+  /* Forget all objects, memory is kept for the next snapshot */
+  void clear();
+
+  /* Rows of device @ifindex are replaced by what is added next */
+  void begin(__u32 ifindex);
+
+  /* Decode one RTM_NEWQDISC or RTM_NEWTCLASS message, false if malformed */
+  bool add(const struct nlmsghdr* nlh);
+
+  /* Row of the object, @type is RTM_NEWQDISC or RTM_NEWTCLASS */
+  std::optional<size_t>
+  find(__u16 type, __u32 ifindex, __u32 handle, __u32 parent) const;
+
+  /*
+   * Replace the contents with the qdiscs of all devices, followed by their
+   * classes if @classes is set. The kernel only dumps classes one device
+   * at a time, so this runs one class dump per device which has qdiscs,
+   * reusing a single request buffer.
+   */
+  result<void> dump(ynl_socket& ys, bool classes = true);
+
+  /* RTM_NEWQDISC or RTM_NEWTCLASS */
+  std::vector<__u16> msg_type;
+  /* index into kinds */
+  std::vector<__u16> kind;
+
+  /* tcmsg fields */
+  std::vector<__u32> ifindex;
+  std::vector<__u32> handle;
+  std::vector<__u32> parent;
+
+  /* basic, with packets from pkt64 when present */
+  std::vector<__u64> bytes;
+  std::vector<__u64> packets;
+  /* basic-hw, the offloaded part of bytes / packets */
+  std::vector<__u64> hw_bytes;
+  std::vector<__u64> hw_packets;
+
+  /* queue */
+  std::vector<__u32> qlen;
+  std::vector<__u32> backlog;
+  std::vector<__u32> drops;
+  std::vector<__u32> requeues;
+  std::vector<__u32> overlimits;
+
+  /* rate-est64, or rate-est */
+  std::vector<__u64> bps;
+  std::vector<__u64> pps;
+
+  /* Distinct kinds seen so far, kept across clear(); 0 is "no kind" */
+  std::vector<std::string> kinds{""};
+
+ private:
+  void pop_back();
+  void move_row(size_t to, size_t from);
+  bool put_kind(size_t i, const struct nlattr* attr);
+  bool put_stats2(size_t i, const struct nlattr* nest);
+  tc_stats_key key(size_t i) const {
+    return {msg_type[i], ifindex[i], handle[i], parent[i]};
+  }
+
+  row_index<tc_stats_key, tc_stats_key_hash> index_;
+};
+
+} // namespace ynl_cpp
+
+#endif
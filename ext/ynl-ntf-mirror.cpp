@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "ynl-ntf-mirror.hpp"
+
+#include <sys/socket.h>
+
+namespace ynl_cpp {
+
+result<void> ntf_mirror::open(
+    const struct ynl_family& family,
+    const char* group,
+    int rcvbuf) {
+  struct ynl_error yerr;
+
+  ntf_ys_ = std::make_unique<ynl_socket>(family, &yerr);
+  if (!*ntf_ys_) {
+    return std::unexpected(error(yerr));
+  }
+  dump_ys_ = std::make_unique<ynl_socket>(family, &yerr);
+  if (!*dump_ys_) {
+    return std::unexpected(error(yerr));
+  }
+
+  if (rcvbuf) {
+    setsockopt(fd(), SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  }
+  if (ynl_subscribe(*ntf_ys_, group) < 0) {
+    return std::unexpected(error(*ntf_ys_));
+  }
+  return {};
+}
+
+int ntf_mirror::fd() {
+  return ynl_socket_get_fd(*ntf_ys_);
+}
+
+/* Discard the queued notifications and read the socket empty, unparsed */
+result<void> ntf_mirror::drain() {
+  struct ynl_sock* ys = *ntf_ys_;
+  struct ynl_ntf_base_type* ntf;
+
+  while ((ntf = ynl_ntf_dequeue(ys))) {
+    ynl_ntf_free(ntf);
+  }
+  /* Overflowing again while draining only means there is more to drop */
+  while (ynl_ntf_check_raw(
+             ys,
+             [](const struct nlmsghdr*, struct ynl_parse_arg*) -> int {
+               return YNL_PARSE_CB_OK;
+             },
+             nullptr) < 0) {
+    if (ys->err.code != ENOBUFS) {
+      return std::unexpected(error(ys));
+    }
+  }
+  return {};
+}
+
+} // namespace ynl_cpp
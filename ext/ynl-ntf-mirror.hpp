@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_YNL_NTF_MIRROR_H
+#define __YNL_CPP_YNL_NTF_MIRROR_H 1
+
+#include <errno.h>
+
+#include <memory>
+
+#include <ynl.hpp>
+
+namespace ynl_cpp {
+
+/**
+ * class ntf_mirror - sockets of state loaded by a dump, then followed by
+ * notifications
+ *
+ * open() subscribes the notification socket before the owner loads its
+ * state, so that no change falls in between. Dumps go through a second
+ * socket, so they don't queue up behind notifications.
+ *
+ * If the notification socket overflows (ENOBUFS) some notifications were
+ * lost and only a dump can tell which. Everything still queued, in the
+ * library and in the socket, predates that dump and would undo newer state
+ * if applied after it, so poll() throws it all away before the resync.
+ *
+ * Not thread safe.
+ */
+class ntf_mirror {
+ public:
+  /* @rcvbuf, if set, is a best effort to make overflows less likely */
+  result<void>
+  open(const struct ynl_family& family, const char* group, int rcvbuf = 0);
+
+  /* Notification socket fd, for poll() / epoll integration */
+  int fd();
+  ynl_socket& dump_socket() {
+    return *dump_ys_;
+  }
+
+  /*
+   * Hand the pending notifications to @apply without blocking, as
+   * bool apply(struct ynl_ntf_base_type *), which returns whether to count
+   * it. After an overflow calls result<void> resync() instead. Returns the
+   * number of notifications counted.
+   */
+  template <typename A, typename R>
+  result<size_t> poll(A&& apply, R&& resync) {
+    struct ynl_sock* ys = *ntf_ys_;
+    struct ynl_ntf_base_type* ntf;
+    size_t n = 0;
+
+    if (ynl_ntf_check(ys) < 0) {
+      if (ys->err.code != ENOBUFS) {
+        return std::unexpected(error(ys));
+      }
+      auto ret = drain();
+      if (!ret) {
+        return std::unexpected(ret.error());
+      }
+      ret = resync();
+      if (!ret) {
+        return std::unexpected(ret.error());
+      }
+      return n;
+    }
+
+    while ((ntf = ynl_ntf_dequeue(ys))) {
+      if (apply(ntf)) {
+        n++;
+      }
+      ynl_ntf_free(ntf);
+    }
+    return n;
+  }
+
+ private:
+  result<void> drain();
+
+  std::unique_ptr<ynl_socket> ntf_ys_;
+  std::unique_ptr<ynl_socket> dump_ys_;
+};
+
+} // namespace ynl_cpp
+
+#endif
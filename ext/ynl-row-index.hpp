@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_YNL_ROW_INDEX_H
+#define __YNL_CPP_YNL_ROW_INDEX_H 1
+
+#include <linux/types.h>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace ynl_cpp {
+
+/**
+ * class row_index - hash index over the rows of a columnar table
+ *
+ * Open addressing with linear probing, each slot holds row + 1, 0 when
+ * empty. The keys stay in the table's columns: calls which need to look
+ * at a row take a key_of callable, Key key_of(size_t row). @Hash maps a
+ * Key to the start of its probe sequence, Key needs operator==.
+ *
+ * Sized to at least twice the rows (or the capacity reserved for them),
+ * a row indexed again under the same key replaces the older one.
+ */
+template <typename Key, typename Hash>
+class row_index {
+ public:
+  explicit row_index(size_t min_slots = 1024) : min_slots_(min_slots) {}
+
+  template <typename KeyOf>
+  std::optional<size_t> find(const Key& key, KeyOf&& key_of) const {
+    size_t mask;
+
+    if (slots_.empty()) {
+      return std::nullopt;
+    }
+    mask = slots_.size() - 1;
+    for (size_t i = Hash{}(key);; i++) {
+      __u32 row = slots_[i & mask];
+
+      if (!row) {
+        return std::nullopt;
+      }
+      if (key_of(row - 1) == key) {
+        return row - 1;
+      }
+    }
+  }
+
+  /* Index the last of @rows rows, which was just added */
+  template <typename KeyOf>
+  void add(size_t rows, size_t capacity, KeyOf&& key_of) {
+    if (rows * 2 > slots_.size()) {
+      rebuild(rows, capacity, key_of);
+    } else {
+      put(rows - 1, key_of);
+    }
+  }
+
+  /* Make room for @capacity rows, the first @rows of which are indexed */
+  template <typename KeyOf>
+  void reserve(size_t rows, size_t capacity, KeyOf&& key_of) {
+    if (capacity * 2 > slots_.size()) {
+      rebuild(rows, capacity, key_of);
+    }
+  }
+
+  /* Start over with room for @capacity rows and index the first @rows */
+  template <typename KeyOf>
+  void rebuild(size_t rows, size_t capacity, KeyOf&& key_of) {
+    size_t n = std::max(slots_.size(), min_slots_);
+
+    while (n < std::max(rows, capacity) * 2) {
+      n *= 2;
+    }
+    slots_.assign(n, 0);
+    for (size_t i = 0; i < rows; i++) {
+      put(i, key_of);
+    }
+  }
+
+  /* Forget all rows, the slots are kept */
+  void clear() {
+    std::fill(slots_.begin(), slots_.end(), 0);
+  }
+
+ private:
+  template <typename KeyOf>
+  void put(size_t i, KeyOf&& key_of) {
+    size_t mask = slots_.size() - 1;
+    Key key = key_of(i);
+
+    for (size_t s = Hash{}(key);; s++) {
+      __u32& row = slots_[s & mask];
+
+      if (!row || key_of(row - 1) == key) {
+        row = i + 1;
+        return;
+      }
+    }
+  }
+
+  size_t min_slots_;
+  std::vector<__u32> slots_;
+};
+
+} // namespace ynl_cpp
+
+#endif
@@ -1017,24 +1017,24 @@ int devlink_dl_dpipe_match_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_DPIPE_MATCH_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_match_type = (devlink_dpipe_match_type)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_HEADER_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_header_id = (devlink_dpipe_header_id)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_HEADER_GLOBAL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->dpipe_header_global = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_HEADER_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_header_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_FIELD_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_field_id = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1062,20 +1062,16 @@ int devlink_dl_dpipe_match_value_parse(struct ynl_parse_arg *yarg,
 		if (type == DEVLINK_ATTR_DPIPE_MATCH) {
 			n_dpipe_match++;
 		} else if (type == DEVLINK_ATTR_DPIPE_VALUE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->dpipe_value.assign(data, data + len);
 		} else if (type == DEVLINK_ATTR_DPIPE_VALUE_MASK) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->dpipe_value_mask.assign(data, data + len);
 		} else if (type == DEVLINK_ATTR_DPIPE_VALUE_MAPPING) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_value_mapping = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1107,24 +1103,24 @@ int devlink_dl_dpipe_action_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_DPIPE_ACTION_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_action_type = (devlink_dpipe_action_type)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_HEADER_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_header_id = (devlink_dpipe_header_id)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_HEADER_GLOBAL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->dpipe_header_global = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_HEADER_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_header_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_FIELD_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_field_id = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1152,20 +1148,16 @@ int devlink_dl_dpipe_action_value_parse(struct ynl_parse_arg *yarg,
 		if (type == DEVLINK_ATTR_DPIPE_ACTION) {
 			n_dpipe_action++;
 		} else if (type == DEVLINK_ATTR_DPIPE_VALUE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->dpipe_value.assign(data, data + len);
 		} else if (type == DEVLINK_ATTR_DPIPE_VALUE_MASK) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->dpipe_value_mask.assign(data, data + len);
 		} else if (type == DEVLINK_ATTR_DPIPE_VALUE_MAPPING) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_value_mapping = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1197,20 +1189,20 @@ int devlink_dl_dpipe_field_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_DPIPE_FIELD_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dpipe_field_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dpipe_field_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DPIPE_FIELD_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_field_id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_FIELD_BITWIDTH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_field_bitwidth = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_FIELD_MAPPING_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_field_mapping_type = (devlink_dpipe_field_mapping_type)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1228,44 +1220,44 @@ int devlink_dl_resource_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_RESOURCE_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->resource_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->resource_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_RESOURCE_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->resource_id = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DEVLINK_ATTR_RESOURCE_SIZE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->resource_size = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DEVLINK_ATTR_RESOURCE_SIZE_NEW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->resource_size_new = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DEVLINK_ATTR_RESOURCE_SIZE_VALID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->resource_size_valid = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == DEVLINK_ATTR_RESOURCE_SIZE_MIN) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->resource_size_min = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DEVLINK_ATTR_RESOURCE_SIZE_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->resource_size_max = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DEVLINK_ATTR_RESOURCE_SIZE_GRAN) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->resource_size_gran = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DEVLINK_ATTR_RESOURCE_UNIT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->resource_unit = (devlink_resource_unit)ynl_attr_get_u8(attr);
 		} else if (type == DEVLINK_ATTR_RESOURCE_OCC) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->resource_occ = (__u64)ynl_attr_get_u64(attr);
 		}
 	}
@@ -1283,13 +1275,13 @@ int devlink_dl_info_version_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_INFO_VERSION_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->info_version_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->info_version_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_INFO_VERSION_VALUE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->info_version_value.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->info_version_value.assign(ynl_attr_get_str(attr));
 		}
 	}
 
@@ -1306,21 +1298,17 @@ int devlink_dl_fmsg_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_FMSG_OBJ_NEST_START) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->fmsg_obj_nest_start = true;
 		} else if (type == DEVLINK_ATTR_FMSG_PAIR_NEST_START) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->fmsg_pair_nest_start = true;
 		} else if (type == DEVLINK_ATTR_FMSG_ARR_NEST_START) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->fmsg_arr_nest_start = true;
 		} else if (type == DEVLINK_ATTR_FMSG_NEST_END) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->fmsg_nest_end = true;
 		} else if (type == DEVLINK_ATTR_FMSG_OBJ_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->fmsg_obj_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->fmsg_obj_name.assign(ynl_attr_get_str(attr));
 		}
 	}
 
@@ -1340,7 +1328,7 @@ int devlink_dl_port_function_put(struct nlmsghdr *nlh, unsigned int attr_type,
 	if (obj.opstate.has_value())
 		ynl_attr_put_u8(nlh, DEVLINK_PORT_FN_ATTR_OPSTATE, obj.opstate.value());
 	if (obj.caps.has_value())
-		ynl_attr_put(nlh, DEVLINK_PORT_FN_ATTR_CAPS, &obj->caps, sizeof(struct nla_bitfield32));
+		ynl_attr_put(nlh, DEVLINK_PORT_FN_ATTR_CAPS, &(*obj.caps), sizeof(struct nla_bitfield32));
 	ynl_attr_nest_end(nlh, nest);
 
 	return 0;
@@ -1356,12 +1344,12 @@ int devlink_dl_reload_stats_entry_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_RELOAD_STATS_LIMIT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->reload_stats_limit = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == DEVLINK_ATTR_RELOAD_STATS_VALUE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->reload_stats_value = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1673,8 +1661,8 @@ int devlink_dl_reload_act_info_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_RELOAD_ACTION) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->reload_action = (devlink_reload_action)ynl_attr_get_u8(attr);
 		} else if (type == DEVLINK_ATTR_RELOAD_ACTION_STATS) {
 			n_reload_action_stats++;
@@ -1711,40 +1699,40 @@ int devlink_dl_dpipe_table_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_DPIPE_TABLE_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dpipe_table_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dpipe_table_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DPIPE_TABLE_SIZE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->dpipe_table_size = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_TABLE_MATCHES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_dpipe_table_matches_nest;
-			parg.data = &dst->dpipe_table_matches;
+			parg.data = &dst->dpipe_table_matches.emplace();
 			if (devlink_dl_dpipe_table_matches_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == DEVLINK_ATTR_DPIPE_TABLE_ACTIONS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_dpipe_table_actions_nest;
-			parg.data = &dst->dpipe_table_actions;
+			parg.data = &dst->dpipe_table_actions.emplace();
 			if (devlink_dl_dpipe_table_actions_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == DEVLINK_ATTR_DPIPE_TABLE_COUNTERS_ENABLED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->dpipe_table_counters_enabled = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_TABLE_RESOURCE_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->dpipe_table_resource_id = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_TABLE_RESOURCE_UNITS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->dpipe_table_resource_units = (__u64)ynl_attr_get_u64(attr);
 		}
 	}
@@ -1765,28 +1753,28 @@ int devlink_dl_dpipe_entry_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_DPIPE_ENTRY_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->dpipe_entry_index = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_ENTRY_MATCH_VALUES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_dpipe_entry_match_values_nest;
-			parg.data = &dst->dpipe_entry_match_values;
+			parg.data = &dst->dpipe_entry_match_values.emplace();
 			if (devlink_dl_dpipe_entry_match_values_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == DEVLINK_ATTR_DPIPE_ENTRY_ACTION_VALUES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_dpipe_entry_action_values_nest;
-			parg.data = &dst->dpipe_entry_action_values;
+			parg.data = &dst->dpipe_entry_action_values.emplace();
 			if (devlink_dl_dpipe_entry_action_values_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == DEVLINK_ATTR_DPIPE_ENTRY_COUNTER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->dpipe_entry_counter = (__u64)ynl_attr_get_u64(attr);
 		}
 	}
@@ -1807,23 +1795,23 @@ int devlink_dl_dpipe_header_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_DPIPE_HEADER_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dpipe_header_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dpipe_header_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DPIPE_HEADER_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dpipe_header_id = (devlink_dpipe_header_id)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_HEADER_GLOBAL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->dpipe_header_global = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == DEVLINK_ATTR_DPIPE_HEADER_FIELDS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_dpipe_header_fields_nest;
-			parg.data = &dst->dpipe_header_fields;
+			parg.data = &dst->dpipe_header_fields.emplace();
 			if (devlink_dl_dpipe_header_fields_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -2001,19 +1989,19 @@ int devlink_dl_dev_stats_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DEVLINK_ATTR_RELOAD_STATS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_reload_stats_nest;
-			parg.data = &dst->reload_stats;
+			parg.data = &dst->reload_stats.emplace();
 			if (devlink_dl_reload_stats_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == DEVLINK_ATTR_REMOTE_RELOAD_STATS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_reload_stats_nest;
-			parg.data = &dst->remote_reload_stats;
+			parg.data = &dst->remote_reload_stats.emplace();
 			if (devlink_dl_reload_stats_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -2037,24 +2025,27 @@ int devlink_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_RELOAD_FAILED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->reload_failed = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == DEVLINK_ATTR_DEV_STATS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_dev_stats_nest;
-			parg.data = &dst->dev_stats;
+			parg.data = &dst->dev_stats.emplace();
 			if (devlink_dl_dev_stats_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -2063,59 +2054,128 @@ int devlink_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_get_rsp>
-devlink_get(ynl_cpp::ynl_socket&  ys, devlink_get_req& req)
+static void devlink_get_put(struct nlmsghdr *nlh, devlink_get_req& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_get_rsp>>
+devlink_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		 const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	rsp.reset(new devlink_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_get_rsp_parse;
 	yrs.rsp_cmd = 3;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_get_rsp>>
+devlink_get_ex(ynl_cpp::ynl_socket&  ys, devlink_get_req& req,
+	       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_GET, 1);
+	devlink_get_put(nlh, req);
+
+	return devlink_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_get_rsp>
+devlink_get(ynl_cpp::ynl_socket&  ys, devlink_get_req& req)
+{
+	auto ret = devlink_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_GET, 1);
+	devlink_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_get_rsp>>
+devlink_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	       const ynl_cpp::projection *proj)
+{
+	return devlink_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_get_rsp>
+devlink_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_GET - dump */
-std::unique_ptr<devlink_get_list> devlink_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<devlink_get_list>>
+devlink_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_get_rsp_parse;
 	yds.rsp_cmd = 3;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_get_list>>
+devlink_get_dump_ex(ynl_cpp::ynl_socket&  ys, const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_GET, 1);
+
+	return devlink_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_get_list> devlink_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = devlink_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_PORT_GET ============== */
 /* DEVLINK_CMD_PORT_GET - do */
 int devlink_port_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -2129,17 +2189,20 @@ int devlink_port_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->port_index = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -2147,150 +2210,288 @@ int devlink_port_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_port_get_rsp>
-devlink_port_get(ynl_cpp::ynl_socket&  ys, devlink_port_get_req& req)
+static void
+devlink_port_get_put(struct nlmsghdr *nlh, devlink_port_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_port_get_rsp>>
+devlink_port_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_port_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
-
 	rsp.reset(new devlink_port_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_port_get_rsp_parse;
 	yrs.rsp_cmd = 7;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* DEVLINK_CMD_PORT_GET - dump */
-int devlink_port_get_rsp_dump_parse(const struct nlmsghdr *nlh,
-				    struct ynl_parse_arg *yarg)
+ynl_cpp::result<std::unique_ptr<devlink_port_get_rsp>>
+devlink_port_get_ex(ynl_cpp::ynl_socket&  ys, devlink_port_get_req& req,
+		    const ynl_cpp::projection *proj)
 {
-	devlink_port_get_rsp_dump *dst;
-	const struct nlattr *attr;
+	struct nlmsghdr *nlh;
 
-	dst = (devlink_port_get_rsp_dump*)yarg->data;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_GET, 1);
+	devlink_port_get_put(nlh, req);
 
-	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
-		unsigned int type = ynl_attr_type(attr);
+	return devlink_port_get_exec(ys, nlh, proj);
+}
 
-		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
-		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
-		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->port_index = (__u32)ynl_attr_get_u32(attr);
-		}
-	}
+std::unique_ptr<devlink_port_get_rsp>
+devlink_port_get(ynl_cpp::ynl_socket&  ys, devlink_port_get_req& req)
+{
+	auto ret = devlink_port_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
 
-	return YNL_PARSE_CB_OK;
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_port_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_GET, 1);
+	devlink_port_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
 }
 
-std::unique_ptr<devlink_port_get_rsp_list>
-devlink_port_get_dump(ynl_cpp::ynl_socket&  ys, devlink_port_get_req_dump& req)
+ynl_cpp::result<std::unique_ptr<devlink_port_get_rsp>>
+devlink_port_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return devlink_port_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_port_get_rsp>
+devlink_port_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_port_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* DEVLINK_CMD_PORT_GET - dump */
+static void
+devlink_port_get_dump_put(struct nlmsghdr *nlh, devlink_port_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_port_get_list>>
+devlink_port_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
-	auto ret = std::make_unique<devlink_port_get_rsp_list>();
+	auto ret = std::make_unique<devlink_port_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
-	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_port_get_rsp_list*>(arg)->objs.emplace_back());};
-	yds.cb = devlink_port_get_rsp_dump_parse;
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_port_get_list*>(arg)->objs.emplace_back());};
+	yds.cb = devlink_port_get_rsp_parse;
 	yds.rsp_cmd = 7;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ============== DEVLINK_CMD_PORT_SET ============== */
-/* DEVLINK_CMD_PORT_SET - do */
-int devlink_port_set(ynl_cpp::ynl_socket&  ys, devlink_port_set_req& req)
+ynl_cpp::result<std::unique_ptr<devlink_port_get_list>>
+devlink_port_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_port_get_req_dump& req,
+			 const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_GET, 1);
+	devlink_port_get_dump_put(nlh, req);
+
+	return devlink_port_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_port_get_list>
+devlink_port_get_dump(ynl_cpp::ynl_socket&  ys, devlink_port_get_req_dump& req)
+{
+	auto ret = devlink_port_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_port_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_GET, 1);
+	devlink_port_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
 
+ynl_cpp::result<std::unique_ptr<devlink_port_get_list>>
+devlink_port_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return devlink_port_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_port_get_list>
+devlink_port_get_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_port_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_PORT_SET ============== */
+/* DEVLINK_CMD_PORT_SET - do */
+static void
+devlink_port_set_put(struct nlmsghdr *nlh, devlink_port_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.port_type.has_value())
+		ynl_attr_put_u16_unchecked(nlh, DEVLINK_ATTR_PORT_TYPE, req.port_type.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
-	if (req.port_type.has_value())
-		ynl_attr_put_u16(nlh, DEVLINK_ATTR_PORT_TYPE, req.port_type.value());
 	if (req.port_function.has_value())
 		devlink_dl_port_function_put(nlh, DEVLINK_ATTR_PORT_FUNCTION, req.port_function.value());
+}
+
+static ynl_cpp::result<void>
+devlink_port_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
 }
 
-/* ============== DEVLINK_CMD_PORT_NEW ============== */
-/* DEVLINK_CMD_PORT_NEW - do */
-int devlink_port_new_rsp_parse(const struct nlmsghdr *nlh,
-			       struct ynl_parse_arg *yarg)
+ynl_cpp::result<void>
+devlink_port_set_ex(ynl_cpp::ynl_socket&  ys, devlink_port_set_req& req)
 {
-	devlink_port_new_rsp *dst;
-	const struct nlattr *attr;
+	struct nlmsghdr *nlh;
 
-	dst = (devlink_port_new_rsp*)yarg->data;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_SET, 1);
+	devlink_port_set_put(nlh, req);
+
+	return devlink_port_set_exec(ys, nlh);
+}
+
+int devlink_port_set(ynl_cpp::ynl_socket&  ys, devlink_port_set_req& req)
+{
+	auto ret = devlink_port_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_set_prepare(ynl_cpp::ynl_socket&  ys, devlink_port_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_SET, 1);
+	devlink_port_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_port_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return devlink_port_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_port_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_port_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_port_set_batch(ynl_cpp::msg_batch& batch, devlink_port_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_PORT_SET, 1);
+	devlink_port_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_PORT_NEW ============== */
+/* DEVLINK_CMD_PORT_NEW - do */
+int devlink_port_new_rsp_parse(const struct nlmsghdr *nlh,
+			       struct ynl_parse_arg *yarg)
+{
+	devlink_port_new_rsp *dst;
+	const struct nlattr *attr;
+
+	dst = (devlink_port_new_rsp*)yarg->data;
 
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->port_index = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -2298,121 +2499,349 @@ int devlink_port_new_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_port_new_rsp>
-devlink_port_new(ynl_cpp::ynl_socket&  ys, devlink_port_new_req& req)
+static void
+devlink_port_new_put(struct nlmsghdr *nlh, devlink_port_new_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_port_new_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_NEW, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 40 <= YNL_SOCKET_BUFFER_SIZE);
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.port_flavour.has_value())
-		ynl_attr_put_u16(nlh, DEVLINK_ATTR_PORT_FLAVOUR, req.port_flavour.value());
+		ynl_attr_put_u16_unchecked(nlh, DEVLINK_ATTR_PORT_FLAVOUR, req.port_flavour.value());
 	if (req.port_pci_pf_number.has_value())
-		ynl_attr_put_u16(nlh, DEVLINK_ATTR_PORT_PCI_PF_NUMBER, req.port_pci_pf_number.value());
+		ynl_attr_put_u16_unchecked(nlh, DEVLINK_ATTR_PORT_PCI_PF_NUMBER, req.port_pci_pf_number.value());
 	if (req.port_pci_sf_number.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_PCI_SF_NUMBER, req.port_pci_sf_number.value());
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_PCI_SF_NUMBER, req.port_pci_sf_number.value());
 	if (req.port_controller_number.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_CONTROLLER_NUMBER, req.port_controller_number.value());
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_CONTROLLER_NUMBER, req.port_controller_number.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_port_new_rsp>>
+devlink_port_new_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_port_new_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
 
 	rsp.reset(new devlink_port_new_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_port_new_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_PORT_NEW;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_port_new_rsp>>
+devlink_port_new_ex(ynl_cpp::ynl_socket&  ys, devlink_port_new_req& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_NEW, 1);
+	devlink_port_new_put(nlh, req);
+
+	return devlink_port_new_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_port_new_rsp>
+devlink_port_new(ynl_cpp::ynl_socket&  ys, devlink_port_new_req& req)
+{
+	auto ret = devlink_port_new_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_new_prepare(ynl_cpp::ynl_socket&  ys, devlink_port_new_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_NEW, 1);
+	devlink_port_new_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_port_new_rsp>>
+devlink_port_new_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return devlink_port_new_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_port_new_rsp>
+devlink_port_new(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_port_new_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_PORT_DEL ============== */
 /* DEVLINK_CMD_PORT_DEL - do */
-int devlink_port_del(ynl_cpp::ynl_socket&  ys, devlink_port_del_req& req)
+static void
+devlink_port_del_put(struct nlmsghdr *nlh, devlink_port_del_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<void>
+devlink_port_del_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_DEL, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_port_del_ex(ynl_cpp::ynl_socket&  ys, devlink_port_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_DEL, 1);
+	devlink_port_del_put(nlh, req);
+
+	return devlink_port_del_exec(ys, nlh);
+}
+
+int devlink_port_del(ynl_cpp::ynl_socket&  ys, devlink_port_del_req& req)
+{
+	auto ret = devlink_port_del_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_del_prepare(ynl_cpp::ynl_socket&  ys, devlink_port_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_DEL, 1);
+	devlink_port_del_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_port_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return devlink_port_del_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_port_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_port_del_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_port_del_batch(ynl_cpp::msg_batch& batch, devlink_port_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_PORT_DEL, 1);
+	devlink_port_del_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_PORT_SPLIT ============== */
+/* DEVLINK_CMD_PORT_SPLIT - do */
+static void
+devlink_port_split_put(struct nlmsghdr *nlh, devlink_port_split_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.port_split_count.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_SPLIT_COUNT, req.port_split_count.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+}
+
+static ynl_cpp::result<void>
+devlink_port_split_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_port_split_ex(ynl_cpp::ynl_socket&  ys, devlink_port_split_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_SPLIT, 1);
+	devlink_port_split_put(nlh, req);
+
+	return devlink_port_split_exec(ys, nlh);
 }
 
-/* ============== DEVLINK_CMD_PORT_SPLIT ============== */
-/* DEVLINK_CMD_PORT_SPLIT - do */
 int devlink_port_split(ynl_cpp::ynl_socket&  ys, devlink_port_split_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	auto ret = devlink_port_split_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_split_prepare(ynl_cpp::ynl_socket&  ys,
+			   devlink_port_split_req& req)
+{
 	struct nlmsghdr *nlh;
-	int err;
 
 	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_SPLIT, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	devlink_port_split_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_port_split_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	return devlink_port_split_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_port_split(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_port_split_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_port_split_batch(ynl_cpp::msg_batch& batch,
+			 devlink_port_split_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_PORT_SPLIT, 1);
+	devlink_port_split_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_PORT_UNSPLIT ============== */
+/* DEVLINK_CMD_PORT_UNSPLIT - do */
+static void
+devlink_port_unsplit_put(struct nlmsghdr *nlh, devlink_port_unsplit_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
-	if (req.port_split_count.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_SPLIT_COUNT, req.port_split_count.value());
+}
+
+static ynl_cpp::result<void>
+devlink_port_unsplit_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_port_unsplit_ex(ynl_cpp::ynl_socket&  ys,
+			devlink_port_unsplit_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_UNSPLIT, 1);
+	devlink_port_unsplit_put(nlh, req);
+
+	return devlink_port_unsplit_exec(ys, nlh);
 }
 
-/* ============== DEVLINK_CMD_PORT_UNSPLIT ============== */
-/* DEVLINK_CMD_PORT_UNSPLIT - do */
 int devlink_port_unsplit(ynl_cpp::ynl_socket&  ys,
 			 devlink_port_unsplit_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	auto ret = devlink_port_unsplit_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_unsplit_prepare(ynl_cpp::ynl_socket&  ys,
+			     devlink_port_unsplit_req& req)
+{
 	struct nlmsghdr *nlh;
-	int err;
 
 	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_UNSPLIT, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	devlink_port_unsplit_put(nlh, req);
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
 
-	err = ynl_exec(ys, nlh, &yrs);
-	if (err < 0)
-		return -1;
+ynl_cpp::result<void>
+devlink_port_unsplit_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	return devlink_port_unsplit_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
 
-	return 0;
+int devlink_port_unsplit(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_port_unsplit_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_port_unsplit_batch(ynl_cpp::msg_batch& batch,
+			   devlink_port_unsplit_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_PORT_UNSPLIT, 1);
+	devlink_port_unsplit_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_SB_GET ============== */
@@ -2428,17 +2857,20 @@ int devlink_sb_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_SB_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->sb_index = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -2446,68 +2878,174 @@ int devlink_sb_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_sb_get_rsp>
-devlink_sb_get(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req& req)
+static void devlink_sb_get_put(struct nlmsghdr *nlh, devlink_sb_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.sb_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_sb_get_rsp>>
+devlink_sb_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		    const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_sb_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.sb_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
-
 	rsp.reset(new devlink_sb_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_sb_get_rsp_parse;
 	yrs.rsp_cmd = 13;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* DEVLINK_CMD_SB_GET - dump */
-std::unique_ptr<devlink_sb_get_list>
-devlink_sb_get_dump(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req_dump& req)
+ynl_cpp::result<std::unique_ptr<devlink_sb_get_rsp>>
+devlink_sb_get_ex(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req& req,
+		  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_GET, 1);
+	devlink_sb_get_put(nlh, req);
+
+	return devlink_sb_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_sb_get_rsp>
+devlink_sb_get(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req& req)
+{
+	auto ret = devlink_sb_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req& req)
 {
-	struct ynl_dump_no_alloc_state yds = {};
 	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_GET, 1);
+	devlink_sb_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_sb_get_rsp>>
+devlink_sb_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj)
+{
+	return devlink_sb_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_sb_get_rsp>
+devlink_sb_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* DEVLINK_CMD_SB_GET - dump */
+static void
+devlink_sb_get_dump_put(struct nlmsghdr *nlh, devlink_sb_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_sb_get_list>>
+devlink_sb_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			 const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
 	int err;
 
 	auto ret = std::make_unique<devlink_sb_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_sb_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_sb_get_rsp_parse;
 	yds.rsp_cmd = 13;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_sb_get_list>>
+devlink_sb_get_dump_ex(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req_dump& req,
+		       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_GET, 1);
+	devlink_sb_get_dump_put(nlh, req);
+
+	return devlink_sb_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_sb_get_list>
+devlink_sb_get_dump(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req_dump& req)
+{
+	auto ret = devlink_sb_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_GET, 1);
+	devlink_sb_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_sb_get_list>>
+devlink_sb_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj)
+{
+	return devlink_sb_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_sb_get_list>
+devlink_sb_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_SB_POOL_GET ============== */
 /* DEVLINK_CMD_SB_POOL_GET - do */
 int devlink_sb_pool_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -2521,21 +3059,24 @@ int devlink_sb_pool_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_SB_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->sb_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_SB_POOL_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->sb_pool_index = (__u16)ynl_attr_get_u16(attr);
 		}
 	}
@@ -2543,100 +3084,271 @@ int devlink_sb_pool_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_sb_pool_get_rsp>
-devlink_sb_pool_get(ynl_cpp::ynl_socket&  ys, devlink_sb_pool_get_req& req)
+static void
+devlink_sb_pool_get_put(struct nlmsghdr *nlh, devlink_sb_pool_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.sb_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
+	if (req.sb_pool_index.has_value())
+		ynl_attr_put_u16_unchecked(nlh, DEVLINK_ATTR_SB_POOL_INDEX, req.sb_pool_index.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_sb_pool_get_rsp>>
+devlink_sb_pool_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			 const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_sb_pool_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_POOL_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.sb_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
-	if (req.sb_pool_index.has_value())
-		ynl_attr_put_u16(nlh, DEVLINK_ATTR_SB_POOL_INDEX, req.sb_pool_index.value());
-
 	rsp.reset(new devlink_sb_pool_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_sb_pool_get_rsp_parse;
 	yrs.rsp_cmd = 17;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_sb_pool_get_rsp>>
+devlink_sb_pool_get_ex(ynl_cpp::ynl_socket&  ys, devlink_sb_pool_get_req& req,
+		       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_POOL_GET, 1);
+	devlink_sb_pool_get_put(nlh, req);
+
+	return devlink_sb_pool_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_sb_pool_get_rsp>
+devlink_sb_pool_get(ynl_cpp::ynl_socket&  ys, devlink_sb_pool_get_req& req)
+{
+	auto ret = devlink_sb_pool_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_pool_get_prepare(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_pool_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_POOL_GET, 1);
+	devlink_sb_pool_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_sb_pool_get_rsp>>
+devlink_sb_pool_get_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj)
+{
+	return devlink_sb_pool_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_sb_pool_get_rsp>
+devlink_sb_pool_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_pool_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_SB_POOL_GET - dump */
-std::unique_ptr<devlink_sb_pool_get_list>
-devlink_sb_pool_get_dump(ynl_cpp::ynl_socket&  ys,
-			 devlink_sb_pool_get_req_dump& req)
+static void
+devlink_sb_pool_get_dump_put(struct nlmsghdr *nlh,
+			     devlink_sb_pool_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_sb_pool_get_list>>
+devlink_sb_pool_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			      const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_sb_pool_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_sb_pool_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_sb_pool_get_rsp_parse;
 	yds.rsp_cmd = 17;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_POOL_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ============== DEVLINK_CMD_SB_POOL_SET ============== */
-/* DEVLINK_CMD_SB_POOL_SET - do */
-int devlink_sb_pool_set(ynl_cpp::ynl_socket&  ys, devlink_sb_pool_set_req& req)
+ynl_cpp::result<std::unique_ptr<devlink_sb_pool_get_list>>
+devlink_sb_pool_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_pool_get_req_dump& req,
+			    const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_POOL_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_POOL_GET, 1);
+	devlink_sb_pool_get_dump_put(nlh, req);
+
+	return devlink_sb_pool_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_sb_pool_get_list>
+devlink_sb_pool_get_dump(ynl_cpp::ynl_socket&  ys,
+			 devlink_sb_pool_get_req_dump& req)
+{
+	auto ret = devlink_sb_pool_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_pool_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_sb_pool_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_POOL_GET, 1);
+	devlink_sb_pool_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_sb_pool_get_list>>
+devlink_sb_pool_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl,
+			    const ynl_cpp::projection *proj)
+{
+	return devlink_sb_pool_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_sb_pool_get_list>
+devlink_sb_pool_get_dump(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_pool_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_SB_POOL_SET ============== */
+/* DEVLINK_CMD_SB_POOL_SET - do */
+static void
+devlink_sb_pool_set_put(struct nlmsghdr *nlh, devlink_sb_pool_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 32 <= YNL_SOCKET_BUFFER_SIZE);
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.sb_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
 	if (req.sb_pool_index.has_value())
-		ynl_attr_put_u16(nlh, DEVLINK_ATTR_SB_POOL_INDEX, req.sb_pool_index.value());
+		ynl_attr_put_u16_unchecked(nlh, DEVLINK_ATTR_SB_POOL_INDEX, req.sb_pool_index.value());
 	if (req.sb_pool_threshold_type.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_SB_POOL_THRESHOLD_TYPE, req.sb_pool_threshold_type.value());
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_SB_POOL_THRESHOLD_TYPE, req.sb_pool_threshold_type.value());
 	if (req.sb_pool_size.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_POOL_SIZE, req.sb_pool_size.value());
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_POOL_SIZE, req.sb_pool_size.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<void>
+devlink_sb_pool_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_sb_pool_set_ex(ynl_cpp::ynl_socket&  ys, devlink_sb_pool_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_POOL_SET, 1);
+	devlink_sb_pool_set_put(nlh, req);
+
+	return devlink_sb_pool_set_exec(ys, nlh);
+}
+
+int devlink_sb_pool_set(ynl_cpp::ynl_socket&  ys, devlink_sb_pool_set_req& req)
+{
+	auto ret = devlink_sb_pool_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_pool_set_prepare(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_pool_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_POOL_SET, 1);
+	devlink_sb_pool_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_sb_pool_set_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	return devlink_sb_pool_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_sb_pool_set(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_pool_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_sb_pool_set_batch(ynl_cpp::msg_batch& batch,
+			  devlink_sb_pool_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_SB_POOL_SET, 1);
+	devlink_sb_pool_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_SB_PORT_POOL_GET ============== */
@@ -2652,25 +3364,28 @@ int devlink_sb_port_pool_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->port_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_SB_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->sb_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_SB_POOL_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->sb_pool_index = (__u16)ynl_attr_get_u16(attr);
 		}
 	}
@@ -2678,104 +3393,281 @@ int devlink_sb_port_pool_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_sb_port_pool_get_rsp>
-devlink_sb_port_pool_get(ynl_cpp::ynl_socket&  ys,
-			 devlink_sb_port_pool_get_req& req)
+static void
+devlink_sb_port_pool_get_put(struct nlmsghdr *nlh,
+			     devlink_sb_port_pool_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.sb_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
+	if (req.sb_pool_index.has_value())
+		ynl_attr_put_u16_unchecked(nlh, DEVLINK_ATTR_SB_POOL_INDEX, req.sb_pool_index.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_sb_port_pool_get_rsp>>
+devlink_sb_port_pool_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			      const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_sb_port_pool_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_PORT_POOL_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
-	if (req.sb_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
-	if (req.sb_pool_index.has_value())
-		ynl_attr_put_u16(nlh, DEVLINK_ATTR_SB_POOL_INDEX, req.sb_pool_index.value());
-
 	rsp.reset(new devlink_sb_port_pool_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_sb_port_pool_get_rsp_parse;
 	yrs.rsp_cmd = 21;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_sb_port_pool_get_rsp>>
+devlink_sb_port_pool_get_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_port_pool_get_req& req,
+			    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_PORT_POOL_GET, 1);
+	devlink_sb_port_pool_get_put(nlh, req);
+
+	return devlink_sb_port_pool_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_sb_port_pool_get_rsp>
+devlink_sb_port_pool_get(ynl_cpp::ynl_socket&  ys,
+			 devlink_sb_port_pool_get_req& req)
+{
+	auto ret = devlink_sb_port_pool_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_port_pool_get_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_sb_port_pool_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_PORT_POOL_GET, 1);
+	devlink_sb_port_pool_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_sb_port_pool_get_rsp>>
+devlink_sb_port_pool_get_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl,
+			    const ynl_cpp::projection *proj)
+{
+	return devlink_sb_port_pool_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_sb_port_pool_get_rsp>
+devlink_sb_port_pool_get(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_port_pool_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_SB_PORT_POOL_GET - dump */
-std::unique_ptr<devlink_sb_port_pool_get_list>
-devlink_sb_port_pool_get_dump(ynl_cpp::ynl_socket&  ys,
-			      devlink_sb_port_pool_get_req_dump& req)
+static void
+devlink_sb_port_pool_get_dump_put(struct nlmsghdr *nlh,
+				  devlink_sb_port_pool_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_sb_port_pool_get_list>>
+devlink_sb_port_pool_get_dump_exec(ynl_cpp::ynl_socket&  ys,
+				   struct nlmsghdr *nlh,
+				   const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_sb_port_pool_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_sb_port_pool_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_sb_port_pool_get_rsp_parse;
 	yds.rsp_cmd = 21;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_PORT_POOL_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_sb_port_pool_get_list>>
+devlink_sb_port_pool_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				 devlink_sb_port_pool_get_req_dump& req,
+				 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_PORT_POOL_GET, 1);
+	devlink_sb_port_pool_get_dump_put(nlh, req);
+
+	return devlink_sb_port_pool_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_sb_port_pool_get_list>
+devlink_sb_port_pool_get_dump(ynl_cpp::ynl_socket&  ys,
+			      devlink_sb_port_pool_get_req_dump& req)
+{
+	auto ret = devlink_sb_port_pool_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_port_pool_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				      devlink_sb_port_pool_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_PORT_POOL_GET, 1);
+	devlink_sb_port_pool_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_sb_port_pool_get_list>>
+devlink_sb_port_pool_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				 ynl_cpp::request_template& tmpl,
+				 const ynl_cpp::projection *proj)
+{
+	return devlink_sb_port_pool_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_sb_port_pool_get_list>
+devlink_sb_port_pool_get_dump(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_port_pool_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_SB_PORT_POOL_SET ============== */
 /* DEVLINK_CMD_SB_PORT_POOL_SET - do */
-int devlink_sb_port_pool_set(ynl_cpp::ynl_socket&  ys,
+static void
+devlink_sb_port_pool_set_put(struct nlmsghdr *nlh,
 			     devlink_sb_port_pool_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_PORT_POOL_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 32 <= YNL_SOCKET_BUFFER_SIZE);
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.sb_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
 	if (req.sb_pool_index.has_value())
-		ynl_attr_put_u16(nlh, DEVLINK_ATTR_SB_POOL_INDEX, req.sb_pool_index.value());
+		ynl_attr_put_u16_unchecked(nlh, DEVLINK_ATTR_SB_POOL_INDEX, req.sb_pool_index.value());
 	if (req.sb_threshold.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_THRESHOLD, req.sb_threshold.value());
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_THRESHOLD, req.sb_threshold.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<void>
+devlink_sb_port_pool_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_sb_port_pool_set_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_port_pool_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_PORT_POOL_SET, 1);
+	devlink_sb_port_pool_set_put(nlh, req);
+
+	return devlink_sb_port_pool_set_exec(ys, nlh);
+}
+
+int devlink_sb_port_pool_set(ynl_cpp::ynl_socket&  ys,
+			     devlink_sb_port_pool_set_req& req)
+{
+	auto ret = devlink_sb_port_pool_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_port_pool_set_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_sb_port_pool_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_PORT_POOL_SET, 1);
+	devlink_sb_port_pool_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_sb_port_pool_set_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl)
+{
+	return devlink_sb_port_pool_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_sb_port_pool_set(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_port_pool_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_sb_port_pool_set_batch(ynl_cpp::msg_batch& batch,
+			       devlink_sb_port_pool_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_SB_PORT_POOL_SET, 1);
+	devlink_sb_port_pool_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_SB_TC_POOL_BIND_GET ============== */
@@ -2791,29 +3683,32 @@ int devlink_sb_tc_pool_bind_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->port_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_SB_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->sb_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_SB_POOL_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->sb_pool_type = (devlink_sb_pool_type)ynl_attr_get_u8(attr);
 		} else if (type == DEVLINK_ATTR_SB_TC_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->sb_tc_index = (__u16)ynl_attr_get_u16(attr);
 		}
 	}
@@ -2821,162 +3716,463 @@ int devlink_sb_tc_pool_bind_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_sb_tc_pool_bind_get_rsp>
-devlink_sb_tc_pool_bind_get(ynl_cpp::ynl_socket&  ys,
-			    devlink_sb_tc_pool_bind_get_req& req)
+static void
+devlink_sb_tc_pool_bind_get_put(struct nlmsghdr *nlh,
+				devlink_sb_tc_pool_bind_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 32 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.sb_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
+	if (req.sb_pool_type.has_value())
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_SB_POOL_TYPE, req.sb_pool_type.value());
+	if (req.sb_tc_index.has_value())
+		ynl_attr_put_u16_unchecked(nlh, DEVLINK_ATTR_SB_TC_INDEX, req.sb_tc_index.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_sb_tc_pool_bind_get_rsp>>
+devlink_sb_tc_pool_bind_get_exec(ynl_cpp::ynl_socket&  ys,
+				 struct nlmsghdr *nlh,
+				 const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_sb_tc_pool_bind_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_TC_POOL_BIND_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
-	if (req.sb_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
-	if (req.sb_pool_type.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_SB_POOL_TYPE, req.sb_pool_type.value());
-	if (req.sb_tc_index.has_value())
-		ynl_attr_put_u16(nlh, DEVLINK_ATTR_SB_TC_INDEX, req.sb_tc_index.value());
-
 	rsp.reset(new devlink_sb_tc_pool_bind_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_sb_tc_pool_bind_get_rsp_parse;
 	yrs.rsp_cmd = 25;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_sb_tc_pool_bind_get_rsp>>
+devlink_sb_tc_pool_bind_get_ex(ynl_cpp::ynl_socket&  ys,
+			       devlink_sb_tc_pool_bind_get_req& req,
+			       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_TC_POOL_BIND_GET, 1);
+	devlink_sb_tc_pool_bind_get_put(nlh, req);
+
+	return devlink_sb_tc_pool_bind_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_sb_tc_pool_bind_get_rsp>
+devlink_sb_tc_pool_bind_get(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_tc_pool_bind_get_req& req)
+{
+	auto ret = devlink_sb_tc_pool_bind_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_tc_pool_bind_get_prepare(ynl_cpp::ynl_socket&  ys,
+				    devlink_sb_tc_pool_bind_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_TC_POOL_BIND_GET, 1);
+	devlink_sb_tc_pool_bind_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_sb_tc_pool_bind_get_rsp>>
+devlink_sb_tc_pool_bind_get_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl,
+			       const ynl_cpp::projection *proj)
+{
+	return devlink_sb_tc_pool_bind_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_sb_tc_pool_bind_get_rsp>
+devlink_sb_tc_pool_bind_get(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_tc_pool_bind_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_SB_TC_POOL_BIND_GET - dump */
-std::unique_ptr<devlink_sb_tc_pool_bind_get_list>
-devlink_sb_tc_pool_bind_get_dump(ynl_cpp::ynl_socket&  ys,
-				 devlink_sb_tc_pool_bind_get_req_dump& req)
+static void
+devlink_sb_tc_pool_bind_get_dump_put(struct nlmsghdr *nlh,
+				     devlink_sb_tc_pool_bind_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_sb_tc_pool_bind_get_list>>
+devlink_sb_tc_pool_bind_get_dump_exec(ynl_cpp::ynl_socket&  ys,
+				      struct nlmsghdr *nlh,
+				      const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_sb_tc_pool_bind_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_sb_tc_pool_bind_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_sb_tc_pool_bind_get_rsp_parse;
 	yds.rsp_cmd = 25;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_TC_POOL_BIND_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ============== DEVLINK_CMD_SB_TC_POOL_BIND_SET ============== */
-/* DEVLINK_CMD_SB_TC_POOL_BIND_SET - do */
-int devlink_sb_tc_pool_bind_set(ynl_cpp::ynl_socket&  ys,
-				devlink_sb_tc_pool_bind_set_req& req)
+ynl_cpp::result<std::unique_ptr<devlink_sb_tc_pool_bind_get_list>>
+devlink_sb_tc_pool_bind_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				    devlink_sb_tc_pool_bind_get_req_dump& req,
+				    const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_TC_POOL_BIND_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
-	if (req.sb_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
-	if (req.sb_pool_index.has_value())
-		ynl_attr_put_u16(nlh, DEVLINK_ATTR_SB_POOL_INDEX, req.sb_pool_index.value());
-	if (req.sb_pool_type.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_SB_POOL_TYPE, req.sb_pool_type.value());
-	if (req.sb_tc_index.has_value())
-		ynl_attr_put_u16(nlh, DEVLINK_ATTR_SB_TC_INDEX, req.sb_tc_index.value());
-	if (req.sb_threshold.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_THRESHOLD, req.sb_threshold.value());
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_TC_POOL_BIND_GET, 1);
+	devlink_sb_tc_pool_bind_get_dump_put(nlh, req);
 
-	err = ynl_exec(ys, nlh, &yrs);
-	if (err < 0)
-		return -1;
+	return devlink_sb_tc_pool_bind_get_dump_exec(ys, nlh, proj);
+}
 
-	return 0;
+std::unique_ptr<devlink_sb_tc_pool_bind_get_list>
+devlink_sb_tc_pool_bind_get_dump(ynl_cpp::ynl_socket&  ys,
+				 devlink_sb_tc_pool_bind_get_req_dump& req)
+{
+	auto ret = devlink_sb_tc_pool_bind_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
 }
 
-/* ============== DEVLINK_CMD_SB_OCC_SNAPSHOT ============== */
-/* DEVLINK_CMD_SB_OCC_SNAPSHOT - do */
-int devlink_sb_occ_snapshot(ynl_cpp::ynl_socket&  ys,
-			    devlink_sb_occ_snapshot_req& req)
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_tc_pool_bind_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+					 devlink_sb_tc_pool_bind_get_req_dump& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_TC_POOL_BIND_GET, 1);
+	devlink_sb_tc_pool_bind_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_sb_tc_pool_bind_get_list>>
+devlink_sb_tc_pool_bind_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				    ynl_cpp::request_template& tmpl,
+				    const ynl_cpp::projection *proj)
+{
+	return devlink_sb_tc_pool_bind_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_sb_tc_pool_bind_get_list>
+devlink_sb_tc_pool_bind_get_dump(ynl_cpp::ynl_socket&  ys,
+				 ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_tc_pool_bind_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_SB_TC_POOL_BIND_SET ============== */
+/* DEVLINK_CMD_SB_TC_POOL_BIND_SET - do */
+static void
+devlink_sb_tc_pool_bind_set_put(struct nlmsghdr *nlh,
+				devlink_sb_tc_pool_bind_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 48 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.sb_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
+	if (req.sb_pool_index.has_value())
+		ynl_attr_put_u16_unchecked(nlh, DEVLINK_ATTR_SB_POOL_INDEX, req.sb_pool_index.value());
+	if (req.sb_pool_type.has_value())
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_SB_POOL_TYPE, req.sb_pool_type.value());
+	if (req.sb_tc_index.has_value())
+		ynl_attr_put_u16_unchecked(nlh, DEVLINK_ATTR_SB_TC_INDEX, req.sb_tc_index.value());
+	if (req.sb_threshold.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_THRESHOLD, req.sb_threshold.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<void>
+devlink_sb_tc_pool_bind_set_exec(ynl_cpp::ynl_socket&  ys,
+				 struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_OCC_SNAPSHOT, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_sb_tc_pool_bind_set_ex(ynl_cpp::ynl_socket&  ys,
+			       devlink_sb_tc_pool_bind_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_TC_POOL_BIND_SET, 1);
+	devlink_sb_tc_pool_bind_set_put(nlh, req);
+
+	return devlink_sb_tc_pool_bind_set_exec(ys, nlh);
+}
+
+int devlink_sb_tc_pool_bind_set(ynl_cpp::ynl_socket&  ys,
+				devlink_sb_tc_pool_bind_set_req& req)
+{
+	auto ret = devlink_sb_tc_pool_bind_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_tc_pool_bind_set_prepare(ynl_cpp::ynl_socket&  ys,
+				    devlink_sb_tc_pool_bind_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_TC_POOL_BIND_SET, 1);
+	devlink_sb_tc_pool_bind_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_sb_tc_pool_bind_set_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl)
+{
+	return devlink_sb_tc_pool_bind_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_sb_tc_pool_bind_set(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_tc_pool_bind_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_sb_tc_pool_bind_set_batch(ynl_cpp::msg_batch& batch,
+				  devlink_sb_tc_pool_bind_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_SB_TC_POOL_BIND_SET, 1);
+	devlink_sb_tc_pool_bind_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_SB_OCC_SNAPSHOT ============== */
+/* DEVLINK_CMD_SB_OCC_SNAPSHOT - do */
+static void
+devlink_sb_occ_snapshot_put(struct nlmsghdr *nlh,
+			    devlink_sb_occ_snapshot_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.sb_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.sb_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
+}
+
+static ynl_cpp::result<void>
+devlink_sb_occ_snapshot_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_sb_occ_snapshot_ex(ynl_cpp::ynl_socket&  ys,
+			   devlink_sb_occ_snapshot_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_OCC_SNAPSHOT, 1);
+	devlink_sb_occ_snapshot_put(nlh, req);
+
+	return devlink_sb_occ_snapshot_exec(ys, nlh);
+}
+
+int devlink_sb_occ_snapshot(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_occ_snapshot_req& req)
+{
+	auto ret = devlink_sb_occ_snapshot_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_occ_snapshot_prepare(ynl_cpp::ynl_socket&  ys,
+				devlink_sb_occ_snapshot_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_OCC_SNAPSHOT, 1);
+	devlink_sb_occ_snapshot_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_sb_occ_snapshot_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl)
+{
+	return devlink_sb_occ_snapshot_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_sb_occ_snapshot(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_occ_snapshot_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_sb_occ_snapshot_batch(ynl_cpp::msg_batch& batch,
+			      devlink_sb_occ_snapshot_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_SB_OCC_SNAPSHOT, 1);
+	devlink_sb_occ_snapshot_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_SB_OCC_MAX_CLEAR ============== */
 /* DEVLINK_CMD_SB_OCC_MAX_CLEAR - do */
-int devlink_sb_occ_max_clear(ynl_cpp::ynl_socket&  ys,
+static void
+devlink_sb_occ_max_clear_put(struct nlmsghdr *nlh,
 			     devlink_sb_occ_max_clear_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_OCC_MAX_CLEAR, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.sb_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.sb_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_SB_INDEX, req.sb_index.value());
+}
+
+static ynl_cpp::result<void>
+devlink_sb_occ_max_clear_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_sb_occ_max_clear_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_occ_max_clear_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_OCC_MAX_CLEAR, 1);
+	devlink_sb_occ_max_clear_put(nlh, req);
+
+	return devlink_sb_occ_max_clear_exec(ys, nlh);
+}
+
+int devlink_sb_occ_max_clear(ynl_cpp::ynl_socket&  ys,
+			     devlink_sb_occ_max_clear_req& req)
+{
+	auto ret = devlink_sb_occ_max_clear_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_occ_max_clear_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_sb_occ_max_clear_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SB_OCC_MAX_CLEAR, 1);
+	devlink_sb_occ_max_clear_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_sb_occ_max_clear_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl)
+{
+	return devlink_sb_occ_max_clear_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_sb_occ_max_clear(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_sb_occ_max_clear_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_sb_occ_max_clear_batch(ynl_cpp::msg_batch& batch,
+			       devlink_sb_occ_max_clear_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_SB_OCC_MAX_CLEAR, 1);
+	devlink_sb_occ_max_clear_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_ESWITCH_GET ============== */
@@ -2992,25 +4188,28 @@ int devlink_eswitch_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_ESWITCH_MODE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->eswitch_mode = (devlink_eswitch_mode)ynl_attr_get_u16(attr);
 		} else if (type == DEVLINK_ATTR_ESWITCH_INLINE_MODE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->eswitch_inline_mode = (devlink_eswitch_inline_mode)ynl_attr_get_u8(attr);
 		} else if (type == DEVLINK_ATTR_ESWITCH_ENCAP_MODE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->eswitch_encap_mode = (devlink_eswitch_encap_mode)ynl_attr_get_u8(attr);
 		}
 	}
@@ -3018,93 +4217,209 @@ int devlink_eswitch_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_eswitch_get_rsp>
-devlink_eswitch_get(ynl_cpp::ynl_socket&  ys, devlink_eswitch_get_req& req)
+static void
+devlink_eswitch_get_put(struct nlmsghdr *nlh, devlink_eswitch_get_req& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_eswitch_get_rsp>>
+devlink_eswitch_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			 const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_eswitch_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_ESWITCH_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	rsp.reset(new devlink_eswitch_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_eswitch_get_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_ESWITCH_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* ============== DEVLINK_CMD_ESWITCH_SET ============== */
-/* DEVLINK_CMD_ESWITCH_SET - do */
-int devlink_eswitch_set(ynl_cpp::ynl_socket&  ys, devlink_eswitch_set_req& req)
+ynl_cpp::result<std::unique_ptr<devlink_eswitch_get_rsp>>
+devlink_eswitch_get_ex(ynl_cpp::ynl_socket&  ys, devlink_eswitch_get_req& req,
+		       const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_ESWITCH_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_ESWITCH_GET, 1);
+	devlink_eswitch_get_put(nlh, req);
+
+	return devlink_eswitch_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_eswitch_get_rsp>
+devlink_eswitch_get(ynl_cpp::ynl_socket&  ys, devlink_eswitch_get_req& req)
+{
+	auto ret = devlink_eswitch_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_eswitch_get_prepare(ynl_cpp::ynl_socket&  ys,
+			    devlink_eswitch_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_ESWITCH_GET, 1);
+	devlink_eswitch_get_put(nlh, req);
 
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_eswitch_get_rsp>>
+devlink_eswitch_get_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj)
+{
+	return devlink_eswitch_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_eswitch_get_rsp>
+devlink_eswitch_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_eswitch_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_ESWITCH_SET ============== */
+/* DEVLINK_CMD_ESWITCH_SET - do */
+static void
+devlink_eswitch_set_put(struct nlmsghdr *nlh, devlink_eswitch_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.eswitch_mode.has_value())
+		ynl_attr_put_u16_unchecked(nlh, DEVLINK_ATTR_ESWITCH_MODE, req.eswitch_mode.value());
+	if (req.eswitch_inline_mode.has_value())
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_ESWITCH_INLINE_MODE, req.eswitch_inline_mode.value());
+	if (req.eswitch_encap_mode.has_value())
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_ESWITCH_ENCAP_MODE, req.eswitch_encap_mode.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.eswitch_mode.has_value())
-		ynl_attr_put_u16(nlh, DEVLINK_ATTR_ESWITCH_MODE, req.eswitch_mode.value());
-	if (req.eswitch_inline_mode.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_ESWITCH_INLINE_MODE, req.eswitch_inline_mode.value());
-	if (req.eswitch_encap_mode.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_ESWITCH_ENCAP_MODE, req.eswitch_encap_mode.value());
+}
+
+static ynl_cpp::result<void>
+devlink_eswitch_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
 }
 
-/* ============== DEVLINK_CMD_DPIPE_TABLE_GET ============== */
-/* DEVLINK_CMD_DPIPE_TABLE_GET - do */
-int devlink_dpipe_table_get_rsp_parse(const struct nlmsghdr *nlh,
-				      struct ynl_parse_arg *yarg)
+ynl_cpp::result<void>
+devlink_eswitch_set_ex(ynl_cpp::ynl_socket&  ys, devlink_eswitch_set_req& req)
 {
-	devlink_dpipe_table_get_rsp *dst;
-	const struct nlattr *attr;
-	struct ynl_parse_arg parg;
+	struct nlmsghdr *nlh;
 
-	dst = (devlink_dpipe_table_get_rsp*)yarg->data;
-	parg.ys = yarg->ys;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_ESWITCH_SET, 1);
+	devlink_eswitch_set_put(nlh, req);
 
-	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
-		unsigned int type = ynl_attr_type(attr);
+	return devlink_eswitch_set_exec(ys, nlh);
+}
 
-		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
-		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
-		} else if (type == DEVLINK_ATTR_DPIPE_TABLES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+int devlink_eswitch_set(ynl_cpp::ynl_socket&  ys, devlink_eswitch_set_req& req)
+{
+	auto ret = devlink_eswitch_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_eswitch_set_prepare(ynl_cpp::ynl_socket&  ys,
+			    devlink_eswitch_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_ESWITCH_SET, 1);
+	devlink_eswitch_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_eswitch_set_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	return devlink_eswitch_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_eswitch_set(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_eswitch_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_eswitch_set_batch(ynl_cpp::msg_batch& batch,
+			  devlink_eswitch_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_ESWITCH_SET, 1);
+	devlink_eswitch_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_DPIPE_TABLE_GET ============== */
+/* DEVLINK_CMD_DPIPE_TABLE_GET - do */
+int devlink_dpipe_table_get_rsp_parse(const struct nlmsghdr *nlh,
+				      struct ynl_parse_arg *yarg)
+{
+	devlink_dpipe_table_get_rsp *dst;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+
+	dst = (devlink_dpipe_table_get_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == DEVLINK_ATTR_BUS_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
+		} else if (type == DEVLINK_ATTR_DEV_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
+		} else if (type == DEVLINK_ATTR_DPIPE_TABLES) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_dpipe_tables_nest;
-			parg.data = &dst->dpipe_tables;
+			parg.data = &dst->dpipe_tables.emplace();
 			if (devlink_dl_dpipe_tables_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -3113,38 +4428,95 @@ int devlink_dpipe_table_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_dpipe_table_get_rsp>
-devlink_dpipe_table_get(ynl_cpp::ynl_socket&  ys,
-			devlink_dpipe_table_get_req& req)
+static void
+devlink_dpipe_table_get_put(struct nlmsghdr *nlh,
+			    devlink_dpipe_table_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_dpipe_table_get_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_TABLE_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
-
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.dpipe_table_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DPIPE_TABLE_NAME, req.dpipe_table_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_dpipe_table_get_rsp>>
+devlink_dpipe_table_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			     const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_dpipe_table_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
 
 	rsp.reset(new devlink_dpipe_table_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_dpipe_table_get_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_DPIPE_TABLE_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_table_get_rsp>>
+devlink_dpipe_table_get_ex(ynl_cpp::ynl_socket&  ys,
+			   devlink_dpipe_table_get_req& req,
+			   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_TABLE_GET, 1);
+	devlink_dpipe_table_get_put(nlh, req);
+
+	return devlink_dpipe_table_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_dpipe_table_get_rsp>
+devlink_dpipe_table_get(ynl_cpp::ynl_socket&  ys,
+			devlink_dpipe_table_get_req& req)
+{
+	auto ret = devlink_dpipe_table_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_dpipe_table_get_prepare(ynl_cpp::ynl_socket&  ys,
+				devlink_dpipe_table_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_TABLE_GET, 1);
+	devlink_dpipe_table_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_table_get_rsp>>
+devlink_dpipe_table_get_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj)
+{
+	return devlink_dpipe_table_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_dpipe_table_get_rsp>
+devlink_dpipe_table_get(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_dpipe_table_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_DPIPE_ENTRIES_GET ============== */
 /* DEVLINK_CMD_DPIPE_ENTRIES_GET - do */
 int devlink_dpipe_entries_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -3160,20 +4532,23 @@ int devlink_dpipe_entries_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DPIPE_ENTRIES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_dpipe_entries_nest;
-			parg.data = &dst->dpipe_entries;
+			parg.data = &dst->dpipe_entries.emplace();
 			if (devlink_dl_dpipe_entries_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -3182,38 +4557,95 @@ int devlink_dpipe_entries_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_dpipe_entries_get_rsp>
-devlink_dpipe_entries_get(ynl_cpp::ynl_socket&  ys,
-			  devlink_dpipe_entries_get_req& req)
+static void
+devlink_dpipe_entries_get_put(struct nlmsghdr *nlh,
+			      devlink_dpipe_entries_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_dpipe_entries_get_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_ENTRIES_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
-
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.dpipe_table_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DPIPE_TABLE_NAME, req.dpipe_table_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_dpipe_entries_get_rsp>>
+devlink_dpipe_entries_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_dpipe_entries_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
 
 	rsp.reset(new devlink_dpipe_entries_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_dpipe_entries_get_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_DPIPE_ENTRIES_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_entries_get_rsp>>
+devlink_dpipe_entries_get_ex(ynl_cpp::ynl_socket&  ys,
+			     devlink_dpipe_entries_get_req& req,
+			     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_ENTRIES_GET, 1);
+	devlink_dpipe_entries_get_put(nlh, req);
+
+	return devlink_dpipe_entries_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_dpipe_entries_get_rsp>
+devlink_dpipe_entries_get(ynl_cpp::ynl_socket&  ys,
+			  devlink_dpipe_entries_get_req& req)
+{
+	auto ret = devlink_dpipe_entries_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_dpipe_entries_get_prepare(ynl_cpp::ynl_socket&  ys,
+				  devlink_dpipe_entries_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_ENTRIES_GET, 1);
+	devlink_dpipe_entries_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_entries_get_rsp>>
+devlink_dpipe_entries_get_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return devlink_dpipe_entries_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_dpipe_entries_get_rsp>
+devlink_dpipe_entries_get(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_dpipe_entries_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_DPIPE_HEADERS_GET ============== */
 /* DEVLINK_CMD_DPIPE_HEADERS_GET - do */
 int devlink_dpipe_headers_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -3229,20 +4661,23 @@ int devlink_dpipe_headers_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DPIPE_HEADERS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_dpipe_headers_nest;
-			parg.data = &dst->dpipe_headers;
+			parg.data = &dst->dpipe_headers.emplace();
 			if (devlink_dl_dpipe_headers_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -3251,158 +4686,396 @@ int devlink_dpipe_headers_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_dpipe_headers_get_rsp>
-devlink_dpipe_headers_get(ynl_cpp::ynl_socket&  ys,
-			  devlink_dpipe_headers_get_req& req)
+static void
+devlink_dpipe_headers_get_put(struct nlmsghdr *nlh,
+			      devlink_dpipe_headers_get_req& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_dpipe_headers_get_rsp>>
+devlink_dpipe_headers_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_dpipe_headers_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_HEADERS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	rsp.reset(new devlink_dpipe_headers_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_dpipe_headers_get_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_DPIPE_HEADERS_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_headers_get_rsp>>
+devlink_dpipe_headers_get_ex(ynl_cpp::ynl_socket&  ys,
+			     devlink_dpipe_headers_get_req& req,
+			     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_HEADERS_GET, 1);
+	devlink_dpipe_headers_get_put(nlh, req);
+
+	return devlink_dpipe_headers_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_dpipe_headers_get_rsp>
+devlink_dpipe_headers_get(ynl_cpp::ynl_socket&  ys,
+			  devlink_dpipe_headers_get_req& req)
+{
+	auto ret = devlink_dpipe_headers_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_dpipe_headers_get_prepare(ynl_cpp::ynl_socket&  ys,
+				  devlink_dpipe_headers_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_HEADERS_GET, 1);
+	devlink_dpipe_headers_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_headers_get_rsp>>
+devlink_dpipe_headers_get_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return devlink_dpipe_headers_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_dpipe_headers_get_rsp>
+devlink_dpipe_headers_get(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_dpipe_headers_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_DPIPE_TABLE_COUNTERS_SET ============== */
 /* DEVLINK_CMD_DPIPE_TABLE_COUNTERS_SET - do */
-int devlink_dpipe_table_counters_set(ynl_cpp::ynl_socket&  ys,
+static void
+devlink_dpipe_table_counters_set_put(struct nlmsghdr *nlh,
 				     devlink_dpipe_table_counters_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_TABLE_COUNTERS_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.dpipe_table_counters_enabled.has_value())
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_DPIPE_TABLE_COUNTERS_ENABLED, req.dpipe_table_counters_enabled.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.dpipe_table_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DPIPE_TABLE_NAME, req.dpipe_table_name.data());
-	if (req.dpipe_table_counters_enabled.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_DPIPE_TABLE_COUNTERS_ENABLED, req.dpipe_table_counters_enabled.value());
-
-	err = ynl_exec(ys, nlh, &yrs);
-	if (err < 0)
-		return -1;
-
-	return 0;
 }
 
-/* ============== DEVLINK_CMD_RESOURCE_SET ============== */
-/* DEVLINK_CMD_RESOURCE_SET - do */
-int devlink_resource_set(ynl_cpp::ynl_socket&  ys,
-			 devlink_resource_set_req& req)
+static ynl_cpp::result<void>
+devlink_dpipe_table_counters_set_exec(ynl_cpp::ynl_socket&  ys,
+				      struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RESOURCE_SET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.resource_id.has_value())
-		ynl_attr_put_u64(nlh, DEVLINK_ATTR_RESOURCE_ID, req.resource_id.value());
-	if (req.resource_size.has_value())
-		ynl_attr_put_u64(nlh, DEVLINK_ATTR_RESOURCE_SIZE, req.resource_size.value());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
 }
 
-/* ============== DEVLINK_CMD_RESOURCE_DUMP ============== */
-/* DEVLINK_CMD_RESOURCE_DUMP - do */
-int devlink_resource_dump_rsp_parse(const struct nlmsghdr *nlh,
-				    struct ynl_parse_arg *yarg)
+ynl_cpp::result<void>
+devlink_dpipe_table_counters_set_ex(ynl_cpp::ynl_socket&  ys,
+				    devlink_dpipe_table_counters_set_req& req)
 {
-	devlink_resource_dump_rsp *dst;
-	const struct nlattr *attr;
-	struct ynl_parse_arg parg;
+	struct nlmsghdr *nlh;
 
-	dst = (devlink_resource_dump_rsp*)yarg->data;
-	parg.ys = yarg->ys;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_TABLE_COUNTERS_SET, 1);
+	devlink_dpipe_table_counters_set_put(nlh, req);
 
-	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
-		unsigned int type = ynl_attr_type(attr);
+	return devlink_dpipe_table_counters_set_exec(ys, nlh);
+}
 
-		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
-		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
-		} else if (type == DEVLINK_ATTR_RESOURCE_LIST) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+int devlink_dpipe_table_counters_set(ynl_cpp::ynl_socket&  ys,
+				     devlink_dpipe_table_counters_set_req& req)
+{
+	auto ret = devlink_dpipe_table_counters_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
 
-			parg.rsp_policy = &devlink_dl_resource_list_nest;
-			parg.data = &dst->resource_list;
-			if (devlink_dl_resource_list_parse(&parg, attr))
-				return YNL_PARSE_CB_ERROR;
-		}
-	}
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_dpipe_table_counters_set_prepare(ynl_cpp::ynl_socket&  ys,
+					 devlink_dpipe_table_counters_set_req& req)
+{
+	struct nlmsghdr *nlh;
 
-	return YNL_PARSE_CB_OK;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_DPIPE_TABLE_COUNTERS_SET, 1);
+	devlink_dpipe_table_counters_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
 }
 
-std::unique_ptr<devlink_resource_dump_rsp>
-devlink_resource_dump(ynl_cpp::ynl_socket&  ys, devlink_resource_dump_req& req)
+ynl_cpp::result<void>
+devlink_dpipe_table_counters_set_ex(ynl_cpp::ynl_socket&  ys,
+				    ynl_cpp::request_template& tmpl)
+{
+	return devlink_dpipe_table_counters_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_dpipe_table_counters_set(ynl_cpp::ynl_socket&  ys,
+				     ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_dpipe_table_counters_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_dpipe_table_counters_set_batch(ynl_cpp::msg_batch& batch,
+				       devlink_dpipe_table_counters_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_resource_dump_rsp> rsp;
 	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_DPIPE_TABLE_COUNTERS_SET, 1);
+	devlink_dpipe_table_counters_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_RESOURCE_SET ============== */
+/* DEVLINK_CMD_RESOURCE_SET - do */
+static void
+devlink_resource_set_put(struct nlmsghdr *nlh, devlink_resource_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.resource_id.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DEVLINK_ATTR_RESOURCE_ID, req.resource_id.value());
+	if (req.resource_size.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DEVLINK_ATTR_RESOURCE_SIZE, req.resource_size.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<void>
+devlink_resource_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RESOURCE_DUMP, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
 
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_resource_set_ex(ynl_cpp::ynl_socket&  ys,
+			devlink_resource_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RESOURCE_SET, 1);
+	devlink_resource_set_put(nlh, req);
+
+	return devlink_resource_set_exec(ys, nlh);
+}
+
+int devlink_resource_set(ynl_cpp::ynl_socket&  ys,
+			 devlink_resource_set_req& req)
+{
+	auto ret = devlink_resource_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_resource_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     devlink_resource_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RESOURCE_SET, 1);
+	devlink_resource_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_resource_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	return devlink_resource_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_resource_set(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_resource_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_resource_set_batch(ynl_cpp::msg_batch& batch,
+			   devlink_resource_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_RESOURCE_SET, 1);
+	devlink_resource_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_RESOURCE_DUMP ============== */
+/* DEVLINK_CMD_RESOURCE_DUMP - do */
+int devlink_resource_dump_rsp_parse(const struct nlmsghdr *nlh,
+				    struct ynl_parse_arg *yarg)
+{
+	devlink_resource_dump_rsp *dst;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+
+	dst = (devlink_resource_dump_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == DEVLINK_ATTR_BUS_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
+		} else if (type == DEVLINK_ATTR_DEV_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
+		} else if (type == DEVLINK_ATTR_RESOURCE_LIST) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &devlink_dl_resource_list_nest;
+			parg.data = &dst->resource_list.emplace();
+			if (devlink_dl_resource_list_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+devlink_resource_dump_put(struct nlmsghdr *nlh, devlink_resource_dump_req& req)
+{
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_resource_dump_rsp>>
+devlink_resource_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_resource_dump_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
 
 	rsp.reset(new devlink_resource_dump_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_resource_dump_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_RESOURCE_DUMP;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_resource_dump_rsp>>
+devlink_resource_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_resource_dump_req& req,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RESOURCE_DUMP, 1);
+	devlink_resource_dump_put(nlh, req);
+
+	return devlink_resource_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_resource_dump_rsp>
+devlink_resource_dump(ynl_cpp::ynl_socket&  ys, devlink_resource_dump_req& req)
+{
+	auto ret = devlink_resource_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_resource_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_resource_dump_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RESOURCE_DUMP, 1);
+	devlink_resource_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_resource_dump_rsp>>
+devlink_resource_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return devlink_resource_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_resource_dump_rsp>
+devlink_resource_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_resource_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_RELOAD ============== */
 /* DEVLINK_CMD_RELOAD - do */
 int devlink_reload_rsp_parse(const struct nlmsghdr *nlh,
@@ -3416,17 +5089,20 @@ int devlink_reload_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_RELOAD_ACTIONS_PERFORMED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(struct nla_bitfield32))
+				return ynl_attr_invalid(yarg, attr, "bitfield32");
 			memcpy(&dst->reload_actions_performed, ynl_attr_data(attr), sizeof(struct nla_bitfield32));
 		}
 	}
@@ -3434,45 +5110,98 @@ int devlink_reload_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_reload_rsp>
-devlink_reload(ynl_cpp::ynl_socket&  ys, devlink_reload_req& req)
+static void devlink_reload_put(struct nlmsghdr *nlh, devlink_reload_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_reload_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RELOAD, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 44 <= YNL_SOCKET_BUFFER_SIZE);
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.reload_action.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_RELOAD_ACTION, req.reload_action.value());
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_RELOAD_ACTION, req.reload_action.value());
 	if (req.reload_limits.has_value())
-		ynl_attr_put(nlh, DEVLINK_ATTR_RELOAD_LIMITS, &req->reload_limits, sizeof(struct nla_bitfield32));
+		ynl_attr_put_unchecked(nlh, DEVLINK_ATTR_RELOAD_LIMITS, &(*req.reload_limits), sizeof(struct nla_bitfield32));
 	if (req.netns_pid.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_NETNS_PID, req.netns_pid.value());
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_NETNS_PID, req.netns_pid.value());
 	if (req.netns_fd.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_NETNS_FD, req.netns_fd.value());
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_NETNS_FD, req.netns_fd.value());
 	if (req.netns_id.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_NETNS_ID, req.netns_id.value());
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_NETNS_ID, req.netns_id.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_reload_rsp>>
+devlink_reload_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		    const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_reload_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
 
 	rsp.reset(new devlink_reload_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_reload_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_RELOAD;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_reload_rsp>>
+devlink_reload_ex(ynl_cpp::ynl_socket&  ys, devlink_reload_req& req,
+		  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RELOAD, 1);
+	devlink_reload_put(nlh, req);
+
+	return devlink_reload_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_reload_rsp>
+devlink_reload(ynl_cpp::ynl_socket&  ys, devlink_reload_req& req)
+{
+	auto ret = devlink_reload_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_reload_prepare(ynl_cpp::ynl_socket&  ys, devlink_reload_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RELOAD, 1);
+	devlink_reload_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_reload_rsp>>
+devlink_reload_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj)
+{
+	return devlink_reload_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_reload_rsp>
+devlink_reload(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_reload_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_PARAM_GET ============== */
 /* DEVLINK_CMD_PARAM_GET - do */
 int devlink_param_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -3486,114 +5215,281 @@ int devlink_param_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_PARAM_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->param_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->param_name.assign(ynl_attr_get_str(attr));
 		}
 	}
 
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_param_get_rsp>
-devlink_param_get(ynl_cpp::ynl_socket&  ys, devlink_param_get_req& req)
+static void
+devlink_param_get_put(struct nlmsghdr *nlh, devlink_param_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_param_get_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PARAM_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
-
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.param_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_PARAM_NAME, req.param_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_param_get_rsp>>
+devlink_param_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_param_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
 
 	rsp.reset(new devlink_param_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_param_get_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_PARAM_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* DEVLINK_CMD_PARAM_GET - dump */
-std::unique_ptr<devlink_param_get_list>
-devlink_param_get_dump(ynl_cpp::ynl_socket&  ys,
-		       devlink_param_get_req_dump& req)
+ynl_cpp::result<std::unique_ptr<devlink_param_get_rsp>>
+devlink_param_get_ex(ynl_cpp::ynl_socket&  ys, devlink_param_get_req& req,
+		     const ynl_cpp::projection *proj)
 {
-	struct ynl_dump_no_alloc_state yds = {};
 	struct nlmsghdr *nlh;
-	int err;
-
-	auto ret = std::make_unique<devlink_param_get_list>();
-	yds.yarg.ys = ys;
-	yds.yarg.rsp_policy = &devlink_nest;
-	yds.yarg.data = ret.get();
-	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_param_get_list*>(arg)->objs.emplace_back());};
-	yds.cb = devlink_param_get_rsp_parse;
-	yds.rsp_cmd = DEVLINK_CMD_PARAM_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PARAM_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PARAM_GET, 1);
+	devlink_param_get_put(nlh, req);
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+	return devlink_param_get_exec(ys, nlh, proj);
+}
 
-	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
-	if (err < 0)
+std::unique_ptr<devlink_param_get_rsp>
+devlink_param_get(ynl_cpp::ynl_socket&  ys, devlink_param_get_req& req)
+{
+	auto ret = devlink_param_get_ex(ys, req);
+	if (!ret)
 		return nullptr;
-
-	return ret;
+	return std::move(*ret);
 }
 
-/* ============== DEVLINK_CMD_PARAM_SET ============== */
-/* DEVLINK_CMD_PARAM_SET - do */
-int devlink_param_set(ynl_cpp::ynl_socket&  ys, devlink_param_set_req& req)
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_param_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_param_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PARAM_GET, 1);
+	devlink_param_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_param_get_rsp>>
+devlink_param_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return devlink_param_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_param_get_rsp>
+devlink_param_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_param_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* DEVLINK_CMD_PARAM_GET - dump */
+static void
+devlink_param_get_dump_put(struct nlmsghdr *nlh,
+			   devlink_param_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_param_get_list>>
+devlink_param_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PARAM_SET, 1);
+	auto ret = std::make_unique<devlink_param_get_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &devlink_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_param_get_list*>(arg)->objs.emplace_back());};
+	yds.cb = devlink_param_get_rsp_parse;
+	yds.rsp_cmd = DEVLINK_CMD_PARAM_GET;
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_param_get_list>>
+devlink_param_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  devlink_param_get_req_dump& req,
+			  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PARAM_GET, 1);
+	devlink_param_get_dump_put(nlh, req);
+
+	return devlink_param_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_param_get_list>
+devlink_param_get_dump(ynl_cpp::ynl_socket&  ys,
+		       devlink_param_get_req_dump& req)
+{
+	auto ret = devlink_param_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_param_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       devlink_param_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PARAM_GET, 1);
+	devlink_param_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_param_get_list>>
+devlink_param_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj)
+{
+	return devlink_param_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_param_get_list>
+devlink_param_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_param_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_PARAM_SET ============== */
+/* DEVLINK_CMD_PARAM_SET - do */
+static void
+devlink_param_set_put(struct nlmsghdr *nlh, devlink_param_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.param_type.has_value())
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_PARAM_TYPE, req.param_type.value());
+	if (req.param_value_cmode.has_value())
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_PARAM_VALUE_CMODE, req.param_value_cmode.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.param_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_PARAM_NAME, req.param_name.data());
-	if (req.param_type.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_PARAM_TYPE, req.param_type.value());
-	if (req.param_value_cmode.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_PARAM_VALUE_CMODE, req.param_value_cmode.value());
+}
+
+static ynl_cpp::result<void>
+devlink_param_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_param_set_ex(ynl_cpp::ynl_socket&  ys, devlink_param_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PARAM_SET, 1);
+	devlink_param_set_put(nlh, req);
+
+	return devlink_param_set_exec(ys, nlh);
+}
+
+int devlink_param_set(ynl_cpp::ynl_socket&  ys, devlink_param_set_req& req)
+{
+	auto ret = devlink_param_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_param_set_prepare(ynl_cpp::ynl_socket&  ys, devlink_param_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PARAM_SET, 1);
+	devlink_param_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_param_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return devlink_param_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_param_set(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_param_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_param_set_batch(ynl_cpp::msg_batch& batch, devlink_param_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_PARAM_SET, 1);
+	devlink_param_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_REGION_GET ============== */
@@ -3609,93 +5505,208 @@ int devlink_region_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->port_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_REGION_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->region_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->region_name.assign(ynl_attr_get_str(attr));
 		}
 	}
 
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_region_get_rsp>
-devlink_region_get(ynl_cpp::ynl_socket&  ys, devlink_region_get_req& req)
+static void
+devlink_region_get_put(struct nlmsghdr *nlh, devlink_region_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_region_get_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.region_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_REGION_NAME, req.region_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_region_get_rsp>>
+devlink_region_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_region_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
 
 	rsp.reset(new devlink_region_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_region_get_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_REGION_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_region_get_rsp>>
+devlink_region_get_ex(ynl_cpp::ynl_socket&  ys, devlink_region_get_req& req,
+		      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_GET, 1);
+	devlink_region_get_put(nlh, req);
+
+	return devlink_region_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_region_get_rsp>
+devlink_region_get(ynl_cpp::ynl_socket&  ys, devlink_region_get_req& req)
+{
+	auto ret = devlink_region_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_region_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   devlink_region_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_GET, 1);
+	devlink_region_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_region_get_rsp>>
+devlink_region_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj)
+{
+	return devlink_region_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_region_get_rsp>
+devlink_region_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_region_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_REGION_GET - dump */
-std::unique_ptr<devlink_region_get_list>
-devlink_region_get_dump(ynl_cpp::ynl_socket&  ys,
-			devlink_region_get_req_dump& req)
+static void
+devlink_region_get_dump_put(struct nlmsghdr *nlh,
+			    devlink_region_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_region_get_list>>
+devlink_region_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			     const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_region_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_region_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_region_get_rsp_parse;
 	yds.rsp_cmd = DEVLINK_CMD_REGION_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_region_get_list>>
+devlink_region_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   devlink_region_get_req_dump& req,
+			   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_GET, 1);
+	devlink_region_get_dump_put(nlh, req);
+
+	return devlink_region_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_region_get_list>
+devlink_region_get_dump(ynl_cpp::ynl_socket&  ys,
+			devlink_region_get_req_dump& req)
+{
+	auto ret = devlink_region_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_region_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				devlink_region_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_GET, 1);
+	devlink_region_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_region_get_list>>
+devlink_region_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj)
+{
+	return devlink_region_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_region_get_list>
+devlink_region_get_dump(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_region_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_REGION_NEW ============== */
 /* DEVLINK_CMD_REGION_NEW - do */
 int devlink_region_new_rsp_parse(const struct nlmsghdr *nlh,
@@ -3709,25 +5720,28 @@ int devlink_region_new_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->port_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_REGION_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->region_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->region_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_REGION_SNAPSHOT_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->region_snapshot_id = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -3735,68 +5749,183 @@ int devlink_region_new_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_region_new_rsp>
-devlink_region_new(ynl_cpp::ynl_socket&  ys, devlink_region_new_req& req)
+static void
+devlink_region_new_put(struct nlmsghdr *nlh, devlink_region_new_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_region_new_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_NEW, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.region_snapshot_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_REGION_SNAPSHOT_ID, req.region_snapshot_id.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.region_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_REGION_NAME, req.region_name.data());
-	if (req.region_snapshot_id.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_REGION_SNAPSHOT_ID, req.region_snapshot_id.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_region_new_rsp>>
+devlink_region_new_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_region_new_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
 
 	rsp.reset(new devlink_region_new_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_region_new_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_REGION_NEW;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* ============== DEVLINK_CMD_REGION_DEL ============== */
-/* DEVLINK_CMD_REGION_DEL - do */
-int devlink_region_del(ynl_cpp::ynl_socket&  ys, devlink_region_del_req& req)
+ynl_cpp::result<std::unique_ptr<devlink_region_new_rsp>>
+devlink_region_new_ex(ynl_cpp::ynl_socket&  ys, devlink_region_new_req& req,
+		      const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_DEL, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_NEW, 1);
+	devlink_region_new_put(nlh, req);
+
+	return devlink_region_new_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_region_new_rsp>
+devlink_region_new(ynl_cpp::ynl_socket&  ys, devlink_region_new_req& req)
+{
+	auto ret = devlink_region_new_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_region_new_prepare(ynl_cpp::ynl_socket&  ys,
+			   devlink_region_new_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_NEW, 1);
+	devlink_region_new_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
 
+ynl_cpp::result<std::unique_ptr<devlink_region_new_rsp>>
+devlink_region_new_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj)
+{
+	return devlink_region_new_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_region_new_rsp>
+devlink_region_new(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_region_new_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_REGION_DEL ============== */
+/* DEVLINK_CMD_REGION_DEL - do */
+static void
+devlink_region_del_put(struct nlmsghdr *nlh, devlink_region_del_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.region_snapshot_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_REGION_SNAPSHOT_ID, req.region_snapshot_id.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.region_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_REGION_NAME, req.region_name.data());
-	if (req.region_snapshot_id.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_REGION_SNAPSHOT_ID, req.region_snapshot_id.value());
+}
+
+static ynl_cpp::result<void>
+devlink_region_del_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_region_del_ex(ynl_cpp::ynl_socket&  ys, devlink_region_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_DEL, 1);
+	devlink_region_del_put(nlh, req);
+
+	return devlink_region_del_exec(ys, nlh);
+}
+
+int devlink_region_del(ynl_cpp::ynl_socket&  ys, devlink_region_del_req& req)
+{
+	auto ret = devlink_region_del_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_region_del_prepare(ynl_cpp::ynl_socket&  ys,
+			   devlink_region_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_DEL, 1);
+	devlink_region_del_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_region_del_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	return devlink_region_del_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_region_del(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_region_del_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_region_del_batch(ynl_cpp::msg_batch& batch,
+			 devlink_region_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_REGION_DEL, 1);
+	devlink_region_del_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_REGION_READ ============== */
@@ -3812,71 +5941,132 @@ int devlink_region_read_rsp_dump_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->port_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_REGION_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->region_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->region_name.assign(ynl_attr_get_str(attr));
 		}
 	}
 
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_region_read_rsp_list>
-devlink_region_read_dump(ynl_cpp::ynl_socket&  ys,
-			 devlink_region_read_req_dump& req)
+static void
+devlink_region_read_dump_put(struct nlmsghdr *nlh,
+			     devlink_region_read_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 44 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.region_snapshot_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_REGION_SNAPSHOT_ID, req.region_snapshot_id.value());
+	if (req.region_direct)
+		ynl_attr_put_unchecked(nlh, DEVLINK_ATTR_REGION_DIRECT, NULL, 0);
+	if (req.region_chunk_addr.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DEVLINK_ATTR_REGION_CHUNK_ADDR, req.region_chunk_addr.value());
+	if (req.region_chunk_len.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DEVLINK_ATTR_REGION_CHUNK_LEN, req.region_chunk_len.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+	if (req.region_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_REGION_NAME, req.region_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_region_read_rsp_list>>
+devlink_region_read_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			      const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_region_read_rsp_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_region_read_rsp_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_region_read_rsp_dump_parse;
 	yds.rsp_cmd = DEVLINK_CMD_REGION_READ;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_READ, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
-	if (req.region_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_REGION_NAME, req.region_name.data());
-	if (req.region_snapshot_id.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_REGION_SNAPSHOT_ID, req.region_snapshot_id.value());
-	if (req.region_direct)
-		ynl_attr_put(nlh, DEVLINK_ATTR_REGION_DIRECT, NULL, 0);
-	if (req.region_chunk_addr.has_value())
-		ynl_attr_put_u64(nlh, DEVLINK_ATTR_REGION_CHUNK_ADDR, req.region_chunk_addr.value());
-	if (req.region_chunk_len.has_value())
-		ynl_attr_put_u64(nlh, DEVLINK_ATTR_REGION_CHUNK_LEN, req.region_chunk_len.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_region_read_rsp_list>>
+devlink_region_read_dump_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_region_read_req_dump& req,
+			    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_READ, 1);
+	devlink_region_read_dump_put(nlh, req);
+
+	return devlink_region_read_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_region_read_rsp_list>
+devlink_region_read_dump(ynl_cpp::ynl_socket&  ys,
+			 devlink_region_read_req_dump& req)
+{
+	auto ret = devlink_region_read_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_region_read_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_region_read_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_REGION_READ, 1);
+	devlink_region_read_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_region_read_rsp_list>>
+devlink_region_read_dump_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl,
+			    const ynl_cpp::projection *proj)
+{
+	return devlink_region_read_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_region_read_rsp_list>
+devlink_region_read_dump(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_region_read_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_PORT_PARAM_GET ============== */
 /* DEVLINK_CMD_PORT_PARAM_GET - do */
 int devlink_port_param_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -3890,17 +6080,20 @@ int devlink_port_param_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->port_index = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -3908,131 +6101,274 @@ int devlink_port_param_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_port_param_get_rsp>
-devlink_port_param_get(ynl_cpp::ynl_socket&  ys,
-		       devlink_port_param_get_req& req)
+static void
+devlink_port_param_get_put(struct nlmsghdr *nlh,
+			   devlink_port_param_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_port_param_get_rsp>>
+devlink_port_param_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_port_param_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_PARAM_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
-
 	rsp.reset(new devlink_port_param_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_port_param_get_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_PORT_PARAM_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_port_param_get_rsp>>
+devlink_port_param_get_ex(ynl_cpp::ynl_socket&  ys,
+			  devlink_port_param_get_req& req,
+			  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_PARAM_GET, 1);
+	devlink_port_param_get_put(nlh, req);
+
+	return devlink_port_param_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_port_param_get_rsp>
+devlink_port_param_get(ynl_cpp::ynl_socket&  ys,
+		       devlink_port_param_get_req& req)
+{
+	auto ret = devlink_port_param_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_param_get_prepare(ynl_cpp::ynl_socket&  ys,
+			       devlink_port_param_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_PARAM_GET, 1);
+	devlink_port_param_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_port_param_get_rsp>>
+devlink_port_param_get_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj)
+{
+	return devlink_port_param_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_port_param_get_rsp>
+devlink_port_param_get(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_port_param_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_PORT_PARAM_GET - dump */
-std::unique_ptr<devlink_port_param_get_list>
-devlink_port_param_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<devlink_port_param_get_list>>
+devlink_port_param_get_dump_exec(ynl_cpp::ynl_socket&  ys,
+				 struct nlmsghdr *nlh,
+				 const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_port_param_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_port_param_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_port_param_get_rsp_parse;
 	yds.rsp_cmd = DEVLINK_CMD_PORT_PARAM_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_PARAM_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_port_param_get_list>>
+devlink_port_param_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_PARAM_GET, 1);
+
+	return devlink_port_param_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_port_param_get_list>
+devlink_port_param_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = devlink_port_param_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_PORT_PARAM_SET ============== */
 /* DEVLINK_CMD_PORT_PARAM_SET - do */
-int devlink_port_param_set(ynl_cpp::ynl_socket&  ys,
+static void
+devlink_port_param_set_put(struct nlmsghdr *nlh,
 			   devlink_port_param_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_PARAM_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+}
+
+static ynl_cpp::result<void>
+devlink_port_param_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
 }
 
-/* ============== DEVLINK_CMD_INFO_GET ============== */
-/* DEVLINK_CMD_INFO_GET - do */
-int devlink_info_get_rsp_parse(const struct nlmsghdr *nlh,
-			       struct ynl_parse_arg *yarg)
+ynl_cpp::result<void>
+devlink_port_param_set_ex(ynl_cpp::ynl_socket&  ys,
+			  devlink_port_param_set_req& req)
 {
-	unsigned int n_info_version_running = 0;
-	unsigned int n_info_version_stored = 0;
-	unsigned int n_info_version_fixed = 0;
-	devlink_info_get_rsp *dst;
-	const struct nlattr *attr;
-	struct ynl_parse_arg parg;
-	int i;
-
-	dst = (devlink_info_get_rsp*)yarg->data;
-	parg.ys = yarg->ys;
+	struct nlmsghdr *nlh;
 
-	if (dst->info_version_fixed.size() > 0)
-		return ynl_error_parse(yarg, "attribute already present (devlink.info-version-fixed)");
-	if (dst->info_version_running.size() > 0)
-		return ynl_error_parse(yarg, "attribute already present (devlink.info-version-running)");
-	if (dst->info_version_stored.size() > 0)
-		return ynl_error_parse(yarg, "attribute already present (devlink.info-version-stored)");
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_PARAM_SET, 1);
+	devlink_port_param_set_put(nlh, req);
 
-	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
-		unsigned int type = ynl_attr_type(attr);
+	return devlink_port_param_set_exec(ys, nlh);
+}
 
-		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+int devlink_port_param_set(ynl_cpp::ynl_socket&  ys,
+			   devlink_port_param_set_req& req)
+{
+	auto ret = devlink_port_param_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_param_set_prepare(ynl_cpp::ynl_socket&  ys,
+			       devlink_port_param_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_PORT_PARAM_SET, 1);
+	devlink_port_param_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_port_param_set_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	return devlink_port_param_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_port_param_set(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_port_param_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_port_param_set_batch(ynl_cpp::msg_batch& batch,
+			     devlink_port_param_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_PORT_PARAM_SET, 1);
+	devlink_port_param_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_INFO_GET ============== */
+/* DEVLINK_CMD_INFO_GET - do */
+int devlink_info_get_rsp_parse(const struct nlmsghdr *nlh,
+			       struct ynl_parse_arg *yarg)
+{
+	unsigned int n_info_version_running = 0;
+	unsigned int n_info_version_stored = 0;
+	unsigned int n_info_version_fixed = 0;
+	devlink_info_get_rsp *dst;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	int i;
+
+	dst = (devlink_info_get_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	if (dst->info_version_fixed.size() > 0)
+		return ynl_error_parse(yarg, "attribute already present (devlink.info-version-fixed)");
+	if (dst->info_version_running.size() > 0)
+		return ynl_error_parse(yarg, "attribute already present (devlink.info-version-running)");
+	if (dst->info_version_stored.size() > 0)
+		return ynl_error_parse(yarg, "attribute already present (devlink.info-version-stored)");
+
+	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == DEVLINK_ATTR_BUS_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_INFO_DRIVER_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->info_driver_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->info_driver_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_INFO_SERIAL_NUMBER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->info_serial_number.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->info_serial_number.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_INFO_VERSION_FIXED) {
 			n_info_version_fixed++;
 		} else if (type == DEVLINK_ATTR_INFO_VERSION_RUNNING) {
@@ -4085,60 +6421,131 @@ int devlink_info_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_info_get_rsp>
-devlink_info_get(ynl_cpp::ynl_socket&  ys, devlink_info_get_req& req)
+static void
+devlink_info_get_put(struct nlmsghdr *nlh, devlink_info_get_req& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_info_get_rsp>>
+devlink_info_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_info_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_INFO_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	rsp.reset(new devlink_info_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_info_get_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_INFO_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_info_get_rsp>>
+devlink_info_get_ex(ynl_cpp::ynl_socket&  ys, devlink_info_get_req& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_INFO_GET, 1);
+	devlink_info_get_put(nlh, req);
+
+	return devlink_info_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_info_get_rsp>
+devlink_info_get(ynl_cpp::ynl_socket&  ys, devlink_info_get_req& req)
+{
+	auto ret = devlink_info_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_info_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_info_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_INFO_GET, 1);
+	devlink_info_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_info_get_rsp>>
+devlink_info_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return devlink_info_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_info_get_rsp>
+devlink_info_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_info_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_INFO_GET - dump */
-std::unique_ptr<devlink_info_get_list>
-devlink_info_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<devlink_info_get_list>>
+devlink_info_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_info_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_info_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_info_get_rsp_parse;
 	yds.rsp_cmd = DEVLINK_CMD_INFO_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_INFO_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_info_get_list>>
+devlink_info_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_INFO_GET, 1);
+
+	return devlink_info_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_info_get_list>
+devlink_info_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = devlink_info_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_GET ============== */
 /* DEVLINK_CMD_HEALTH_REPORTER_GET - do */
 int devlink_health_reporter_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -4152,184 +6559,492 @@ int devlink_health_reporter_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->port_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DEVLINK_ATTR_HEALTH_REPORTER_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->health_reporter_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->health_reporter_name.assign(ynl_attr_get_str(attr));
 		}
 	}
 
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_health_reporter_get_rsp>
-devlink_health_reporter_get(ynl_cpp::ynl_socket&  ys,
-			    devlink_health_reporter_get_req& req)
+static void
+devlink_health_reporter_get_put(struct nlmsghdr *nlh,
+				devlink_health_reporter_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_health_reporter_get_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.health_reporter_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_HEALTH_REPORTER_NAME, req.health_reporter_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_health_reporter_get_rsp>>
+devlink_health_reporter_get_exec(ynl_cpp::ynl_socket&  ys,
+				 struct nlmsghdr *nlh,
+				 const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_health_reporter_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
 
 	rsp.reset(new devlink_health_reporter_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_health_reporter_get_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_HEALTH_REPORTER_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_get_rsp>>
+devlink_health_reporter_get_ex(ynl_cpp::ynl_socket&  ys,
+			       devlink_health_reporter_get_req& req,
+			       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_GET, 1);
+	devlink_health_reporter_get_put(nlh, req);
+
+	return devlink_health_reporter_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_health_reporter_get_rsp>
+devlink_health_reporter_get(ynl_cpp::ynl_socket&  ys,
+			    devlink_health_reporter_get_req& req)
+{
+	auto ret = devlink_health_reporter_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_get_prepare(ynl_cpp::ynl_socket&  ys,
+				    devlink_health_reporter_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_GET, 1);
+	devlink_health_reporter_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_get_rsp>>
+devlink_health_reporter_get_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl,
+			       const ynl_cpp::projection *proj)
+{
+	return devlink_health_reporter_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_health_reporter_get_rsp>
+devlink_health_reporter_get(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_health_reporter_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_HEALTH_REPORTER_GET - dump */
-std::unique_ptr<devlink_health_reporter_get_list>
-devlink_health_reporter_get_dump(ynl_cpp::ynl_socket&  ys,
-				 devlink_health_reporter_get_req_dump& req)
+static void
+devlink_health_reporter_get_dump_put(struct nlmsghdr *nlh,
+				     devlink_health_reporter_get_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_health_reporter_get_list>>
+devlink_health_reporter_get_dump_exec(ynl_cpp::ynl_socket&  ys,
+				      struct nlmsghdr *nlh,
+				      const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_health_reporter_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_health_reporter_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_health_reporter_get_rsp_parse;
 	yds.rsp_cmd = DEVLINK_CMD_HEALTH_REPORTER_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_get_list>>
+devlink_health_reporter_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				    devlink_health_reporter_get_req_dump& req,
+				    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_GET, 1);
+	devlink_health_reporter_get_dump_put(nlh, req);
+
+	return devlink_health_reporter_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_health_reporter_get_list>
+devlink_health_reporter_get_dump(ynl_cpp::ynl_socket&  ys,
+				 devlink_health_reporter_get_req_dump& req)
+{
+	auto ret = devlink_health_reporter_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+					 devlink_health_reporter_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_GET, 1);
+	devlink_health_reporter_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_get_list>>
+devlink_health_reporter_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				    ynl_cpp::request_template& tmpl,
+				    const ynl_cpp::projection *proj)
+{
+	return devlink_health_reporter_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_health_reporter_get_list>
+devlink_health_reporter_get_dump(ynl_cpp::ynl_socket&  ys,
+				 ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_health_reporter_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_SET ============== */
 /* DEVLINK_CMD_HEALTH_REPORTER_SET - do */
-int devlink_health_reporter_set(ynl_cpp::ynl_socket&  ys,
+static void
+devlink_health_reporter_set_put(struct nlmsghdr *nlh,
 				devlink_health_reporter_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 36 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.health_reporter_graceful_period.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DEVLINK_ATTR_HEALTH_REPORTER_GRACEFUL_PERIOD, req.health_reporter_graceful_period.value());
+	if (req.health_reporter_auto_recover.has_value())
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_HEALTH_REPORTER_AUTO_RECOVER, req.health_reporter_auto_recover.value());
+	if (req.health_reporter_auto_dump.has_value())
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_HEALTH_REPORTER_AUTO_DUMP, req.health_reporter_auto_dump.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.health_reporter_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_HEALTH_REPORTER_NAME, req.health_reporter_name.data());
-	if (req.health_reporter_graceful_period.has_value())
-		ynl_attr_put_u64(nlh, DEVLINK_ATTR_HEALTH_REPORTER_GRACEFUL_PERIOD, req.health_reporter_graceful_period.value());
-	if (req.health_reporter_auto_recover.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_HEALTH_REPORTER_AUTO_RECOVER, req.health_reporter_auto_recover.value());
-	if (req.health_reporter_auto_dump.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_HEALTH_REPORTER_AUTO_DUMP, req.health_reporter_auto_dump.value());
-
-	err = ynl_exec(ys, nlh, &yrs);
-	if (err < 0)
-		return -1;
-
-	return 0;
 }
 
-/* ============== DEVLINK_CMD_HEALTH_REPORTER_RECOVER ============== */
-/* DEVLINK_CMD_HEALTH_REPORTER_RECOVER - do */
-int devlink_health_reporter_recover(ynl_cpp::ynl_socket&  ys,
-				    devlink_health_reporter_recover_req& req)
+static ynl_cpp::result<void>
+devlink_health_reporter_set_exec(ynl_cpp::ynl_socket&  ys,
+				 struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_RECOVER, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_health_reporter_set_ex(ynl_cpp::ynl_socket&  ys,
+			       devlink_health_reporter_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_SET, 1);
+	devlink_health_reporter_set_put(nlh, req);
+
+	return devlink_health_reporter_set_exec(ys, nlh);
+}
+
+int devlink_health_reporter_set(ynl_cpp::ynl_socket&  ys,
+				devlink_health_reporter_set_req& req)
+{
+	auto ret = devlink_health_reporter_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_set_prepare(ynl_cpp::ynl_socket&  ys,
+				    devlink_health_reporter_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_SET, 1);
+	devlink_health_reporter_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_health_reporter_set_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl)
+{
+	return devlink_health_reporter_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_health_reporter_set(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_health_reporter_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_health_reporter_set_batch(ynl_cpp::msg_batch& batch,
+				  devlink_health_reporter_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_HEALTH_REPORTER_SET, 1);
+	devlink_health_reporter_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_HEALTH_REPORTER_RECOVER ============== */
+/* DEVLINK_CMD_HEALTH_REPORTER_RECOVER - do */
+static void
+devlink_health_reporter_recover_put(struct nlmsghdr *nlh,
+				    devlink_health_reporter_recover_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.health_reporter_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_HEALTH_REPORTER_NAME, req.health_reporter_name.data());
+}
+
+static ynl_cpp::result<void>
+devlink_health_reporter_recover_exec(ynl_cpp::ynl_socket&  ys,
+				     struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_health_reporter_recover_ex(ynl_cpp::ynl_socket&  ys,
+				   devlink_health_reporter_recover_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_RECOVER, 1);
+	devlink_health_reporter_recover_put(nlh, req);
+
+	return devlink_health_reporter_recover_exec(ys, nlh);
+}
+
+int devlink_health_reporter_recover(ynl_cpp::ynl_socket&  ys,
+				    devlink_health_reporter_recover_req& req)
+{
+	auto ret = devlink_health_reporter_recover_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_recover_prepare(ynl_cpp::ynl_socket&  ys,
+					devlink_health_reporter_recover_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_RECOVER, 1);
+	devlink_health_reporter_recover_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_health_reporter_recover_ex(ynl_cpp::ynl_socket&  ys,
+				   ynl_cpp::request_template& tmpl)
+{
+	return devlink_health_reporter_recover_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_health_reporter_recover(ynl_cpp::ynl_socket&  ys,
+				    ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_health_reporter_recover_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_health_reporter_recover_batch(ynl_cpp::msg_batch& batch,
+				      devlink_health_reporter_recover_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_HEALTH_REPORTER_RECOVER, 1);
+	devlink_health_reporter_recover_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_DIAGNOSE ============== */
 /* DEVLINK_CMD_HEALTH_REPORTER_DIAGNOSE - do */
-int devlink_health_reporter_diagnose(ynl_cpp::ynl_socket&  ys,
+static void
+devlink_health_reporter_diagnose_put(struct nlmsghdr *nlh,
 				     devlink_health_reporter_diagnose_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_DIAGNOSE, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.health_reporter_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_HEALTH_REPORTER_NAME, req.health_reporter_name.data());
+}
+
+static ynl_cpp::result<void>
+devlink_health_reporter_diagnose_exec(ynl_cpp::ynl_socket&  ys,
+				      struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_health_reporter_diagnose_ex(ynl_cpp::ynl_socket&  ys,
+				    devlink_health_reporter_diagnose_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_DIAGNOSE, 1);
+	devlink_health_reporter_diagnose_put(nlh, req);
+
+	return devlink_health_reporter_diagnose_exec(ys, nlh);
+}
+
+int devlink_health_reporter_diagnose(ynl_cpp::ynl_socket&  ys,
+				     devlink_health_reporter_diagnose_req& req)
+{
+	auto ret = devlink_health_reporter_diagnose_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_diagnose_prepare(ynl_cpp::ynl_socket&  ys,
+					 devlink_health_reporter_diagnose_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_DIAGNOSE, 1);
+	devlink_health_reporter_diagnose_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_health_reporter_diagnose_ex(ynl_cpp::ynl_socket&  ys,
+				    ynl_cpp::request_template& tmpl)
+{
+	return devlink_health_reporter_diagnose_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_health_reporter_diagnose(ynl_cpp::ynl_socket&  ys,
+				     ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_health_reporter_diagnose_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_health_reporter_diagnose_batch(ynl_cpp::msg_batch& batch,
+				       devlink_health_reporter_diagnose_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_HEALTH_REPORTER_DIAGNOSE, 1);
+	devlink_health_reporter_diagnose_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_DUMP_GET ============== */
@@ -4347,12 +7062,15 @@ int devlink_health_reporter_dump_get_rsp_dump_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_FMSG) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &devlink_dl_fmsg_nest;
-			parg.data = &dst->fmsg;
+			parg.data = &dst->fmsg.emplace();
 			if (devlink_dl_fmsg_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -4361,81 +7079,199 @@ int devlink_health_reporter_dump_get_rsp_dump_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_health_reporter_dump_get_rsp_list>
-devlink_health_reporter_dump_get_dump(ynl_cpp::ynl_socket&  ys,
-				      devlink_health_reporter_dump_get_req_dump& req)
+static void
+devlink_health_reporter_dump_get_dump_put(struct nlmsghdr *nlh,
+					  devlink_health_reporter_dump_get_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+	if (req.health_reporter_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_HEALTH_REPORTER_NAME, req.health_reporter_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_health_reporter_dump_get_rsp_list>>
+devlink_health_reporter_dump_get_dump_exec(ynl_cpp::ynl_socket&  ys,
+					   struct nlmsghdr *nlh,
+					   const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_health_reporter_dump_get_rsp_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_health_reporter_dump_get_rsp_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_health_reporter_dump_get_rsp_dump_parse;
 	yds.rsp_cmd = DEVLINK_CMD_HEALTH_REPORTER_DUMP_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_DUMP_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
-	if (req.health_reporter_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_HEALTH_REPORTER_NAME, req.health_reporter_name.data());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_dump_get_rsp_list>>
+devlink_health_reporter_dump_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+					 devlink_health_reporter_dump_get_req_dump& req,
+					 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_DUMP_GET, 1);
+	devlink_health_reporter_dump_get_dump_put(nlh, req);
+
+	return devlink_health_reporter_dump_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_health_reporter_dump_get_rsp_list>
+devlink_health_reporter_dump_get_dump(ynl_cpp::ynl_socket&  ys,
+				      devlink_health_reporter_dump_get_req_dump& req)
+{
+	auto ret = devlink_health_reporter_dump_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_dump_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+					      devlink_health_reporter_dump_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_DUMP_GET, 1);
+	devlink_health_reporter_dump_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_dump_get_rsp_list>>
+devlink_health_reporter_dump_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+					 ynl_cpp::request_template& tmpl,
+					 const ynl_cpp::projection *proj)
+{
+	return devlink_health_reporter_dump_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_health_reporter_dump_get_rsp_list>
+devlink_health_reporter_dump_get_dump(ynl_cpp::ynl_socket&  ys,
+				      ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_health_reporter_dump_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_DUMP_CLEAR ============== */
 /* DEVLINK_CMD_HEALTH_REPORTER_DUMP_CLEAR - do */
-int devlink_health_reporter_dump_clear(ynl_cpp::ynl_socket&  ys,
+static void
+devlink_health_reporter_dump_clear_put(struct nlmsghdr *nlh,
 				       devlink_health_reporter_dump_clear_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_DUMP_CLEAR, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.health_reporter_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_HEALTH_REPORTER_NAME, req.health_reporter_name.data());
+}
+
+static ynl_cpp::result<void>
+devlink_health_reporter_dump_clear_exec(ynl_cpp::ynl_socket&  ys,
+					struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
 }
 
-/* ============== DEVLINK_CMD_FLASH_UPDATE ============== */
-/* DEVLINK_CMD_FLASH_UPDATE - do */
-int devlink_flash_update(ynl_cpp::ynl_socket&  ys,
-			 devlink_flash_update_req& req)
+ynl_cpp::result<void>
+devlink_health_reporter_dump_clear_ex(ynl_cpp::ynl_socket&  ys,
+				      devlink_health_reporter_dump_clear_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_FLASH_UPDATE, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_DUMP_CLEAR, 1);
+	devlink_health_reporter_dump_clear_put(nlh, req);
+
+	return devlink_health_reporter_dump_clear_exec(ys, nlh);
+}
+
+int devlink_health_reporter_dump_clear(ynl_cpp::ynl_socket&  ys,
+				       devlink_health_reporter_dump_clear_req& req)
+{
+	auto ret = devlink_health_reporter_dump_clear_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_dump_clear_prepare(ynl_cpp::ynl_socket&  ys,
+					   devlink_health_reporter_dump_clear_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_DUMP_CLEAR, 1);
+	devlink_health_reporter_dump_clear_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_health_reporter_dump_clear_ex(ynl_cpp::ynl_socket&  ys,
+				      ynl_cpp::request_template& tmpl)
+{
+	return devlink_health_reporter_dump_clear_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_health_reporter_dump_clear(ynl_cpp::ynl_socket&  ys,
+				       ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_health_reporter_dump_clear_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_health_reporter_dump_clear_batch(ynl_cpp::msg_batch& batch,
+					 devlink_health_reporter_dump_clear_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_HEALTH_REPORTER_DUMP_CLEAR, 1);
+	devlink_health_reporter_dump_clear_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_FLASH_UPDATE ============== */
+/* DEVLINK_CMD_FLASH_UPDATE - do */
+static void
+devlink_flash_update_put(struct nlmsghdr *nlh, devlink_flash_update_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 12 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.flash_update_overwrite_mask.has_value())
+		ynl_attr_put_unchecked(nlh, DEVLINK_ATTR_FLASH_UPDATE_OVERWRITE_MASK, &(*req.flash_update_overwrite_mask), sizeof(struct nla_bitfield32));
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
@@ -4444,17 +7280,80 @@ int devlink_flash_update(ynl_cpp::ynl_socket&  ys,
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_FLASH_UPDATE_FILE_NAME, req.flash_update_file_name.data());
 	if (req.flash_update_component.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_FLASH_UPDATE_COMPONENT, req.flash_update_component.data());
-	if (req.flash_update_overwrite_mask.has_value())
-		ynl_attr_put(nlh, DEVLINK_ATTR_FLASH_UPDATE_OVERWRITE_MASK, &req->flash_update_overwrite_mask, sizeof(struct nla_bitfield32));
+}
+
+static ynl_cpp::result<void>
+devlink_flash_update_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
 }
 
-/* ============== DEVLINK_CMD_TRAP_GET ============== */
+ynl_cpp::result<void>
+devlink_flash_update_ex(ynl_cpp::ynl_socket&  ys,
+			devlink_flash_update_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_FLASH_UPDATE, 1);
+	devlink_flash_update_put(nlh, req);
+
+	return devlink_flash_update_exec(ys, nlh);
+}
+
+int devlink_flash_update(ynl_cpp::ynl_socket&  ys,
+			 devlink_flash_update_req& req)
+{
+	auto ret = devlink_flash_update_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_flash_update_prepare(ynl_cpp::ynl_socket&  ys,
+			     devlink_flash_update_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_FLASH_UPDATE, 1);
+	devlink_flash_update_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_flash_update_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	return devlink_flash_update_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_flash_update(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_flash_update_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_flash_update_batch(ynl_cpp::msg_batch& batch,
+			   devlink_flash_update_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_FLASH_UPDATE, 1);
+	devlink_flash_update_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_TRAP_GET ============== */
 /* DEVLINK_CMD_TRAP_GET - do */
 int devlink_trap_get_rsp_parse(const struct nlmsghdr *nlh,
 			       struct ynl_parse_arg *yarg)
@@ -4467,111 +7366,276 @@ int devlink_trap_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_TRAP_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->trap_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->trap_name.assign(ynl_attr_get_str(attr));
 		}
 	}
 
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_trap_get_rsp>
-devlink_trap_get(ynl_cpp::ynl_socket&  ys, devlink_trap_get_req& req)
+static void
+devlink_trap_get_put(struct nlmsghdr *nlh, devlink_trap_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_trap_get_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
-
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.trap_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_TRAP_NAME, req.trap_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_trap_get_rsp>>
+devlink_trap_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_trap_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
 
 	rsp.reset(new devlink_trap_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_trap_get_rsp_parse;
 	yrs.rsp_cmd = 63;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_trap_get_rsp>>
+devlink_trap_get_ex(ynl_cpp::ynl_socket&  ys, devlink_trap_get_req& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GET, 1);
+	devlink_trap_get_put(nlh, req);
+
+	return devlink_trap_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_trap_get_rsp>
+devlink_trap_get(ynl_cpp::ynl_socket&  ys, devlink_trap_get_req& req)
+{
+	auto ret = devlink_trap_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_trap_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GET, 1);
+	devlink_trap_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_trap_get_rsp>>
+devlink_trap_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return devlink_trap_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_trap_get_rsp>
+devlink_trap_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_trap_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_TRAP_GET - dump */
-std::unique_ptr<devlink_trap_get_list>
-devlink_trap_get_dump(ynl_cpp::ynl_socket&  ys, devlink_trap_get_req_dump& req)
+static void
+devlink_trap_get_dump_put(struct nlmsghdr *nlh, devlink_trap_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_trap_get_list>>
+devlink_trap_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_trap_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_trap_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_trap_get_rsp_parse;
 	yds.rsp_cmd = 63;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ============== DEVLINK_CMD_TRAP_SET ============== */
-/* DEVLINK_CMD_TRAP_SET - do */
-int devlink_trap_set(ynl_cpp::ynl_socket&  ys, devlink_trap_set_req& req)
+ynl_cpp::result<std::unique_ptr<devlink_trap_get_list>>
+devlink_trap_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_trap_get_req_dump& req,
+			 const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GET, 1);
+	devlink_trap_get_dump_put(nlh, req);
+
+	return devlink_trap_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_trap_get_list>
+devlink_trap_get_dump(ynl_cpp::ynl_socket&  ys, devlink_trap_get_req_dump& req)
+{
+	auto ret = devlink_trap_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_trap_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GET, 1);
+	devlink_trap_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_trap_get_list>>
+devlink_trap_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return devlink_trap_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_trap_get_list>
+devlink_trap_get_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_trap_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_TRAP_SET ============== */
+/* DEVLINK_CMD_TRAP_SET - do */
+static void
+devlink_trap_set_put(struct nlmsghdr *nlh, devlink_trap_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.trap_action.has_value())
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_TRAP_ACTION, req.trap_action.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.trap_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_TRAP_NAME, req.trap_name.data());
-	if (req.trap_action.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_TRAP_ACTION, req.trap_action.value());
+}
+
+static ynl_cpp::result<void>
+devlink_trap_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_trap_set_ex(ynl_cpp::ynl_socket&  ys, devlink_trap_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_SET, 1);
+	devlink_trap_set_put(nlh, req);
+
+	return devlink_trap_set_exec(ys, nlh);
+}
+
+int devlink_trap_set(ynl_cpp::ynl_socket&  ys, devlink_trap_set_req& req)
+{
+	auto ret = devlink_trap_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_set_prepare(ynl_cpp::ynl_socket&  ys, devlink_trap_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_SET, 1);
+	devlink_trap_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_trap_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return devlink_trap_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_trap_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_trap_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_trap_set_batch(ynl_cpp::msg_batch& batch, devlink_trap_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_TRAP_SET, 1);
+	devlink_trap_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_TRAP_GROUP_GET ============== */
@@ -4587,116 +7651,294 @@ int devlink_trap_group_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_TRAP_GROUP_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->trap_group_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->trap_group_name.assign(ynl_attr_get_str(attr));
 		}
 	}
 
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_trap_group_get_rsp>
-devlink_trap_group_get(ynl_cpp::ynl_socket&  ys,
-		       devlink_trap_group_get_req& req)
+static void
+devlink_trap_group_get_put(struct nlmsghdr *nlh,
+			   devlink_trap_group_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_trap_group_get_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GROUP_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
-
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.trap_group_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_TRAP_GROUP_NAME, req.trap_group_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_trap_group_get_rsp>>
+devlink_trap_group_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_trap_group_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
 
 	rsp.reset(new devlink_trap_group_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_trap_group_get_rsp_parse;
 	yrs.rsp_cmd = 67;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_trap_group_get_rsp>>
+devlink_trap_group_get_ex(ynl_cpp::ynl_socket&  ys,
+			  devlink_trap_group_get_req& req,
+			  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GROUP_GET, 1);
+	devlink_trap_group_get_put(nlh, req);
+
+	return devlink_trap_group_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_trap_group_get_rsp>
+devlink_trap_group_get(ynl_cpp::ynl_socket&  ys,
+		       devlink_trap_group_get_req& req)
+{
+	auto ret = devlink_trap_group_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_group_get_prepare(ynl_cpp::ynl_socket&  ys,
+			       devlink_trap_group_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GROUP_GET, 1);
+	devlink_trap_group_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_trap_group_get_rsp>>
+devlink_trap_group_get_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj)
+{
+	return devlink_trap_group_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_trap_group_get_rsp>
+devlink_trap_group_get(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_trap_group_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_TRAP_GROUP_GET - dump */
-std::unique_ptr<devlink_trap_group_get_list>
-devlink_trap_group_get_dump(ynl_cpp::ynl_socket&  ys,
-			    devlink_trap_group_get_req_dump& req)
+static void
+devlink_trap_group_get_dump_put(struct nlmsghdr *nlh,
+				devlink_trap_group_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_trap_group_get_list>>
+devlink_trap_group_get_dump_exec(ynl_cpp::ynl_socket&  ys,
+				 struct nlmsghdr *nlh,
+				 const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_trap_group_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_trap_group_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_trap_group_get_rsp_parse;
 	yds.rsp_cmd = 67;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GROUP_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ============== DEVLINK_CMD_TRAP_GROUP_SET ============== */
-/* DEVLINK_CMD_TRAP_GROUP_SET - do */
-int devlink_trap_group_set(ynl_cpp::ynl_socket&  ys,
-			   devlink_trap_group_set_req& req)
+ynl_cpp::result<std::unique_ptr<devlink_trap_group_get_list>>
+devlink_trap_group_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			       devlink_trap_group_get_req_dump& req,
+			       const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GROUP_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GROUP_GET, 1);
+	devlink_trap_group_get_dump_put(nlh, req);
+
+	return devlink_trap_group_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_trap_group_get_list>
+devlink_trap_group_get_dump(ynl_cpp::ynl_socket&  ys,
+			    devlink_trap_group_get_req_dump& req)
+{
+	auto ret = devlink_trap_group_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_group_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				    devlink_trap_group_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GROUP_GET, 1);
+	devlink_trap_group_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_trap_group_get_list>>
+devlink_trap_group_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl,
+			       const ynl_cpp::projection *proj)
+{
+	return devlink_trap_group_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_trap_group_get_list>
+devlink_trap_group_get_dump(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_trap_group_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_TRAP_GROUP_SET ============== */
+/* DEVLINK_CMD_TRAP_GROUP_SET - do */
+static void
+devlink_trap_group_set_put(struct nlmsghdr *nlh,
+			   devlink_trap_group_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.trap_action.has_value())
+		ynl_attr_put_u8_unchecked(nlh, DEVLINK_ATTR_TRAP_ACTION, req.trap_action.value());
+	if (req.trap_policer_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_TRAP_POLICER_ID, req.trap_policer_id.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.trap_group_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_TRAP_GROUP_NAME, req.trap_group_name.data());
-	if (req.trap_action.has_value())
-		ynl_attr_put_u8(nlh, DEVLINK_ATTR_TRAP_ACTION, req.trap_action.value());
-	if (req.trap_policer_id.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_TRAP_POLICER_ID, req.trap_policer_id.value());
+}
+
+static ynl_cpp::result<void>
+devlink_trap_group_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_trap_group_set_ex(ynl_cpp::ynl_socket&  ys,
+			  devlink_trap_group_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GROUP_SET, 1);
+	devlink_trap_group_set_put(nlh, req);
+
+	return devlink_trap_group_set_exec(ys, nlh);
+}
+
+int devlink_trap_group_set(ynl_cpp::ynl_socket&  ys,
+			   devlink_trap_group_set_req& req)
+{
+	auto ret = devlink_trap_group_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_group_set_prepare(ynl_cpp::ynl_socket&  ys,
+			       devlink_trap_group_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_GROUP_SET, 1);
+	devlink_trap_group_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_trap_group_set_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	return devlink_trap_group_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_trap_group_set(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_trap_group_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_trap_group_set_batch(ynl_cpp::msg_batch& batch,
+			     devlink_trap_group_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_TRAP_GROUP_SET, 1);
+	devlink_trap_group_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_TRAP_POLICER_GET ============== */
@@ -4712,17 +7954,20 @@ int devlink_trap_policer_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_TRAP_POLICER_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->trap_policer_id = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -4730,320 +7975,834 @@ int devlink_trap_policer_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_trap_policer_get_rsp>
-devlink_trap_policer_get(ynl_cpp::ynl_socket&  ys,
-			 devlink_trap_policer_get_req& req)
+static void
+devlink_trap_policer_get_put(struct nlmsghdr *nlh,
+			     devlink_trap_policer_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.trap_policer_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_TRAP_POLICER_ID, req.trap_policer_id.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_trap_policer_get_rsp>>
+devlink_trap_policer_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			      const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_trap_policer_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_POLICER_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.trap_policer_id.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_TRAP_POLICER_ID, req.trap_policer_id.value());
-
 	rsp.reset(new devlink_trap_policer_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_trap_policer_get_rsp_parse;
 	yrs.rsp_cmd = 71;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_trap_policer_get_rsp>>
+devlink_trap_policer_get_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_trap_policer_get_req& req,
+			    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_POLICER_GET, 1);
+	devlink_trap_policer_get_put(nlh, req);
+
+	return devlink_trap_policer_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_trap_policer_get_rsp>
+devlink_trap_policer_get(ynl_cpp::ynl_socket&  ys,
+			 devlink_trap_policer_get_req& req)
+{
+	auto ret = devlink_trap_policer_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_policer_get_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_trap_policer_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_POLICER_GET, 1);
+	devlink_trap_policer_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_trap_policer_get_rsp>>
+devlink_trap_policer_get_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl,
+			    const ynl_cpp::projection *proj)
+{
+	return devlink_trap_policer_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_trap_policer_get_rsp>
+devlink_trap_policer_get(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_trap_policer_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_TRAP_POLICER_GET - dump */
-std::unique_ptr<devlink_trap_policer_get_list>
-devlink_trap_policer_get_dump(ynl_cpp::ynl_socket&  ys,
-			      devlink_trap_policer_get_req_dump& req)
+static void
+devlink_trap_policer_get_dump_put(struct nlmsghdr *nlh,
+				  devlink_trap_policer_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_trap_policer_get_list>>
+devlink_trap_policer_get_dump_exec(ynl_cpp::ynl_socket&  ys,
+				   struct nlmsghdr *nlh,
+				   const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_trap_policer_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_trap_policer_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_trap_policer_get_rsp_parse;
 	yds.rsp_cmd = 71;
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_trap_policer_get_list>>
+devlink_trap_policer_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				 devlink_trap_policer_get_req_dump& req,
+				 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
 
 	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_POLICER_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	devlink_trap_policer_get_dump_put(nlh, req);
 
+	return devlink_trap_policer_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_trap_policer_get_list>
+devlink_trap_policer_get_dump(ynl_cpp::ynl_socket&  ys,
+			      devlink_trap_policer_get_req_dump& req)
+{
+	auto ret = devlink_trap_policer_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_policer_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				      devlink_trap_policer_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_POLICER_GET, 1);
+	devlink_trap_policer_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_trap_policer_get_list>>
+devlink_trap_policer_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				 ynl_cpp::request_template& tmpl,
+				 const ynl_cpp::projection *proj)
+{
+	return devlink_trap_policer_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_trap_policer_get_list>
+devlink_trap_policer_get_dump(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_trap_policer_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_TRAP_POLICER_SET ============== */
+/* DEVLINK_CMD_TRAP_POLICER_SET - do */
+static void
+devlink_trap_policer_set_put(struct nlmsghdr *nlh,
+			     devlink_trap_policer_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 32 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.trap_policer_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_TRAP_POLICER_ID, req.trap_policer_id.value());
+	if (req.trap_policer_rate.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DEVLINK_ATTR_TRAP_POLICER_RATE, req.trap_policer_rate.value());
+	if (req.trap_policer_burst.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DEVLINK_ATTR_TRAP_POLICER_BURST, req.trap_policer_burst.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
 
-	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+static ynl_cpp::result<void>
+devlink_trap_policer_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+
+	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return ret;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_trap_policer_set_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_trap_policer_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_POLICER_SET, 1);
+	devlink_trap_policer_set_put(nlh, req);
+
+	return devlink_trap_policer_set_exec(ys, nlh);
 }
 
-/* ============== DEVLINK_CMD_TRAP_POLICER_SET ============== */
-/* DEVLINK_CMD_TRAP_POLICER_SET - do */
 int devlink_trap_policer_set(ynl_cpp::ynl_socket&  ys,
 			     devlink_trap_policer_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	auto ret = devlink_trap_policer_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_policer_set_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_trap_policer_set_req& req)
+{
 	struct nlmsghdr *nlh;
-	int err;
 
 	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_TRAP_POLICER_SET, 1);
+	devlink_trap_policer_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_trap_policer_set_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl)
+{
+	return devlink_trap_policer_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_trap_policer_set(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_trap_policer_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_trap_policer_set_batch(ynl_cpp::msg_batch& batch,
+			       devlink_trap_policer_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_TRAP_POLICER_SET, 1);
+	devlink_trap_policer_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_HEALTH_REPORTER_TEST ============== */
+/* DEVLINK_CMD_HEALTH_REPORTER_TEST - do */
+static void
+devlink_health_reporter_test_put(struct nlmsghdr *nlh,
+				 devlink_health_reporter_test_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+	if (req.health_reporter_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_HEALTH_REPORTER_NAME, req.health_reporter_name.data());
+}
+
+static ynl_cpp::result<void>
+devlink_health_reporter_test_exec(ynl_cpp::ynl_socket&  ys,
+				  struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_health_reporter_test_ex(ynl_cpp::ynl_socket&  ys,
+				devlink_health_reporter_test_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_TEST, 1);
+	devlink_health_reporter_test_put(nlh, req);
+
+	return devlink_health_reporter_test_exec(ys, nlh);
+}
+
+int devlink_health_reporter_test(ynl_cpp::ynl_socket&  ys,
+				 devlink_health_reporter_test_req& req)
+{
+	auto ret = devlink_health_reporter_test_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_test_prepare(ynl_cpp::ynl_socket&  ys,
+				     devlink_health_reporter_test_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_TEST, 1);
+	devlink_health_reporter_test_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_health_reporter_test_ex(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl)
+{
+	return devlink_health_reporter_test_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_health_reporter_test(ynl_cpp::ynl_socket&  ys,
+				 ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_health_reporter_test_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_health_reporter_test_batch(ynl_cpp::msg_batch& batch,
+				   devlink_health_reporter_test_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_HEALTH_REPORTER_TEST, 1);
+	devlink_health_reporter_test_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_RATE_GET ============== */
+/* DEVLINK_CMD_RATE_GET - do */
+int devlink_rate_get_rsp_parse(const struct nlmsghdr *nlh,
+			       struct ynl_parse_arg *yarg)
+{
+	devlink_rate_get_rsp *dst;
+	const struct nlattr *attr;
+
+	dst = (devlink_rate_get_rsp*)yarg->data;
+
+	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == DEVLINK_ATTR_BUS_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
+		} else if (type == DEVLINK_ATTR_DEV_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
+		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->port_index = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == DEVLINK_ATTR_RATE_NODE_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->rate_node_name.assign(ynl_attr_get_str(attr));
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+devlink_rate_get_put(struct nlmsghdr *nlh, devlink_rate_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.trap_policer_id.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_TRAP_POLICER_ID, req.trap_policer_id.value());
-	if (req.trap_policer_rate.has_value())
-		ynl_attr_put_u64(nlh, DEVLINK_ATTR_TRAP_POLICER_RATE, req.trap_policer_rate.value());
-	if (req.trap_policer_burst.has_value())
-		ynl_attr_put_u64(nlh, DEVLINK_ATTR_TRAP_POLICER_BURST, req.trap_policer_burst.value());
+	if (req.rate_node_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_RATE_NODE_NAME, req.rate_node_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_rate_get_rsp>>
+devlink_rate_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<devlink_rate_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	yrs.yarg.rsp_policy = &devlink_nest;
+
+	rsp.reset(new devlink_rate_get_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = devlink_rate_get_rsp_parse;
+	yrs.rsp_cmd = 76;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_rate_get_rsp>>
+devlink_rate_get_ex(ynl_cpp::ynl_socket&  ys, devlink_rate_get_req& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_GET, 1);
+	devlink_rate_get_put(nlh, req);
+
+	return devlink_rate_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_rate_get_rsp>
+devlink_rate_get(ynl_cpp::ynl_socket&  ys, devlink_rate_get_req& req)
+{
+	auto ret = devlink_rate_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_rate_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_rate_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_GET, 1);
+	devlink_rate_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_rate_get_rsp>>
+devlink_rate_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return devlink_rate_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_rate_get_rsp>
+devlink_rate_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_rate_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* DEVLINK_CMD_RATE_GET - dump */
+static void
+devlink_rate_get_dump_put(struct nlmsghdr *nlh, devlink_rate_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_rate_get_list>>
+devlink_rate_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<devlink_rate_get_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &devlink_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_rate_get_list*>(arg)->objs.emplace_back());};
+	yds.cb = devlink_rate_get_rsp_parse;
+	yds.rsp_cmd = 76;
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_rate_get_list>>
+devlink_rate_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_rate_get_req_dump& req,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_GET, 1);
+	devlink_rate_get_dump_put(nlh, req);
+
+	return devlink_rate_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_rate_get_list>
+devlink_rate_get_dump(ynl_cpp::ynl_socket&  ys, devlink_rate_get_req_dump& req)
+{
+	auto ret = devlink_rate_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_rate_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_rate_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_GET, 1);
+	devlink_rate_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_rate_get_list>>
+devlink_rate_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return devlink_rate_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_rate_get_list>
+devlink_rate_get_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_rate_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_RATE_SET ============== */
+/* DEVLINK_CMD_RATE_SET - do */
+static void
+devlink_rate_set_put(struct nlmsghdr *nlh, devlink_rate_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 40 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.rate_tx_share.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DEVLINK_ATTR_RATE_TX_SHARE, req.rate_tx_share.value());
+	if (req.rate_tx_max.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DEVLINK_ATTR_RATE_TX_MAX, req.rate_tx_max.value());
+	if (req.rate_tx_priority.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_RATE_TX_PRIORITY, req.rate_tx_priority.value());
+	if (req.rate_tx_weight.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_RATE_TX_WEIGHT, req.rate_tx_weight.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+	if (req.rate_node_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_RATE_NODE_NAME, req.rate_node_name.data());
+	if (req.rate_parent_node_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_RATE_PARENT_NODE_NAME, req.rate_parent_node_name.data());
 }
 
-/* ============== DEVLINK_CMD_HEALTH_REPORTER_TEST ============== */
-/* DEVLINK_CMD_HEALTH_REPORTER_TEST - do */
-int devlink_health_reporter_test(ynl_cpp::ynl_socket&  ys,
-				 devlink_health_reporter_test_req& req)
+static ynl_cpp::result<void>
+devlink_rate_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_HEALTH_REPORTER_TEST, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
-	if (req.health_reporter_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_HEALTH_REPORTER_NAME, req.health_reporter_name.data());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
 }
 
-/* ============== DEVLINK_CMD_RATE_GET ============== */
-/* DEVLINK_CMD_RATE_GET - do */
-int devlink_rate_get_rsp_parse(const struct nlmsghdr *nlh,
-			       struct ynl_parse_arg *yarg)
+ynl_cpp::result<void>
+devlink_rate_set_ex(ynl_cpp::ynl_socket&  ys, devlink_rate_set_req& req)
 {
-	devlink_rate_get_rsp *dst;
-	const struct nlattr *attr;
+	struct nlmsghdr *nlh;
 
-	dst = (devlink_rate_get_rsp*)yarg->data;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_SET, 1);
+	devlink_rate_set_put(nlh, req);
 
-	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
-		unsigned int type = ynl_attr_type(attr);
+	return devlink_rate_set_exec(ys, nlh);
+}
 
-		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
-		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
-		} else if (type == DEVLINK_ATTR_PORT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->port_index = (__u32)ynl_attr_get_u32(attr);
-		} else if (type == DEVLINK_ATTR_RATE_NODE_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->rate_node_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
-		}
-	}
+int devlink_rate_set(ynl_cpp::ynl_socket&  ys, devlink_rate_set_req& req)
+{
+	auto ret = devlink_rate_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
 
-	return YNL_PARSE_CB_OK;
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_rate_set_prepare(ynl_cpp::ynl_socket&  ys, devlink_rate_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_SET, 1);
+	devlink_rate_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
 }
 
-std::unique_ptr<devlink_rate_get_rsp>
-devlink_rate_get(ynl_cpp::ynl_socket&  ys, devlink_rate_get_req& req)
+ynl_cpp::result<void>
+devlink_rate_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return devlink_rate_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_rate_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_rate_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_rate_set_batch(ynl_cpp::msg_batch& batch, devlink_rate_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<devlink_rate_get_rsp> rsp;
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
-	yrs.yarg.rsp_policy = &devlink_nest;
+	nlh = batch.gemsg_start(DEVLINK_CMD_RATE_SET, 1);
+	devlink_rate_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
+
+/* ============== DEVLINK_CMD_RATE_NEW ============== */
+/* DEVLINK_CMD_RATE_NEW - do */
+static void
+devlink_rate_new_put(struct nlmsghdr *nlh, devlink_rate_new_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 40 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.rate_tx_share.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DEVLINK_ATTR_RATE_TX_SHARE, req.rate_tx_share.value());
+	if (req.rate_tx_max.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DEVLINK_ATTR_RATE_TX_MAX, req.rate_tx_max.value());
+	if (req.rate_tx_priority.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_RATE_TX_PRIORITY, req.rate_tx_priority.value());
+	if (req.rate_tx_weight.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_RATE_TX_WEIGHT, req.rate_tx_weight.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.rate_node_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_RATE_NODE_NAME, req.rate_node_name.data());
+	if (req.rate_parent_node_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_RATE_PARENT_NODE_NAME, req.rate_parent_node_name.data());
+}
 
-	rsp.reset(new devlink_rate_get_rsp());
-	yrs.yarg.data = rsp.get();
-	yrs.cb = devlink_rate_get_rsp_parse;
-	yrs.rsp_cmd = 76;
+static ynl_cpp::result<void>
+devlink_rate_new_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return rsp;
+	return {};
 }
 
-/* DEVLINK_CMD_RATE_GET - dump */
-std::unique_ptr<devlink_rate_get_list>
-devlink_rate_get_dump(ynl_cpp::ynl_socket&  ys, devlink_rate_get_req_dump& req)
+ynl_cpp::result<void>
+devlink_rate_new_ex(ynl_cpp::ynl_socket&  ys, devlink_rate_new_req& req)
 {
-	struct ynl_dump_no_alloc_state yds = {};
 	struct nlmsghdr *nlh;
-	int err;
 
-	auto ret = std::make_unique<devlink_rate_get_list>();
-	yds.yarg.ys = ys;
-	yds.yarg.rsp_policy = &devlink_nest;
-	yds.yarg.data = ret.get();
-	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_rate_get_list*>(arg)->objs.emplace_back());};
-	yds.cb = devlink_rate_get_rsp_parse;
-	yds.rsp_cmd = 76;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_NEW, 1);
+	devlink_rate_new_put(nlh, req);
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	return devlink_rate_new_exec(ys, nlh);
+}
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+int devlink_rate_new(ynl_cpp::ynl_socket&  ys, devlink_rate_new_req& req)
+{
+	auto ret = devlink_rate_new_ex(ys, req);
+	return ret ? 0 : -1;
+}
 
-	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
-	if (err < 0)
-		return nullptr;
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_rate_new_prepare(ynl_cpp::ynl_socket&  ys, devlink_rate_new_req& req)
+{
+	struct nlmsghdr *nlh;
 
-	return ret;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_NEW, 1);
+	devlink_rate_new_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
 }
 
-/* ============== DEVLINK_CMD_RATE_SET ============== */
-/* DEVLINK_CMD_RATE_SET - do */
-int devlink_rate_set(ynl_cpp::ynl_socket&  ys, devlink_rate_set_req& req)
+ynl_cpp::result<void>
+devlink_rate_new_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return devlink_rate_new_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_rate_new(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_rate_new_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_rate_new_batch(ynl_cpp::msg_batch& batch, devlink_rate_new_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	nlh = batch.gemsg_start(DEVLINK_CMD_RATE_NEW, 1);
+	devlink_rate_new_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
+}
 
+/* ============== DEVLINK_CMD_RATE_DEL ============== */
+/* DEVLINK_CMD_RATE_DEL - do */
+static void
+devlink_rate_del_put(struct nlmsghdr *nlh, devlink_rate_del_req& req)
+{
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.rate_node_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_RATE_NODE_NAME, req.rate_node_name.data());
-	if (req.rate_tx_share.has_value())
-		ynl_attr_put_u64(nlh, DEVLINK_ATTR_RATE_TX_SHARE, req.rate_tx_share.value());
-	if (req.rate_tx_max.has_value())
-		ynl_attr_put_u64(nlh, DEVLINK_ATTR_RATE_TX_MAX, req.rate_tx_max.value());
-	if (req.rate_tx_priority.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_RATE_TX_PRIORITY, req.rate_tx_priority.value());
-	if (req.rate_tx_weight.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_RATE_TX_WEIGHT, req.rate_tx_weight.value());
-	if (req.rate_parent_node_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_RATE_PARENT_NODE_NAME, req.rate_parent_node_name.data());
-
-	err = ynl_exec(ys, nlh, &yrs);
-	if (err < 0)
-		return -1;
-
-	return 0;
 }
 
-/* ============== DEVLINK_CMD_RATE_NEW ============== */
-/* DEVLINK_CMD_RATE_NEW - do */
-int devlink_rate_new(ynl_cpp::ynl_socket&  ys, devlink_rate_new_req& req)
+static ynl_cpp::result<void>
+devlink_rate_del_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_NEW, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.rate_node_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_RATE_NODE_NAME, req.rate_node_name.data());
-	if (req.rate_tx_share.has_value())
-		ynl_attr_put_u64(nlh, DEVLINK_ATTR_RATE_TX_SHARE, req.rate_tx_share.value());
-	if (req.rate_tx_max.has_value())
-		ynl_attr_put_u64(nlh, DEVLINK_ATTR_RATE_TX_MAX, req.rate_tx_max.value());
-	if (req.rate_tx_priority.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_RATE_TX_PRIORITY, req.rate_tx_priority.value());
-	if (req.rate_tx_weight.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_RATE_TX_WEIGHT, req.rate_tx_weight.value());
-	if (req.rate_parent_node_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_RATE_PARENT_NODE_NAME, req.rate_parent_node_name.data());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_rate_del_ex(ynl_cpp::ynl_socket&  ys, devlink_rate_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_DEL, 1);
+	devlink_rate_del_put(nlh, req);
+
+	return devlink_rate_del_exec(ys, nlh);
 }
 
-/* ============== DEVLINK_CMD_RATE_DEL ============== */
-/* DEVLINK_CMD_RATE_DEL - do */
 int devlink_rate_del(ynl_cpp::ynl_socket&  ys, devlink_rate_del_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	auto ret = devlink_rate_del_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_rate_del_prepare(ynl_cpp::ynl_socket&  ys, devlink_rate_del_req& req)
+{
 	struct nlmsghdr *nlh;
-	int err;
 
 	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_RATE_DEL, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	devlink_rate_del_put(nlh, req);
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.rate_node_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_RATE_NODE_NAME, req.rate_node_name.data());
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
 
-	err = ynl_exec(ys, nlh, &yrs);
-	if (err < 0)
-		return -1;
+ynl_cpp::result<void>
+devlink_rate_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return devlink_rate_del_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
 
-	return 0;
+int devlink_rate_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_rate_del_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_rate_del_batch(ynl_cpp::msg_batch& batch, devlink_rate_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_RATE_DEL, 1);
+	devlink_rate_del_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_LINECARD_GET ============== */
@@ -5059,17 +8818,20 @@ int devlink_linecard_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_LINECARD_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->linecard_index = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -5077,95 +8839,268 @@ int devlink_linecard_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_linecard_get_rsp>
-devlink_linecard_get(ynl_cpp::ynl_socket&  ys, devlink_linecard_get_req& req)
+static void
+devlink_linecard_get_put(struct nlmsghdr *nlh, devlink_linecard_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.linecard_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_LINECARD_INDEX, req.linecard_index.value());
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_linecard_get_rsp>>
+devlink_linecard_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_linecard_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_LINECARD_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.linecard_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_LINECARD_INDEX, req.linecard_index.value());
-
 	rsp.reset(new devlink_linecard_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_linecard_get_rsp_parse;
 	yrs.rsp_cmd = 80;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* DEVLINK_CMD_LINECARD_GET - dump */
-std::unique_ptr<devlink_linecard_get_list>
-devlink_linecard_get_dump(ynl_cpp::ynl_socket&  ys,
-			  devlink_linecard_get_req_dump& req)
+ynl_cpp::result<std::unique_ptr<devlink_linecard_get_rsp>>
+devlink_linecard_get_ex(ynl_cpp::ynl_socket&  ys,
+			devlink_linecard_get_req& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_LINECARD_GET, 1);
+	devlink_linecard_get_put(nlh, req);
+
+	return devlink_linecard_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_linecard_get_rsp>
+devlink_linecard_get(ynl_cpp::ynl_socket&  ys, devlink_linecard_get_req& req)
+{
+	auto ret = devlink_linecard_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_linecard_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     devlink_linecard_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_LINECARD_GET, 1);
+	devlink_linecard_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_linecard_get_rsp>>
+devlink_linecard_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return devlink_linecard_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_linecard_get_rsp>
+devlink_linecard_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_linecard_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* DEVLINK_CMD_LINECARD_GET - dump */
+static void
+devlink_linecard_get_dump_put(struct nlmsghdr *nlh,
+			      devlink_linecard_get_req_dump& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_linecard_get_list>>
+devlink_linecard_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_linecard_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_linecard_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_linecard_get_rsp_parse;
 	yds.rsp_cmd = 80;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_LINECARD_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ============== DEVLINK_CMD_LINECARD_SET ============== */
-/* DEVLINK_CMD_LINECARD_SET - do */
-int devlink_linecard_set(ynl_cpp::ynl_socket&  ys,
-			 devlink_linecard_set_req& req)
+ynl_cpp::result<std::unique_ptr<devlink_linecard_get_list>>
+devlink_linecard_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     devlink_linecard_get_req_dump& req,
+			     const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_LINECARD_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_LINECARD_GET, 1);
+	devlink_linecard_get_dump_put(nlh, req);
+
+	return devlink_linecard_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_linecard_get_list>
+devlink_linecard_get_dump(ynl_cpp::ynl_socket&  ys,
+			  devlink_linecard_get_req_dump& req)
+{
+	auto ret = devlink_linecard_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_linecard_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  devlink_linecard_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_LINECARD_GET, 1);
+	devlink_linecard_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_linecard_get_list>>
+devlink_linecard_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return devlink_linecard_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_linecard_get_list>
+devlink_linecard_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_linecard_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_LINECARD_SET ============== */
+/* DEVLINK_CMD_LINECARD_SET - do */
+static void
+devlink_linecard_set_put(struct nlmsghdr *nlh, devlink_linecard_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.linecard_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_LINECARD_INDEX, req.linecard_index.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.linecard_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_LINECARD_INDEX, req.linecard_index.value());
 	if (req.linecard_type.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_LINECARD_TYPE, req.linecard_type.data());
+}
+
+static ynl_cpp::result<void>
+devlink_linecard_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_linecard_set_ex(ynl_cpp::ynl_socket&  ys,
+			devlink_linecard_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_LINECARD_SET, 1);
+	devlink_linecard_set_put(nlh, req);
+
+	return devlink_linecard_set_exec(ys, nlh);
+}
+
+int devlink_linecard_set(ynl_cpp::ynl_socket&  ys,
+			 devlink_linecard_set_req& req)
+{
+	auto ret = devlink_linecard_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_linecard_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     devlink_linecard_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_LINECARD_SET, 1);
+	devlink_linecard_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_linecard_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	return devlink_linecard_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_linecard_set(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_linecard_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_linecard_set_batch(ynl_cpp::msg_batch& batch,
+			   devlink_linecard_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_LINECARD_SET, 1);
+	devlink_linecard_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_SELFTESTS_GET ============== */
@@ -5181,124 +9116,321 @@ int devlink_selftests_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DEVLINK_ATTR_BUS_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->bus_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->bus_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DEVLINK_ATTR_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		}
 	}
 
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<devlink_selftests_get_rsp>
-devlink_selftests_get(ynl_cpp::ynl_socket&  ys, devlink_selftests_get_req& req)
+static void
+devlink_selftests_get_put(struct nlmsghdr *nlh, devlink_selftests_get_req& req)
+{
+	if (req.bus_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
+	if (req.dev_name.size() > 0)
+		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<devlink_selftests_get_rsp>>
+devlink_selftests_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<devlink_selftests_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SELFTESTS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 	yrs.yarg.rsp_policy = &devlink_nest;
 
-	if (req.bus_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
-	if (req.dev_name.size() > 0)
-		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-
 	rsp.reset(new devlink_selftests_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = devlink_selftests_get_rsp_parse;
 	yrs.rsp_cmd = DEVLINK_CMD_SELFTESTS_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<devlink_selftests_get_rsp>>
+devlink_selftests_get_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_selftests_get_req& req,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SELFTESTS_GET, 1);
+	devlink_selftests_get_put(nlh, req);
+
+	return devlink_selftests_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<devlink_selftests_get_rsp>
+devlink_selftests_get(ynl_cpp::ynl_socket&  ys, devlink_selftests_get_req& req)
+{
+	auto ret = devlink_selftests_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_selftests_get_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_selftests_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SELFTESTS_GET, 1);
+	devlink_selftests_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<devlink_selftests_get_rsp>>
+devlink_selftests_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return devlink_selftests_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<devlink_selftests_get_rsp>
+devlink_selftests_get(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_selftests_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DEVLINK_CMD_SELFTESTS_GET - dump */
-std::unique_ptr<devlink_selftests_get_list>
-devlink_selftests_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<devlink_selftests_get_list>>
+devlink_selftests_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+				const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<devlink_selftests_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &devlink_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<devlink_selftests_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = devlink_selftests_get_rsp_parse;
 	yds.rsp_cmd = DEVLINK_CMD_SELFTESTS_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SELFTESTS_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ============== DEVLINK_CMD_SELFTESTS_RUN ============== */
-/* DEVLINK_CMD_SELFTESTS_RUN - do */
-int devlink_selftests_run(ynl_cpp::ynl_socket&  ys,
-			  devlink_selftests_run_req& req)
+ynl_cpp::result<std::unique_ptr<devlink_selftests_get_list>>
+devlink_selftests_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SELFTESTS_RUN, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SELFTESTS_GET, 1);
+
+	return devlink_selftests_get_dump_exec(ys, nlh, proj);
+}
 
+std::unique_ptr<devlink_selftests_get_list>
+devlink_selftests_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = devlink_selftests_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DEVLINK_CMD_SELFTESTS_RUN ============== */
+/* DEVLINK_CMD_SELFTESTS_RUN - do */
+static void
+devlink_selftests_run_put(struct nlmsghdr *nlh, devlink_selftests_run_req& req)
+{
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
 	if (req.selftests.has_value())
 		devlink_dl_selftest_id_put(nlh, DEVLINK_ATTR_SELFTESTS, req.selftests.value());
+}
+
+static ynl_cpp::result<void>
+devlink_selftests_run_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_selftests_run_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_selftests_run_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SELFTESTS_RUN, 1);
+	devlink_selftests_run_put(nlh, req);
+
+	return devlink_selftests_run_exec(ys, nlh);
+}
+
+int devlink_selftests_run(ynl_cpp::ynl_socket&  ys,
+			  devlink_selftests_run_req& req)
+{
+	auto ret = devlink_selftests_run_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_selftests_run_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_selftests_run_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_SELFTESTS_RUN, 1);
+	devlink_selftests_run_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_selftests_run_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	return devlink_selftests_run_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_selftests_run(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_selftests_run_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_selftests_run_batch(ynl_cpp::msg_batch& batch,
+			    devlink_selftests_run_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_SELFTESTS_RUN, 1);
+	devlink_selftests_run_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 /* ============== DEVLINK_CMD_NOTIFY_FILTER_SET ============== */
 /* DEVLINK_CMD_NOTIFY_FILTER_SET - do */
-int devlink_notify_filter_set(ynl_cpp::ynl_socket&  ys,
+static void
+devlink_notify_filter_set_put(struct nlmsghdr *nlh,
 			      devlink_notify_filter_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_NOTIFY_FILTER_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.port_index.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
 	if (req.bus_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_BUS_NAME, req.bus_name.data());
 	if (req.dev_name.size() > 0)
 		ynl_attr_put_str(nlh, DEVLINK_ATTR_DEV_NAME, req.dev_name.data());
-	if (req.port_index.has_value())
-		ynl_attr_put_u32(nlh, DEVLINK_ATTR_PORT_INDEX, req.port_index.value());
+}
+
+static ynl_cpp::result<void>
+devlink_notify_filter_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &devlink_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+devlink_notify_filter_set_ex(ynl_cpp::ynl_socket&  ys,
+			     devlink_notify_filter_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_NOTIFY_FILTER_SET, 1);
+	devlink_notify_filter_set_put(nlh, req);
+
+	return devlink_notify_filter_set_exec(ys, nlh);
+}
+
+int devlink_notify_filter_set(ynl_cpp::ynl_socket&  ys,
+			      devlink_notify_filter_set_req& req)
+{
+	auto ret = devlink_notify_filter_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_notify_filter_set_prepare(ynl_cpp::ynl_socket&  ys,
+				  devlink_notify_filter_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DEVLINK_CMD_NOTIFY_FILTER_SET, 1);
+	devlink_notify_filter_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+devlink_notify_filter_set_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl)
+{
+	return devlink_notify_filter_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int devlink_notify_filter_set(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl)
+{
+	auto ret = devlink_notify_filter_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+devlink_notify_filter_set_batch(ynl_cpp::msg_batch& batch,
+				devlink_notify_filter_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DEVLINK_CMD_NOTIFY_FILTER_SET, 1);
+	devlink_notify_filter_set_put(nlh, req);
+	return batch.msg_end(nlh, &devlink_nest);
 }
 
 const struct ynl_family ynl_devlink_family =  {
@@ -262,6 +262,49 @@ struct devlink_dl_dev_stats {
 	std::optional<devlink_dl_reload_stats> remote_reload_stats;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest devlink_dl_dpipe_match_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_match_value_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_action_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_action_value_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_field_nest;
+extern struct ynl_policy_nest devlink_dl_resource_nest;
+extern struct ynl_policy_nest devlink_dl_param_nest;
+extern struct ynl_policy_nest devlink_dl_region_snapshot_nest;
+extern struct ynl_policy_nest devlink_dl_region_chunk_nest;
+extern struct ynl_policy_nest devlink_dl_info_version_nest;
+extern struct ynl_policy_nest devlink_dl_fmsg_nest;
+extern struct ynl_policy_nest devlink_dl_health_reporter_nest;
+extern struct ynl_policy_nest devlink_dl_attr_stats_nest;
+extern struct ynl_policy_nest devlink_dl_trap_metadata_nest;
+extern struct ynl_policy_nest devlink_dl_port_function_nest;
+extern struct ynl_policy_nest devlink_dl_reload_stats_entry_nest;
+extern struct ynl_policy_nest devlink_dl_reload_act_stats_nest;
+extern struct ynl_policy_nest devlink_dl_linecard_supported_types_nest;
+extern struct ynl_policy_nest devlink_dl_selftest_id_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_table_matches_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_table_actions_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_entry_match_values_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_entry_action_values_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_header_fields_nest;
+extern struct ynl_policy_nest devlink_dl_resource_list_nest;
+extern struct ynl_policy_nest devlink_dl_region_snapshots_nest;
+extern struct ynl_policy_nest devlink_dl_region_chunks_nest;
+extern struct ynl_policy_nest devlink_dl_reload_act_info_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_table_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_entry_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_header_nest;
+extern struct ynl_policy_nest devlink_dl_reload_stats_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_tables_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_entries_nest;
+extern struct ynl_policy_nest devlink_dl_dpipe_headers_nest;
+extern struct ynl_policy_nest devlink_dl_dev_stats_nest;
+extern struct ynl_policy_nest devlink_nest;
+int devlink_dl_port_function_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				 const devlink_dl_port_function&  obj);
+int devlink_dl_selftest_id_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const devlink_dl_selftest_id&  obj);
+
 /* ============== DEVLINK_CMD_GET ============== */
 /* DEVLINK_CMD_GET - do */
 struct devlink_get_req {
@@ -281,6 +324,16 @@ struct devlink_get_rsp {
  */
 std::unique_ptr<devlink_get_rsp>
 devlink_get(ynl_cpp::ynl_socket&  ys, devlink_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_get_rsp>>
+devlink_get_ex(ynl_cpp::ynl_socket&  ys, devlink_get_req& req,
+	       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_get_req& req);
+std::unique_ptr<devlink_get_rsp>
+devlink_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_get_rsp>>
+devlink_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	       const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_GET - dump */
 struct devlink_get_list {
@@ -288,6 +341,9 @@ struct devlink_get_list {
 };
 
 std::unique_ptr<devlink_get_list> devlink_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<devlink_get_list>>
+devlink_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_PORT_GET ============== */
 /* DEVLINK_CMD_PORT_GET - do */
@@ -308,6 +364,16 @@ struct devlink_port_get_rsp {
  */
 std::unique_ptr<devlink_port_get_rsp>
 devlink_port_get(ynl_cpp::ynl_socket&  ys, devlink_port_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_port_get_rsp>>
+devlink_port_get_ex(ynl_cpp::ynl_socket&  ys, devlink_port_get_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_port_get_req& req);
+std::unique_ptr<devlink_port_get_rsp>
+devlink_port_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_port_get_rsp>>
+devlink_port_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_PORT_GET - dump */
 struct devlink_port_get_req_dump {
@@ -315,18 +381,26 @@ struct devlink_port_get_req_dump {
 	std::string dev_name;
 };
 
-struct devlink_port_get_rsp_dump {
-	std::string bus_name;
-	std::string dev_name;
-	std::optional<__u32> port_index;
+struct devlink_port_get_list {
+	std::list<devlink_port_get_rsp> objs;
 };
 
-struct devlink_port_get_rsp_list {
-	std::list<devlink_port_get_rsp_dump> objs;
-};
-
-std::unique_ptr<devlink_port_get_rsp_list>
+std::unique_ptr<devlink_port_get_list>
 devlink_port_get_dump(ynl_cpp::ynl_socket&  ys, devlink_port_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_port_get_list>>
+devlink_port_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_port_get_req_dump& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_port_get_req_dump& req);
+std::unique_ptr<devlink_port_get_list>
+devlink_port_get_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_port_get_list>>
+devlink_port_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_PORT_SET ============== */
 /* DEVLINK_CMD_PORT_SET - do */
@@ -342,6 +416,15 @@ struct devlink_port_set_req {
  * Set devlink port instances.
  */
 int devlink_port_set(ynl_cpp::ynl_socket&  ys, devlink_port_set_req& req);
+ynl_cpp::result<void>
+devlink_port_set_ex(ynl_cpp::ynl_socket&  ys, devlink_port_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_set_prepare(ynl_cpp::ynl_socket&  ys, devlink_port_set_req& req);
+int devlink_port_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_port_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_port_set_batch(ynl_cpp::msg_batch& batch, devlink_port_set_req& req);
 
 /* ============== DEVLINK_CMD_PORT_NEW ============== */
 /* DEVLINK_CMD_PORT_NEW - do */
@@ -366,6 +449,16 @@ struct devlink_port_new_rsp {
  */
 std::unique_ptr<devlink_port_new_rsp>
 devlink_port_new(ynl_cpp::ynl_socket&  ys, devlink_port_new_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_port_new_rsp>>
+devlink_port_new_ex(ynl_cpp::ynl_socket&  ys, devlink_port_new_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_new_prepare(ynl_cpp::ynl_socket&  ys, devlink_port_new_req& req);
+std::unique_ptr<devlink_port_new_rsp>
+devlink_port_new(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_port_new_rsp>>
+devlink_port_new_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_PORT_DEL ============== */
 /* DEVLINK_CMD_PORT_DEL - do */
@@ -379,6 +472,15 @@ struct devlink_port_del_req {
  * Delete devlink port instances.
  */
 int devlink_port_del(ynl_cpp::ynl_socket&  ys, devlink_port_del_req& req);
+ynl_cpp::result<void>
+devlink_port_del_ex(ynl_cpp::ynl_socket&  ys, devlink_port_del_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_del_prepare(ynl_cpp::ynl_socket&  ys, devlink_port_del_req& req);
+int devlink_port_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_port_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_port_del_batch(ynl_cpp::msg_batch& batch, devlink_port_del_req& req);
 
 /* ============== DEVLINK_CMD_PORT_SPLIT ============== */
 /* DEVLINK_CMD_PORT_SPLIT - do */
@@ -393,6 +495,19 @@ struct devlink_port_split_req {
  * Split devlink port instances.
  */
 int devlink_port_split(ynl_cpp::ynl_socket&  ys, devlink_port_split_req& req);
+ynl_cpp::result<void>
+devlink_port_split_ex(ynl_cpp::ynl_socket&  ys, devlink_port_split_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_split_prepare(ynl_cpp::ynl_socket&  ys,
+			   devlink_port_split_req& req);
+int devlink_port_split(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_port_split_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_port_split_batch(ynl_cpp::msg_batch& batch,
+			 devlink_port_split_req& req);
 
 /* ============== DEVLINK_CMD_PORT_UNSPLIT ============== */
 /* DEVLINK_CMD_PORT_UNSPLIT - do */
@@ -407,6 +522,20 @@ struct devlink_port_unsplit_req {
  */
 int devlink_port_unsplit(ynl_cpp::ynl_socket&  ys,
 			 devlink_port_unsplit_req& req);
+ynl_cpp::result<void>
+devlink_port_unsplit_ex(ynl_cpp::ynl_socket&  ys,
+			devlink_port_unsplit_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_unsplit_prepare(ynl_cpp::ynl_socket&  ys,
+			     devlink_port_unsplit_req& req);
+int devlink_port_unsplit(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_port_unsplit_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_port_unsplit_batch(ynl_cpp::msg_batch& batch,
+			   devlink_port_unsplit_req& req);
 
 /* ============== DEVLINK_CMD_SB_GET ============== */
 /* DEVLINK_CMD_SB_GET - do */
@@ -427,6 +556,16 @@ struct devlink_sb_get_rsp {
  */
 std::unique_ptr<devlink_sb_get_rsp>
 devlink_sb_get(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_sb_get_rsp>>
+devlink_sb_get_ex(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req& req,
+		  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req& req);
+std::unique_ptr<devlink_sb_get_rsp>
+devlink_sb_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_sb_get_rsp>>
+devlink_sb_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_SB_GET - dump */
 struct devlink_sb_get_req_dump {
@@ -440,6 +579,18 @@ struct devlink_sb_get_list {
 
 std::unique_ptr<devlink_sb_get_list>
 devlink_sb_get_dump(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_sb_get_list>>
+devlink_sb_get_dump_ex(ynl_cpp::ynl_socket&  ys, devlink_sb_get_req_dump& req,
+		       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_get_req_dump& req);
+std::unique_ptr<devlink_sb_get_list>
+devlink_sb_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_sb_get_list>>
+devlink_sb_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_SB_POOL_GET ============== */
 /* DEVLINK_CMD_SB_POOL_GET - do */
@@ -462,6 +613,18 @@ struct devlink_sb_pool_get_rsp {
  */
 std::unique_ptr<devlink_sb_pool_get_rsp>
 devlink_sb_pool_get(ynl_cpp::ynl_socket&  ys, devlink_sb_pool_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_sb_pool_get_rsp>>
+devlink_sb_pool_get_ex(ynl_cpp::ynl_socket&  ys, devlink_sb_pool_get_req& req,
+		       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_pool_get_prepare(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_pool_get_req& req);
+std::unique_ptr<devlink_sb_pool_get_rsp>
+devlink_sb_pool_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_sb_pool_get_rsp>>
+devlink_sb_pool_get_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_SB_POOL_GET - dump */
 struct devlink_sb_pool_get_req_dump {
@@ -476,6 +639,20 @@ struct devlink_sb_pool_get_list {
 std::unique_ptr<devlink_sb_pool_get_list>
 devlink_sb_pool_get_dump(ynl_cpp::ynl_socket&  ys,
 			 devlink_sb_pool_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_sb_pool_get_list>>
+devlink_sb_pool_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_pool_get_req_dump& req,
+			    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_pool_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_sb_pool_get_req_dump& req);
+std::unique_ptr<devlink_sb_pool_get_list>
+devlink_sb_pool_get_dump(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_sb_pool_get_list>>
+devlink_sb_pool_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl,
+			    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_SB_POOL_SET ============== */
 /* DEVLINK_CMD_SB_POOL_SET - do */
@@ -492,6 +669,19 @@ struct devlink_sb_pool_set_req {
  * Set shared buffer pool instances.
  */
 int devlink_sb_pool_set(ynl_cpp::ynl_socket&  ys, devlink_sb_pool_set_req& req);
+ynl_cpp::result<void>
+devlink_sb_pool_set_ex(ynl_cpp::ynl_socket&  ys, devlink_sb_pool_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_pool_set_prepare(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_pool_set_req& req);
+int devlink_sb_pool_set(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_sb_pool_set_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_sb_pool_set_batch(ynl_cpp::msg_batch& batch,
+			  devlink_sb_pool_set_req& req);
 
 /* ============== DEVLINK_CMD_SB_PORT_POOL_GET ============== */
 /* DEVLINK_CMD_SB_PORT_POOL_GET - do */
@@ -517,6 +707,20 @@ struct devlink_sb_port_pool_get_rsp {
 std::unique_ptr<devlink_sb_port_pool_get_rsp>
 devlink_sb_port_pool_get(ynl_cpp::ynl_socket&  ys,
 			 devlink_sb_port_pool_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_sb_port_pool_get_rsp>>
+devlink_sb_port_pool_get_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_port_pool_get_req& req,
+			    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_port_pool_get_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_sb_port_pool_get_req& req);
+std::unique_ptr<devlink_sb_port_pool_get_rsp>
+devlink_sb_port_pool_get(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_sb_port_pool_get_rsp>>
+devlink_sb_port_pool_get_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl,
+			    const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_SB_PORT_POOL_GET - dump */
 struct devlink_sb_port_pool_get_req_dump {
@@ -531,6 +735,20 @@ struct devlink_sb_port_pool_get_list {
 std::unique_ptr<devlink_sb_port_pool_get_list>
 devlink_sb_port_pool_get_dump(ynl_cpp::ynl_socket&  ys,
 			      devlink_sb_port_pool_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_sb_port_pool_get_list>>
+devlink_sb_port_pool_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				 devlink_sb_port_pool_get_req_dump& req,
+				 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_port_pool_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				      devlink_sb_port_pool_get_req_dump& req);
+std::unique_ptr<devlink_sb_port_pool_get_list>
+devlink_sb_port_pool_get_dump(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_sb_port_pool_get_list>>
+devlink_sb_port_pool_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				 ynl_cpp::request_template& tmpl,
+				 const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_SB_PORT_POOL_SET ============== */
 /* DEVLINK_CMD_SB_PORT_POOL_SET - do */
@@ -548,6 +766,20 @@ struct devlink_sb_port_pool_set_req {
  */
 int devlink_sb_port_pool_set(ynl_cpp::ynl_socket&  ys,
 			     devlink_sb_port_pool_set_req& req);
+ynl_cpp::result<void>
+devlink_sb_port_pool_set_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_port_pool_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_port_pool_set_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_sb_port_pool_set_req& req);
+int devlink_sb_port_pool_set(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_sb_port_pool_set_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_sb_port_pool_set_batch(ynl_cpp::msg_batch& batch,
+			       devlink_sb_port_pool_set_req& req);
 
 /* ============== DEVLINK_CMD_SB_TC_POOL_BIND_GET ============== */
 /* DEVLINK_CMD_SB_TC_POOL_BIND_GET - do */
@@ -575,6 +807,20 @@ struct devlink_sb_tc_pool_bind_get_rsp {
 std::unique_ptr<devlink_sb_tc_pool_bind_get_rsp>
 devlink_sb_tc_pool_bind_get(ynl_cpp::ynl_socket&  ys,
 			    devlink_sb_tc_pool_bind_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_sb_tc_pool_bind_get_rsp>>
+devlink_sb_tc_pool_bind_get_ex(ynl_cpp::ynl_socket&  ys,
+			       devlink_sb_tc_pool_bind_get_req& req,
+			       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_tc_pool_bind_get_prepare(ynl_cpp::ynl_socket&  ys,
+				    devlink_sb_tc_pool_bind_get_req& req);
+std::unique_ptr<devlink_sb_tc_pool_bind_get_rsp>
+devlink_sb_tc_pool_bind_get(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_sb_tc_pool_bind_get_rsp>>
+devlink_sb_tc_pool_bind_get_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl,
+			       const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_SB_TC_POOL_BIND_GET - dump */
 struct devlink_sb_tc_pool_bind_get_req_dump {
@@ -589,6 +835,20 @@ struct devlink_sb_tc_pool_bind_get_list {
 std::unique_ptr<devlink_sb_tc_pool_bind_get_list>
 devlink_sb_tc_pool_bind_get_dump(ynl_cpp::ynl_socket&  ys,
 				 devlink_sb_tc_pool_bind_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_sb_tc_pool_bind_get_list>>
+devlink_sb_tc_pool_bind_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				    devlink_sb_tc_pool_bind_get_req_dump& req,
+				    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_tc_pool_bind_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+					 devlink_sb_tc_pool_bind_get_req_dump& req);
+std::unique_ptr<devlink_sb_tc_pool_bind_get_list>
+devlink_sb_tc_pool_bind_get_dump(ynl_cpp::ynl_socket&  ys,
+				 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_sb_tc_pool_bind_get_list>>
+devlink_sb_tc_pool_bind_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				    ynl_cpp::request_template& tmpl,
+				    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_SB_TC_POOL_BIND_SET ============== */
 /* DEVLINK_CMD_SB_TC_POOL_BIND_SET - do */
@@ -608,6 +868,20 @@ struct devlink_sb_tc_pool_bind_set_req {
  */
 int devlink_sb_tc_pool_bind_set(ynl_cpp::ynl_socket&  ys,
 				devlink_sb_tc_pool_bind_set_req& req);
+ynl_cpp::result<void>
+devlink_sb_tc_pool_bind_set_ex(ynl_cpp::ynl_socket&  ys,
+			       devlink_sb_tc_pool_bind_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_tc_pool_bind_set_prepare(ynl_cpp::ynl_socket&  ys,
+				    devlink_sb_tc_pool_bind_set_req& req);
+int devlink_sb_tc_pool_bind_set(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_sb_tc_pool_bind_set_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_sb_tc_pool_bind_set_batch(ynl_cpp::msg_batch& batch,
+				  devlink_sb_tc_pool_bind_set_req& req);
 
 /* ============== DEVLINK_CMD_SB_OCC_SNAPSHOT ============== */
 /* DEVLINK_CMD_SB_OCC_SNAPSHOT - do */
@@ -622,6 +896,20 @@ struct devlink_sb_occ_snapshot_req {
  */
 int devlink_sb_occ_snapshot(ynl_cpp::ynl_socket&  ys,
 			    devlink_sb_occ_snapshot_req& req);
+ynl_cpp::result<void>
+devlink_sb_occ_snapshot_ex(ynl_cpp::ynl_socket&  ys,
+			   devlink_sb_occ_snapshot_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_occ_snapshot_prepare(ynl_cpp::ynl_socket&  ys,
+				devlink_sb_occ_snapshot_req& req);
+int devlink_sb_occ_snapshot(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_sb_occ_snapshot_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_sb_occ_snapshot_batch(ynl_cpp::msg_batch& batch,
+			      devlink_sb_occ_snapshot_req& req);
 
 /* ============== DEVLINK_CMD_SB_OCC_MAX_CLEAR ============== */
 /* DEVLINK_CMD_SB_OCC_MAX_CLEAR - do */
@@ -636,6 +924,20 @@ struct devlink_sb_occ_max_clear_req {
  */
 int devlink_sb_occ_max_clear(ynl_cpp::ynl_socket&  ys,
 			     devlink_sb_occ_max_clear_req& req);
+ynl_cpp::result<void>
+devlink_sb_occ_max_clear_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_sb_occ_max_clear_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_sb_occ_max_clear_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_sb_occ_max_clear_req& req);
+int devlink_sb_occ_max_clear(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_sb_occ_max_clear_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_sb_occ_max_clear_batch(ynl_cpp::msg_batch& batch,
+			       devlink_sb_occ_max_clear_req& req);
 
 /* ============== DEVLINK_CMD_ESWITCH_GET ============== */
 /* DEVLINK_CMD_ESWITCH_GET - do */
@@ -657,6 +959,18 @@ struct devlink_eswitch_get_rsp {
  */
 std::unique_ptr<devlink_eswitch_get_rsp>
 devlink_eswitch_get(ynl_cpp::ynl_socket&  ys, devlink_eswitch_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_eswitch_get_rsp>>
+devlink_eswitch_get_ex(ynl_cpp::ynl_socket&  ys, devlink_eswitch_get_req& req,
+		       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_eswitch_get_prepare(ynl_cpp::ynl_socket&  ys,
+			    devlink_eswitch_get_req& req);
+std::unique_ptr<devlink_eswitch_get_rsp>
+devlink_eswitch_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_eswitch_get_rsp>>
+devlink_eswitch_get_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_ESWITCH_SET ============== */
 /* DEVLINK_CMD_ESWITCH_SET - do */
@@ -672,6 +986,19 @@ struct devlink_eswitch_set_req {
  * Set eswitch attributes.
  */
 int devlink_eswitch_set(ynl_cpp::ynl_socket&  ys, devlink_eswitch_set_req& req);
+ynl_cpp::result<void>
+devlink_eswitch_set_ex(ynl_cpp::ynl_socket&  ys, devlink_eswitch_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_eswitch_set_prepare(ynl_cpp::ynl_socket&  ys,
+			    devlink_eswitch_set_req& req);
+int devlink_eswitch_set(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_eswitch_set_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_eswitch_set_batch(ynl_cpp::msg_batch& batch,
+			  devlink_eswitch_set_req& req);
 
 /* ============== DEVLINK_CMD_DPIPE_TABLE_GET ============== */
 /* DEVLINK_CMD_DPIPE_TABLE_GET - do */
@@ -693,6 +1020,20 @@ struct devlink_dpipe_table_get_rsp {
 std::unique_ptr<devlink_dpipe_table_get_rsp>
 devlink_dpipe_table_get(ynl_cpp::ynl_socket&  ys,
 			devlink_dpipe_table_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_table_get_rsp>>
+devlink_dpipe_table_get_ex(ynl_cpp::ynl_socket&  ys,
+			   devlink_dpipe_table_get_req& req,
+			   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_dpipe_table_get_prepare(ynl_cpp::ynl_socket&  ys,
+				devlink_dpipe_table_get_req& req);
+std::unique_ptr<devlink_dpipe_table_get_rsp>
+devlink_dpipe_table_get(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_table_get_rsp>>
+devlink_dpipe_table_get_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_DPIPE_ENTRIES_GET ============== */
 /* DEVLINK_CMD_DPIPE_ENTRIES_GET - do */
@@ -714,6 +1055,20 @@ struct devlink_dpipe_entries_get_rsp {
 std::unique_ptr<devlink_dpipe_entries_get_rsp>
 devlink_dpipe_entries_get(ynl_cpp::ynl_socket&  ys,
 			  devlink_dpipe_entries_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_entries_get_rsp>>
+devlink_dpipe_entries_get_ex(ynl_cpp::ynl_socket&  ys,
+			     devlink_dpipe_entries_get_req& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_dpipe_entries_get_prepare(ynl_cpp::ynl_socket&  ys,
+				  devlink_dpipe_entries_get_req& req);
+std::unique_ptr<devlink_dpipe_entries_get_rsp>
+devlink_dpipe_entries_get(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_entries_get_rsp>>
+devlink_dpipe_entries_get_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_DPIPE_HEADERS_GET ============== */
 /* DEVLINK_CMD_DPIPE_HEADERS_GET - do */
@@ -734,6 +1089,20 @@ struct devlink_dpipe_headers_get_rsp {
 std::unique_ptr<devlink_dpipe_headers_get_rsp>
 devlink_dpipe_headers_get(ynl_cpp::ynl_socket&  ys,
 			  devlink_dpipe_headers_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_headers_get_rsp>>
+devlink_dpipe_headers_get_ex(ynl_cpp::ynl_socket&  ys,
+			     devlink_dpipe_headers_get_req& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_dpipe_headers_get_prepare(ynl_cpp::ynl_socket&  ys,
+				  devlink_dpipe_headers_get_req& req);
+std::unique_ptr<devlink_dpipe_headers_get_rsp>
+devlink_dpipe_headers_get(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_dpipe_headers_get_rsp>>
+devlink_dpipe_headers_get_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_DPIPE_TABLE_COUNTERS_SET ============== */
 /* DEVLINK_CMD_DPIPE_TABLE_COUNTERS_SET - do */
@@ -749,6 +1118,20 @@ struct devlink_dpipe_table_counters_set_req {
  */
 int devlink_dpipe_table_counters_set(ynl_cpp::ynl_socket&  ys,
 				     devlink_dpipe_table_counters_set_req& req);
+ynl_cpp::result<void>
+devlink_dpipe_table_counters_set_ex(ynl_cpp::ynl_socket&  ys,
+				    devlink_dpipe_table_counters_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_dpipe_table_counters_set_prepare(ynl_cpp::ynl_socket&  ys,
+					 devlink_dpipe_table_counters_set_req& req);
+int devlink_dpipe_table_counters_set(ynl_cpp::ynl_socket&  ys,
+				     ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_dpipe_table_counters_set_ex(ynl_cpp::ynl_socket&  ys,
+				    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_dpipe_table_counters_set_batch(ynl_cpp::msg_batch& batch,
+				       devlink_dpipe_table_counters_set_req& req);
 
 /* ============== DEVLINK_CMD_RESOURCE_SET ============== */
 /* DEVLINK_CMD_RESOURCE_SET - do */
@@ -764,6 +1147,20 @@ struct devlink_resource_set_req {
  */
 int devlink_resource_set(ynl_cpp::ynl_socket&  ys,
 			 devlink_resource_set_req& req);
+ynl_cpp::result<void>
+devlink_resource_set_ex(ynl_cpp::ynl_socket&  ys,
+			devlink_resource_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_resource_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     devlink_resource_set_req& req);
+int devlink_resource_set(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_resource_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_resource_set_batch(ynl_cpp::msg_batch& batch,
+			   devlink_resource_set_req& req);
 
 /* ============== DEVLINK_CMD_RESOURCE_DUMP ============== */
 /* DEVLINK_CMD_RESOURCE_DUMP - do */
@@ -783,6 +1180,20 @@ struct devlink_resource_dump_rsp {
  */
 std::unique_ptr<devlink_resource_dump_rsp>
 devlink_resource_dump(ynl_cpp::ynl_socket&  ys, devlink_resource_dump_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_resource_dump_rsp>>
+devlink_resource_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_resource_dump_req& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_resource_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_resource_dump_req& req);
+std::unique_ptr<devlink_resource_dump_rsp>
+devlink_resource_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_resource_dump_rsp>>
+devlink_resource_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_RELOAD ============== */
 /* DEVLINK_CMD_RELOAD - do */
@@ -807,6 +1218,16 @@ struct devlink_reload_rsp {
  */
 std::unique_ptr<devlink_reload_rsp>
 devlink_reload(ynl_cpp::ynl_socket&  ys, devlink_reload_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_reload_rsp>>
+devlink_reload_ex(ynl_cpp::ynl_socket&  ys, devlink_reload_req& req,
+		  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_reload_prepare(ynl_cpp::ynl_socket&  ys, devlink_reload_req& req);
+std::unique_ptr<devlink_reload_rsp>
+devlink_reload(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_reload_rsp>>
+devlink_reload_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_PARAM_GET ============== */
 /* DEVLINK_CMD_PARAM_GET - do */
@@ -827,6 +1248,16 @@ struct devlink_param_get_rsp {
  */
 std::unique_ptr<devlink_param_get_rsp>
 devlink_param_get(ynl_cpp::ynl_socket&  ys, devlink_param_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_param_get_rsp>>
+devlink_param_get_ex(ynl_cpp::ynl_socket&  ys, devlink_param_get_req& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_param_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_param_get_req& req);
+std::unique_ptr<devlink_param_get_rsp>
+devlink_param_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_param_get_rsp>>
+devlink_param_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_PARAM_GET - dump */
 struct devlink_param_get_req_dump {
@@ -841,6 +1272,20 @@ struct devlink_param_get_list {
 std::unique_ptr<devlink_param_get_list>
 devlink_param_get_dump(ynl_cpp::ynl_socket&  ys,
 		       devlink_param_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_param_get_list>>
+devlink_param_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  devlink_param_get_req_dump& req,
+			  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_param_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       devlink_param_get_req_dump& req);
+std::unique_ptr<devlink_param_get_list>
+devlink_param_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_param_get_list>>
+devlink_param_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_PARAM_SET ============== */
 /* DEVLINK_CMD_PARAM_SET - do */
@@ -856,6 +1301,16 @@ struct devlink_param_set_req {
  * Set param instances.
  */
 int devlink_param_set(ynl_cpp::ynl_socket&  ys, devlink_param_set_req& req);
+ynl_cpp::result<void>
+devlink_param_set_ex(ynl_cpp::ynl_socket&  ys, devlink_param_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_param_set_prepare(ynl_cpp::ynl_socket&  ys, devlink_param_set_req& req);
+int devlink_param_set(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_param_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_param_set_batch(ynl_cpp::msg_batch& batch, devlink_param_set_req& req);
 
 /* ============== DEVLINK_CMD_REGION_GET ============== */
 /* DEVLINK_CMD_REGION_GET - do */
@@ -878,6 +1333,18 @@ struct devlink_region_get_rsp {
  */
 std::unique_ptr<devlink_region_get_rsp>
 devlink_region_get(ynl_cpp::ynl_socket&  ys, devlink_region_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_region_get_rsp>>
+devlink_region_get_ex(ynl_cpp::ynl_socket&  ys, devlink_region_get_req& req,
+		      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_region_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   devlink_region_get_req& req);
+std::unique_ptr<devlink_region_get_rsp>
+devlink_region_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_region_get_rsp>>
+devlink_region_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_REGION_GET - dump */
 struct devlink_region_get_req_dump {
@@ -892,6 +1359,20 @@ struct devlink_region_get_list {
 std::unique_ptr<devlink_region_get_list>
 devlink_region_get_dump(ynl_cpp::ynl_socket&  ys,
 			devlink_region_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_region_get_list>>
+devlink_region_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   devlink_region_get_req_dump& req,
+			   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_region_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				devlink_region_get_req_dump& req);
+std::unique_ptr<devlink_region_get_list>
+devlink_region_get_dump(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_region_get_list>>
+devlink_region_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_REGION_NEW ============== */
 /* DEVLINK_CMD_REGION_NEW - do */
@@ -916,6 +1397,18 @@ struct devlink_region_new_rsp {
  */
 std::unique_ptr<devlink_region_new_rsp>
 devlink_region_new(ynl_cpp::ynl_socket&  ys, devlink_region_new_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_region_new_rsp>>
+devlink_region_new_ex(ynl_cpp::ynl_socket&  ys, devlink_region_new_req& req,
+		      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_region_new_prepare(ynl_cpp::ynl_socket&  ys,
+			   devlink_region_new_req& req);
+std::unique_ptr<devlink_region_new_rsp>
+devlink_region_new(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_region_new_rsp>>
+devlink_region_new_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_REGION_DEL ============== */
 /* DEVLINK_CMD_REGION_DEL - do */
@@ -931,6 +1424,19 @@ struct devlink_region_del_req {
  * Delete region snapshot.
  */
 int devlink_region_del(ynl_cpp::ynl_socket&  ys, devlink_region_del_req& req);
+ynl_cpp::result<void>
+devlink_region_del_ex(ynl_cpp::ynl_socket&  ys, devlink_region_del_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_region_del_prepare(ynl_cpp::ynl_socket&  ys,
+			   devlink_region_del_req& req);
+int devlink_region_del(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_region_del_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_region_del_batch(ynl_cpp::msg_batch& batch,
+			 devlink_region_del_req& req);
 
 /* ============== DEVLINK_CMD_REGION_READ ============== */
 /* DEVLINK_CMD_REGION_READ - dump */
@@ -959,6 +1465,20 @@ struct devlink_region_read_rsp_list {
 std::unique_ptr<devlink_region_read_rsp_list>
 devlink_region_read_dump(ynl_cpp::ynl_socket&  ys,
 			 devlink_region_read_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_region_read_rsp_list>>
+devlink_region_read_dump_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_region_read_req_dump& req,
+			    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_region_read_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_region_read_req_dump& req);
+std::unique_ptr<devlink_region_read_rsp_list>
+devlink_region_read_dump(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_region_read_rsp_list>>
+devlink_region_read_dump_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl,
+			    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_PORT_PARAM_GET ============== */
 /* DEVLINK_CMD_PORT_PARAM_GET - do */
@@ -980,6 +1500,20 @@ struct devlink_port_param_get_rsp {
 std::unique_ptr<devlink_port_param_get_rsp>
 devlink_port_param_get(ynl_cpp::ynl_socket&  ys,
 		       devlink_port_param_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_port_param_get_rsp>>
+devlink_port_param_get_ex(ynl_cpp::ynl_socket&  ys,
+			  devlink_port_param_get_req& req,
+			  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_param_get_prepare(ynl_cpp::ynl_socket&  ys,
+			       devlink_port_param_get_req& req);
+std::unique_ptr<devlink_port_param_get_rsp>
+devlink_port_param_get(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_port_param_get_rsp>>
+devlink_port_param_get_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_PORT_PARAM_GET - dump */
 struct devlink_port_param_get_list {
@@ -988,6 +1522,9 @@ struct devlink_port_param_get_list {
 
 std::unique_ptr<devlink_port_param_get_list>
 devlink_port_param_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<devlink_port_param_get_list>>
+devlink_port_param_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			       const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_PORT_PARAM_SET ============== */
 /* DEVLINK_CMD_PORT_PARAM_SET - do */
@@ -1002,6 +1539,20 @@ struct devlink_port_param_set_req {
  */
 int devlink_port_param_set(ynl_cpp::ynl_socket&  ys,
 			   devlink_port_param_set_req& req);
+ynl_cpp::result<void>
+devlink_port_param_set_ex(ynl_cpp::ynl_socket&  ys,
+			  devlink_port_param_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_port_param_set_prepare(ynl_cpp::ynl_socket&  ys,
+			       devlink_port_param_set_req& req);
+int devlink_port_param_set(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_port_param_set_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_port_param_set_batch(ynl_cpp::msg_batch& batch,
+			     devlink_port_param_set_req& req);
 
 /* ============== DEVLINK_CMD_INFO_GET ============== */
 /* DEVLINK_CMD_INFO_GET - do */
@@ -1025,6 +1576,16 @@ struct devlink_info_get_rsp {
  */
 std::unique_ptr<devlink_info_get_rsp>
 devlink_info_get(ynl_cpp::ynl_socket&  ys, devlink_info_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_info_get_rsp>>
+devlink_info_get_ex(ynl_cpp::ynl_socket&  ys, devlink_info_get_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_info_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_info_get_req& req);
+std::unique_ptr<devlink_info_get_rsp>
+devlink_info_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_info_get_rsp>>
+devlink_info_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_INFO_GET - dump */
 struct devlink_info_get_list {
@@ -1033,6 +1594,9 @@ struct devlink_info_get_list {
 
 std::unique_ptr<devlink_info_get_list>
 devlink_info_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<devlink_info_get_list>>
+devlink_info_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_GET ============== */
 /* DEVLINK_CMD_HEALTH_REPORTER_GET - do */
@@ -1056,6 +1620,20 @@ struct devlink_health_reporter_get_rsp {
 std::unique_ptr<devlink_health_reporter_get_rsp>
 devlink_health_reporter_get(ynl_cpp::ynl_socket&  ys,
 			    devlink_health_reporter_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_get_rsp>>
+devlink_health_reporter_get_ex(ynl_cpp::ynl_socket&  ys,
+			       devlink_health_reporter_get_req& req,
+			       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_get_prepare(ynl_cpp::ynl_socket&  ys,
+				    devlink_health_reporter_get_req& req);
+std::unique_ptr<devlink_health_reporter_get_rsp>
+devlink_health_reporter_get(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_get_rsp>>
+devlink_health_reporter_get_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl,
+			       const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_HEALTH_REPORTER_GET - dump */
 struct devlink_health_reporter_get_req_dump {
@@ -1071,6 +1649,20 @@ struct devlink_health_reporter_get_list {
 std::unique_ptr<devlink_health_reporter_get_list>
 devlink_health_reporter_get_dump(ynl_cpp::ynl_socket&  ys,
 				 devlink_health_reporter_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_get_list>>
+devlink_health_reporter_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				    devlink_health_reporter_get_req_dump& req,
+				    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+					 devlink_health_reporter_get_req_dump& req);
+std::unique_ptr<devlink_health_reporter_get_list>
+devlink_health_reporter_get_dump(ynl_cpp::ynl_socket&  ys,
+				 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_get_list>>
+devlink_health_reporter_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				    ynl_cpp::request_template& tmpl,
+				    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_SET ============== */
 /* DEVLINK_CMD_HEALTH_REPORTER_SET - do */
@@ -1089,6 +1681,20 @@ struct devlink_health_reporter_set_req {
  */
 int devlink_health_reporter_set(ynl_cpp::ynl_socket&  ys,
 				devlink_health_reporter_set_req& req);
+ynl_cpp::result<void>
+devlink_health_reporter_set_ex(ynl_cpp::ynl_socket&  ys,
+			       devlink_health_reporter_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_set_prepare(ynl_cpp::ynl_socket&  ys,
+				    devlink_health_reporter_set_req& req);
+int devlink_health_reporter_set(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_health_reporter_set_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_health_reporter_set_batch(ynl_cpp::msg_batch& batch,
+				  devlink_health_reporter_set_req& req);
 
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_RECOVER ============== */
 /* DEVLINK_CMD_HEALTH_REPORTER_RECOVER - do */
@@ -1104,6 +1710,20 @@ struct devlink_health_reporter_recover_req {
  */
 int devlink_health_reporter_recover(ynl_cpp::ynl_socket&  ys,
 				    devlink_health_reporter_recover_req& req);
+ynl_cpp::result<void>
+devlink_health_reporter_recover_ex(ynl_cpp::ynl_socket&  ys,
+				   devlink_health_reporter_recover_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_recover_prepare(ynl_cpp::ynl_socket&  ys,
+					devlink_health_reporter_recover_req& req);
+int devlink_health_reporter_recover(ynl_cpp::ynl_socket&  ys,
+				    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_health_reporter_recover_ex(ynl_cpp::ynl_socket&  ys,
+				   ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_health_reporter_recover_batch(ynl_cpp::msg_batch& batch,
+				      devlink_health_reporter_recover_req& req);
 
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_DIAGNOSE ============== */
 /* DEVLINK_CMD_HEALTH_REPORTER_DIAGNOSE - do */
@@ -1119,6 +1739,20 @@ struct devlink_health_reporter_diagnose_req {
  */
 int devlink_health_reporter_diagnose(ynl_cpp::ynl_socket&  ys,
 				     devlink_health_reporter_diagnose_req& req);
+ynl_cpp::result<void>
+devlink_health_reporter_diagnose_ex(ynl_cpp::ynl_socket&  ys,
+				    devlink_health_reporter_diagnose_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_diagnose_prepare(ynl_cpp::ynl_socket&  ys,
+					 devlink_health_reporter_diagnose_req& req);
+int devlink_health_reporter_diagnose(ynl_cpp::ynl_socket&  ys,
+				     ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_health_reporter_diagnose_ex(ynl_cpp::ynl_socket&  ys,
+				    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_health_reporter_diagnose_batch(ynl_cpp::msg_batch& batch,
+				       devlink_health_reporter_diagnose_req& req);
 
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_DUMP_GET ============== */
 /* DEVLINK_CMD_HEALTH_REPORTER_DUMP_GET - dump */
@@ -1140,6 +1774,20 @@ struct devlink_health_reporter_dump_get_rsp_list {
 std::unique_ptr<devlink_health_reporter_dump_get_rsp_list>
 devlink_health_reporter_dump_get_dump(ynl_cpp::ynl_socket&  ys,
 				      devlink_health_reporter_dump_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_dump_get_rsp_list>>
+devlink_health_reporter_dump_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+					 devlink_health_reporter_dump_get_req_dump& req,
+					 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_dump_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+					      devlink_health_reporter_dump_get_req_dump& req);
+std::unique_ptr<devlink_health_reporter_dump_get_rsp_list>
+devlink_health_reporter_dump_get_dump(ynl_cpp::ynl_socket&  ys,
+				      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_health_reporter_dump_get_rsp_list>>
+devlink_health_reporter_dump_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+					 ynl_cpp::request_template& tmpl,
+					 const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_DUMP_CLEAR ============== */
 /* DEVLINK_CMD_HEALTH_REPORTER_DUMP_CLEAR - do */
@@ -1155,6 +1803,20 @@ struct devlink_health_reporter_dump_clear_req {
  */
 int devlink_health_reporter_dump_clear(ynl_cpp::ynl_socket&  ys,
 				       devlink_health_reporter_dump_clear_req& req);
+ynl_cpp::result<void>
+devlink_health_reporter_dump_clear_ex(ynl_cpp::ynl_socket&  ys,
+				      devlink_health_reporter_dump_clear_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_dump_clear_prepare(ynl_cpp::ynl_socket&  ys,
+					   devlink_health_reporter_dump_clear_req& req);
+int devlink_health_reporter_dump_clear(ynl_cpp::ynl_socket&  ys,
+				       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_health_reporter_dump_clear_ex(ynl_cpp::ynl_socket&  ys,
+				      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_health_reporter_dump_clear_batch(ynl_cpp::msg_batch& batch,
+					 devlink_health_reporter_dump_clear_req& req);
 
 /* ============== DEVLINK_CMD_FLASH_UPDATE ============== */
 /* DEVLINK_CMD_FLASH_UPDATE - do */
@@ -1171,6 +1833,20 @@ struct devlink_flash_update_req {
  */
 int devlink_flash_update(ynl_cpp::ynl_socket&  ys,
 			 devlink_flash_update_req& req);
+ynl_cpp::result<void>
+devlink_flash_update_ex(ynl_cpp::ynl_socket&  ys,
+			devlink_flash_update_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_flash_update_prepare(ynl_cpp::ynl_socket&  ys,
+			     devlink_flash_update_req& req);
+int devlink_flash_update(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_flash_update_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_flash_update_batch(ynl_cpp::msg_batch& batch,
+			   devlink_flash_update_req& req);
 
 /* ============== DEVLINK_CMD_TRAP_GET ============== */
 /* DEVLINK_CMD_TRAP_GET - do */
@@ -1191,6 +1867,16 @@ struct devlink_trap_get_rsp {
  */
 std::unique_ptr<devlink_trap_get_rsp>
 devlink_trap_get(ynl_cpp::ynl_socket&  ys, devlink_trap_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_trap_get_rsp>>
+devlink_trap_get_ex(ynl_cpp::ynl_socket&  ys, devlink_trap_get_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_trap_get_req& req);
+std::unique_ptr<devlink_trap_get_rsp>
+devlink_trap_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_trap_get_rsp>>
+devlink_trap_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_TRAP_GET - dump */
 struct devlink_trap_get_req_dump {
@@ -1204,6 +1890,20 @@ struct devlink_trap_get_list {
 
 std::unique_ptr<devlink_trap_get_list>
 devlink_trap_get_dump(ynl_cpp::ynl_socket&  ys, devlink_trap_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_trap_get_list>>
+devlink_trap_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_trap_get_req_dump& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_trap_get_req_dump& req);
+std::unique_ptr<devlink_trap_get_list>
+devlink_trap_get_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_trap_get_list>>
+devlink_trap_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_TRAP_SET ============== */
 /* DEVLINK_CMD_TRAP_SET - do */
@@ -1218,6 +1918,15 @@ struct devlink_trap_set_req {
  * Set trap instances.
  */
 int devlink_trap_set(ynl_cpp::ynl_socket&  ys, devlink_trap_set_req& req);
+ynl_cpp::result<void>
+devlink_trap_set_ex(ynl_cpp::ynl_socket&  ys, devlink_trap_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_set_prepare(ynl_cpp::ynl_socket&  ys, devlink_trap_set_req& req);
+int devlink_trap_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_trap_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_trap_set_batch(ynl_cpp::msg_batch& batch, devlink_trap_set_req& req);
 
 /* ============== DEVLINK_CMD_TRAP_GROUP_GET ============== */
 /* DEVLINK_CMD_TRAP_GROUP_GET - do */
@@ -1239,6 +1948,20 @@ struct devlink_trap_group_get_rsp {
 std::unique_ptr<devlink_trap_group_get_rsp>
 devlink_trap_group_get(ynl_cpp::ynl_socket&  ys,
 		       devlink_trap_group_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_trap_group_get_rsp>>
+devlink_trap_group_get_ex(ynl_cpp::ynl_socket&  ys,
+			  devlink_trap_group_get_req& req,
+			  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_group_get_prepare(ynl_cpp::ynl_socket&  ys,
+			       devlink_trap_group_get_req& req);
+std::unique_ptr<devlink_trap_group_get_rsp>
+devlink_trap_group_get(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_trap_group_get_rsp>>
+devlink_trap_group_get_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_TRAP_GROUP_GET - dump */
 struct devlink_trap_group_get_req_dump {
@@ -1253,6 +1976,20 @@ struct devlink_trap_group_get_list {
 std::unique_ptr<devlink_trap_group_get_list>
 devlink_trap_group_get_dump(ynl_cpp::ynl_socket&  ys,
 			    devlink_trap_group_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_trap_group_get_list>>
+devlink_trap_group_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			       devlink_trap_group_get_req_dump& req,
+			       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_group_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				    devlink_trap_group_get_req_dump& req);
+std::unique_ptr<devlink_trap_group_get_list>
+devlink_trap_group_get_dump(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_trap_group_get_list>>
+devlink_trap_group_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl,
+			       const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_TRAP_GROUP_SET ============== */
 /* DEVLINK_CMD_TRAP_GROUP_SET - do */
@@ -1269,6 +2006,20 @@ struct devlink_trap_group_set_req {
  */
 int devlink_trap_group_set(ynl_cpp::ynl_socket&  ys,
 			   devlink_trap_group_set_req& req);
+ynl_cpp::result<void>
+devlink_trap_group_set_ex(ynl_cpp::ynl_socket&  ys,
+			  devlink_trap_group_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_group_set_prepare(ynl_cpp::ynl_socket&  ys,
+			       devlink_trap_group_set_req& req);
+int devlink_trap_group_set(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_trap_group_set_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_trap_group_set_batch(ynl_cpp::msg_batch& batch,
+			     devlink_trap_group_set_req& req);
 
 /* ============== DEVLINK_CMD_TRAP_POLICER_GET ============== */
 /* DEVLINK_CMD_TRAP_POLICER_GET - do */
@@ -1290,6 +2041,20 @@ struct devlink_trap_policer_get_rsp {
 std::unique_ptr<devlink_trap_policer_get_rsp>
 devlink_trap_policer_get(ynl_cpp::ynl_socket&  ys,
 			 devlink_trap_policer_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_trap_policer_get_rsp>>
+devlink_trap_policer_get_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_trap_policer_get_req& req,
+			    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_policer_get_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_trap_policer_get_req& req);
+std::unique_ptr<devlink_trap_policer_get_rsp>
+devlink_trap_policer_get(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_trap_policer_get_rsp>>
+devlink_trap_policer_get_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl,
+			    const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_TRAP_POLICER_GET - dump */
 struct devlink_trap_policer_get_req_dump {
@@ -1304,6 +2069,20 @@ struct devlink_trap_policer_get_list {
 std::unique_ptr<devlink_trap_policer_get_list>
 devlink_trap_policer_get_dump(ynl_cpp::ynl_socket&  ys,
 			      devlink_trap_policer_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_trap_policer_get_list>>
+devlink_trap_policer_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				 devlink_trap_policer_get_req_dump& req,
+				 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_policer_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				      devlink_trap_policer_get_req_dump& req);
+std::unique_ptr<devlink_trap_policer_get_list>
+devlink_trap_policer_get_dump(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_trap_policer_get_list>>
+devlink_trap_policer_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				 ynl_cpp::request_template& tmpl,
+				 const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_TRAP_POLICER_SET ============== */
 /* DEVLINK_CMD_TRAP_POLICER_SET - do */
@@ -1320,6 +2099,20 @@ struct devlink_trap_policer_set_req {
  */
 int devlink_trap_policer_set(ynl_cpp::ynl_socket&  ys,
 			     devlink_trap_policer_set_req& req);
+ynl_cpp::result<void>
+devlink_trap_policer_set_ex(ynl_cpp::ynl_socket&  ys,
+			    devlink_trap_policer_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_trap_policer_set_prepare(ynl_cpp::ynl_socket&  ys,
+				 devlink_trap_policer_set_req& req);
+int devlink_trap_policer_set(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_trap_policer_set_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_trap_policer_set_batch(ynl_cpp::msg_batch& batch,
+			       devlink_trap_policer_set_req& req);
 
 /* ============== DEVLINK_CMD_HEALTH_REPORTER_TEST ============== */
 /* DEVLINK_CMD_HEALTH_REPORTER_TEST - do */
@@ -1335,6 +2128,20 @@ struct devlink_health_reporter_test_req {
  */
 int devlink_health_reporter_test(ynl_cpp::ynl_socket&  ys,
 				 devlink_health_reporter_test_req& req);
+ynl_cpp::result<void>
+devlink_health_reporter_test_ex(ynl_cpp::ynl_socket&  ys,
+				devlink_health_reporter_test_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_health_reporter_test_prepare(ynl_cpp::ynl_socket&  ys,
+				     devlink_health_reporter_test_req& req);
+int devlink_health_reporter_test(ynl_cpp::ynl_socket&  ys,
+				 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_health_reporter_test_ex(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_health_reporter_test_batch(ynl_cpp::msg_batch& batch,
+				   devlink_health_reporter_test_req& req);
 
 /* ============== DEVLINK_CMD_RATE_GET ============== */
 /* DEVLINK_CMD_RATE_GET - do */
@@ -1357,6 +2164,16 @@ struct devlink_rate_get_rsp {
  */
 std::unique_ptr<devlink_rate_get_rsp>
 devlink_rate_get(ynl_cpp::ynl_socket&  ys, devlink_rate_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_rate_get_rsp>>
+devlink_rate_get_ex(ynl_cpp::ynl_socket&  ys, devlink_rate_get_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_rate_get_prepare(ynl_cpp::ynl_socket&  ys, devlink_rate_get_req& req);
+std::unique_ptr<devlink_rate_get_rsp>
+devlink_rate_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_rate_get_rsp>>
+devlink_rate_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_RATE_GET - dump */
 struct devlink_rate_get_req_dump {
@@ -1370,6 +2187,20 @@ struct devlink_rate_get_list {
 
 std::unique_ptr<devlink_rate_get_list>
 devlink_rate_get_dump(ynl_cpp::ynl_socket&  ys, devlink_rate_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_rate_get_list>>
+devlink_rate_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_rate_get_req_dump& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_rate_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_rate_get_req_dump& req);
+std::unique_ptr<devlink_rate_get_list>
+devlink_rate_get_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_rate_get_list>>
+devlink_rate_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_RATE_SET ============== */
 /* DEVLINK_CMD_RATE_SET - do */
@@ -1388,6 +2219,15 @@ struct devlink_rate_set_req {
  * Set rate instances.
  */
 int devlink_rate_set(ynl_cpp::ynl_socket&  ys, devlink_rate_set_req& req);
+ynl_cpp::result<void>
+devlink_rate_set_ex(ynl_cpp::ynl_socket&  ys, devlink_rate_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_rate_set_prepare(ynl_cpp::ynl_socket&  ys, devlink_rate_set_req& req);
+int devlink_rate_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_rate_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_rate_set_batch(ynl_cpp::msg_batch& batch, devlink_rate_set_req& req);
 
 /* ============== DEVLINK_CMD_RATE_NEW ============== */
 /* DEVLINK_CMD_RATE_NEW - do */
@@ -1406,6 +2246,15 @@ struct devlink_rate_new_req {
  * Create rate instances.
  */
 int devlink_rate_new(ynl_cpp::ynl_socket&  ys, devlink_rate_new_req& req);
+ynl_cpp::result<void>
+devlink_rate_new_ex(ynl_cpp::ynl_socket&  ys, devlink_rate_new_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_rate_new_prepare(ynl_cpp::ynl_socket&  ys, devlink_rate_new_req& req);
+int devlink_rate_new(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_rate_new_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_rate_new_batch(ynl_cpp::msg_batch& batch, devlink_rate_new_req& req);
 
 /* ============== DEVLINK_CMD_RATE_DEL ============== */
 /* DEVLINK_CMD_RATE_DEL - do */
@@ -1419,6 +2268,15 @@ struct devlink_rate_del_req {
  * Delete rate instances.
  */
 int devlink_rate_del(ynl_cpp::ynl_socket&  ys, devlink_rate_del_req& req);
+ynl_cpp::result<void>
+devlink_rate_del_ex(ynl_cpp::ynl_socket&  ys, devlink_rate_del_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_rate_del_prepare(ynl_cpp::ynl_socket&  ys, devlink_rate_del_req& req);
+int devlink_rate_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_rate_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_rate_del_batch(ynl_cpp::msg_batch& batch, devlink_rate_del_req& req);
 
 /* ============== DEVLINK_CMD_LINECARD_GET ============== */
 /* DEVLINK_CMD_LINECARD_GET - do */
@@ -1439,6 +2297,19 @@ struct devlink_linecard_get_rsp {
  */
 std::unique_ptr<devlink_linecard_get_rsp>
 devlink_linecard_get(ynl_cpp::ynl_socket&  ys, devlink_linecard_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_linecard_get_rsp>>
+devlink_linecard_get_ex(ynl_cpp::ynl_socket&  ys,
+			devlink_linecard_get_req& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_linecard_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     devlink_linecard_get_req& req);
+std::unique_ptr<devlink_linecard_get_rsp>
+devlink_linecard_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_linecard_get_rsp>>
+devlink_linecard_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_LINECARD_GET - dump */
 struct devlink_linecard_get_req_dump {
@@ -1453,6 +2324,20 @@ struct devlink_linecard_get_list {
 std::unique_ptr<devlink_linecard_get_list>
 devlink_linecard_get_dump(ynl_cpp::ynl_socket&  ys,
 			  devlink_linecard_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<devlink_linecard_get_list>>
+devlink_linecard_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     devlink_linecard_get_req_dump& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_linecard_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  devlink_linecard_get_req_dump& req);
+std::unique_ptr<devlink_linecard_get_list>
+devlink_linecard_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_linecard_get_list>>
+devlink_linecard_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_LINECARD_SET ============== */
 /* DEVLINK_CMD_LINECARD_SET - do */
@@ -1468,6 +2353,20 @@ struct devlink_linecard_set_req {
  */
 int devlink_linecard_set(ynl_cpp::ynl_socket&  ys,
 			 devlink_linecard_set_req& req);
+ynl_cpp::result<void>
+devlink_linecard_set_ex(ynl_cpp::ynl_socket&  ys,
+			devlink_linecard_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_linecard_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     devlink_linecard_set_req& req);
+int devlink_linecard_set(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_linecard_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_linecard_set_batch(ynl_cpp::msg_batch& batch,
+			   devlink_linecard_set_req& req);
 
 /* ============== DEVLINK_CMD_SELFTESTS_GET ============== */
 /* DEVLINK_CMD_SELFTESTS_GET - do */
@@ -1486,6 +2385,20 @@ struct devlink_selftests_get_rsp {
  */
 std::unique_ptr<devlink_selftests_get_rsp>
 devlink_selftests_get(ynl_cpp::ynl_socket&  ys, devlink_selftests_get_req& req);
+ynl_cpp::result<std::unique_ptr<devlink_selftests_get_rsp>>
+devlink_selftests_get_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_selftests_get_req& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_selftests_get_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_selftests_get_req& req);
+std::unique_ptr<devlink_selftests_get_rsp>
+devlink_selftests_get(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<devlink_selftests_get_rsp>>
+devlink_selftests_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* DEVLINK_CMD_SELFTESTS_GET - dump */
 struct devlink_selftests_get_list {
@@ -1494,6 +2407,9 @@ struct devlink_selftests_get_list {
 
 std::unique_ptr<devlink_selftests_get_list>
 devlink_selftests_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<devlink_selftests_get_list>>
+devlink_selftests_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DEVLINK_CMD_SELFTESTS_RUN ============== */
 /* DEVLINK_CMD_SELFTESTS_RUN - do */
@@ -1508,6 +2424,20 @@ struct devlink_selftests_run_req {
  */
 int devlink_selftests_run(ynl_cpp::ynl_socket&  ys,
 			  devlink_selftests_run_req& req);
+ynl_cpp::result<void>
+devlink_selftests_run_ex(ynl_cpp::ynl_socket&  ys,
+			 devlink_selftests_run_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_selftests_run_prepare(ynl_cpp::ynl_socket&  ys,
+			      devlink_selftests_run_req& req);
+int devlink_selftests_run(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_selftests_run_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_selftests_run_batch(ynl_cpp::msg_batch& batch,
+			    devlink_selftests_run_req& req);
 
 /* ============== DEVLINK_CMD_NOTIFY_FILTER_SET ============== */
 /* DEVLINK_CMD_NOTIFY_FILTER_SET - do */
@@ -1522,6 +2452,20 @@ struct devlink_notify_filter_set_req {
  */
 int devlink_notify_filter_set(ynl_cpp::ynl_socket&  ys,
 			      devlink_notify_filter_set_req& req);
+ynl_cpp::result<void>
+devlink_notify_filter_set_ex(ynl_cpp::ynl_socket&  ys,
+			     devlink_notify_filter_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+devlink_notify_filter_set_prepare(ynl_cpp::ynl_socket&  ys,
+				  devlink_notify_filter_set_req& req);
+int devlink_notify_filter_set(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+devlink_notify_filter_set_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+devlink_notify_filter_set_batch(ynl_cpp::msg_batch& batch,
+				devlink_notify_filter_set_req& req);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_DEVLINK_GEN_H */
@@ -289,12 +289,12 @@ int dpll_frequency_range_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DPLL_A_PIN_FREQUENCY_MIN) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->frequency_min = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DPLL_A_PIN_FREQUENCY_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->frequency_max = (__u64)ynl_attr_get_u64(attr);
 		}
 	}
@@ -333,24 +333,24 @@ int dpll_pin_parent_device_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DPLL_A_PIN_PARENT_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->parent_id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_PIN_DIRECTION) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->direction = (dpll_pin_direction)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_PIN_PRIO) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->prio = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_PIN_STATE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->state = (dpll_pin_state)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_PIN_PHASE_OFFSET) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s64))
+				return ynl_attr_invalid(yarg, attr, "s64");
 			dst->phase_offset = (__s64)ynl_attr_get_s64(attr);
 		}
 	}
@@ -383,12 +383,12 @@ int dpll_pin_parent_pin_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == DPLL_A_PIN_PARENT_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->parent_id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_PIN_STATE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->state = (dpll_pin_state)ynl_attr_get_u32(attr);
 		}
 	}
@@ -409,9 +409,12 @@ int dpll_device_id_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DPLL_A_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -419,37 +422,93 @@ int dpll_device_id_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<dpll_device_id_get_rsp>
-dpll_device_id_get(ynl_cpp::ynl_socket&  ys, dpll_device_id_get_req& req)
+static void
+dpll_device_id_get_put(struct nlmsghdr *nlh, dpll_device_id_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 20 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.clock_id.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DPLL_A_CLOCK_ID, req.clock_id.value());
+	if (req.type.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DPLL_A_TYPE, req.type.value());
+	if (req.module_name.size() > 0)
+		ynl_attr_put_str(nlh, DPLL_A_MODULE_NAME, req.module_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<dpll_device_id_get_rsp>>
+dpll_device_id_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<dpll_device_id_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_DEVICE_ID_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &dpll_nest;
 	yrs.yarg.rsp_policy = &dpll_nest;
 
-	if (req.module_name.size() > 0)
-		ynl_attr_put_str(nlh, DPLL_A_MODULE_NAME, req.module_name.data());
-	if (req.clock_id.has_value())
-		ynl_attr_put_u64(nlh, DPLL_A_CLOCK_ID, req.clock_id.value());
-	if (req.type.has_value())
-		ynl_attr_put_u32(nlh, DPLL_A_TYPE, req.type.value());
-
 	rsp.reset(new dpll_device_id_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = dpll_device_id_get_rsp_parse;
 	yrs.rsp_cmd = DPLL_CMD_DEVICE_ID_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<dpll_device_id_get_rsp>>
+dpll_device_id_get_ex(ynl_cpp::ynl_socket&  ys, dpll_device_id_get_req& req,
+		      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_DEVICE_ID_GET, 1);
+	dpll_device_id_get_put(nlh, req);
+
+	return dpll_device_id_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<dpll_device_id_get_rsp>
+dpll_device_id_get(ynl_cpp::ynl_socket&  ys, dpll_device_id_get_req& req)
+{
+	auto ret = dpll_device_id_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_device_id_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   dpll_device_id_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_DEVICE_ID_GET, 1);
+	dpll_device_id_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<dpll_device_id_get_rsp>>
+dpll_device_id_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj)
+{
+	return dpll_device_id_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<dpll_device_id_get_rsp>
+dpll_device_id_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = dpll_device_id_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DPLL_CMD_DEVICE_GET ============== */
 /* DPLL_CMD_DEVICE_GET - do */
 int dpll_device_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -468,39 +527,42 @@ int dpll_device_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DPLL_A_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_MODULE_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->module_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->module_name.assign(ynl_attr_get_str(attr));
 		} else if (type == DPLL_A_MODE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->mode = (dpll_mode)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_MODE_SUPPORTED) {
 			n_mode_supported++;
 		} else if (type == DPLL_A_LOCK_STATUS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->lock_status = (dpll_lock_status)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_LOCK_STATUS_ERROR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->lock_status_error = (dpll_lock_status_error)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_TEMP) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
 			dst->temp = (__s32)ynl_attr_get_s32(attr);
 		} else if (type == DPLL_A_CLOCK_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->clock_id = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DPLL_A_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->type = (dpll_type)ynl_attr_get_u32(attr);
 		}
 	}
@@ -519,78 +581,219 @@ int dpll_device_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<dpll_device_get_rsp>
-dpll_device_get(ynl_cpp::ynl_socket&  ys, dpll_device_get_req& req)
+static void dpll_device_get_put(struct nlmsghdr *nlh, dpll_device_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DPLL_A_ID, req.id.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<dpll_device_get_rsp>>
+dpll_device_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<dpll_device_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_DEVICE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &dpll_nest;
 	yrs.yarg.rsp_policy = &dpll_nest;
 
-	if (req.id.has_value())
-		ynl_attr_put_u32(nlh, DPLL_A_ID, req.id.value());
-
 	rsp.reset(new dpll_device_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = dpll_device_get_rsp_parse;
 	yrs.rsp_cmd = DPLL_CMD_DEVICE_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<dpll_device_get_rsp>>
+dpll_device_get_ex(ynl_cpp::ynl_socket&  ys, dpll_device_get_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_DEVICE_GET, 1);
+	dpll_device_get_put(nlh, req);
+
+	return dpll_device_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<dpll_device_get_rsp>
+dpll_device_get(ynl_cpp::ynl_socket&  ys, dpll_device_get_req& req)
+{
+	auto ret = dpll_device_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_device_get_prepare(ynl_cpp::ynl_socket&  ys, dpll_device_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_DEVICE_GET, 1);
+	dpll_device_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<dpll_device_get_rsp>>
+dpll_device_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return dpll_device_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<dpll_device_get_rsp>
+dpll_device_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = dpll_device_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DPLL_CMD_DEVICE_GET - dump */
-std::unique_ptr<dpll_device_get_list>
-dpll_device_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<dpll_device_get_list>>
+dpll_device_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<dpll_device_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &dpll_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<dpll_device_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = dpll_device_get_rsp_parse;
 	yds.rsp_cmd = DPLL_CMD_DEVICE_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_DEVICE_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<dpll_device_get_list>>
+dpll_device_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_DEVICE_GET, 1);
+
+	return dpll_device_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<dpll_device_get_list>
+dpll_device_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = dpll_device_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DPLL_CMD_DEVICE_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<dpll_device_get_ntf>());
+
+static void *dpll_device_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) dpll_device_get_ntf())->obj;
+}
+
+static void dpll_device_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	dpll_device_get_ntf *rsp = (dpll_device_get_ntf *)ntf;
+
+	rsp->~dpll_device_get_ntf();
+	::free(rsp);
+}
+
 /* ============== DPLL_CMD_DEVICE_SET ============== */
 /* DPLL_CMD_DEVICE_SET - do */
-int dpll_device_set(ynl_cpp::ynl_socket&  ys, dpll_device_set_req& req)
+static void dpll_device_set_put(struct nlmsghdr *nlh, dpll_device_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DPLL_A_ID, req.id.value());
+}
+
+static ynl_cpp::result<void>
+dpll_device_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_DEVICE_SET, 1);
 	((struct ynl_sock*)ys)->req_policy = &dpll_nest;
 
-	if (req.id.has_value())
-		ynl_attr_put_u32(nlh, DPLL_A_ID, req.id.value());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+dpll_device_set_ex(ynl_cpp::ynl_socket&  ys, dpll_device_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_DEVICE_SET, 1);
+	dpll_device_set_put(nlh, req);
+
+	return dpll_device_set_exec(ys, nlh);
+}
+
+int dpll_device_set(ynl_cpp::ynl_socket&  ys, dpll_device_set_req& req)
+{
+	auto ret = dpll_device_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_device_set_prepare(ynl_cpp::ynl_socket&  ys, dpll_device_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_DEVICE_SET, 1);
+	dpll_device_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+dpll_device_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return dpll_device_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int dpll_device_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = dpll_device_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+dpll_device_set_batch(ynl_cpp::msg_batch& batch, dpll_device_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DPLL_CMD_DEVICE_SET, 1);
+	dpll_device_set_put(nlh, req);
+	return batch.msg_end(nlh, &dpll_nest);
 }
 
 /* ============== DPLL_CMD_PIN_ID_GET ============== */
@@ -606,9 +809,12 @@ int dpll_pin_id_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DPLL_A_PIN_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -616,43 +822,96 @@ int dpll_pin_id_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<dpll_pin_id_get_rsp>
-dpll_pin_id_get(ynl_cpp::ynl_socket&  ys, dpll_pin_id_get_req& req)
+static void dpll_pin_id_get_put(struct nlmsghdr *nlh, dpll_pin_id_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<dpll_pin_id_get_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_ID_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &dpll_pin_nest;
-	yrs.yarg.rsp_policy = &dpll_pin_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 20 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.clock_id.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DPLL_A_PIN_CLOCK_ID, req.clock_id.value());
+	if (req.type.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DPLL_A_PIN_TYPE, req.type.value());
 	if (req.module_name.size() > 0)
 		ynl_attr_put_str(nlh, DPLL_A_PIN_MODULE_NAME, req.module_name.data());
-	if (req.clock_id.has_value())
-		ynl_attr_put_u64(nlh, DPLL_A_PIN_CLOCK_ID, req.clock_id.value());
 	if (req.board_label.size() > 0)
 		ynl_attr_put_str(nlh, DPLL_A_PIN_BOARD_LABEL, req.board_label.data());
 	if (req.panel_label.size() > 0)
 		ynl_attr_put_str(nlh, DPLL_A_PIN_PANEL_LABEL, req.panel_label.data());
 	if (req.package_label.size() > 0)
 		ynl_attr_put_str(nlh, DPLL_A_PIN_PACKAGE_LABEL, req.package_label.data());
-	if (req.type.has_value())
-		ynl_attr_put_u32(nlh, DPLL_A_PIN_TYPE, req.type.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<dpll_pin_id_get_rsp>>
+dpll_pin_id_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<dpll_pin_id_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &dpll_pin_nest;
+	yrs.yarg.rsp_policy = &dpll_pin_nest;
 
 	rsp.reset(new dpll_pin_id_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = dpll_pin_id_get_rsp_parse;
 	yrs.rsp_cmd = DPLL_CMD_PIN_ID_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<dpll_pin_id_get_rsp>>
+dpll_pin_id_get_ex(ynl_cpp::ynl_socket&  ys, dpll_pin_id_get_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_ID_GET, 1);
+	dpll_pin_id_get_put(nlh, req);
+
+	return dpll_pin_id_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<dpll_pin_id_get_rsp>
+dpll_pin_id_get(ynl_cpp::ynl_socket&  ys, dpll_pin_id_get_req& req)
+{
+	auto ret = dpll_pin_id_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_pin_id_get_prepare(ynl_cpp::ynl_socket&  ys, dpll_pin_id_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_ID_GET, 1);
+	dpll_pin_id_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<dpll_pin_id_get_rsp>>
+dpll_pin_id_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return dpll_pin_id_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<dpll_pin_id_get_rsp>
+dpll_pin_id_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = dpll_pin_id_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== DPLL_CMD_PIN_GET ============== */
 /* DPLL_CMD_PIN_GET - do */
 int dpll_pin_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -682,65 +941,68 @@ int dpll_pin_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == DPLL_A_PIN_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_PIN_BOARD_LABEL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->board_label.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->board_label.assign(ynl_attr_get_str(attr));
 		} else if (type == DPLL_A_PIN_PANEL_LABEL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->panel_label.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->panel_label.assign(ynl_attr_get_str(attr));
 		} else if (type == DPLL_A_PIN_PACKAGE_LABEL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->package_label.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->package_label.assign(ynl_attr_get_str(attr));
 		} else if (type == DPLL_A_PIN_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->type = (dpll_pin_type)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_PIN_FREQUENCY) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->frequency = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DPLL_A_PIN_FREQUENCY_SUPPORTED) {
 			n_frequency_supported++;
 		} else if (type == DPLL_A_PIN_CAPABILITIES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->capabilities = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == DPLL_A_PIN_PARENT_DEVICE) {
 			n_parent_device++;
 		} else if (type == DPLL_A_PIN_PARENT_PIN) {
 			n_parent_pin++;
 		} else if (type == DPLL_A_PIN_PHASE_ADJUST_MIN) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
 			dst->phase_adjust_min = (__s32)ynl_attr_get_s32(attr);
 		} else if (type == DPLL_A_PIN_PHASE_ADJUST_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
 			dst->phase_adjust_max = (__s32)ynl_attr_get_s32(attr);
 		} else if (type == DPLL_A_PIN_PHASE_ADJUST) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
 			dst->phase_adjust = (__s32)ynl_attr_get_s32(attr);
 		} else if (type == DPLL_A_PIN_FRACTIONAL_FREQUENCY_OFFSET) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "sint");
 			dst->fractional_frequency_offset = (__s64)ynl_attr_get_sint(attr);
 		} else if (type == DPLL_A_PIN_ESYNC_FREQUENCY) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->esync_frequency = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == DPLL_A_PIN_ESYNC_FREQUENCY_SUPPORTED) {
 			n_esync_frequency_supported++;
 		} else if (type == DPLL_A_PIN_ESYNC_PULSE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->esync_pulse = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -801,98 +1063,273 @@ int dpll_pin_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<dpll_pin_get_rsp>
-dpll_pin_get(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req& req)
+static void dpll_pin_get_put(struct nlmsghdr *nlh, dpll_pin_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DPLL_A_PIN_ID, req.id.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<dpll_pin_get_rsp>>
+dpll_pin_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		  const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<dpll_pin_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &dpll_pin_nest;
 	yrs.yarg.rsp_policy = &dpll_pin_nest;
 
-	if (req.id.has_value())
-		ynl_attr_put_u32(nlh, DPLL_A_PIN_ID, req.id.value());
-
 	rsp.reset(new dpll_pin_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = dpll_pin_get_rsp_parse;
 	yrs.rsp_cmd = DPLL_CMD_PIN_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<dpll_pin_get_rsp>>
+dpll_pin_get_ex(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req& req,
+		const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_GET, 1);
+	dpll_pin_get_put(nlh, req);
+
+	return dpll_pin_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<dpll_pin_get_rsp>
+dpll_pin_get(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req& req)
+{
+	auto ret = dpll_pin_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_pin_get_prepare(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_GET, 1);
+	dpll_pin_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<dpll_pin_get_rsp>>
+dpll_pin_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		const ynl_cpp::projection *proj)
+{
+	return dpll_pin_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<dpll_pin_get_rsp>
+dpll_pin_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = dpll_pin_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DPLL_CMD_PIN_GET - dump */
-std::unique_ptr<dpll_pin_get_list>
-dpll_pin_get_dump(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req_dump& req)
+static void
+dpll_pin_get_dump_put(struct nlmsghdr *nlh, dpll_pin_get_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, DPLL_A_PIN_ID, req.id.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<dpll_pin_get_list>>
+dpll_pin_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<dpll_pin_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &dpll_pin_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<dpll_pin_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = dpll_pin_get_rsp_parse;
 	yds.rsp_cmd = DPLL_CMD_PIN_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &dpll_pin_nest;
 
-	if (req.id.has_value())
-		ynl_attr_put_u32(nlh, DPLL_A_PIN_ID, req.id.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<dpll_pin_get_list>>
+dpll_pin_get_dump_ex(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req_dump& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_GET, 1);
+	dpll_pin_get_dump_put(nlh, req);
+
+	return dpll_pin_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<dpll_pin_get_list>
+dpll_pin_get_dump(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req_dump& req)
+{
+	auto ret = dpll_pin_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_pin_get_dump_prepare(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_GET, 1);
+	dpll_pin_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<dpll_pin_get_list>>
+dpll_pin_get_dump_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return dpll_pin_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<dpll_pin_get_list>
+dpll_pin_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = dpll_pin_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* DPLL_CMD_PIN_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<dpll_pin_get_ntf>());
+
+static void *dpll_pin_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) dpll_pin_get_ntf())->obj;
+}
+
+static void dpll_pin_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	dpll_pin_get_ntf *rsp = (dpll_pin_get_ntf *)ntf;
+
+	rsp->~dpll_pin_get_ntf();
+	::free(rsp);
+}
+
 /* ============== DPLL_CMD_PIN_SET ============== */
 /* DPLL_CMD_PIN_SET - do */
-int dpll_pin_set(ynl_cpp::ynl_socket&  ys, dpll_pin_set_req& req)
+static void dpll_pin_set_put(struct nlmsghdr *nlh, dpll_pin_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &dpll_pin_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 64 <= YNL_SOCKET_BUFFER_SIZE);
 
 	if (req.id.has_value())
-		ynl_attr_put_u32(nlh, DPLL_A_PIN_ID, req.id.value());
+		ynl_attr_put_u32_unchecked(nlh, DPLL_A_PIN_ID, req.id.value());
 	if (req.frequency.has_value())
-		ynl_attr_put_u64(nlh, DPLL_A_PIN_FREQUENCY, req.frequency.value());
+		ynl_attr_put_u64_unchecked(nlh, DPLL_A_PIN_FREQUENCY, req.frequency.value());
 	if (req.direction.has_value())
-		ynl_attr_put_u32(nlh, DPLL_A_PIN_DIRECTION, req.direction.value());
+		ynl_attr_put_u32_unchecked(nlh, DPLL_A_PIN_DIRECTION, req.direction.value());
 	if (req.prio.has_value())
-		ynl_attr_put_u32(nlh, DPLL_A_PIN_PRIO, req.prio.value());
+		ynl_attr_put_u32_unchecked(nlh, DPLL_A_PIN_PRIO, req.prio.value());
 	if (req.state.has_value())
-		ynl_attr_put_u32(nlh, DPLL_A_PIN_STATE, req.state.value());
+		ynl_attr_put_u32_unchecked(nlh, DPLL_A_PIN_STATE, req.state.value());
+	if (req.phase_adjust.has_value())
+		ynl_attr_put_s32_unchecked(nlh, DPLL_A_PIN_PHASE_ADJUST, req.phase_adjust.value());
+	if (req.esync_frequency.has_value())
+		ynl_attr_put_u64_unchecked(nlh, DPLL_A_PIN_ESYNC_FREQUENCY, req.esync_frequency.value());
 	for (unsigned int i = 0; i < req.parent_device.size(); i++)
 		dpll_pin_parent_device_put(nlh, DPLL_A_PIN_PARENT_DEVICE, req.parent_device[i]);
 	for (unsigned int i = 0; i < req.parent_pin.size(); i++)
 		dpll_pin_parent_pin_put(nlh, DPLL_A_PIN_PARENT_PIN, req.parent_pin[i]);
-	if (req.phase_adjust.has_value())
-		ynl_attr_put_s32(nlh, DPLL_A_PIN_PHASE_ADJUST, req.phase_adjust.value());
-	if (req.esync_frequency.has_value())
-		ynl_attr_put_u64(nlh, DPLL_A_PIN_ESYNC_FREQUENCY, req.esync_frequency.value());
+}
+
+static ynl_cpp::result<void>
+dpll_pin_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &dpll_pin_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+dpll_pin_set_ex(ynl_cpp::ynl_socket&  ys, dpll_pin_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_SET, 1);
+	dpll_pin_set_put(nlh, req);
+
+	return dpll_pin_set_exec(ys, nlh);
+}
+
+int dpll_pin_set(ynl_cpp::ynl_socket&  ys, dpll_pin_set_req& req)
+{
+	auto ret = dpll_pin_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_pin_set_prepare(ynl_cpp::ynl_socket&  ys, dpll_pin_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, DPLL_CMD_PIN_SET, 1);
+	dpll_pin_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+dpll_pin_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return dpll_pin_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int dpll_pin_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = dpll_pin_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+dpll_pin_set_batch(ynl_cpp::msg_batch& batch, dpll_pin_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(DPLL_CMD_PIN_SET, 1);
+	dpll_pin_set_put(nlh, req);
+	return batch.msg_end(nlh, &dpll_pin_nest);
 }
 
 static constexpr std::array<ynl_ntf_info, DPLL_CMD_PIN_CHANGE_NTF + 1> dpll_ntf_info = []() {
@@ -900,26 +1337,44 @@ static constexpr std::array<ynl_ntf_info, DPLL_CMD_PIN_CHANGE_NTF + 1> dpll_ntf_
 	arr[DPLL_CMD_DEVICE_CREATE_NTF] =  {
 		.cb		= dpll_device_get_rsp_parse,
 		.policy		= &dpll_nest,
+		.alloc_sz	= sizeof(dpll_device_get_ntf),
+		.free		= dpll_device_get_ntf_free,
+		.init		= dpll_device_get_ntf_init,
 	};
 	arr[DPLL_CMD_DEVICE_DELETE_NTF] =  {
 		.cb		= dpll_device_get_rsp_parse,
 		.policy		= &dpll_nest,
+		.alloc_sz	= sizeof(dpll_device_get_ntf),
+		.free		= dpll_device_get_ntf_free,
+		.init		= dpll_device_get_ntf_init,
 	};
 	arr[DPLL_CMD_DEVICE_CHANGE_NTF] =  {
 		.cb		= dpll_device_get_rsp_parse,
 		.policy		= &dpll_nest,
+		.alloc_sz	= sizeof(dpll_device_get_ntf),
+		.free		= dpll_device_get_ntf_free,
+		.init		= dpll_device_get_ntf_init,
 	};
 	arr[DPLL_CMD_PIN_CREATE_NTF] =  {
 		.cb		= dpll_pin_get_rsp_parse,
 		.policy		= &dpll_pin_nest,
+		.alloc_sz	= sizeof(dpll_pin_get_ntf),
+		.free		= dpll_pin_get_ntf_free,
+		.init		= dpll_pin_get_ntf_init,
 	};
 	arr[DPLL_CMD_PIN_DELETE_NTF] =  {
 		.cb		= dpll_pin_get_rsp_parse,
 		.policy		= &dpll_pin_nest,
+		.alloc_sz	= sizeof(dpll_pin_get_ntf),
+		.free		= dpll_pin_get_ntf_free,
+		.init		= dpll_pin_get_ntf_init,
 	};
 	arr[DPLL_CMD_PIN_CHANGE_NTF] =  {
 		.cb		= dpll_pin_get_rsp_parse,
 		.policy		= &dpll_pin_nest,
+		.alloc_sz	= sizeof(dpll_pin_get_ntf),
+		.free		= dpll_pin_get_ntf_free,
+		.init		= dpll_pin_get_ntf_init,
 	};
 	return arr;
 } ();
@@ -55,6 +55,17 @@ struct dpll_pin_parent_pin {
 	std::optional<dpll_pin_state> state;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest dpll_frequency_range_nest;
+extern struct ynl_policy_nest dpll_pin_parent_device_nest;
+extern struct ynl_policy_nest dpll_pin_parent_pin_nest;
+extern struct ynl_policy_nest dpll_nest;
+extern struct ynl_policy_nest dpll_pin_nest;
+int dpll_pin_parent_device_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const dpll_pin_parent_device&  obj);
+int dpll_pin_parent_pin_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			    const dpll_pin_parent_pin&  obj);
+
 /* ============== DPLL_CMD_DEVICE_ID_GET ============== */
 /* DPLL_CMD_DEVICE_ID_GET - do */
 struct dpll_device_id_get_req {
@@ -73,6 +84,18 @@ struct dpll_device_id_get_rsp {
  */
 std::unique_ptr<dpll_device_id_get_rsp>
 dpll_device_id_get(ynl_cpp::ynl_socket&  ys, dpll_device_id_get_req& req);
+ynl_cpp::result<std::unique_ptr<dpll_device_id_get_rsp>>
+dpll_device_id_get_ex(ynl_cpp::ynl_socket&  ys, dpll_device_id_get_req& req,
+		      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_device_id_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   dpll_device_id_get_req& req);
+std::unique_ptr<dpll_device_id_get_rsp>
+dpll_device_id_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<dpll_device_id_get_rsp>>
+dpll_device_id_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DPLL_CMD_DEVICE_GET ============== */
 /* DPLL_CMD_DEVICE_GET - do */
@@ -80,6 +103,9 @@ struct dpll_device_get_req {
 	std::optional<__u32> id;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t dpll_device_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct dpll_device_get_rsp {
 	std::optional<__u32> id;
 	std::string module_name;
@@ -98,6 +124,16 @@ struct dpll_device_get_rsp {
  */
 std::unique_ptr<dpll_device_get_rsp>
 dpll_device_get(ynl_cpp::ynl_socket&  ys, dpll_device_get_req& req);
+ynl_cpp::result<std::unique_ptr<dpll_device_get_rsp>>
+dpll_device_get_ex(ynl_cpp::ynl_socket&  ys, dpll_device_get_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_device_get_prepare(ynl_cpp::ynl_socket&  ys, dpll_device_get_req& req);
+std::unique_ptr<dpll_device_get_rsp>
+dpll_device_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<dpll_device_get_rsp>>
+dpll_device_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
 
 /* DPLL_CMD_DEVICE_GET - dump */
 struct dpll_device_get_list {
@@ -106,9 +142,18 @@ struct dpll_device_get_list {
 
 std::unique_ptr<dpll_device_get_list>
 dpll_device_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<dpll_device_get_list>>
+dpll_device_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* DPLL_CMD_DEVICE_GET - notify */
 struct dpll_device_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	dpll_device_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== DPLL_CMD_DEVICE_SET ============== */
@@ -117,10 +162,22 @@ struct dpll_device_set_req {
 	std::optional<__u32> id;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t dpll_device_set_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 /*
  * Set attributes for a DPLL device
  */
 int dpll_device_set(ynl_cpp::ynl_socket&  ys, dpll_device_set_req& req);
+ynl_cpp::result<void>
+dpll_device_set_ex(ynl_cpp::ynl_socket&  ys, dpll_device_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_device_set_prepare(ynl_cpp::ynl_socket&  ys, dpll_device_set_req& req);
+int dpll_device_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+dpll_device_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+dpll_device_set_batch(ynl_cpp::msg_batch& batch, dpll_device_set_req& req);
 
 /* ============== DPLL_CMD_PIN_ID_GET ============== */
 /* DPLL_CMD_PIN_ID_GET - do */
@@ -143,6 +200,16 @@ struct dpll_pin_id_get_rsp {
  */
 std::unique_ptr<dpll_pin_id_get_rsp>
 dpll_pin_id_get(ynl_cpp::ynl_socket&  ys, dpll_pin_id_get_req& req);
+ynl_cpp::result<std::unique_ptr<dpll_pin_id_get_rsp>>
+dpll_pin_id_get_ex(ynl_cpp::ynl_socket&  ys, dpll_pin_id_get_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_pin_id_get_prepare(ynl_cpp::ynl_socket&  ys, dpll_pin_id_get_req& req);
+std::unique_ptr<dpll_pin_id_get_rsp>
+dpll_pin_id_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<dpll_pin_id_get_rsp>>
+dpll_pin_id_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
 
 /* ============== DPLL_CMD_PIN_GET ============== */
 /* DPLL_CMD_PIN_GET - do */
@@ -150,6 +217,9 @@ struct dpll_pin_get_req {
 	std::optional<__u32> id;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t dpll_pin_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct dpll_pin_get_rsp {
 	std::optional<__u32> id;
 	std::string board_label;
@@ -182,21 +252,50 @@ struct dpll_pin_get_rsp {
  */
 std::unique_ptr<dpll_pin_get_rsp>
 dpll_pin_get(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req& req);
+ynl_cpp::result<std::unique_ptr<dpll_pin_get_rsp>>
+dpll_pin_get_ex(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req& req,
+		const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_pin_get_prepare(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req& req);
+std::unique_ptr<dpll_pin_get_rsp>
+dpll_pin_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<dpll_pin_get_rsp>>
+dpll_pin_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		const ynl_cpp::projection *proj = nullptr);
 
 /* DPLL_CMD_PIN_GET - dump */
 struct dpll_pin_get_req_dump {
 	std::optional<__u32> id;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t dpll_pin_get_req_dump_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct dpll_pin_get_list {
 	std::list<dpll_pin_get_rsp> objs;
 };
 
 std::unique_ptr<dpll_pin_get_list>
 dpll_pin_get_dump(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<dpll_pin_get_list>>
+dpll_pin_get_dump_ex(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req_dump& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_pin_get_dump_prepare(ynl_cpp::ynl_socket&  ys, dpll_pin_get_req_dump& req);
+std::unique_ptr<dpll_pin_get_list>
+dpll_pin_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<dpll_pin_get_list>>
+dpll_pin_get_dump_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
 
 /* DPLL_CMD_PIN_GET - notify */
 struct dpll_pin_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	dpll_pin_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== DPLL_CMD_PIN_SET ============== */
@@ -217,6 +316,15 @@ struct dpll_pin_set_req {
  * Set attributes of a target pin
  */
 int dpll_pin_set(ynl_cpp::ynl_socket&  ys, dpll_pin_set_req& req);
+ynl_cpp::result<void>
+dpll_pin_set_ex(ynl_cpp::ynl_socket&  ys, dpll_pin_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+dpll_pin_set_prepare(ynl_cpp::ynl_socket&  ys, dpll_pin_set_req& req);
+int dpll_pin_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+dpll_pin_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+dpll_pin_set_batch(ynl_cpp::msg_batch& batch, dpll_pin_set_req& req);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_DPLL_GEN_H */
@@ -1118,20 +1118,20 @@ int ethtool_header_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_HEADER_DEV_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dev_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_HEADER_DEV_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->dev_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->dev_name.assign(ynl_attr_get_str(attr));
 		} else if (type == ETHTOOL_A_HEADER_FLAGS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->flags = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_HEADER_PHY_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->phy_index = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1164,12 +1164,12 @@ int ethtool_pause_stat_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_PAUSE_STAT_TX_FRAMES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->tx_frames = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == ETHTOOL_A_PAUSE_STAT_RX_FRAMES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->rx_frames = (__u64)ynl_attr_get_u64(attr);
 		}
 	}
@@ -1187,20 +1187,20 @@ int ethtool_ts_stat_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_TS_STAT_TX_PKTS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->tx_pkts = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == ETHTOOL_A_TS_STAT_TX_LOST) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->tx_lost = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == ETHTOOL_A_TS_STAT_TX_ERR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->tx_err = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == ETHTOOL_A_TS_STAT_TX_ONESTEP_PKTS_UNCONFIRMED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->tx_onestep_pkts_unconfirmed = (__u64)ynl_attr_get_uint(attr);
 		}
 	}
@@ -1234,12 +1234,12 @@ int ethtool_ts_hwtstamp_provider_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_TS_HWTSTAMP_PROVIDER_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_TS_HWTSTAMP_PROVIDER_QUALIFIER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->qualifier = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1274,20 +1274,14 @@ int ethtool_fec_stat_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_FEC_STAT_CORRECTED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->corrected.assign(data, data + len);
 		} else if (type == ETHTOOL_A_FEC_STAT_UNCORR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->uncorr.assign(data, data + len);
 		} else if (type == ETHTOOL_A_FEC_STAT_CORR_BITS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->corr_bits.assign(data, data + len);
@@ -1307,12 +1301,12 @@ int ethtool_c33_pse_pw_limit_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_C33_PSE_PW_LIMIT_MIN) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->min = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_C33_PSE_PW_LIMIT_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->max = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1330,28 +1324,28 @@ int ethtool_mm_stat_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_MM_STAT_REASSEMBLY_ERRORS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->reassembly_errors = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == ETHTOOL_A_MM_STAT_SMD_ERRORS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->smd_errors = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == ETHTOOL_A_MM_STAT_REASSEMBLY_OK) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->reassembly_ok = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == ETHTOOL_A_MM_STAT_RX_FRAG_COUNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->rx_frag_count = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == ETHTOOL_A_MM_STAT_TX_FRAG_COUNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->tx_frag_count = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == ETHTOOL_A_MM_STAT_HOLD_COUNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->hold_count = (__u64)ynl_attr_get_u64(attr);
 		}
 	}
@@ -1386,16 +1380,16 @@ int ethtool_irq_moderation_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_IRQ_MODERATION_USEC) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->usec = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_IRQ_MODERATION_PKTS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->pkts = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_IRQ_MODERATION_COMPS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->comps = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1413,16 +1407,16 @@ int ethtool_cable_result_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_CABLE_RESULT_PAIR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->pair = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_CABLE_RESULT_CODE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->code = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_CABLE_RESULT_SRC) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->src = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1440,16 +1434,16 @@ int ethtool_cable_fault_length_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_CABLE_FAULT_LENGTH_PAIR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->pair = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_CABLE_FAULT_LENGTH_CM) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->cm = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_CABLE_FAULT_LENGTH_SRC) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->src = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1467,16 +1461,16 @@ int ethtool_stats_grp_hist_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_STATS_GRP_HIST_BKT_LOW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->hist_bkt_low = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_STATS_GRP_HIST_BKT_HI) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->hist_bkt_hi = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_STATS_GRP_HIST_VAL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->hist_val = (__u64)ynl_attr_get_u64(attr);
 		}
 	}
@@ -1511,16 +1505,15 @@ int ethtool_bitset_bit_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_BITSET_BIT_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_BITSET_BIT_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
 		} else if (type == ETHTOOL_A_BITSET_BIT_VALUE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->value = true;
 		}
 	}
 
@@ -1537,12 +1530,12 @@ int ethtool_tunnel_udp_entry_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_TUNNEL_UDP_ENTRY_PORT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->port = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == ETHTOOL_A_TUNNEL_UDP_ENTRY_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->type = (int)ynl_attr_get_u32(attr);
 		}
 	}
@@ -1575,13 +1568,13 @@ int ethtool_string_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_STRING_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_STRING_VALUE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->value.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->value.assign(ynl_attr_get_str(attr));
 		}
 	}
 
@@ -1653,19 +1646,19 @@ int ethtool_cable_nest_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_CABLE_NEST_RESULT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_cable_result_nest;
-			parg.data = &dst->result;
+			parg.data = &dst->result.emplace();
 			if (ethtool_cable_result_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_CABLE_NEST_FAULT_LENGTH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_cable_fault_length_nest;
-			parg.data = &dst->fault_length;
+			parg.data = &dst->fault_length.emplace();
 			if (ethtool_cable_fault_length_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -1687,44 +1680,44 @@ int ethtool_stats_grp_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_STATS_GRP_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_STATS_GRP_SS_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ss_id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_STATS_GRP_STAT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->stat = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == ETHTOOL_A_STATS_GRP_HIST_RX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_stats_grp_hist_nest;
-			parg.data = &dst->hist_rx;
+			parg.data = &dst->hist_rx.emplace();
 			if (ethtool_stats_grp_hist_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_STATS_GRP_HIST_TX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_stats_grp_hist_nest;
-			parg.data = &dst->hist_tx;
+			parg.data = &dst->hist_tx.emplace();
 			if (ethtool_stats_grp_hist_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_STATS_GRP_HIST_BKT_LOW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->hist_bkt_low = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_STATS_GRP_HIST_BKT_HI) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->hist_bkt_hi = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_STATS_GRP_HIST_VAL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->hist_val = (__u64)ynl_attr_get_u64(attr);
 		}
 	}
@@ -1870,29 +1863,24 @@ int ethtool_bitset_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_BITSET_NOMASK) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->nomask = true;
 		} else if (type == ETHTOOL_A_BITSET_SIZE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->size = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_BITSET_BITS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_bits_nest;
-			parg.data = &dst->bits;
+			parg.data = &dst->bits.emplace();
 			if (ethtool_bitset_bits_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_BITSET_VALUE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->value.assign(data, data + len);
 		} else if (type == ETHTOOL_A_BITSET_MASK) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->mask.assign(data, data + len);
@@ -1937,12 +1925,12 @@ int ethtool_stringset_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_STRINGSET_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_STRINGSET_COUNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->count = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_STRINGSET_STRINGS) {
 			n_strings++;
@@ -1984,15 +1972,15 @@ int ethtool_tunnel_udp_table_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_TUNNEL_UDP_TABLE_SIZE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->size = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_TUNNEL_UDP_TABLE_TYPES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->types;
+			parg.data = &dst->types.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TUNNEL_UDP_TABLE_ENTRY) {
@@ -2082,11 +2070,11 @@ int ethtool_tunnel_udp_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == ETHTOOL_A_TUNNEL_UDP_TABLE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_tunnel_udp_table_nest;
-			parg.data = &dst->table;
+			parg.data = &dst->table.emplace();
 			if (ethtool_tunnel_udp_table_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -2110,20 +2098,23 @@ int ethtool_strset_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_STRSET_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_STRSET_STRINGSETS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_stringsets_nest;
-			parg.data = &dst->stringsets;
+			parg.data = &dst->stringsets.emplace();
 			if (ethtool_stringsets_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -2132,71 +2123,185 @@ int ethtool_strset_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_strset_get_rsp>
-ethtool_strset_get(ynl_cpp::ynl_socket&  ys, ethtool_strset_get_req& req)
+static void
+ethtool_strset_get_put(struct nlmsghdr *nlh, ethtool_strset_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 4 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.counts_only)
+		ynl_attr_put_unchecked(nlh, ETHTOOL_A_STRSET_COUNTS_ONLY, NULL, 0);
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_STRSET_HEADER, req.header.value());
+	if (req.stringsets.has_value())
+		ethtool_stringsets_put(nlh, ETHTOOL_A_STRSET_STRINGSETS, req.stringsets.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_strset_get_rsp>>
+ethtool_strset_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_strset_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_STRSET_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_strset_nest;
 	yrs.yarg.rsp_policy = &ethtool_strset_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_STRSET_HEADER, req.header.value());
-	if (req.stringsets.has_value())
-		ethtool_stringsets_put(nlh, ETHTOOL_A_STRSET_STRINGSETS, req.stringsets.value());
-	if (req.counts_only)
-		ynl_attr_put(nlh, ETHTOOL_A_STRSET_COUNTS_ONLY, NULL, 0);
-
 	rsp.reset(new ethtool_strset_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_strset_get_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_STRSET_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_strset_get_rsp>>
+ethtool_strset_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_strset_get_req& req,
+		      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_STRSET_GET, 1);
+	ethtool_strset_get_put(nlh, req);
+
+	return ethtool_strset_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_strset_get_rsp>
+ethtool_strset_get(ynl_cpp::ynl_socket&  ys, ethtool_strset_get_req& req)
+{
+	auto ret = ethtool_strset_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_strset_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   ethtool_strset_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_STRSET_GET, 1);
+	ethtool_strset_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_strset_get_rsp>>
+ethtool_strset_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj)
+{
+	return ethtool_strset_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_strset_get_rsp>
+ethtool_strset_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_strset_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_STRSET_GET - dump */
-std::unique_ptr<ethtool_strset_get_list>
-ethtool_strset_get_dump(ynl_cpp::ynl_socket&  ys,
-			ethtool_strset_get_req_dump& req)
+static void
+ethtool_strset_get_dump_put(struct nlmsghdr *nlh,
+			    ethtool_strset_get_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 4 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.counts_only)
+		ynl_attr_put_unchecked(nlh, ETHTOOL_A_STRSET_COUNTS_ONLY, NULL, 0);
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_STRSET_HEADER, req.header.value());
+	if (req.stringsets.has_value())
+		ethtool_stringsets_put(nlh, ETHTOOL_A_STRSET_STRINGSETS, req.stringsets.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_strset_get_list>>
+ethtool_strset_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			     const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_strset_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_strset_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_strset_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_strset_get_rsp_parse;
 	yds.rsp_cmd = ETHTOOL_MSG_STRSET_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_STRSET_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_strset_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_STRSET_HEADER, req.header.value());
-	if (req.stringsets.has_value())
-		ethtool_stringsets_put(nlh, ETHTOOL_A_STRSET_STRINGSETS, req.stringsets.value());
-	if (req.counts_only)
-		ynl_attr_put(nlh, ETHTOOL_A_STRSET_COUNTS_ONLY, NULL, 0);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_strset_get_list>>
+ethtool_strset_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_strset_get_req_dump& req,
+			   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_STRSET_GET, 1);
+	ethtool_strset_get_dump_put(nlh, req);
+
+	return ethtool_strset_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_strset_get_list>
+ethtool_strset_get_dump(ynl_cpp::ynl_socket&  ys,
+			ethtool_strset_get_req_dump& req)
+{
+	auto ret = ethtool_strset_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_strset_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_strset_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_STRSET_GET, 1);
+	ethtool_strset_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_strset_get_list>>
+ethtool_strset_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj)
+{
+	return ethtool_strset_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_strset_get_list>
+ethtool_strset_get_dump(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_strset_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== ETHTOOL_MSG_LINKINFO_GET ============== */
 /* ETHTOOL_MSG_LINKINFO_GET - do */
 int ethtool_linkinfo_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -2212,33 +2317,36 @@ int ethtool_linkinfo_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_LINKINFO_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_LINKINFO_PORT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->port = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_LINKINFO_PHYADDR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->phyaddr = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_LINKINFO_TP_MDIX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->tp_mdix = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_LINKINFO_TP_MDIX_CTRL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->tp_mdix_ctrl = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_LINKINFO_TRANSCEIVER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->transceiver = (__u8)ynl_attr_get_u8(attr);
 		}
 	}
@@ -2246,97 +2354,283 @@ int ethtool_linkinfo_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_linkinfo_get_rsp>
-ethtool_linkinfo_get(ynl_cpp::ynl_socket&  ys, ethtool_linkinfo_get_req& req)
+static void
+ethtool_linkinfo_get_put(struct nlmsghdr *nlh, ethtool_linkinfo_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_LINKINFO_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_linkinfo_get_rsp>>
+ethtool_linkinfo_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_linkinfo_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKINFO_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_linkinfo_nest;
 	yrs.yarg.rsp_policy = &ethtool_linkinfo_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_LINKINFO_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_linkinfo_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_linkinfo_get_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_LINKINFO_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_linkinfo_get_rsp>>
+ethtool_linkinfo_get_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_linkinfo_get_req& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKINFO_GET, 1);
+	ethtool_linkinfo_get_put(nlh, req);
+
+	return ethtool_linkinfo_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_linkinfo_get_rsp>
+ethtool_linkinfo_get(ynl_cpp::ynl_socket&  ys, ethtool_linkinfo_get_req& req)
+{
+	auto ret = ethtool_linkinfo_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkinfo_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_linkinfo_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKINFO_GET, 1);
+	ethtool_linkinfo_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_linkinfo_get_rsp>>
+ethtool_linkinfo_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_linkinfo_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_linkinfo_get_rsp>
+ethtool_linkinfo_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_linkinfo_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_LINKINFO_GET - dump */
-std::unique_ptr<ethtool_linkinfo_get_list>
-ethtool_linkinfo_get_dump(ynl_cpp::ynl_socket&  ys,
-			  ethtool_linkinfo_get_req_dump& req)
+static void
+ethtool_linkinfo_get_dump_put(struct nlmsghdr *nlh,
+			      ethtool_linkinfo_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_LINKINFO_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_linkinfo_get_list>>
+ethtool_linkinfo_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_linkinfo_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_linkinfo_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_linkinfo_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_linkinfo_get_rsp_parse;
 	yds.rsp_cmd = ETHTOOL_MSG_LINKINFO_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKINFO_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_linkinfo_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_LINKINFO_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ETHTOOL_MSG_LINKINFO_GET - notify */
-/* ============== ETHTOOL_MSG_LINKINFO_SET ============== */
-/* ETHTOOL_MSG_LINKINFO_SET - do */
-int ethtool_linkinfo_set(ynl_cpp::ynl_socket&  ys,
-			 ethtool_linkinfo_set_req& req)
+ynl_cpp::result<std::unique_ptr<ethtool_linkinfo_get_list>>
+ethtool_linkinfo_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_linkinfo_get_req_dump& req,
+			     const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKINFO_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_linkinfo_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_LINKINFO_HEADER, req.header.value());
-	if (req.port.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_LINKINFO_PORT, req.port.value());
-	if (req.phyaddr.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_LINKINFO_PHYADDR, req.phyaddr.value());
-	if (req.tp_mdix.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_LINKINFO_TP_MDIX, req.tp_mdix.value());
-	if (req.tp_mdix_ctrl.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_LINKINFO_TP_MDIX_CTRL, req.tp_mdix_ctrl.value());
-	if (req.transceiver.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_LINKINFO_TRANSCEIVER, req.transceiver.value());
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKINFO_GET, 1);
+	ethtool_linkinfo_get_dump_put(nlh, req);
 
-	err = ynl_exec(ys, nlh, &yrs);
-	if (err < 0)
-		return -1;
+	return ethtool_linkinfo_get_dump_exec(ys, nlh, proj);
+}
 
-	return 0;
+std::unique_ptr<ethtool_linkinfo_get_list>
+ethtool_linkinfo_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ethtool_linkinfo_get_req_dump& req)
+{
+	auto ret = ethtool_linkinfo_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
 }
 
-/* ============== ETHTOOL_MSG_LINKMODES_GET ============== */
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkinfo_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_linkinfo_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKINFO_GET, 1);
+	ethtool_linkinfo_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_linkinfo_get_list>>
+ethtool_linkinfo_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return ethtool_linkinfo_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_linkinfo_get_list>
+ethtool_linkinfo_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_linkinfo_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ETHTOOL_MSG_LINKINFO_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_linkinfo_get_ntf>());
+
+static void *ethtool_linkinfo_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_linkinfo_get_ntf())->obj;
+}
+
+static void ethtool_linkinfo_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_linkinfo_get_ntf *rsp = (ethtool_linkinfo_get_ntf *)ntf;
+
+	rsp->~ethtool_linkinfo_get_ntf();
+	::free(rsp);
+}
+
+/* ============== ETHTOOL_MSG_LINKINFO_SET ============== */
+/* ETHTOOL_MSG_LINKINFO_SET - do */
+static void
+ethtool_linkinfo_set_put(struct nlmsghdr *nlh, ethtool_linkinfo_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 40 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.port.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_LINKINFO_PORT, req.port.value());
+	if (req.phyaddr.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_LINKINFO_PHYADDR, req.phyaddr.value());
+	if (req.tp_mdix.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_LINKINFO_TP_MDIX, req.tp_mdix.value());
+	if (req.tp_mdix_ctrl.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_LINKINFO_TP_MDIX_CTRL, req.tp_mdix_ctrl.value());
+	if (req.transceiver.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_LINKINFO_TRANSCEIVER, req.transceiver.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_LINKINFO_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_linkinfo_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_linkinfo_nest;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_linkinfo_set_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_linkinfo_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKINFO_SET, 1);
+	ethtool_linkinfo_set_put(nlh, req);
+
+	return ethtool_linkinfo_set_exec(ys, nlh);
+}
+
+int ethtool_linkinfo_set(ynl_cpp::ynl_socket&  ys,
+			 ethtool_linkinfo_set_req& req)
+{
+	auto ret = ethtool_linkinfo_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkinfo_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_linkinfo_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKINFO_SET, 1);
+	ethtool_linkinfo_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_linkinfo_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	return ethtool_linkinfo_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_linkinfo_set(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_linkinfo_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_linkinfo_set_batch(ynl_cpp::msg_batch& batch,
+			   ethtool_linkinfo_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_LINKINFO_SET, 1);
+	ethtool_linkinfo_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_linkinfo_nest);
+}
+
+/* ============== ETHTOOL_MSG_LINKMODES_GET ============== */
 /* ETHTOOL_MSG_LINKMODES_GET - do */
 int ethtool_linkmodes_get_rsp_parse(const struct nlmsghdr *nlh,
 				    struct ynl_parse_arg *yarg)
@@ -2351,57 +2645,60 @@ int ethtool_linkmodes_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_LINKMODES_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_LINKMODES_AUTONEG) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->autoneg = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_LINKMODES_OURS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->ours;
+			parg.data = &dst->ours.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_LINKMODES_PEER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->peer;
+			parg.data = &dst->peer.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_LINKMODES_SPEED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->speed = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_LINKMODES_DUPLEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->duplex = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_LINKMODES_MASTER_SLAVE_CFG) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->master_slave_cfg = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_LINKMODES_MASTER_SLAVE_STATE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->master_slave_state = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_LINKMODES_LANES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->lanes = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_LINKMODES_RATE_MATCHING) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->rate_matching = (__u8)ynl_attr_get_u8(attr);
 		}
 	}
@@ -2409,102 +2706,289 @@ int ethtool_linkmodes_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_linkmodes_get_rsp>
-ethtool_linkmodes_get(ynl_cpp::ynl_socket&  ys, ethtool_linkmodes_get_req& req)
+static void
+ethtool_linkmodes_get_put(struct nlmsghdr *nlh, ethtool_linkmodes_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_LINKMODES_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_linkmodes_get_rsp>>
+ethtool_linkmodes_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_linkmodes_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKMODES_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_linkmodes_nest;
 	yrs.yarg.rsp_policy = &ethtool_linkmodes_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_LINKMODES_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_linkmodes_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_linkmodes_get_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_LINKMODES_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_linkmodes_get_rsp>>
+ethtool_linkmodes_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ethtool_linkmodes_get_req& req,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKMODES_GET, 1);
+	ethtool_linkmodes_get_put(nlh, req);
+
+	return ethtool_linkmodes_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_linkmodes_get_rsp>
+ethtool_linkmodes_get(ynl_cpp::ynl_socket&  ys, ethtool_linkmodes_get_req& req)
+{
+	auto ret = ethtool_linkmodes_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkmodes_get_prepare(ynl_cpp::ynl_socket&  ys,
+			      ethtool_linkmodes_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKMODES_GET, 1);
+	ethtool_linkmodes_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_linkmodes_get_rsp>>
+ethtool_linkmodes_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return ethtool_linkmodes_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_linkmodes_get_rsp>
+ethtool_linkmodes_get(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_linkmodes_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_LINKMODES_GET - dump */
-std::unique_ptr<ethtool_linkmodes_get_list>
-ethtool_linkmodes_get_dump(ynl_cpp::ynl_socket&  ys,
-			   ethtool_linkmodes_get_req_dump& req)
+static void
+ethtool_linkmodes_get_dump_put(struct nlmsghdr *nlh,
+			       ethtool_linkmodes_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_LINKMODES_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_linkmodes_get_list>>
+ethtool_linkmodes_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+				const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_linkmodes_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_linkmodes_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_linkmodes_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_linkmodes_get_rsp_parse;
 	yds.rsp_cmd = ETHTOOL_MSG_LINKMODES_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKMODES_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_linkmodes_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_LINKMODES_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_linkmodes_get_list>>
+ethtool_linkmodes_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ethtool_linkmodes_get_req_dump& req,
+			      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKMODES_GET, 1);
+	ethtool_linkmodes_get_dump_put(nlh, req);
+
+	return ethtool_linkmodes_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_linkmodes_get_list>
+ethtool_linkmodes_get_dump(ynl_cpp::ynl_socket&  ys,
+			   ethtool_linkmodes_get_req_dump& req)
+{
+	auto ret = ethtool_linkmodes_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkmodes_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				   ethtool_linkmodes_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKMODES_GET, 1);
+	ethtool_linkmodes_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_linkmodes_get_list>>
+ethtool_linkmodes_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl,
+			      const ynl_cpp::projection *proj)
+{
+	return ethtool_linkmodes_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_linkmodes_get_list>
+ethtool_linkmodes_get_dump(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_linkmodes_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_LINKMODES_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_linkmodes_get_ntf>());
+
+static void *ethtool_linkmodes_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_linkmodes_get_ntf())->obj;
+}
+
+static void ethtool_linkmodes_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_linkmodes_get_ntf *rsp = (ethtool_linkmodes_get_ntf *)ntf;
+
+	rsp->~ethtool_linkmodes_get_ntf();
+	::free(rsp);
+}
+
 /* ============== ETHTOOL_MSG_LINKMODES_SET ============== */
 /* ETHTOOL_MSG_LINKMODES_SET - do */
-int ethtool_linkmodes_set(ynl_cpp::ynl_socket&  ys,
-			  ethtool_linkmodes_set_req& req)
+static void
+ethtool_linkmodes_set_put(struct nlmsghdr *nlh, ethtool_linkmodes_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKMODES_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_linkmodes_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 56 <= YNL_SOCKET_BUFFER_SIZE);
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_LINKMODES_HEADER, req.header.value());
 	if (req.autoneg.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_LINKMODES_AUTONEG, req.autoneg.value());
-	if (req.ours.has_value())
-		ethtool_bitset_put(nlh, ETHTOOL_A_LINKMODES_OURS, req.ours.value());
-	if (req.peer.has_value())
-		ethtool_bitset_put(nlh, ETHTOOL_A_LINKMODES_PEER, req.peer.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_LINKMODES_AUTONEG, req.autoneg.value());
 	if (req.speed.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_LINKMODES_SPEED, req.speed.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_LINKMODES_SPEED, req.speed.value());
 	if (req.duplex.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_LINKMODES_DUPLEX, req.duplex.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_LINKMODES_DUPLEX, req.duplex.value());
 	if (req.master_slave_cfg.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_LINKMODES_MASTER_SLAVE_CFG, req.master_slave_cfg.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_LINKMODES_MASTER_SLAVE_CFG, req.master_slave_cfg.value());
 	if (req.master_slave_state.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_LINKMODES_MASTER_SLAVE_STATE, req.master_slave_state.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_LINKMODES_MASTER_SLAVE_STATE, req.master_slave_state.value());
 	if (req.lanes.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_LINKMODES_LANES, req.lanes.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_LINKMODES_LANES, req.lanes.value());
 	if (req.rate_matching.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_LINKMODES_RATE_MATCHING, req.rate_matching.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_LINKMODES_RATE_MATCHING, req.rate_matching.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_LINKMODES_HEADER, req.header.value());
+	if (req.ours.has_value())
+		ethtool_bitset_put(nlh, ETHTOOL_A_LINKMODES_OURS, req.ours.value());
+	if (req.peer.has_value())
+		ethtool_bitset_put(nlh, ETHTOOL_A_LINKMODES_PEER, req.peer.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_linkmodes_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_linkmodes_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_linkmodes_set_ex(ynl_cpp::ynl_socket&  ys,
+			 ethtool_linkmodes_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKMODES_SET, 1);
+	ethtool_linkmodes_set_put(nlh, req);
+
+	return ethtool_linkmodes_set_exec(ys, nlh);
+}
+
+int ethtool_linkmodes_set(ynl_cpp::ynl_socket&  ys,
+			  ethtool_linkmodes_set_req& req)
+{
+	auto ret = ethtool_linkmodes_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkmodes_set_prepare(ynl_cpp::ynl_socket&  ys,
+			      ethtool_linkmodes_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKMODES_SET, 1);
+	ethtool_linkmodes_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_linkmodes_set_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	return ethtool_linkmodes_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_linkmodes_set(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_linkmodes_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_linkmodes_set_batch(ynl_cpp::msg_batch& batch,
+			    ethtool_linkmodes_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_LINKMODES_SET, 1);
+	ethtool_linkmodes_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_linkmodes_nest);
 }
 
 /* ============== ETHTOOL_MSG_LINKSTATE_GET ============== */
@@ -2522,37 +3006,40 @@ int ethtool_linkstate_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_LINKSTATE_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_LINKSTATE_LINK) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->link = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_LINKSTATE_SQI) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->sqi = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_LINKSTATE_SQI_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->sqi_max = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_LINKSTATE_EXT_STATE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->ext_state = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_LINKSTATE_EXT_SUBSTATE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->ext_substate = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_LINKSTATE_EXT_DOWN_CNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ext_down_cnt = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -2560,63 +3047,175 @@ int ethtool_linkstate_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_linkstate_get_rsp>
-ethtool_linkstate_get(ynl_cpp::ynl_socket&  ys, ethtool_linkstate_get_req& req)
+static void
+ethtool_linkstate_get_put(struct nlmsghdr *nlh, ethtool_linkstate_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_LINKSTATE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_linkstate_get_rsp>>
+ethtool_linkstate_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_linkstate_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKSTATE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_linkstate_nest;
 	yrs.yarg.rsp_policy = &ethtool_linkstate_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_LINKSTATE_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_linkstate_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_linkstate_get_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_LINKSTATE_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_linkstate_get_rsp>>
+ethtool_linkstate_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ethtool_linkstate_get_req& req,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKSTATE_GET, 1);
+	ethtool_linkstate_get_put(nlh, req);
+
+	return ethtool_linkstate_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_linkstate_get_rsp>
+ethtool_linkstate_get(ynl_cpp::ynl_socket&  ys, ethtool_linkstate_get_req& req)
+{
+	auto ret = ethtool_linkstate_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkstate_get_prepare(ynl_cpp::ynl_socket&  ys,
+			      ethtool_linkstate_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKSTATE_GET, 1);
+	ethtool_linkstate_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_linkstate_get_rsp>>
+ethtool_linkstate_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return ethtool_linkstate_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_linkstate_get_rsp>
+ethtool_linkstate_get(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_linkstate_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_LINKSTATE_GET - dump */
-std::unique_ptr<ethtool_linkstate_get_list>
-ethtool_linkstate_get_dump(ynl_cpp::ynl_socket&  ys,
-			   ethtool_linkstate_get_req_dump& req)
+static void
+ethtool_linkstate_get_dump_put(struct nlmsghdr *nlh,
+			       ethtool_linkstate_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_LINKSTATE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_linkstate_get_list>>
+ethtool_linkstate_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+				const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_linkstate_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_linkstate_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_linkstate_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_linkstate_get_rsp_parse;
 	yds.rsp_cmd = ETHTOOL_MSG_LINKSTATE_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKSTATE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_linkstate_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_LINKSTATE_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_linkstate_get_list>>
+ethtool_linkstate_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ethtool_linkstate_get_req_dump& req,
+			      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKSTATE_GET, 1);
+	ethtool_linkstate_get_dump_put(nlh, req);
+
+	return ethtool_linkstate_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_linkstate_get_list>
+ethtool_linkstate_get_dump(ynl_cpp::ynl_socket&  ys,
+			   ethtool_linkstate_get_req_dump& req)
+{
+	auto ret = ethtool_linkstate_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkstate_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				   ethtool_linkstate_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_LINKSTATE_GET, 1);
+	ethtool_linkstate_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_linkstate_get_list>>
+ethtool_linkstate_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl,
+			      const ynl_cpp::projection *proj)
+{
+	return ethtool_linkstate_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_linkstate_get_list>
+ethtool_linkstate_get_dump(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_linkstate_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== ETHTOOL_MSG_DEBUG_GET ============== */
 /* ETHTOOL_MSG_DEBUG_GET - do */
 int ethtool_debug_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -2632,20 +3231,23 @@ int ethtool_debug_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_DEBUG_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_DEBUG_MSGMASK) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->msgmask;
+			parg.data = &dst->msgmask.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -2654,85 +3256,262 @@ int ethtool_debug_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_debug_get_rsp>
-ethtool_debug_get(ynl_cpp::ynl_socket&  ys, ethtool_debug_get_req& req)
+static void
+ethtool_debug_get_put(struct nlmsghdr *nlh, ethtool_debug_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_DEBUG_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_debug_get_rsp>>
+ethtool_debug_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_debug_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_DEBUG_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_debug_nest;
 	yrs.yarg.rsp_policy = &ethtool_debug_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_DEBUG_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_debug_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_debug_get_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_DEBUG_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_debug_get_rsp>>
+ethtool_debug_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_debug_get_req& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_DEBUG_GET, 1);
+	ethtool_debug_get_put(nlh, req);
+
+	return ethtool_debug_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_debug_get_rsp>
+ethtool_debug_get(ynl_cpp::ynl_socket&  ys, ethtool_debug_get_req& req)
+{
+	auto ret = ethtool_debug_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_debug_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_debug_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_DEBUG_GET, 1);
+	ethtool_debug_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_debug_get_rsp>>
+ethtool_debug_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return ethtool_debug_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_debug_get_rsp>
+ethtool_debug_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_debug_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_DEBUG_GET - dump */
-std::unique_ptr<ethtool_debug_get_list>
-ethtool_debug_get_dump(ynl_cpp::ynl_socket&  ys,
-		       ethtool_debug_get_req_dump& req)
+static void
+ethtool_debug_get_dump_put(struct nlmsghdr *nlh,
+			   ethtool_debug_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_DEBUG_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_debug_get_list>>
+ethtool_debug_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_debug_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_debug_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_debug_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_debug_get_rsp_parse;
 	yds.rsp_cmd = ETHTOOL_MSG_DEBUG_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_DEBUG_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_debug_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_DEBUG_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ETHTOOL_MSG_DEBUG_GET - notify */
-/* ============== ETHTOOL_MSG_DEBUG_SET ============== */
-/* ETHTOOL_MSG_DEBUG_SET - do */
-int ethtool_debug_set(ynl_cpp::ynl_socket&  ys, ethtool_debug_set_req& req)
+ynl_cpp::result<std::unique_ptr<ethtool_debug_get_list>>
+ethtool_debug_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ethtool_debug_get_req_dump& req,
+			  const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_DEBUG_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_debug_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_DEBUG_GET, 1);
+	ethtool_debug_get_dump_put(nlh, req);
+
+	return ethtool_debug_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_debug_get_list>
+ethtool_debug_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ethtool_debug_get_req_dump& req)
+{
+	auto ret = ethtool_debug_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_debug_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       ethtool_debug_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_DEBUG_GET, 1);
+	ethtool_debug_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_debug_get_list>>
+ethtool_debug_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj)
+{
+	return ethtool_debug_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_debug_get_list>
+ethtool_debug_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_debug_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ETHTOOL_MSG_DEBUG_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_debug_get_ntf>());
+
+static void *ethtool_debug_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_debug_get_ntf())->obj;
+}
+
+static void ethtool_debug_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_debug_get_ntf *rsp = (ethtool_debug_get_ntf *)ntf;
+
+	rsp->~ethtool_debug_get_ntf();
+	::free(rsp);
+}
 
+/* ============== ETHTOOL_MSG_DEBUG_SET ============== */
+/* ETHTOOL_MSG_DEBUG_SET - do */
+static void
+ethtool_debug_set_put(struct nlmsghdr *nlh, ethtool_debug_set_req& req)
+{
 	if (req.header.has_value())
 		ethtool_header_put(nlh, ETHTOOL_A_DEBUG_HEADER, req.header.value());
 	if (req.msgmask.has_value())
 		ethtool_bitset_put(nlh, ETHTOOL_A_DEBUG_MSGMASK, req.msgmask.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_debug_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_debug_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_debug_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_debug_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_DEBUG_SET, 1);
+	ethtool_debug_set_put(nlh, req);
+
+	return ethtool_debug_set_exec(ys, nlh);
+}
+
+int ethtool_debug_set(ynl_cpp::ynl_socket&  ys, ethtool_debug_set_req& req)
+{
+	auto ret = ethtool_debug_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_debug_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_debug_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_DEBUG_SET, 1);
+	ethtool_debug_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_debug_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ethtool_debug_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_debug_set(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_debug_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_debug_set_batch(ynl_cpp::msg_batch& batch, ethtool_debug_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_DEBUG_SET, 1);
+	ethtool_debug_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_debug_nest);
 }
 
 /* ============== ETHTOOL_MSG_WOL_GET ============== */
@@ -2750,25 +3529,26 @@ int ethtool_wol_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_WOL_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_WOL_MODES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->modes;
+			parg.data = &dst->modes.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_WOL_SOPASS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->sopass.assign(data, data + len);
@@ -2778,86 +3558,258 @@ int ethtool_wol_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_wol_get_rsp>
-ethtool_wol_get(ynl_cpp::ynl_socket&  ys, ethtool_wol_get_req& req)
+static void ethtool_wol_get_put(struct nlmsghdr *nlh, ethtool_wol_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_WOL_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_wol_get_rsp>>
+ethtool_wol_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_wol_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_WOL_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_wol_nest;
 	yrs.yarg.rsp_policy = &ethtool_wol_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_WOL_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_wol_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_wol_get_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_WOL_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* ETHTOOL_MSG_WOL_GET - dump */
-std::unique_ptr<ethtool_wol_get_list>
-ethtool_wol_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_wol_get_req_dump& req)
+ynl_cpp::result<std::unique_ptr<ethtool_wol_get_rsp>>
+ethtool_wol_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_wol_get_req& req,
+		   const ynl_cpp::projection *proj)
 {
-	struct ynl_dump_no_alloc_state yds = {};
 	struct nlmsghdr *nlh;
-	int err;
 
-	auto ret = std::make_unique<ethtool_wol_get_list>();
-	yds.yarg.ys = ys;
-	yds.yarg.rsp_policy = &ethtool_wol_nest;
-	yds.yarg.data = ret.get();
-	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_wol_get_list*>(arg)->objs.emplace_back());};
-	yds.cb = ethtool_wol_get_rsp_parse;
-	yds.rsp_cmd = ETHTOOL_MSG_WOL_GET;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_WOL_GET, 1);
+	ethtool_wol_get_put(nlh, req);
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_WOL_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_wol_nest;
+	return ethtool_wol_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_wol_get_rsp>
+ethtool_wol_get(ynl_cpp::ynl_socket&  ys, ethtool_wol_get_req& req)
+{
+	auto ret = ethtool_wol_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_wol_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_wol_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_WOL_GET, 1);
+	ethtool_wol_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_wol_get_rsp>>
+ethtool_wol_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return ethtool_wol_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_wol_get_rsp>
+ethtool_wol_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_wol_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
 
+/* ETHTOOL_MSG_WOL_GET - dump */
+static void
+ethtool_wol_get_dump_put(struct nlmsghdr *nlh, ethtool_wol_get_req_dump& req)
+{
 	if (req.header.has_value())
 		ethtool_header_put(nlh, ETHTOOL_A_WOL_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_wol_get_list>>
+ethtool_wol_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<ethtool_wol_get_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &ethtool_wol_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_wol_get_list*>(arg)->objs.emplace_back());};
+	yds.cb = ethtool_wol_get_rsp_parse;
+	yds.rsp_cmd = ETHTOOL_MSG_WOL_GET;
+	((struct ynl_sock*)ys)->req_policy = &ethtool_wol_nest;
 
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ETHTOOL_MSG_WOL_GET - notify */
-/* ============== ETHTOOL_MSG_WOL_SET ============== */
-/* ETHTOOL_MSG_WOL_SET - do */
-int ethtool_wol_set(ynl_cpp::ynl_socket&  ys, ethtool_wol_set_req& req)
+ynl_cpp::result<std::unique_ptr<ethtool_wol_get_list>>
+ethtool_wol_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_wol_get_req_dump& req,
+			const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_WOL_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_wol_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_WOL_GET, 1);
+	ethtool_wol_get_dump_put(nlh, req);
+
+	return ethtool_wol_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_wol_get_list>
+ethtool_wol_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_wol_get_req_dump& req)
+{
+	auto ret = ethtool_wol_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_wol_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_wol_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_WOL_GET, 1);
+	ethtool_wol_get_dump_put(nlh, req);
 
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_wol_get_list>>
+ethtool_wol_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_wol_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_wol_get_list>
+ethtool_wol_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_wol_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ETHTOOL_MSG_WOL_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_wol_get_ntf>());
+
+static void *ethtool_wol_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_wol_get_ntf())->obj;
+}
+
+static void ethtool_wol_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_wol_get_ntf *rsp = (ethtool_wol_get_ntf *)ntf;
+
+	rsp->~ethtool_wol_get_ntf();
+	::free(rsp);
+}
+
+/* ============== ETHTOOL_MSG_WOL_SET ============== */
+/* ETHTOOL_MSG_WOL_SET - do */
+static void ethtool_wol_set_put(struct nlmsghdr *nlh, ethtool_wol_set_req& req)
+{
 	if (req.header.has_value())
 		ethtool_header_put(nlh, ETHTOOL_A_WOL_HEADER, req.header.value());
 	if (req.modes.has_value())
 		ethtool_bitset_put(nlh, ETHTOOL_A_WOL_MODES, req.modes.value());
 	if (req.sopass.size() > 0)
 		ynl_attr_put(nlh, ETHTOOL_A_WOL_SOPASS, req.sopass.data(), req.sopass.size());
+}
+
+static ynl_cpp::result<void>
+ethtool_wol_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_wol_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_wol_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_wol_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_WOL_SET, 1);
+	ethtool_wol_set_put(nlh, req);
+
+	return ethtool_wol_set_exec(ys, nlh);
+}
+
+int ethtool_wol_set(ynl_cpp::ynl_socket&  ys, ethtool_wol_set_req& req)
+{
+	auto ret = ethtool_wol_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_wol_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_wol_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_WOL_SET, 1);
+	ethtool_wol_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_wol_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ethtool_wol_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_wol_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_wol_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_wol_set_batch(ynl_cpp::msg_batch& batch, ethtool_wol_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_WOL_SET, 1);
+	ethtool_wol_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_wol_nest);
 }
 
 /* ============== ETHTOOL_MSG_FEATURES_GET ============== */
@@ -2875,44 +3827,47 @@ int ethtool_features_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_FEATURES_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_FEATURES_HW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->hw;
+			parg.data = &dst->hw.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_FEATURES_WANTED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->wanted;
+			parg.data = &dst->wanted.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_FEATURES_ACTIVE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->active;
+			parg.data = &dst->active.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_FEATURES_NOCHANGE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->nochange;
+			parg.data = &dst->nochange.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -2921,64 +3876,190 @@ int ethtool_features_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_features_get_rsp>
-ethtool_features_get(ynl_cpp::ynl_socket&  ys, ethtool_features_get_req& req)
+static void
+ethtool_features_get_put(struct nlmsghdr *nlh, ethtool_features_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_FEATURES_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_features_get_rsp>>
+ethtool_features_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_features_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEATURES_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_features_nest;
 	yrs.yarg.rsp_policy = &ethtool_features_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_FEATURES_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_features_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_features_get_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_FEATURES_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_features_get_rsp>>
+ethtool_features_get_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_features_get_req& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEATURES_GET, 1);
+	ethtool_features_get_put(nlh, req);
+
+	return ethtool_features_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_features_get_rsp>
+ethtool_features_get(ynl_cpp::ynl_socket&  ys, ethtool_features_get_req& req)
+{
+	auto ret = ethtool_features_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_features_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_features_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEATURES_GET, 1);
+	ethtool_features_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_features_get_rsp>>
+ethtool_features_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_features_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_features_get_rsp>
+ethtool_features_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_features_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_FEATURES_GET - dump */
-std::unique_ptr<ethtool_features_get_list>
-ethtool_features_get_dump(ynl_cpp::ynl_socket&  ys,
-			  ethtool_features_get_req_dump& req)
+static void
+ethtool_features_get_dump_put(struct nlmsghdr *nlh,
+			      ethtool_features_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_FEATURES_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_features_get_list>>
+ethtool_features_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_features_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_features_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_features_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_features_get_rsp_parse;
 	yds.rsp_cmd = ETHTOOL_MSG_FEATURES_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEATURES_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_features_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_FEATURES_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_features_get_list>>
+ethtool_features_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_features_get_req_dump& req,
+			     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEATURES_GET, 1);
+	ethtool_features_get_dump_put(nlh, req);
+
+	return ethtool_features_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_features_get_list>
+ethtool_features_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ethtool_features_get_req_dump& req)
+{
+	auto ret = ethtool_features_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_features_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_features_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEATURES_GET, 1);
+	ethtool_features_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_features_get_list>>
+ethtool_features_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return ethtool_features_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_features_get_list>
+ethtool_features_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_features_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_FEATURES_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_features_get_ntf>());
+
+static void *ethtool_features_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_features_get_ntf())->obj;
+}
+
+static void ethtool_features_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_features_get_ntf *rsp = (ethtool_features_get_ntf *)ntf;
+
+	rsp->~ethtool_features_get_ntf();
+	::free(rsp);
+}
+
 /* ============== ETHTOOL_MSG_FEATURES_SET ============== */
 /* ETHTOOL_MSG_FEATURES_SET - do */
 int ethtool_features_set_rsp_parse(const struct nlmsghdr *nlh,
@@ -2994,44 +4075,47 @@ int ethtool_features_set_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_FEATURES_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_FEATURES_HW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->hw;
+			parg.data = &dst->hw.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_FEATURES_WANTED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->wanted;
+			parg.data = &dst->wanted.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_FEATURES_ACTIVE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->active;
+			parg.data = &dst->active.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_FEATURES_NOCHANGE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->nochange;
+			parg.data = &dst->nochange.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -3040,18 +4124,9 @@ int ethtool_features_set_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_features_set_rsp>
-ethtool_features_set(ynl_cpp::ynl_socket&  ys, ethtool_features_set_req& req)
+static void
+ethtool_features_set_put(struct nlmsghdr *nlh, ethtool_features_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<ethtool_features_set_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEATURES_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_features_nest;
-	yrs.yarg.rsp_policy = &ethtool_features_nest;
-
 	if (req.header.has_value())
 		ethtool_header_put(nlh, ETHTOOL_A_FEATURES_HEADER, req.header.value());
 	if (req.hw.has_value())
@@ -3062,26 +4137,90 @@ ethtool_features_set(ynl_cpp::ynl_socket&  ys, ethtool_features_set_req& req)
 		ethtool_bitset_put(nlh, ETHTOOL_A_FEATURES_ACTIVE, req.active.value());
 	if (req.nochange.has_value())
 		ethtool_bitset_put(nlh, ETHTOOL_A_FEATURES_NOCHANGE, req.nochange.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_features_set_rsp>>
+ethtool_features_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<ethtool_features_set_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_features_nest;
+	yrs.yarg.rsp_policy = &ethtool_features_nest;
 
 	rsp.reset(new ethtool_features_set_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_features_set_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_FEATURES_SET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* ============== ETHTOOL_MSG_PRIVFLAGS_GET ============== */
-/* ETHTOOL_MSG_PRIVFLAGS_GET - do */
-int ethtool_privflags_get_rsp_parse(const struct nlmsghdr *nlh,
-				    struct ynl_parse_arg *yarg)
+ynl_cpp::result<std::unique_ptr<ethtool_features_set_rsp>>
+ethtool_features_set_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_features_set_req& req,
+			const ynl_cpp::projection *proj)
 {
-	ethtool_privflags_get_rsp *dst;
-	const struct nlattr *attr;
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEATURES_SET, 1);
+	ethtool_features_set_put(nlh, req);
+
+	return ethtool_features_set_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_features_set_rsp>
+ethtool_features_set(ynl_cpp::ynl_socket&  ys, ethtool_features_set_req& req)
+{
+	auto ret = ethtool_features_set_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_features_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_features_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEATURES_SET, 1);
+	ethtool_features_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_features_set_rsp>>
+ethtool_features_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_features_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_features_set_rsp>
+ethtool_features_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_features_set_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== ETHTOOL_MSG_PRIVFLAGS_GET ============== */
+/* ETHTOOL_MSG_PRIVFLAGS_GET - do */
+int ethtool_privflags_get_rsp_parse(const struct nlmsghdr *nlh,
+				    struct ynl_parse_arg *yarg)
+{
+	ethtool_privflags_get_rsp *dst;
+	const struct nlattr *attr;
 	struct ynl_parse_arg parg;
 
 	dst = (ethtool_privflags_get_rsp*)yarg->data;
@@ -3090,20 +4229,23 @@ int ethtool_privflags_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_PRIVFLAGS_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_PRIVFLAGS_FLAGS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->flags;
+			parg.data = &dst->flags.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -3112,86 +4254,271 @@ int ethtool_privflags_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_privflags_get_rsp>
-ethtool_privflags_get(ynl_cpp::ynl_socket&  ys, ethtool_privflags_get_req& req)
+static void
+ethtool_privflags_get_put(struct nlmsghdr *nlh, ethtool_privflags_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PRIVFLAGS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_privflags_get_rsp>>
+ethtool_privflags_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_privflags_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PRIVFLAGS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_privflags_nest;
 	yrs.yarg.rsp_policy = &ethtool_privflags_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PRIVFLAGS_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_privflags_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_privflags_get_rsp_parse;
 	yrs.rsp_cmd = 14;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_privflags_get_rsp>>
+ethtool_privflags_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ethtool_privflags_get_req& req,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PRIVFLAGS_GET, 1);
+	ethtool_privflags_get_put(nlh, req);
+
+	return ethtool_privflags_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_privflags_get_rsp>
+ethtool_privflags_get(ynl_cpp::ynl_socket&  ys, ethtool_privflags_get_req& req)
+{
+	auto ret = ethtool_privflags_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_privflags_get_prepare(ynl_cpp::ynl_socket&  ys,
+			      ethtool_privflags_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PRIVFLAGS_GET, 1);
+	ethtool_privflags_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_privflags_get_rsp>>
+ethtool_privflags_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return ethtool_privflags_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_privflags_get_rsp>
+ethtool_privflags_get(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_privflags_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_PRIVFLAGS_GET - dump */
-std::unique_ptr<ethtool_privflags_get_list>
-ethtool_privflags_get_dump(ynl_cpp::ynl_socket&  ys,
-			   ethtool_privflags_get_req_dump& req)
+static void
+ethtool_privflags_get_dump_put(struct nlmsghdr *nlh,
+			       ethtool_privflags_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PRIVFLAGS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_privflags_get_list>>
+ethtool_privflags_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+				const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_privflags_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_privflags_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_privflags_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_privflags_get_rsp_parse;
 	yds.rsp_cmd = 14;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PRIVFLAGS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_privflags_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PRIVFLAGS_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ETHTOOL_MSG_PRIVFLAGS_GET - notify */
-/* ============== ETHTOOL_MSG_PRIVFLAGS_SET ============== */
-/* ETHTOOL_MSG_PRIVFLAGS_SET - do */
-int ethtool_privflags_set(ynl_cpp::ynl_socket&  ys,
-			  ethtool_privflags_set_req& req)
+ynl_cpp::result<std::unique_ptr<ethtool_privflags_get_list>>
+ethtool_privflags_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ethtool_privflags_get_req_dump& req,
+			      const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PRIVFLAGS_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_privflags_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PRIVFLAGS_GET, 1);
+	ethtool_privflags_get_dump_put(nlh, req);
+
+	return ethtool_privflags_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_privflags_get_list>
+ethtool_privflags_get_dump(ynl_cpp::ynl_socket&  ys,
+			   ethtool_privflags_get_req_dump& req)
+{
+	auto ret = ethtool_privflags_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_privflags_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				   ethtool_privflags_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PRIVFLAGS_GET, 1);
+	ethtool_privflags_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_privflags_get_list>>
+ethtool_privflags_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl,
+			      const ynl_cpp::projection *proj)
+{
+	return ethtool_privflags_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_privflags_get_list>
+ethtool_privflags_get_dump(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_privflags_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
 
+/* ETHTOOL_MSG_PRIVFLAGS_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_privflags_get_ntf>());
+
+static void *ethtool_privflags_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_privflags_get_ntf())->obj;
+}
+
+static void ethtool_privflags_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_privflags_get_ntf *rsp = (ethtool_privflags_get_ntf *)ntf;
+
+	rsp->~ethtool_privflags_get_ntf();
+	::free(rsp);
+}
+
+/* ============== ETHTOOL_MSG_PRIVFLAGS_SET ============== */
+/* ETHTOOL_MSG_PRIVFLAGS_SET - do */
+static void
+ethtool_privflags_set_put(struct nlmsghdr *nlh, ethtool_privflags_set_req& req)
+{
 	if (req.header.has_value())
 		ethtool_header_put(nlh, ETHTOOL_A_PRIVFLAGS_HEADER, req.header.value());
 	if (req.flags.has_value())
 		ethtool_bitset_put(nlh, ETHTOOL_A_PRIVFLAGS_FLAGS, req.flags.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_privflags_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_privflags_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_privflags_set_ex(ynl_cpp::ynl_socket&  ys,
+			 ethtool_privflags_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PRIVFLAGS_SET, 1);
+	ethtool_privflags_set_put(nlh, req);
+
+	return ethtool_privflags_set_exec(ys, nlh);
+}
+
+int ethtool_privflags_set(ynl_cpp::ynl_socket&  ys,
+			  ethtool_privflags_set_req& req)
+{
+	auto ret = ethtool_privflags_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_privflags_set_prepare(ynl_cpp::ynl_socket&  ys,
+			      ethtool_privflags_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PRIVFLAGS_SET, 1);
+	ethtool_privflags_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_privflags_set_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	return ethtool_privflags_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_privflags_set(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_privflags_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_privflags_set_batch(ynl_cpp::msg_batch& batch,
+			    ethtool_privflags_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_PRIVFLAGS_SET, 1);
+	ethtool_privflags_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_privflags_nest);
 }
 
 /* ============== ETHTOOL_MSG_RINGS_GET ============== */
@@ -3209,81 +4536,84 @@ int ethtool_rings_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_RINGS_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_RINGS_RX_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_max = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_RX_MINI_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_mini_max = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_RX_JUMBO_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_jumbo_max = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_TX_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_max = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_RX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_RX_MINI) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_mini = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_RX_JUMBO) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_jumbo = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_TX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_RX_BUF_LEN) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_buf_len = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_TCP_DATA_SPLIT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->tcp_data_split = (ethtool_tcp_data_split)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_RINGS_CQE_SIZE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->cqe_size = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_TX_PUSH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->tx_push = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_RINGS_RX_PUSH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->rx_push = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_RINGS_TX_PUSH_BUF_LEN) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_push_buf_len = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_TX_PUSH_BUF_LEN_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_push_buf_len_max = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_HDS_THRESH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->hds_thresh = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RINGS_HDS_THRESH_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->hds_thresh_max = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -3291,117 +4621,296 @@ int ethtool_rings_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_rings_get_rsp>
-ethtool_rings_get(ynl_cpp::ynl_socket&  ys, ethtool_rings_get_req& req)
+static void
+ethtool_rings_get_put(struct nlmsghdr *nlh, ethtool_rings_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_RINGS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_rings_get_rsp>>
+ethtool_rings_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_rings_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RINGS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_rings_nest;
 	yrs.yarg.rsp_policy = &ethtool_rings_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_RINGS_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_rings_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_rings_get_rsp_parse;
 	yrs.rsp_cmd = 16;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_rings_get_rsp>>
+ethtool_rings_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_rings_get_req& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RINGS_GET, 1);
+	ethtool_rings_get_put(nlh, req);
+
+	return ethtool_rings_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_rings_get_rsp>
+ethtool_rings_get(ynl_cpp::ynl_socket&  ys, ethtool_rings_get_req& req)
+{
+	auto ret = ethtool_rings_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rings_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_rings_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RINGS_GET, 1);
+	ethtool_rings_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_rings_get_rsp>>
+ethtool_rings_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return ethtool_rings_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_rings_get_rsp>
+ethtool_rings_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_rings_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_RINGS_GET - dump */
-std::unique_ptr<ethtool_rings_get_list>
-ethtool_rings_get_dump(ynl_cpp::ynl_socket&  ys,
-		       ethtool_rings_get_req_dump& req)
+static void
+ethtool_rings_get_dump_put(struct nlmsghdr *nlh,
+			   ethtool_rings_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_RINGS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_rings_get_list>>
+ethtool_rings_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_rings_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_rings_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_rings_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_rings_get_rsp_parse;
 	yds.rsp_cmd = 16;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RINGS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_rings_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_RINGS_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ETHTOOL_MSG_RINGS_GET - notify */
-/* ============== ETHTOOL_MSG_RINGS_SET ============== */
-/* ETHTOOL_MSG_RINGS_SET - do */
-int ethtool_rings_set(ynl_cpp::ynl_socket&  ys, ethtool_rings_set_req& req)
+ynl_cpp::result<std::unique_ptr<ethtool_rings_get_list>>
+ethtool_rings_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ethtool_rings_get_req_dump& req,
+			  const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RINGS_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_rings_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RINGS_GET, 1);
+	ethtool_rings_get_dump_put(nlh, req);
+
+	return ethtool_rings_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_rings_get_list>
+ethtool_rings_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ethtool_rings_get_req_dump& req)
+{
+	auto ret = ethtool_rings_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rings_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       ethtool_rings_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RINGS_GET, 1);
+	ethtool_rings_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_rings_get_list>>
+ethtool_rings_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj)
+{
+	return ethtool_rings_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_rings_get_list>
+ethtool_rings_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_rings_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ETHTOOL_MSG_RINGS_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_rings_get_ntf>());
+
+static void *ethtool_rings_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_rings_get_ntf())->obj;
+}
+
+static void ethtool_rings_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_rings_get_ntf *rsp = (ethtool_rings_get_ntf *)ntf;
+
+	rsp->~ethtool_rings_get_ntf();
+	::free(rsp);
+}
+
+/* ============== ETHTOOL_MSG_RINGS_SET ============== */
+/* ETHTOOL_MSG_RINGS_SET - do */
+static void
+ethtool_rings_set_put(struct nlmsghdr *nlh, ethtool_rings_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 136 <= YNL_SOCKET_BUFFER_SIZE);
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_RINGS_HEADER, req.header.value());
 	if (req.rx_max.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_RX_MAX, req.rx_max.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_RX_MAX, req.rx_max.value());
 	if (req.rx_mini_max.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_RX_MINI_MAX, req.rx_mini_max.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_RX_MINI_MAX, req.rx_mini_max.value());
 	if (req.rx_jumbo_max.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_RX_JUMBO_MAX, req.rx_jumbo_max.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_RX_JUMBO_MAX, req.rx_jumbo_max.value());
 	if (req.tx_max.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_TX_MAX, req.tx_max.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_TX_MAX, req.tx_max.value());
 	if (req.rx.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_RX, req.rx.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_RX, req.rx.value());
 	if (req.rx_mini.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_RX_MINI, req.rx_mini.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_RX_MINI, req.rx_mini.value());
 	if (req.rx_jumbo.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_RX_JUMBO, req.rx_jumbo.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_RX_JUMBO, req.rx_jumbo.value());
 	if (req.tx.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_TX, req.tx.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_TX, req.tx.value());
 	if (req.rx_buf_len.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_RX_BUF_LEN, req.rx_buf_len.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_RX_BUF_LEN, req.rx_buf_len.value());
 	if (req.tcp_data_split.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_RINGS_TCP_DATA_SPLIT, req.tcp_data_split.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_RINGS_TCP_DATA_SPLIT, req.tcp_data_split.value());
 	if (req.cqe_size.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_CQE_SIZE, req.cqe_size.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_CQE_SIZE, req.cqe_size.value());
 	if (req.tx_push.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_RINGS_TX_PUSH, req.tx_push.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_RINGS_TX_PUSH, req.tx_push.value());
 	if (req.rx_push.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_RINGS_RX_PUSH, req.rx_push.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_RINGS_RX_PUSH, req.rx_push.value());
 	if (req.tx_push_buf_len.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_TX_PUSH_BUF_LEN, req.tx_push_buf_len.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_TX_PUSH_BUF_LEN, req.tx_push_buf_len.value());
 	if (req.tx_push_buf_len_max.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_TX_PUSH_BUF_LEN_MAX, req.tx_push_buf_len_max.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_TX_PUSH_BUF_LEN_MAX, req.tx_push_buf_len_max.value());
 	if (req.hds_thresh.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_HDS_THRESH, req.hds_thresh.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_HDS_THRESH, req.hds_thresh.value());
 	if (req.hds_thresh_max.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RINGS_HDS_THRESH_MAX, req.hds_thresh_max.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RINGS_HDS_THRESH_MAX, req.hds_thresh_max.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_RINGS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_rings_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_rings_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_rings_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_rings_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RINGS_SET, 1);
+	ethtool_rings_set_put(nlh, req);
+
+	return ethtool_rings_set_exec(ys, nlh);
+}
+
+int ethtool_rings_set(ynl_cpp::ynl_socket&  ys, ethtool_rings_set_req& req)
+{
+	auto ret = ethtool_rings_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rings_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_rings_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RINGS_SET, 1);
+	ethtool_rings_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_rings_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ethtool_rings_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_rings_set(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_rings_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_rings_set_batch(ynl_cpp::msg_batch& batch, ethtool_rings_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_RINGS_SET, 1);
+	ethtool_rings_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_rings_nest);
 }
 
 /* ============== ETHTOOL_MSG_CHANNELS_GET ============== */
@@ -3419,45 +4928,48 @@ int ethtool_channels_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_CHANNELS_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_CHANNELS_RX_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_max = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_CHANNELS_TX_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_max = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_CHANNELS_OTHER_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->other_max = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_CHANNELS_COMBINED_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->combined_max = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_CHANNELS_RX_COUNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_count = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_CHANNELS_TX_COUNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_count = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_CHANNELS_OTHER_COUNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->other_count = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_CHANNELS_COMBINED_COUNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->combined_count = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -3465,100 +4977,286 @@ int ethtool_channels_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_channels_get_rsp>
-ethtool_channels_get(ynl_cpp::ynl_socket&  ys, ethtool_channels_get_req& req)
+static void
+ethtool_channels_get_put(struct nlmsghdr *nlh, ethtool_channels_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_CHANNELS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_channels_get_rsp>>
+ethtool_channels_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_channels_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CHANNELS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_channels_nest;
 	yrs.yarg.rsp_policy = &ethtool_channels_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_CHANNELS_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_channels_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_channels_get_rsp_parse;
 	yrs.rsp_cmd = 18;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_channels_get_rsp>>
+ethtool_channels_get_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_channels_get_req& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CHANNELS_GET, 1);
+	ethtool_channels_get_put(nlh, req);
+
+	return ethtool_channels_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_channels_get_rsp>
+ethtool_channels_get(ynl_cpp::ynl_socket&  ys, ethtool_channels_get_req& req)
+{
+	auto ret = ethtool_channels_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_channels_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_channels_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CHANNELS_GET, 1);
+	ethtool_channels_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_channels_get_rsp>>
+ethtool_channels_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_channels_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_channels_get_rsp>
+ethtool_channels_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_channels_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_CHANNELS_GET - dump */
-std::unique_ptr<ethtool_channels_get_list>
-ethtool_channels_get_dump(ynl_cpp::ynl_socket&  ys,
-			  ethtool_channels_get_req_dump& req)
+static void
+ethtool_channels_get_dump_put(struct nlmsghdr *nlh,
+			      ethtool_channels_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_CHANNELS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_channels_get_list>>
+ethtool_channels_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_channels_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_channels_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_channels_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_channels_get_rsp_parse;
 	yds.rsp_cmd = 18;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CHANNELS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_channels_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_CHANNELS_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_channels_get_list>>
+ethtool_channels_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_channels_get_req_dump& req,
+			     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CHANNELS_GET, 1);
+	ethtool_channels_get_dump_put(nlh, req);
+
+	return ethtool_channels_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_channels_get_list>
+ethtool_channels_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ethtool_channels_get_req_dump& req)
+{
+	auto ret = ethtool_channels_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_channels_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_channels_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CHANNELS_GET, 1);
+	ethtool_channels_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_channels_get_list>>
+ethtool_channels_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return ethtool_channels_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_channels_get_list>
+ethtool_channels_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_channels_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_CHANNELS_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_channels_get_ntf>());
+
+static void *ethtool_channels_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_channels_get_ntf())->obj;
+}
+
+static void ethtool_channels_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_channels_get_ntf *rsp = (ethtool_channels_get_ntf *)ntf;
+
+	rsp->~ethtool_channels_get_ntf();
+	::free(rsp);
+}
+
 /* ============== ETHTOOL_MSG_CHANNELS_SET ============== */
 /* ETHTOOL_MSG_CHANNELS_SET - do */
-int ethtool_channels_set(ynl_cpp::ynl_socket&  ys,
-			 ethtool_channels_set_req& req)
+static void
+ethtool_channels_set_put(struct nlmsghdr *nlh, ethtool_channels_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CHANNELS_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_channels_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 64 <= YNL_SOCKET_BUFFER_SIZE);
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_CHANNELS_HEADER, req.header.value());
 	if (req.rx_max.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_CHANNELS_RX_MAX, req.rx_max.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_CHANNELS_RX_MAX, req.rx_max.value());
 	if (req.tx_max.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_CHANNELS_TX_MAX, req.tx_max.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_CHANNELS_TX_MAX, req.tx_max.value());
 	if (req.other_max.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_CHANNELS_OTHER_MAX, req.other_max.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_CHANNELS_OTHER_MAX, req.other_max.value());
 	if (req.combined_max.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_CHANNELS_COMBINED_MAX, req.combined_max.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_CHANNELS_COMBINED_MAX, req.combined_max.value());
 	if (req.rx_count.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_CHANNELS_RX_COUNT, req.rx_count.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_CHANNELS_RX_COUNT, req.rx_count.value());
 	if (req.tx_count.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_CHANNELS_TX_COUNT, req.tx_count.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_CHANNELS_TX_COUNT, req.tx_count.value());
 	if (req.other_count.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_CHANNELS_OTHER_COUNT, req.other_count.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_CHANNELS_OTHER_COUNT, req.other_count.value());
 	if (req.combined_count.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_CHANNELS_COMBINED_COUNT, req.combined_count.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_CHANNELS_COMBINED_COUNT, req.combined_count.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_CHANNELS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_channels_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_channels_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_channels_set_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_channels_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CHANNELS_SET, 1);
+	ethtool_channels_set_put(nlh, req);
+
+	return ethtool_channels_set_exec(ys, nlh);
+}
+
+int ethtool_channels_set(ynl_cpp::ynl_socket&  ys,
+			 ethtool_channels_set_req& req)
+{
+	auto ret = ethtool_channels_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_channels_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_channels_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CHANNELS_SET, 1);
+	ethtool_channels_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_channels_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	return ethtool_channels_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_channels_set(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_channels_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_channels_set_batch(ynl_cpp::msg_batch& batch,
+			   ethtool_channels_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_CHANNELS_SET, 1);
+	ethtool_channels_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_channels_nest);
 }
 
 /* ============== ETHTOOL_MSG_COALESCE_GET ============== */
@@ -3576,136 +5274,139 @@ int ethtool_coalesce_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_COALESCE_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_COALESCE_RX_USECS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_usecs = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_RX_MAX_FRAMES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_max_frames = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_RX_USECS_IRQ) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_usecs_irq = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_RX_MAX_FRAMES_IRQ) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_max_frames_irq = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_TX_USECS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_usecs = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_TX_MAX_FRAMES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_max_frames = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_TX_USECS_IRQ) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_usecs_irq = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_TX_MAX_FRAMES_IRQ) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_max_frames_irq = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_STATS_BLOCK_USECS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->stats_block_usecs = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_USE_ADAPTIVE_RX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->use_adaptive_rx = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_COALESCE_USE_ADAPTIVE_TX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->use_adaptive_tx = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_COALESCE_PKT_RATE_LOW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->pkt_rate_low = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_RX_USECS_LOW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_usecs_low = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_RX_MAX_FRAMES_LOW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_max_frames_low = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_TX_USECS_LOW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_usecs_low = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_TX_MAX_FRAMES_LOW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_max_frames_low = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_PKT_RATE_HIGH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->pkt_rate_high = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_RX_USECS_HIGH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_usecs_high = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_RX_MAX_FRAMES_HIGH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_max_frames_high = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_TX_USECS_HIGH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_usecs_high = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_TX_MAX_FRAMES_HIGH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_max_frames_high = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_RATE_SAMPLE_INTERVAL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rate_sample_interval = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_USE_CQE_MODE_TX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->use_cqe_mode_tx = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_COALESCE_USE_CQE_MODE_RX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->use_cqe_mode_rx = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_COALESCE_TX_AGGR_MAX_BYTES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_aggr_max_bytes = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_TX_AGGR_MAX_FRAMES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_aggr_max_frames = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_TX_AGGR_TIME_USECS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_aggr_time_usecs = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_COALESCE_RX_PROFILE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_profile_nest;
-			parg.data = &dst->rx_profile;
+			parg.data = &dst->rx_profile.emplace();
 			if (ethtool_profile_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_COALESCE_TX_PROFILE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_profile_nest;
-			parg.data = &dst->tx_profile;
+			parg.data = &dst->tx_profile.emplace();
 			if (ethtool_profile_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -3714,142 +5415,328 @@ int ethtool_coalesce_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_coalesce_get_rsp>
-ethtool_coalesce_get(ynl_cpp::ynl_socket&  ys, ethtool_coalesce_get_req& req)
+static void
+ethtool_coalesce_get_put(struct nlmsghdr *nlh, ethtool_coalesce_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_COALESCE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_coalesce_get_rsp>>
+ethtool_coalesce_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_coalesce_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_COALESCE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_coalesce_nest;
 	yrs.yarg.rsp_policy = &ethtool_coalesce_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_COALESCE_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_coalesce_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_coalesce_get_rsp_parse;
 	yrs.rsp_cmd = 20;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_coalesce_get_rsp>>
+ethtool_coalesce_get_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_coalesce_get_req& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_COALESCE_GET, 1);
+	ethtool_coalesce_get_put(nlh, req);
+
+	return ethtool_coalesce_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_coalesce_get_rsp>
+ethtool_coalesce_get(ynl_cpp::ynl_socket&  ys, ethtool_coalesce_get_req& req)
+{
+	auto ret = ethtool_coalesce_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_coalesce_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_coalesce_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_COALESCE_GET, 1);
+	ethtool_coalesce_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_coalesce_get_rsp>>
+ethtool_coalesce_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_coalesce_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_coalesce_get_rsp>
+ethtool_coalesce_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_coalesce_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_COALESCE_GET - dump */
-std::unique_ptr<ethtool_coalesce_get_list>
-ethtool_coalesce_get_dump(ynl_cpp::ynl_socket&  ys,
-			  ethtool_coalesce_get_req_dump& req)
+static void
+ethtool_coalesce_get_dump_put(struct nlmsghdr *nlh,
+			      ethtool_coalesce_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_COALESCE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_coalesce_get_list>>
+ethtool_coalesce_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_coalesce_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_coalesce_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_coalesce_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_coalesce_get_rsp_parse;
 	yds.rsp_cmd = 20;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_COALESCE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_coalesce_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_COALESCE_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_coalesce_get_list>>
+ethtool_coalesce_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_coalesce_get_req_dump& req,
+			     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_COALESCE_GET, 1);
+	ethtool_coalesce_get_dump_put(nlh, req);
+
+	return ethtool_coalesce_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_coalesce_get_list>
+ethtool_coalesce_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ethtool_coalesce_get_req_dump& req)
+{
+	auto ret = ethtool_coalesce_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_coalesce_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_coalesce_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_COALESCE_GET, 1);
+	ethtool_coalesce_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_coalesce_get_list>>
+ethtool_coalesce_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return ethtool_coalesce_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_coalesce_get_list>
+ethtool_coalesce_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_coalesce_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_COALESCE_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_coalesce_get_ntf>());
+
+static void *ethtool_coalesce_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_coalesce_get_ntf())->obj;
+}
+
+static void ethtool_coalesce_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_coalesce_get_ntf *rsp = (ethtool_coalesce_get_ntf *)ntf;
+
+	rsp->~ethtool_coalesce_get_ntf();
+	::free(rsp);
+}
+
 /* ============== ETHTOOL_MSG_COALESCE_SET ============== */
 /* ETHTOOL_MSG_COALESCE_SET - do */
-int ethtool_coalesce_set(ynl_cpp::ynl_socket&  ys,
-			 ethtool_coalesce_set_req& req)
+static void
+ethtool_coalesce_set_put(struct nlmsghdr *nlh, ethtool_coalesce_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_COALESCE_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_coalesce_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 216 <= YNL_SOCKET_BUFFER_SIZE);
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_COALESCE_HEADER, req.header.value());
 	if (req.rx_usecs.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_RX_USECS, req.rx_usecs.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_RX_USECS, req.rx_usecs.value());
 	if (req.rx_max_frames.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_RX_MAX_FRAMES, req.rx_max_frames.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_RX_MAX_FRAMES, req.rx_max_frames.value());
 	if (req.rx_usecs_irq.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_RX_USECS_IRQ, req.rx_usecs_irq.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_RX_USECS_IRQ, req.rx_usecs_irq.value());
 	if (req.rx_max_frames_irq.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_RX_MAX_FRAMES_IRQ, req.rx_max_frames_irq.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_RX_MAX_FRAMES_IRQ, req.rx_max_frames_irq.value());
 	if (req.tx_usecs.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_TX_USECS, req.tx_usecs.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_TX_USECS, req.tx_usecs.value());
 	if (req.tx_max_frames.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_TX_MAX_FRAMES, req.tx_max_frames.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_TX_MAX_FRAMES, req.tx_max_frames.value());
 	if (req.tx_usecs_irq.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_TX_USECS_IRQ, req.tx_usecs_irq.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_TX_USECS_IRQ, req.tx_usecs_irq.value());
 	if (req.tx_max_frames_irq.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_TX_MAX_FRAMES_IRQ, req.tx_max_frames_irq.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_TX_MAX_FRAMES_IRQ, req.tx_max_frames_irq.value());
 	if (req.stats_block_usecs.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_STATS_BLOCK_USECS, req.stats_block_usecs.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_STATS_BLOCK_USECS, req.stats_block_usecs.value());
 	if (req.use_adaptive_rx.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_COALESCE_USE_ADAPTIVE_RX, req.use_adaptive_rx.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_COALESCE_USE_ADAPTIVE_RX, req.use_adaptive_rx.value());
 	if (req.use_adaptive_tx.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_COALESCE_USE_ADAPTIVE_TX, req.use_adaptive_tx.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_COALESCE_USE_ADAPTIVE_TX, req.use_adaptive_tx.value());
 	if (req.pkt_rate_low.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_PKT_RATE_LOW, req.pkt_rate_low.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_PKT_RATE_LOW, req.pkt_rate_low.value());
 	if (req.rx_usecs_low.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_RX_USECS_LOW, req.rx_usecs_low.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_RX_USECS_LOW, req.rx_usecs_low.value());
 	if (req.rx_max_frames_low.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_RX_MAX_FRAMES_LOW, req.rx_max_frames_low.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_RX_MAX_FRAMES_LOW, req.rx_max_frames_low.value());
 	if (req.tx_usecs_low.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_TX_USECS_LOW, req.tx_usecs_low.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_TX_USECS_LOW, req.tx_usecs_low.value());
 	if (req.tx_max_frames_low.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_TX_MAX_FRAMES_LOW, req.tx_max_frames_low.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_TX_MAX_FRAMES_LOW, req.tx_max_frames_low.value());
 	if (req.pkt_rate_high.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_PKT_RATE_HIGH, req.pkt_rate_high.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_PKT_RATE_HIGH, req.pkt_rate_high.value());
 	if (req.rx_usecs_high.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_RX_USECS_HIGH, req.rx_usecs_high.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_RX_USECS_HIGH, req.rx_usecs_high.value());
 	if (req.rx_max_frames_high.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_RX_MAX_FRAMES_HIGH, req.rx_max_frames_high.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_RX_MAX_FRAMES_HIGH, req.rx_max_frames_high.value());
 	if (req.tx_usecs_high.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_TX_USECS_HIGH, req.tx_usecs_high.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_TX_USECS_HIGH, req.tx_usecs_high.value());
 	if (req.tx_max_frames_high.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_TX_MAX_FRAMES_HIGH, req.tx_max_frames_high.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_TX_MAX_FRAMES_HIGH, req.tx_max_frames_high.value());
 	if (req.rate_sample_interval.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_RATE_SAMPLE_INTERVAL, req.rate_sample_interval.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_RATE_SAMPLE_INTERVAL, req.rate_sample_interval.value());
 	if (req.use_cqe_mode_tx.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_COALESCE_USE_CQE_MODE_TX, req.use_cqe_mode_tx.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_COALESCE_USE_CQE_MODE_TX, req.use_cqe_mode_tx.value());
 	if (req.use_cqe_mode_rx.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_COALESCE_USE_CQE_MODE_RX, req.use_cqe_mode_rx.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_COALESCE_USE_CQE_MODE_RX, req.use_cqe_mode_rx.value());
 	if (req.tx_aggr_max_bytes.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_TX_AGGR_MAX_BYTES, req.tx_aggr_max_bytes.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_TX_AGGR_MAX_BYTES, req.tx_aggr_max_bytes.value());
 	if (req.tx_aggr_max_frames.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_TX_AGGR_MAX_FRAMES, req.tx_aggr_max_frames.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_TX_AGGR_MAX_FRAMES, req.tx_aggr_max_frames.value());
 	if (req.tx_aggr_time_usecs.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_COALESCE_TX_AGGR_TIME_USECS, req.tx_aggr_time_usecs.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_COALESCE_TX_AGGR_TIME_USECS, req.tx_aggr_time_usecs.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_COALESCE_HEADER, req.header.value());
 	if (req.rx_profile.has_value())
 		ethtool_profile_put(nlh, ETHTOOL_A_COALESCE_RX_PROFILE, req.rx_profile.value());
 	if (req.tx_profile.has_value())
 		ethtool_profile_put(nlh, ETHTOOL_A_COALESCE_TX_PROFILE, req.tx_profile.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_coalesce_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_coalesce_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_coalesce_set_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_coalesce_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_COALESCE_SET, 1);
+	ethtool_coalesce_set_put(nlh, req);
+
+	return ethtool_coalesce_set_exec(ys, nlh);
+}
+
+int ethtool_coalesce_set(ynl_cpp::ynl_socket&  ys,
+			 ethtool_coalesce_set_req& req)
+{
+	auto ret = ethtool_coalesce_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_coalesce_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_coalesce_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_COALESCE_SET, 1);
+	ethtool_coalesce_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_coalesce_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	return ethtool_coalesce_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_coalesce_set(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_coalesce_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_coalesce_set_batch(ynl_cpp::msg_batch& batch,
+			   ethtool_coalesce_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_COALESCE_SET, 1);
+	ethtool_coalesce_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_coalesce_nest);
 }
 
 /* ============== ETHTOOL_MSG_PAUSE_GET ============== */
@@ -3867,37 +5754,40 @@ int ethtool_pause_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_PAUSE_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_PAUSE_AUTONEG) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->autoneg = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_PAUSE_RX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->rx = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_PAUSE_TX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->tx = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_PAUSE_STATS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_pause_stat_nest;
-			parg.data = &dst->stats;
+			parg.data = &dst->stats.emplace();
 			if (ethtool_pause_stat_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_PAUSE_STATS_SRC) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->stats_src = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -3905,101 +5795,280 @@ int ethtool_pause_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_pause_get_rsp>
-ethtool_pause_get(ynl_cpp::ynl_socket&  ys, ethtool_pause_get_req& req)
+static void
+ethtool_pause_get_put(struct nlmsghdr *nlh, ethtool_pause_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PAUSE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_pause_get_rsp>>
+ethtool_pause_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_pause_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PAUSE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_pause_nest;
 	yrs.yarg.rsp_policy = &ethtool_pause_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PAUSE_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_pause_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_pause_get_rsp_parse;
 	yrs.rsp_cmd = 22;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_pause_get_rsp>>
+ethtool_pause_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_pause_get_req& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PAUSE_GET, 1);
+	ethtool_pause_get_put(nlh, req);
+
+	return ethtool_pause_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_pause_get_rsp>
+ethtool_pause_get(ynl_cpp::ynl_socket&  ys, ethtool_pause_get_req& req)
+{
+	auto ret = ethtool_pause_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pause_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_pause_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PAUSE_GET, 1);
+	ethtool_pause_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_pause_get_rsp>>
+ethtool_pause_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return ethtool_pause_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_pause_get_rsp>
+ethtool_pause_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_pause_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_PAUSE_GET - dump */
-std::unique_ptr<ethtool_pause_get_list>
-ethtool_pause_get_dump(ynl_cpp::ynl_socket&  ys,
-		       ethtool_pause_get_req_dump& req)
+static void
+ethtool_pause_get_dump_put(struct nlmsghdr *nlh,
+			   ethtool_pause_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PAUSE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_pause_get_list>>
+ethtool_pause_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_pause_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_pause_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_pause_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_pause_get_rsp_parse;
 	yds.rsp_cmd = 22;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PAUSE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_pause_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PAUSE_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ETHTOOL_MSG_PAUSE_GET - notify */
-/* ============== ETHTOOL_MSG_PAUSE_SET ============== */
-/* ETHTOOL_MSG_PAUSE_SET - do */
-int ethtool_pause_set(ynl_cpp::ynl_socket&  ys, ethtool_pause_set_req& req)
+ynl_cpp::result<std::unique_ptr<ethtool_pause_get_list>>
+ethtool_pause_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ethtool_pause_get_req_dump& req,
+			  const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PAUSE_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_pause_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PAUSE_HEADER, req.header.value());
-	if (req.autoneg.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_PAUSE_AUTONEG, req.autoneg.value());
-	if (req.rx.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_PAUSE_RX, req.rx.value());
-	if (req.tx.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_PAUSE_TX, req.tx.value());
-	if (req.stats.has_value())
-		ethtool_pause_stat_put(nlh, ETHTOOL_A_PAUSE_STATS, req.stats.value());
-	if (req.stats_src.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_PAUSE_STATS_SRC, req.stats_src.value());
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PAUSE_GET, 1);
+	ethtool_pause_get_dump_put(nlh, req);
 
-	err = ynl_exec(ys, nlh, &yrs);
-	if (err < 0)
-		return -1;
+	return ethtool_pause_get_dump_exec(ys, nlh, proj);
+}
 
-	return 0;
+std::unique_ptr<ethtool_pause_get_list>
+ethtool_pause_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ethtool_pause_get_req_dump& req)
+{
+	auto ret = ethtool_pause_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
 }
 
-/* ============== ETHTOOL_MSG_EEE_GET ============== */
-/* ETHTOOL_MSG_EEE_GET - do */
-int ethtool_eee_get_rsp_parse(const struct nlmsghdr *nlh,
-			      struct ynl_parse_arg *yarg)
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pause_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       ethtool_pause_get_req_dump& req)
 {
-	const struct nlattr *attr;
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PAUSE_GET, 1);
+	ethtool_pause_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_pause_get_list>>
+ethtool_pause_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj)
+{
+	return ethtool_pause_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_pause_get_list>
+ethtool_pause_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_pause_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ETHTOOL_MSG_PAUSE_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_pause_get_ntf>());
+
+static void *ethtool_pause_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_pause_get_ntf())->obj;
+}
+
+static void ethtool_pause_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_pause_get_ntf *rsp = (ethtool_pause_get_ntf *)ntf;
+
+	rsp->~ethtool_pause_get_ntf();
+	::free(rsp);
+}
+
+/* ============== ETHTOOL_MSG_PAUSE_SET ============== */
+/* ETHTOOL_MSG_PAUSE_SET - do */
+static void
+ethtool_pause_set_put(struct nlmsghdr *nlh, ethtool_pause_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 32 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.autoneg.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_PAUSE_AUTONEG, req.autoneg.value());
+	if (req.rx.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_PAUSE_RX, req.rx.value());
+	if (req.tx.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_PAUSE_TX, req.tx.value());
+	if (req.stats_src.has_value())
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_PAUSE_STATS_SRC, req.stats_src.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PAUSE_HEADER, req.header.value());
+	if (req.stats.has_value())
+		ethtool_pause_stat_put(nlh, ETHTOOL_A_PAUSE_STATS, req.stats.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_pause_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_pause_nest;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_pause_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_pause_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PAUSE_SET, 1);
+	ethtool_pause_set_put(nlh, req);
+
+	return ethtool_pause_set_exec(ys, nlh);
+}
+
+int ethtool_pause_set(ynl_cpp::ynl_socket&  ys, ethtool_pause_set_req& req)
+{
+	auto ret = ethtool_pause_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pause_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_pause_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PAUSE_SET, 1);
+	ethtool_pause_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_pause_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ethtool_pause_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_pause_set(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_pause_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_pause_set_batch(ynl_cpp::msg_batch& batch, ethtool_pause_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_PAUSE_SET, 1);
+	ethtool_pause_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_pause_nest);
+}
+
+/* ============== ETHTOOL_MSG_EEE_GET ============== */
+/* ETHTOOL_MSG_EEE_GET - do */
+int ethtool_eee_get_rsp_parse(const struct nlmsghdr *nlh,
+			      struct ynl_parse_arg *yarg)
+{
+	const struct nlattr *attr;
 	struct ynl_parse_arg parg;
 	ethtool_eee_get_rsp *dst;
 
@@ -4009,45 +6078,48 @@ int ethtool_eee_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_EEE_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_EEE_MODES_OURS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->modes_ours;
+			parg.data = &dst->modes_ours.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_EEE_MODES_PEER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->modes_peer;
+			parg.data = &dst->modes_peer.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_EEE_ACTIVE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->active = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_EEE_ENABLED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->enabled = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_EEE_TX_LPI_ENABLED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->tx_lpi_enabled = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_EEE_TX_LPI_TIMER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_lpi_timer = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -4055,94 +6127,268 @@ int ethtool_eee_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_eee_get_rsp>
-ethtool_eee_get(ynl_cpp::ynl_socket&  ys, ethtool_eee_get_req& req)
+static void ethtool_eee_get_put(struct nlmsghdr *nlh, ethtool_eee_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_EEE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_eee_get_rsp>>
+ethtool_eee_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_eee_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_EEE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_eee_nest;
 	yrs.yarg.rsp_policy = &ethtool_eee_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_EEE_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_eee_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_eee_get_rsp_parse;
 	yrs.rsp_cmd = 24;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_eee_get_rsp>>
+ethtool_eee_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_eee_get_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_EEE_GET, 1);
+	ethtool_eee_get_put(nlh, req);
+
+	return ethtool_eee_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_eee_get_rsp>
+ethtool_eee_get(ynl_cpp::ynl_socket&  ys, ethtool_eee_get_req& req)
+{
+	auto ret = ethtool_eee_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_eee_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_eee_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_EEE_GET, 1);
+	ethtool_eee_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_eee_get_rsp>>
+ethtool_eee_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return ethtool_eee_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_eee_get_rsp>
+ethtool_eee_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_eee_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_EEE_GET - dump */
-std::unique_ptr<ethtool_eee_get_list>
-ethtool_eee_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_eee_get_req_dump& req)
+static void
+ethtool_eee_get_dump_put(struct nlmsghdr *nlh, ethtool_eee_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_EEE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_eee_get_list>>
+ethtool_eee_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_eee_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_eee_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_eee_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_eee_get_rsp_parse;
 	yds.rsp_cmd = 24;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_EEE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_eee_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_EEE_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_eee_get_list>>
+ethtool_eee_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_eee_get_req_dump& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_EEE_GET, 1);
+	ethtool_eee_get_dump_put(nlh, req);
+
+	return ethtool_eee_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_eee_get_list>
+ethtool_eee_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_eee_get_req_dump& req)
+{
+	auto ret = ethtool_eee_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_eee_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_eee_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_EEE_GET, 1);
+	ethtool_eee_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_eee_get_list>>
+ethtool_eee_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_eee_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_eee_get_list>
+ethtool_eee_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_eee_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_EEE_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_eee_get_ntf>());
+
+static void *ethtool_eee_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_eee_get_ntf())->obj;
+}
+
+static void ethtool_eee_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_eee_get_ntf *rsp = (ethtool_eee_get_ntf *)ntf;
+
+	rsp->~ethtool_eee_get_ntf();
+	::free(rsp);
+}
+
 /* ============== ETHTOOL_MSG_EEE_SET ============== */
 /* ETHTOOL_MSG_EEE_SET - do */
-int ethtool_eee_set(ynl_cpp::ynl_socket&  ys, ethtool_eee_set_req& req)
+static void ethtool_eee_set_put(struct nlmsghdr *nlh, ethtool_eee_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_EEE_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_eee_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 32 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.active.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_EEE_ACTIVE, req.active.value());
+	if (req.enabled.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_EEE_ENABLED, req.enabled.value());
+	if (req.tx_lpi_enabled.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_EEE_TX_LPI_ENABLED, req.tx_lpi_enabled.value());
+	if (req.tx_lpi_timer.has_value())
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_EEE_TX_LPI_TIMER, req.tx_lpi_timer.value());
 	if (req.header.has_value())
 		ethtool_header_put(nlh, ETHTOOL_A_EEE_HEADER, req.header.value());
 	if (req.modes_ours.has_value())
 		ethtool_bitset_put(nlh, ETHTOOL_A_EEE_MODES_OURS, req.modes_ours.value());
 	if (req.modes_peer.has_value())
 		ethtool_bitset_put(nlh, ETHTOOL_A_EEE_MODES_PEER, req.modes_peer.value());
-	if (req.active.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_EEE_ACTIVE, req.active.value());
-	if (req.enabled.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_EEE_ENABLED, req.enabled.value());
-	if (req.tx_lpi_enabled.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_EEE_TX_LPI_ENABLED, req.tx_lpi_enabled.value());
-	if (req.tx_lpi_timer.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_EEE_TX_LPI_TIMER, req.tx_lpi_timer.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_eee_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_eee_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_eee_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_eee_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_EEE_SET, 1);
+	ethtool_eee_set_put(nlh, req);
+
+	return ethtool_eee_set_exec(ys, nlh);
+}
+
+int ethtool_eee_set(ynl_cpp::ynl_socket&  ys, ethtool_eee_set_req& req)
+{
+	auto ret = ethtool_eee_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_eee_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_eee_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_EEE_SET, 1);
+	ethtool_eee_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_eee_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ethtool_eee_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_eee_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_eee_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_eee_set_batch(ynl_cpp::msg_batch& batch, ethtool_eee_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_EEE_SET, 1);
+	ethtool_eee_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_eee_nest);
 }
 
 /* ============== ETHTOOL_MSG_TSINFO_GET ============== */
@@ -4160,56 +6406,59 @@ int ethtool_tsinfo_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_TSINFO_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSINFO_TIMESTAMPING) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->timestamping;
+			parg.data = &dst->timestamping.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSINFO_TX_TYPES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->tx_types;
+			parg.data = &dst->tx_types.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSINFO_RX_FILTERS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->rx_filters;
+			parg.data = &dst->rx_filters.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSINFO_PHC_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->phc_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_TSINFO_STATS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_ts_stat_nest;
-			parg.data = &dst->stats;
+			parg.data = &dst->stats.emplace();
 			if (ethtool_ts_stat_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSINFO_HWTSTAMP_PROVIDER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_ts_hwtstamp_provider_nest;
-			parg.data = &dst->hwtstamp_provider;
+			parg.data = &dst->hwtstamp_provider.emplace();
 			if (ethtool_ts_hwtstamp_provider_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -4218,109 +6467,337 @@ int ethtool_tsinfo_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_tsinfo_get_rsp>
-ethtool_tsinfo_get(ynl_cpp::ynl_socket&  ys, ethtool_tsinfo_get_req& req)
+static void
+ethtool_tsinfo_get_put(struct nlmsghdr *nlh, ethtool_tsinfo_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_TSINFO_HEADER, req.header.value());
+	if (req.hwtstamp_provider.has_value())
+		ethtool_ts_hwtstamp_provider_put(nlh, ETHTOOL_A_TSINFO_HWTSTAMP_PROVIDER, req.hwtstamp_provider.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_tsinfo_get_rsp>>
+ethtool_tsinfo_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_tsinfo_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSINFO_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_tsinfo_nest;
 	yrs.yarg.rsp_policy = &ethtool_tsinfo_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_TSINFO_HEADER, req.header.value());
-	if (req.hwtstamp_provider.has_value())
-		ethtool_ts_hwtstamp_provider_put(nlh, ETHTOOL_A_TSINFO_HWTSTAMP_PROVIDER, req.hwtstamp_provider.value());
-
 	rsp.reset(new ethtool_tsinfo_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_tsinfo_get_rsp_parse;
 	yrs.rsp_cmd = 26;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_tsinfo_get_rsp>>
+ethtool_tsinfo_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_tsinfo_get_req& req,
+		      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSINFO_GET, 1);
+	ethtool_tsinfo_get_put(nlh, req);
+
+	return ethtool_tsinfo_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_tsinfo_get_rsp>
+ethtool_tsinfo_get(ynl_cpp::ynl_socket&  ys, ethtool_tsinfo_get_req& req)
+{
+	auto ret = ethtool_tsinfo_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tsinfo_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   ethtool_tsinfo_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSINFO_GET, 1);
+	ethtool_tsinfo_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_tsinfo_get_rsp>>
+ethtool_tsinfo_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj)
+{
+	return ethtool_tsinfo_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_tsinfo_get_rsp>
+ethtool_tsinfo_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_tsinfo_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_TSINFO_GET - dump */
-std::unique_ptr<ethtool_tsinfo_get_list>
-ethtool_tsinfo_get_dump(ynl_cpp::ynl_socket&  ys,
-			ethtool_tsinfo_get_req_dump& req)
+static void
+ethtool_tsinfo_get_dump_put(struct nlmsghdr *nlh,
+			    ethtool_tsinfo_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_TSINFO_HEADER, req.header.value());
+	if (req.hwtstamp_provider.has_value())
+		ethtool_ts_hwtstamp_provider_put(nlh, ETHTOOL_A_TSINFO_HWTSTAMP_PROVIDER, req.hwtstamp_provider.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_tsinfo_get_list>>
+ethtool_tsinfo_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			     const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_tsinfo_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_tsinfo_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_tsinfo_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_tsinfo_get_rsp_parse;
 	yds.rsp_cmd = 26;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSINFO_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_tsinfo_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_TSINFO_HEADER, req.header.value());
-	if (req.hwtstamp_provider.has_value())
-		ethtool_ts_hwtstamp_provider_put(nlh, ETHTOOL_A_TSINFO_HWTSTAMP_PROVIDER, req.hwtstamp_provider.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_tsinfo_get_list>>
+ethtool_tsinfo_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_tsinfo_get_req_dump& req,
+			   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSINFO_GET, 1);
+	ethtool_tsinfo_get_dump_put(nlh, req);
+
+	return ethtool_tsinfo_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_tsinfo_get_list>
+ethtool_tsinfo_get_dump(ynl_cpp::ynl_socket&  ys,
+			ethtool_tsinfo_get_req_dump& req)
+{
+	auto ret = ethtool_tsinfo_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tsinfo_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_tsinfo_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSINFO_GET, 1);
+	ethtool_tsinfo_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_tsinfo_get_list>>
+ethtool_tsinfo_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj)
+{
+	return ethtool_tsinfo_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_tsinfo_get_list>
+ethtool_tsinfo_get_dump(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_tsinfo_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== ETHTOOL_MSG_CABLE_TEST_ACT ============== */
 /* ETHTOOL_MSG_CABLE_TEST_ACT - do */
-int ethtool_cable_test_act(ynl_cpp::ynl_socket&  ys,
+static void
+ethtool_cable_test_act_put(struct nlmsghdr *nlh,
 			   ethtool_cable_test_act_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_CABLE_TEST_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_cable_test_act_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CABLE_TEST_ACT, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_cable_test_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_CABLE_TEST_HEADER, req.header.value());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_cable_test_act_ex(ynl_cpp::ynl_socket&  ys,
+			  ethtool_cable_test_act_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CABLE_TEST_ACT, 1);
+	ethtool_cable_test_act_put(nlh, req);
+
+	return ethtool_cable_test_act_exec(ys, nlh);
+}
+
+int ethtool_cable_test_act(ynl_cpp::ynl_socket&  ys,
+			   ethtool_cable_test_act_req& req)
+{
+	auto ret = ethtool_cable_test_act_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_cable_test_act_prepare(ynl_cpp::ynl_socket&  ys,
+			       ethtool_cable_test_act_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CABLE_TEST_ACT, 1);
+	ethtool_cable_test_act_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_cable_test_act_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	return ethtool_cable_test_act_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_cable_test_act(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_cable_test_act_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_cable_test_act_batch(ynl_cpp::msg_batch& batch,
+			     ethtool_cable_test_act_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_CABLE_TEST_ACT, 1);
+	ethtool_cable_test_act_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_cable_test_nest);
 }
 
 /* ============== ETHTOOL_MSG_CABLE_TEST_TDR_ACT ============== */
 /* ETHTOOL_MSG_CABLE_TEST_TDR_ACT - do */
-int ethtool_cable_test_tdr_act(ynl_cpp::ynl_socket&  ys,
+static void
+ethtool_cable_test_tdr_act_put(struct nlmsghdr *nlh,
 			       ethtool_cable_test_tdr_act_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_CABLE_TEST_TDR_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_cable_test_tdr_act_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CABLE_TEST_TDR_ACT, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_cable_test_tdr_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_CABLE_TEST_TDR_HEADER, req.header.value());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_cable_test_tdr_act_ex(ynl_cpp::ynl_socket&  ys,
+			      ethtool_cable_test_tdr_act_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CABLE_TEST_TDR_ACT, 1);
+	ethtool_cable_test_tdr_act_put(nlh, req);
+
+	return ethtool_cable_test_tdr_act_exec(ys, nlh);
+}
+
+int ethtool_cable_test_tdr_act(ynl_cpp::ynl_socket&  ys,
+			       ethtool_cable_test_tdr_act_req& req)
+{
+	auto ret = ethtool_cable_test_tdr_act_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_cable_test_tdr_act_prepare(ynl_cpp::ynl_socket&  ys,
+				   ethtool_cable_test_tdr_act_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_CABLE_TEST_TDR_ACT, 1);
+	ethtool_cable_test_tdr_act_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_cable_test_tdr_act_ex(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl)
+{
+	return ethtool_cable_test_tdr_act_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_cable_test_tdr_act(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_cable_test_tdr_act_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_cable_test_tdr_act_batch(ynl_cpp::msg_batch& batch,
+				 ethtool_cable_test_tdr_act_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_CABLE_TEST_TDR_ACT, 1);
+	ethtool_cable_test_tdr_act_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_cable_test_tdr_nest);
 }
 
 /* ============== ETHTOOL_MSG_TUNNEL_INFO_GET ============== */
@@ -4338,20 +6815,23 @@ int ethtool_tunnel_info_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_TUNNEL_INFO_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TUNNEL_INFO_UDP_PORTS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_tunnel_udp_nest;
-			parg.data = &dst->udp_ports;
+			parg.data = &dst->udp_ports.emplace();
 			if (ethtool_tunnel_udp_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -4360,64 +6840,178 @@ int ethtool_tunnel_info_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_tunnel_info_get_rsp>
-ethtool_tunnel_info_get(ynl_cpp::ynl_socket&  ys,
-			ethtool_tunnel_info_get_req& req)
+static void
+ethtool_tunnel_info_get_put(struct nlmsghdr *nlh,
+			    ethtool_tunnel_info_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_TUNNEL_INFO_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_tunnel_info_get_rsp>>
+ethtool_tunnel_info_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			     const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_tunnel_info_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TUNNEL_INFO_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_tunnel_info_nest;
 	yrs.yarg.rsp_policy = &ethtool_tunnel_info_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_TUNNEL_INFO_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_tunnel_info_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_tunnel_info_get_rsp_parse;
 	yrs.rsp_cmd = 29;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_tunnel_info_get_rsp>>
+ethtool_tunnel_info_get_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_tunnel_info_get_req& req,
+			   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TUNNEL_INFO_GET, 1);
+	ethtool_tunnel_info_get_put(nlh, req);
+
+	return ethtool_tunnel_info_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_tunnel_info_get_rsp>
+ethtool_tunnel_info_get(ynl_cpp::ynl_socket&  ys,
+			ethtool_tunnel_info_get_req& req)
+{
+	auto ret = ethtool_tunnel_info_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tunnel_info_get_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_tunnel_info_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TUNNEL_INFO_GET, 1);
+	ethtool_tunnel_info_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_tunnel_info_get_rsp>>
+ethtool_tunnel_info_get_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj)
+{
+	return ethtool_tunnel_info_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_tunnel_info_get_rsp>
+ethtool_tunnel_info_get(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_tunnel_info_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_TUNNEL_INFO_GET - dump */
-std::unique_ptr<ethtool_tunnel_info_get_list>
-ethtool_tunnel_info_get_dump(ynl_cpp::ynl_socket&  ys,
-			     ethtool_tunnel_info_get_req_dump& req)
+static void
+ethtool_tunnel_info_get_dump_put(struct nlmsghdr *nlh,
+				 ethtool_tunnel_info_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_TUNNEL_INFO_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_tunnel_info_get_list>>
+ethtool_tunnel_info_get_dump_exec(ynl_cpp::ynl_socket&  ys,
+				  struct nlmsghdr *nlh,
+				  const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_tunnel_info_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_tunnel_info_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_tunnel_info_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_tunnel_info_get_rsp_parse;
 	yds.rsp_cmd = 29;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TUNNEL_INFO_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_tunnel_info_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_TUNNEL_INFO_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_tunnel_info_get_list>>
+ethtool_tunnel_info_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ethtool_tunnel_info_get_req_dump& req,
+				const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TUNNEL_INFO_GET, 1);
+	ethtool_tunnel_info_get_dump_put(nlh, req);
+
+	return ethtool_tunnel_info_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_tunnel_info_get_list>
+ethtool_tunnel_info_get_dump(ynl_cpp::ynl_socket&  ys,
+			     ethtool_tunnel_info_get_req_dump& req)
+{
+	auto ret = ethtool_tunnel_info_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tunnel_info_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				     ethtool_tunnel_info_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TUNNEL_INFO_GET, 1);
+	ethtool_tunnel_info_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_tunnel_info_get_list>>
+ethtool_tunnel_info_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl,
+				const ynl_cpp::projection *proj)
+{
+	return ethtool_tunnel_info_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_tunnel_info_get_list>
+ethtool_tunnel_info_get_dump(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_tunnel_info_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== ETHTOOL_MSG_FEC_GET ============== */
 /* ETHTOOL_MSG_FEC_GET - do */
 int ethtool_fec_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -4433,128 +7027,305 @@ int ethtool_fec_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_FEC_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_FEC_MODES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->modes;
+			parg.data = &dst->modes.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_FEC_AUTO) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->auto_ = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_FEC_ACTIVE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->active = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_FEC_STATS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_fec_stat_nest;
-			parg.data = &dst->stats;
+			parg.data = &dst->stats.emplace();
 			if (ethtool_fec_stat_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
 	}
 
-	return YNL_PARSE_CB_OK;
+	return YNL_PARSE_CB_OK;
+}
+
+static void ethtool_fec_get_put(struct nlmsghdr *nlh, ethtool_fec_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_FEC_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_fec_get_rsp>>
+ethtool_fec_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<ethtool_fec_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_fec_nest;
+	yrs.yarg.rsp_policy = &ethtool_fec_nest;
+
+	rsp.reset(new ethtool_fec_get_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = ethtool_fec_get_rsp_parse;
+	yrs.rsp_cmd = 30;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_fec_get_rsp>>
+ethtool_fec_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_fec_get_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEC_GET, 1);
+	ethtool_fec_get_put(nlh, req);
+
+	return ethtool_fec_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_fec_get_rsp>
+ethtool_fec_get(ynl_cpp::ynl_socket&  ys, ethtool_fec_get_req& req)
+{
+	auto ret = ethtool_fec_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_fec_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_fec_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEC_GET, 1);
+	ethtool_fec_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_fec_get_rsp>>
+ethtool_fec_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return ethtool_fec_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_fec_get_rsp>
+ethtool_fec_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_fec_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ETHTOOL_MSG_FEC_GET - dump */
+static void
+ethtool_fec_get_dump_put(struct nlmsghdr *nlh, ethtool_fec_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_FEC_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_fec_get_list>>
+ethtool_fec_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<ethtool_fec_get_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &ethtool_fec_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_fec_get_list*>(arg)->objs.emplace_back());};
+	yds.cb = ethtool_fec_get_rsp_parse;
+	yds.rsp_cmd = 30;
+	((struct ynl_sock*)ys)->req_policy = &ethtool_fec_nest;
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_fec_get_list>>
+ethtool_fec_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_fec_get_req_dump& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEC_GET, 1);
+	ethtool_fec_get_dump_put(nlh, req);
+
+	return ethtool_fec_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_fec_get_list>
+ethtool_fec_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_fec_get_req_dump& req)
+{
+	auto ret = ethtool_fec_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_fec_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_fec_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEC_GET, 1);
+	ethtool_fec_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_fec_get_list>>
+ethtool_fec_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_fec_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_fec_get_list>
+ethtool_fec_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_fec_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ETHTOOL_MSG_FEC_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_fec_get_ntf>());
+
+static void *ethtool_fec_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_fec_get_ntf())->obj;
+}
+
+static void ethtool_fec_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_fec_get_ntf *rsp = (ethtool_fec_get_ntf *)ntf;
+
+	rsp->~ethtool_fec_get_ntf();
+	::free(rsp);
+}
+
+/* ============== ETHTOOL_MSG_FEC_SET ============== */
+/* ETHTOOL_MSG_FEC_SET - do */
+static void ethtool_fec_set_put(struct nlmsghdr *nlh, ethtool_fec_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.auto_.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_FEC_AUTO, req.auto_.value());
+	if (req.active.has_value())
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_FEC_ACTIVE, req.active.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_FEC_HEADER, req.header.value());
+	if (req.modes.has_value())
+		ethtool_bitset_put(nlh, ETHTOOL_A_FEC_MODES, req.modes.value());
+	if (req.stats.has_value())
+		ethtool_fec_stat_put(nlh, ETHTOOL_A_FEC_STATS, req.stats.value());
 }
 
-std::unique_ptr<ethtool_fec_get_rsp>
-ethtool_fec_get(ynl_cpp::ynl_socket&  ys, ethtool_fec_get_req& req)
+static ynl_cpp::result<void>
+ethtool_fec_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<ethtool_fec_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEC_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_fec_nest;
-	yrs.yarg.rsp_policy = &ethtool_fec_nest;
-
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_FEC_HEADER, req.header.value());
-
-	rsp.reset(new ethtool_fec_get_rsp());
-	yrs.yarg.data = rsp.get();
-	yrs.cb = ethtool_fec_get_rsp_parse;
-	yrs.rsp_cmd = 30;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return rsp;
+	return {};
 }
 
-/* ETHTOOL_MSG_FEC_GET - dump */
-std::unique_ptr<ethtool_fec_get_list>
-ethtool_fec_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_fec_get_req_dump& req)
+ynl_cpp::result<void>
+ethtool_fec_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_fec_set_req& req)
 {
-	struct ynl_dump_no_alloc_state yds = {};
 	struct nlmsghdr *nlh;
-	int err;
-
-	auto ret = std::make_unique<ethtool_fec_get_list>();
-	yds.yarg.ys = ys;
-	yds.yarg.rsp_policy = &ethtool_fec_nest;
-	yds.yarg.data = ret.get();
-	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_fec_get_list*>(arg)->objs.emplace_back());};
-	yds.cb = ethtool_fec_get_rsp_parse;
-	yds.rsp_cmd = 30;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEC_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_fec_nest;
-
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_FEC_HEADER, req.header.value());
 
-	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
-	if (err < 0)
-		return nullptr;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEC_SET, 1);
+	ethtool_fec_set_put(nlh, req);
 
-	return ret;
+	return ethtool_fec_set_exec(ys, nlh);
 }
 
-/* ETHTOOL_MSG_FEC_GET - notify */
-/* ============== ETHTOOL_MSG_FEC_SET ============== */
-/* ETHTOOL_MSG_FEC_SET - do */
 int ethtool_fec_set(ynl_cpp::ynl_socket&  ys, ethtool_fec_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	auto ret = ethtool_fec_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_fec_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_fec_set_req& req)
+{
 	struct nlmsghdr *nlh;
-	int err;
 
 	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_FEC_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_fec_nest;
+	ethtool_fec_set_put(nlh, req);
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_FEC_HEADER, req.header.value());
-	if (req.modes.has_value())
-		ethtool_bitset_put(nlh, ETHTOOL_A_FEC_MODES, req.modes.value());
-	if (req.auto_.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_FEC_AUTO, req.auto_.value());
-	if (req.active.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_FEC_ACTIVE, req.active.value());
-	if (req.stats.has_value())
-		ethtool_fec_stat_put(nlh, ETHTOOL_A_FEC_STATS, req.stats.value());
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
 
-	err = ynl_exec(ys, nlh, &yrs);
-	if (err < 0)
-		return -1;
+ynl_cpp::result<void>
+ethtool_fec_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ethtool_fec_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
 
-	return 0;
+int ethtool_fec_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_fec_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_fec_set_batch(ynl_cpp::msg_batch& batch, ethtool_fec_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_FEC_SET, 1);
+	ethtool_fec_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_fec_nest);
 }
 
 /* ============== ETHTOOL_MSG_MODULE_EEPROM_GET ============== */
@@ -4572,37 +7343,38 @@ int ethtool_module_eeprom_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_MODULE_EEPROM_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_MODULE_EEPROM_OFFSET) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->offset = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_MODULE_EEPROM_LENGTH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->length = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_MODULE_EEPROM_PAGE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->page = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_MODULE_EEPROM_BANK) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->bank = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_MODULE_EEPROM_I2C_ADDRESS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->i2c_address = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_MODULE_EEPROM_DATA) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->data.assign(data, data + len);
@@ -4612,64 +7384,178 @@ int ethtool_module_eeprom_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_module_eeprom_get_rsp>
-ethtool_module_eeprom_get(ynl_cpp::ynl_socket&  ys,
-			  ethtool_module_eeprom_get_req& req)
+static void
+ethtool_module_eeprom_get_put(struct nlmsghdr *nlh,
+			      ethtool_module_eeprom_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_MODULE_EEPROM_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_module_eeprom_get_rsp>>
+ethtool_module_eeprom_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_module_eeprom_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_EEPROM_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_module_eeprom_nest;
 	yrs.yarg.rsp_policy = &ethtool_module_eeprom_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_MODULE_EEPROM_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_module_eeprom_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_module_eeprom_get_rsp_parse;
 	yrs.rsp_cmd = 32;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_module_eeprom_get_rsp>>
+ethtool_module_eeprom_get_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_module_eeprom_get_req& req,
+			     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_EEPROM_GET, 1);
+	ethtool_module_eeprom_get_put(nlh, req);
+
+	return ethtool_module_eeprom_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_module_eeprom_get_rsp>
+ethtool_module_eeprom_get(ynl_cpp::ynl_socket&  ys,
+			  ethtool_module_eeprom_get_req& req)
+{
+	auto ret = ethtool_module_eeprom_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_eeprom_get_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_module_eeprom_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_EEPROM_GET, 1);
+	ethtool_module_eeprom_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_module_eeprom_get_rsp>>
+ethtool_module_eeprom_get_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return ethtool_module_eeprom_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_module_eeprom_get_rsp>
+ethtool_module_eeprom_get(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_module_eeprom_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_MODULE_EEPROM_GET - dump */
-std::unique_ptr<ethtool_module_eeprom_get_list>
-ethtool_module_eeprom_get_dump(ynl_cpp::ynl_socket&  ys,
-			       ethtool_module_eeprom_get_req_dump& req)
+static void
+ethtool_module_eeprom_get_dump_put(struct nlmsghdr *nlh,
+				   ethtool_module_eeprom_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_MODULE_EEPROM_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_module_eeprom_get_list>>
+ethtool_module_eeprom_get_dump_exec(ynl_cpp::ynl_socket&  ys,
+				    struct nlmsghdr *nlh,
+				    const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_module_eeprom_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_module_eeprom_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_module_eeprom_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_module_eeprom_get_rsp_parse;
 	yds.rsp_cmd = 32;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_EEPROM_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_module_eeprom_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_MODULE_EEPROM_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_module_eeprom_get_list>>
+ethtool_module_eeprom_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				  ethtool_module_eeprom_get_req_dump& req,
+				  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_EEPROM_GET, 1);
+	ethtool_module_eeprom_get_dump_put(nlh, req);
+
+	return ethtool_module_eeprom_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_module_eeprom_get_list>
+ethtool_module_eeprom_get_dump(ynl_cpp::ynl_socket&  ys,
+			       ethtool_module_eeprom_get_req_dump& req)
+{
+	auto ret = ethtool_module_eeprom_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_eeprom_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				       ethtool_module_eeprom_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_EEPROM_GET, 1);
+	ethtool_module_eeprom_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_module_eeprom_get_list>>
+ethtool_module_eeprom_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				  ynl_cpp::request_template& tmpl,
+				  const ynl_cpp::projection *proj)
+{
+	return ethtool_module_eeprom_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_module_eeprom_get_list>
+ethtool_module_eeprom_get_dump(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_module_eeprom_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== ETHTOOL_MSG_STATS_GET ============== */
 /* ETHTOOL_MSG_STATS_GET - do */
 int ethtool_stats_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -4685,33 +7571,36 @@ int ethtool_stats_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_STATS_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_STATS_GROUPS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->groups;
+			parg.data = &dst->groups.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_STATS_GRP) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_stats_grp_nest;
-			parg.data = &dst->grp;
+			parg.data = &dst->grp.emplace();
 			if (ethtool_stats_grp_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_STATS_SRC) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->src = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -4719,65 +7608,173 @@ int ethtool_stats_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_stats_get_rsp>
-ethtool_stats_get(ynl_cpp::ynl_socket&  ys, ethtool_stats_get_req& req)
+static void
+ethtool_stats_get_put(struct nlmsghdr *nlh, ethtool_stats_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_STATS_HEADER, req.header.value());
+	if (req.groups.has_value())
+		ethtool_bitset_put(nlh, ETHTOOL_A_STATS_GROUPS, req.groups.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_stats_get_rsp>>
+ethtool_stats_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_stats_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_STATS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_stats_nest;
 	yrs.yarg.rsp_policy = &ethtool_stats_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_STATS_HEADER, req.header.value());
-	if (req.groups.has_value())
-		ethtool_bitset_put(nlh, ETHTOOL_A_STATS_GROUPS, req.groups.value());
-
 	rsp.reset(new ethtool_stats_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_stats_get_rsp_parse;
 	yrs.rsp_cmd = 33;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_stats_get_rsp>>
+ethtool_stats_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_stats_get_req& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_STATS_GET, 1);
+	ethtool_stats_get_put(nlh, req);
+
+	return ethtool_stats_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_stats_get_rsp>
+ethtool_stats_get(ynl_cpp::ynl_socket&  ys, ethtool_stats_get_req& req)
+{
+	auto ret = ethtool_stats_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_stats_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_stats_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_STATS_GET, 1);
+	ethtool_stats_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_stats_get_rsp>>
+ethtool_stats_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return ethtool_stats_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_stats_get_rsp>
+ethtool_stats_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_stats_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_STATS_GET - dump */
-std::unique_ptr<ethtool_stats_get_list>
-ethtool_stats_get_dump(ynl_cpp::ynl_socket&  ys,
-		       ethtool_stats_get_req_dump& req)
+static void
+ethtool_stats_get_dump_put(struct nlmsghdr *nlh,
+			   ethtool_stats_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_STATS_HEADER, req.header.value());
+	if (req.groups.has_value())
+		ethtool_bitset_put(nlh, ETHTOOL_A_STATS_GROUPS, req.groups.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_stats_get_list>>
+ethtool_stats_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_stats_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_stats_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_stats_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_stats_get_rsp_parse;
 	yds.rsp_cmd = 33;
+	((struct ynl_sock*)ys)->req_policy = &ethtool_stats_nest;
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_stats_get_list>>
+ethtool_stats_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ethtool_stats_get_req_dump& req,
+			  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_STATS_GET, 1);
+	ethtool_stats_get_dump_put(nlh, req);
+
+	return ethtool_stats_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_stats_get_list>
+ethtool_stats_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ethtool_stats_get_req_dump& req)
+{
+	auto ret = ethtool_stats_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_stats_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       ethtool_stats_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
 
 	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_STATS_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_stats_nest;
+	ethtool_stats_get_dump_put(nlh, req);
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_STATS_HEADER, req.header.value());
-	if (req.groups.has_value())
-		ethtool_bitset_put(nlh, ETHTOOL_A_STATS_GROUPS, req.groups.value());
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
 
-	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
-	if (err < 0)
-		return nullptr;
+ynl_cpp::result<std::unique_ptr<ethtool_stats_get_list>>
+ethtool_stats_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj)
+{
+	return ethtool_stats_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
 
-	return ret;
+std::unique_ptr<ethtool_stats_get_list>
+ethtool_stats_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_stats_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
 }
 
 /* ============== ETHTOOL_MSG_PHC_VCLOCKS_GET ============== */
@@ -4795,17 +7792,20 @@ int ethtool_phc_vclocks_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_PHC_VCLOCKS_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_PHC_VCLOCKS_NUM) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->num = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -4813,64 +7813,178 @@ int ethtool_phc_vclocks_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_phc_vclocks_get_rsp>
-ethtool_phc_vclocks_get(ynl_cpp::ynl_socket&  ys,
-			ethtool_phc_vclocks_get_req& req)
+static void
+ethtool_phc_vclocks_get_put(struct nlmsghdr *nlh,
+			    ethtool_phc_vclocks_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PHC_VCLOCKS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_phc_vclocks_get_rsp>>
+ethtool_phc_vclocks_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			     const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_phc_vclocks_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PHC_VCLOCKS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_phc_vclocks_nest;
 	yrs.yarg.rsp_policy = &ethtool_phc_vclocks_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PHC_VCLOCKS_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_phc_vclocks_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_phc_vclocks_get_rsp_parse;
 	yrs.rsp_cmd = 34;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_phc_vclocks_get_rsp>>
+ethtool_phc_vclocks_get_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_phc_vclocks_get_req& req,
+			   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PHC_VCLOCKS_GET, 1);
+	ethtool_phc_vclocks_get_put(nlh, req);
+
+	return ethtool_phc_vclocks_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_phc_vclocks_get_rsp>
+ethtool_phc_vclocks_get(ynl_cpp::ynl_socket&  ys,
+			ethtool_phc_vclocks_get_req& req)
+{
+	auto ret = ethtool_phc_vclocks_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_phc_vclocks_get_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_phc_vclocks_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PHC_VCLOCKS_GET, 1);
+	ethtool_phc_vclocks_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_phc_vclocks_get_rsp>>
+ethtool_phc_vclocks_get_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj)
+{
+	return ethtool_phc_vclocks_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_phc_vclocks_get_rsp>
+ethtool_phc_vclocks_get(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_phc_vclocks_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_PHC_VCLOCKS_GET - dump */
-std::unique_ptr<ethtool_phc_vclocks_get_list>
-ethtool_phc_vclocks_get_dump(ynl_cpp::ynl_socket&  ys,
-			     ethtool_phc_vclocks_get_req_dump& req)
+static void
+ethtool_phc_vclocks_get_dump_put(struct nlmsghdr *nlh,
+				 ethtool_phc_vclocks_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PHC_VCLOCKS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_phc_vclocks_get_list>>
+ethtool_phc_vclocks_get_dump_exec(ynl_cpp::ynl_socket&  ys,
+				  struct nlmsghdr *nlh,
+				  const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_phc_vclocks_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_phc_vclocks_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_phc_vclocks_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_phc_vclocks_get_rsp_parse;
 	yds.rsp_cmd = 34;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PHC_VCLOCKS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_phc_vclocks_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PHC_VCLOCKS_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_phc_vclocks_get_list>>
+ethtool_phc_vclocks_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ethtool_phc_vclocks_get_req_dump& req,
+				const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PHC_VCLOCKS_GET, 1);
+	ethtool_phc_vclocks_get_dump_put(nlh, req);
+
+	return ethtool_phc_vclocks_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_phc_vclocks_get_list>
+ethtool_phc_vclocks_get_dump(ynl_cpp::ynl_socket&  ys,
+			     ethtool_phc_vclocks_get_req_dump& req)
+{
+	auto ret = ethtool_phc_vclocks_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_phc_vclocks_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				     ethtool_phc_vclocks_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PHC_VCLOCKS_GET, 1);
+	ethtool_phc_vclocks_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_phc_vclocks_get_list>>
+ethtool_phc_vclocks_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl,
+				const ynl_cpp::projection *proj)
+{
+	return ethtool_phc_vclocks_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_phc_vclocks_get_list>
+ethtool_phc_vclocks_get_dump(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_phc_vclocks_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== ETHTOOL_MSG_MODULE_GET ============== */
 /* ETHTOOL_MSG_MODULE_GET - do */
 int ethtool_module_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -4886,21 +8000,24 @@ int ethtool_module_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_MODULE_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_MODULE_POWER_MODE_POLICY) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->power_mode_policy = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_MODULE_POWER_MODE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->power_mode = (__u8)ynl_attr_get_u8(attr);
 		}
 	}
@@ -4908,87 +8025,271 @@ int ethtool_module_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_module_get_rsp>
-ethtool_module_get(ynl_cpp::ynl_socket&  ys, ethtool_module_get_req& req)
+static void
+ethtool_module_get_put(struct nlmsghdr *nlh, ethtool_module_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_MODULE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_module_get_rsp>>
+ethtool_module_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_module_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_module_nest;
 	yrs.yarg.rsp_policy = &ethtool_module_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_MODULE_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_module_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_module_get_rsp_parse;
 	yrs.rsp_cmd = 35;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_module_get_rsp>>
+ethtool_module_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_module_get_req& req,
+		      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_GET, 1);
+	ethtool_module_get_put(nlh, req);
+
+	return ethtool_module_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_module_get_rsp>
+ethtool_module_get(ynl_cpp::ynl_socket&  ys, ethtool_module_get_req& req)
+{
+	auto ret = ethtool_module_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   ethtool_module_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_GET, 1);
+	ethtool_module_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_module_get_rsp>>
+ethtool_module_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj)
+{
+	return ethtool_module_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_module_get_rsp>
+ethtool_module_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_module_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_MODULE_GET - dump */
-std::unique_ptr<ethtool_module_get_list>
-ethtool_module_get_dump(ynl_cpp::ynl_socket&  ys,
-			ethtool_module_get_req_dump& req)
+static void
+ethtool_module_get_dump_put(struct nlmsghdr *nlh,
+			    ethtool_module_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_MODULE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_module_get_list>>
+ethtool_module_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			     const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_module_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_module_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_module_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_module_get_rsp_parse;
 	yds.rsp_cmd = 35;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_module_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_MODULE_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_module_get_list>>
+ethtool_module_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_module_get_req_dump& req,
+			   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_GET, 1);
+	ethtool_module_get_dump_put(nlh, req);
+
+	return ethtool_module_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_module_get_list>
+ethtool_module_get_dump(ynl_cpp::ynl_socket&  ys,
+			ethtool_module_get_req_dump& req)
+{
+	auto ret = ethtool_module_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_module_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_GET, 1);
+	ethtool_module_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_module_get_list>>
+ethtool_module_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj)
+{
+	return ethtool_module_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_module_get_list>
+ethtool_module_get_dump(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_module_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_MODULE_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_module_get_ntf>());
+
+static void *ethtool_module_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_module_get_ntf())->obj;
+}
+
+static void ethtool_module_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_module_get_ntf *rsp = (ethtool_module_get_ntf *)ntf;
+
+	rsp->~ethtool_module_get_ntf();
+	::free(rsp);
+}
+
 /* ============== ETHTOOL_MSG_MODULE_SET ============== */
 /* ETHTOOL_MSG_MODULE_SET - do */
-int ethtool_module_set(ynl_cpp::ynl_socket&  ys, ethtool_module_set_req& req)
+static void
+ethtool_module_set_put(struct nlmsghdr *nlh, ethtool_module_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.power_mode_policy.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_MODULE_POWER_MODE_POLICY, req.power_mode_policy.value());
+	if (req.power_mode.has_value())
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_MODULE_POWER_MODE, req.power_mode.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_MODULE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_module_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_SET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_module_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_MODULE_HEADER, req.header.value());
-	if (req.power_mode_policy.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_MODULE_POWER_MODE_POLICY, req.power_mode_policy.value());
-	if (req.power_mode.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_MODULE_POWER_MODE, req.power_mode.value());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_module_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_module_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_SET, 1);
+	ethtool_module_set_put(nlh, req);
+
+	return ethtool_module_set_exec(ys, nlh);
+}
+
+int ethtool_module_set(ynl_cpp::ynl_socket&  ys, ethtool_module_set_req& req)
+{
+	auto ret = ethtool_module_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_set_prepare(ynl_cpp::ynl_socket&  ys,
+			   ethtool_module_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_SET, 1);
+	ethtool_module_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_module_set_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	return ethtool_module_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_module_set(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_module_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_module_set_batch(ynl_cpp::msg_batch& batch,
+			 ethtool_module_set_req& req)
+{
+	struct nlmsghdr *nlh;
 
-	return 0;
+	nlh = batch.gemsg_start(ETHTOOL_MSG_MODULE_SET, 1);
+	ethtool_module_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_module_nest);
 }
 
 /* ============== ETHTOOL_MSG_PSE_GET ============== */
@@ -5011,57 +8312,60 @@ int ethtool_pse_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_PSE_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_PODL_PSE_ADMIN_STATE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->podl_pse_admin_state = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PODL_PSE_ADMIN_CONTROL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->podl_pse_admin_control = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PODL_PSE_PW_D_STATUS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->podl_pse_pw_d_status = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_C33_PSE_ADMIN_STATE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->c33_pse_admin_state = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_C33_PSE_ADMIN_CONTROL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->c33_pse_admin_control = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_C33_PSE_PW_D_STATUS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->c33_pse_pw_d_status = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_C33_PSE_PW_CLASS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->c33_pse_pw_class = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_C33_PSE_ACTUAL_PW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->c33_pse_actual_pw = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_C33_PSE_EXT_STATE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->c33_pse_ext_state = (ethtool_c33_pse_ext_state)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_C33_PSE_EXT_SUBSTATE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->c33_pse_ext_substate = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_C33_PSE_AVAIL_PW_LIMIT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->c33_pse_avail_pw_limit = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_C33_PSE_PW_LIMIT_RANGES) {
 			n_c33_pse_pw_limit_ranges++;
@@ -5085,87 +8389,246 @@ int ethtool_pse_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_pse_get_rsp>
-ethtool_pse_get(ynl_cpp::ynl_socket&  ys, ethtool_pse_get_req& req)
+static void ethtool_pse_get_put(struct nlmsghdr *nlh, ethtool_pse_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PSE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_pse_get_rsp>>
+ethtool_pse_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_pse_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PSE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_pse_nest;
 	yrs.yarg.rsp_policy = &ethtool_pse_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PSE_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_pse_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_pse_get_rsp_parse;
 	yrs.rsp_cmd = 37;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_pse_get_rsp>>
+ethtool_pse_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_pse_get_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PSE_GET, 1);
+	ethtool_pse_get_put(nlh, req);
+
+	return ethtool_pse_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_pse_get_rsp>
+ethtool_pse_get(ynl_cpp::ynl_socket&  ys, ethtool_pse_get_req& req)
+{
+	auto ret = ethtool_pse_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pse_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_pse_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PSE_GET, 1);
+	ethtool_pse_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_pse_get_rsp>>
+ethtool_pse_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return ethtool_pse_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_pse_get_rsp>
+ethtool_pse_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_pse_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_PSE_GET - dump */
-std::unique_ptr<ethtool_pse_get_list>
-ethtool_pse_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_pse_get_req_dump& req)
+static void
+ethtool_pse_get_dump_put(struct nlmsghdr *nlh, ethtool_pse_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PSE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_pse_get_list>>
+ethtool_pse_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_pse_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_pse_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_pse_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_pse_get_rsp_parse;
 	yds.rsp_cmd = 37;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PSE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_pse_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PSE_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ============== ETHTOOL_MSG_PSE_SET ============== */
-/* ETHTOOL_MSG_PSE_SET - do */
-int ethtool_pse_set(ynl_cpp::ynl_socket&  ys, ethtool_pse_set_req& req)
+ynl_cpp::result<std::unique_ptr<ethtool_pse_get_list>>
+ethtool_pse_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_pse_get_req_dump& req,
+			const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PSE_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_pse_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PSE_GET, 1);
+	ethtool_pse_get_dump_put(nlh, req);
+
+	return ethtool_pse_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_pse_get_list>
+ethtool_pse_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_pse_get_req_dump& req)
+{
+	auto ret = ethtool_pse_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pse_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_pse_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PSE_GET, 1);
+	ethtool_pse_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_pse_get_list>>
+ethtool_pse_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_pse_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_pse_get_list>
+ethtool_pse_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_pse_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== ETHTOOL_MSG_PSE_SET ============== */
+/* ETHTOOL_MSG_PSE_SET - do */
+static void ethtool_pse_set_put(struct nlmsghdr *nlh, ethtool_pse_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 24 <= YNL_SOCKET_BUFFER_SIZE);
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PSE_HEADER, req.header.value());
 	if (req.podl_pse_admin_control.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_PODL_PSE_ADMIN_CONTROL, req.podl_pse_admin_control.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_PODL_PSE_ADMIN_CONTROL, req.podl_pse_admin_control.value());
 	if (req.c33_pse_admin_control.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_C33_PSE_ADMIN_CONTROL, req.c33_pse_admin_control.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_C33_PSE_ADMIN_CONTROL, req.c33_pse_admin_control.value());
 	if (req.c33_pse_avail_pw_limit.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_C33_PSE_AVAIL_PW_LIMIT, req.c33_pse_avail_pw_limit.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_C33_PSE_AVAIL_PW_LIMIT, req.c33_pse_avail_pw_limit.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PSE_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_pse_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_pse_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_pse_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_pse_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PSE_SET, 1);
+	ethtool_pse_set_put(nlh, req);
+
+	return ethtool_pse_set_exec(ys, nlh);
+}
+
+int ethtool_pse_set(ynl_cpp::ynl_socket&  ys, ethtool_pse_set_req& req)
+{
+	auto ret = ethtool_pse_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pse_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_pse_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PSE_SET, 1);
+	ethtool_pse_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_pse_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ethtool_pse_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_pse_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_pse_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_pse_set_batch(ynl_cpp::msg_batch& batch, ethtool_pse_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_PSE_SET, 1);
+	ethtool_pse_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_pse_nest);
 }
 
 /* ============== ETHTOOL_MSG_RSS_GET ============== */
@@ -5183,37 +8646,36 @@ int ethtool_rss_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_RSS_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_RSS_CONTEXT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->context = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RSS_HFUNC) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->hfunc = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_RSS_INDIR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->indir.assign(data, data + len);
 		} else if (type == ETHTOOL_A_RSS_HKEY) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->hkey.assign(data, data + len);
 		} else if (type == ETHTOOL_A_RSS_INPUT_XFRM) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->input_xfrm = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -5221,66 +8683,175 @@ int ethtool_rss_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_rss_get_rsp>
-ethtool_rss_get(ynl_cpp::ynl_socket&  ys, ethtool_rss_get_req& req)
+static void ethtool_rss_get_put(struct nlmsghdr *nlh, ethtool_rss_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.context.has_value())
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RSS_CONTEXT, req.context.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_RSS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_rss_get_rsp>>
+ethtool_rss_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_rss_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RSS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_rss_nest;
 	yrs.yarg.rsp_policy = &ethtool_rss_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_RSS_HEADER, req.header.value());
-	if (req.context.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RSS_CONTEXT, req.context.value());
-
 	rsp.reset(new ethtool_rss_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_rss_get_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_RSS_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_rss_get_rsp>>
+ethtool_rss_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_rss_get_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RSS_GET, 1);
+	ethtool_rss_get_put(nlh, req);
+
+	return ethtool_rss_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_rss_get_rsp>
+ethtool_rss_get(ynl_cpp::ynl_socket&  ys, ethtool_rss_get_req& req)
+{
+	auto ret = ethtool_rss_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rss_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_rss_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RSS_GET, 1);
+	ethtool_rss_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_rss_get_rsp>>
+ethtool_rss_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return ethtool_rss_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_rss_get_rsp>
+ethtool_rss_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_rss_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_RSS_GET - dump */
-std::unique_ptr<ethtool_rss_get_list>
-ethtool_rss_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_rss_get_req_dump& req)
+static void
+ethtool_rss_get_dump_put(struct nlmsghdr *nlh, ethtool_rss_get_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.start_context.has_value())
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RSS_START_CONTEXT, req.start_context.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_RSS_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_rss_get_list>>
+ethtool_rss_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_rss_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_rss_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_rss_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_rss_get_rsp_parse;
 	yds.rsp_cmd = ETHTOOL_MSG_RSS_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RSS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_rss_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_RSS_HEADER, req.header.value());
-	if (req.start_context.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_RSS_START_CONTEXT, req.start_context.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_rss_get_list>>
+ethtool_rss_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_rss_get_req_dump& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RSS_GET, 1);
+	ethtool_rss_get_dump_put(nlh, req);
+
+	return ethtool_rss_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_rss_get_list>
+ethtool_rss_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_rss_get_req_dump& req)
+{
+	auto ret = ethtool_rss_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rss_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_rss_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RSS_GET, 1);
+	ethtool_rss_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_rss_get_list>>
+ethtool_rss_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_rss_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_rss_get_list>
+ethtool_rss_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_rss_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== ETHTOOL_MSG_PLCA_GET_CFG ============== */
 /* ETHTOOL_MSG_PLCA_GET_CFG - do */
 int ethtool_plca_get_cfg_rsp_parse(const struct nlmsghdr *nlh,
@@ -5296,45 +8867,48 @@ int ethtool_plca_get_cfg_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_PLCA_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_PLCA_VERSION) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->version = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == ETHTOOL_A_PLCA_ENABLED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->enabled = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_PLCA_STATUS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->status = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_PLCA_NODE_CNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->node_cnt = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PLCA_NODE_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->node_id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PLCA_TO_TMR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->to_tmr = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PLCA_BURST_CNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->burst_cnt = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PLCA_BURST_TMR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->burst_tmr = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -5342,100 +8916,286 @@ int ethtool_plca_get_cfg_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_plca_get_cfg_rsp>
-ethtool_plca_get_cfg(ynl_cpp::ynl_socket&  ys, ethtool_plca_get_cfg_req& req)
+static void
+ethtool_plca_get_cfg_put(struct nlmsghdr *nlh, ethtool_plca_get_cfg_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PLCA_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_plca_get_cfg_rsp>>
+ethtool_plca_get_cfg_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_plca_get_cfg_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_CFG, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_plca_nest;
 	yrs.yarg.rsp_policy = &ethtool_plca_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PLCA_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_plca_get_cfg_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_plca_get_cfg_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_PLCA_GET_CFG;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_cfg_rsp>>
+ethtool_plca_get_cfg_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_plca_get_cfg_req& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_CFG, 1);
+	ethtool_plca_get_cfg_put(nlh, req);
+
+	return ethtool_plca_get_cfg_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_plca_get_cfg_rsp>
+ethtool_plca_get_cfg(ynl_cpp::ynl_socket&  ys, ethtool_plca_get_cfg_req& req)
+{
+	auto ret = ethtool_plca_get_cfg_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_plca_get_cfg_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_plca_get_cfg_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_CFG, 1);
+	ethtool_plca_get_cfg_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_cfg_rsp>>
+ethtool_plca_get_cfg_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_plca_get_cfg_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_plca_get_cfg_rsp>
+ethtool_plca_get_cfg(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_plca_get_cfg_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_PLCA_GET_CFG - dump */
-std::unique_ptr<ethtool_plca_get_cfg_list>
-ethtool_plca_get_cfg_dump(ynl_cpp::ynl_socket&  ys,
-			  ethtool_plca_get_cfg_req_dump& req)
+static void
+ethtool_plca_get_cfg_dump_put(struct nlmsghdr *nlh,
+			      ethtool_plca_get_cfg_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PLCA_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_plca_get_cfg_list>>
+ethtool_plca_get_cfg_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_plca_get_cfg_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_plca_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_plca_get_cfg_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_plca_get_cfg_rsp_parse;
 	yds.rsp_cmd = ETHTOOL_MSG_PLCA_GET_CFG;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_CFG, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_plca_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PLCA_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_cfg_list>>
+ethtool_plca_get_cfg_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_plca_get_cfg_req_dump& req,
+			     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_CFG, 1);
+	ethtool_plca_get_cfg_dump_put(nlh, req);
+
+	return ethtool_plca_get_cfg_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_plca_get_cfg_list>
+ethtool_plca_get_cfg_dump(ynl_cpp::ynl_socket&  ys,
+			  ethtool_plca_get_cfg_req_dump& req)
+{
+	auto ret = ethtool_plca_get_cfg_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_plca_get_cfg_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_plca_get_cfg_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_CFG, 1);
+	ethtool_plca_get_cfg_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_cfg_list>>
+ethtool_plca_get_cfg_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return ethtool_plca_get_cfg_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_plca_get_cfg_list>
+ethtool_plca_get_cfg_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_plca_get_cfg_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_PLCA_GET_CFG - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_plca_get_cfg_ntf>());
+
+static void *ethtool_plca_get_cfg_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_plca_get_cfg_ntf())->obj;
+}
+
+static void ethtool_plca_get_cfg_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_plca_get_cfg_ntf *rsp = (ethtool_plca_get_cfg_ntf *)ntf;
+
+	rsp->~ethtool_plca_get_cfg_ntf();
+	::free(rsp);
+}
+
 /* ============== ETHTOOL_MSG_PLCA_SET_CFG ============== */
 /* ETHTOOL_MSG_PLCA_SET_CFG - do */
-int ethtool_plca_set_cfg(ynl_cpp::ynl_socket&  ys,
-			 ethtool_plca_set_cfg_req& req)
+static void
+ethtool_plca_set_cfg_put(struct nlmsghdr *nlh, ethtool_plca_set_cfg_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_SET_CFG, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_plca_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 64 <= YNL_SOCKET_BUFFER_SIZE);
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PLCA_HEADER, req.header.value());
 	if (req.version.has_value())
-		ynl_attr_put_u16(nlh, ETHTOOL_A_PLCA_VERSION, req.version.value());
+		ynl_attr_put_u16_unchecked(nlh, ETHTOOL_A_PLCA_VERSION, req.version.value());
 	if (req.enabled.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_PLCA_ENABLED, req.enabled.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_PLCA_ENABLED, req.enabled.value());
 	if (req.status.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_PLCA_STATUS, req.status.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_PLCA_STATUS, req.status.value());
 	if (req.node_cnt.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_PLCA_NODE_CNT, req.node_cnt.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_PLCA_NODE_CNT, req.node_cnt.value());
 	if (req.node_id.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_PLCA_NODE_ID, req.node_id.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_PLCA_NODE_ID, req.node_id.value());
 	if (req.to_tmr.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_PLCA_TO_TMR, req.to_tmr.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_PLCA_TO_TMR, req.to_tmr.value());
 	if (req.burst_cnt.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_PLCA_BURST_CNT, req.burst_cnt.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_PLCA_BURST_CNT, req.burst_cnt.value());
 	if (req.burst_tmr.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_PLCA_BURST_TMR, req.burst_tmr.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_PLCA_BURST_TMR, req.burst_tmr.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PLCA_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_plca_set_cfg_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_plca_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_plca_set_cfg_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_plca_set_cfg_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_SET_CFG, 1);
+	ethtool_plca_set_cfg_put(nlh, req);
+
+	return ethtool_plca_set_cfg_exec(ys, nlh);
+}
+
+int ethtool_plca_set_cfg(ynl_cpp::ynl_socket&  ys,
+			 ethtool_plca_set_cfg_req& req)
+{
+	auto ret = ethtool_plca_set_cfg_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_plca_set_cfg_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_plca_set_cfg_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_SET_CFG, 1);
+	ethtool_plca_set_cfg_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_plca_set_cfg_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	return ethtool_plca_set_cfg_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_plca_set_cfg(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_plca_set_cfg_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_plca_set_cfg_batch(ynl_cpp::msg_batch& batch,
+			   ethtool_plca_set_cfg_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_PLCA_SET_CFG, 1);
+	ethtool_plca_set_cfg_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_plca_nest);
 }
 
 /* ============== ETHTOOL_MSG_PLCA_GET_STATUS ============== */
@@ -5453,45 +9213,48 @@ int ethtool_plca_get_status_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_PLCA_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_PLCA_VERSION) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->version = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == ETHTOOL_A_PLCA_ENABLED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->enabled = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_PLCA_STATUS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->status = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_PLCA_NODE_CNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->node_cnt = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PLCA_NODE_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->node_id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PLCA_TO_TMR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->to_tmr = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PLCA_BURST_CNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->burst_cnt = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PLCA_BURST_TMR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->burst_tmr = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -5499,64 +9262,178 @@ int ethtool_plca_get_status_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_plca_get_status_rsp>
-ethtool_plca_get_status(ynl_cpp::ynl_socket&  ys,
-			ethtool_plca_get_status_req& req)
+static void
+ethtool_plca_get_status_put(struct nlmsghdr *nlh,
+			    ethtool_plca_get_status_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PLCA_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_plca_get_status_rsp>>
+ethtool_plca_get_status_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			     const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_plca_get_status_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_STATUS, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_plca_nest;
 	yrs.yarg.rsp_policy = &ethtool_plca_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PLCA_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_plca_get_status_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_plca_get_status_rsp_parse;
 	yrs.rsp_cmd = 40;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_status_rsp>>
+ethtool_plca_get_status_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_plca_get_status_req& req,
+			   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_STATUS, 1);
+	ethtool_plca_get_status_put(nlh, req);
+
+	return ethtool_plca_get_status_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_plca_get_status_rsp>
+ethtool_plca_get_status(ynl_cpp::ynl_socket&  ys,
+			ethtool_plca_get_status_req& req)
+{
+	auto ret = ethtool_plca_get_status_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_plca_get_status_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_plca_get_status_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_STATUS, 1);
+	ethtool_plca_get_status_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_status_rsp>>
+ethtool_plca_get_status_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj)
+{
+	return ethtool_plca_get_status_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_plca_get_status_rsp>
+ethtool_plca_get_status(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_plca_get_status_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_PLCA_GET_STATUS - dump */
-std::unique_ptr<ethtool_plca_get_status_list>
-ethtool_plca_get_status_dump(ynl_cpp::ynl_socket&  ys,
-			     ethtool_plca_get_status_req_dump& req)
+static void
+ethtool_plca_get_status_dump_put(struct nlmsghdr *nlh,
+				 ethtool_plca_get_status_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PLCA_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_plca_get_status_list>>
+ethtool_plca_get_status_dump_exec(ynl_cpp::ynl_socket&  ys,
+				  struct nlmsghdr *nlh,
+				  const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_plca_get_status_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_plca_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_plca_get_status_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_plca_get_status_rsp_parse;
 	yds.rsp_cmd = 40;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_STATUS, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_plca_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PLCA_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_status_list>>
+ethtool_plca_get_status_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ethtool_plca_get_status_req_dump& req,
+				const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_STATUS, 1);
+	ethtool_plca_get_status_dump_put(nlh, req);
+
+	return ethtool_plca_get_status_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_plca_get_status_list>
+ethtool_plca_get_status_dump(ynl_cpp::ynl_socket&  ys,
+			     ethtool_plca_get_status_req_dump& req)
+{
+	auto ret = ethtool_plca_get_status_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_plca_get_status_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				     ethtool_plca_get_status_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PLCA_GET_STATUS, 1);
+	ethtool_plca_get_status_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_status_list>>
+ethtool_plca_get_status_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl,
+				const ynl_cpp::projection *proj)
+{
+	return ethtool_plca_get_status_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_plca_get_status_list>
+ethtool_plca_get_status_dump(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_plca_get_status_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== ETHTOOL_MSG_MM_GET ============== */
 /* ETHTOOL_MSG_MM_GET - do */
 int ethtool_mm_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -5572,52 +9449,55 @@ int ethtool_mm_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_MM_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_MM_PMAC_ENABLED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->pmac_enabled = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_MM_TX_ENABLED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->tx_enabled = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_MM_TX_ACTIVE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->tx_active = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_MM_TX_MIN_FRAG_SIZE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->tx_min_frag_size = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_MM_RX_MIN_FRAG_SIZE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rx_min_frag_size = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_MM_VERIFY_ENABLED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->verify_enabled = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_MM_VERIFY_TIME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->verify_time = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_MM_MAX_VERIFY_TIME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->max_verify_time = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_MM_STATS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_mm_stat_nest;
-			parg.data = &dst->stats;
+			parg.data = &dst->stats.emplace();
 			if (ethtool_mm_stat_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -5626,118 +9506,353 @@ int ethtool_mm_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_mm_get_rsp>
-ethtool_mm_get(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req& req)
+static void ethtool_mm_get_put(struct nlmsghdr *nlh, ethtool_mm_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_MM_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_mm_get_rsp>>
+ethtool_mm_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		    const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_mm_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MM_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_mm_nest;
 	yrs.yarg.rsp_policy = &ethtool_mm_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_MM_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_mm_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_mm_get_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_MM_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_mm_get_rsp>>
+ethtool_mm_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req& req,
+		  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MM_GET, 1);
+	ethtool_mm_get_put(nlh, req);
+
+	return ethtool_mm_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_mm_get_rsp>
+ethtool_mm_get(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req& req)
+{
+	auto ret = ethtool_mm_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_mm_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MM_GET, 1);
+	ethtool_mm_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_mm_get_rsp>>
+ethtool_mm_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj)
+{
+	return ethtool_mm_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_mm_get_rsp>
+ethtool_mm_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_mm_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_MM_GET - dump */
-std::unique_ptr<ethtool_mm_get_list>
-ethtool_mm_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req_dump& req)
+static void
+ethtool_mm_get_dump_put(struct nlmsghdr *nlh, ethtool_mm_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_MM_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_mm_get_list>>
+ethtool_mm_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			 const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_mm_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_mm_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_mm_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_mm_get_rsp_parse;
 	yds.rsp_cmd = ETHTOOL_MSG_MM_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MM_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_mm_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_MM_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_mm_get_list>>
+ethtool_mm_get_dump_ex(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req_dump& req,
+		       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MM_GET, 1);
+	ethtool_mm_get_dump_put(nlh, req);
+
+	return ethtool_mm_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_mm_get_list>
+ethtool_mm_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req_dump& req)
+{
+	auto ret = ethtool_mm_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_mm_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			    ethtool_mm_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MM_GET, 1);
+	ethtool_mm_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_mm_get_list>>
+ethtool_mm_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj)
+{
+	return ethtool_mm_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_mm_get_list>
+ethtool_mm_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_mm_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_MM_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_mm_get_ntf>());
+
+static void *ethtool_mm_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_mm_get_ntf())->obj;
+}
+
+static void ethtool_mm_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_mm_get_ntf *rsp = (ethtool_mm_get_ntf *)ntf;
+
+	rsp->~ethtool_mm_get_ntf();
+	::free(rsp);
+}
+
 /* ============== ETHTOOL_MSG_MM_SET ============== */
 /* ETHTOOL_MSG_MM_SET - do */
-int ethtool_mm_set(ynl_cpp::ynl_socket&  ys, ethtool_mm_set_req& req)
+static void ethtool_mm_set_put(struct nlmsghdr *nlh, ethtool_mm_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MM_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_mm_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 40 <= YNL_SOCKET_BUFFER_SIZE);
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_MM_HEADER, req.header.value());
 	if (req.verify_enabled.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_MM_VERIFY_ENABLED, req.verify_enabled.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_MM_VERIFY_ENABLED, req.verify_enabled.value());
 	if (req.verify_time.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_MM_VERIFY_TIME, req.verify_time.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_MM_VERIFY_TIME, req.verify_time.value());
 	if (req.tx_enabled.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_MM_TX_ENABLED, req.tx_enabled.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_MM_TX_ENABLED, req.tx_enabled.value());
 	if (req.pmac_enabled.has_value())
-		ynl_attr_put_u8(nlh, ETHTOOL_A_MM_PMAC_ENABLED, req.pmac_enabled.value());
+		ynl_attr_put_u8_unchecked(nlh, ETHTOOL_A_MM_PMAC_ENABLED, req.pmac_enabled.value());
 	if (req.tx_min_frag_size.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_MM_TX_MIN_FRAG_SIZE, req.tx_min_frag_size.value());
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_MM_TX_MIN_FRAG_SIZE, req.tx_min_frag_size.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_MM_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_mm_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_mm_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_mm_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_mm_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MM_SET, 1);
+	ethtool_mm_set_put(nlh, req);
+
+	return ethtool_mm_set_exec(ys, nlh);
+}
+
+int ethtool_mm_set(ynl_cpp::ynl_socket&  ys, ethtool_mm_set_req& req)
+{
+	auto ret = ethtool_mm_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_mm_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_mm_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MM_SET, 1);
+	ethtool_mm_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_mm_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ethtool_mm_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_mm_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_mm_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_mm_set_batch(ynl_cpp::msg_batch& batch, ethtool_mm_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_MM_SET, 1);
+	ethtool_mm_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_mm_nest);
 }
 
 /* ============== ETHTOOL_MSG_MODULE_FW_FLASH_ACT ============== */
 /* ETHTOOL_MSG_MODULE_FW_FLASH_ACT - do */
-int ethtool_module_fw_flash_act(ynl_cpp::ynl_socket&  ys,
+static void
+ethtool_module_fw_flash_act_put(struct nlmsghdr *nlh,
 				ethtool_module_fw_flash_act_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_FW_FLASH_ACT, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_module_fw_flash_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.password.has_value())
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_MODULE_FW_FLASH_PASSWORD, req.password.value());
 	if (req.header.has_value())
 		ethtool_header_put(nlh, ETHTOOL_A_MODULE_FW_FLASH_HEADER, req.header.value());
 	if (req.file_name.size() > 0)
 		ynl_attr_put_str(nlh, ETHTOOL_A_MODULE_FW_FLASH_FILE_NAME, req.file_name.data());
-	if (req.password.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_MODULE_FW_FLASH_PASSWORD, req.password.value());
+}
+
+static ynl_cpp::result<void>
+ethtool_module_fw_flash_act_exec(ynl_cpp::ynl_socket&  ys,
+				 struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_module_fw_flash_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_module_fw_flash_act_ex(ynl_cpp::ynl_socket&  ys,
+			       ethtool_module_fw_flash_act_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_FW_FLASH_ACT, 1);
+	ethtool_module_fw_flash_act_put(nlh, req);
+
+	return ethtool_module_fw_flash_act_exec(ys, nlh);
+}
+
+int ethtool_module_fw_flash_act(ynl_cpp::ynl_socket&  ys,
+				ethtool_module_fw_flash_act_req& req)
+{
+	auto ret = ethtool_module_fw_flash_act_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_fw_flash_act_prepare(ynl_cpp::ynl_socket&  ys,
+				    ethtool_module_fw_flash_act_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_MODULE_FW_FLASH_ACT, 1);
+	ethtool_module_fw_flash_act_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_module_fw_flash_act_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl)
+{
+	return ethtool_module_fw_flash_act_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_module_fw_flash_act(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_module_fw_flash_act_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_module_fw_flash_act_batch(ynl_cpp::msg_batch& batch,
+				  ethtool_module_fw_flash_act_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_MODULE_FW_FLASH_ACT, 1);
+	ethtool_module_fw_flash_act_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_module_fw_flash_nest);
 }
 
 /* ============== ETHTOOL_MSG_PHY_GET ============== */
@@ -5755,105 +9870,228 @@ int ethtool_phy_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_PHY_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_PHY_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PHY_DRVNAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->drvname.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->drvname.assign(ynl_attr_get_str(attr));
 		} else if (type == ETHTOOL_A_PHY_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
 		} else if (type == ETHTOOL_A_PHY_UPSTREAM_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->upstream_type = (int)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PHY_UPSTREAM_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->upstream_index = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_PHY_UPSTREAM_SFP_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->upstream_sfp_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->upstream_sfp_name.assign(ynl_attr_get_str(attr));
 		} else if (type == ETHTOOL_A_PHY_DOWNSTREAM_SFP_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->downstream_sfp_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->downstream_sfp_name.assign(ynl_attr_get_str(attr));
 		}
 	}
 
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_phy_get_rsp>
-ethtool_phy_get(ynl_cpp::ynl_socket&  ys, ethtool_phy_get_req& req)
+static void ethtool_phy_get_put(struct nlmsghdr *nlh, ethtool_phy_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PHY_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_phy_get_rsp>>
+ethtool_phy_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_phy_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PHY_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_phy_nest;
 	yrs.yarg.rsp_policy = &ethtool_phy_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PHY_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_phy_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_phy_get_rsp_parse;
 	yrs.rsp_cmd = ETHTOOL_MSG_PHY_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_phy_get_rsp>>
+ethtool_phy_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_phy_get_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PHY_GET, 1);
+	ethtool_phy_get_put(nlh, req);
+
+	return ethtool_phy_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_phy_get_rsp>
+ethtool_phy_get(ynl_cpp::ynl_socket&  ys, ethtool_phy_get_req& req)
+{
+	auto ret = ethtool_phy_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_phy_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_phy_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PHY_GET, 1);
+	ethtool_phy_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_phy_get_rsp>>
+ethtool_phy_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return ethtool_phy_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_phy_get_rsp>
+ethtool_phy_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_phy_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_PHY_GET - dump */
-std::unique_ptr<ethtool_phy_get_list>
-ethtool_phy_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_phy_get_req_dump& req)
+static void
+ethtool_phy_get_dump_put(struct nlmsghdr *nlh, ethtool_phy_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_PHY_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_phy_get_list>>
+ethtool_phy_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_phy_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_phy_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_phy_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_phy_get_rsp_parse;
 	yds.rsp_cmd = ETHTOOL_MSG_PHY_GET;
+	((struct ynl_sock*)ys)->req_policy = &ethtool_phy_nest;
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_phy_get_list>>
+ethtool_phy_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_phy_get_req_dump& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PHY_GET, 1);
+	ethtool_phy_get_dump_put(nlh, req);
+
+	return ethtool_phy_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_phy_get_list>
+ethtool_phy_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_phy_get_req_dump& req)
+{
+	auto ret = ethtool_phy_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_phy_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_phy_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
 
 	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_PHY_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_phy_nest;
+	ethtool_phy_get_dump_put(nlh, req);
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_PHY_HEADER, req.header.value());
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
 
-	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
-	if (err < 0)
-		return nullptr;
+ynl_cpp::result<std::unique_ptr<ethtool_phy_get_list>>
+ethtool_phy_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_phy_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
 
-	return ret;
+std::unique_ptr<ethtool_phy_get_list>
+ethtool_phy_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_phy_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
 }
 
 /* ETHTOOL_MSG_PHY_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_phy_get_ntf>());
+
+static void *ethtool_phy_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_phy_get_ntf())->obj;
+}
+
+static void ethtool_phy_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_phy_get_ntf *rsp = (ethtool_phy_get_ntf *)ntf;
+
+	rsp->~ethtool_phy_get_ntf();
+	::free(rsp);
+}
+
 /* ============== ETHTOOL_MSG_TSCONFIG_GET ============== */
 /* ETHTOOL_MSG_TSCONFIG_GET - do */
 int ethtool_tsconfig_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -5869,41 +10107,44 @@ int ethtool_tsconfig_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_TSCONFIG_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSCONFIG_HWTSTAMP_PROVIDER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_ts_hwtstamp_provider_nest;
-			parg.data = &dst->hwtstamp_provider;
+			parg.data = &dst->hwtstamp_provider.emplace();
 			if (ethtool_ts_hwtstamp_provider_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSCONFIG_TX_TYPES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->tx_types;
+			parg.data = &dst->tx_types.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSCONFIG_RX_FILTERS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->rx_filters;
+			parg.data = &dst->rx_filters.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSCONFIG_HWTSTAMP_FLAGS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->hwtstamp_flags = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -5911,63 +10152,174 @@ int ethtool_tsconfig_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_tsconfig_get_rsp>
-ethtool_tsconfig_get(ynl_cpp::ynl_socket&  ys, ethtool_tsconfig_get_req& req)
+static void
+ethtool_tsconfig_get_put(struct nlmsghdr *nlh, ethtool_tsconfig_get_req& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_TSCONFIG_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_get_rsp>>
+ethtool_tsconfig_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<ethtool_tsconfig_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSCONFIG_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_tsconfig_nest;
 	yrs.yarg.rsp_policy = &ethtool_tsconfig_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_TSCONFIG_HEADER, req.header.value());
-
 	rsp.reset(new ethtool_tsconfig_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_tsconfig_get_rsp_parse;
 	yrs.rsp_cmd = 47;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_get_rsp>>
+ethtool_tsconfig_get_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_tsconfig_get_req& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSCONFIG_GET, 1);
+	ethtool_tsconfig_get_put(nlh, req);
+
+	return ethtool_tsconfig_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_tsconfig_get_rsp>
+ethtool_tsconfig_get(ynl_cpp::ynl_socket&  ys, ethtool_tsconfig_get_req& req)
+{
+	auto ret = ethtool_tsconfig_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tsconfig_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_tsconfig_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSCONFIG_GET, 1);
+	ethtool_tsconfig_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_get_rsp>>
+ethtool_tsconfig_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_tsconfig_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_tsconfig_get_rsp>
+ethtool_tsconfig_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_tsconfig_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ETHTOOL_MSG_TSCONFIG_GET - dump */
-std::unique_ptr<ethtool_tsconfig_get_list>
-ethtool_tsconfig_get_dump(ynl_cpp::ynl_socket&  ys,
-			  ethtool_tsconfig_get_req_dump& req)
+static void
+ethtool_tsconfig_get_dump_put(struct nlmsghdr *nlh,
+			      ethtool_tsconfig_get_req_dump& req)
+{
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_TSCONFIG_HEADER, req.header.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_get_list>>
+ethtool_tsconfig_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<ethtool_tsconfig_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ethtool_tsconfig_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ethtool_tsconfig_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ethtool_tsconfig_get_rsp_parse;
 	yds.rsp_cmd = 47;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSCONFIG_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &ethtool_tsconfig_nest;
 
-	if (req.header.has_value())
-		ethtool_header_put(nlh, ETHTOOL_A_TSCONFIG_HEADER, req.header.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_get_list>>
+ethtool_tsconfig_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_tsconfig_get_req_dump& req,
+			     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSCONFIG_GET, 1);
+	ethtool_tsconfig_get_dump_put(nlh, req);
+
+	return ethtool_tsconfig_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_tsconfig_get_list>
+ethtool_tsconfig_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ethtool_tsconfig_get_req_dump& req)
+{
+	auto ret = ethtool_tsconfig_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tsconfig_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_tsconfig_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSCONFIG_GET, 1);
+	ethtool_tsconfig_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_get_list>>
+ethtool_tsconfig_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return ethtool_tsconfig_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_tsconfig_get_list>
+ethtool_tsconfig_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_tsconfig_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== ETHTOOL_MSG_TSCONFIG_SET ============== */
 /* ETHTOOL_MSG_TSCONFIG_SET - do */
 int ethtool_tsconfig_set_rsp_parse(const struct nlmsghdr *nlh,
@@ -5983,41 +10335,44 @@ int ethtool_tsconfig_set_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_TSCONFIG_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSCONFIG_HWTSTAMP_PROVIDER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_ts_hwtstamp_provider_nest;
-			parg.data = &dst->hwtstamp_provider;
+			parg.data = &dst->hwtstamp_provider.emplace();
 			if (ethtool_ts_hwtstamp_provider_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSCONFIG_TX_TYPES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->tx_types;
+			parg.data = &dst->tx_types.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSCONFIG_RX_FILTERS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_bitset_nest;
-			parg.data = &dst->rx_filters;
+			parg.data = &dst->rx_filters.emplace();
 			if (ethtool_bitset_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_TSCONFIG_HWTSTAMP_FLAGS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->hwtstamp_flags = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -6025,18 +10380,13 @@ int ethtool_tsconfig_set_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ethtool_tsconfig_set_rsp>
-ethtool_tsconfig_set(ynl_cpp::ynl_socket&  ys, ethtool_tsconfig_set_req& req)
+static void
+ethtool_tsconfig_set_put(struct nlmsghdr *nlh, ethtool_tsconfig_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<ethtool_tsconfig_set_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSCONFIG_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ethtool_tsconfig_nest;
-	yrs.yarg.rsp_policy = &ethtool_tsconfig_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.hwtstamp_flags.has_value())
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_TSCONFIG_HWTSTAMP_FLAGS, req.hwtstamp_flags.value());
 	if (req.header.has_value())
 		ethtool_header_put(nlh, ETHTOOL_A_TSCONFIG_HEADER, req.header.value());
 	if (req.hwtstamp_provider.has_value())
@@ -6045,21 +10395,168 @@ ethtool_tsconfig_set(ynl_cpp::ynl_socket&  ys, ethtool_tsconfig_set_req& req)
 		ethtool_bitset_put(nlh, ETHTOOL_A_TSCONFIG_TX_TYPES, req.tx_types.value());
 	if (req.rx_filters.has_value())
 		ethtool_bitset_put(nlh, ETHTOOL_A_TSCONFIG_RX_FILTERS, req.rx_filters.value());
-	if (req.hwtstamp_flags.has_value())
-		ynl_attr_put_u32(nlh, ETHTOOL_A_TSCONFIG_HWTSTAMP_FLAGS, req.hwtstamp_flags.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_set_rsp>>
+ethtool_tsconfig_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<ethtool_tsconfig_set_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_tsconfig_nest;
+	yrs.yarg.rsp_policy = &ethtool_tsconfig_nest;
 
 	rsp.reset(new ethtool_tsconfig_set_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ethtool_tsconfig_set_rsp_parse;
 	yrs.rsp_cmd = 48;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_set_rsp>>
+ethtool_tsconfig_set_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_tsconfig_set_req& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSCONFIG_SET, 1);
+	ethtool_tsconfig_set_put(nlh, req);
+
+	return ethtool_tsconfig_set_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ethtool_tsconfig_set_rsp>
+ethtool_tsconfig_set(ynl_cpp::ynl_socket&  ys, ethtool_tsconfig_set_req& req)
+{
+	auto ret = ethtool_tsconfig_set_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tsconfig_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_tsconfig_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_TSCONFIG_SET, 1);
+	ethtool_tsconfig_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_set_rsp>>
+ethtool_tsconfig_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return ethtool_tsconfig_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ethtool_tsconfig_set_rsp>
+ethtool_tsconfig_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_tsconfig_set_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== ETHTOOL_MSG_RSS_SET ============== */
+/* ETHTOOL_MSG_RSS_SET - do */
+static void ethtool_rss_set_put(struct nlmsghdr *nlh, ethtool_rss_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.context.has_value())
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RSS_CONTEXT, req.context.value());
+	if (req.hfunc.has_value())
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RSS_HFUNC, req.hfunc.value());
+	if (req.input_xfrm.has_value())
+		ynl_attr_put_u32_unchecked(nlh, ETHTOOL_A_RSS_INPUT_XFRM, req.input_xfrm.value());
+	if (req.header.has_value())
+		ethtool_header_put(nlh, ETHTOOL_A_RSS_HEADER, req.header.value());
+	if (req.indir.size() > 0)
+		ynl_attr_put(nlh, ETHTOOL_A_RSS_INDIR, req.indir.data(), req.indir.size());
+	if (req.hkey.size() > 0)
+		ynl_attr_put(nlh, ETHTOOL_A_RSS_HKEY, req.hkey.data(), req.hkey.size());
+}
+
+static ynl_cpp::result<void>
+ethtool_rss_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ethtool_rss_nest;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+ethtool_rss_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_rss_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RSS_SET, 1);
+	ethtool_rss_set_put(nlh, req);
+
+	return ethtool_rss_set_exec(ys, nlh);
+}
+
+int ethtool_rss_set(ynl_cpp::ynl_socket&  ys, ethtool_rss_set_req& req)
+{
+	auto ret = ethtool_rss_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rss_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_rss_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, ETHTOOL_MSG_RSS_SET, 1);
+	ethtool_rss_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ethtool_rss_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ethtool_rss_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ethtool_rss_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ethtool_rss_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ethtool_rss_set_batch(ynl_cpp::msg_batch& batch, ethtool_rss_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(ETHTOOL_MSG_RSS_SET, 1);
+	ethtool_rss_set_put(nlh, req);
+	return batch.msg_end(nlh, &ethtool_rss_nest);
+}
+
 /* ETHTOOL_MSG_CABLE_TEST_NTF - event */
 int ethtool_cable_test_ntf_rsp_parse(const struct nlmsghdr *nlh,
 				     struct ynl_parse_arg *yarg)
@@ -6074,17 +10571,20 @@ int ethtool_cable_test_ntf_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_CABLE_TEST_NTF_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_CABLE_TEST_NTF_STATUS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->status = (__u8)ynl_attr_get_u8(attr);
 		}
 	}
@@ -6092,6 +10592,21 @@ int ethtool_cable_test_ntf_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_cable_test_ntf>());
+
+static void *ethtool_cable_test_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_cable_test_ntf())->obj;
+}
+
+static void ethtool_cable_test_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_cable_test_ntf *rsp = (ethtool_cable_test_ntf *)ntf;
+
+	rsp->~ethtool_cable_test_ntf();
+	::free(rsp);
+}
+
 /* ETHTOOL_MSG_CABLE_TEST_TDR_NTF - event */
 int ethtool_cable_test_tdr_ntf_rsp_parse(const struct nlmsghdr *nlh,
 					 struct ynl_parse_arg *yarg)
@@ -6106,24 +10621,27 @@ int ethtool_cable_test_tdr_ntf_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_CABLE_TEST_TDR_NTF_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_CABLE_TEST_TDR_NTF_STATUS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->status = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == ETHTOOL_A_CABLE_TEST_TDR_NTF_NEST) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_cable_nest_nest;
-			parg.data = &dst->nest;
+			parg.data = &dst->nest.emplace();
 			if (ethtool_cable_nest_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -6132,6 +10650,21 @@ int ethtool_cable_test_tdr_ntf_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_cable_test_tdr_ntf>());
+
+static void *ethtool_cable_test_tdr_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_cable_test_tdr_ntf())->obj;
+}
+
+static void ethtool_cable_test_tdr_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_cable_test_tdr_ntf *rsp = (ethtool_cable_test_tdr_ntf *)ntf;
+
+	rsp->~ethtool_cable_test_tdr_ntf();
+	::free(rsp);
+}
+
 /* ETHTOOL_MSG_MODULE_FW_FLASH_NTF - event */
 int ethtool_module_fw_flash_ntf_rsp_parse(const struct nlmsghdr *nlh,
 					  struct ynl_parse_arg *yarg)
@@ -6146,29 +10679,32 @@ int ethtool_module_fw_flash_ntf_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == ETHTOOL_A_MODULE_FW_FLASH_HEADER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &ethtool_header_nest;
-			parg.data = &dst->header;
+			parg.data = &dst->header.emplace();
 			if (ethtool_header_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == ETHTOOL_A_MODULE_FW_FLASH_STATUS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->status = (ethtool_module_fw_flash_status)ynl_attr_get_u32(attr);
 		} else if (type == ETHTOOL_A_MODULE_FW_FLASH_STATUS_MSG) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->status_msg.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->status_msg.assign(ynl_attr_get_str(attr));
 		} else if (type == ETHTOOL_A_MODULE_FW_FLASH_DONE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->done = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == ETHTOOL_A_MODULE_FW_FLASH_TOTAL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->total = (__u64)ynl_attr_get_uint(attr);
 		}
 	}
@@ -6176,83 +10712,155 @@ int ethtool_module_fw_flash_ntf_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
+static_assert(ynl_cpp::ntf_layout_matches<ethtool_module_fw_flash_ntf>());
+
+static void *ethtool_module_fw_flash_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) ethtool_module_fw_flash_ntf())->obj;
+}
+
+static void ethtool_module_fw_flash_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	ethtool_module_fw_flash_ntf *rsp = (ethtool_module_fw_flash_ntf *)ntf;
+
+	rsp->~ethtool_module_fw_flash_ntf();
+	::free(rsp);
+}
+
 static constexpr std::array<ynl_ntf_info, ETHTOOL_MSG_PHY_NTF + 1> ethtool_ntf_info = []() {
 	std::array<ynl_ntf_info, ETHTOOL_MSG_PHY_NTF + 1> arr{};
 	arr[ETHTOOL_MSG_LINKINFO_NTF] =  {
 		.cb		= ethtool_linkinfo_get_rsp_parse,
 		.policy		= &ethtool_linkinfo_nest,
+		.alloc_sz	= sizeof(ethtool_linkinfo_get_ntf),
+		.free		= ethtool_linkinfo_get_ntf_free,
+		.init		= ethtool_linkinfo_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_LINKMODES_NTF] =  {
 		.cb		= ethtool_linkmodes_get_rsp_parse,
 		.policy		= &ethtool_linkmodes_nest,
+		.alloc_sz	= sizeof(ethtool_linkmodes_get_ntf),
+		.free		= ethtool_linkmodes_get_ntf_free,
+		.init		= ethtool_linkmodes_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_DEBUG_NTF] =  {
 		.cb		= ethtool_debug_get_rsp_parse,
 		.policy		= &ethtool_debug_nest,
+		.alloc_sz	= sizeof(ethtool_debug_get_ntf),
+		.free		= ethtool_debug_get_ntf_free,
+		.init		= ethtool_debug_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_WOL_NTF] =  {
 		.cb		= ethtool_wol_get_rsp_parse,
 		.policy		= &ethtool_wol_nest,
+		.alloc_sz	= sizeof(ethtool_wol_get_ntf),
+		.free		= ethtool_wol_get_ntf_free,
+		.init		= ethtool_wol_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_FEATURES_NTF] =  {
 		.cb		= ethtool_features_get_rsp_parse,
 		.policy		= &ethtool_features_nest,
+		.alloc_sz	= sizeof(ethtool_features_get_ntf),
+		.free		= ethtool_features_get_ntf_free,
+		.init		= ethtool_features_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_PRIVFLAGS_NTF] =  {
 		.cb		= ethtool_privflags_get_rsp_parse,
 		.policy		= &ethtool_privflags_nest,
+		.alloc_sz	= sizeof(ethtool_privflags_get_ntf),
+		.free		= ethtool_privflags_get_ntf_free,
+		.init		= ethtool_privflags_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_RINGS_NTF] =  {
 		.cb		= ethtool_rings_get_rsp_parse,
 		.policy		= &ethtool_rings_nest,
+		.alloc_sz	= sizeof(ethtool_rings_get_ntf),
+		.free		= ethtool_rings_get_ntf_free,
+		.init		= ethtool_rings_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_CHANNELS_NTF] =  {
 		.cb		= ethtool_channels_get_rsp_parse,
 		.policy		= &ethtool_channels_nest,
+		.alloc_sz	= sizeof(ethtool_channels_get_ntf),
+		.free		= ethtool_channels_get_ntf_free,
+		.init		= ethtool_channels_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_COALESCE_NTF] =  {
 		.cb		= ethtool_coalesce_get_rsp_parse,
 		.policy		= &ethtool_coalesce_nest,
+		.alloc_sz	= sizeof(ethtool_coalesce_get_ntf),
+		.free		= ethtool_coalesce_get_ntf_free,
+		.init		= ethtool_coalesce_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_PAUSE_NTF] =  {
 		.cb		= ethtool_pause_get_rsp_parse,
 		.policy		= &ethtool_pause_nest,
+		.alloc_sz	= sizeof(ethtool_pause_get_ntf),
+		.free		= ethtool_pause_get_ntf_free,
+		.init		= ethtool_pause_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_EEE_NTF] =  {
 		.cb		= ethtool_eee_get_rsp_parse,
 		.policy		= &ethtool_eee_nest,
+		.alloc_sz	= sizeof(ethtool_eee_get_ntf),
+		.free		= ethtool_eee_get_ntf_free,
+		.init		= ethtool_eee_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_CABLE_TEST_NTF] =  {
 		.cb		= ethtool_cable_test_ntf_rsp_parse,
 		.policy		= &ethtool_cable_test_ntf_nest,
+		.alloc_sz	= sizeof(ethtool_cable_test_ntf),
+		.free		= ethtool_cable_test_ntf_free,
+		.init		= ethtool_cable_test_ntf_init,
 	};
 	arr[ETHTOOL_MSG_CABLE_TEST_TDR_NTF] =  {
 		.cb		= ethtool_cable_test_tdr_ntf_rsp_parse,
 		.policy		= &ethtool_cable_test_tdr_ntf_nest,
+		.alloc_sz	= sizeof(ethtool_cable_test_tdr_ntf),
+		.free		= ethtool_cable_test_tdr_ntf_free,
+		.init		= ethtool_cable_test_tdr_ntf_init,
 	};
 	arr[ETHTOOL_MSG_FEC_NTF] =  {
 		.cb		= ethtool_fec_get_rsp_parse,
 		.policy		= &ethtool_fec_nest,
+		.alloc_sz	= sizeof(ethtool_fec_get_ntf),
+		.free		= ethtool_fec_get_ntf_free,
+		.init		= ethtool_fec_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_MODULE_NTF] =  {
 		.cb		= ethtool_module_get_rsp_parse,
 		.policy		= &ethtool_module_nest,
+		.alloc_sz	= sizeof(ethtool_module_get_ntf),
+		.free		= ethtool_module_get_ntf_free,
+		.init		= ethtool_module_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_PLCA_NTF] =  {
 		.cb		= ethtool_plca_get_cfg_rsp_parse,
 		.policy		= &ethtool_plca_nest,
+		.alloc_sz	= sizeof(ethtool_plca_get_cfg_ntf),
+		.free		= ethtool_plca_get_cfg_ntf_free,
+		.init		= ethtool_plca_get_cfg_ntf_init,
 	};
 	arr[ETHTOOL_MSG_MM_NTF] =  {
 		.cb		= ethtool_mm_get_rsp_parse,
 		.policy		= &ethtool_mm_nest,
+		.alloc_sz	= sizeof(ethtool_mm_get_ntf),
+		.free		= ethtool_mm_get_ntf_free,
+		.init		= ethtool_mm_get_ntf_init,
 	};
 	arr[ETHTOOL_MSG_MODULE_FW_FLASH_NTF] =  {
 		.cb		= ethtool_module_fw_flash_ntf_rsp_parse,
 		.policy		= &ethtool_module_fw_flash_nest,
+		.alloc_sz	= sizeof(ethtool_module_fw_flash_ntf),
+		.free		= ethtool_module_fw_flash_ntf_free,
+		.init		= ethtool_module_fw_flash_ntf_init,
 	};
 	arr[ETHTOOL_MSG_PHY_NTF] =  {
 		.cb		= ethtool_phy_get_rsp_parse,
 		.policy		= &ethtool_phy_nest,
+		.alloc_sz	= sizeof(ethtool_phy_get_ntf),
+		.free		= ethtool_phy_get_ntf_free,
+		.init		= ethtool_phy_get_ntf_init,
 	};
 	return arr;
 } ();
@@ -187,6 +187,91 @@ struct ethtool_tunnel_udp {
 	std::optional<ethtool_tunnel_udp_table> table;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest ethtool_header_nest;
+extern struct ynl_policy_nest ethtool_pause_stat_nest;
+extern struct ynl_policy_nest ethtool_ts_stat_nest;
+extern struct ynl_policy_nest ethtool_ts_hwtstamp_provider_nest;
+extern struct ynl_policy_nest ethtool_cable_test_tdr_cfg_nest;
+extern struct ynl_policy_nest ethtool_fec_stat_nest;
+extern struct ynl_policy_nest ethtool_c33_pse_pw_limit_nest;
+extern struct ynl_policy_nest ethtool_mm_stat_nest;
+extern struct ynl_policy_nest ethtool_irq_moderation_nest;
+extern struct ynl_policy_nest ethtool_cable_result_nest;
+extern struct ynl_policy_nest ethtool_cable_fault_length_nest;
+extern struct ynl_policy_nest ethtool_stats_grp_hist_nest;
+extern struct ynl_policy_nest ethtool_bitset_bit_nest;
+extern struct ynl_policy_nest ethtool_tunnel_udp_entry_nest;
+extern struct ynl_policy_nest ethtool_string_nest;
+extern struct ynl_policy_nest ethtool_profile_nest;
+extern struct ynl_policy_nest ethtool_cable_nest_nest;
+extern struct ynl_policy_nest ethtool_stats_grp_nest;
+extern struct ynl_policy_nest ethtool_bitset_bits_nest;
+extern struct ynl_policy_nest ethtool_strings_nest;
+extern struct ynl_policy_nest ethtool_bitset_nest;
+extern struct ynl_policy_nest ethtool_stringset_nest;
+extern struct ynl_policy_nest ethtool_tunnel_udp_table_nest;
+extern struct ynl_policy_nest ethtool_stringsets_nest;
+extern struct ynl_policy_nest ethtool_tunnel_udp_nest;
+extern struct ynl_policy_nest ethtool_strset_nest;
+extern struct ynl_policy_nest ethtool_linkinfo_nest;
+extern struct ynl_policy_nest ethtool_linkmodes_nest;
+extern struct ynl_policy_nest ethtool_linkstate_nest;
+extern struct ynl_policy_nest ethtool_debug_nest;
+extern struct ynl_policy_nest ethtool_wol_nest;
+extern struct ynl_policy_nest ethtool_features_nest;
+extern struct ynl_policy_nest ethtool_privflags_nest;
+extern struct ynl_policy_nest ethtool_rings_nest;
+extern struct ynl_policy_nest ethtool_channels_nest;
+extern struct ynl_policy_nest ethtool_coalesce_nest;
+extern struct ynl_policy_nest ethtool_pause_nest;
+extern struct ynl_policy_nest ethtool_eee_nest;
+extern struct ynl_policy_nest ethtool_tsinfo_nest;
+extern struct ynl_policy_nest ethtool_cable_test_nest;
+extern struct ynl_policy_nest ethtool_cable_test_ntf_nest;
+extern struct ynl_policy_nest ethtool_cable_test_tdr_nest;
+extern struct ynl_policy_nest ethtool_cable_test_tdr_ntf_nest;
+extern struct ynl_policy_nest ethtool_tunnel_info_nest;
+extern struct ynl_policy_nest ethtool_fec_nest;
+extern struct ynl_policy_nest ethtool_module_eeprom_nest;
+extern struct ynl_policy_nest ethtool_stats_nest;
+extern struct ynl_policy_nest ethtool_phc_vclocks_nest;
+extern struct ynl_policy_nest ethtool_module_nest;
+extern struct ynl_policy_nest ethtool_pse_nest;
+extern struct ynl_policy_nest ethtool_rss_nest;
+extern struct ynl_policy_nest ethtool_plca_nest;
+extern struct ynl_policy_nest ethtool_mm_nest;
+extern struct ynl_policy_nest ethtool_module_fw_flash_nest;
+extern struct ynl_policy_nest ethtool_phy_nest;
+extern struct ynl_policy_nest ethtool_tsconfig_nest;
+int ethtool_header_put(struct nlmsghdr *nlh, unsigned int attr_type,
+		       const ethtool_header&  obj);
+int ethtool_pause_stat_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			   const ethtool_pause_stat&  obj);
+int ethtool_ts_hwtstamp_provider_put(struct nlmsghdr *nlh,
+				     unsigned int attr_type,
+				     const ethtool_ts_hwtstamp_provider&  obj);
+int ethtool_fec_stat_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			 const ethtool_fec_stat&  obj);
+int ethtool_irq_moderation_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const ethtool_irq_moderation&  obj);
+int ethtool_bitset_bit_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			   const ethtool_bitset_bit&  obj);
+int ethtool_string_put(struct nlmsghdr *nlh, unsigned int attr_type,
+		       const ethtool_string&  obj);
+int ethtool_profile_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			const ethtool_profile&  obj);
+int ethtool_bitset_bits_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			    const ethtool_bitset_bits&  obj);
+int ethtool_strings_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			const ethtool_strings&  obj);
+int ethtool_bitset_put(struct nlmsghdr *nlh, unsigned int attr_type,
+		       const ethtool_bitset&  obj);
+int ethtool_stringset_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			  const ethtool_stringset_t&  obj);
+int ethtool_stringsets_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			   const ethtool_stringsets&  obj);
+
 /* ============== ETHTOOL_MSG_STRSET_GET ============== */
 /* ETHTOOL_MSG_STRSET_GET - do */
 struct ethtool_strset_get_req {
@@ -205,6 +290,18 @@ struct ethtool_strset_get_rsp {
  */
 std::unique_ptr<ethtool_strset_get_rsp>
 ethtool_strset_get(ynl_cpp::ynl_socket&  ys, ethtool_strset_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_strset_get_rsp>>
+ethtool_strset_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_strset_get_req& req,
+		      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_strset_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   ethtool_strset_get_req& req);
+std::unique_ptr<ethtool_strset_get_rsp>
+ethtool_strset_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_strset_get_rsp>>
+ethtool_strset_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_STRSET_GET - dump */
 struct ethtool_strset_get_req_dump {
@@ -220,6 +317,20 @@ struct ethtool_strset_get_list {
 std::unique_ptr<ethtool_strset_get_list>
 ethtool_strset_get_dump(ynl_cpp::ynl_socket&  ys,
 			ethtool_strset_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_strset_get_list>>
+ethtool_strset_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_strset_get_req_dump& req,
+			   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_strset_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_strset_get_req_dump& req);
+std::unique_ptr<ethtool_strset_get_list>
+ethtool_strset_get_dump(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_strset_get_list>>
+ethtool_strset_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_LINKINFO_GET ============== */
 /* ETHTOOL_MSG_LINKINFO_GET - do */
@@ -241,6 +352,19 @@ struct ethtool_linkinfo_get_rsp {
  */
 std::unique_ptr<ethtool_linkinfo_get_rsp>
 ethtool_linkinfo_get(ynl_cpp::ynl_socket&  ys, ethtool_linkinfo_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_linkinfo_get_rsp>>
+ethtool_linkinfo_get_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_linkinfo_get_req& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkinfo_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_linkinfo_get_req& req);
+std::unique_ptr<ethtool_linkinfo_get_rsp>
+ethtool_linkinfo_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_linkinfo_get_rsp>>
+ethtool_linkinfo_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_LINKINFO_GET - dump */
 struct ethtool_linkinfo_get_req_dump {
@@ -254,9 +378,29 @@ struct ethtool_linkinfo_get_list {
 std::unique_ptr<ethtool_linkinfo_get_list>
 ethtool_linkinfo_get_dump(ynl_cpp::ynl_socket&  ys,
 			  ethtool_linkinfo_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_linkinfo_get_list>>
+ethtool_linkinfo_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_linkinfo_get_req_dump& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkinfo_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_linkinfo_get_req_dump& req);
+std::unique_ptr<ethtool_linkinfo_get_list>
+ethtool_linkinfo_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_linkinfo_get_list>>
+ethtool_linkinfo_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_LINKINFO_GET - notify */
 struct ethtool_linkinfo_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_linkinfo_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_LINKINFO_SET ============== */
@@ -275,6 +419,20 @@ struct ethtool_linkinfo_set_req {
  */
 int ethtool_linkinfo_set(ynl_cpp::ynl_socket&  ys,
 			 ethtool_linkinfo_set_req& req);
+ynl_cpp::result<void>
+ethtool_linkinfo_set_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_linkinfo_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkinfo_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_linkinfo_set_req& req);
+int ethtool_linkinfo_set(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_linkinfo_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_linkinfo_set_batch(ynl_cpp::msg_batch& batch,
+			   ethtool_linkinfo_set_req& req);
 
 /* ============== ETHTOOL_MSG_LINKMODES_GET ============== */
 /* ETHTOOL_MSG_LINKMODES_GET - do */
@@ -300,6 +458,20 @@ struct ethtool_linkmodes_get_rsp {
  */
 std::unique_ptr<ethtool_linkmodes_get_rsp>
 ethtool_linkmodes_get(ynl_cpp::ynl_socket&  ys, ethtool_linkmodes_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_linkmodes_get_rsp>>
+ethtool_linkmodes_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ethtool_linkmodes_get_req& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkmodes_get_prepare(ynl_cpp::ynl_socket&  ys,
+			      ethtool_linkmodes_get_req& req);
+std::unique_ptr<ethtool_linkmodes_get_rsp>
+ethtool_linkmodes_get(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_linkmodes_get_rsp>>
+ethtool_linkmodes_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_LINKMODES_GET - dump */
 struct ethtool_linkmodes_get_req_dump {
@@ -313,9 +485,29 @@ struct ethtool_linkmodes_get_list {
 std::unique_ptr<ethtool_linkmodes_get_list>
 ethtool_linkmodes_get_dump(ynl_cpp::ynl_socket&  ys,
 			   ethtool_linkmodes_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_linkmodes_get_list>>
+ethtool_linkmodes_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ethtool_linkmodes_get_req_dump& req,
+			      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkmodes_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				   ethtool_linkmodes_get_req_dump& req);
+std::unique_ptr<ethtool_linkmodes_get_list>
+ethtool_linkmodes_get_dump(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_linkmodes_get_list>>
+ethtool_linkmodes_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl,
+			      const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_LINKMODES_GET - notify */
 struct ethtool_linkmodes_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_linkmodes_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_LINKMODES_SET ============== */
@@ -338,6 +530,20 @@ struct ethtool_linkmodes_set_req {
  */
 int ethtool_linkmodes_set(ynl_cpp::ynl_socket&  ys,
 			  ethtool_linkmodes_set_req& req);
+ynl_cpp::result<void>
+ethtool_linkmodes_set_ex(ynl_cpp::ynl_socket&  ys,
+			 ethtool_linkmodes_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkmodes_set_prepare(ynl_cpp::ynl_socket&  ys,
+			      ethtool_linkmodes_set_req& req);
+int ethtool_linkmodes_set(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_linkmodes_set_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_linkmodes_set_batch(ynl_cpp::msg_batch& batch,
+			    ethtool_linkmodes_set_req& req);
 
 /* ============== ETHTOOL_MSG_LINKSTATE_GET ============== */
 /* ETHTOOL_MSG_LINKSTATE_GET - do */
@@ -360,6 +566,20 @@ struct ethtool_linkstate_get_rsp {
  */
 std::unique_ptr<ethtool_linkstate_get_rsp>
 ethtool_linkstate_get(ynl_cpp::ynl_socket&  ys, ethtool_linkstate_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_linkstate_get_rsp>>
+ethtool_linkstate_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ethtool_linkstate_get_req& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkstate_get_prepare(ynl_cpp::ynl_socket&  ys,
+			      ethtool_linkstate_get_req& req);
+std::unique_ptr<ethtool_linkstate_get_rsp>
+ethtool_linkstate_get(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_linkstate_get_rsp>>
+ethtool_linkstate_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_LINKSTATE_GET - dump */
 struct ethtool_linkstate_get_req_dump {
@@ -373,6 +593,20 @@ struct ethtool_linkstate_get_list {
 std::unique_ptr<ethtool_linkstate_get_list>
 ethtool_linkstate_get_dump(ynl_cpp::ynl_socket&  ys,
 			   ethtool_linkstate_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_linkstate_get_list>>
+ethtool_linkstate_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ethtool_linkstate_get_req_dump& req,
+			      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_linkstate_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				   ethtool_linkstate_get_req_dump& req);
+std::unique_ptr<ethtool_linkstate_get_list>
+ethtool_linkstate_get_dump(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_linkstate_get_list>>
+ethtool_linkstate_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl,
+			      const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_DEBUG_GET ============== */
 /* ETHTOOL_MSG_DEBUG_GET - do */
@@ -390,6 +624,16 @@ struct ethtool_debug_get_rsp {
  */
 std::unique_ptr<ethtool_debug_get_rsp>
 ethtool_debug_get(ynl_cpp::ynl_socket&  ys, ethtool_debug_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_debug_get_rsp>>
+ethtool_debug_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_debug_get_req& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_debug_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_debug_get_req& req);
+std::unique_ptr<ethtool_debug_get_rsp>
+ethtool_debug_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_debug_get_rsp>>
+ethtool_debug_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_DEBUG_GET - dump */
 struct ethtool_debug_get_req_dump {
@@ -403,9 +647,29 @@ struct ethtool_debug_get_list {
 std::unique_ptr<ethtool_debug_get_list>
 ethtool_debug_get_dump(ynl_cpp::ynl_socket&  ys,
 		       ethtool_debug_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_debug_get_list>>
+ethtool_debug_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ethtool_debug_get_req_dump& req,
+			  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_debug_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       ethtool_debug_get_req_dump& req);
+std::unique_ptr<ethtool_debug_get_list>
+ethtool_debug_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_debug_get_list>>
+ethtool_debug_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_DEBUG_GET - notify */
 struct ethtool_debug_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_debug_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_DEBUG_SET ============== */
@@ -419,6 +683,16 @@ struct ethtool_debug_set_req {
  * Set debug message mask.
  */
 int ethtool_debug_set(ynl_cpp::ynl_socket&  ys, ethtool_debug_set_req& req);
+ynl_cpp::result<void>
+ethtool_debug_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_debug_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_debug_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_debug_set_req& req);
+int ethtool_debug_set(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_debug_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_debug_set_batch(ynl_cpp::msg_batch& batch, ethtool_debug_set_req& req);
 
 /* ============== ETHTOOL_MSG_WOL_GET ============== */
 /* ETHTOOL_MSG_WOL_GET - do */
@@ -437,6 +711,16 @@ struct ethtool_wol_get_rsp {
  */
 std::unique_ptr<ethtool_wol_get_rsp>
 ethtool_wol_get(ynl_cpp::ynl_socket&  ys, ethtool_wol_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_wol_get_rsp>>
+ethtool_wol_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_wol_get_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_wol_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_wol_get_req& req);
+std::unique_ptr<ethtool_wol_get_rsp>
+ethtool_wol_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_wol_get_rsp>>
+ethtool_wol_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_WOL_GET - dump */
 struct ethtool_wol_get_req_dump {
@@ -449,9 +733,28 @@ struct ethtool_wol_get_list {
 
 std::unique_ptr<ethtool_wol_get_list>
 ethtool_wol_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_wol_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_wol_get_list>>
+ethtool_wol_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_wol_get_req_dump& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_wol_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_wol_get_req_dump& req);
+std::unique_ptr<ethtool_wol_get_list>
+ethtool_wol_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_wol_get_list>>
+ethtool_wol_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_WOL_GET - notify */
 struct ethtool_wol_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_wol_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_WOL_SET ============== */
@@ -466,6 +769,15 @@ struct ethtool_wol_set_req {
  * Set WOL params.
  */
 int ethtool_wol_set(ynl_cpp::ynl_socket&  ys, ethtool_wol_set_req& req);
+ynl_cpp::result<void>
+ethtool_wol_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_wol_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_wol_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_wol_set_req& req);
+int ethtool_wol_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_wol_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_wol_set_batch(ynl_cpp::msg_batch& batch, ethtool_wol_set_req& req);
 
 /* ============== ETHTOOL_MSG_FEATURES_GET ============== */
 /* ETHTOOL_MSG_FEATURES_GET - do */
@@ -486,6 +798,19 @@ struct ethtool_features_get_rsp {
  */
 std::unique_ptr<ethtool_features_get_rsp>
 ethtool_features_get(ynl_cpp::ynl_socket&  ys, ethtool_features_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_features_get_rsp>>
+ethtool_features_get_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_features_get_req& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_features_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_features_get_req& req);
+std::unique_ptr<ethtool_features_get_rsp>
+ethtool_features_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_features_get_rsp>>
+ethtool_features_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_FEATURES_GET - dump */
 struct ethtool_features_get_req_dump {
@@ -499,9 +824,29 @@ struct ethtool_features_get_list {
 std::unique_ptr<ethtool_features_get_list>
 ethtool_features_get_dump(ynl_cpp::ynl_socket&  ys,
 			  ethtool_features_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_features_get_list>>
+ethtool_features_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_features_get_req_dump& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_features_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_features_get_req_dump& req);
+std::unique_ptr<ethtool_features_get_list>
+ethtool_features_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_features_get_list>>
+ethtool_features_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_FEATURES_GET - notify */
 struct ethtool_features_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_features_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_FEATURES_SET ============== */
@@ -527,6 +872,19 @@ struct ethtool_features_set_rsp {
  */
 std::unique_ptr<ethtool_features_set_rsp>
 ethtool_features_set(ynl_cpp::ynl_socket&  ys, ethtool_features_set_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_features_set_rsp>>
+ethtool_features_set_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_features_set_req& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_features_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_features_set_req& req);
+std::unique_ptr<ethtool_features_set_rsp>
+ethtool_features_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_features_set_rsp>>
+ethtool_features_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_PRIVFLAGS_GET ============== */
 /* ETHTOOL_MSG_PRIVFLAGS_GET - do */
@@ -544,6 +902,20 @@ struct ethtool_privflags_get_rsp {
  */
 std::unique_ptr<ethtool_privflags_get_rsp>
 ethtool_privflags_get(ynl_cpp::ynl_socket&  ys, ethtool_privflags_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_privflags_get_rsp>>
+ethtool_privflags_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ethtool_privflags_get_req& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_privflags_get_prepare(ynl_cpp::ynl_socket&  ys,
+			      ethtool_privflags_get_req& req);
+std::unique_ptr<ethtool_privflags_get_rsp>
+ethtool_privflags_get(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_privflags_get_rsp>>
+ethtool_privflags_get_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_PRIVFLAGS_GET - dump */
 struct ethtool_privflags_get_req_dump {
@@ -557,9 +929,29 @@ struct ethtool_privflags_get_list {
 std::unique_ptr<ethtool_privflags_get_list>
 ethtool_privflags_get_dump(ynl_cpp::ynl_socket&  ys,
 			   ethtool_privflags_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_privflags_get_list>>
+ethtool_privflags_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ethtool_privflags_get_req_dump& req,
+			      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_privflags_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				   ethtool_privflags_get_req_dump& req);
+std::unique_ptr<ethtool_privflags_get_list>
+ethtool_privflags_get_dump(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_privflags_get_list>>
+ethtool_privflags_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl,
+			      const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_PRIVFLAGS_GET - notify */
 struct ethtool_privflags_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_privflags_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_PRIVFLAGS_SET ============== */
@@ -574,6 +966,20 @@ struct ethtool_privflags_set_req {
  */
 int ethtool_privflags_set(ynl_cpp::ynl_socket&  ys,
 			  ethtool_privflags_set_req& req);
+ynl_cpp::result<void>
+ethtool_privflags_set_ex(ynl_cpp::ynl_socket&  ys,
+			 ethtool_privflags_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_privflags_set_prepare(ynl_cpp::ynl_socket&  ys,
+			      ethtool_privflags_set_req& req);
+int ethtool_privflags_set(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_privflags_set_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_privflags_set_batch(ynl_cpp::msg_batch& batch,
+			    ethtool_privflags_set_req& req);
 
 /* ============== ETHTOOL_MSG_RINGS_GET ============== */
 /* ETHTOOL_MSG_RINGS_GET - do */
@@ -607,6 +1013,16 @@ struct ethtool_rings_get_rsp {
  */
 std::unique_ptr<ethtool_rings_get_rsp>
 ethtool_rings_get(ynl_cpp::ynl_socket&  ys, ethtool_rings_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_rings_get_rsp>>
+ethtool_rings_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_rings_get_req& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rings_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_rings_get_req& req);
+std::unique_ptr<ethtool_rings_get_rsp>
+ethtool_rings_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_rings_get_rsp>>
+ethtool_rings_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_RINGS_GET - dump */
 struct ethtool_rings_get_req_dump {
@@ -620,9 +1036,29 @@ struct ethtool_rings_get_list {
 std::unique_ptr<ethtool_rings_get_list>
 ethtool_rings_get_dump(ynl_cpp::ynl_socket&  ys,
 		       ethtool_rings_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_rings_get_list>>
+ethtool_rings_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ethtool_rings_get_req_dump& req,
+			  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rings_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       ethtool_rings_get_req_dump& req);
+std::unique_ptr<ethtool_rings_get_list>
+ethtool_rings_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_rings_get_list>>
+ethtool_rings_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_RINGS_GET - notify */
 struct ethtool_rings_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_rings_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_RINGS_SET ============== */
@@ -652,6 +1088,16 @@ struct ethtool_rings_set_req {
  * Set ring params.
  */
 int ethtool_rings_set(ynl_cpp::ynl_socket&  ys, ethtool_rings_set_req& req);
+ynl_cpp::result<void>
+ethtool_rings_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_rings_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rings_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_rings_set_req& req);
+int ethtool_rings_set(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_rings_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_rings_set_batch(ynl_cpp::msg_batch& batch, ethtool_rings_set_req& req);
 
 /* ============== ETHTOOL_MSG_CHANNELS_GET ============== */
 /* ETHTOOL_MSG_CHANNELS_GET - do */
@@ -676,6 +1122,19 @@ struct ethtool_channels_get_rsp {
  */
 std::unique_ptr<ethtool_channels_get_rsp>
 ethtool_channels_get(ynl_cpp::ynl_socket&  ys, ethtool_channels_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_channels_get_rsp>>
+ethtool_channels_get_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_channels_get_req& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_channels_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_channels_get_req& req);
+std::unique_ptr<ethtool_channels_get_rsp>
+ethtool_channels_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_channels_get_rsp>>
+ethtool_channels_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_CHANNELS_GET - dump */
 struct ethtool_channels_get_req_dump {
@@ -689,9 +1148,29 @@ struct ethtool_channels_get_list {
 std::unique_ptr<ethtool_channels_get_list>
 ethtool_channels_get_dump(ynl_cpp::ynl_socket&  ys,
 			  ethtool_channels_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_channels_get_list>>
+ethtool_channels_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_channels_get_req_dump& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_channels_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_channels_get_req_dump& req);
+std::unique_ptr<ethtool_channels_get_list>
+ethtool_channels_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_channels_get_list>>
+ethtool_channels_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_CHANNELS_GET - notify */
 struct ethtool_channels_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_channels_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_CHANNELS_SET ============== */
@@ -713,6 +1192,20 @@ struct ethtool_channels_set_req {
  */
 int ethtool_channels_set(ynl_cpp::ynl_socket&  ys,
 			 ethtool_channels_set_req& req);
+ynl_cpp::result<void>
+ethtool_channels_set_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_channels_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_channels_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_channels_set_req& req);
+int ethtool_channels_set(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_channels_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_channels_set_batch(ynl_cpp::msg_batch& batch,
+			   ethtool_channels_set_req& req);
 
 /* ============== ETHTOOL_MSG_COALESCE_GET ============== */
 /* ETHTOOL_MSG_COALESCE_GET - do */
@@ -758,6 +1251,19 @@ struct ethtool_coalesce_get_rsp {
  */
 std::unique_ptr<ethtool_coalesce_get_rsp>
 ethtool_coalesce_get(ynl_cpp::ynl_socket&  ys, ethtool_coalesce_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_coalesce_get_rsp>>
+ethtool_coalesce_get_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_coalesce_get_req& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_coalesce_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_coalesce_get_req& req);
+std::unique_ptr<ethtool_coalesce_get_rsp>
+ethtool_coalesce_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_coalesce_get_rsp>>
+ethtool_coalesce_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_COALESCE_GET - dump */
 struct ethtool_coalesce_get_req_dump {
@@ -771,9 +1277,29 @@ struct ethtool_coalesce_get_list {
 std::unique_ptr<ethtool_coalesce_get_list>
 ethtool_coalesce_get_dump(ynl_cpp::ynl_socket&  ys,
 			  ethtool_coalesce_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_coalesce_get_list>>
+ethtool_coalesce_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_coalesce_get_req_dump& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_coalesce_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_coalesce_get_req_dump& req);
+std::unique_ptr<ethtool_coalesce_get_list>
+ethtool_coalesce_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_coalesce_get_list>>
+ethtool_coalesce_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_COALESCE_GET - notify */
 struct ethtool_coalesce_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_coalesce_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_COALESCE_SET ============== */
@@ -816,6 +1342,20 @@ struct ethtool_coalesce_set_req {
  */
 int ethtool_coalesce_set(ynl_cpp::ynl_socket&  ys,
 			 ethtool_coalesce_set_req& req);
+ynl_cpp::result<void>
+ethtool_coalesce_set_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_coalesce_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_coalesce_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_coalesce_set_req& req);
+int ethtool_coalesce_set(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_coalesce_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_coalesce_set_batch(ynl_cpp::msg_batch& batch,
+			   ethtool_coalesce_set_req& req);
 
 /* ============== ETHTOOL_MSG_PAUSE_GET ============== */
 /* ETHTOOL_MSG_PAUSE_GET - do */
@@ -837,6 +1377,16 @@ struct ethtool_pause_get_rsp {
  */
 std::unique_ptr<ethtool_pause_get_rsp>
 ethtool_pause_get(ynl_cpp::ynl_socket&  ys, ethtool_pause_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_pause_get_rsp>>
+ethtool_pause_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_pause_get_req& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pause_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_pause_get_req& req);
+std::unique_ptr<ethtool_pause_get_rsp>
+ethtool_pause_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_pause_get_rsp>>
+ethtool_pause_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_PAUSE_GET - dump */
 struct ethtool_pause_get_req_dump {
@@ -850,9 +1400,29 @@ struct ethtool_pause_get_list {
 std::unique_ptr<ethtool_pause_get_list>
 ethtool_pause_get_dump(ynl_cpp::ynl_socket&  ys,
 		       ethtool_pause_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_pause_get_list>>
+ethtool_pause_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ethtool_pause_get_req_dump& req,
+			  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pause_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       ethtool_pause_get_req_dump& req);
+std::unique_ptr<ethtool_pause_get_list>
+ethtool_pause_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_pause_get_list>>
+ethtool_pause_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_PAUSE_GET - notify */
 struct ethtool_pause_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_pause_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_PAUSE_SET ============== */
@@ -870,6 +1440,16 @@ struct ethtool_pause_set_req {
  * Set pause params.
  */
 int ethtool_pause_set(ynl_cpp::ynl_socket&  ys, ethtool_pause_set_req& req);
+ynl_cpp::result<void>
+ethtool_pause_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_pause_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pause_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_pause_set_req& req);
+int ethtool_pause_set(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_pause_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_pause_set_batch(ynl_cpp::msg_batch& batch, ethtool_pause_set_req& req);
 
 /* ============== ETHTOOL_MSG_EEE_GET ============== */
 /* ETHTOOL_MSG_EEE_GET - do */
@@ -892,6 +1472,16 @@ struct ethtool_eee_get_rsp {
  */
 std::unique_ptr<ethtool_eee_get_rsp>
 ethtool_eee_get(ynl_cpp::ynl_socket&  ys, ethtool_eee_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_eee_get_rsp>>
+ethtool_eee_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_eee_get_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_eee_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_eee_get_req& req);
+std::unique_ptr<ethtool_eee_get_rsp>
+ethtool_eee_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_eee_get_rsp>>
+ethtool_eee_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_EEE_GET - dump */
 struct ethtool_eee_get_req_dump {
@@ -904,9 +1494,28 @@ struct ethtool_eee_get_list {
 
 std::unique_ptr<ethtool_eee_get_list>
 ethtool_eee_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_eee_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_eee_get_list>>
+ethtool_eee_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_eee_get_req_dump& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_eee_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_eee_get_req_dump& req);
+std::unique_ptr<ethtool_eee_get_list>
+ethtool_eee_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_eee_get_list>>
+ethtool_eee_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_EEE_GET - notify */
 struct ethtool_eee_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_eee_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_EEE_SET ============== */
@@ -925,6 +1534,15 @@ struct ethtool_eee_set_req {
  * Set eee params.
  */
 int ethtool_eee_set(ynl_cpp::ynl_socket&  ys, ethtool_eee_set_req& req);
+ynl_cpp::result<void>
+ethtool_eee_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_eee_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_eee_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_eee_set_req& req);
+int ethtool_eee_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_eee_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_eee_set_batch(ynl_cpp::msg_batch& batch, ethtool_eee_set_req& req);
 
 /* ============== ETHTOOL_MSG_TSINFO_GET ============== */
 /* ETHTOOL_MSG_TSINFO_GET - do */
@@ -948,6 +1566,18 @@ struct ethtool_tsinfo_get_rsp {
  */
 std::unique_ptr<ethtool_tsinfo_get_rsp>
 ethtool_tsinfo_get(ynl_cpp::ynl_socket&  ys, ethtool_tsinfo_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_tsinfo_get_rsp>>
+ethtool_tsinfo_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_tsinfo_get_req& req,
+		      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tsinfo_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   ethtool_tsinfo_get_req& req);
+std::unique_ptr<ethtool_tsinfo_get_rsp>
+ethtool_tsinfo_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_tsinfo_get_rsp>>
+ethtool_tsinfo_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_TSINFO_GET - dump */
 struct ethtool_tsinfo_get_req_dump {
@@ -962,6 +1592,20 @@ struct ethtool_tsinfo_get_list {
 std::unique_ptr<ethtool_tsinfo_get_list>
 ethtool_tsinfo_get_dump(ynl_cpp::ynl_socket&  ys,
 			ethtool_tsinfo_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_tsinfo_get_list>>
+ethtool_tsinfo_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_tsinfo_get_req_dump& req,
+			   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tsinfo_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_tsinfo_get_req_dump& req);
+std::unique_ptr<ethtool_tsinfo_get_list>
+ethtool_tsinfo_get_dump(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_tsinfo_get_list>>
+ethtool_tsinfo_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_CABLE_TEST_ACT ============== */
 /* ETHTOOL_MSG_CABLE_TEST_ACT - do */
@@ -974,6 +1618,20 @@ struct ethtool_cable_test_act_req {
  */
 int ethtool_cable_test_act(ynl_cpp::ynl_socket&  ys,
 			   ethtool_cable_test_act_req& req);
+ynl_cpp::result<void>
+ethtool_cable_test_act_ex(ynl_cpp::ynl_socket&  ys,
+			  ethtool_cable_test_act_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_cable_test_act_prepare(ynl_cpp::ynl_socket&  ys,
+			       ethtool_cable_test_act_req& req);
+int ethtool_cable_test_act(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_cable_test_act_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_cable_test_act_batch(ynl_cpp::msg_batch& batch,
+			     ethtool_cable_test_act_req& req);
 
 /* ============== ETHTOOL_MSG_CABLE_TEST_TDR_ACT ============== */
 /* ETHTOOL_MSG_CABLE_TEST_TDR_ACT - do */
@@ -986,6 +1644,20 @@ struct ethtool_cable_test_tdr_act_req {
  */
 int ethtool_cable_test_tdr_act(ynl_cpp::ynl_socket&  ys,
 			       ethtool_cable_test_tdr_act_req& req);
+ynl_cpp::result<void>
+ethtool_cable_test_tdr_act_ex(ynl_cpp::ynl_socket&  ys,
+			      ethtool_cable_test_tdr_act_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_cable_test_tdr_act_prepare(ynl_cpp::ynl_socket&  ys,
+				   ethtool_cable_test_tdr_act_req& req);
+int ethtool_cable_test_tdr_act(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_cable_test_tdr_act_ex(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_cable_test_tdr_act_batch(ynl_cpp::msg_batch& batch,
+				 ethtool_cable_test_tdr_act_req& req);
 
 /* ============== ETHTOOL_MSG_TUNNEL_INFO_GET ============== */
 /* ETHTOOL_MSG_TUNNEL_INFO_GET - do */
@@ -1004,6 +1676,20 @@ struct ethtool_tunnel_info_get_rsp {
 std::unique_ptr<ethtool_tunnel_info_get_rsp>
 ethtool_tunnel_info_get(ynl_cpp::ynl_socket&  ys,
 			ethtool_tunnel_info_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_tunnel_info_get_rsp>>
+ethtool_tunnel_info_get_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_tunnel_info_get_req& req,
+			   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tunnel_info_get_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_tunnel_info_get_req& req);
+std::unique_ptr<ethtool_tunnel_info_get_rsp>
+ethtool_tunnel_info_get(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_tunnel_info_get_rsp>>
+ethtool_tunnel_info_get_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_TUNNEL_INFO_GET - dump */
 struct ethtool_tunnel_info_get_req_dump {
@@ -1017,6 +1703,20 @@ struct ethtool_tunnel_info_get_list {
 std::unique_ptr<ethtool_tunnel_info_get_list>
 ethtool_tunnel_info_get_dump(ynl_cpp::ynl_socket&  ys,
 			     ethtool_tunnel_info_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_tunnel_info_get_list>>
+ethtool_tunnel_info_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ethtool_tunnel_info_get_req_dump& req,
+				const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tunnel_info_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				     ethtool_tunnel_info_get_req_dump& req);
+std::unique_ptr<ethtool_tunnel_info_get_list>
+ethtool_tunnel_info_get_dump(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_tunnel_info_get_list>>
+ethtool_tunnel_info_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl,
+				const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_FEC_GET ============== */
 /* ETHTOOL_MSG_FEC_GET - do */
@@ -1037,6 +1737,16 @@ struct ethtool_fec_get_rsp {
  */
 std::unique_ptr<ethtool_fec_get_rsp>
 ethtool_fec_get(ynl_cpp::ynl_socket&  ys, ethtool_fec_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_fec_get_rsp>>
+ethtool_fec_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_fec_get_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_fec_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_fec_get_req& req);
+std::unique_ptr<ethtool_fec_get_rsp>
+ethtool_fec_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_fec_get_rsp>>
+ethtool_fec_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_FEC_GET - dump */
 struct ethtool_fec_get_req_dump {
@@ -1049,9 +1759,28 @@ struct ethtool_fec_get_list {
 
 std::unique_ptr<ethtool_fec_get_list>
 ethtool_fec_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_fec_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_fec_get_list>>
+ethtool_fec_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_fec_get_req_dump& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_fec_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_fec_get_req_dump& req);
+std::unique_ptr<ethtool_fec_get_list>
+ethtool_fec_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_fec_get_list>>
+ethtool_fec_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_FEC_GET - notify */
 struct ethtool_fec_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_fec_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_FEC_SET ============== */
@@ -1068,6 +1797,15 @@ struct ethtool_fec_set_req {
  * Set FEC params.
  */
 int ethtool_fec_set(ynl_cpp::ynl_socket&  ys, ethtool_fec_set_req& req);
+ynl_cpp::result<void>
+ethtool_fec_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_fec_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_fec_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_fec_set_req& req);
+int ethtool_fec_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_fec_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_fec_set_batch(ynl_cpp::msg_batch& batch, ethtool_fec_set_req& req);
 
 /* ============== ETHTOOL_MSG_MODULE_EEPROM_GET ============== */
 /* ETHTOOL_MSG_MODULE_EEPROM_GET - do */
@@ -1091,6 +1829,20 @@ struct ethtool_module_eeprom_get_rsp {
 std::unique_ptr<ethtool_module_eeprom_get_rsp>
 ethtool_module_eeprom_get(ynl_cpp::ynl_socket&  ys,
 			  ethtool_module_eeprom_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_module_eeprom_get_rsp>>
+ethtool_module_eeprom_get_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_module_eeprom_get_req& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_eeprom_get_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_module_eeprom_get_req& req);
+std::unique_ptr<ethtool_module_eeprom_get_rsp>
+ethtool_module_eeprom_get(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_module_eeprom_get_rsp>>
+ethtool_module_eeprom_get_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_MODULE_EEPROM_GET - dump */
 struct ethtool_module_eeprom_get_req_dump {
@@ -1104,6 +1856,20 @@ struct ethtool_module_eeprom_get_list {
 std::unique_ptr<ethtool_module_eeprom_get_list>
 ethtool_module_eeprom_get_dump(ynl_cpp::ynl_socket&  ys,
 			       ethtool_module_eeprom_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_module_eeprom_get_list>>
+ethtool_module_eeprom_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				  ethtool_module_eeprom_get_req_dump& req,
+				  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_eeprom_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				       ethtool_module_eeprom_get_req_dump& req);
+std::unique_ptr<ethtool_module_eeprom_get_list>
+ethtool_module_eeprom_get_dump(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_module_eeprom_get_list>>
+ethtool_module_eeprom_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				  ynl_cpp::request_template& tmpl,
+				  const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_STATS_GET ============== */
 /* ETHTOOL_MSG_STATS_GET - do */
@@ -1124,6 +1890,16 @@ struct ethtool_stats_get_rsp {
  */
 std::unique_ptr<ethtool_stats_get_rsp>
 ethtool_stats_get(ynl_cpp::ynl_socket&  ys, ethtool_stats_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_stats_get_rsp>>
+ethtool_stats_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_stats_get_req& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_stats_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_stats_get_req& req);
+std::unique_ptr<ethtool_stats_get_rsp>
+ethtool_stats_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_stats_get_rsp>>
+ethtool_stats_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_STATS_GET - dump */
 struct ethtool_stats_get_req_dump {
@@ -1138,6 +1914,20 @@ struct ethtool_stats_get_list {
 std::unique_ptr<ethtool_stats_get_list>
 ethtool_stats_get_dump(ynl_cpp::ynl_socket&  ys,
 		       ethtool_stats_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_stats_get_list>>
+ethtool_stats_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ethtool_stats_get_req_dump& req,
+			  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_stats_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       ethtool_stats_get_req_dump& req);
+std::unique_ptr<ethtool_stats_get_list>
+ethtool_stats_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_stats_get_list>>
+ethtool_stats_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_PHC_VCLOCKS_GET ============== */
 /* ETHTOOL_MSG_PHC_VCLOCKS_GET - do */
@@ -1156,6 +1946,20 @@ struct ethtool_phc_vclocks_get_rsp {
 std::unique_ptr<ethtool_phc_vclocks_get_rsp>
 ethtool_phc_vclocks_get(ynl_cpp::ynl_socket&  ys,
 			ethtool_phc_vclocks_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_phc_vclocks_get_rsp>>
+ethtool_phc_vclocks_get_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_phc_vclocks_get_req& req,
+			   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_phc_vclocks_get_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_phc_vclocks_get_req& req);
+std::unique_ptr<ethtool_phc_vclocks_get_rsp>
+ethtool_phc_vclocks_get(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_phc_vclocks_get_rsp>>
+ethtool_phc_vclocks_get_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_PHC_VCLOCKS_GET - dump */
 struct ethtool_phc_vclocks_get_req_dump {
@@ -1169,6 +1973,20 @@ struct ethtool_phc_vclocks_get_list {
 std::unique_ptr<ethtool_phc_vclocks_get_list>
 ethtool_phc_vclocks_get_dump(ynl_cpp::ynl_socket&  ys,
 			     ethtool_phc_vclocks_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_phc_vclocks_get_list>>
+ethtool_phc_vclocks_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ethtool_phc_vclocks_get_req_dump& req,
+				const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_phc_vclocks_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				     ethtool_phc_vclocks_get_req_dump& req);
+std::unique_ptr<ethtool_phc_vclocks_get_list>
+ethtool_phc_vclocks_get_dump(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_phc_vclocks_get_list>>
+ethtool_phc_vclocks_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl,
+				const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_MODULE_GET ============== */
 /* ETHTOOL_MSG_MODULE_GET - do */
@@ -1187,6 +2005,18 @@ struct ethtool_module_get_rsp {
  */
 std::unique_ptr<ethtool_module_get_rsp>
 ethtool_module_get(ynl_cpp::ynl_socket&  ys, ethtool_module_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_module_get_rsp>>
+ethtool_module_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_module_get_req& req,
+		      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   ethtool_module_get_req& req);
+std::unique_ptr<ethtool_module_get_rsp>
+ethtool_module_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_module_get_rsp>>
+ethtool_module_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_MODULE_GET - dump */
 struct ethtool_module_get_req_dump {
@@ -1200,9 +2030,29 @@ struct ethtool_module_get_list {
 std::unique_ptr<ethtool_module_get_list>
 ethtool_module_get_dump(ynl_cpp::ynl_socket&  ys,
 			ethtool_module_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_module_get_list>>
+ethtool_module_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_module_get_req_dump& req,
+			   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_module_get_req_dump& req);
+std::unique_ptr<ethtool_module_get_list>
+ethtool_module_get_dump(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_module_get_list>>
+ethtool_module_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_MODULE_GET - notify */
 struct ethtool_module_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_module_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_MODULE_SET ============== */
@@ -1217,6 +2067,19 @@ struct ethtool_module_set_req {
  * Set module params.
  */
 int ethtool_module_set(ynl_cpp::ynl_socket&  ys, ethtool_module_set_req& req);
+ynl_cpp::result<void>
+ethtool_module_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_module_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_set_prepare(ynl_cpp::ynl_socket&  ys,
+			   ethtool_module_set_req& req);
+int ethtool_module_set(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_module_set_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_module_set_batch(ynl_cpp::msg_batch& batch,
+			 ethtool_module_set_req& req);
 
 /* ============== ETHTOOL_MSG_PSE_GET ============== */
 /* ETHTOOL_MSG_PSE_GET - do */
@@ -1245,6 +2108,16 @@ struct ethtool_pse_get_rsp {
  */
 std::unique_ptr<ethtool_pse_get_rsp>
 ethtool_pse_get(ynl_cpp::ynl_socket&  ys, ethtool_pse_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_pse_get_rsp>>
+ethtool_pse_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_pse_get_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pse_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_pse_get_req& req);
+std::unique_ptr<ethtool_pse_get_rsp>
+ethtool_pse_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_pse_get_rsp>>
+ethtool_pse_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_PSE_GET - dump */
 struct ethtool_pse_get_req_dump {
@@ -1257,6 +2130,19 @@ struct ethtool_pse_get_list {
 
 std::unique_ptr<ethtool_pse_get_list>
 ethtool_pse_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_pse_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_pse_get_list>>
+ethtool_pse_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_pse_get_req_dump& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pse_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_pse_get_req_dump& req);
+std::unique_ptr<ethtool_pse_get_list>
+ethtool_pse_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_pse_get_list>>
+ethtool_pse_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_PSE_SET ============== */
 /* ETHTOOL_MSG_PSE_SET - do */
@@ -1271,6 +2157,15 @@ struct ethtool_pse_set_req {
  * Set Power Sourcing Equipment params.
  */
 int ethtool_pse_set(ynl_cpp::ynl_socket&  ys, ethtool_pse_set_req& req);
+ynl_cpp::result<void>
+ethtool_pse_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_pse_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_pse_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_pse_set_req& req);
+int ethtool_pse_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_pse_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_pse_set_batch(ynl_cpp::msg_batch& batch, ethtool_pse_set_req& req);
 
 /* ============== ETHTOOL_MSG_RSS_GET ============== */
 /* ETHTOOL_MSG_RSS_GET - do */
@@ -1293,6 +2188,16 @@ struct ethtool_rss_get_rsp {
  */
 std::unique_ptr<ethtool_rss_get_rsp>
 ethtool_rss_get(ynl_cpp::ynl_socket&  ys, ethtool_rss_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_rss_get_rsp>>
+ethtool_rss_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_rss_get_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rss_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_rss_get_req& req);
+std::unique_ptr<ethtool_rss_get_rsp>
+ethtool_rss_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_rss_get_rsp>>
+ethtool_rss_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_RSS_GET - dump */
 struct ethtool_rss_get_req_dump {
@@ -1306,6 +2211,19 @@ struct ethtool_rss_get_list {
 
 std::unique_ptr<ethtool_rss_get_list>
 ethtool_rss_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_rss_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_rss_get_list>>
+ethtool_rss_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_rss_get_req_dump& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rss_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_rss_get_req_dump& req);
+std::unique_ptr<ethtool_rss_get_list>
+ethtool_rss_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_rss_get_list>>
+ethtool_rss_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_PLCA_GET_CFG ============== */
 /* ETHTOOL_MSG_PLCA_GET_CFG - do */
@@ -1330,6 +2248,19 @@ struct ethtool_plca_get_cfg_rsp {
  */
 std::unique_ptr<ethtool_plca_get_cfg_rsp>
 ethtool_plca_get_cfg(ynl_cpp::ynl_socket&  ys, ethtool_plca_get_cfg_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_cfg_rsp>>
+ethtool_plca_get_cfg_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_plca_get_cfg_req& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_plca_get_cfg_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_plca_get_cfg_req& req);
+std::unique_ptr<ethtool_plca_get_cfg_rsp>
+ethtool_plca_get_cfg(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_cfg_rsp>>
+ethtool_plca_get_cfg_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_PLCA_GET_CFG - dump */
 struct ethtool_plca_get_cfg_req_dump {
@@ -1343,9 +2274,29 @@ struct ethtool_plca_get_cfg_list {
 std::unique_ptr<ethtool_plca_get_cfg_list>
 ethtool_plca_get_cfg_dump(ynl_cpp::ynl_socket&  ys,
 			  ethtool_plca_get_cfg_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_cfg_list>>
+ethtool_plca_get_cfg_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_plca_get_cfg_req_dump& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_plca_get_cfg_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_plca_get_cfg_req_dump& req);
+std::unique_ptr<ethtool_plca_get_cfg_list>
+ethtool_plca_get_cfg_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_cfg_list>>
+ethtool_plca_get_cfg_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_PLCA_GET_CFG - notify */
 struct ethtool_plca_get_cfg_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_plca_get_cfg_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_PLCA_SET_CFG ============== */
@@ -1367,6 +2318,20 @@ struct ethtool_plca_set_cfg_req {
  */
 int ethtool_plca_set_cfg(ynl_cpp::ynl_socket&  ys,
 			 ethtool_plca_set_cfg_req& req);
+ynl_cpp::result<void>
+ethtool_plca_set_cfg_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_plca_set_cfg_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_plca_set_cfg_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_plca_set_cfg_req& req);
+int ethtool_plca_set_cfg(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_plca_set_cfg_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_plca_set_cfg_batch(ynl_cpp::msg_batch& batch,
+			   ethtool_plca_set_cfg_req& req);
 
 /* ============== ETHTOOL_MSG_PLCA_GET_STATUS ============== */
 /* ETHTOOL_MSG_PLCA_GET_STATUS - do */
@@ -1392,6 +2357,20 @@ struct ethtool_plca_get_status_rsp {
 std::unique_ptr<ethtool_plca_get_status_rsp>
 ethtool_plca_get_status(ynl_cpp::ynl_socket&  ys,
 			ethtool_plca_get_status_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_status_rsp>>
+ethtool_plca_get_status_ex(ynl_cpp::ynl_socket&  ys,
+			   ethtool_plca_get_status_req& req,
+			   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_plca_get_status_prepare(ynl_cpp::ynl_socket&  ys,
+				ethtool_plca_get_status_req& req);
+std::unique_ptr<ethtool_plca_get_status_rsp>
+ethtool_plca_get_status(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_status_rsp>>
+ethtool_plca_get_status_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_PLCA_GET_STATUS - dump */
 struct ethtool_plca_get_status_req_dump {
@@ -1405,6 +2384,20 @@ struct ethtool_plca_get_status_list {
 std::unique_ptr<ethtool_plca_get_status_list>
 ethtool_plca_get_status_dump(ynl_cpp::ynl_socket&  ys,
 			     ethtool_plca_get_status_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_status_list>>
+ethtool_plca_get_status_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ethtool_plca_get_status_req_dump& req,
+				const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_plca_get_status_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				     ethtool_plca_get_status_req_dump& req);
+std::unique_ptr<ethtool_plca_get_status_list>
+ethtool_plca_get_status_dump(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_plca_get_status_list>>
+ethtool_plca_get_status_dump_ex(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl,
+				const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_MM_GET ============== */
 /* ETHTOOL_MSG_MM_GET - do */
@@ -1430,6 +2423,16 @@ struct ethtool_mm_get_rsp {
  */
 std::unique_ptr<ethtool_mm_get_rsp>
 ethtool_mm_get(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_mm_get_rsp>>
+ethtool_mm_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req& req,
+		  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_mm_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req& req);
+std::unique_ptr<ethtool_mm_get_rsp>
+ethtool_mm_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_mm_get_rsp>>
+ethtool_mm_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_MM_GET - dump */
 struct ethtool_mm_get_req_dump {
@@ -1442,9 +2445,27 @@ struct ethtool_mm_get_list {
 
 std::unique_ptr<ethtool_mm_get_list>
 ethtool_mm_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_mm_get_list>>
+ethtool_mm_get_dump_ex(ynl_cpp::ynl_socket&  ys, ethtool_mm_get_req_dump& req,
+		       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_mm_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			    ethtool_mm_get_req_dump& req);
+std::unique_ptr<ethtool_mm_get_list>
+ethtool_mm_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_mm_get_list>>
+ethtool_mm_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_MM_GET - notify */
 struct ethtool_mm_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_mm_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_MM_SET ============== */
@@ -1462,6 +2483,15 @@ struct ethtool_mm_set_req {
  * Set MAC Merge configuration
  */
 int ethtool_mm_set(ynl_cpp::ynl_socket&  ys, ethtool_mm_set_req& req);
+ynl_cpp::result<void>
+ethtool_mm_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_mm_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_mm_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_mm_set_req& req);
+int ethtool_mm_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_mm_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_mm_set_batch(ynl_cpp::msg_batch& batch, ethtool_mm_set_req& req);
 
 /* ============== ETHTOOL_MSG_MODULE_FW_FLASH_ACT ============== */
 /* ETHTOOL_MSG_MODULE_FW_FLASH_ACT - do */
@@ -1476,6 +2506,20 @@ struct ethtool_module_fw_flash_act_req {
  */
 int ethtool_module_fw_flash_act(ynl_cpp::ynl_socket&  ys,
 				ethtool_module_fw_flash_act_req& req);
+ynl_cpp::result<void>
+ethtool_module_fw_flash_act_ex(ynl_cpp::ynl_socket&  ys,
+			       ethtool_module_fw_flash_act_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_module_fw_flash_act_prepare(ynl_cpp::ynl_socket&  ys,
+				    ethtool_module_fw_flash_act_req& req);
+int ethtool_module_fw_flash_act(ynl_cpp::ynl_socket&  ys,
+				ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_module_fw_flash_act_ex(ynl_cpp::ynl_socket&  ys,
+			       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_module_fw_flash_act_batch(ynl_cpp::msg_batch& batch,
+				  ethtool_module_fw_flash_act_req& req);
 
 /* ============== ETHTOOL_MSG_PHY_GET ============== */
 /* ETHTOOL_MSG_PHY_GET - do */
@@ -1499,6 +2543,16 @@ struct ethtool_phy_get_rsp {
  */
 std::unique_ptr<ethtool_phy_get_rsp>
 ethtool_phy_get(ynl_cpp::ynl_socket&  ys, ethtool_phy_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_phy_get_rsp>>
+ethtool_phy_get_ex(ynl_cpp::ynl_socket&  ys, ethtool_phy_get_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_phy_get_prepare(ynl_cpp::ynl_socket&  ys, ethtool_phy_get_req& req);
+std::unique_ptr<ethtool_phy_get_rsp>
+ethtool_phy_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_phy_get_rsp>>
+ethtool_phy_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_PHY_GET - dump */
 struct ethtool_phy_get_req_dump {
@@ -1511,9 +2565,28 @@ struct ethtool_phy_get_list {
 
 std::unique_ptr<ethtool_phy_get_list>
 ethtool_phy_get_dump(ynl_cpp::ynl_socket&  ys, ethtool_phy_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_phy_get_list>>
+ethtool_phy_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_phy_get_req_dump& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_phy_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_phy_get_req_dump& req);
+std::unique_ptr<ethtool_phy_get_list>
+ethtool_phy_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_phy_get_list>>
+ethtool_phy_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_PHY_GET - notify */
 struct ethtool_phy_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_phy_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== ETHTOOL_MSG_TSCONFIG_GET ============== */
@@ -1535,6 +2608,19 @@ struct ethtool_tsconfig_get_rsp {
  */
 std::unique_ptr<ethtool_tsconfig_get_rsp>
 ethtool_tsconfig_get(ynl_cpp::ynl_socket&  ys, ethtool_tsconfig_get_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_get_rsp>>
+ethtool_tsconfig_get_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_tsconfig_get_req& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tsconfig_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_tsconfig_get_req& req);
+std::unique_ptr<ethtool_tsconfig_get_rsp>
+ethtool_tsconfig_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_get_rsp>>
+ethtool_tsconfig_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ETHTOOL_MSG_TSCONFIG_GET - dump */
 struct ethtool_tsconfig_get_req_dump {
@@ -1548,6 +2634,20 @@ struct ethtool_tsconfig_get_list {
 std::unique_ptr<ethtool_tsconfig_get_list>
 ethtool_tsconfig_get_dump(ynl_cpp::ynl_socket&  ys,
 			  ethtool_tsconfig_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_get_list>>
+ethtool_tsconfig_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ethtool_tsconfig_get_req_dump& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tsconfig_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  ethtool_tsconfig_get_req_dump& req);
+std::unique_ptr<ethtool_tsconfig_get_list>
+ethtool_tsconfig_get_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_get_list>>
+ethtool_tsconfig_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
 
 /* ============== ETHTOOL_MSG_TSCONFIG_SET ============== */
 /* ETHTOOL_MSG_TSCONFIG_SET - do */
@@ -1572,6 +2672,44 @@ struct ethtool_tsconfig_set_rsp {
  */
 std::unique_ptr<ethtool_tsconfig_set_rsp>
 ethtool_tsconfig_set(ynl_cpp::ynl_socket&  ys, ethtool_tsconfig_set_req& req);
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_set_rsp>>
+ethtool_tsconfig_set_ex(ynl_cpp::ynl_socket&  ys,
+			ethtool_tsconfig_set_req& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_tsconfig_set_prepare(ynl_cpp::ynl_socket&  ys,
+			     ethtool_tsconfig_set_req& req);
+std::unique_ptr<ethtool_tsconfig_set_rsp>
+ethtool_tsconfig_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ethtool_tsconfig_set_rsp>>
+ethtool_tsconfig_set_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
+
+/* ============== ETHTOOL_MSG_RSS_SET ============== */
+/* ETHTOOL_MSG_RSS_SET - do */
+struct ethtool_rss_set_req {
+	std::optional<ethtool_header> header;
+	std::optional<__u32> context;
+	std::optional<__u32> hfunc;
+	std::vector<__u8> indir;
+	std::vector<__u8> hkey;
+	std::optional<__u32> input_xfrm;
+};
+
+/*
+ * Set RSS params.
+ */
+int ethtool_rss_set(ynl_cpp::ynl_socket&  ys, ethtool_rss_set_req& req);
+ynl_cpp::result<void>
+ethtool_rss_set_ex(ynl_cpp::ynl_socket&  ys, ethtool_rss_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ethtool_rss_set_prepare(ynl_cpp::ynl_socket&  ys, ethtool_rss_set_req& req);
+int ethtool_rss_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ethtool_rss_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ethtool_rss_set_batch(ynl_cpp::msg_batch& batch, ethtool_rss_set_req& req);
 
 /* ETHTOOL_MSG_CABLE_TEST_NTF - event */
 struct ethtool_cable_test_ntf_rsp {
@@ -1580,6 +2718,12 @@ struct ethtool_cable_test_ntf_rsp {
 };
 
 struct ethtool_cable_test_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_cable_test_ntf_rsp obj __attribute__((aligned(8)));
 };
 
 /* ETHTOOL_MSG_CABLE_TEST_TDR_NTF - event */
@@ -1590,6 +2734,12 @@ struct ethtool_cable_test_tdr_ntf_rsp {
 };
 
 struct ethtool_cable_test_tdr_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_cable_test_tdr_ntf_rsp obj __attribute__((aligned(8)));
 };
 
 /* ETHTOOL_MSG_MODULE_FW_FLASH_NTF - event */
@@ -1602,6 +2752,12 @@ struct ethtool_module_fw_flash_ntf_rsp {
 };
 
 struct ethtool_module_fw_flash_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	ethtool_module_fw_flash_ntf_rsp obj __attribute__((aligned(8)));
 };
 
 } //namespace ynl_cpp
@@ -70,76 +70,182 @@ struct ynl_policy_nest fou_nest = {
 /* Common nested types */
 /* ============== FOU_CMD_ADD ============== */
 /* FOU_CMD_ADD - do */
-int fou_add(ynl_cpp::ynl_socket&  ys, fou_add_req& req)
+static void fou_add_put(struct nlmsghdr *nlh, fou_add_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, FOU_CMD_ADD, 1);
-	((struct ynl_sock*)ys)->req_policy = &fou_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 60 <= YNL_SOCKET_BUFFER_SIZE);
 
 	if (req.port.has_value())
-		ynl_attr_put_u16(nlh, FOU_ATTR_PORT, req.port.value());
+		ynl_attr_put_u16_unchecked(nlh, FOU_ATTR_PORT, req.port.value());
 	if (req.ipproto.has_value())
-		ynl_attr_put_u8(nlh, FOU_ATTR_IPPROTO, req.ipproto.value());
+		ynl_attr_put_u8_unchecked(nlh, FOU_ATTR_IPPROTO, req.ipproto.value());
 	if (req.type.has_value())
-		ynl_attr_put_u8(nlh, FOU_ATTR_TYPE, req.type.value());
+		ynl_attr_put_u8_unchecked(nlh, FOU_ATTR_TYPE, req.type.value());
 	if (req.remcsum_nopartial)
-		ynl_attr_put(nlh, FOU_ATTR_REMCSUM_NOPARTIAL, NULL, 0);
+		ynl_attr_put_unchecked(nlh, FOU_ATTR_REMCSUM_NOPARTIAL, NULL, 0);
 	if (req.local_v4.has_value())
-		ynl_attr_put_u32(nlh, FOU_ATTR_LOCAL_V4, req.local_v4.value());
+		ynl_attr_put_u32_unchecked(nlh, FOU_ATTR_LOCAL_V4, req.local_v4.value());
 	if (req.peer_v4.has_value())
-		ynl_attr_put_u32(nlh, FOU_ATTR_PEER_V4, req.peer_v4.value());
+		ynl_attr_put_u32_unchecked(nlh, FOU_ATTR_PEER_V4, req.peer_v4.value());
+	if (req.peer_port.has_value())
+		ynl_attr_put_u16_unchecked(nlh, FOU_ATTR_PEER_PORT, req.peer_port.value());
+	if (req.ifindex.has_value())
+		ynl_attr_put_s32_unchecked(nlh, FOU_ATTR_IFINDEX, req.ifindex.value());
 	if (req.local_v6.size() > 0)
 		ynl_attr_put(nlh, FOU_ATTR_LOCAL_V6, req.local_v6.data(), req.local_v6.size());
 	if (req.peer_v6.size() > 0)
 		ynl_attr_put(nlh, FOU_ATTR_PEER_V6, req.peer_v6.data(), req.peer_v6.size());
-	if (req.peer_port.has_value())
-		ynl_attr_put_u16(nlh, FOU_ATTR_PEER_PORT, req.peer_port.value());
-	if (req.ifindex.has_value())
-		ynl_attr_put_s32(nlh, FOU_ATTR_IFINDEX, req.ifindex.value());
+}
+
+static ynl_cpp::result<void>
+fou_add_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &fou_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
 }
 
-/* ============== FOU_CMD_DEL ============== */
-/* FOU_CMD_DEL - do */
-int fou_del(ynl_cpp::ynl_socket&  ys, fou_del_req& req)
+ynl_cpp::result<void> fou_add_ex(ynl_cpp::ynl_socket&  ys, fou_add_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, FOU_CMD_DEL, 1);
-	((struct ynl_sock*)ys)->req_policy = &fou_nest;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, FOU_CMD_ADD, 1);
+	fou_add_put(nlh, req);
+
+	return fou_add_exec(ys, nlh);
+}
+
+int fou_add(ynl_cpp::ynl_socket&  ys, fou_add_req& req)
+{
+	auto ret = fou_add_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+fou_add_prepare(ynl_cpp::ynl_socket&  ys, fou_add_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, FOU_CMD_ADD, 1);
+	fou_add_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+fou_add_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return fou_add_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int fou_add(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = fou_add_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+fou_add_batch(ynl_cpp::msg_batch& batch, fou_add_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(FOU_CMD_ADD, 1);
+	fou_add_put(nlh, req);
+	return batch.msg_end(nlh, &fou_nest);
+}
+
+/* ============== FOU_CMD_DEL ============== */
+/* FOU_CMD_DEL - do */
+static void fou_del_put(struct nlmsghdr *nlh, fou_del_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 48 <= YNL_SOCKET_BUFFER_SIZE);
 
 	if (req.af.has_value())
-		ynl_attr_put_u8(nlh, FOU_ATTR_AF, req.af.value());
+		ynl_attr_put_u8_unchecked(nlh, FOU_ATTR_AF, req.af.value());
 	if (req.ifindex.has_value())
-		ynl_attr_put_s32(nlh, FOU_ATTR_IFINDEX, req.ifindex.value());
+		ynl_attr_put_s32_unchecked(nlh, FOU_ATTR_IFINDEX, req.ifindex.value());
 	if (req.port.has_value())
-		ynl_attr_put_u16(nlh, FOU_ATTR_PORT, req.port.value());
+		ynl_attr_put_u16_unchecked(nlh, FOU_ATTR_PORT, req.port.value());
 	if (req.peer_port.has_value())
-		ynl_attr_put_u16(nlh, FOU_ATTR_PEER_PORT, req.peer_port.value());
+		ynl_attr_put_u16_unchecked(nlh, FOU_ATTR_PEER_PORT, req.peer_port.value());
 	if (req.local_v4.has_value())
-		ynl_attr_put_u32(nlh, FOU_ATTR_LOCAL_V4, req.local_v4.value());
+		ynl_attr_put_u32_unchecked(nlh, FOU_ATTR_LOCAL_V4, req.local_v4.value());
 	if (req.peer_v4.has_value())
-		ynl_attr_put_u32(nlh, FOU_ATTR_PEER_V4, req.peer_v4.value());
+		ynl_attr_put_u32_unchecked(nlh, FOU_ATTR_PEER_V4, req.peer_v4.value());
 	if (req.local_v6.size() > 0)
 		ynl_attr_put(nlh, FOU_ATTR_LOCAL_V6, req.local_v6.data(), req.local_v6.size());
 	if (req.peer_v6.size() > 0)
 		ynl_attr_put(nlh, FOU_ATTR_PEER_V6, req.peer_v6.data(), req.peer_v6.size());
+}
+
+static ynl_cpp::result<void>
+fou_del_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &fou_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void> fou_del_ex(ynl_cpp::ynl_socket&  ys, fou_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, FOU_CMD_DEL, 1);
+	fou_del_put(nlh, req);
+
+	return fou_del_exec(ys, nlh);
+}
+
+int fou_del(ynl_cpp::ynl_socket&  ys, fou_del_req& req)
+{
+	auto ret = fou_del_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+fou_del_prepare(ynl_cpp::ynl_socket&  ys, fou_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, FOU_CMD_DEL, 1);
+	fou_del_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+fou_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return fou_del_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int fou_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = fou_del_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+fou_del_batch(ynl_cpp::msg_batch& batch, fou_del_req& req)
+{
+	struct nlmsghdr *nlh;
 
-	return 0;
+	nlh = batch.gemsg_start(FOU_CMD_DEL, 1);
+	fou_del_put(nlh, req);
+	return batch.msg_end(nlh, &fou_nest);
 }
 
 /* ============== FOU_CMD_GET ============== */
@@ -154,48 +260,46 @@ int fou_get_rsp_parse(const struct nlmsghdr *nlh, struct ynl_parse_arg *yarg)
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == FOU_ATTR_PORT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->port = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == FOU_ATTR_IPPROTO) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->ipproto = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == FOU_ATTR_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->type = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == FOU_ATTR_REMCSUM_NOPARTIAL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->remcsum_nopartial = true;
 		} else if (type == FOU_ATTR_LOCAL_V4) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->local_v4 = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == FOU_ATTR_PEER_V4) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->peer_v4 = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == FOU_ATTR_LOCAL_V6) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->local_v6.assign(data, data + len);
 		} else if (type == FOU_ATTR_PEER_V6) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->peer_v6.assign(data, data + len);
 		} else if (type == FOU_ATTR_PEER_PORT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->peer_port = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == FOU_ATTR_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
 			dst->ifindex = (__s32)ynl_attr_get_s32(attr);
 		}
 	}
@@ -203,71 +307,142 @@ int fou_get_rsp_parse(const struct nlmsghdr *nlh, struct ynl_parse_arg *yarg)
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<fou_get_rsp>
-fou_get(ynl_cpp::ynl_socket&  ys, fou_get_req& req)
+static void fou_get_put(struct nlmsghdr *nlh, fou_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<fou_get_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, FOU_CMD_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &fou_nest;
-	yrs.yarg.rsp_policy = &fou_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 48 <= YNL_SOCKET_BUFFER_SIZE);
 
 	if (req.af.has_value())
-		ynl_attr_put_u8(nlh, FOU_ATTR_AF, req.af.value());
+		ynl_attr_put_u8_unchecked(nlh, FOU_ATTR_AF, req.af.value());
 	if (req.ifindex.has_value())
-		ynl_attr_put_s32(nlh, FOU_ATTR_IFINDEX, req.ifindex.value());
+		ynl_attr_put_s32_unchecked(nlh, FOU_ATTR_IFINDEX, req.ifindex.value());
 	if (req.port.has_value())
-		ynl_attr_put_u16(nlh, FOU_ATTR_PORT, req.port.value());
+		ynl_attr_put_u16_unchecked(nlh, FOU_ATTR_PORT, req.port.value());
 	if (req.peer_port.has_value())
-		ynl_attr_put_u16(nlh, FOU_ATTR_PEER_PORT, req.peer_port.value());
+		ynl_attr_put_u16_unchecked(nlh, FOU_ATTR_PEER_PORT, req.peer_port.value());
 	if (req.local_v4.has_value())
-		ynl_attr_put_u32(nlh, FOU_ATTR_LOCAL_V4, req.local_v4.value());
+		ynl_attr_put_u32_unchecked(nlh, FOU_ATTR_LOCAL_V4, req.local_v4.value());
 	if (req.peer_v4.has_value())
-		ynl_attr_put_u32(nlh, FOU_ATTR_PEER_V4, req.peer_v4.value());
+		ynl_attr_put_u32_unchecked(nlh, FOU_ATTR_PEER_V4, req.peer_v4.value());
 	if (req.local_v6.size() > 0)
 		ynl_attr_put(nlh, FOU_ATTR_LOCAL_V6, req.local_v6.data(), req.local_v6.size());
 	if (req.peer_v6.size() > 0)
 		ynl_attr_put(nlh, FOU_ATTR_PEER_V6, req.peer_v6.data(), req.peer_v6.size());
+}
+
+static ynl_cpp::result<std::unique_ptr<fou_get_rsp>>
+fou_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+	     const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<fou_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &fou_nest;
+	yrs.yarg.rsp_policy = &fou_nest;
 
 	rsp.reset(new fou_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = fou_get_rsp_parse;
 	yrs.rsp_cmd = FOU_CMD_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<fou_get_rsp>>
+fou_get_ex(ynl_cpp::ynl_socket&  ys, fou_get_req& req,
+	   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, FOU_CMD_GET, 1);
+	fou_get_put(nlh, req);
+
+	return fou_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<fou_get_rsp>
+fou_get(ynl_cpp::ynl_socket&  ys, fou_get_req& req)
+{
+	auto ret = fou_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+fou_get_prepare(ynl_cpp::ynl_socket&  ys, fou_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, FOU_CMD_GET, 1);
+	fou_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<fou_get_rsp>>
+fou_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	   const ynl_cpp::projection *proj)
+{
+	return fou_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<fou_get_rsp>
+fou_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = fou_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* FOU_CMD_GET - dump */
-std::unique_ptr<fou_get_list> fou_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<fou_get_list>>
+fou_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		  const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<fou_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &fou_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<fou_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = fou_get_rsp_parse;
 	yds.rsp_cmd = FOU_CMD_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, FOU_CMD_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<fou_get_list>>
+fou_get_dump_ex(ynl_cpp::ynl_socket&  ys, const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, FOU_CMD_GET, 1);
+
+	return fou_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<fou_get_list> fou_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = fou_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 const struct ynl_family ynl_fou_family =  {
 	.name		= "fou",
 	.hdr_len	= sizeof(struct genlmsghdr),
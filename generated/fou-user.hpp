@@ -29,6 +29,9 @@ std::string_view fou_op_str(int op);
 std::string_view fou_encap_type_str(int value);
 
 /* Common nested types */
+/* Policies and nested encoders */
+extern struct ynl_policy_nest fou_nest;
+
 /* ============== FOU_CMD_ADD ============== */
 /* FOU_CMD_ADD - do */
 struct fou_add_req {
@@ -48,6 +51,14 @@ struct fou_add_req {
  * Add port.
  */
 int fou_add(ynl_cpp::ynl_socket&  ys, fou_add_req& req);
+ynl_cpp::result<void> fou_add_ex(ynl_cpp::ynl_socket&  ys, fou_add_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+fou_add_prepare(ynl_cpp::ynl_socket&  ys, fou_add_req& req);
+int fou_add(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+fou_add_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+fou_add_batch(ynl_cpp::msg_batch& batch, fou_add_req& req);
 
 /* ============== FOU_CMD_DEL ============== */
 /* FOU_CMD_DEL - do */
@@ -66,6 +77,14 @@ struct fou_del_req {
  * Delete port.
  */
 int fou_del(ynl_cpp::ynl_socket&  ys, fou_del_req& req);
+ynl_cpp::result<void> fou_del_ex(ynl_cpp::ynl_socket&  ys, fou_del_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+fou_del_prepare(ynl_cpp::ynl_socket&  ys, fou_del_req& req);
+int fou_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+fou_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+fou_del_batch(ynl_cpp::msg_batch& batch, fou_del_req& req);
 
 /* ============== FOU_CMD_GET ============== */
 /* FOU_CMD_GET - do */
@@ -98,6 +117,16 @@ struct fou_get_rsp {
  */
 std::unique_ptr<fou_get_rsp>
 fou_get(ynl_cpp::ynl_socket&  ys, fou_get_req& req);
+ynl_cpp::result<std::unique_ptr<fou_get_rsp>>
+fou_get_ex(ynl_cpp::ynl_socket&  ys, fou_get_req& req,
+	   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+fou_get_prepare(ynl_cpp::ynl_socket&  ys, fou_get_req& req);
+std::unique_ptr<fou_get_rsp>
+fou_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<fou_get_rsp>>
+fou_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	   const ynl_cpp::projection *proj = nullptr);
 
 /* FOU_CMD_GET - dump */
 struct fou_get_list {
@@ -105,6 +134,9 @@ struct fou_get_list {
 };
 
 std::unique_ptr<fou_get_list> fou_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<fou_get_list>>
+fou_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		const ynl_cpp::projection *proj = nullptr);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_FOU_GEN_H */
@@ -130,12 +130,12 @@ int handshake_x509_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == HANDSHAKE_A_X509_CERT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
 			dst->cert = (__s32)ynl_attr_get_s32(attr);
 		} else if (type == HANDSHAKE_A_X509_PRIVKEY) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
 			dst->privkey = (__s32)ynl_attr_get_s32(attr);
 		}
 	}
@@ -166,30 +166,33 @@ int handshake_accept_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == HANDSHAKE_A_ACCEPT_SOCKFD) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
 			dst->sockfd = (__s32)ynl_attr_get_s32(attr);
 		} else if (type == HANDSHAKE_A_ACCEPT_MESSAGE_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->message_type = (handshake_msg_type)ynl_attr_get_u32(attr);
 		} else if (type == HANDSHAKE_A_ACCEPT_TIMEOUT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->timeout = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == HANDSHAKE_A_ACCEPT_AUTH_MODE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->auth_mode = (handshake_auth)ynl_attr_get_u32(attr);
 		} else if (type == HANDSHAKE_A_ACCEPT_PEER_IDENTITY) {
 			n_peer_identity++;
 		} else if (type == HANDSHAKE_A_ACCEPT_CERTIFICATE) {
 			n_certificate++;
 		} else if (type == HANDSHAKE_A_ACCEPT_PEERNAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->peername.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->peername.assign(ynl_attr_get_str(attr));
 		}
 	}
 
@@ -220,57 +223,180 @@ int handshake_accept_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<handshake_accept_rsp>
-handshake_accept(ynl_cpp::ynl_socket&  ys, handshake_accept_req& req)
+static void
+handshake_accept_put(struct nlmsghdr *nlh, handshake_accept_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.handler_class.has_value())
+		ynl_attr_put_u32_unchecked(nlh, HANDSHAKE_A_ACCEPT_HANDLER_CLASS, req.handler_class.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<handshake_accept_rsp>>
+handshake_accept_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<handshake_accept_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, HANDSHAKE_CMD_ACCEPT, 1);
 	((struct ynl_sock*)ys)->req_policy = &handshake_accept_nest;
 	yrs.yarg.rsp_policy = &handshake_accept_nest;
 
-	if (req.handler_class.has_value())
-		ynl_attr_put_u32(nlh, HANDSHAKE_A_ACCEPT_HANDLER_CLASS, req.handler_class.value());
-
 	rsp.reset(new handshake_accept_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = handshake_accept_rsp_parse;
 	yrs.rsp_cmd = HANDSHAKE_CMD_ACCEPT;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<handshake_accept_rsp>>
+handshake_accept_ex(ynl_cpp::ynl_socket&  ys, handshake_accept_req& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, HANDSHAKE_CMD_ACCEPT, 1);
+	handshake_accept_put(nlh, req);
+
+	return handshake_accept_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<handshake_accept_rsp>
+handshake_accept(ynl_cpp::ynl_socket&  ys, handshake_accept_req& req)
+{
+	auto ret = handshake_accept_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+handshake_accept_prepare(ynl_cpp::ynl_socket&  ys, handshake_accept_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, HANDSHAKE_CMD_ACCEPT, 1);
+	handshake_accept_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<handshake_accept_rsp>>
+handshake_accept_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return handshake_accept_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<handshake_accept_rsp>
+handshake_accept(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = handshake_accept_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* HANDSHAKE_CMD_ACCEPT - notify */
+static_assert(ynl_cpp::ntf_layout_matches<handshake_accept_ntf>());
+
+static void *handshake_accept_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) handshake_accept_ntf())->obj;
+}
+
+static void handshake_accept_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	handshake_accept_ntf *rsp = (handshake_accept_ntf *)ntf;
+
+	rsp->~handshake_accept_ntf();
+	::free(rsp);
+}
+
 /* ============== HANDSHAKE_CMD_DONE ============== */
 /* HANDSHAKE_CMD_DONE - do */
-int handshake_done(ynl_cpp::ynl_socket&  ys, handshake_done_req& req)
+static void handshake_done_put(struct nlmsghdr *nlh, handshake_done_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, HANDSHAKE_CMD_DONE, 1);
-	((struct ynl_sock*)ys)->req_policy = &handshake_done_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
 
 	if (req.status.has_value())
-		ynl_attr_put_u32(nlh, HANDSHAKE_A_DONE_STATUS, req.status.value());
+		ynl_attr_put_u32_unchecked(nlh, HANDSHAKE_A_DONE_STATUS, req.status.value());
 	if (req.sockfd.has_value())
-		ynl_attr_put_s32(nlh, HANDSHAKE_A_DONE_SOCKFD, req.sockfd.value());
+		ynl_attr_put_s32_unchecked(nlh, HANDSHAKE_A_DONE_SOCKFD, req.sockfd.value());
 	for (unsigned int i = 0; i < req.remote_auth.size(); i++)
 		ynl_attr_put_u32(nlh, HANDSHAKE_A_DONE_REMOTE_AUTH, req.remote_auth[i]);
+}
+
+static ynl_cpp::result<void>
+handshake_done_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &handshake_done_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+handshake_done_ex(ynl_cpp::ynl_socket&  ys, handshake_done_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, HANDSHAKE_CMD_DONE, 1);
+	handshake_done_put(nlh, req);
+
+	return handshake_done_exec(ys, nlh);
+}
+
+int handshake_done(ynl_cpp::ynl_socket&  ys, handshake_done_req& req)
+{
+	auto ret = handshake_done_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+handshake_done_prepare(ynl_cpp::ynl_socket&  ys, handshake_done_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, HANDSHAKE_CMD_DONE, 1);
+	handshake_done_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+handshake_done_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return handshake_done_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int handshake_done(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = handshake_done_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+handshake_done_batch(ynl_cpp::msg_batch& batch, handshake_done_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(HANDSHAKE_CMD_DONE, 1);
+	handshake_done_put(nlh, req);
+	return batch.msg_end(nlh, &handshake_done_nest);
 }
 
 static constexpr std::array<ynl_ntf_info, HANDSHAKE_CMD_READY + 1> handshake_ntf_info = []() {
@@ -278,6 +404,9 @@ static constexpr std::array<ynl_ntf_info, HANDSHAKE_CMD_READY + 1> handshake_ntf
 	arr[HANDSHAKE_CMD_READY] =  {
 		.cb		= handshake_accept_rsp_parse,
 		.policy		= &handshake_accept_nest,
+		.alloc_sz	= sizeof(handshake_accept_ntf),
+		.free		= handshake_accept_ntf_free,
+		.init		= handshake_accept_ntf_init,
 	};
 	return arr;
 } ();
@@ -36,12 +36,20 @@ struct handshake_x509 {
 	std::optional<__s32> privkey;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest handshake_x509_nest;
+extern struct ynl_policy_nest handshake_accept_nest;
+extern struct ynl_policy_nest handshake_done_nest;
+
 /* ============== HANDSHAKE_CMD_ACCEPT ============== */
 /* HANDSHAKE_CMD_ACCEPT - do */
 struct handshake_accept_req {
 	std::optional<handshake_handler_class> handler_class;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t handshake_accept_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct handshake_accept_rsp {
 	std::optional<__s32> sockfd;
 	std::optional<handshake_msg_type> message_type;
@@ -57,9 +65,25 @@ struct handshake_accept_rsp {
  */
 std::unique_ptr<handshake_accept_rsp>
 handshake_accept(ynl_cpp::ynl_socket&  ys, handshake_accept_req& req);
+ynl_cpp::result<std::unique_ptr<handshake_accept_rsp>>
+handshake_accept_ex(ynl_cpp::ynl_socket&  ys, handshake_accept_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+handshake_accept_prepare(ynl_cpp::ynl_socket&  ys, handshake_accept_req& req);
+std::unique_ptr<handshake_accept_rsp>
+handshake_accept(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<handshake_accept_rsp>>
+handshake_accept_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* HANDSHAKE_CMD_ACCEPT - notify */
 struct handshake_accept_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	handshake_accept_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== HANDSHAKE_CMD_DONE ============== */
@@ -74,6 +98,15 @@ struct handshake_done_req {
  * Handler reports handshake completion
  */
 int handshake_done(ynl_cpp::ynl_socket&  ys, handshake_done_req& req);
+ynl_cpp::result<void>
+handshake_done_ex(ynl_cpp::ynl_socket&  ys, handshake_done_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+handshake_done_prepare(ynl_cpp::ynl_socket&  ys, handshake_done_req& req);
+int handshake_done(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+handshake_done_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+handshake_done_batch(ynl_cpp::msg_batch& batch, handshake_done_req& req);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_HANDSHAKE_GEN_H */
@@ -143,34 +143,32 @@ int mptcp_pm_address_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == MPTCP_PM_ADDR_ATTR_FAMILY) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->family = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == MPTCP_PM_ADDR_ATTR_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->id = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == MPTCP_PM_ADDR_ATTR_ADDR4) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->addr4 = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == MPTCP_PM_ADDR_ATTR_ADDR6) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->addr6.assign(data, data + len);
 		} else if (type == MPTCP_PM_ADDR_ATTR_PORT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->port = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == MPTCP_PM_ADDR_ATTR_FLAGS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->flags = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == MPTCP_PM_ADDR_ATTR_IF_IDX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
 			dst->if_idx = (__s32)ynl_attr_get_s32(attr);
 		}
 	}
@@ -180,44 +178,152 @@ int mptcp_pm_address_parse(struct ynl_parse_arg *yarg,
 
 /* ============== MPTCP_PM_CMD_ADD_ADDR ============== */
 /* MPTCP_PM_CMD_ADD_ADDR - do */
-int mptcp_pm_add_addr(ynl_cpp::ynl_socket&  ys, mptcp_pm_add_addr_req& req)
+static void
+mptcp_pm_add_addr_put(struct nlmsghdr *nlh, mptcp_pm_add_addr_req& req)
+{
+	if (req.addr.has_value())
+		mptcp_pm_address_put(nlh, MPTCP_PM_ENDPOINT_ADDR, req.addr.value());
+}
+
+static ynl_cpp::result<void>
+mptcp_pm_add_addr_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_ADD_ADDR, 1);
 	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_endpoint_nest;
 
-	if (req.addr.has_value())
-		mptcp_pm_address_put(nlh, MPTCP_PM_ENDPOINT_ADDR, req.addr.value());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+mptcp_pm_add_addr_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_add_addr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_ADD_ADDR, 1);
+	mptcp_pm_add_addr_put(nlh, req);
+
+	return mptcp_pm_add_addr_exec(ys, nlh);
+}
+
+int mptcp_pm_add_addr(ynl_cpp::ynl_socket&  ys, mptcp_pm_add_addr_req& req)
+{
+	auto ret = mptcp_pm_add_addr_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_add_addr_prepare(ynl_cpp::ynl_socket&  ys, mptcp_pm_add_addr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_ADD_ADDR, 1);
+	mptcp_pm_add_addr_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+mptcp_pm_add_addr_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return mptcp_pm_add_addr_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int mptcp_pm_add_addr(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = mptcp_pm_add_addr_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+mptcp_pm_add_addr_batch(ynl_cpp::msg_batch& batch, mptcp_pm_add_addr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(MPTCP_PM_CMD_ADD_ADDR, 1);
+	mptcp_pm_add_addr_put(nlh, req);
+	return batch.msg_end(nlh, &mptcp_pm_endpoint_nest);
 }
 
 /* ============== MPTCP_PM_CMD_DEL_ADDR ============== */
 /* MPTCP_PM_CMD_DEL_ADDR - do */
-int mptcp_pm_del_addr(ynl_cpp::ynl_socket&  ys, mptcp_pm_del_addr_req& req)
+static void
+mptcp_pm_del_addr_put(struct nlmsghdr *nlh, mptcp_pm_del_addr_req& req)
+{
+	if (req.addr.has_value())
+		mptcp_pm_address_put(nlh, MPTCP_PM_ENDPOINT_ADDR, req.addr.value());
+}
+
+static ynl_cpp::result<void>
+mptcp_pm_del_addr_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_DEL_ADDR, 1);
 	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_endpoint_nest;
 
-	if (req.addr.has_value())
-		mptcp_pm_address_put(nlh, MPTCP_PM_ENDPOINT_ADDR, req.addr.value());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+mptcp_pm_del_addr_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_del_addr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_DEL_ADDR, 1);
+	mptcp_pm_del_addr_put(nlh, req);
+
+	return mptcp_pm_del_addr_exec(ys, nlh);
+}
+
+int mptcp_pm_del_addr(ynl_cpp::ynl_socket&  ys, mptcp_pm_del_addr_req& req)
+{
+	auto ret = mptcp_pm_del_addr_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_del_addr_prepare(ynl_cpp::ynl_socket&  ys, mptcp_pm_del_addr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_DEL_ADDR, 1);
+	mptcp_pm_del_addr_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+mptcp_pm_del_addr_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return mptcp_pm_del_addr_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int mptcp_pm_del_addr(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = mptcp_pm_del_addr_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+mptcp_pm_del_addr_batch(ynl_cpp::msg_batch& batch, mptcp_pm_del_addr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(MPTCP_PM_CMD_DEL_ADDR, 1);
+	mptcp_pm_del_addr_put(nlh, req);
+	return batch.msg_end(nlh, &mptcp_pm_endpoint_nest);
 }
 
 /* ============== MPTCP_PM_CMD_GET_ADDR ============== */
@@ -235,12 +341,15 @@ int mptcp_pm_get_addr_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == MPTCP_PM_ATTR_ADDR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &mptcp_pm_address_nest;
-			parg.data = &dst->addr;
+			parg.data = &dst->addr.emplace();
 			if (mptcp_pm_address_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -249,103 +358,293 @@ int mptcp_pm_get_addr_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<mptcp_pm_get_addr_rsp>
-mptcp_pm_get_addr(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_addr_req& req)
+static void
+mptcp_pm_get_addr_put(struct nlmsghdr *nlh, mptcp_pm_get_addr_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.token.has_value())
+		ynl_attr_put_u32_unchecked(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
+	if (req.addr.has_value())
+		mptcp_pm_address_put(nlh, MPTCP_PM_ATTR_ADDR, req.addr.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<mptcp_pm_get_addr_rsp>>
+mptcp_pm_get_addr_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<mptcp_pm_get_addr_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_GET_ADDR, 1);
 	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_attr_nest;
 	yrs.yarg.rsp_policy = &mptcp_pm_attr_nest;
 
-	if (req.addr.has_value())
-		mptcp_pm_address_put(nlh, MPTCP_PM_ATTR_ADDR, req.addr.value());
-	if (req.token.has_value())
-		ynl_attr_put_u32(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
-
 	rsp.reset(new mptcp_pm_get_addr_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = mptcp_pm_get_addr_rsp_parse;
 	yrs.rsp_cmd = MPTCP_PM_CMD_GET_ADDR;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<mptcp_pm_get_addr_rsp>>
+mptcp_pm_get_addr_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_addr_req& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_GET_ADDR, 1);
+	mptcp_pm_get_addr_put(nlh, req);
+
+	return mptcp_pm_get_addr_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<mptcp_pm_get_addr_rsp>
+mptcp_pm_get_addr(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_addr_req& req)
+{
+	auto ret = mptcp_pm_get_addr_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_get_addr_prepare(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_addr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_GET_ADDR, 1);
+	mptcp_pm_get_addr_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<mptcp_pm_get_addr_rsp>>
+mptcp_pm_get_addr_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return mptcp_pm_get_addr_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<mptcp_pm_get_addr_rsp>
+mptcp_pm_get_addr(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = mptcp_pm_get_addr_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* MPTCP_PM_CMD_GET_ADDR - dump */
-std::unique_ptr<mptcp_pm_get_addr_list>
-mptcp_pm_get_addr_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<mptcp_pm_get_addr_list>>
+mptcp_pm_get_addr_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<mptcp_pm_get_addr_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &mptcp_pm_attr_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<mptcp_pm_get_addr_list*>(arg)->objs.emplace_back());};
 	yds.cb = mptcp_pm_get_addr_rsp_parse;
 	yds.rsp_cmd = MPTCP_PM_CMD_GET_ADDR;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_GET_ADDR, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<mptcp_pm_get_addr_list>>
+mptcp_pm_get_addr_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_GET_ADDR, 1);
+
+	return mptcp_pm_get_addr_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<mptcp_pm_get_addr_list>
+mptcp_pm_get_addr_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = mptcp_pm_get_addr_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== MPTCP_PM_CMD_FLUSH_ADDRS ============== */
 /* MPTCP_PM_CMD_FLUSH_ADDRS - do */
-int mptcp_pm_flush_addrs(ynl_cpp::ynl_socket&  ys,
-			 mptcp_pm_flush_addrs_req& req)
+static void
+mptcp_pm_flush_addrs_put(struct nlmsghdr *nlh, mptcp_pm_flush_addrs_req& req)
+{
+	if (req.addr.has_value())
+		mptcp_pm_address_put(nlh, MPTCP_PM_ENDPOINT_ADDR, req.addr.value());
+}
+
+static ynl_cpp::result<void>
+mptcp_pm_flush_addrs_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_FLUSH_ADDRS, 1);
 	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_endpoint_nest;
 
-	if (req.addr.has_value())
-		mptcp_pm_address_put(nlh, MPTCP_PM_ENDPOINT_ADDR, req.addr.value());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+mptcp_pm_flush_addrs_ex(ynl_cpp::ynl_socket&  ys,
+			mptcp_pm_flush_addrs_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_FLUSH_ADDRS, 1);
+	mptcp_pm_flush_addrs_put(nlh, req);
+
+	return mptcp_pm_flush_addrs_exec(ys, nlh);
+}
+
+int mptcp_pm_flush_addrs(ynl_cpp::ynl_socket&  ys,
+			 mptcp_pm_flush_addrs_req& req)
+{
+	auto ret = mptcp_pm_flush_addrs_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_flush_addrs_prepare(ynl_cpp::ynl_socket&  ys,
+			     mptcp_pm_flush_addrs_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_FLUSH_ADDRS, 1);
+	mptcp_pm_flush_addrs_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+mptcp_pm_flush_addrs_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	return mptcp_pm_flush_addrs_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int mptcp_pm_flush_addrs(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = mptcp_pm_flush_addrs_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+mptcp_pm_flush_addrs_batch(ynl_cpp::msg_batch& batch,
+			   mptcp_pm_flush_addrs_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(MPTCP_PM_CMD_FLUSH_ADDRS, 1);
+	mptcp_pm_flush_addrs_put(nlh, req);
+	return batch.msg_end(nlh, &mptcp_pm_endpoint_nest);
 }
 
 /* ============== MPTCP_PM_CMD_SET_LIMITS ============== */
 /* MPTCP_PM_CMD_SET_LIMITS - do */
-int mptcp_pm_set_limits(ynl_cpp::ynl_socket&  ys, mptcp_pm_set_limits_req& req)
+static void
+mptcp_pm_set_limits_put(struct nlmsghdr *nlh, mptcp_pm_set_limits_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.rcv_add_addrs.has_value())
+		ynl_attr_put_u32_unchecked(nlh, MPTCP_PM_ATTR_RCV_ADD_ADDRS, req.rcv_add_addrs.value());
+	if (req.subflows.has_value())
+		ynl_attr_put_u32_unchecked(nlh, MPTCP_PM_ATTR_SUBFLOWS, req.subflows.value());
+}
+
+static ynl_cpp::result<void>
+mptcp_pm_set_limits_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SET_LIMITS, 1);
 	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_attr_nest;
 
-	if (req.rcv_add_addrs.has_value())
-		ynl_attr_put_u32(nlh, MPTCP_PM_ATTR_RCV_ADD_ADDRS, req.rcv_add_addrs.value());
-	if (req.subflows.has_value())
-		ynl_attr_put_u32(nlh, MPTCP_PM_ATTR_SUBFLOWS, req.subflows.value());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+mptcp_pm_set_limits_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_set_limits_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SET_LIMITS, 1);
+	mptcp_pm_set_limits_put(nlh, req);
+
+	return mptcp_pm_set_limits_exec(ys, nlh);
+}
+
+int mptcp_pm_set_limits(ynl_cpp::ynl_socket&  ys, mptcp_pm_set_limits_req& req)
+{
+	auto ret = mptcp_pm_set_limits_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_set_limits_prepare(ynl_cpp::ynl_socket&  ys,
+			    mptcp_pm_set_limits_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SET_LIMITS, 1);
+	mptcp_pm_set_limits_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+mptcp_pm_set_limits_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	return mptcp_pm_set_limits_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int mptcp_pm_set_limits(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = mptcp_pm_set_limits_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+mptcp_pm_set_limits_batch(ynl_cpp::msg_batch& batch,
+			  mptcp_pm_set_limits_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(MPTCP_PM_CMD_SET_LIMITS, 1);
+	mptcp_pm_set_limits_put(nlh, req);
+	return batch.msg_end(nlh, &mptcp_pm_attr_nest);
 }
 
 /* ============== MPTCP_PM_CMD_GET_LIMITS ============== */
@@ -361,13 +660,16 @@ int mptcp_pm_get_limits_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == MPTCP_PM_ATTR_RCV_ADD_ADDRS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rcv_add_addrs = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == MPTCP_PM_ATTR_SUBFLOWS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->subflows = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -375,156 +677,503 @@ int mptcp_pm_get_limits_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<mptcp_pm_get_limits_rsp>
-mptcp_pm_get_limits(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_limits_req& req)
+static void
+mptcp_pm_get_limits_put(struct nlmsghdr *nlh, mptcp_pm_get_limits_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.rcv_add_addrs.has_value())
+		ynl_attr_put_u32_unchecked(nlh, MPTCP_PM_ATTR_RCV_ADD_ADDRS, req.rcv_add_addrs.value());
+	if (req.subflows.has_value())
+		ynl_attr_put_u32_unchecked(nlh, MPTCP_PM_ATTR_SUBFLOWS, req.subflows.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<mptcp_pm_get_limits_rsp>>
+mptcp_pm_get_limits_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			 const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<mptcp_pm_get_limits_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_GET_LIMITS, 1);
 	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_attr_nest;
 	yrs.yarg.rsp_policy = &mptcp_pm_attr_nest;
 
-	if (req.rcv_add_addrs.has_value())
-		ynl_attr_put_u32(nlh, MPTCP_PM_ATTR_RCV_ADD_ADDRS, req.rcv_add_addrs.value());
-	if (req.subflows.has_value())
-		ynl_attr_put_u32(nlh, MPTCP_PM_ATTR_SUBFLOWS, req.subflows.value());
-
 	rsp.reset(new mptcp_pm_get_limits_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = mptcp_pm_get_limits_rsp_parse;
 	yrs.rsp_cmd = MPTCP_PM_CMD_GET_LIMITS;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* ============== MPTCP_PM_CMD_SET_FLAGS ============== */
-/* MPTCP_PM_CMD_SET_FLAGS - do */
-int mptcp_pm_set_flags(ynl_cpp::ynl_socket&  ys, mptcp_pm_set_flags_req& req)
+ynl_cpp::result<std::unique_ptr<mptcp_pm_get_limits_rsp>>
+mptcp_pm_get_limits_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_limits_req& req,
+		       const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SET_FLAGS, 1);
-	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_attr_nest;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_GET_LIMITS, 1);
+	mptcp_pm_get_limits_put(nlh, req);
+
+	return mptcp_pm_get_limits_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<mptcp_pm_get_limits_rsp>
+mptcp_pm_get_limits(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_limits_req& req)
+{
+	auto ret = mptcp_pm_get_limits_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
 
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_get_limits_prepare(ynl_cpp::ynl_socket&  ys,
+			    mptcp_pm_get_limits_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_GET_LIMITS, 1);
+	mptcp_pm_get_limits_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<mptcp_pm_get_limits_rsp>>
+mptcp_pm_get_limits_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj)
+{
+	return mptcp_pm_get_limits_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<mptcp_pm_get_limits_rsp>
+mptcp_pm_get_limits(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = mptcp_pm_get_limits_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== MPTCP_PM_CMD_SET_FLAGS ============== */
+/* MPTCP_PM_CMD_SET_FLAGS - do */
+static void
+mptcp_pm_set_flags_put(struct nlmsghdr *nlh, mptcp_pm_set_flags_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.token.has_value())
+		ynl_attr_put_u32_unchecked(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
 	if (req.addr.has_value())
 		mptcp_pm_address_put(nlh, MPTCP_PM_ATTR_ADDR, req.addr.value());
-	if (req.token.has_value())
-		ynl_attr_put_u32(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
 	if (req.addr_remote.has_value())
 		mptcp_pm_address_put(nlh, MPTCP_PM_ATTR_ADDR_REMOTE, req.addr_remote.value());
+}
+
+static ynl_cpp::result<void>
+mptcp_pm_set_flags_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_attr_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+mptcp_pm_set_flags_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_set_flags_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SET_FLAGS, 1);
+	mptcp_pm_set_flags_put(nlh, req);
+
+	return mptcp_pm_set_flags_exec(ys, nlh);
+}
+
+int mptcp_pm_set_flags(ynl_cpp::ynl_socket&  ys, mptcp_pm_set_flags_req& req)
+{
+	auto ret = mptcp_pm_set_flags_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_set_flags_prepare(ynl_cpp::ynl_socket&  ys,
+			   mptcp_pm_set_flags_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SET_FLAGS, 1);
+	mptcp_pm_set_flags_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+mptcp_pm_set_flags_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	return mptcp_pm_set_flags_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int mptcp_pm_set_flags(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = mptcp_pm_set_flags_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+mptcp_pm_set_flags_batch(ynl_cpp::msg_batch& batch,
+			 mptcp_pm_set_flags_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(MPTCP_PM_CMD_SET_FLAGS, 1);
+	mptcp_pm_set_flags_put(nlh, req);
+	return batch.msg_end(nlh, &mptcp_pm_attr_nest);
 }
 
 /* ============== MPTCP_PM_CMD_ANNOUNCE ============== */
 /* MPTCP_PM_CMD_ANNOUNCE - do */
-int mptcp_pm_announce(ynl_cpp::ynl_socket&  ys, mptcp_pm_announce_req& req)
+static void
+mptcp_pm_announce_put(struct nlmsghdr *nlh, mptcp_pm_announce_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.token.has_value())
+		ynl_attr_put_u32_unchecked(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
+	if (req.addr.has_value())
+		mptcp_pm_address_put(nlh, MPTCP_PM_ATTR_ADDR, req.addr.value());
+}
+
+static ynl_cpp::result<void>
+mptcp_pm_announce_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_ANNOUNCE, 1);
 	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_attr_nest;
 
-	if (req.addr.has_value())
-		mptcp_pm_address_put(nlh, MPTCP_PM_ATTR_ADDR, req.addr.value());
-	if (req.token.has_value())
-		ynl_attr_put_u32(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+mptcp_pm_announce_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_announce_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_ANNOUNCE, 1);
+	mptcp_pm_announce_put(nlh, req);
+
+	return mptcp_pm_announce_exec(ys, nlh);
+}
+
+int mptcp_pm_announce(ynl_cpp::ynl_socket&  ys, mptcp_pm_announce_req& req)
+{
+	auto ret = mptcp_pm_announce_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_announce_prepare(ynl_cpp::ynl_socket&  ys, mptcp_pm_announce_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_ANNOUNCE, 1);
+	mptcp_pm_announce_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+mptcp_pm_announce_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return mptcp_pm_announce_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int mptcp_pm_announce(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = mptcp_pm_announce_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+mptcp_pm_announce_batch(ynl_cpp::msg_batch& batch, mptcp_pm_announce_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(MPTCP_PM_CMD_ANNOUNCE, 1);
+	mptcp_pm_announce_put(nlh, req);
+	return batch.msg_end(nlh, &mptcp_pm_attr_nest);
 }
 
 /* ============== MPTCP_PM_CMD_REMOVE ============== */
 /* MPTCP_PM_CMD_REMOVE - do */
-int mptcp_pm_remove(ynl_cpp::ynl_socket&  ys, mptcp_pm_remove_req& req)
+static void mptcp_pm_remove_put(struct nlmsghdr *nlh, mptcp_pm_remove_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.token.has_value())
+		ynl_attr_put_u32_unchecked(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
+	if (req.loc_id.has_value())
+		ynl_attr_put_u8_unchecked(nlh, MPTCP_PM_ATTR_LOC_ID, req.loc_id.value());
+}
+
+static ynl_cpp::result<void>
+mptcp_pm_remove_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_REMOVE, 1);
 	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_attr_nest;
 
-	if (req.token.has_value())
-		ynl_attr_put_u32(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
-	if (req.loc_id.has_value())
-		ynl_attr_put_u8(nlh, MPTCP_PM_ATTR_LOC_ID, req.loc_id.value());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+mptcp_pm_remove_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_remove_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_REMOVE, 1);
+	mptcp_pm_remove_put(nlh, req);
+
+	return mptcp_pm_remove_exec(ys, nlh);
+}
+
+int mptcp_pm_remove(ynl_cpp::ynl_socket&  ys, mptcp_pm_remove_req& req)
+{
+	auto ret = mptcp_pm_remove_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_remove_prepare(ynl_cpp::ynl_socket&  ys, mptcp_pm_remove_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_REMOVE, 1);
+	mptcp_pm_remove_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+mptcp_pm_remove_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return mptcp_pm_remove_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int mptcp_pm_remove(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = mptcp_pm_remove_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+mptcp_pm_remove_batch(ynl_cpp::msg_batch& batch, mptcp_pm_remove_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(MPTCP_PM_CMD_REMOVE, 1);
+	mptcp_pm_remove_put(nlh, req);
+	return batch.msg_end(nlh, &mptcp_pm_attr_nest);
 }
 
 /* ============== MPTCP_PM_CMD_SUBFLOW_CREATE ============== */
 /* MPTCP_PM_CMD_SUBFLOW_CREATE - do */
-int mptcp_pm_subflow_create(ynl_cpp::ynl_socket&  ys,
+static void
+mptcp_pm_subflow_create_put(struct nlmsghdr *nlh,
 			    mptcp_pm_subflow_create_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SUBFLOW_CREATE, 1);
-	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_attr_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.token.has_value())
+		ynl_attr_put_u32_unchecked(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
 	if (req.addr.has_value())
 		mptcp_pm_address_put(nlh, MPTCP_PM_ATTR_ADDR, req.addr.value());
-	if (req.token.has_value())
-		ynl_attr_put_u32(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
 	if (req.addr_remote.has_value())
 		mptcp_pm_address_put(nlh, MPTCP_PM_ATTR_ADDR_REMOTE, req.addr_remote.value());
+}
+
+static ynl_cpp::result<void>
+mptcp_pm_subflow_create_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_attr_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+mptcp_pm_subflow_create_ex(ynl_cpp::ynl_socket&  ys,
+			   mptcp_pm_subflow_create_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SUBFLOW_CREATE, 1);
+	mptcp_pm_subflow_create_put(nlh, req);
+
+	return mptcp_pm_subflow_create_exec(ys, nlh);
+}
+
+int mptcp_pm_subflow_create(ynl_cpp::ynl_socket&  ys,
+			    mptcp_pm_subflow_create_req& req)
+{
+	auto ret = mptcp_pm_subflow_create_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_subflow_create_prepare(ynl_cpp::ynl_socket&  ys,
+				mptcp_pm_subflow_create_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SUBFLOW_CREATE, 1);
+	mptcp_pm_subflow_create_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+mptcp_pm_subflow_create_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl)
+{
+	return mptcp_pm_subflow_create_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int mptcp_pm_subflow_create(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl)
+{
+	auto ret = mptcp_pm_subflow_create_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+mptcp_pm_subflow_create_batch(ynl_cpp::msg_batch& batch,
+			      mptcp_pm_subflow_create_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(MPTCP_PM_CMD_SUBFLOW_CREATE, 1);
+	mptcp_pm_subflow_create_put(nlh, req);
+	return batch.msg_end(nlh, &mptcp_pm_attr_nest);
 }
 
 /* ============== MPTCP_PM_CMD_SUBFLOW_DESTROY ============== */
 /* MPTCP_PM_CMD_SUBFLOW_DESTROY - do */
-int mptcp_pm_subflow_destroy(ynl_cpp::ynl_socket&  ys,
+static void
+mptcp_pm_subflow_destroy_put(struct nlmsghdr *nlh,
 			     mptcp_pm_subflow_destroy_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SUBFLOW_DESTROY, 1);
-	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_attr_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
+	if (req.token.has_value())
+		ynl_attr_put_u32_unchecked(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
 	if (req.addr.has_value())
 		mptcp_pm_address_put(nlh, MPTCP_PM_ATTR_ADDR, req.addr.value());
-	if (req.token.has_value())
-		ynl_attr_put_u32(nlh, MPTCP_PM_ATTR_TOKEN, req.token.value());
 	if (req.addr_remote.has_value())
 		mptcp_pm_address_put(nlh, MPTCP_PM_ATTR_ADDR_REMOTE, req.addr_remote.value());
+}
+
+static ynl_cpp::result<void>
+mptcp_pm_subflow_destroy_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &mptcp_pm_attr_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+mptcp_pm_subflow_destroy_ex(ynl_cpp::ynl_socket&  ys,
+			    mptcp_pm_subflow_destroy_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SUBFLOW_DESTROY, 1);
+	mptcp_pm_subflow_destroy_put(nlh, req);
+
+	return mptcp_pm_subflow_destroy_exec(ys, nlh);
+}
+
+int mptcp_pm_subflow_destroy(ynl_cpp::ynl_socket&  ys,
+			     mptcp_pm_subflow_destroy_req& req)
+{
+	auto ret = mptcp_pm_subflow_destroy_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_subflow_destroy_prepare(ynl_cpp::ynl_socket&  ys,
+				 mptcp_pm_subflow_destroy_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, MPTCP_PM_CMD_SUBFLOW_DESTROY, 1);
+	mptcp_pm_subflow_destroy_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+mptcp_pm_subflow_destroy_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl)
+{
+	return mptcp_pm_subflow_destroy_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int mptcp_pm_subflow_destroy(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl)
+{
+	auto ret = mptcp_pm_subflow_destroy_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+mptcp_pm_subflow_destroy_batch(ynl_cpp::msg_batch& batch,
+			       mptcp_pm_subflow_destroy_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(MPTCP_PM_CMD_SUBFLOW_DESTROY, 1);
+	mptcp_pm_subflow_destroy_put(nlh, req);
+	return batch.msg_end(nlh, &mptcp_pm_attr_nest);
 }
 
 const struct ynl_family ynl_mptcp_pm_family =  {
@@ -39,16 +39,36 @@ struct mptcp_pm_address {
 	std::optional<__s32> if_idx;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest mptcp_pm_address_nest;
+extern struct ynl_policy_nest mptcp_pm_endpoint_nest;
+extern struct ynl_policy_nest mptcp_pm_attr_nest;
+int mptcp_pm_address_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			 const mptcp_pm_address&  obj);
+
 /* ============== MPTCP_PM_CMD_ADD_ADDR ============== */
 /* MPTCP_PM_CMD_ADD_ADDR - do */
 struct mptcp_pm_add_addr_req {
 	std::optional<mptcp_pm_address> addr;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t mptcp_pm_add_addr_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 72;
+
 /*
  * Add endpoint
  */
 int mptcp_pm_add_addr(ynl_cpp::ynl_socket&  ys, mptcp_pm_add_addr_req& req);
+ynl_cpp::result<void>
+mptcp_pm_add_addr_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_add_addr_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_add_addr_prepare(ynl_cpp::ynl_socket&  ys, mptcp_pm_add_addr_req& req);
+int mptcp_pm_add_addr(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+mptcp_pm_add_addr_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+mptcp_pm_add_addr_batch(ynl_cpp::msg_batch& batch, mptcp_pm_add_addr_req& req);
 
 /* ============== MPTCP_PM_CMD_DEL_ADDR ============== */
 /* MPTCP_PM_CMD_DEL_ADDR - do */
@@ -56,10 +76,23 @@ struct mptcp_pm_del_addr_req {
 	std::optional<mptcp_pm_address> addr;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t mptcp_pm_del_addr_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 72;
+
 /*
  * Delete endpoint
  */
 int mptcp_pm_del_addr(ynl_cpp::ynl_socket&  ys, mptcp_pm_del_addr_req& req);
+ynl_cpp::result<void>
+mptcp_pm_del_addr_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_del_addr_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_del_addr_prepare(ynl_cpp::ynl_socket&  ys, mptcp_pm_del_addr_req& req);
+int mptcp_pm_del_addr(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+mptcp_pm_del_addr_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+mptcp_pm_del_addr_batch(ynl_cpp::msg_batch& batch, mptcp_pm_del_addr_req& req);
 
 /* ============== MPTCP_PM_CMD_GET_ADDR ============== */
 /* MPTCP_PM_CMD_GET_ADDR - do */
@@ -68,6 +101,9 @@ struct mptcp_pm_get_addr_req {
 	std::optional<__u32> token;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t mptcp_pm_get_addr_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 80;
+
 struct mptcp_pm_get_addr_rsp {
 	std::optional<mptcp_pm_address> addr;
 };
@@ -77,6 +113,16 @@ struct mptcp_pm_get_addr_rsp {
  */
 std::unique_ptr<mptcp_pm_get_addr_rsp>
 mptcp_pm_get_addr(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_addr_req& req);
+ynl_cpp::result<std::unique_ptr<mptcp_pm_get_addr_rsp>>
+mptcp_pm_get_addr_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_addr_req& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_get_addr_prepare(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_addr_req& req);
+std::unique_ptr<mptcp_pm_get_addr_rsp>
+mptcp_pm_get_addr(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<mptcp_pm_get_addr_rsp>>
+mptcp_pm_get_addr_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
 
 /* MPTCP_PM_CMD_GET_ADDR - dump */
 struct mptcp_pm_get_addr_list {
@@ -85,6 +131,9 @@ struct mptcp_pm_get_addr_list {
 
 std::unique_ptr<mptcp_pm_get_addr_list>
 mptcp_pm_get_addr_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<mptcp_pm_get_addr_list>>
+mptcp_pm_get_addr_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  const ynl_cpp::projection *proj = nullptr);
 
 /* ============== MPTCP_PM_CMD_FLUSH_ADDRS ============== */
 /* MPTCP_PM_CMD_FLUSH_ADDRS - do */
@@ -92,11 +141,28 @@ struct mptcp_pm_flush_addrs_req {
 	std::optional<mptcp_pm_address> addr;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t mptcp_pm_flush_addrs_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 72;
+
 /*
  * Flush addresses
  */
 int mptcp_pm_flush_addrs(ynl_cpp::ynl_socket&  ys,
 			 mptcp_pm_flush_addrs_req& req);
+ynl_cpp::result<void>
+mptcp_pm_flush_addrs_ex(ynl_cpp::ynl_socket&  ys,
+			mptcp_pm_flush_addrs_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_flush_addrs_prepare(ynl_cpp::ynl_socket&  ys,
+			     mptcp_pm_flush_addrs_req& req);
+int mptcp_pm_flush_addrs(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+mptcp_pm_flush_addrs_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+mptcp_pm_flush_addrs_batch(ynl_cpp::msg_batch& batch,
+			   mptcp_pm_flush_addrs_req& req);
 
 /* ============== MPTCP_PM_CMD_SET_LIMITS ============== */
 /* MPTCP_PM_CMD_SET_LIMITS - do */
@@ -105,10 +171,26 @@ struct mptcp_pm_set_limits_req {
 	std::optional<__u32> subflows;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t mptcp_pm_set_limits_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 16;
+
 /*
  * Set protocol limits
  */
 int mptcp_pm_set_limits(ynl_cpp::ynl_socket&  ys, mptcp_pm_set_limits_req& req);
+ynl_cpp::result<void>
+mptcp_pm_set_limits_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_set_limits_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_set_limits_prepare(ynl_cpp::ynl_socket&  ys,
+			    mptcp_pm_set_limits_req& req);
+int mptcp_pm_set_limits(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+mptcp_pm_set_limits_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+mptcp_pm_set_limits_batch(ynl_cpp::msg_batch& batch,
+			  mptcp_pm_set_limits_req& req);
 
 /* ============== MPTCP_PM_CMD_GET_LIMITS ============== */
 /* MPTCP_PM_CMD_GET_LIMITS - do */
@@ -117,6 +199,9 @@ struct mptcp_pm_get_limits_req {
 	std::optional<__u32> subflows;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t mptcp_pm_get_limits_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 16;
+
 struct mptcp_pm_get_limits_rsp {
 	std::optional<__u32> rcv_add_addrs;
 	std::optional<__u32> subflows;
@@ -127,6 +212,18 @@ struct mptcp_pm_get_limits_rsp {
  */
 std::unique_ptr<mptcp_pm_get_limits_rsp>
 mptcp_pm_get_limits(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_limits_req& req);
+ynl_cpp::result<std::unique_ptr<mptcp_pm_get_limits_rsp>>
+mptcp_pm_get_limits_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_get_limits_req& req,
+		       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_get_limits_prepare(ynl_cpp::ynl_socket&  ys,
+			    mptcp_pm_get_limits_req& req);
+std::unique_ptr<mptcp_pm_get_limits_rsp>
+mptcp_pm_get_limits(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<mptcp_pm_get_limits_rsp>>
+mptcp_pm_get_limits_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj = nullptr);
 
 /* ============== MPTCP_PM_CMD_SET_FLAGS ============== */
 /* MPTCP_PM_CMD_SET_FLAGS - do */
@@ -136,10 +233,26 @@ struct mptcp_pm_set_flags_req {
 	std::optional<mptcp_pm_address> addr_remote;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t mptcp_pm_set_flags_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 152;
+
 /*
  * Change endpoint flags
  */
 int mptcp_pm_set_flags(ynl_cpp::ynl_socket&  ys, mptcp_pm_set_flags_req& req);
+ynl_cpp::result<void>
+mptcp_pm_set_flags_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_set_flags_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_set_flags_prepare(ynl_cpp::ynl_socket&  ys,
+			   mptcp_pm_set_flags_req& req);
+int mptcp_pm_set_flags(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+mptcp_pm_set_flags_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+mptcp_pm_set_flags_batch(ynl_cpp::msg_batch& batch,
+			 mptcp_pm_set_flags_req& req);
 
 /* ============== MPTCP_PM_CMD_ANNOUNCE ============== */
 /* MPTCP_PM_CMD_ANNOUNCE - do */
@@ -148,10 +261,23 @@ struct mptcp_pm_announce_req {
 	std::optional<__u32> token;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t mptcp_pm_announce_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 80;
+
 /*
  * Announce new address
  */
 int mptcp_pm_announce(ynl_cpp::ynl_socket&  ys, mptcp_pm_announce_req& req);
+ynl_cpp::result<void>
+mptcp_pm_announce_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_announce_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_announce_prepare(ynl_cpp::ynl_socket&  ys, mptcp_pm_announce_req& req);
+int mptcp_pm_announce(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+mptcp_pm_announce_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+mptcp_pm_announce_batch(ynl_cpp::msg_batch& batch, mptcp_pm_announce_req& req);
 
 /* ============== MPTCP_PM_CMD_REMOVE ============== */
 /* MPTCP_PM_CMD_REMOVE - do */
@@ -160,10 +286,22 @@ struct mptcp_pm_remove_req {
 	std::optional<__u8> loc_id;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t mptcp_pm_remove_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 16;
+
 /*
  * Announce removal
  */
 int mptcp_pm_remove(ynl_cpp::ynl_socket&  ys, mptcp_pm_remove_req& req);
+ynl_cpp::result<void>
+mptcp_pm_remove_ex(ynl_cpp::ynl_socket&  ys, mptcp_pm_remove_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_remove_prepare(ynl_cpp::ynl_socket&  ys, mptcp_pm_remove_req& req);
+int mptcp_pm_remove(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+mptcp_pm_remove_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+mptcp_pm_remove_batch(ynl_cpp::msg_batch& batch, mptcp_pm_remove_req& req);
 
 /* ============== MPTCP_PM_CMD_SUBFLOW_CREATE ============== */
 /* MPTCP_PM_CMD_SUBFLOW_CREATE - do */
@@ -173,11 +311,28 @@ struct mptcp_pm_subflow_create_req {
 	std::optional<mptcp_pm_address> addr_remote;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t mptcp_pm_subflow_create_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 152;
+
 /*
  * Create subflow
  */
 int mptcp_pm_subflow_create(ynl_cpp::ynl_socket&  ys,
 			    mptcp_pm_subflow_create_req& req);
+ynl_cpp::result<void>
+mptcp_pm_subflow_create_ex(ynl_cpp::ynl_socket&  ys,
+			   mptcp_pm_subflow_create_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_subflow_create_prepare(ynl_cpp::ynl_socket&  ys,
+				mptcp_pm_subflow_create_req& req);
+int mptcp_pm_subflow_create(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+mptcp_pm_subflow_create_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+mptcp_pm_subflow_create_batch(ynl_cpp::msg_batch& batch,
+			      mptcp_pm_subflow_create_req& req);
 
 /* ============== MPTCP_PM_CMD_SUBFLOW_DESTROY ============== */
 /* MPTCP_PM_CMD_SUBFLOW_DESTROY - do */
@@ -187,11 +342,28 @@ struct mptcp_pm_subflow_destroy_req {
 	std::optional<mptcp_pm_address> addr_remote;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t mptcp_pm_subflow_destroy_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 152;
+
 /*
  * Destroy subflow
  */
 int mptcp_pm_subflow_destroy(ynl_cpp::ynl_socket&  ys,
 			     mptcp_pm_subflow_destroy_req& req);
+ynl_cpp::result<void>
+mptcp_pm_subflow_destroy_ex(ynl_cpp::ynl_socket&  ys,
+			    mptcp_pm_subflow_destroy_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+mptcp_pm_subflow_destroy_prepare(ynl_cpp::ynl_socket&  ys,
+				 mptcp_pm_subflow_destroy_req& req);
+int mptcp_pm_subflow_destroy(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+mptcp_pm_subflow_destroy_ex(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+mptcp_pm_subflow_destroy_batch(ynl_cpp::msg_batch& batch,
+			       mptcp_pm_subflow_destroy_req& req);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_MPTCP_PM_GEN_H */
@@ -153,12 +153,12 @@ int net_shaper_handle_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == NET_SHAPER_A_HANDLE_SCOPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->scope = (net_shaper_scope)ynl_attr_get_u32(attr);
 		} else if (type == NET_SHAPER_A_HANDLE_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -198,49 +198,52 @@ int net_shaper_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NET_SHAPER_A_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NET_SHAPER_A_PARENT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &net_shaper_handle_nest;
-			parg.data = &dst->parent;
+			parg.data = &dst->parent.emplace();
 			if (net_shaper_handle_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == NET_SHAPER_A_HANDLE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &net_shaper_handle_nest;
-			parg.data = &dst->handle;
+			parg.data = &dst->handle.emplace();
 			if (net_shaper_handle_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == NET_SHAPER_A_METRIC) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->metric = (net_shaper_metric)ynl_attr_get_u32(attr);
 		} else if (type == NET_SHAPER_A_BW_MIN) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->bw_min = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NET_SHAPER_A_BW_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->bw_max = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NET_SHAPER_A_BURST) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->burst = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NET_SHAPER_A_PRIORITY) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->priority = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NET_SHAPER_A_WEIGHT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->weight = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -248,120 +251,338 @@ int net_shaper_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<net_shaper_get_rsp>
-net_shaper_get(ynl_cpp::ynl_socket&  ys, net_shaper_get_req& req)
+static void net_shaper_get_put(struct nlmsghdr *nlh, net_shaper_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_IFINDEX, req.ifindex.value());
+	if (req.handle.has_value())
+		net_shaper_handle_put(nlh, NET_SHAPER_A_HANDLE, req.handle.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<net_shaper_get_rsp>>
+net_shaper_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		    const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<net_shaper_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &net_shaper_net_shaper_nest;
 	yrs.yarg.rsp_policy = &net_shaper_net_shaper_nest;
 
-	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_IFINDEX, req.ifindex.value());
-	if (req.handle.has_value())
-		net_shaper_handle_put(nlh, NET_SHAPER_A_HANDLE, req.handle.value());
-
 	rsp.reset(new net_shaper_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = net_shaper_get_rsp_parse;
 	yrs.rsp_cmd = NET_SHAPER_CMD_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<net_shaper_get_rsp>>
+net_shaper_get_ex(ynl_cpp::ynl_socket&  ys, net_shaper_get_req& req,
+		  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_GET, 1);
+	net_shaper_get_put(nlh, req);
+
+	return net_shaper_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<net_shaper_get_rsp>
+net_shaper_get(ynl_cpp::ynl_socket&  ys, net_shaper_get_req& req)
+{
+	auto ret = net_shaper_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_get_prepare(ynl_cpp::ynl_socket&  ys, net_shaper_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_GET, 1);
+	net_shaper_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<net_shaper_get_rsp>>
+net_shaper_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj)
+{
+	return net_shaper_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<net_shaper_get_rsp>
+net_shaper_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = net_shaper_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* NET_SHAPER_CMD_GET - dump */
-std::unique_ptr<net_shaper_get_list>
-net_shaper_get_dump(ynl_cpp::ynl_socket&  ys, net_shaper_get_req_dump& req)
+static void
+net_shaper_get_dump_put(struct nlmsghdr *nlh, net_shaper_get_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_IFINDEX, req.ifindex.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<net_shaper_get_list>>
+net_shaper_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			 const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<net_shaper_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &net_shaper_net_shaper_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<net_shaper_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = net_shaper_get_rsp_parse;
 	yds.rsp_cmd = NET_SHAPER_CMD_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &net_shaper_net_shaper_nest;
 
-	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_IFINDEX, req.ifindex.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ============== NET_SHAPER_CMD_SET ============== */
-/* NET_SHAPER_CMD_SET - do */
-int net_shaper_set(ynl_cpp::ynl_socket&  ys, net_shaper_set_req& req)
+ynl_cpp::result<std::unique_ptr<net_shaper_get_list>>
+net_shaper_get_dump_ex(ynl_cpp::ynl_socket&  ys, net_shaper_get_req_dump& req,
+		       const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &net_shaper_net_shaper_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_GET, 1);
+	net_shaper_get_dump_put(nlh, req);
+
+	return net_shaper_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<net_shaper_get_list>
+net_shaper_get_dump(ynl_cpp::ynl_socket&  ys, net_shaper_get_req_dump& req)
+{
+	auto ret = net_shaper_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			    net_shaper_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_GET, 1);
+	net_shaper_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<net_shaper_get_list>>
+net_shaper_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj)
+{
+	return net_shaper_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<net_shaper_get_list>
+net_shaper_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = net_shaper_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== NET_SHAPER_CMD_SET ============== */
+/* NET_SHAPER_CMD_SET - do */
+static void net_shaper_set_put(struct nlmsghdr *nlh, net_shaper_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 68 <= YNL_SOCKET_BUFFER_SIZE);
 
 	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_IFINDEX, req.ifindex.value());
-	if (req.handle.has_value())
-		net_shaper_handle_put(nlh, NET_SHAPER_A_HANDLE, req.handle.value());
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_IFINDEX, req.ifindex.value());
 	if (req.metric.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_METRIC, req.metric.value());
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_METRIC, req.metric.value());
 	if (req.bw_min.has_value())
-		ynl_attr_put_uint(nlh, NET_SHAPER_A_BW_MIN, req.bw_min.value());
+		ynl_attr_put_uint_unchecked(nlh, NET_SHAPER_A_BW_MIN, req.bw_min.value());
 	if (req.bw_max.has_value())
-		ynl_attr_put_uint(nlh, NET_SHAPER_A_BW_MAX, req.bw_max.value());
+		ynl_attr_put_uint_unchecked(nlh, NET_SHAPER_A_BW_MAX, req.bw_max.value());
 	if (req.burst.has_value())
-		ynl_attr_put_uint(nlh, NET_SHAPER_A_BURST, req.burst.value());
+		ynl_attr_put_uint_unchecked(nlh, NET_SHAPER_A_BURST, req.burst.value());
 	if (req.priority.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_PRIORITY, req.priority.value());
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_PRIORITY, req.priority.value());
 	if (req.weight.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_WEIGHT, req.weight.value());
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_WEIGHT, req.weight.value());
+	if (req.handle.has_value())
+		net_shaper_handle_put(nlh, NET_SHAPER_A_HANDLE, req.handle.value());
+}
+
+static ynl_cpp::result<void>
+net_shaper_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &net_shaper_net_shaper_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
 }
 
-/* ============== NET_SHAPER_CMD_DELETE ============== */
-/* NET_SHAPER_CMD_DELETE - do */
-int net_shaper_delete(ynl_cpp::ynl_socket&  ys, net_shaper_delete_req& req)
+ynl_cpp::result<void>
+net_shaper_set_ex(ynl_cpp::ynl_socket&  ys, net_shaper_set_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_DELETE, 1);
-	((struct ynl_sock*)ys)->req_policy = &net_shaper_net_shaper_nest;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_SET, 1);
+	net_shaper_set_put(nlh, req);
+
+	return net_shaper_set_exec(ys, nlh);
+}
+
+int net_shaper_set(ynl_cpp::ynl_socket&  ys, net_shaper_set_req& req)
+{
+	auto ret = net_shaper_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_set_prepare(ynl_cpp::ynl_socket&  ys, net_shaper_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_SET, 1);
+	net_shaper_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+net_shaper_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return net_shaper_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int net_shaper_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = net_shaper_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+net_shaper_set_batch(ynl_cpp::msg_batch& batch, net_shaper_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(NET_SHAPER_CMD_SET, 1);
+	net_shaper_set_put(nlh, req);
+	return batch.msg_end(nlh, &net_shaper_net_shaper_nest);
+}
+
+/* ============== NET_SHAPER_CMD_DELETE ============== */
+/* NET_SHAPER_CMD_DELETE - do */
+static void
+net_shaper_delete_put(struct nlmsghdr *nlh, net_shaper_delete_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
 
 	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_IFINDEX, req.ifindex.value());
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_IFINDEX, req.ifindex.value());
 	if (req.handle.has_value())
 		net_shaper_handle_put(nlh, NET_SHAPER_A_HANDLE, req.handle.value());
+}
+
+static ynl_cpp::result<void>
+net_shaper_delete_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &net_shaper_net_shaper_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+net_shaper_delete_ex(ynl_cpp::ynl_socket&  ys, net_shaper_delete_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_DELETE, 1);
+	net_shaper_delete_put(nlh, req);
+
+	return net_shaper_delete_exec(ys, nlh);
+}
+
+int net_shaper_delete(ynl_cpp::ynl_socket&  ys, net_shaper_delete_req& req)
+{
+	auto ret = net_shaper_delete_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_delete_prepare(ynl_cpp::ynl_socket&  ys, net_shaper_delete_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_DELETE, 1);
+	net_shaper_delete_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+net_shaper_delete_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return net_shaper_delete_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int net_shaper_delete(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = net_shaper_delete_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+net_shaper_delete_batch(ynl_cpp::msg_batch& batch, net_shaper_delete_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(NET_SHAPER_CMD_DELETE, 1);
+	net_shaper_delete_put(nlh, req);
+	return batch.msg_end(nlh, &net_shaper_net_shaper_nest);
 }
 
 /* ============== NET_SHAPER_CMD_GROUP ============== */
@@ -379,16 +600,19 @@ int net_shaper_group_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NET_SHAPER_A_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NET_SHAPER_A_HANDLE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &net_shaper_handle_nest;
-			parg.data = &dst->handle;
+			parg.data = &dst->handle.emplace();
 			if (net_shaper_handle_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -397,51 +621,105 @@ int net_shaper_group_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<net_shaper_group_rsp>
-net_shaper_group(ynl_cpp::ynl_socket&  ys, net_shaper_group_req& req)
+static void
+net_shaper_group_put(struct nlmsghdr *nlh, net_shaper_group_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<net_shaper_group_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_GROUP, 1);
-	((struct ynl_sock*)ys)->req_policy = &net_shaper_net_shaper_nest;
-	yrs.yarg.rsp_policy = &net_shaper_net_shaper_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 68 <= YNL_SOCKET_BUFFER_SIZE);
 
 	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_IFINDEX, req.ifindex.value());
-	if (req.parent.has_value())
-		net_shaper_handle_put(nlh, NET_SHAPER_A_PARENT, req.parent.value());
-	if (req.handle.has_value())
-		net_shaper_handle_put(nlh, NET_SHAPER_A_HANDLE, req.handle.value());
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_IFINDEX, req.ifindex.value());
 	if (req.metric.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_METRIC, req.metric.value());
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_METRIC, req.metric.value());
 	if (req.bw_min.has_value())
-		ynl_attr_put_uint(nlh, NET_SHAPER_A_BW_MIN, req.bw_min.value());
+		ynl_attr_put_uint_unchecked(nlh, NET_SHAPER_A_BW_MIN, req.bw_min.value());
 	if (req.bw_max.has_value())
-		ynl_attr_put_uint(nlh, NET_SHAPER_A_BW_MAX, req.bw_max.value());
+		ynl_attr_put_uint_unchecked(nlh, NET_SHAPER_A_BW_MAX, req.bw_max.value());
 	if (req.burst.has_value())
-		ynl_attr_put_uint(nlh, NET_SHAPER_A_BURST, req.burst.value());
+		ynl_attr_put_uint_unchecked(nlh, NET_SHAPER_A_BURST, req.burst.value());
 	if (req.priority.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_PRIORITY, req.priority.value());
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_PRIORITY, req.priority.value());
 	if (req.weight.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_WEIGHT, req.weight.value());
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_WEIGHT, req.weight.value());
+	if (req.parent.has_value())
+		net_shaper_handle_put(nlh, NET_SHAPER_A_PARENT, req.parent.value());
+	if (req.handle.has_value())
+		net_shaper_handle_put(nlh, NET_SHAPER_A_HANDLE, req.handle.value());
 	for (unsigned int i = 0; i < req.leaves.size(); i++)
 		net_shaper_leaf_info_put(nlh, NET_SHAPER_A_LEAVES, req.leaves[i]);
+}
+
+static ynl_cpp::result<std::unique_ptr<net_shaper_group_rsp>>
+net_shaper_group_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<net_shaper_group_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &net_shaper_net_shaper_nest;
+	yrs.yarg.rsp_policy = &net_shaper_net_shaper_nest;
 
 	rsp.reset(new net_shaper_group_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = net_shaper_group_rsp_parse;
 	yrs.rsp_cmd = NET_SHAPER_CMD_GROUP;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<net_shaper_group_rsp>>
+net_shaper_group_ex(ynl_cpp::ynl_socket&  ys, net_shaper_group_req& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_GROUP, 1);
+	net_shaper_group_put(nlh, req);
+
+	return net_shaper_group_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<net_shaper_group_rsp>
+net_shaper_group(ynl_cpp::ynl_socket&  ys, net_shaper_group_req& req)
+{
+	auto ret = net_shaper_group_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_group_prepare(ynl_cpp::ynl_socket&  ys, net_shaper_group_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_GROUP, 1);
+	net_shaper_group_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<net_shaper_group_rsp>>
+net_shaper_group_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return net_shaper_group_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<net_shaper_group_rsp>
+net_shaper_group(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = net_shaper_group_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== NET_SHAPER_CMD_CAP_GET ============== */
 /* NET_SHAPER_CMD_CAP_GET - do */
 int net_shaper_cap_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -455,103 +733,212 @@ int net_shaper_cap_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NET_SHAPER_A_CAPS_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NET_SHAPER_A_CAPS_SCOPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->scope = (net_shaper_scope)ynl_attr_get_u32(attr);
 		} else if (type == NET_SHAPER_A_CAPS_SUPPORT_METRIC_BPS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->support_metric_bps = true;
 		} else if (type == NET_SHAPER_A_CAPS_SUPPORT_METRIC_PPS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->support_metric_pps = true;
 		} else if (type == NET_SHAPER_A_CAPS_SUPPORT_NESTING) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->support_nesting = true;
 		} else if (type == NET_SHAPER_A_CAPS_SUPPORT_BW_MIN) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->support_bw_min = true;
 		} else if (type == NET_SHAPER_A_CAPS_SUPPORT_BW_MAX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->support_bw_max = true;
 		} else if (type == NET_SHAPER_A_CAPS_SUPPORT_BURST) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->support_burst = true;
 		} else if (type == NET_SHAPER_A_CAPS_SUPPORT_PRIORITY) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->support_priority = true;
 		} else if (type == NET_SHAPER_A_CAPS_SUPPORT_WEIGHT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->support_weight = true;
 		}
 	}
 
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<net_shaper_cap_get_rsp>
-net_shaper_cap_get(ynl_cpp::ynl_socket&  ys, net_shaper_cap_get_req& req)
+static void
+net_shaper_cap_get_put(struct nlmsghdr *nlh, net_shaper_cap_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_CAPS_IFINDEX, req.ifindex.value());
+	if (req.scope.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_CAPS_SCOPE, req.scope.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<net_shaper_cap_get_rsp>>
+net_shaper_cap_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<net_shaper_cap_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_CAP_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &net_shaper_caps_nest;
 	yrs.yarg.rsp_policy = &net_shaper_caps_nest;
 
-	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_CAPS_IFINDEX, req.ifindex.value());
-	if (req.scope.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_CAPS_SCOPE, req.scope.value());
-
 	rsp.reset(new net_shaper_cap_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = net_shaper_cap_get_rsp_parse;
 	yrs.rsp_cmd = NET_SHAPER_CMD_CAP_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<net_shaper_cap_get_rsp>>
+net_shaper_cap_get_ex(ynl_cpp::ynl_socket&  ys, net_shaper_cap_get_req& req,
+		      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_CAP_GET, 1);
+	net_shaper_cap_get_put(nlh, req);
+
+	return net_shaper_cap_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<net_shaper_cap_get_rsp>
+net_shaper_cap_get(ynl_cpp::ynl_socket&  ys, net_shaper_cap_get_req& req)
+{
+	auto ret = net_shaper_cap_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_cap_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   net_shaper_cap_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_CAP_GET, 1);
+	net_shaper_cap_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<net_shaper_cap_get_rsp>>
+net_shaper_cap_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj)
+{
+	return net_shaper_cap_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<net_shaper_cap_get_rsp>
+net_shaper_cap_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = net_shaper_cap_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* NET_SHAPER_CMD_CAP_GET - dump */
-std::unique_ptr<net_shaper_cap_get_list>
-net_shaper_cap_get_dump(ynl_cpp::ynl_socket&  ys,
-			net_shaper_cap_get_req_dump& req)
+static void
+net_shaper_cap_get_dump_put(struct nlmsghdr *nlh,
+			    net_shaper_cap_get_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NET_SHAPER_A_CAPS_IFINDEX, req.ifindex.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<net_shaper_cap_get_list>>
+net_shaper_cap_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			     const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<net_shaper_cap_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &net_shaper_caps_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<net_shaper_cap_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = net_shaper_cap_get_rsp_parse;
 	yds.rsp_cmd = NET_SHAPER_CMD_CAP_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_CAP_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &net_shaper_caps_nest;
 
-	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NET_SHAPER_A_CAPS_IFINDEX, req.ifindex.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<net_shaper_cap_get_list>>
+net_shaper_cap_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   net_shaper_cap_get_req_dump& req,
+			   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_CAP_GET, 1);
+	net_shaper_cap_get_dump_put(nlh, req);
+
+	return net_shaper_cap_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<net_shaper_cap_get_list>
+net_shaper_cap_get_dump(ynl_cpp::ynl_socket&  ys,
+			net_shaper_cap_get_req_dump& req)
+{
+	auto ret = net_shaper_cap_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_cap_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				net_shaper_cap_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NET_SHAPER_CMD_CAP_GET, 1);
+	net_shaper_cap_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<net_shaper_cap_get_list>>
+net_shaper_cap_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj)
+{
+	return net_shaper_cap_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<net_shaper_cap_get_list>
+net_shaper_cap_get_dump(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = net_shaper_cap_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 const struct ynl_family ynl_net_shaper_family =  {
 	.name		= "net_shaper",
 	.hdr_len	= sizeof(struct genlmsghdr),
@@ -41,6 +41,16 @@ struct net_shaper_leaf_info {
 	std::optional<__u32> weight;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest net_shaper_handle_nest;
+extern struct ynl_policy_nest net_shaper_leaf_info_nest;
+extern struct ynl_policy_nest net_shaper_net_shaper_nest;
+extern struct ynl_policy_nest net_shaper_caps_nest;
+int net_shaper_handle_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			  const net_shaper_handle&  obj);
+int net_shaper_leaf_info_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			     const net_shaper_leaf_info&  obj);
+
 /* ============== NET_SHAPER_CMD_GET ============== */
 /* NET_SHAPER_CMD_GET - do */
 struct net_shaper_get_req {
@@ -48,6 +58,9 @@ struct net_shaper_get_req {
 	std::optional<net_shaper_handle> handle;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t net_shaper_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 28;
+
 struct net_shaper_get_rsp {
 	std::optional<__u32> ifindex;
 	std::optional<net_shaper_handle> parent;
@@ -66,18 +79,43 @@ struct net_shaper_get_rsp {
  */
 std::unique_ptr<net_shaper_get_rsp>
 net_shaper_get(ynl_cpp::ynl_socket&  ys, net_shaper_get_req& req);
+ynl_cpp::result<std::unique_ptr<net_shaper_get_rsp>>
+net_shaper_get_ex(ynl_cpp::ynl_socket&  ys, net_shaper_get_req& req,
+		  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_get_prepare(ynl_cpp::ynl_socket&  ys, net_shaper_get_req& req);
+std::unique_ptr<net_shaper_get_rsp>
+net_shaper_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<net_shaper_get_rsp>>
+net_shaper_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj = nullptr);
 
 /* NET_SHAPER_CMD_GET - dump */
 struct net_shaper_get_req_dump {
 	std::optional<__u32> ifindex;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t net_shaper_get_req_dump_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct net_shaper_get_list {
 	std::list<net_shaper_get_rsp> objs;
 };
 
 std::unique_ptr<net_shaper_get_list>
 net_shaper_get_dump(ynl_cpp::ynl_socket&  ys, net_shaper_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<net_shaper_get_list>>
+net_shaper_get_dump_ex(ynl_cpp::ynl_socket&  ys, net_shaper_get_req_dump& req,
+		       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			    net_shaper_get_req_dump& req);
+std::unique_ptr<net_shaper_get_list>
+net_shaper_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<net_shaper_get_list>>
+net_shaper_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj = nullptr);
 
 /* ============== NET_SHAPER_CMD_SET ============== */
 /* NET_SHAPER_CMD_SET - do */
@@ -92,6 +130,9 @@ struct net_shaper_set_req {
 	std::optional<__u32> weight;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t net_shaper_set_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 88;
+
 /*
  * Create or update the specified shaper.
 The set operation can't be used to create a @node scope shaper,
@@ -99,6 +140,15 @@ use the @group operation instead.
 
  */
 int net_shaper_set(ynl_cpp::ynl_socket&  ys, net_shaper_set_req& req);
+ynl_cpp::result<void>
+net_shaper_set_ex(ynl_cpp::ynl_socket&  ys, net_shaper_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_set_prepare(ynl_cpp::ynl_socket&  ys, net_shaper_set_req& req);
+int net_shaper_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+net_shaper_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+net_shaper_set_batch(ynl_cpp::msg_batch& batch, net_shaper_set_req& req);
 
 /* ============== NET_SHAPER_CMD_DELETE ============== */
 /* NET_SHAPER_CMD_DELETE - do */
@@ -107,6 +157,9 @@ struct net_shaper_delete_req {
 	std::optional<net_shaper_handle> handle;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t net_shaper_delete_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 28;
+
 /*
  * Clear (remove) the specified shaper. When deleting
 a @node shaper, reattach all the node's leaves to the
@@ -122,6 +175,16 @@ feeds an implicit RR node at the root of the hierarchy.
 
  */
 int net_shaper_delete(ynl_cpp::ynl_socket&  ys, net_shaper_delete_req& req);
+ynl_cpp::result<void>
+net_shaper_delete_ex(ynl_cpp::ynl_socket&  ys, net_shaper_delete_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_delete_prepare(ynl_cpp::ynl_socket&  ys, net_shaper_delete_req& req);
+int net_shaper_delete(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+net_shaper_delete_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+net_shaper_delete_batch(ynl_cpp::msg_batch& batch, net_shaper_delete_req& req);
 
 /* ============== NET_SHAPER_CMD_GROUP ============== */
 /* NET_SHAPER_CMD_GROUP - do */
@@ -167,6 +230,16 @@ as the reply.
  */
 std::unique_ptr<net_shaper_group_rsp>
 net_shaper_group(ynl_cpp::ynl_socket&  ys, net_shaper_group_req& req);
+ynl_cpp::result<std::unique_ptr<net_shaper_group_rsp>>
+net_shaper_group_ex(ynl_cpp::ynl_socket&  ys, net_shaper_group_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_group_prepare(ynl_cpp::ynl_socket&  ys, net_shaper_group_req& req);
+std::unique_ptr<net_shaper_group_rsp>
+net_shaper_group(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<net_shaper_group_rsp>>
+net_shaper_group_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== NET_SHAPER_CMD_CAP_GET ============== */
 /* NET_SHAPER_CMD_CAP_GET - do */
@@ -175,6 +248,9 @@ struct net_shaper_cap_get_req {
 	std::optional<net_shaper_scope> scope;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t net_shaper_cap_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 16;
+
 struct net_shaper_cap_get_rsp {
 	std::optional<__u32> ifindex;
 	std::optional<net_shaper_scope> scope;
@@ -195,12 +271,27 @@ for the specified scope.
  */
 std::unique_ptr<net_shaper_cap_get_rsp>
 net_shaper_cap_get(ynl_cpp::ynl_socket&  ys, net_shaper_cap_get_req& req);
+ynl_cpp::result<std::unique_ptr<net_shaper_cap_get_rsp>>
+net_shaper_cap_get_ex(ynl_cpp::ynl_socket&  ys, net_shaper_cap_get_req& req,
+		      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_cap_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   net_shaper_cap_get_req& req);
+std::unique_ptr<net_shaper_cap_get_rsp>
+net_shaper_cap_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<net_shaper_cap_get_rsp>>
+net_shaper_cap_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj = nullptr);
 
 /* NET_SHAPER_CMD_CAP_GET - dump */
 struct net_shaper_cap_get_req_dump {
 	std::optional<__u32> ifindex;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t net_shaper_cap_get_req_dump_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct net_shaper_cap_get_list {
 	std::list<net_shaper_cap_get_rsp> objs;
 };
@@ -208,6 +299,20 @@ struct net_shaper_cap_get_list {
 std::unique_ptr<net_shaper_cap_get_list>
 net_shaper_cap_get_dump(ynl_cpp::ynl_socket&  ys,
 			net_shaper_cap_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<net_shaper_cap_get_list>>
+net_shaper_cap_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   net_shaper_cap_get_req_dump& req,
+			   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+net_shaper_cap_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				net_shaper_cap_get_req_dump& req);
+std::unique_ptr<net_shaper_cap_get_list>
+net_shaper_cap_get_dump(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<net_shaper_cap_get_list>>
+net_shaper_cap_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl,
+			   const ynl_cpp::projection *proj = nullptr);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_NET_SHAPER_GEN_H */
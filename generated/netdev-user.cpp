@@ -312,12 +312,12 @@ int netdev_page_pool_info_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == NETDEV_A_PAGE_POOL_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->id = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -353,25 +353,28 @@ int netdev_dev_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NETDEV_A_DEV_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_DEV_XDP_FEATURES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->xdp_features = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == NETDEV_A_DEV_XDP_ZC_MAX_SEGS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->xdp_zc_max_segs = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_DEV_XDP_RX_METADATA_FEATURES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->xdp_rx_metadata_features = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == NETDEV_A_DEV_XSK_FEATURES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->xsk_features = (__u64)ynl_attr_get_u64(attr);
 		}
 	}
@@ -379,59 +382,146 @@ int netdev_dev_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<netdev_dev_get_rsp>
-netdev_dev_get(ynl_cpp::ynl_socket&  ys, netdev_dev_get_req& req)
+static void netdev_dev_get_put(struct nlmsghdr *nlh, netdev_dev_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_DEV_IFINDEX, req.ifindex.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<netdev_dev_get_rsp>>
+netdev_dev_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		    const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<netdev_dev_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_DEV_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &netdev_dev_nest;
 	yrs.yarg.rsp_policy = &netdev_dev_nest;
 
-	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_DEV_IFINDEX, req.ifindex.value());
-
 	rsp.reset(new netdev_dev_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = netdev_dev_get_rsp_parse;
 	yrs.rsp_cmd = NETDEV_CMD_DEV_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<netdev_dev_get_rsp>>
+netdev_dev_get_ex(ynl_cpp::ynl_socket&  ys, netdev_dev_get_req& req,
+		  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_DEV_GET, 1);
+	netdev_dev_get_put(nlh, req);
+
+	return netdev_dev_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_dev_get_rsp>
+netdev_dev_get(ynl_cpp::ynl_socket&  ys, netdev_dev_get_req& req)
+{
+	auto ret = netdev_dev_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_dev_get_prepare(ynl_cpp::ynl_socket&  ys, netdev_dev_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_DEV_GET, 1);
+	netdev_dev_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<netdev_dev_get_rsp>>
+netdev_dev_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj)
+{
+	return netdev_dev_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<netdev_dev_get_rsp>
+netdev_dev_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = netdev_dev_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* NETDEV_CMD_DEV_GET - dump */
-std::unique_ptr<netdev_dev_get_list>
-netdev_dev_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<netdev_dev_get_list>>
+netdev_dev_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			 const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<netdev_dev_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &netdev_dev_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<netdev_dev_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = netdev_dev_get_rsp_parse;
 	yds.rsp_cmd = NETDEV_CMD_DEV_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_DEV_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<netdev_dev_get_list>>
+netdev_dev_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_DEV_GET, 1);
+
+	return netdev_dev_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_dev_get_list>
+netdev_dev_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = netdev_dev_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* NETDEV_CMD_DEV_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<netdev_dev_get_ntf>());
+
+static void *netdev_dev_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) netdev_dev_get_ntf())->obj;
+}
+
+static void netdev_dev_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	netdev_dev_get_ntf *rsp = (netdev_dev_get_ntf *)ntf;
+
+	rsp->~netdev_dev_get_ntf();
+	::free(rsp);
+}
+
 /* ============== NETDEV_CMD_PAGE_POOL_GET ============== */
 /* NETDEV_CMD_PAGE_POOL_GET - do */
 int netdev_page_pool_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -445,33 +535,36 @@ int netdev_page_pool_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NETDEV_A_PAGE_POOL_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->id = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_NAPI_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->napi_id = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_INFLIGHT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->inflight = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_INFLIGHT_MEM) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->inflight_mem = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_DETACH_TIME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->detach_time = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_DMABUF) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dmabuf = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -479,59 +572,150 @@ int netdev_page_pool_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<netdev_page_pool_get_rsp>
-netdev_page_pool_get(ynl_cpp::ynl_socket&  ys, netdev_page_pool_get_req& req)
+static void
+netdev_page_pool_get_put(struct nlmsghdr *nlh, netdev_page_pool_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 12 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.id.has_value())
+		ynl_attr_put_uint_unchecked(nlh, NETDEV_A_PAGE_POOL_ID, req.id.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<netdev_page_pool_get_rsp>>
+netdev_page_pool_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<netdev_page_pool_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_PAGE_POOL_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &netdev_page_pool_nest;
 	yrs.yarg.rsp_policy = &netdev_page_pool_nest;
 
-	if (req.id.has_value())
-		ynl_attr_put_uint(nlh, NETDEV_A_PAGE_POOL_ID, req.id.value());
-
 	rsp.reset(new netdev_page_pool_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = netdev_page_pool_get_rsp_parse;
 	yrs.rsp_cmd = NETDEV_CMD_PAGE_POOL_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_get_rsp>>
+netdev_page_pool_get_ex(ynl_cpp::ynl_socket&  ys,
+			netdev_page_pool_get_req& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_PAGE_POOL_GET, 1);
+	netdev_page_pool_get_put(nlh, req);
+
+	return netdev_page_pool_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_page_pool_get_rsp>
+netdev_page_pool_get(ynl_cpp::ynl_socket&  ys, netdev_page_pool_get_req& req)
+{
+	auto ret = netdev_page_pool_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_page_pool_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     netdev_page_pool_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_PAGE_POOL_GET, 1);
+	netdev_page_pool_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_get_rsp>>
+netdev_page_pool_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return netdev_page_pool_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<netdev_page_pool_get_rsp>
+netdev_page_pool_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = netdev_page_pool_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* NETDEV_CMD_PAGE_POOL_GET - dump */
-std::unique_ptr<netdev_page_pool_get_list>
-netdev_page_pool_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<netdev_page_pool_get_list>>
+netdev_page_pool_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<netdev_page_pool_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &netdev_page_pool_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<netdev_page_pool_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = netdev_page_pool_get_rsp_parse;
 	yds.rsp_cmd = NETDEV_CMD_PAGE_POOL_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_PAGE_POOL_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_get_list>>
+netdev_page_pool_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_PAGE_POOL_GET, 1);
+
+	return netdev_page_pool_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_page_pool_get_list>
+netdev_page_pool_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = netdev_page_pool_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* NETDEV_CMD_PAGE_POOL_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<netdev_page_pool_get_ntf>());
+
+static void *netdev_page_pool_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) netdev_page_pool_get_ntf())->obj;
+}
+
+static void netdev_page_pool_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	netdev_page_pool_get_ntf *rsp = (netdev_page_pool_get_ntf *)ntf;
+
+	rsp->~netdev_page_pool_get_ntf();
+	::free(rsp);
+}
+
 /* ============== NETDEV_CMD_PAGE_POOL_STATS_GET ============== */
 /* NETDEV_CMD_PAGE_POOL_STATS_GET - do */
 int netdev_page_pool_stats_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -547,57 +731,60 @@ int netdev_page_pool_stats_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NETDEV_A_PAGE_POOL_STATS_INFO) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &netdev_page_pool_info_nest;
-			parg.data = &dst->info;
+			parg.data = &dst->info.emplace();
 			if (netdev_page_pool_info_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == NETDEV_A_PAGE_POOL_STATS_ALLOC_FAST) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->alloc_fast = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_STATS_ALLOC_SLOW) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->alloc_slow = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_STATS_ALLOC_SLOW_HIGH_ORDER) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->alloc_slow_high_order = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_STATS_ALLOC_EMPTY) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->alloc_empty = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_STATS_ALLOC_REFILL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->alloc_refill = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_STATS_ALLOC_WAIVE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->alloc_waive = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_STATS_RECYCLE_CACHED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->recycle_cached = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_STATS_RECYCLE_CACHE_FULL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->recycle_cache_full = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_STATS_RECYCLE_RING) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->recycle_ring = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_STATS_RECYCLE_RING_FULL) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->recycle_ring_full = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_PAGE_POOL_STATS_RECYCLE_RELEASED_REFCNT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->recycle_released_refcnt = (__u64)ynl_attr_get_uint(attr);
 		}
 	}
@@ -605,59 +792,136 @@ int netdev_page_pool_stats_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<netdev_page_pool_stats_get_rsp>
-netdev_page_pool_stats_get(ynl_cpp::ynl_socket&  ys,
-			   netdev_page_pool_stats_get_req& req)
+static void
+netdev_page_pool_stats_get_put(struct nlmsghdr *nlh,
+			       netdev_page_pool_stats_get_req& req)
+{
+	if (req.info.has_value())
+		netdev_page_pool_info_put(nlh, NETDEV_A_PAGE_POOL_STATS_INFO, req.info.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<netdev_page_pool_stats_get_rsp>>
+netdev_page_pool_stats_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+				const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<netdev_page_pool_stats_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_PAGE_POOL_STATS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &netdev_page_pool_stats_nest;
 	yrs.yarg.rsp_policy = &netdev_page_pool_stats_nest;
 
-	if (req.info.has_value())
-		netdev_page_pool_info_put(nlh, NETDEV_A_PAGE_POOL_STATS_INFO, req.info.value());
-
 	rsp.reset(new netdev_page_pool_stats_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = netdev_page_pool_stats_get_rsp_parse;
 	yrs.rsp_cmd = NETDEV_CMD_PAGE_POOL_STATS_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_stats_get_rsp>>
+netdev_page_pool_stats_get_ex(ynl_cpp::ynl_socket&  ys,
+			      netdev_page_pool_stats_get_req& req,
+			      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_PAGE_POOL_STATS_GET, 1);
+	netdev_page_pool_stats_get_put(nlh, req);
+
+	return netdev_page_pool_stats_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_page_pool_stats_get_rsp>
+netdev_page_pool_stats_get(ynl_cpp::ynl_socket&  ys,
+			   netdev_page_pool_stats_get_req& req)
+{
+	auto ret = netdev_page_pool_stats_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_page_pool_stats_get_prepare(ynl_cpp::ynl_socket&  ys,
+				   netdev_page_pool_stats_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_PAGE_POOL_STATS_GET, 1);
+	netdev_page_pool_stats_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_stats_get_rsp>>
+netdev_page_pool_stats_get_ex(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl,
+			      const ynl_cpp::projection *proj)
+{
+	return netdev_page_pool_stats_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<netdev_page_pool_stats_get_rsp>
+netdev_page_pool_stats_get(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl)
+{
+	auto ret = netdev_page_pool_stats_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* NETDEV_CMD_PAGE_POOL_STATS_GET - dump */
-std::unique_ptr<netdev_page_pool_stats_get_list>
-netdev_page_pool_stats_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<netdev_page_pool_stats_get_list>>
+netdev_page_pool_stats_get_dump_exec(ynl_cpp::ynl_socket&  ys,
+				     struct nlmsghdr *nlh,
+				     const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<netdev_page_pool_stats_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &netdev_page_pool_stats_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<netdev_page_pool_stats_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = netdev_page_pool_stats_get_rsp_parse;
 	yds.rsp_cmd = NETDEV_CMD_PAGE_POOL_STATS_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_PAGE_POOL_STATS_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_stats_get_list>>
+netdev_page_pool_stats_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_PAGE_POOL_STATS_GET, 1);
+
+	return netdev_page_pool_stats_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_page_pool_stats_get_list>
+netdev_page_pool_stats_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = netdev_page_pool_stats_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== NETDEV_CMD_QUEUE_GET ============== */
 /* NETDEV_CMD_QUEUE_GET - do */
 int netdev_queue_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -671,25 +935,28 @@ int netdev_queue_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NETDEV_A_QUEUE_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_QUEUE_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->type = (netdev_queue_type)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_QUEUE_NAPI_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->napi_id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_QUEUE_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_QUEUE_DMABUF) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dmabuf = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -697,66 +964,177 @@ int netdev_queue_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<netdev_queue_get_rsp>
-netdev_queue_get(ynl_cpp::ynl_socket&  ys, netdev_queue_get_req& req)
+static void
+netdev_queue_get_put(struct nlmsghdr *nlh, netdev_queue_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_QUEUE_IFINDEX, req.ifindex.value());
+	if (req.type.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_QUEUE_TYPE, req.type.value());
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_QUEUE_ID, req.id.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<netdev_queue_get_rsp>>
+netdev_queue_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<netdev_queue_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_QUEUE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &netdev_queue_nest;
 	yrs.yarg.rsp_policy = &netdev_queue_nest;
 
-	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_QUEUE_IFINDEX, req.ifindex.value());
-	if (req.type.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_QUEUE_TYPE, req.type.value());
-	if (req.id.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_QUEUE_ID, req.id.value());
-
 	rsp.reset(new netdev_queue_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = netdev_queue_get_rsp_parse;
 	yrs.rsp_cmd = NETDEV_CMD_QUEUE_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* NETDEV_CMD_QUEUE_GET - dump */
-std::unique_ptr<netdev_queue_get_list>
-netdev_queue_get_dump(ynl_cpp::ynl_socket&  ys, netdev_queue_get_req_dump& req)
+ynl_cpp::result<std::unique_ptr<netdev_queue_get_rsp>>
+netdev_queue_get_ex(ynl_cpp::ynl_socket&  ys, netdev_queue_get_req& req,
+		    const ynl_cpp::projection *proj)
 {
-	struct ynl_dump_no_alloc_state yds = {};
 	struct nlmsghdr *nlh;
-	int err;
 
-	auto ret = std::make_unique<netdev_queue_get_list>();
-	yds.yarg.ys = ys;
-	yds.yarg.rsp_policy = &netdev_queue_nest;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_QUEUE_GET, 1);
+	netdev_queue_get_put(nlh, req);
+
+	return netdev_queue_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_queue_get_rsp>
+netdev_queue_get(ynl_cpp::ynl_socket&  ys, netdev_queue_get_req& req)
+{
+	auto ret = netdev_queue_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_queue_get_prepare(ynl_cpp::ynl_socket&  ys, netdev_queue_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_QUEUE_GET, 1);
+	netdev_queue_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<netdev_queue_get_rsp>>
+netdev_queue_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return netdev_queue_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<netdev_queue_get_rsp>
+netdev_queue_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = netdev_queue_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* NETDEV_CMD_QUEUE_GET - dump */
+static void
+netdev_queue_get_dump_put(struct nlmsghdr *nlh, netdev_queue_get_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_QUEUE_IFINDEX, req.ifindex.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<netdev_queue_get_list>>
+netdev_queue_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<netdev_queue_get_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &netdev_queue_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<netdev_queue_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = netdev_queue_get_rsp_parse;
 	yds.rsp_cmd = NETDEV_CMD_QUEUE_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_QUEUE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &netdev_queue_nest;
 
-	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_QUEUE_IFINDEX, req.ifindex.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<netdev_queue_get_list>>
+netdev_queue_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 netdev_queue_get_req_dump& req,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_QUEUE_GET, 1);
+	netdev_queue_get_dump_put(nlh, req);
+
+	return netdev_queue_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_queue_get_list>
+netdev_queue_get_dump(ynl_cpp::ynl_socket&  ys, netdev_queue_get_req_dump& req)
+{
+	auto ret = netdev_queue_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_queue_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      netdev_queue_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_QUEUE_GET, 1);
+	netdev_queue_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<netdev_queue_get_list>>
+netdev_queue_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return netdev_queue_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<netdev_queue_get_list>
+netdev_queue_get_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = netdev_queue_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== NETDEV_CMD_NAPI_GET ============== */
 /* NETDEV_CMD_NAPI_GET - do */
 int netdev_napi_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -770,33 +1148,36 @@ int netdev_napi_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NETDEV_A_NAPI_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_NAPI_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_NAPI_IRQ) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->irq = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_NAPI_PID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->pid = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_NAPI_DEFER_HARD_IRQS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->defer_hard_irqs = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_NAPI_GRO_FLUSH_TIMEOUT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->gro_flush_timeout = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_NAPI_IRQ_SUSPEND_TIMEOUT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->irq_suspend_timeout = (__u64)ynl_attr_get_uint(attr);
 		}
 	}
@@ -804,62 +1185,171 @@ int netdev_napi_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<netdev_napi_get_rsp>
-netdev_napi_get(ynl_cpp::ynl_socket&  ys, netdev_napi_get_req& req)
+static void netdev_napi_get_put(struct nlmsghdr *nlh, netdev_napi_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_NAPI_ID, req.id.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<netdev_napi_get_rsp>>
+netdev_napi_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<netdev_napi_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_NAPI_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &netdev_napi_nest;
 	yrs.yarg.rsp_policy = &netdev_napi_nest;
 
-	if (req.id.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_NAPI_ID, req.id.value());
-
 	rsp.reset(new netdev_napi_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = netdev_napi_get_rsp_parse;
 	yrs.rsp_cmd = NETDEV_CMD_NAPI_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<netdev_napi_get_rsp>>
+netdev_napi_get_ex(ynl_cpp::ynl_socket&  ys, netdev_napi_get_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_NAPI_GET, 1);
+	netdev_napi_get_put(nlh, req);
+
+	return netdev_napi_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_napi_get_rsp>
+netdev_napi_get(ynl_cpp::ynl_socket&  ys, netdev_napi_get_req& req)
+{
+	auto ret = netdev_napi_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_napi_get_prepare(ynl_cpp::ynl_socket&  ys, netdev_napi_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_NAPI_GET, 1);
+	netdev_napi_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<netdev_napi_get_rsp>>
+netdev_napi_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return netdev_napi_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<netdev_napi_get_rsp>
+netdev_napi_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = netdev_napi_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* NETDEV_CMD_NAPI_GET - dump */
-std::unique_ptr<netdev_napi_get_list>
-netdev_napi_get_dump(ynl_cpp::ynl_socket&  ys, netdev_napi_get_req_dump& req)
+static void
+netdev_napi_get_dump_put(struct nlmsghdr *nlh, netdev_napi_get_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_NAPI_IFINDEX, req.ifindex.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<netdev_napi_get_list>>
+netdev_napi_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<netdev_napi_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &netdev_napi_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<netdev_napi_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = netdev_napi_get_rsp_parse;
 	yds.rsp_cmd = NETDEV_CMD_NAPI_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_NAPI_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &netdev_napi_nest;
 
-	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_NAPI_IFINDEX, req.ifindex.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<netdev_napi_get_list>>
+netdev_napi_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			netdev_napi_get_req_dump& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_NAPI_GET, 1);
+	netdev_napi_get_dump_put(nlh, req);
+
+	return netdev_napi_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_napi_get_list>
+netdev_napi_get_dump(ynl_cpp::ynl_socket&  ys, netdev_napi_get_req_dump& req)
+{
+	auto ret = netdev_napi_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_napi_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     netdev_napi_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_NAPI_GET, 1);
+	netdev_napi_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<netdev_napi_get_list>>
+netdev_napi_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return netdev_napi_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<netdev_napi_get_list>
+netdev_napi_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = netdev_napi_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== NETDEV_CMD_QSTATS_GET ============== */
 /* NETDEV_CMD_QSTATS_GET - dump */
 int netdev_qstats_get_rsp_dump_parse(const struct nlmsghdr *nlh,
@@ -873,33 +1363,36 @@ int netdev_qstats_get_rsp_dump_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NETDEV_A_QSTATS_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_QSTATS_QUEUE_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->queue_type = (netdev_queue_type)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_QSTATS_QUEUE_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->queue_id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NETDEV_A_QSTATS_RX_PACKETS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->rx_packets = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_QSTATS_RX_BYTES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->rx_bytes = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_QSTATS_TX_PACKETS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->tx_packets = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == NETDEV_A_QSTATS_TX_BYTES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->tx_bytes = (__u64)ynl_attr_get_uint(attr);
 		}
 	}
@@ -907,37 +1400,95 @@ int netdev_qstats_get_rsp_dump_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<netdev_qstats_get_rsp_list>
-netdev_qstats_get_dump(ynl_cpp::ynl_socket&  ys,
-		       netdev_qstats_get_req_dump& req)
+static void
+netdev_qstats_get_dump_put(struct nlmsghdr *nlh,
+			   netdev_qstats_get_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 20 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_QSTATS_IFINDEX, req.ifindex.value());
+	if (req.scope.has_value())
+		ynl_attr_put_uint_unchecked(nlh, NETDEV_A_QSTATS_SCOPE, req.scope.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<netdev_qstats_get_rsp_list>>
+netdev_qstats_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<netdev_qstats_get_rsp_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &netdev_qstats_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<netdev_qstats_get_rsp_list*>(arg)->objs.emplace_back());};
 	yds.cb = netdev_qstats_get_rsp_dump_parse;
 	yds.rsp_cmd = NETDEV_CMD_QSTATS_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_QSTATS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &netdev_qstats_nest;
 
-	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_QSTATS_IFINDEX, req.ifindex.value());
-	if (req.scope.has_value())
-		ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_SCOPE, req.scope.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<netdev_qstats_get_rsp_list>>
+netdev_qstats_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  netdev_qstats_get_req_dump& req,
+			  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_QSTATS_GET, 1);
+	netdev_qstats_get_dump_put(nlh, req);
+
+	return netdev_qstats_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_qstats_get_rsp_list>
+netdev_qstats_get_dump(ynl_cpp::ynl_socket&  ys,
+		       netdev_qstats_get_req_dump& req)
+{
+	auto ret = netdev_qstats_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_qstats_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       netdev_qstats_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_QSTATS_GET, 1);
+	netdev_qstats_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<netdev_qstats_get_rsp_list>>
+netdev_qstats_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj)
+{
+	return netdev_qstats_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<netdev_qstats_get_rsp_list>
+netdev_qstats_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = netdev_qstats_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== NETDEV_CMD_BIND_RX ============== */
 /* NETDEV_CMD_BIND_RX - do */
 int netdev_bind_rx_rsp_parse(const struct nlmsghdr *nlh,
@@ -951,9 +1502,12 @@ int netdev_bind_rx_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NETDEV_A_DMABUF_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -961,62 +1515,169 @@ int netdev_bind_rx_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<netdev_bind_rx_rsp>
-netdev_bind_rx(ynl_cpp::ynl_socket&  ys, netdev_bind_rx_req& req)
+static void netdev_bind_rx_put(struct nlmsghdr *nlh, netdev_bind_rx_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_DMABUF_IFINDEX, req.ifindex.value());
+	if (req.fd.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_DMABUF_FD, req.fd.value());
+	for (unsigned int i = 0; i < req.queues.size(); i++)
+		netdev_queue_id_put(nlh, NETDEV_A_DMABUF_QUEUES, req.queues[i]);
+}
+
+static ynl_cpp::result<std::unique_ptr<netdev_bind_rx_rsp>>
+netdev_bind_rx_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		    const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<netdev_bind_rx_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_BIND_RX, 1);
 	((struct ynl_sock*)ys)->req_policy = &netdev_dmabuf_nest;
 	yrs.yarg.rsp_policy = &netdev_dmabuf_nest;
 
-	if (req.ifindex.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_DMABUF_IFINDEX, req.ifindex.value());
-	if (req.fd.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_DMABUF_FD, req.fd.value());
-	for (unsigned int i = 0; i < req.queues.size(); i++)
-		netdev_queue_id_put(nlh, NETDEV_A_DMABUF_QUEUES, req.queues[i]);
-
 	rsp.reset(new netdev_bind_rx_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = netdev_bind_rx_rsp_parse;
 	yrs.rsp_cmd = NETDEV_CMD_BIND_RX;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* ============== NETDEV_CMD_NAPI_SET ============== */
-/* NETDEV_CMD_NAPI_SET - do */
-int netdev_napi_set(ynl_cpp::ynl_socket&  ys, netdev_napi_set_req& req)
+ynl_cpp::result<std::unique_ptr<netdev_bind_rx_rsp>>
+netdev_bind_rx_ex(ynl_cpp::ynl_socket&  ys, netdev_bind_rx_req& req,
+		  const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_NAPI_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &netdev_napi_nest;
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_BIND_RX, 1);
+	netdev_bind_rx_put(nlh, req);
+
+	return netdev_bind_rx_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<netdev_bind_rx_rsp>
+netdev_bind_rx(ynl_cpp::ynl_socket&  ys, netdev_bind_rx_req& req)
+{
+	auto ret = netdev_bind_rx_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_bind_rx_prepare(ynl_cpp::ynl_socket&  ys, netdev_bind_rx_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_BIND_RX, 1);
+	netdev_bind_rx_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<netdev_bind_rx_rsp>>
+netdev_bind_rx_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj)
+{
+	return netdev_bind_rx_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<netdev_bind_rx_rsp>
+netdev_bind_rx(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = netdev_bind_rx_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== NETDEV_CMD_NAPI_SET ============== */
+/* NETDEV_CMD_NAPI_SET - do */
+static void netdev_napi_set_put(struct nlmsghdr *nlh, netdev_napi_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 40 <= YNL_SOCKET_BUFFER_SIZE);
 
 	if (req.id.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_NAPI_ID, req.id.value());
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_NAPI_ID, req.id.value());
 	if (req.defer_hard_irqs.has_value())
-		ynl_attr_put_u32(nlh, NETDEV_A_NAPI_DEFER_HARD_IRQS, req.defer_hard_irqs.value());
+		ynl_attr_put_u32_unchecked(nlh, NETDEV_A_NAPI_DEFER_HARD_IRQS, req.defer_hard_irqs.value());
 	if (req.gro_flush_timeout.has_value())
-		ynl_attr_put_uint(nlh, NETDEV_A_NAPI_GRO_FLUSH_TIMEOUT, req.gro_flush_timeout.value());
+		ynl_attr_put_uint_unchecked(nlh, NETDEV_A_NAPI_GRO_FLUSH_TIMEOUT, req.gro_flush_timeout.value());
 	if (req.irq_suspend_timeout.has_value())
-		ynl_attr_put_uint(nlh, NETDEV_A_NAPI_IRQ_SUSPEND_TIMEOUT, req.irq_suspend_timeout.value());
+		ynl_attr_put_uint_unchecked(nlh, NETDEV_A_NAPI_IRQ_SUSPEND_TIMEOUT, req.irq_suspend_timeout.value());
+}
+
+static ynl_cpp::result<void>
+netdev_napi_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &netdev_napi_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+netdev_napi_set_ex(ynl_cpp::ynl_socket&  ys, netdev_napi_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_NAPI_SET, 1);
+	netdev_napi_set_put(nlh, req);
+
+	return netdev_napi_set_exec(ys, nlh);
+}
+
+int netdev_napi_set(ynl_cpp::ynl_socket&  ys, netdev_napi_set_req& req)
+{
+	auto ret = netdev_napi_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_napi_set_prepare(ynl_cpp::ynl_socket&  ys, netdev_napi_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NETDEV_CMD_NAPI_SET, 1);
+	netdev_napi_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+netdev_napi_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return netdev_napi_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int netdev_napi_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = netdev_napi_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+netdev_napi_set_batch(ynl_cpp::msg_batch& batch, netdev_napi_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(NETDEV_CMD_NAPI_SET, 1);
+	netdev_napi_set_put(nlh, req);
+	return batch.msg_end(nlh, &netdev_napi_nest);
 }
 
 static constexpr std::array<ynl_ntf_info, NETDEV_CMD_PAGE_POOL_CHANGE_NTF + 1> netdev_ntf_info = []() {
@@ -1024,26 +1685,44 @@ static constexpr std::array<ynl_ntf_info, NETDEV_CMD_PAGE_POOL_CHANGE_NTF + 1> n
 	arr[NETDEV_CMD_DEV_ADD_NTF] =  {
 		.cb		= netdev_dev_get_rsp_parse,
 		.policy		= &netdev_dev_nest,
+		.alloc_sz	= sizeof(netdev_dev_get_ntf),
+		.free		= netdev_dev_get_ntf_free,
+		.init		= netdev_dev_get_ntf_init,
 	};
 	arr[NETDEV_CMD_DEV_DEL_NTF] =  {
 		.cb		= netdev_dev_get_rsp_parse,
 		.policy		= &netdev_dev_nest,
+		.alloc_sz	= sizeof(netdev_dev_get_ntf),
+		.free		= netdev_dev_get_ntf_free,
+		.init		= netdev_dev_get_ntf_init,
 	};
 	arr[NETDEV_CMD_DEV_CHANGE_NTF] =  {
 		.cb		= netdev_dev_get_rsp_parse,
 		.policy		= &netdev_dev_nest,
+		.alloc_sz	= sizeof(netdev_dev_get_ntf),
+		.free		= netdev_dev_get_ntf_free,
+		.init		= netdev_dev_get_ntf_init,
 	};
 	arr[NETDEV_CMD_PAGE_POOL_ADD_NTF] =  {
 		.cb		= netdev_page_pool_get_rsp_parse,
 		.policy		= &netdev_page_pool_nest,
+		.alloc_sz	= sizeof(netdev_page_pool_get_ntf),
+		.free		= netdev_page_pool_get_ntf_free,
+		.init		= netdev_page_pool_get_ntf_init,
 	};
 	arr[NETDEV_CMD_PAGE_POOL_DEL_NTF] =  {
 		.cb		= netdev_page_pool_get_rsp_parse,
 		.policy		= &netdev_page_pool_nest,
+		.alloc_sz	= sizeof(netdev_page_pool_get_ntf),
+		.free		= netdev_page_pool_get_ntf_free,
+		.init		= netdev_page_pool_get_ntf_init,
 	};
 	arr[NETDEV_CMD_PAGE_POOL_CHANGE_NTF] =  {
 		.cb		= netdev_page_pool_get_rsp_parse,
 		.policy		= &netdev_page_pool_nest,
+		.alloc_sz	= sizeof(netdev_page_pool_get_ntf),
+		.free		= netdev_page_pool_get_ntf_free,
+		.init		= netdev_page_pool_get_ntf_init,
 	};
 	return arr;
 } ();
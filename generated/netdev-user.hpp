@@ -43,12 +43,30 @@ struct netdev_queue_id {
 	std::optional<netdev_queue_type> type;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest netdev_page_pool_info_nest;
+extern struct ynl_policy_nest netdev_queue_id_nest;
+extern struct ynl_policy_nest netdev_dev_nest;
+extern struct ynl_policy_nest netdev_page_pool_nest;
+extern struct ynl_policy_nest netdev_page_pool_stats_nest;
+extern struct ynl_policy_nest netdev_queue_nest;
+extern struct ynl_policy_nest netdev_napi_nest;
+extern struct ynl_policy_nest netdev_qstats_nest;
+extern struct ynl_policy_nest netdev_dmabuf_nest;
+int netdev_page_pool_info_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			      const netdev_page_pool_info&  obj);
+int netdev_queue_id_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			const netdev_queue_id&  obj);
+
 /* ============== NETDEV_CMD_DEV_GET ============== */
 /* NETDEV_CMD_DEV_GET - do */
 struct netdev_dev_get_req {
 	std::optional<__u32> ifindex;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t netdev_dev_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct netdev_dev_get_rsp {
 	std::optional<__u32> ifindex;
 	std::optional<__u64> xdp_features;
@@ -62,6 +80,16 @@ struct netdev_dev_get_rsp {
  */
 std::unique_ptr<netdev_dev_get_rsp>
 netdev_dev_get(ynl_cpp::ynl_socket&  ys, netdev_dev_get_req& req);
+ynl_cpp::result<std::unique_ptr<netdev_dev_get_rsp>>
+netdev_dev_get_ex(ynl_cpp::ynl_socket&  ys, netdev_dev_get_req& req,
+		  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_dev_get_prepare(ynl_cpp::ynl_socket&  ys, netdev_dev_get_req& req);
+std::unique_ptr<netdev_dev_get_rsp>
+netdev_dev_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<netdev_dev_get_rsp>>
+netdev_dev_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj = nullptr);
 
 /* NETDEV_CMD_DEV_GET - dump */
 struct netdev_dev_get_list {
@@ -70,9 +98,18 @@ struct netdev_dev_get_list {
 
 std::unique_ptr<netdev_dev_get_list>
 netdev_dev_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<netdev_dev_get_list>>
+netdev_dev_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		       const ynl_cpp::projection *proj = nullptr);
 
 /* NETDEV_CMD_DEV_GET - notify */
 struct netdev_dev_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	netdev_dev_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== NETDEV_CMD_PAGE_POOL_GET ============== */
@@ -81,6 +118,9 @@ struct netdev_page_pool_get_req {
 	std::optional<__u64> id;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t netdev_page_pool_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 12;
+
 struct netdev_page_pool_get_rsp {
 	std::optional<__u64> id;
 	std::optional<__u32> ifindex;
@@ -98,6 +138,19 @@ struct netdev_page_pool_get_rsp {
  */
 std::unique_ptr<netdev_page_pool_get_rsp>
 netdev_page_pool_get(ynl_cpp::ynl_socket&  ys, netdev_page_pool_get_req& req);
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_get_rsp>>
+netdev_page_pool_get_ex(ynl_cpp::ynl_socket&  ys,
+			netdev_page_pool_get_req& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_page_pool_get_prepare(ynl_cpp::ynl_socket&  ys,
+			     netdev_page_pool_get_req& req);
+std::unique_ptr<netdev_page_pool_get_rsp>
+netdev_page_pool_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_get_rsp>>
+netdev_page_pool_get_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* NETDEV_CMD_PAGE_POOL_GET - dump */
 struct netdev_page_pool_get_list {
@@ -106,9 +159,18 @@ struct netdev_page_pool_get_list {
 
 std::unique_ptr<netdev_page_pool_get_list>
 netdev_page_pool_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_get_list>>
+netdev_page_pool_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     const ynl_cpp::projection *proj = nullptr);
 
 /* NETDEV_CMD_PAGE_POOL_GET - notify */
 struct netdev_page_pool_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	netdev_page_pool_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== NETDEV_CMD_PAGE_POOL_STATS_GET ============== */
@@ -117,6 +179,9 @@ struct netdev_page_pool_stats_get_req {
 	std::optional<netdev_page_pool_info> info;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t netdev_page_pool_stats_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 24;
+
 struct netdev_page_pool_stats_get_rsp {
 	std::optional<netdev_page_pool_info> info;
 	std::optional<__u64> alloc_fast;
@@ -138,6 +203,20 @@ struct netdev_page_pool_stats_get_rsp {
 std::unique_ptr<netdev_page_pool_stats_get_rsp>
 netdev_page_pool_stats_get(ynl_cpp::ynl_socket&  ys,
 			   netdev_page_pool_stats_get_req& req);
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_stats_get_rsp>>
+netdev_page_pool_stats_get_ex(ynl_cpp::ynl_socket&  ys,
+			      netdev_page_pool_stats_get_req& req,
+			      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_page_pool_stats_get_prepare(ynl_cpp::ynl_socket&  ys,
+				   netdev_page_pool_stats_get_req& req);
+std::unique_ptr<netdev_page_pool_stats_get_rsp>
+netdev_page_pool_stats_get(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_stats_get_rsp>>
+netdev_page_pool_stats_get_ex(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl,
+			      const ynl_cpp::projection *proj = nullptr);
 
 /* NETDEV_CMD_PAGE_POOL_STATS_GET - dump */
 struct netdev_page_pool_stats_get_list {
@@ -146,6 +225,9 @@ struct netdev_page_pool_stats_get_list {
 
 std::unique_ptr<netdev_page_pool_stats_get_list>
 netdev_page_pool_stats_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<netdev_page_pool_stats_get_list>>
+netdev_page_pool_stats_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+				   const ynl_cpp::projection *proj = nullptr);
 
 /* ============== NETDEV_CMD_QUEUE_GET ============== */
 /* NETDEV_CMD_QUEUE_GET - do */
@@ -155,6 +237,9 @@ struct netdev_queue_get_req {
 	std::optional<__u32> id;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t netdev_queue_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 24;
+
 struct netdev_queue_get_rsp {
 	std::optional<__u32> id;
 	std::optional<netdev_queue_type> type;
@@ -168,18 +253,45 @@ struct netdev_queue_get_rsp {
  */
 std::unique_ptr<netdev_queue_get_rsp>
 netdev_queue_get(ynl_cpp::ynl_socket&  ys, netdev_queue_get_req& req);
+ynl_cpp::result<std::unique_ptr<netdev_queue_get_rsp>>
+netdev_queue_get_ex(ynl_cpp::ynl_socket&  ys, netdev_queue_get_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_queue_get_prepare(ynl_cpp::ynl_socket&  ys, netdev_queue_get_req& req);
+std::unique_ptr<netdev_queue_get_rsp>
+netdev_queue_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<netdev_queue_get_rsp>>
+netdev_queue_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* NETDEV_CMD_QUEUE_GET - dump */
 struct netdev_queue_get_req_dump {
 	std::optional<__u32> ifindex;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t netdev_queue_get_req_dump_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct netdev_queue_get_list {
 	std::list<netdev_queue_get_rsp> objs;
 };
 
 std::unique_ptr<netdev_queue_get_list>
 netdev_queue_get_dump(ynl_cpp::ynl_socket&  ys, netdev_queue_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<netdev_queue_get_list>>
+netdev_queue_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 netdev_queue_get_req_dump& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_queue_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      netdev_queue_get_req_dump& req);
+std::unique_ptr<netdev_queue_get_list>
+netdev_queue_get_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<netdev_queue_get_list>>
+netdev_queue_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* ============== NETDEV_CMD_NAPI_GET ============== */
 /* NETDEV_CMD_NAPI_GET - do */
@@ -187,6 +299,9 @@ struct netdev_napi_get_req {
 	std::optional<__u32> id;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t netdev_napi_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct netdev_napi_get_rsp {
 	std::optional<__u32> id;
 	std::optional<__u32> ifindex;
@@ -202,18 +317,44 @@ struct netdev_napi_get_rsp {
  */
 std::unique_ptr<netdev_napi_get_rsp>
 netdev_napi_get(ynl_cpp::ynl_socket&  ys, netdev_napi_get_req& req);
+ynl_cpp::result<std::unique_ptr<netdev_napi_get_rsp>>
+netdev_napi_get_ex(ynl_cpp::ynl_socket&  ys, netdev_napi_get_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_napi_get_prepare(ynl_cpp::ynl_socket&  ys, netdev_napi_get_req& req);
+std::unique_ptr<netdev_napi_get_rsp>
+netdev_napi_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<netdev_napi_get_rsp>>
+netdev_napi_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
 
 /* NETDEV_CMD_NAPI_GET - dump */
 struct netdev_napi_get_req_dump {
 	std::optional<__u32> ifindex;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t netdev_napi_get_req_dump_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct netdev_napi_get_list {
 	std::list<netdev_napi_get_rsp> objs;
 };
 
 std::unique_ptr<netdev_napi_get_list>
 netdev_napi_get_dump(ynl_cpp::ynl_socket&  ys, netdev_napi_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<netdev_napi_get_list>>
+netdev_napi_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			netdev_napi_get_req_dump& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_napi_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     netdev_napi_get_req_dump& req);
+std::unique_ptr<netdev_napi_get_list>
+netdev_napi_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<netdev_napi_get_list>>
+netdev_napi_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ============== NETDEV_CMD_QSTATS_GET ============== */
 /* NETDEV_CMD_QSTATS_GET - dump */
@@ -222,6 +363,9 @@ struct netdev_qstats_get_req_dump {
 	std::optional<__u64> scope;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t netdev_qstats_get_req_dump_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 20;
+
 struct netdev_qstats_get_rsp_dump {
 	std::optional<__u32> ifindex;
 	std::optional<netdev_queue_type> queue_type;
@@ -239,6 +383,20 @@ struct netdev_qstats_get_rsp_list {
 std::unique_ptr<netdev_qstats_get_rsp_list>
 netdev_qstats_get_dump(ynl_cpp::ynl_socket&  ys,
 		       netdev_qstats_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<netdev_qstats_get_rsp_list>>
+netdev_qstats_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  netdev_qstats_get_req_dump& req,
+			  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_qstats_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       netdev_qstats_get_req_dump& req);
+std::unique_ptr<netdev_qstats_get_rsp_list>
+netdev_qstats_get_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<netdev_qstats_get_rsp_list>>
+netdev_qstats_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj = nullptr);
 
 /* ============== NETDEV_CMD_BIND_RX ============== */
 /* NETDEV_CMD_BIND_RX - do */
@@ -257,6 +415,16 @@ struct netdev_bind_rx_rsp {
  */
 std::unique_ptr<netdev_bind_rx_rsp>
 netdev_bind_rx(ynl_cpp::ynl_socket&  ys, netdev_bind_rx_req& req);
+ynl_cpp::result<std::unique_ptr<netdev_bind_rx_rsp>>
+netdev_bind_rx_ex(ynl_cpp::ynl_socket&  ys, netdev_bind_rx_req& req,
+		  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_bind_rx_prepare(ynl_cpp::ynl_socket&  ys, netdev_bind_rx_req& req);
+std::unique_ptr<netdev_bind_rx_rsp>
+netdev_bind_rx(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<netdev_bind_rx_rsp>>
+netdev_bind_rx_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj = nullptr);
 
 /* ============== NETDEV_CMD_NAPI_SET ============== */
 /* NETDEV_CMD_NAPI_SET - do */
@@ -267,10 +435,22 @@ struct netdev_napi_set_req {
 	std::optional<__u64> irq_suspend_timeout;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t netdev_napi_set_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 40;
+
 /*
  * Set configurable NAPI instance settings.
  */
 int netdev_napi_set(ynl_cpp::ynl_socket&  ys, netdev_napi_set_req& req);
+ynl_cpp::result<void>
+netdev_napi_set_ex(ynl_cpp::ynl_socket&  ys, netdev_napi_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+netdev_napi_set_prepare(ynl_cpp::ynl_socket&  ys, netdev_napi_set_req& req);
+int netdev_napi_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+netdev_napi_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+netdev_napi_set_batch(ynl_cpp::msg_batch& batch, netdev_napi_set_req& req);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_NETDEV_GEN_H */
@@ -160,16 +160,15 @@ int nfsd_version_parse(struct ynl_parse_arg *yarg, const struct nlattr *nested)
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == NFSD_A_VERSION_MAJOR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->major = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NFSD_A_VERSION_MINOR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->minor = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NFSD_A_VERSION_ENABLED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->enabled = true;
 		}
 	}
 
@@ -200,15 +199,13 @@ int nfsd_sock_parse(struct ynl_parse_arg *yarg, const struct nlattr *nested)
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == NFSD_A_SOCK_ADDR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->addr.assign(data, data + len);
 		} else if (type == NFSD_A_SOCK_TRANSPORT_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->transport_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->transport_name.assign(ynl_attr_get_str(attr));
 		}
 	}
 
@@ -233,57 +230,56 @@ int nfsd_rpc_status_get_rsp_dump_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NFSD_A_RPC_STATUS_XID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->xid = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NFSD_A_RPC_STATUS_FLAGS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->flags = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NFSD_A_RPC_STATUS_PROG) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->prog = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NFSD_A_RPC_STATUS_VERSION) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->version = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == NFSD_A_RPC_STATUS_PROC) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->proc = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NFSD_A_RPC_STATUS_SERVICE_TIME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s64))
+				return ynl_attr_invalid(yarg, attr, "s64");
 			dst->service_time = (__s64)ynl_attr_get_s64(attr);
 		} else if (type == NFSD_A_RPC_STATUS_SADDR4) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->saddr4 = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NFSD_A_RPC_STATUS_DADDR4) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->daddr4 = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NFSD_A_RPC_STATUS_SADDR6) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->saddr6.assign(data, data + len);
 		} else if (type == NFSD_A_RPC_STATUS_DADDR6) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->daddr6.assign(data, data + len);
 		} else if (type == NFSD_A_RPC_STATUS_SPORT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->sport = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == NFSD_A_RPC_STATUS_DPORT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->dport = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == NFSD_A_RPC_STATUS_COMPOUND_OPS) {
 			n_compound_ops++;
@@ -304,55 +300,129 @@ int nfsd_rpc_status_get_rsp_dump_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<nfsd_rpc_status_get_rsp_list>
-nfsd_rpc_status_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<nfsd_rpc_status_get_rsp_list>>
+nfsd_rpc_status_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			      const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<nfsd_rpc_status_get_rsp_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &nfsd_rpc_status_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<nfsd_rpc_status_get_rsp_list*>(arg)->objs.emplace_back());};
 	yds.cb = nfsd_rpc_status_get_rsp_dump_parse;
 	yds.rsp_cmd = NFSD_CMD_RPC_STATUS_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_RPC_STATUS_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ============== NFSD_CMD_THREADS_SET ============== */
-/* NFSD_CMD_THREADS_SET - do */
-int nfsd_threads_set(ynl_cpp::ynl_socket&  ys, nfsd_threads_set_req& req)
+ynl_cpp::result<std::unique_ptr<nfsd_rpc_status_get_rsp_list>>
+nfsd_rpc_status_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			    const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_THREADS_SET, 1);
-	((struct ynl_sock*)ys)->req_policy = &nfsd_server_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_RPC_STATUS_GET, 1);
+
+	return nfsd_rpc_status_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nfsd_rpc_status_get_rsp_list>
+nfsd_rpc_status_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = nfsd_rpc_status_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== NFSD_CMD_THREADS_SET ============== */
+/* NFSD_CMD_THREADS_SET - do */
+static void
+nfsd_threads_set_put(struct nlmsghdr *nlh, nfsd_threads_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
 
-	for (unsigned int i = 0; i < req.threads.size(); i++)
-		ynl_attr_put_u32(nlh, NFSD_A_SERVER_THREADS, req.threads[i]);
 	if (req.gracetime.has_value())
-		ynl_attr_put_u32(nlh, NFSD_A_SERVER_GRACETIME, req.gracetime.value());
+		ynl_attr_put_u32_unchecked(nlh, NFSD_A_SERVER_GRACETIME, req.gracetime.value());
 	if (req.leasetime.has_value())
-		ynl_attr_put_u32(nlh, NFSD_A_SERVER_LEASETIME, req.leasetime.value());
+		ynl_attr_put_u32_unchecked(nlh, NFSD_A_SERVER_LEASETIME, req.leasetime.value());
+	for (unsigned int i = 0; i < req.threads.size(); i++)
+		ynl_attr_put_u32(nlh, NFSD_A_SERVER_THREADS, req.threads[i]);
 	if (req.scope.size() > 0)
 		ynl_attr_put_str(nlh, NFSD_A_SERVER_SCOPE, req.scope.data());
+}
+
+static ynl_cpp::result<void>
+nfsd_threads_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nfsd_server_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+nfsd_threads_set_ex(ynl_cpp::ynl_socket&  ys, nfsd_threads_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_THREADS_SET, 1);
+	nfsd_threads_set_put(nlh, req);
+
+	return nfsd_threads_set_exec(ys, nlh);
+}
+
+int nfsd_threads_set(ynl_cpp::ynl_socket&  ys, nfsd_threads_set_req& req)
+{
+	auto ret = nfsd_threads_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nfsd_threads_set_prepare(ynl_cpp::ynl_socket&  ys, nfsd_threads_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_THREADS_SET, 1);
+	nfsd_threads_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+nfsd_threads_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nfsd_threads_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nfsd_threads_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nfsd_threads_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nfsd_threads_set_batch(ynl_cpp::msg_batch& batch, nfsd_threads_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(NFSD_CMD_THREADS_SET, 1);
+	nfsd_threads_set_put(nlh, req);
+	return batch.msg_end(nlh, &nfsd_server_nest);
 }
 
 /* ============== NFSD_CMD_THREADS_GET ============== */
@@ -373,20 +443,23 @@ int nfsd_threads_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NFSD_A_SERVER_THREADS) {
 			n_threads++;
 		} else if (type == NFSD_A_SERVER_GRACETIME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->gracetime = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NFSD_A_SERVER_LEASETIME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->leasetime = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NFSD_A_SERVER_SCOPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->scope.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->scope.assign(ynl_attr_get_str(attr));
 		}
 	}
 
@@ -404,49 +477,121 @@ int nfsd_threads_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<nfsd_threads_get_rsp>
-nfsd_threads_get(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<nfsd_threads_get_rsp>>
+nfsd_threads_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<nfsd_threads_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_THREADS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &nfsd_server_nest;
 	yrs.yarg.rsp_policy = &nfsd_server_nest;
 
 	rsp.reset(new nfsd_threads_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = nfsd_threads_get_rsp_parse;
 	yrs.rsp_cmd = NFSD_CMD_THREADS_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<nfsd_threads_get_rsp>>
+nfsd_threads_get_ex(ynl_cpp::ynl_socket&  ys, const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_THREADS_GET, 1);
+
+	return nfsd_threads_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nfsd_threads_get_rsp>
+nfsd_threads_get(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = nfsd_threads_get_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== NFSD_CMD_VERSION_SET ============== */
 /* NFSD_CMD_VERSION_SET - do */
-int nfsd_version_set(ynl_cpp::ynl_socket&  ys, nfsd_version_set_req& req)
+static void
+nfsd_version_set_put(struct nlmsghdr *nlh, nfsd_version_set_req& req)
+{
+	for (unsigned int i = 0; i < req.version.size(); i++)
+		nfsd_version_put(nlh, NFSD_A_SERVER_PROTO_VERSION, req.version[i]);
+}
+
+static ynl_cpp::result<void>
+nfsd_version_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_VERSION_SET, 1);
 	((struct ynl_sock*)ys)->req_policy = &nfsd_server_proto_nest;
 
-	for (unsigned int i = 0; i < req.version.size(); i++)
-		nfsd_version_put(nlh, NFSD_A_SERVER_PROTO_VERSION, req.version[i]);
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+nfsd_version_set_ex(ynl_cpp::ynl_socket&  ys, nfsd_version_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_VERSION_SET, 1);
+	nfsd_version_set_put(nlh, req);
+
+	return nfsd_version_set_exec(ys, nlh);
+}
+
+int nfsd_version_set(ynl_cpp::ynl_socket&  ys, nfsd_version_set_req& req)
+{
+	auto ret = nfsd_version_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nfsd_version_set_prepare(ynl_cpp::ynl_socket&  ys, nfsd_version_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_VERSION_SET, 1);
+	nfsd_version_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+nfsd_version_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nfsd_version_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nfsd_version_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nfsd_version_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nfsd_version_set_batch(ynl_cpp::msg_batch& batch, nfsd_version_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(NFSD_CMD_VERSION_SET, 1);
+	nfsd_version_set_put(nlh, req);
+	return batch.msg_end(nlh, &nfsd_server_proto_nest);
 }
 
 /* ============== NFSD_CMD_VERSION_GET ============== */
@@ -469,6 +614,9 @@ int nfsd_version_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NFSD_A_SERVER_PROTO_VERSION) {
 			n_version++;
 		}
@@ -491,49 +639,122 @@ int nfsd_version_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<nfsd_version_get_rsp>
-nfsd_version_get(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<nfsd_version_get_rsp>>
+nfsd_version_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<nfsd_version_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_VERSION_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &nfsd_server_proto_nest;
 	yrs.yarg.rsp_policy = &nfsd_server_proto_nest;
 
 	rsp.reset(new nfsd_version_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = nfsd_version_get_rsp_parse;
 	yrs.rsp_cmd = NFSD_CMD_VERSION_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<nfsd_version_get_rsp>>
+nfsd_version_get_ex(ynl_cpp::ynl_socket&  ys, const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_VERSION_GET, 1);
+
+	return nfsd_version_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nfsd_version_get_rsp>
+nfsd_version_get(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = nfsd_version_get_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== NFSD_CMD_LISTENER_SET ============== */
 /* NFSD_CMD_LISTENER_SET - do */
-int nfsd_listener_set(ynl_cpp::ynl_socket&  ys, nfsd_listener_set_req& req)
+static void
+nfsd_listener_set_put(struct nlmsghdr *nlh, nfsd_listener_set_req& req)
+{
+	for (unsigned int i = 0; i < req.addr.size(); i++)
+		nfsd_sock_put(nlh, NFSD_A_SERVER_SOCK_ADDR, req.addr[i]);
+}
+
+static ynl_cpp::result<void>
+nfsd_listener_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_LISTENER_SET, 1);
 	((struct ynl_sock*)ys)->req_policy = &nfsd_server_sock_nest;
 
-	for (unsigned int i = 0; i < req.addr.size(); i++)
-		nfsd_sock_put(nlh, NFSD_A_SERVER_SOCK_ADDR, req.addr[i]);
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+nfsd_listener_set_ex(ynl_cpp::ynl_socket&  ys, nfsd_listener_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_LISTENER_SET, 1);
+	nfsd_listener_set_put(nlh, req);
+
+	return nfsd_listener_set_exec(ys, nlh);
+}
+
+int nfsd_listener_set(ynl_cpp::ynl_socket&  ys, nfsd_listener_set_req& req)
+{
+	auto ret = nfsd_listener_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nfsd_listener_set_prepare(ynl_cpp::ynl_socket&  ys, nfsd_listener_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_LISTENER_SET, 1);
+	nfsd_listener_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+nfsd_listener_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nfsd_listener_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nfsd_listener_set(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = nfsd_listener_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nfsd_listener_set_batch(ynl_cpp::msg_batch& batch, nfsd_listener_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(NFSD_CMD_LISTENER_SET, 1);
+	nfsd_listener_set_put(nlh, req);
+	return batch.msg_end(nlh, &nfsd_server_sock_nest);
 }
 
 /* ============== NFSD_CMD_LISTENER_GET ============== */
@@ -556,6 +777,9 @@ int nfsd_listener_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NFSD_A_SERVER_SOCK_ADDR) {
 			n_addr++;
 		}
@@ -578,49 +802,125 @@ int nfsd_listener_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<nfsd_listener_get_rsp>
-nfsd_listener_get(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<nfsd_listener_get_rsp>>
+nfsd_listener_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<nfsd_listener_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_LISTENER_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &nfsd_server_sock_nest;
 	yrs.yarg.rsp_policy = &nfsd_server_sock_nest;
 
 	rsp.reset(new nfsd_listener_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = nfsd_listener_get_rsp_parse;
 	yrs.rsp_cmd = NFSD_CMD_LISTENER_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<nfsd_listener_get_rsp>>
+nfsd_listener_get_ex(ynl_cpp::ynl_socket&  ys, const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_LISTENER_GET, 1);
+
+	return nfsd_listener_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nfsd_listener_get_rsp>
+nfsd_listener_get(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = nfsd_listener_get_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== NFSD_CMD_POOL_MODE_SET ============== */
 /* NFSD_CMD_POOL_MODE_SET - do */
-int nfsd_pool_mode_set(ynl_cpp::ynl_socket&  ys, nfsd_pool_mode_set_req& req)
+static void
+nfsd_pool_mode_set_put(struct nlmsghdr *nlh, nfsd_pool_mode_set_req& req)
+{
+	if (req.mode.size() > 0)
+		ynl_attr_put_str(nlh, NFSD_A_POOL_MODE_MODE, req.mode.data());
+}
+
+static ynl_cpp::result<void>
+nfsd_pool_mode_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_POOL_MODE_SET, 1);
 	((struct ynl_sock*)ys)->req_policy = &nfsd_pool_mode_nest;
 
-	if (req.mode.size() > 0)
-		ynl_attr_put_str(nlh, NFSD_A_POOL_MODE_MODE, req.mode.data());
-
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+nfsd_pool_mode_set_ex(ynl_cpp::ynl_socket&  ys, nfsd_pool_mode_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_POOL_MODE_SET, 1);
+	nfsd_pool_mode_set_put(nlh, req);
+
+	return nfsd_pool_mode_set_exec(ys, nlh);
+}
+
+int nfsd_pool_mode_set(ynl_cpp::ynl_socket&  ys, nfsd_pool_mode_set_req& req)
+{
+	auto ret = nfsd_pool_mode_set_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nfsd_pool_mode_set_prepare(ynl_cpp::ynl_socket&  ys,
+			   nfsd_pool_mode_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_POOL_MODE_SET, 1);
+	nfsd_pool_mode_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+nfsd_pool_mode_set_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	return nfsd_pool_mode_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nfsd_pool_mode_set(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = nfsd_pool_mode_set_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nfsd_pool_mode_set_batch(ynl_cpp::msg_batch& batch,
+			 nfsd_pool_mode_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(NFSD_CMD_POOL_MODE_SET, 1);
+	nfsd_pool_mode_set_put(nlh, req);
+	return batch.msg_end(nlh, &nfsd_pool_mode_nest);
 }
 
 /* ============== NFSD_CMD_POOL_MODE_GET ============== */
@@ -636,13 +936,16 @@ int nfsd_pool_mode_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == NFSD_A_POOL_MODE_MODE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->mode.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->mode.assign(ynl_attr_get_str(attr));
 		} else if (type == NFSD_A_POOL_MODE_NPOOLS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->npools = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -650,30 +953,50 @@ int nfsd_pool_mode_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<nfsd_pool_mode_get_rsp>
-nfsd_pool_mode_get(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<nfsd_pool_mode_get_rsp>>
+nfsd_pool_mode_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<nfsd_pool_mode_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_POOL_MODE_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &nfsd_pool_mode_nest;
 	yrs.yarg.rsp_policy = &nfsd_pool_mode_nest;
 
 	rsp.reset(new nfsd_pool_mode_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = nfsd_pool_mode_get_rsp_parse;
 	yrs.rsp_cmd = NFSD_CMD_POOL_MODE_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<nfsd_pool_mode_get_rsp>>
+nfsd_pool_mode_get_ex(ynl_cpp::ynl_socket&  ys,
+		      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, NFSD_CMD_POOL_MODE_GET, 1);
+
+	return nfsd_pool_mode_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nfsd_pool_mode_get_rsp>
+nfsd_pool_mode_get(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = nfsd_pool_mode_get_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 const struct ynl_family ynl_nfsd_family =  {
 	.name		= "nfsd",
 	.hdr_len	= sizeof(struct genlmsghdr),
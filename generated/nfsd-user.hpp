@@ -39,6 +39,19 @@ struct nfsd_sock {
 	std::string transport_name;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest nfsd_version_nest;
+extern struct ynl_policy_nest nfsd_sock_nest;
+extern struct ynl_policy_nest nfsd_rpc_status_nest;
+extern struct ynl_policy_nest nfsd_server_nest;
+extern struct ynl_policy_nest nfsd_server_proto_nest;
+extern struct ynl_policy_nest nfsd_server_sock_nest;
+extern struct ynl_policy_nest nfsd_pool_mode_nest;
+int nfsd_version_put(struct nlmsghdr *nlh, unsigned int attr_type,
+		     const nfsd_version&  obj);
+int nfsd_sock_put(struct nlmsghdr *nlh, unsigned int attr_type,
+		  const nfsd_sock&  obj);
+
 /* ============== NFSD_CMD_RPC_STATUS_GET ============== */
 /* NFSD_CMD_RPC_STATUS_GET - dump */
 struct nfsd_rpc_status_get_rsp_dump {
@@ -63,6 +76,9 @@ struct nfsd_rpc_status_get_rsp_list {
 
 std::unique_ptr<nfsd_rpc_status_get_rsp_list>
 nfsd_rpc_status_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<nfsd_rpc_status_get_rsp_list>>
+nfsd_rpc_status_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== NFSD_CMD_THREADS_SET ============== */
 /* NFSD_CMD_THREADS_SET - do */
@@ -77,6 +93,15 @@ struct nfsd_threads_set_req {
  * set the number of running threads
  */
 int nfsd_threads_set(ynl_cpp::ynl_socket&  ys, nfsd_threads_set_req& req);
+ynl_cpp::result<void>
+nfsd_threads_set_ex(ynl_cpp::ynl_socket&  ys, nfsd_threads_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nfsd_threads_set_prepare(ynl_cpp::ynl_socket&  ys, nfsd_threads_set_req& req);
+int nfsd_threads_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nfsd_threads_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nfsd_threads_set_batch(ynl_cpp::msg_batch& batch, nfsd_threads_set_req& req);
 
 /* ============== NFSD_CMD_THREADS_GET ============== */
 /* NFSD_CMD_THREADS_GET - do */
@@ -93,6 +118,9 @@ struct nfsd_threads_get_rsp {
  */
 std::unique_ptr<nfsd_threads_get_rsp>
 nfsd_threads_get(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<nfsd_threads_get_rsp>>
+nfsd_threads_get_ex(ynl_cpp::ynl_socket&  ys,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== NFSD_CMD_VERSION_SET ============== */
 /* NFSD_CMD_VERSION_SET - do */
@@ -104,6 +132,15 @@ struct nfsd_version_set_req {
  * set nfs enabled versions
  */
 int nfsd_version_set(ynl_cpp::ynl_socket&  ys, nfsd_version_set_req& req);
+ynl_cpp::result<void>
+nfsd_version_set_ex(ynl_cpp::ynl_socket&  ys, nfsd_version_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nfsd_version_set_prepare(ynl_cpp::ynl_socket&  ys, nfsd_version_set_req& req);
+int nfsd_version_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nfsd_version_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nfsd_version_set_batch(ynl_cpp::msg_batch& batch, nfsd_version_set_req& req);
 
 /* ============== NFSD_CMD_VERSION_GET ============== */
 /* NFSD_CMD_VERSION_GET - do */
@@ -117,6 +154,9 @@ struct nfsd_version_get_rsp {
  */
 std::unique_ptr<nfsd_version_get_rsp>
 nfsd_version_get(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<nfsd_version_get_rsp>>
+nfsd_version_get_ex(ynl_cpp::ynl_socket&  ys,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== NFSD_CMD_LISTENER_SET ============== */
 /* NFSD_CMD_LISTENER_SET - do */
@@ -128,6 +168,16 @@ struct nfsd_listener_set_req {
  * set nfs running sockets
  */
 int nfsd_listener_set(ynl_cpp::ynl_socket&  ys, nfsd_listener_set_req& req);
+ynl_cpp::result<void>
+nfsd_listener_set_ex(ynl_cpp::ynl_socket&  ys, nfsd_listener_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nfsd_listener_set_prepare(ynl_cpp::ynl_socket&  ys, nfsd_listener_set_req& req);
+int nfsd_listener_set(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nfsd_listener_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nfsd_listener_set_batch(ynl_cpp::msg_batch& batch, nfsd_listener_set_req& req);
 
 /* ============== NFSD_CMD_LISTENER_GET ============== */
 /* NFSD_CMD_LISTENER_GET - do */
@@ -141,6 +191,9 @@ struct nfsd_listener_get_rsp {
  */
 std::unique_ptr<nfsd_listener_get_rsp>
 nfsd_listener_get(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<nfsd_listener_get_rsp>>
+nfsd_listener_get_ex(ynl_cpp::ynl_socket&  ys,
+		     const ynl_cpp::projection *proj = nullptr);
 
 /* ============== NFSD_CMD_POOL_MODE_SET ============== */
 /* NFSD_CMD_POOL_MODE_SET - do */
@@ -152,6 +205,19 @@ struct nfsd_pool_mode_set_req {
  * set the current server pool-mode
  */
 int nfsd_pool_mode_set(ynl_cpp::ynl_socket&  ys, nfsd_pool_mode_set_req& req);
+ynl_cpp::result<void>
+nfsd_pool_mode_set_ex(ynl_cpp::ynl_socket&  ys, nfsd_pool_mode_set_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nfsd_pool_mode_set_prepare(ynl_cpp::ynl_socket&  ys,
+			   nfsd_pool_mode_set_req& req);
+int nfsd_pool_mode_set(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nfsd_pool_mode_set_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nfsd_pool_mode_set_batch(ynl_cpp::msg_batch& batch,
+			 nfsd_pool_mode_set_req& req);
 
 /* ============== NFSD_CMD_POOL_MODE_GET ============== */
 /* NFSD_CMD_POOL_MODE_GET - do */
@@ -166,6 +232,9 @@ struct nfsd_pool_mode_get_rsp {
  */
 std::unique_ptr<nfsd_pool_mode_get_rsp>
 nfsd_pool_mode_get(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<nfsd_pool_mode_get_rsp>>
+nfsd_pool_mode_get_ex(ynl_cpp::ynl_socket&  ys,
+		      const ynl_cpp::projection *proj = nullptr);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_NFSD_GEN_H */
@@ -0,0 +1,4138 @@
+// SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause)
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user source */
+
+#include "nftables-user.hpp"
+
+#include <array>
+
+#include <linux/genetlink.h>
+
+namespace ynl_cpp {
+
+/* Enums */
+static constexpr std::array<std::string_view, 2582 + 1> nftables_op_strmap = []() {
+	std::array<std::string_view, 2582 + 1> arr{};
+	arr[16] = "batch-begin";
+	arr[2560] = "gettable";
+	arr[2563] = "getchain";
+	arr[2566] = "getrule-reset";
+	arr[2569] = "getset";
+	arr[2572] = "getsetelem-reset";
+	arr[2575] = "getgen";
+	arr[2578] = "getobj";
+	arr[2582] = "getflowtable";
+	return arr;
+} ();
+
+std::string_view nftables_op_str(int op)
+{
+	if (op < 0 || op >= (int)(nftables_op_strmap.size()))
+		return "";
+	return nftables_op_strmap[op];
+}
+
+static constexpr std::array<std::string_view, 35 + 1> nftables_meta_keys_strmap = []() {
+	std::array<std::string_view, 35 + 1> arr{};
+	arr[0] = "len";
+	arr[1] = "protocol";
+	arr[2] = "priority";
+	arr[3] = "mark";
+	arr[4] = "iif";
+	arr[5] = "oif";
+	arr[6] = "iifname";
+	arr[7] = "oifname";
+	arr[8] = "iftype";
+	arr[9] = "oiftype";
+	arr[10] = "skuid";
+	arr[11] = "skgid";
+	arr[12] = "nftrace";
+	arr[13] = "rtclassid";
+	arr[14] = "secmark";
+	arr[15] = "nfproto";
+	arr[16] = "l4-proto";
+	arr[17] = "bri-iifname";
+	arr[18] = "bri-oifname";
+	arr[19] = "pkttype";
+	arr[20] = "cpu";
+	arr[21] = "iifgroup";
+	arr[22] = "oifgroup";
+	arr[23] = "cgroup";
+	arr[24] = "prandom";
+	arr[25] = "secpath";
+	arr[26] = "iifkind";
+	arr[27] = "oifkind";
+	arr[28] = "bri-iifpvid";
+	arr[29] = "bri-iifvproto";
+	arr[30] = "time-ns";
+	arr[31] = "time-day";
+	arr[32] = "time-hour";
+	arr[33] = "sdif";
+	arr[34] = "sdifname";
+	arr[35] = "bri-broute";
+	return arr;
+} ();
+
+std::string_view nftables_meta_keys_str(nftables_meta_keys value)
+{
+	if (value < 0 || value >= (int)(nftables_meta_keys_strmap.size()))
+		return "";
+	return nftables_meta_keys_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 2 + 1> nftables_bitwise_ops_strmap = []() {
+	std::array<std::string_view, 2 + 1> arr{};
+	arr[0] = "bool";
+	arr[1] = "lshift";
+	arr[2] = "rshift";
+	return arr;
+} ();
+
+std::string_view nftables_bitwise_ops_str(nftables_bitwise_ops value)
+{
+	if (value < 0 || value >= (int)(nftables_bitwise_ops_strmap.size()))
+		return "";
+	return nftables_bitwise_ops_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 5 + 1> nftables_cmp_ops_strmap = []() {
+	std::array<std::string_view, 5 + 1> arr{};
+	arr[0] = "eq";
+	arr[1] = "neq";
+	arr[2] = "lt";
+	arr[3] = "lte";
+	arr[4] = "gt";
+	arr[5] = "gte";
+	return arr;
+} ();
+
+std::string_view nftables_cmp_ops_str(nftables_cmp_ops value)
+{
+	if (value < 0 || value >= (int)(nftables_cmp_ops_strmap.size()))
+		return "";
+	return nftables_cmp_ops_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 10 + 1> nftables_object_type_strmap = []() {
+	std::array<std::string_view, 10 + 1> arr{};
+	arr[0] = "unspec";
+	arr[1] = "counter";
+	arr[2] = "quota";
+	arr[3] = "ct-helper";
+	arr[4] = "limit";
+	arr[5] = "connlimit";
+	arr[6] = "tunnel";
+	arr[7] = "ct-timeout";
+	arr[8] = "secmark";
+	arr[9] = "ct-expect";
+	arr[10] = "synproxy";
+	return arr;
+} ();
+
+std::string_view nftables_object_type_str(nftables_object_type value)
+{
+	if (value < 0 || value >= (int)(nftables_object_type_strmap.size()))
+		return "";
+	return nftables_object_type_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 6 + 1> nftables_nat_range_flags_strmap = []() {
+	std::array<std::string_view, 6 + 1> arr{};
+	arr[0] = "map-ips";
+	arr[1] = "proto-specified";
+	arr[2] = "proto-random";
+	arr[3] = "persistent";
+	arr[4] = "proto-random-fully";
+	arr[5] = "proto-offset";
+	arr[6] = "netmap";
+	return arr;
+} ();
+
+std::string_view nftables_nat_range_flags_str(nftables_nat_range_flags value)
+{
+	value = (nftables_nat_range_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(nftables_nat_range_flags_strmap.size()))
+		return "";
+	return nftables_nat_range_flags_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 2 + 1> nftables_table_flags_strmap = []() {
+	std::array<std::string_view, 2 + 1> arr{};
+	arr[0] = "dormant";
+	arr[1] = "owner";
+	arr[2] = "persist";
+	return arr;
+} ();
+
+std::string_view nftables_table_flags_str(nftables_table_flags value)
+{
+	value = (nftables_table_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(nftables_table_flags_strmap.size()))
+		return "";
+	return nftables_table_flags_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 2 + 1> nftables_chain_flags_strmap = []() {
+	std::array<std::string_view, 2 + 1> arr{};
+	arr[0] = "base";
+	arr[1] = "hw-offload";
+	arr[2] = "binding";
+	return arr;
+} ();
+
+std::string_view nftables_chain_flags_str(nftables_chain_flags value)
+{
+	value = (nftables_chain_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(nftables_chain_flags_strmap.size()))
+		return "";
+	return nftables_chain_flags_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 8 + 1> nftables_set_flags_strmap = []() {
+	std::array<std::string_view, 8 + 1> arr{};
+	arr[0] = "anonymous";
+	arr[1] = "constant";
+	arr[2] = "interval";
+	arr[3] = "map";
+	arr[4] = "timeout";
+	arr[5] = "eval";
+	arr[6] = "object";
+	arr[7] = "concat";
+	arr[8] = "expr";
+	return arr;
+} ();
+
+std::string_view nftables_set_flags_str(nftables_set_flags value)
+{
+	value = (nftables_set_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(nftables_set_flags_strmap.size()))
+		return "";
+	return nftables_set_flags_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 0 + 1> nftables_lookup_flags_strmap = []() {
+	std::array<std::string_view, 0 + 1> arr{};
+	arr[0] = "invert";
+	return arr;
+} ();
+
+std::string_view nftables_lookup_flags_str(nftables_lookup_flags value)
+{
+	value = (nftables_lookup_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(nftables_lookup_flags_strmap.size()))
+		return "";
+	return nftables_lookup_flags_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 23 + 1> nftables_ct_keys_strmap = []() {
+	std::array<std::string_view, 23 + 1> arr{};
+	arr[0] = "state";
+	arr[1] = "direction";
+	arr[2] = "status";
+	arr[3] = "mark";
+	arr[4] = "secmark";
+	arr[5] = "expiration";
+	arr[6] = "helper";
+	arr[7] = "l3protocol";
+	arr[8] = "src";
+	arr[9] = "dst";
+	arr[10] = "protocol";
+	arr[11] = "proto-src";
+	arr[12] = "proto-dst";
+	arr[13] = "labels";
+	arr[14] = "pkts";
+	arr[15] = "bytes";
+	arr[16] = "avgpkt";
+	arr[17] = "zone";
+	arr[18] = "eventmask";
+	arr[19] = "src-ip";
+	arr[20] = "dst-ip";
+	arr[21] = "src-ip6";
+	arr[22] = "dst-ip6";
+	arr[23] = "ct-id";
+	return arr;
+} ();
+
+std::string_view nftables_ct_keys_str(nftables_ct_keys value)
+{
+	if (value < 0 || value >= (int)(nftables_ct_keys_strmap.size()))
+		return "";
+	return nftables_ct_keys_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 1 + 1> nftables_ct_direction_strmap = []() {
+	std::array<std::string_view, 1 + 1> arr{};
+	arr[0] = "original";
+	arr[1] = "reply";
+	return arr;
+} ();
+
+std::string_view nftables_ct_direction_str(nftables_ct_direction value)
+{
+	if (value < 0 || value >= (int)(nftables_ct_direction_strmap.size()))
+		return "";
+	return nftables_ct_direction_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 1 + 1> nftables_quota_flags_strmap = []() {
+	std::array<std::string_view, 1 + 1> arr{};
+	arr[0] = "invert";
+	arr[1] = "depleted";
+	return arr;
+} ();
+
+std::string_view nftables_quota_flags_str(nftables_quota_flags value)
+{
+	value = (nftables_quota_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(nftables_quota_flags_strmap.size()))
+		return "";
+	return nftables_quota_flags_strmap[value];
+}
+
+std::string_view nftables_verdict_code_str(nftables_verdict_code value)
+{
+	switch ((__u32)value) {
+	case 0xffffffff:
+		return "continue";
+	case 0xfffffffe:
+		return "break";
+	case 0xfffffffd:
+		return "jump";
+	case 0xfffffffc:
+		return "goto";
+	case 0xfffffffb:
+		return "return";
+	case 0x0:
+		return "drop";
+	case 0x1:
+		return "accept";
+	case 0x2:
+		return "stolen";
+	case 0x3:
+		return "queue";
+	case 0x4:
+		return "repeat";
+	}
+	return "";
+}
+
+static constexpr std::array<std::string_view, 2 + 1> nftables_fib_result_strmap = []() {
+	std::array<std::string_view, 2 + 1> arr{};
+	arr[0] = "oif";
+	arr[1] = "oifname";
+	arr[2] = "addrtype";
+	return arr;
+} ();
+
+std::string_view nftables_fib_result_str(nftables_fib_result value)
+{
+	if (value < 0 || value >= (int)(nftables_fib_result_strmap.size()))
+		return "";
+	return nftables_fib_result_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 5 + 1> nftables_fib_flags_strmap = []() {
+	std::array<std::string_view, 5 + 1> arr{};
+	arr[0] = "saddr";
+	arr[1] = "daddr";
+	arr[2] = "mark";
+	arr[3] = "iif";
+	arr[4] = "oif";
+	arr[5] = "present";
+	return arr;
+} ();
+
+std::string_view nftables_fib_flags_str(nftables_fib_flags value)
+{
+	value = (nftables_fib_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(nftables_fib_flags_strmap.size()))
+		return "";
+	return nftables_fib_flags_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 2 + 1> nftables_reject_types_strmap = []() {
+	std::array<std::string_view, 2 + 1> arr{};
+	arr[0] = "icmp-unreach";
+	arr[1] = "tcp-rst";
+	arr[2] = "icmpx-unreach";
+	return arr;
+} ();
+
+std::string_view nftables_reject_types_str(nftables_reject_types value)
+{
+	if (value < 0 || value >= (int)(nftables_reject_types_strmap.size()))
+		return "";
+	return nftables_reject_types_strmap[value];
+}
+
+/* Policies */
+static std::array<ynl_policy_attr,2 + 1> nftables_nft_counter_attrs_policy = []() {
+	std::array<ynl_policy_attr,2 + 1> arr{};
+	arr[NFTABLES_A_NFT_COUNTER_ATTRS_BYTES] = { .name = "bytes", .type = YNL_PT_U64, };
+	arr[NFTABLES_A_NFT_COUNTER_ATTRS_PACKETS] = { .name = "packets", .type = YNL_PT_U64, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_nft_counter_attrs_nest = {
+	.max_attr = 2,
+	.table = nftables_nft_counter_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,2 + 1> nftables_rule_compat_attrs_policy = []() {
+	std::array<ynl_policy_attr,2 + 1> arr{};
+	arr[NFTABLES_A_RULE_COMPAT_ATTRS_PROTO] = { .name = "proto", .type = YNL_PT_BINARY,};
+	arr[NFTABLES_A_RULE_COMPAT_ATTRS_FLAGS] = { .name = "flags", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_rule_compat_attrs_nest = {
+	.max_attr = 2,
+	.table = nftables_rule_compat_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,2 + 1> nftables_expr_attrs_policy = []() {
+	std::array<ynl_policy_attr,2 + 1> arr{};
+	arr[NFTABLES_A_EXPR_ATTRS_NAME] = { .name = "name", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_EXPR_ATTRS_DATA] = { .name = "data", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_expr_attrs_nest = {
+	.max_attr = 2,
+	.table = nftables_expr_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,1 + 1> nftables_set_list_attrs_policy = []() {
+	std::array<ynl_policy_attr,1 + 1> arr{};
+	arr[NFTABLES_A_SET_LIST_ATTRS_ELEM] = { .name = "elem", .type = YNL_PT_NEST, .nest = &nftables_expr_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_set_list_attrs_nest = {
+	.max_attr = 1,
+	.table = nftables_set_list_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,1 + 1> nftables_hook_dev_attrs_policy = []() {
+	std::array<ynl_policy_attr,1 + 1> arr{};
+	arr[NFTABLES_A_HOOK_DEV_ATTRS_NAME] = { .name = "name", .type = YNL_PT_NUL_STR, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_hook_dev_attrs_nest = {
+	.max_attr = 1,
+	.table = nftables_hook_dev_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,1 + 1> nftables_set_field_attrs_policy = []() {
+	std::array<ynl_policy_attr,1 + 1> arr{};
+	arr[NFTABLES_A_SET_FIELD_ATTRS_LEN] = { .name = "len", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_set_field_attrs_nest = {
+	.max_attr = 1,
+	.table = nftables_set_field_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,3 + 1> nftables_verdict_attrs_policy = []() {
+	std::array<ynl_policy_attr,3 + 1> arr{};
+	arr[NFTABLES_A_VERDICT_ATTRS_CODE] = { .name = "code", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_VERDICT_ATTRS_CHAIN] = { .name = "chain", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_VERDICT_ATTRS_CHAIN_ID] = { .name = "chain-id", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_verdict_attrs_nest = {
+	.max_attr = 3,
+	.table = nftables_verdict_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,4 + 1> nftables_nft_hook_attrs_policy = []() {
+	std::array<ynl_policy_attr,4 + 1> arr{};
+	arr[NFTABLES_A_NFT_HOOK_ATTRS_NUM] = { .name = "num", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_NFT_HOOK_ATTRS_PRIORITY] = { .name = "priority", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_NFT_HOOK_ATTRS_DEV] = { .name = "dev", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_NFT_HOOK_ATTRS_DEVS] = { .name = "devs", .type = YNL_PT_NEST, .nest = &nftables_hook_dev_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_nft_hook_attrs_nest = {
+	.max_attr = 4,
+	.table = nftables_nft_hook_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,1 + 1> nftables_expr_list_attrs_policy = []() {
+	std::array<ynl_policy_attr,1 + 1> arr{};
+	arr[NFTABLES_A_EXPR_LIST_ATTRS_ELEM] = { .name = "elem", .type = YNL_PT_NEST, .nest = &nftables_expr_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_expr_list_attrs_nest = {
+	.max_attr = 1,
+	.table = nftables_expr_list_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,3 + 1> nftables_flowtable_hook_attrs_policy = []() {
+	std::array<ynl_policy_attr,3 + 1> arr{};
+	arr[NFTABLES_A_FLOWTABLE_HOOK_ATTRS_NUM] = { .name = "num", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_FLOWTABLE_HOOK_ATTRS_PRIORITY] = { .name = "priority", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_FLOWTABLE_HOOK_ATTRS_DEVS] = { .name = "devs", .type = YNL_PT_NEST, .nest = &nftables_hook_dev_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_flowtable_hook_attrs_nest = {
+	.max_attr = 3,
+	.table = nftables_flowtable_hook_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,1 + 1> nftables_set_desc_concat_attrs_policy = []() {
+	std::array<ynl_policy_attr,1 + 1> arr{};
+	arr[NFTABLES_A_SET_DESC_CONCAT_ATTRS_ELEM] = { .name = "elem", .type = YNL_PT_NEST, .nest = &nftables_set_field_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_set_desc_concat_attrs_nest = {
+	.max_attr = 1,
+	.table = nftables_set_desc_concat_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,2 + 1> nftables_data_attrs_policy = []() {
+	std::array<ynl_policy_attr,2 + 1> arr{};
+	arr[NFTABLES_A_DATA_ATTRS_VALUE] = { .name = "value", .type = YNL_PT_BINARY,};
+	arr[NFTABLES_A_DATA_ATTRS_VERDICT] = { .name = "verdict", .type = YNL_PT_NEST, .nest = &nftables_verdict_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_data_attrs_nest = {
+	.max_attr = 2,
+	.table = nftables_data_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,2 + 1> nftables_set_desc_attrs_policy = []() {
+	std::array<ynl_policy_attr,2 + 1> arr{};
+	arr[NFTABLES_A_SET_DESC_ATTRS_SIZE] = { .name = "size", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_SET_DESC_ATTRS_CONCAT] = { .name = "concat", .type = YNL_PT_NEST, .nest = &nftables_set_desc_concat_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_set_desc_attrs_nest = {
+	.max_attr = 2,
+	.table = nftables_set_desc_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,10 + 1> nftables_setelem_attrs_policy = []() {
+	std::array<ynl_policy_attr,10 + 1> arr{};
+	arr[NFTABLES_A_SETELEM_ATTRS_KEY] = { .name = "key", .type = YNL_PT_NEST, .nest = &nftables_data_attrs_nest, };
+	arr[NFTABLES_A_SETELEM_ATTRS_DATA] = { .name = "data", .type = YNL_PT_NEST, .nest = &nftables_data_attrs_nest, };
+	arr[NFTABLES_A_SETELEM_ATTRS_FLAGS] = { .name = "flags", .type = YNL_PT_BINARY,};
+	arr[NFTABLES_A_SETELEM_ATTRS_TIMEOUT] = { .name = "timeout", .type = YNL_PT_U64, };
+	arr[NFTABLES_A_SETELEM_ATTRS_EXPIRATION] = { .name = "expiration", .type = YNL_PT_U64, };
+	arr[NFTABLES_A_SETELEM_ATTRS_USERDATA] = { .name = "userdata", .type = YNL_PT_BINARY,};
+	arr[NFTABLES_A_SETELEM_ATTRS_EXPR] = { .name = "expr", .type = YNL_PT_NEST, .nest = &nftables_expr_attrs_nest, };
+	arr[NFTABLES_A_SETELEM_ATTRS_OBJREF] = { .name = "objref", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_SETELEM_ATTRS_KEY_END] = { .name = "key-end", .type = YNL_PT_NEST, .nest = &nftables_data_attrs_nest, };
+	arr[NFTABLES_A_SETELEM_ATTRS_EXPRESSIONS] = { .name = "expressions", .type = YNL_PT_NEST, .nest = &nftables_expr_list_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_setelem_attrs_nest = {
+	.max_attr = 10,
+	.table = nftables_setelem_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,1 + 1> nftables_setelem_list_elem_attrs_policy = []() {
+	std::array<ynl_policy_attr,1 + 1> arr{};
+	arr[NFTABLES_A_SETELEM_LIST_ELEM_ATTRS_ELEM] = { .name = "elem", .type = YNL_PT_NEST, .nest = &nftables_setelem_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_setelem_list_elem_attrs_nest = {
+	.max_attr = 1,
+	.table = nftables_setelem_list_elem_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,1 + 1> nftables_batch_attrs_policy = []() {
+	std::array<ynl_policy_attr,1 + 1> arr{};
+	arr[NFTABLES_A_BATCH_ATTRS_GENID] = { .name = "genid", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_batch_attrs_nest = {
+	.max_attr = 1,
+	.table = nftables_batch_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,5 + 1> nftables_table_attrs_policy = []() {
+	std::array<ynl_policy_attr,5 + 1> arr{};
+	arr[NFTABLES_A_TABLE_ATTRS_NAME] = { .name = "name", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_TABLE_ATTRS_FLAGS] = { .name = "flags", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_TABLE_ATTRS_USE] = { .name = "use", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_TABLE_ATTRS_HANDLE] = { .name = "handle", .type = YNL_PT_U64, };
+	arr[NFTABLES_A_TABLE_ATTRS_USERDATA] = { .name = "userdata", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_table_attrs_nest = {
+	.max_attr = 5,
+	.table = nftables_table_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,11 + 1> nftables_chain_attrs_policy = []() {
+	std::array<ynl_policy_attr,11 + 1> arr{};
+	arr[NFTABLES_A_CHAIN_ATTRS_TABLE] = { .name = "table", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_CHAIN_ATTRS_HANDLE] = { .name = "handle", .type = YNL_PT_U64, };
+	arr[NFTABLES_A_CHAIN_ATTRS_NAME] = { .name = "name", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_CHAIN_ATTRS_HOOK] = { .name = "hook", .type = YNL_PT_NEST, .nest = &nftables_nft_hook_attrs_nest, };
+	arr[NFTABLES_A_CHAIN_ATTRS_POLICY] = { .name = "policy", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_CHAIN_ATTRS_USE] = { .name = "use", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_CHAIN_ATTRS_TYPE] = { .name = "type", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_CHAIN_ATTRS_COUNTERS] = { .name = "counters", .type = YNL_PT_NEST, .nest = &nftables_nft_counter_attrs_nest, };
+	arr[NFTABLES_A_CHAIN_ATTRS_FLAGS] = { .name = "flags", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_CHAIN_ATTRS_ID] = { .name = "id", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_CHAIN_ATTRS_USERDATA] = { .name = "userdata", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_chain_attrs_nest = {
+	.max_attr = 11,
+	.table = nftables_chain_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,10 + 1> nftables_rule_attrs_policy = []() {
+	std::array<ynl_policy_attr,10 + 1> arr{};
+	arr[NFTABLES_A_RULE_ATTRS_TABLE] = { .name = "table", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_RULE_ATTRS_CHAIN] = { .name = "chain", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_RULE_ATTRS_HANDLE] = { .name = "handle", .type = YNL_PT_U64, };
+	arr[NFTABLES_A_RULE_ATTRS_EXPRESSIONS] = { .name = "expressions", .type = YNL_PT_NEST, .nest = &nftables_expr_list_attrs_nest, };
+	arr[NFTABLES_A_RULE_ATTRS_COMPAT] = { .name = "compat", .type = YNL_PT_NEST, .nest = &nftables_rule_compat_attrs_nest, };
+	arr[NFTABLES_A_RULE_ATTRS_POSITION] = { .name = "position", .type = YNL_PT_U64, };
+	arr[NFTABLES_A_RULE_ATTRS_USERDATA] = { .name = "userdata", .type = YNL_PT_BINARY,};
+	arr[NFTABLES_A_RULE_ATTRS_ID] = { .name = "id", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_RULE_ATTRS_POSITION_ID] = { .name = "position-id", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_RULE_ATTRS_CHAIN_ID] = { .name = "chain-id", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_rule_attrs_nest = {
+	.max_attr = 10,
+	.table = nftables_rule_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,18 + 1> nftables_set_attrs_policy = []() {
+	std::array<ynl_policy_attr,18 + 1> arr{};
+	arr[NFTABLES_A_SET_ATTRS_TABLE] = { .name = "table", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_SET_ATTRS_NAME] = { .name = "name", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_SET_ATTRS_FLAGS] = { .name = "flags", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_SET_ATTRS_KEY_TYPE] = { .name = "key-type", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_SET_ATTRS_KEY_LEN] = { .name = "key-len", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_SET_ATTRS_DATA_TYPE] = { .name = "data-type", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_SET_ATTRS_DATA_LEN] = { .name = "data-len", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_SET_ATTRS_POLICY] = { .name = "policy", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_SET_ATTRS_DESC] = { .name = "desc", .type = YNL_PT_NEST, .nest = &nftables_set_desc_attrs_nest, };
+	arr[NFTABLES_A_SET_ATTRS_ID] = { .name = "id", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_SET_ATTRS_TIMEOUT] = { .name = "timeout", .type = YNL_PT_U64, };
+	arr[NFTABLES_A_SET_ATTRS_GC_INTERVAL] = { .name = "gc-interval", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_SET_ATTRS_USERDATA] = { .name = "userdata", .type = YNL_PT_BINARY,};
+	arr[NFTABLES_A_SET_ATTRS_PAD] = { .name = "pad", .type = YNL_PT_IGNORE, };
+	arr[NFTABLES_A_SET_ATTRS_OBJ_TYPE] = { .name = "obj-type", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_SET_ATTRS_HANDLE] = { .name = "handle", .type = YNL_PT_U64, };
+	arr[NFTABLES_A_SET_ATTRS_EXPR] = { .name = "expr", .type = YNL_PT_NEST, .nest = &nftables_expr_attrs_nest, };
+	arr[NFTABLES_A_SET_ATTRS_EXPRESSIONS] = { .name = "expressions", .type = YNL_PT_NEST, .nest = &nftables_set_list_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_set_attrs_nest = {
+	.max_attr = 18,
+	.table = nftables_set_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,4 + 1> nftables_setelem_list_attrs_policy = []() {
+	std::array<ynl_policy_attr,4 + 1> arr{};
+	arr[NFTABLES_A_SETELEM_LIST_ATTRS_TABLE] = { .name = "table", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_SETELEM_LIST_ATTRS_SET] = { .name = "set", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_SETELEM_LIST_ATTRS_ELEMENTS] = { .name = "elements", .type = YNL_PT_NEST, .nest = &nftables_setelem_list_elem_attrs_nest, };
+	arr[NFTABLES_A_SETELEM_LIST_ATTRS_SET_ID] = { .name = "set-id", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_setelem_list_attrs_nest = {
+	.max_attr = 4,
+	.table = nftables_setelem_list_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,3 + 1> nftables_gen_attrs_policy = []() {
+	std::array<ynl_policy_attr,3 + 1> arr{};
+	arr[NFTABLES_A_GEN_ATTRS_ID] = { .name = "id", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_GEN_ATTRS_PROC_PID] = { .name = "proc-pid", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_GEN_ATTRS_PROC_NAME] = { .name = "proc-name", .type = YNL_PT_NUL_STR, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_gen_attrs_nest = {
+	.max_attr = 3,
+	.table = nftables_gen_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,8 + 1> nftables_obj_attrs_policy = []() {
+	std::array<ynl_policy_attr,8 + 1> arr{};
+	arr[NFTABLES_A_OBJ_ATTRS_TABLE] = { .name = "table", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_OBJ_ATTRS_NAME] = { .name = "name", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_OBJ_ATTRS_TYPE] = { .name = "type", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_OBJ_ATTRS_DATA] = { .name = "data", .type = YNL_PT_BINARY,};
+	arr[NFTABLES_A_OBJ_ATTRS_USE] = { .name = "use", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_OBJ_ATTRS_HANDLE] = { .name = "handle", .type = YNL_PT_U64, };
+	arr[NFTABLES_A_OBJ_ATTRS_PAD] = { .name = "pad", .type = YNL_PT_IGNORE, };
+	arr[NFTABLES_A_OBJ_ATTRS_USERDATA] = { .name = "userdata", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_obj_attrs_nest = {
+	.max_attr = 8,
+	.table = nftables_obj_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,7 + 1> nftables_flowtable_attrs_policy = []() {
+	std::array<ynl_policy_attr,7 + 1> arr{};
+	arr[NFTABLES_A_FLOWTABLE_ATTRS_TABLE] = { .name = "table", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_FLOWTABLE_ATTRS_NAME] = { .name = "name", .type = YNL_PT_NUL_STR, };
+	arr[NFTABLES_A_FLOWTABLE_ATTRS_HOOK] = { .name = "hook", .type = YNL_PT_NEST, .nest = &nftables_flowtable_hook_attrs_nest, };
+	arr[NFTABLES_A_FLOWTABLE_ATTRS_USE] = { .name = "use", .type = YNL_PT_U32, };
+	arr[NFTABLES_A_FLOWTABLE_ATTRS_HANDLE] = { .name = "handle", .type = YNL_PT_U64, };
+	arr[NFTABLES_A_FLOWTABLE_ATTRS_PAD] = { .name = "pad", .type = YNL_PT_IGNORE, };
+	arr[NFTABLES_A_FLOWTABLE_ATTRS_FLAGS] = { .name = "flags", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest nftables_flowtable_attrs_nest = {
+	.max_attr = 7,
+	.table = nftables_flowtable_attrs_policy.data(),
+};
+
+/* Common nested types */
+int nftables_nft_counter_attrs_put(struct nlmsghdr *nlh,
+				   unsigned int attr_type,
+				   const nftables_nft_counter_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.bytes.has_value())
+		ynl_attr_put_u64(nlh, NFTABLES_A_NFT_COUNTER_ATTRS_BYTES, obj.bytes.value());
+	if (obj.packets.has_value())
+		ynl_attr_put_u64(nlh, NFTABLES_A_NFT_COUNTER_ATTRS_PACKETS, obj.packets.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_rule_compat_attrs_put(struct nlmsghdr *nlh,
+				   unsigned int attr_type,
+				   const nftables_rule_compat_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.proto.size() > 0)
+		ynl_attr_put(nlh, NFTABLES_A_RULE_COMPAT_ATTRS_PROTO, obj.proto.data(), obj.proto.size());
+	if (obj.flags.size() > 0)
+		ynl_attr_put(nlh, NFTABLES_A_RULE_COMPAT_ATTRS_FLAGS, obj.flags.data(), obj.flags.size());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_expr_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			    const nftables_expr_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_EXPR_ATTRS_NAME, obj.name.data());
+	if (obj.data.size() > 0)
+		ynl_attr_put(nlh, NFTABLES_A_EXPR_ATTRS_DATA, obj.data.data(), obj.data.size());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_hook_dev_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				const nftables_hook_dev_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	for (unsigned int i = 0; i < obj.name.size(); i++)
+		ynl_attr_put_str(nlh, NFTABLES_A_HOOK_DEV_ATTRS_NAME, obj.name[i].c_str());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_set_field_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				 const nftables_set_field_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.len.has_value())
+		ynl_attr_put_u32(nlh, NFTABLES_A_SET_FIELD_ATTRS_LEN, obj.len.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_verdict_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const nftables_verdict_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.code.has_value())
+		ynl_attr_put_u32(nlh, NFTABLES_A_VERDICT_ATTRS_CODE, obj.code.value());
+	if (obj.chain.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_VERDICT_ATTRS_CHAIN, obj.chain.data());
+	if (obj.chain_id.has_value())
+		ynl_attr_put_u32(nlh, NFTABLES_A_VERDICT_ATTRS_CHAIN_ID, obj.chain_id.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_nft_hook_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				const nftables_nft_hook_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.num.has_value())
+		ynl_attr_put_u32(nlh, NFTABLES_A_NFT_HOOK_ATTRS_NUM, obj.num.value());
+	if (obj.priority.has_value())
+		ynl_attr_put_s32(nlh, NFTABLES_A_NFT_HOOK_ATTRS_PRIORITY, obj.priority.value());
+	if (obj.dev.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_NFT_HOOK_ATTRS_DEV, obj.dev.data());
+	if (obj.devs.has_value())
+		nftables_hook_dev_attrs_put(nlh, NFTABLES_A_NFT_HOOK_ATTRS_DEVS, obj.devs.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_expr_list_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				 const nftables_expr_list_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	for (unsigned int i = 0; i < obj.elem.size(); i++)
+		nftables_expr_attrs_put(nlh, NFTABLES_A_EXPR_LIST_ATTRS_ELEM, obj.elem[i]);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_set_desc_concat_attrs_put(struct nlmsghdr *nlh,
+				       unsigned int attr_type,
+				       const nftables_set_desc_concat_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.elem.has_value())
+		nftables_set_field_attrs_put(nlh, NFTABLES_A_SET_DESC_CONCAT_ATTRS_ELEM, obj.elem.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_data_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			    const nftables_data_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.value.size() > 0)
+		ynl_attr_put(nlh, NFTABLES_A_DATA_ATTRS_VALUE, obj.value.data(), obj.value.size());
+	if (obj.verdict.has_value())
+		nftables_verdict_attrs_put(nlh, NFTABLES_A_DATA_ATTRS_VERDICT, obj.verdict.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_set_desc_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				const nftables_set_desc_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.size.has_value())
+		ynl_attr_put_u32(nlh, NFTABLES_A_SET_DESC_ATTRS_SIZE, obj.size.value());
+	for (unsigned int i = 0; i < obj.concat.size(); i++)
+		nftables_set_desc_concat_attrs_put(nlh, NFTABLES_A_SET_DESC_ATTRS_CONCAT, obj.concat[i]);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_setelem_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const nftables_setelem_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.key.has_value())
+		nftables_data_attrs_put(nlh, NFTABLES_A_SETELEM_ATTRS_KEY, obj.key.value());
+	if (obj.data.has_value())
+		nftables_data_attrs_put(nlh, NFTABLES_A_SETELEM_ATTRS_DATA, obj.data.value());
+	if (obj.flags.size() > 0)
+		ynl_attr_put(nlh, NFTABLES_A_SETELEM_ATTRS_FLAGS, obj.flags.data(), obj.flags.size());
+	if (obj.timeout.has_value())
+		ynl_attr_put_u64(nlh, NFTABLES_A_SETELEM_ATTRS_TIMEOUT, obj.timeout.value());
+	if (obj.expiration.has_value())
+		ynl_attr_put_u64(nlh, NFTABLES_A_SETELEM_ATTRS_EXPIRATION, obj.expiration.value());
+	if (obj.userdata.size() > 0)
+		ynl_attr_put(nlh, NFTABLES_A_SETELEM_ATTRS_USERDATA, obj.userdata.data(), obj.userdata.size());
+	if (obj.expr.has_value())
+		nftables_expr_attrs_put(nlh, NFTABLES_A_SETELEM_ATTRS_EXPR, obj.expr.value());
+	if (obj.objref.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SETELEM_ATTRS_OBJREF, obj.objref.data());
+	if (obj.key_end.has_value())
+		nftables_data_attrs_put(nlh, NFTABLES_A_SETELEM_ATTRS_KEY_END, obj.key_end.value());
+	if (obj.expressions.has_value())
+		nftables_expr_list_attrs_put(nlh, NFTABLES_A_SETELEM_ATTRS_EXPRESSIONS, obj.expressions.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int nftables_setelem_list_elem_attrs_put(struct nlmsghdr *nlh,
+					 unsigned int attr_type,
+					 const nftables_setelem_list_elem_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	for (unsigned int i = 0; i < obj.elem.size(); i++)
+		nftables_setelem_attrs_put(nlh, NFTABLES_A_SETELEM_LIST_ELEM_ATTRS_ELEM, obj.elem[i]);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+/* ============== BATCH_BEGIN ============== */
+/* BATCH_BEGIN - do */
+int nftables_batch_begin_rsp_parse(const struct nlmsghdr *nlh,
+				   struct ynl_parse_arg *yarg)
+{
+	nftables_batch_begin_rsp *dst;
+	const struct nlattr *attr;
+	void *hdr;
+
+	dst = (nftables_batch_begin_rsp*)yarg->data;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct nfgenmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct nfgenmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == NFTABLES_A_BATCH_ATTRS_GENID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->genid = (__u32)ynl_attr_get_u32(attr);
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+nftables_batch_begin_put(struct nlmsghdr *nlh, nftables_batch_begin_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.genid.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_BATCH_ATTRS_GENID, req.genid.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<nftables_batch_begin_rsp>>
+nftables_batch_begin_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<nftables_batch_begin_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_batch_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+	yrs.yarg.rsp_policy = &nftables_batch_attrs_nest;
+
+	rsp.reset(new nftables_batch_begin_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = nftables_batch_begin_rsp_parse;
+	yrs.rsp_cmd = 16;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_batch_begin_rsp>>
+nftables_batch_begin_ex(ynl_cpp::ynl_socket&  ys,
+			nftables_batch_begin_req& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 16, req._nlmsg_flags);
+	nftables_batch_begin_put(nlh, req);
+
+	return nftables_batch_begin_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nftables_batch_begin_rsp>
+nftables_batch_begin(ynl_cpp::ynl_socket&  ys, nftables_batch_begin_req& req)
+{
+	auto ret = nftables_batch_begin_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_batch_begin_prepare(ynl_cpp::ynl_socket&  ys,
+			     nftables_batch_begin_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 16, req._nlmsg_flags);
+	nftables_batch_begin_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_batch_begin_rsp>>
+nftables_batch_begin_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return nftables_batch_begin_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nftables_batch_begin_rsp>
+nftables_batch_begin(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_batch_begin_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== BATCH_END ============== */
+/* BATCH_END - do */
+static void
+nftables_batch_end_put(struct nlmsghdr *nlh, nftables_batch_end_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.genid.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_BATCH_ATTRS_GENID, req.genid.value());
+}
+
+static ynl_cpp::result<void>
+nftables_batch_end_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_batch_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_batch_end_ex(ynl_cpp::ynl_socket&  ys, nftables_batch_end_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 17, req._nlmsg_flags);
+	nftables_batch_end_put(nlh, req);
+
+	return nftables_batch_end_exec(ys, nlh);
+}
+
+int nftables_batch_end(ynl_cpp::ynl_socket&  ys, nftables_batch_end_req& req)
+{
+	auto ret = nftables_batch_end_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_batch_end_prepare(ynl_cpp::ynl_socket&  ys,
+			   nftables_batch_end_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 17, req._nlmsg_flags);
+	nftables_batch_end_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_batch_end_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	return nftables_batch_end_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_batch_end(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_batch_end_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_batch_end_batch(ynl_cpp::msg_batch& batch,
+			 nftables_batch_end_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(17, req._nlmsg_flags);
+	nftables_batch_end_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_batch_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== NEWTABLE ============== */
+/* NEWTABLE - do */
+static void
+nftables_newtable_put(struct nlmsghdr *nlh, nftables_newtable_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.flags.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_TABLE_ATTRS_FLAGS, req.flags.value());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_TABLE_ATTRS_NAME, req.name.data());
+	if (req.userdata.size() > 0)
+		ynl_attr_put(nlh, NFTABLES_A_TABLE_ATTRS_USERDATA, req.userdata.data(), req.userdata.size());
+}
+
+static ynl_cpp::result<void>
+nftables_newtable_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_table_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_newtable_ex(ynl_cpp::ynl_socket&  ys, nftables_newtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2560, req._nlmsg_flags);
+	nftables_newtable_put(nlh, req);
+
+	return nftables_newtable_exec(ys, nlh);
+}
+
+int nftables_newtable(ynl_cpp::ynl_socket&  ys, nftables_newtable_req& req)
+{
+	auto ret = nftables_newtable_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newtable_prepare(ynl_cpp::ynl_socket&  ys, nftables_newtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2560, req._nlmsg_flags);
+	nftables_newtable_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_newtable_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nftables_newtable_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_newtable(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_newtable_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_newtable_batch(ynl_cpp::msg_batch& batch, nftables_newtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2560, req._nlmsg_flags);
+	nftables_newtable_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_table_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== GETTABLE ============== */
+/* GETTABLE - do */
+int nftables_gettable_rsp_parse(const struct nlmsghdr *nlh,
+				struct ynl_parse_arg *yarg)
+{
+	nftables_gettable_rsp *dst;
+	const struct nlattr *attr;
+	void *hdr;
+
+	dst = (nftables_gettable_rsp*)yarg->data;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct nfgenmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct nfgenmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == NFTABLES_A_TABLE_ATTRS_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+nftables_gettable_put(struct nlmsghdr *nlh, nftables_gettable_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_TABLE_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<nftables_gettable_rsp>>
+nftables_gettable_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<nftables_gettable_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_table_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+	yrs.yarg.rsp_policy = &nftables_table_attrs_nest;
+
+	rsp.reset(new nftables_gettable_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = nftables_gettable_rsp_parse;
+	yrs.rsp_cmd = 2560;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_gettable_rsp>>
+nftables_gettable_ex(ynl_cpp::ynl_socket&  ys, nftables_gettable_req& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2561, req._nlmsg_flags);
+	nftables_gettable_put(nlh, req);
+
+	return nftables_gettable_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nftables_gettable_rsp>
+nftables_gettable(ynl_cpp::ynl_socket&  ys, nftables_gettable_req& req)
+{
+	auto ret = nftables_gettable_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_gettable_prepare(ynl_cpp::ynl_socket&  ys, nftables_gettable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2561, req._nlmsg_flags);
+	nftables_gettable_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_gettable_rsp>>
+nftables_gettable_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return nftables_gettable_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nftables_gettable_rsp>
+nftables_gettable(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_gettable_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DELTABLE ============== */
+/* DELTABLE - do */
+static void
+nftables_deltable_put(struct nlmsghdr *nlh, nftables_deltable_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 12 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.handle.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_TABLE_ATTRS_HANDLE, req.handle.value());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_TABLE_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_deltable_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_table_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_deltable_ex(ynl_cpp::ynl_socket&  ys, nftables_deltable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2562, req._nlmsg_flags);
+	nftables_deltable_put(nlh, req);
+
+	return nftables_deltable_exec(ys, nlh);
+}
+
+int nftables_deltable(ynl_cpp::ynl_socket&  ys, nftables_deltable_req& req)
+{
+	auto ret = nftables_deltable_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_deltable_prepare(ynl_cpp::ynl_socket&  ys, nftables_deltable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2562, req._nlmsg_flags);
+	nftables_deltable_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_deltable_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nftables_deltable_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_deltable(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_deltable_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_deltable_batch(ynl_cpp::msg_batch& batch, nftables_deltable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2562, req._nlmsg_flags);
+	nftables_deltable_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_table_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== DESTROYTABLE ============== */
+/* DESTROYTABLE - do */
+static void
+nftables_destroytable_put(struct nlmsghdr *nlh, nftables_destroytable_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 12 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.handle.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_TABLE_ATTRS_HANDLE, req.handle.value());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_TABLE_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_destroytable_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_table_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_destroytable_ex(ynl_cpp::ynl_socket&  ys,
+			 nftables_destroytable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2586, req._nlmsg_flags);
+	nftables_destroytable_put(nlh, req);
+
+	return nftables_destroytable_exec(ys, nlh);
+}
+
+int nftables_destroytable(ynl_cpp::ynl_socket&  ys,
+			  nftables_destroytable_req& req)
+{
+	auto ret = nftables_destroytable_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroytable_prepare(ynl_cpp::ynl_socket&  ys,
+			      nftables_destroytable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2586, req._nlmsg_flags);
+	nftables_destroytable_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_destroytable_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	return nftables_destroytable_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_destroytable(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_destroytable_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_destroytable_batch(ynl_cpp::msg_batch& batch,
+			    nftables_destroytable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2586, req._nlmsg_flags);
+	nftables_destroytable_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_table_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== NEWCHAIN ============== */
+/* NEWCHAIN - do */
+static void
+nftables_newchain_put(struct nlmsghdr *nlh, nftables_newchain_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 36 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.handle.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_CHAIN_ATTRS_HANDLE, req.handle.value());
+	if (req.policy.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_CHAIN_ATTRS_POLICY, req.policy.value());
+	if (req.flags.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_CHAIN_ATTRS_FLAGS, req.flags.value());
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_CHAIN_ATTRS_ID, req.id.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_CHAIN_ATTRS_TABLE, req.table.data());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_CHAIN_ATTRS_NAME, req.name.data());
+	if (req.hook.has_value())
+		nftables_nft_hook_attrs_put(nlh, NFTABLES_A_CHAIN_ATTRS_HOOK, req.hook.value());
+	if (req.type.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_CHAIN_ATTRS_TYPE, req.type.data());
+	if (req.counters.has_value())
+		nftables_nft_counter_attrs_put(nlh, NFTABLES_A_CHAIN_ATTRS_COUNTERS, req.counters.value());
+	if (req.userdata.size() > 0)
+		ynl_attr_put(nlh, NFTABLES_A_CHAIN_ATTRS_USERDATA, req.userdata.data(), req.userdata.size());
+}
+
+static ynl_cpp::result<void>
+nftables_newchain_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_chain_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_newchain_ex(ynl_cpp::ynl_socket&  ys, nftables_newchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2563, req._nlmsg_flags);
+	nftables_newchain_put(nlh, req);
+
+	return nftables_newchain_exec(ys, nlh);
+}
+
+int nftables_newchain(ynl_cpp::ynl_socket&  ys, nftables_newchain_req& req)
+{
+	auto ret = nftables_newchain_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newchain_prepare(ynl_cpp::ynl_socket&  ys, nftables_newchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2563, req._nlmsg_flags);
+	nftables_newchain_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_newchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nftables_newchain_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_newchain(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_newchain_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_newchain_batch(ynl_cpp::msg_batch& batch, nftables_newchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2563, req._nlmsg_flags);
+	nftables_newchain_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_chain_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== GETCHAIN ============== */
+/* GETCHAIN - do */
+int nftables_getchain_rsp_parse(const struct nlmsghdr *nlh,
+				struct ynl_parse_arg *yarg)
+{
+	nftables_getchain_rsp *dst;
+	const struct nlattr *attr;
+	void *hdr;
+
+	dst = (nftables_getchain_rsp*)yarg->data;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct nfgenmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct nfgenmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == NFTABLES_A_CHAIN_ATTRS_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+nftables_getchain_put(struct nlmsghdr *nlh, nftables_getchain_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_CHAIN_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<nftables_getchain_rsp>>
+nftables_getchain_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<nftables_getchain_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_chain_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+	yrs.yarg.rsp_policy = &nftables_chain_attrs_nest;
+
+	rsp.reset(new nftables_getchain_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = nftables_getchain_rsp_parse;
+	yrs.rsp_cmd = 2563;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getchain_rsp>>
+nftables_getchain_ex(ynl_cpp::ynl_socket&  ys, nftables_getchain_req& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2564, req._nlmsg_flags);
+	nftables_getchain_put(nlh, req);
+
+	return nftables_getchain_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nftables_getchain_rsp>
+nftables_getchain(ynl_cpp::ynl_socket&  ys, nftables_getchain_req& req)
+{
+	auto ret = nftables_getchain_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getchain_prepare(ynl_cpp::ynl_socket&  ys, nftables_getchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2564, req._nlmsg_flags);
+	nftables_getchain_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getchain_rsp>>
+nftables_getchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return nftables_getchain_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nftables_getchain_rsp>
+nftables_getchain(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_getchain_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DELCHAIN ============== */
+/* DELCHAIN - do */
+static void
+nftables_delchain_put(struct nlmsghdr *nlh, nftables_delchain_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 12 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.handle.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_CHAIN_ATTRS_HANDLE, req.handle.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_CHAIN_ATTRS_TABLE, req.table.data());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_CHAIN_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_delchain_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_chain_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_delchain_ex(ynl_cpp::ynl_socket&  ys, nftables_delchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2565, req._nlmsg_flags);
+	nftables_delchain_put(nlh, req);
+
+	return nftables_delchain_exec(ys, nlh);
+}
+
+int nftables_delchain(ynl_cpp::ynl_socket&  ys, nftables_delchain_req& req)
+{
+	auto ret = nftables_delchain_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delchain_prepare(ynl_cpp::ynl_socket&  ys, nftables_delchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2565, req._nlmsg_flags);
+	nftables_delchain_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_delchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nftables_delchain_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_delchain(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_delchain_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_delchain_batch(ynl_cpp::msg_batch& batch, nftables_delchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2565, req._nlmsg_flags);
+	nftables_delchain_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_chain_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== DESTROYCHAIN ============== */
+/* DESTROYCHAIN - do */
+static void
+nftables_destroychain_put(struct nlmsghdr *nlh, nftables_destroychain_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 12 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.handle.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_CHAIN_ATTRS_HANDLE, req.handle.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_CHAIN_ATTRS_TABLE, req.table.data());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_CHAIN_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_destroychain_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_chain_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_destroychain_ex(ynl_cpp::ynl_socket&  ys,
+			 nftables_destroychain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2587, req._nlmsg_flags);
+	nftables_destroychain_put(nlh, req);
+
+	return nftables_destroychain_exec(ys, nlh);
+}
+
+int nftables_destroychain(ynl_cpp::ynl_socket&  ys,
+			  nftables_destroychain_req& req)
+{
+	auto ret = nftables_destroychain_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroychain_prepare(ynl_cpp::ynl_socket&  ys,
+			      nftables_destroychain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2587, req._nlmsg_flags);
+	nftables_destroychain_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_destroychain_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	return nftables_destroychain_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_destroychain(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_destroychain_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_destroychain_batch(ynl_cpp::msg_batch& batch,
+			    nftables_destroychain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2587, req._nlmsg_flags);
+	nftables_destroychain_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_chain_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== NEWRULE ============== */
+/* NEWRULE - do */
+static void
+nftables_newrule_put(struct nlmsghdr *nlh, nftables_newrule_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 48 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.handle.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_RULE_ATTRS_HANDLE, req.handle.value());
+	if (req.position.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_RULE_ATTRS_POSITION, req.position.value());
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_RULE_ATTRS_ID, req.id.value());
+	if (req.position_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_RULE_ATTRS_POSITION_ID, req.position_id.value());
+	if (req.chain_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_RULE_ATTRS_CHAIN_ID, req.chain_id.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_RULE_ATTRS_TABLE, req.table.data());
+	if (req.chain.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_RULE_ATTRS_CHAIN, req.chain.data());
+	if (req.expressions.has_value())
+		nftables_expr_list_attrs_put(nlh, NFTABLES_A_RULE_ATTRS_EXPRESSIONS, req.expressions.value());
+	if (req.compat.has_value())
+		nftables_rule_compat_attrs_put(nlh, NFTABLES_A_RULE_ATTRS_COMPAT, req.compat.value());
+	if (req.userdata.size() > 0)
+		ynl_attr_put(nlh, NFTABLES_A_RULE_ATTRS_USERDATA, req.userdata.data(), req.userdata.size());
+}
+
+static ynl_cpp::result<void>
+nftables_newrule_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_rule_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_newrule_ex(ynl_cpp::ynl_socket&  ys, nftables_newrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2566, req._nlmsg_flags);
+	nftables_newrule_put(nlh, req);
+
+	return nftables_newrule_exec(ys, nlh);
+}
+
+int nftables_newrule(ynl_cpp::ynl_socket&  ys, nftables_newrule_req& req)
+{
+	auto ret = nftables_newrule_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newrule_prepare(ynl_cpp::ynl_socket&  ys, nftables_newrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2566, req._nlmsg_flags);
+	nftables_newrule_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_newrule_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nftables_newrule_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_newrule(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_newrule_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_newrule_batch(ynl_cpp::msg_batch& batch, nftables_newrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2566, req._nlmsg_flags);
+	nftables_newrule_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_rule_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== GETRULE ============== */
+/* GETRULE - do */
+int nftables_getrule_rsp_parse(const struct nlmsghdr *nlh,
+			       struct ynl_parse_arg *yarg)
+{
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+nftables_getrule_put(struct nlmsghdr *nlh, nftables_getrule_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<nftables_getrule_rsp>>
+nftables_getrule_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<nftables_getrule_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_rule_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+	yrs.yarg.rsp_policy = &nftables_rule_attrs_nest;
+
+	rsp.reset(new nftables_getrule_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = nftables_getrule_rsp_parse;
+	yrs.rsp_cmd = 2566;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getrule_rsp>>
+nftables_getrule_ex(ynl_cpp::ynl_socket&  ys, nftables_getrule_req& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2567, req._nlmsg_flags);
+	nftables_getrule_put(nlh, req);
+
+	return nftables_getrule_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nftables_getrule_rsp>
+nftables_getrule(ynl_cpp::ynl_socket&  ys, nftables_getrule_req& req)
+{
+	auto ret = nftables_getrule_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getrule_prepare(ynl_cpp::ynl_socket&  ys, nftables_getrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2567, req._nlmsg_flags);
+	nftables_getrule_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getrule_rsp>>
+nftables_getrule_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return nftables_getrule_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nftables_getrule_rsp>
+nftables_getrule(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_getrule_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== GETRULE_RESET ============== */
+/* GETRULE_RESET - do */
+int nftables_getrule_reset_rsp_parse(const struct nlmsghdr *nlh,
+				     struct ynl_parse_arg *yarg)
+{
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+nftables_getrule_reset_put(struct nlmsghdr *nlh,
+			   nftables_getrule_reset_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<nftables_getrule_reset_rsp>>
+nftables_getrule_reset_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<nftables_getrule_reset_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_rule_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+	yrs.yarg.rsp_policy = &nftables_rule_attrs_nest;
+
+	rsp.reset(new nftables_getrule_reset_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = nftables_getrule_reset_rsp_parse;
+	yrs.rsp_cmd = 2566;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getrule_reset_rsp>>
+nftables_getrule_reset_ex(ynl_cpp::ynl_socket&  ys,
+			  nftables_getrule_reset_req& req,
+			  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2585, req._nlmsg_flags);
+	nftables_getrule_reset_put(nlh, req);
+
+	return nftables_getrule_reset_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nftables_getrule_reset_rsp>
+nftables_getrule_reset(ynl_cpp::ynl_socket&  ys,
+		       nftables_getrule_reset_req& req)
+{
+	auto ret = nftables_getrule_reset_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getrule_reset_prepare(ynl_cpp::ynl_socket&  ys,
+			       nftables_getrule_reset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2585, req._nlmsg_flags);
+	nftables_getrule_reset_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getrule_reset_rsp>>
+nftables_getrule_reset_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj)
+{
+	return nftables_getrule_reset_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nftables_getrule_reset_rsp>
+nftables_getrule_reset(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_getrule_reset_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DELRULE ============== */
+/* DELRULE - do */
+static void
+nftables_delrule_put(struct nlmsghdr *nlh, nftables_delrule_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 20 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.handle.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_RULE_ATTRS_HANDLE, req.handle.value());
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_RULE_ATTRS_ID, req.id.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_RULE_ATTRS_TABLE, req.table.data());
+	if (req.chain.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_RULE_ATTRS_CHAIN, req.chain.data());
+}
+
+static ynl_cpp::result<void>
+nftables_delrule_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_rule_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_delrule_ex(ynl_cpp::ynl_socket&  ys, nftables_delrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2568, req._nlmsg_flags);
+	nftables_delrule_put(nlh, req);
+
+	return nftables_delrule_exec(ys, nlh);
+}
+
+int nftables_delrule(ynl_cpp::ynl_socket&  ys, nftables_delrule_req& req)
+{
+	auto ret = nftables_delrule_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delrule_prepare(ynl_cpp::ynl_socket&  ys, nftables_delrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2568, req._nlmsg_flags);
+	nftables_delrule_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_delrule_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nftables_delrule_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_delrule(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_delrule_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_delrule_batch(ynl_cpp::msg_batch& batch, nftables_delrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2568, req._nlmsg_flags);
+	nftables_delrule_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_rule_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== DESTROYRULE ============== */
+/* DESTROYRULE - do */
+static void
+nftables_destroyrule_put(struct nlmsghdr *nlh, nftables_destroyrule_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 20 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.handle.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_RULE_ATTRS_HANDLE, req.handle.value());
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_RULE_ATTRS_ID, req.id.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_RULE_ATTRS_TABLE, req.table.data());
+	if (req.chain.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_RULE_ATTRS_CHAIN, req.chain.data());
+}
+
+static ynl_cpp::result<void>
+nftables_destroyrule_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_rule_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_destroyrule_ex(ynl_cpp::ynl_socket&  ys,
+			nftables_destroyrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2588, req._nlmsg_flags);
+	nftables_destroyrule_put(nlh, req);
+
+	return nftables_destroyrule_exec(ys, nlh);
+}
+
+int nftables_destroyrule(ynl_cpp::ynl_socket&  ys,
+			 nftables_destroyrule_req& req)
+{
+	auto ret = nftables_destroyrule_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroyrule_prepare(ynl_cpp::ynl_socket&  ys,
+			     nftables_destroyrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2588, req._nlmsg_flags);
+	nftables_destroyrule_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_destroyrule_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	return nftables_destroyrule_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_destroyrule(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_destroyrule_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_destroyrule_batch(ynl_cpp::msg_batch& batch,
+			   nftables_destroyrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2588, req._nlmsg_flags);
+	nftables_destroyrule_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_rule_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== NEWSET ============== */
+/* NEWSET - do */
+static void nftables_newset_put(struct nlmsghdr *nlh, nftables_newset_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 84 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.flags.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SET_ATTRS_FLAGS, req.flags.value());
+	if (req.key_type.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SET_ATTRS_KEY_TYPE, req.key_type.value());
+	if (req.key_len.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SET_ATTRS_KEY_LEN, req.key_len.value());
+	if (req.data_type.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SET_ATTRS_DATA_TYPE, req.data_type.value());
+	if (req.data_len.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SET_ATTRS_DATA_LEN, req.data_len.value());
+	if (req.policy.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SET_ATTRS_POLICY, req.policy.value());
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SET_ATTRS_ID, req.id.value());
+	if (req.timeout.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_SET_ATTRS_TIMEOUT, req.timeout.value());
+	if (req.gc_interval.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SET_ATTRS_GC_INTERVAL, req.gc_interval.value());
+	if (req.obj_type.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SET_ATTRS_OBJ_TYPE, req.obj_type.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SET_ATTRS_TABLE, req.table.data());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SET_ATTRS_NAME, req.name.data());
+	if (req.desc.has_value())
+		nftables_set_desc_attrs_put(nlh, NFTABLES_A_SET_ATTRS_DESC, req.desc.value());
+	if (req.userdata.size() > 0)
+		ynl_attr_put(nlh, NFTABLES_A_SET_ATTRS_USERDATA, req.userdata.data(), req.userdata.size());
+}
+
+static ynl_cpp::result<void>
+nftables_newset_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_set_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_newset_ex(ynl_cpp::ynl_socket&  ys, nftables_newset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2569, req._nlmsg_flags);
+	nftables_newset_put(nlh, req);
+
+	return nftables_newset_exec(ys, nlh);
+}
+
+int nftables_newset(ynl_cpp::ynl_socket&  ys, nftables_newset_req& req)
+{
+	auto ret = nftables_newset_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newset_prepare(ynl_cpp::ynl_socket&  ys, nftables_newset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2569, req._nlmsg_flags);
+	nftables_newset_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_newset_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nftables_newset_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_newset(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_newset_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_newset_batch(ynl_cpp::msg_batch& batch, nftables_newset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2569, req._nlmsg_flags);
+	nftables_newset_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_set_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== GETSET ============== */
+/* GETSET - do */
+int nftables_getset_rsp_parse(const struct nlmsghdr *nlh,
+			      struct ynl_parse_arg *yarg)
+{
+	const struct nlattr *attr;
+	nftables_getset_rsp *dst;
+	void *hdr;
+
+	dst = (nftables_getset_rsp*)yarg->data;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct nfgenmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct nfgenmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == NFTABLES_A_SET_ATTRS_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void nftables_getset_put(struct nlmsghdr *nlh, nftables_getset_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SET_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<nftables_getset_rsp>>
+nftables_getset_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<nftables_getset_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_set_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+	yrs.yarg.rsp_policy = &nftables_set_attrs_nest;
+
+	rsp.reset(new nftables_getset_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = nftables_getset_rsp_parse;
+	yrs.rsp_cmd = 2569;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getset_rsp>>
+nftables_getset_ex(ynl_cpp::ynl_socket&  ys, nftables_getset_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2570, req._nlmsg_flags);
+	nftables_getset_put(nlh, req);
+
+	return nftables_getset_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nftables_getset_rsp>
+nftables_getset(ynl_cpp::ynl_socket&  ys, nftables_getset_req& req)
+{
+	auto ret = nftables_getset_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getset_prepare(ynl_cpp::ynl_socket&  ys, nftables_getset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2570, req._nlmsg_flags);
+	nftables_getset_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getset_rsp>>
+nftables_getset_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return nftables_getset_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nftables_getset_rsp>
+nftables_getset(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_getset_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DELSET ============== */
+/* DELSET - do */
+static void nftables_delset_put(struct nlmsghdr *nlh, nftables_delset_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 12 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.handle.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_SET_ATTRS_HANDLE, req.handle.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SET_ATTRS_TABLE, req.table.data());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SET_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_delset_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_set_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_delset_ex(ynl_cpp::ynl_socket&  ys, nftables_delset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2571, req._nlmsg_flags);
+	nftables_delset_put(nlh, req);
+
+	return nftables_delset_exec(ys, nlh);
+}
+
+int nftables_delset(ynl_cpp::ynl_socket&  ys, nftables_delset_req& req)
+{
+	auto ret = nftables_delset_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delset_prepare(ynl_cpp::ynl_socket&  ys, nftables_delset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2571, req._nlmsg_flags);
+	nftables_delset_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_delset_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nftables_delset_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_delset(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_delset_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_delset_batch(ynl_cpp::msg_batch& batch, nftables_delset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2571, req._nlmsg_flags);
+	nftables_delset_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_set_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== DESTROYSET ============== */
+/* DESTROYSET - do */
+static void
+nftables_destroyset_put(struct nlmsghdr *nlh, nftables_destroyset_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 12 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.handle.has_value())
+		ynl_attr_put_u64_unchecked(nlh, NFTABLES_A_SET_ATTRS_HANDLE, req.handle.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SET_ATTRS_TABLE, req.table.data());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SET_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_destroyset_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_set_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_destroyset_ex(ynl_cpp::ynl_socket&  ys, nftables_destroyset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2589, req._nlmsg_flags);
+	nftables_destroyset_put(nlh, req);
+
+	return nftables_destroyset_exec(ys, nlh);
+}
+
+int nftables_destroyset(ynl_cpp::ynl_socket&  ys, nftables_destroyset_req& req)
+{
+	auto ret = nftables_destroyset_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroyset_prepare(ynl_cpp::ynl_socket&  ys,
+			    nftables_destroyset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2589, req._nlmsg_flags);
+	nftables_destroyset_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_destroyset_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	return nftables_destroyset_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_destroyset(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_destroyset_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_destroyset_batch(ynl_cpp::msg_batch& batch,
+			  nftables_destroyset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2589, req._nlmsg_flags);
+	nftables_destroyset_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_set_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== NEWSETELEM ============== */
+/* NEWSETELEM - do */
+static void
+nftables_newsetelem_put(struct nlmsghdr *nlh, nftables_newsetelem_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.set_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_SET_ID, req.set_id.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_TABLE, req.table.data());
+	if (req.set.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_SET, req.set.data());
+	if (req.elements.has_value())
+		nftables_setelem_list_elem_attrs_put(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_ELEMENTS, req.elements.value());
+}
+
+static ynl_cpp::result<void>
+nftables_newsetelem_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_setelem_list_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_newsetelem_ex(ynl_cpp::ynl_socket&  ys, nftables_newsetelem_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2572, req._nlmsg_flags);
+	nftables_newsetelem_put(nlh, req);
+
+	return nftables_newsetelem_exec(ys, nlh);
+}
+
+int nftables_newsetelem(ynl_cpp::ynl_socket&  ys, nftables_newsetelem_req& req)
+{
+	auto ret = nftables_newsetelem_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newsetelem_prepare(ynl_cpp::ynl_socket&  ys,
+			    nftables_newsetelem_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2572, req._nlmsg_flags);
+	nftables_newsetelem_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_newsetelem_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	return nftables_newsetelem_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_newsetelem(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_newsetelem_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_newsetelem_batch(ynl_cpp::msg_batch& batch,
+			  nftables_newsetelem_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2572, req._nlmsg_flags);
+	nftables_newsetelem_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_setelem_list_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== GETSETELEM ============== */
+/* GETSETELEM - do */
+int nftables_getsetelem_rsp_parse(const struct nlmsghdr *nlh,
+				  struct ynl_parse_arg *yarg)
+{
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+nftables_getsetelem_put(struct nlmsghdr *nlh, nftables_getsetelem_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<nftables_getsetelem_rsp>>
+nftables_getsetelem_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			 const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<nftables_getsetelem_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_setelem_list_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+	yrs.yarg.rsp_policy = &nftables_setelem_list_attrs_nest;
+
+	rsp.reset(new nftables_getsetelem_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = nftables_getsetelem_rsp_parse;
+	yrs.rsp_cmd = 2572;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getsetelem_rsp>>
+nftables_getsetelem_ex(ynl_cpp::ynl_socket&  ys, nftables_getsetelem_req& req,
+		       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2573, req._nlmsg_flags);
+	nftables_getsetelem_put(nlh, req);
+
+	return nftables_getsetelem_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nftables_getsetelem_rsp>
+nftables_getsetelem(ynl_cpp::ynl_socket&  ys, nftables_getsetelem_req& req)
+{
+	auto ret = nftables_getsetelem_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getsetelem_prepare(ynl_cpp::ynl_socket&  ys,
+			    nftables_getsetelem_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2573, req._nlmsg_flags);
+	nftables_getsetelem_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getsetelem_rsp>>
+nftables_getsetelem_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj)
+{
+	return nftables_getsetelem_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nftables_getsetelem_rsp>
+nftables_getsetelem(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_getsetelem_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== GETSETELEM_RESET ============== */
+/* GETSETELEM_RESET - do */
+int nftables_getsetelem_reset_rsp_parse(const struct nlmsghdr *nlh,
+					struct ynl_parse_arg *yarg)
+{
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+nftables_getsetelem_reset_put(struct nlmsghdr *nlh,
+			      nftables_getsetelem_reset_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<nftables_getsetelem_reset_rsp>>
+nftables_getsetelem_reset_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<nftables_getsetelem_reset_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_setelem_list_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+	yrs.yarg.rsp_policy = &nftables_setelem_list_attrs_nest;
+
+	rsp.reset(new nftables_getsetelem_reset_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = nftables_getsetelem_reset_rsp_parse;
+	yrs.rsp_cmd = 2572;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getsetelem_reset_rsp>>
+nftables_getsetelem_reset_ex(ynl_cpp::ynl_socket&  ys,
+			     nftables_getsetelem_reset_req& req,
+			     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2593, req._nlmsg_flags);
+	nftables_getsetelem_reset_put(nlh, req);
+
+	return nftables_getsetelem_reset_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nftables_getsetelem_reset_rsp>
+nftables_getsetelem_reset(ynl_cpp::ynl_socket&  ys,
+			  nftables_getsetelem_reset_req& req)
+{
+	auto ret = nftables_getsetelem_reset_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getsetelem_reset_prepare(ynl_cpp::ynl_socket&  ys,
+				  nftables_getsetelem_reset_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2593, req._nlmsg_flags);
+	nftables_getsetelem_reset_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getsetelem_reset_rsp>>
+nftables_getsetelem_reset_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return nftables_getsetelem_reset_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nftables_getsetelem_reset_rsp>
+nftables_getsetelem_reset(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_getsetelem_reset_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DELSETELEM ============== */
+/* DELSETELEM - do */
+static void
+nftables_delsetelem_put(struct nlmsghdr *nlh, nftables_delsetelem_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.set_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_SET_ID, req.set_id.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_TABLE, req.table.data());
+	if (req.set.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_SET, req.set.data());
+	if (req.elements.has_value())
+		nftables_setelem_list_elem_attrs_put(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_ELEMENTS, req.elements.value());
+}
+
+static ynl_cpp::result<void>
+nftables_delsetelem_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_setelem_list_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_delsetelem_ex(ynl_cpp::ynl_socket&  ys, nftables_delsetelem_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2574, req._nlmsg_flags);
+	nftables_delsetelem_put(nlh, req);
+
+	return nftables_delsetelem_exec(ys, nlh);
+}
+
+int nftables_delsetelem(ynl_cpp::ynl_socket&  ys, nftables_delsetelem_req& req)
+{
+	auto ret = nftables_delsetelem_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delsetelem_prepare(ynl_cpp::ynl_socket&  ys,
+			    nftables_delsetelem_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2574, req._nlmsg_flags);
+	nftables_delsetelem_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_delsetelem_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	return nftables_delsetelem_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_delsetelem(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_delsetelem_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_delsetelem_batch(ynl_cpp::msg_batch& batch,
+			  nftables_delsetelem_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2574, req._nlmsg_flags);
+	nftables_delsetelem_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_setelem_list_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== DESTROYSETELEM ============== */
+/* DESTROYSETELEM - do */
+static void
+nftables_destroysetelem_put(struct nlmsghdr *nlh,
+			    nftables_destroysetelem_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.set_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_SET_ID, req.set_id.value());
+	if (req.table.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_TABLE, req.table.data());
+	if (req.set.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_SET, req.set.data());
+	if (req.elements.has_value())
+		nftables_setelem_list_elem_attrs_put(nlh, NFTABLES_A_SETELEM_LIST_ATTRS_ELEMENTS, req.elements.value());
+}
+
+static ynl_cpp::result<void>
+nftables_destroysetelem_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_setelem_list_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_destroysetelem_ex(ynl_cpp::ynl_socket&  ys,
+			   nftables_destroysetelem_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2590, req._nlmsg_flags);
+	nftables_destroysetelem_put(nlh, req);
+
+	return nftables_destroysetelem_exec(ys, nlh);
+}
+
+int nftables_destroysetelem(ynl_cpp::ynl_socket&  ys,
+			    nftables_destroysetelem_req& req)
+{
+	auto ret = nftables_destroysetelem_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroysetelem_prepare(ynl_cpp::ynl_socket&  ys,
+				nftables_destroysetelem_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2590, req._nlmsg_flags);
+	nftables_destroysetelem_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_destroysetelem_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl)
+{
+	return nftables_destroysetelem_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_destroysetelem(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_destroysetelem_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_destroysetelem_batch(ynl_cpp::msg_batch& batch,
+			      nftables_destroysetelem_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2590, req._nlmsg_flags);
+	nftables_destroysetelem_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_setelem_list_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== GETGEN ============== */
+/* GETGEN - do */
+int nftables_getgen_rsp_parse(const struct nlmsghdr *nlh,
+			      struct ynl_parse_arg *yarg)
+{
+	return YNL_PARSE_CB_OK;
+}
+
+static void nftables_getgen_put(struct nlmsghdr *nlh, nftables_getgen_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<nftables_getgen_rsp>>
+nftables_getgen_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<nftables_getgen_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_gen_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+	yrs.yarg.rsp_policy = &nftables_gen_attrs_nest;
+
+	rsp.reset(new nftables_getgen_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = nftables_getgen_rsp_parse;
+	yrs.rsp_cmd = 2575;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getgen_rsp>>
+nftables_getgen_ex(ynl_cpp::ynl_socket&  ys, nftables_getgen_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2576, req._nlmsg_flags);
+	nftables_getgen_put(nlh, req);
+
+	return nftables_getgen_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nftables_getgen_rsp>
+nftables_getgen(ynl_cpp::ynl_socket&  ys, nftables_getgen_req& req)
+{
+	auto ret = nftables_getgen_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getgen_prepare(ynl_cpp::ynl_socket&  ys, nftables_getgen_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2576, req._nlmsg_flags);
+	nftables_getgen_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getgen_rsp>>
+nftables_getgen_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return nftables_getgen_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nftables_getgen_rsp>
+nftables_getgen(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_getgen_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== NEWOBJ ============== */
+/* NEWOBJ - do */
+static void nftables_newobj_put(struct nlmsghdr *nlh, nftables_newobj_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_OBJ_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_newobj_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_obj_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_newobj_ex(ynl_cpp::ynl_socket&  ys, nftables_newobj_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2578, req._nlmsg_flags);
+	nftables_newobj_put(nlh, req);
+
+	return nftables_newobj_exec(ys, nlh);
+}
+
+int nftables_newobj(ynl_cpp::ynl_socket&  ys, nftables_newobj_req& req)
+{
+	auto ret = nftables_newobj_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newobj_prepare(ynl_cpp::ynl_socket&  ys, nftables_newobj_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2578, req._nlmsg_flags);
+	nftables_newobj_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_newobj_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nftables_newobj_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_newobj(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_newobj_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_newobj_batch(ynl_cpp::msg_batch& batch, nftables_newobj_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2578, req._nlmsg_flags);
+	nftables_newobj_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_obj_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== GETOBJ ============== */
+/* GETOBJ - do */
+int nftables_getobj_rsp_parse(const struct nlmsghdr *nlh,
+			      struct ynl_parse_arg *yarg)
+{
+	const struct nlattr *attr;
+	nftables_getobj_rsp *dst;
+	void *hdr;
+
+	dst = (nftables_getobj_rsp*)yarg->data;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct nfgenmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct nfgenmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == NFTABLES_A_OBJ_ATTRS_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void nftables_getobj_put(struct nlmsghdr *nlh, nftables_getobj_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_OBJ_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<nftables_getobj_rsp>>
+nftables_getobj_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<nftables_getobj_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_obj_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+	yrs.yarg.rsp_policy = &nftables_obj_attrs_nest;
+
+	rsp.reset(new nftables_getobj_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = nftables_getobj_rsp_parse;
+	yrs.rsp_cmd = 2578;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getobj_rsp>>
+nftables_getobj_ex(ynl_cpp::ynl_socket&  ys, nftables_getobj_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2579, req._nlmsg_flags);
+	nftables_getobj_put(nlh, req);
+
+	return nftables_getobj_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nftables_getobj_rsp>
+nftables_getobj(ynl_cpp::ynl_socket&  ys, nftables_getobj_req& req)
+{
+	auto ret = nftables_getobj_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getobj_prepare(ynl_cpp::ynl_socket&  ys, nftables_getobj_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2579, req._nlmsg_flags);
+	nftables_getobj_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getobj_rsp>>
+nftables_getobj_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return nftables_getobj_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nftables_getobj_rsp>
+nftables_getobj(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_getobj_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DELOBJ ============== */
+/* DELOBJ - do */
+static void nftables_delobj_put(struct nlmsghdr *nlh, nftables_delobj_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_OBJ_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_delobj_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_obj_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_delobj_ex(ynl_cpp::ynl_socket&  ys, nftables_delobj_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2580, req._nlmsg_flags);
+	nftables_delobj_put(nlh, req);
+
+	return nftables_delobj_exec(ys, nlh);
+}
+
+int nftables_delobj(ynl_cpp::ynl_socket&  ys, nftables_delobj_req& req)
+{
+	auto ret = nftables_delobj_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delobj_prepare(ynl_cpp::ynl_socket&  ys, nftables_delobj_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2580, req._nlmsg_flags);
+	nftables_delobj_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_delobj_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return nftables_delobj_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_delobj(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_delobj_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_delobj_batch(ynl_cpp::msg_batch& batch, nftables_delobj_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2580, req._nlmsg_flags);
+	nftables_delobj_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_obj_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== DESTROYOBJ ============== */
+/* DESTROYOBJ - do */
+static void
+nftables_destroyobj_put(struct nlmsghdr *nlh, nftables_destroyobj_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_OBJ_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_destroyobj_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_obj_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_destroyobj_ex(ynl_cpp::ynl_socket&  ys, nftables_destroyobj_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2591, req._nlmsg_flags);
+	nftables_destroyobj_put(nlh, req);
+
+	return nftables_destroyobj_exec(ys, nlh);
+}
+
+int nftables_destroyobj(ynl_cpp::ynl_socket&  ys, nftables_destroyobj_req& req)
+{
+	auto ret = nftables_destroyobj_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroyobj_prepare(ynl_cpp::ynl_socket&  ys,
+			    nftables_destroyobj_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2591, req._nlmsg_flags);
+	nftables_destroyobj_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_destroyobj_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	return nftables_destroyobj_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_destroyobj(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_destroyobj_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_destroyobj_batch(ynl_cpp::msg_batch& batch,
+			  nftables_destroyobj_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2591, req._nlmsg_flags);
+	nftables_destroyobj_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_obj_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== NEWFLOWTABLE ============== */
+/* NEWFLOWTABLE - do */
+static void
+nftables_newflowtable_put(struct nlmsghdr *nlh, nftables_newflowtable_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_FLOWTABLE_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_newflowtable_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_flowtable_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_newflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 nftables_newflowtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2582, req._nlmsg_flags);
+	nftables_newflowtable_put(nlh, req);
+
+	return nftables_newflowtable_exec(ys, nlh);
+}
+
+int nftables_newflowtable(ynl_cpp::ynl_socket&  ys,
+			  nftables_newflowtable_req& req)
+{
+	auto ret = nftables_newflowtable_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newflowtable_prepare(ynl_cpp::ynl_socket&  ys,
+			      nftables_newflowtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2582, req._nlmsg_flags);
+	nftables_newflowtable_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_newflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	return nftables_newflowtable_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_newflowtable(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_newflowtable_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_newflowtable_batch(ynl_cpp::msg_batch& batch,
+			    nftables_newflowtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2582, req._nlmsg_flags);
+	nftables_newflowtable_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_flowtable_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== GETFLOWTABLE ============== */
+/* GETFLOWTABLE - do */
+int nftables_getflowtable_rsp_parse(const struct nlmsghdr *nlh,
+				    struct ynl_parse_arg *yarg)
+{
+	nftables_getflowtable_rsp *dst;
+	const struct nlattr *attr;
+	void *hdr;
+
+	dst = (nftables_getflowtable_rsp*)yarg->data;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct nfgenmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct nfgenmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == NFTABLES_A_FLOWTABLE_ATTRS_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+nftables_getflowtable_put(struct nlmsghdr *nlh, nftables_getflowtable_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_FLOWTABLE_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<nftables_getflowtable_rsp>>
+nftables_getflowtable_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<nftables_getflowtable_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_flowtable_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+	yrs.yarg.rsp_policy = &nftables_flowtable_attrs_nest;
+
+	rsp.reset(new nftables_getflowtable_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = nftables_getflowtable_rsp_parse;
+	yrs.rsp_cmd = 2582;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getflowtable_rsp>>
+nftables_getflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 nftables_getflowtable_req& req,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2583, req._nlmsg_flags);
+	nftables_getflowtable_put(nlh, req);
+
+	return nftables_getflowtable_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nftables_getflowtable_rsp>
+nftables_getflowtable(ynl_cpp::ynl_socket&  ys, nftables_getflowtable_req& req)
+{
+	auto ret = nftables_getflowtable_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getflowtable_prepare(ynl_cpp::ynl_socket&  ys,
+			      nftables_getflowtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2583, req._nlmsg_flags);
+	nftables_getflowtable_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<nftables_getflowtable_rsp>>
+nftables_getflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return nftables_getflowtable_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nftables_getflowtable_rsp>
+nftables_getflowtable(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_getflowtable_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== DELFLOWTABLE ============== */
+/* DELFLOWTABLE - do */
+static void
+nftables_delflowtable_put(struct nlmsghdr *nlh, nftables_delflowtable_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_FLOWTABLE_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_delflowtable_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_flowtable_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_delflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 nftables_delflowtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2584, req._nlmsg_flags);
+	nftables_delflowtable_put(nlh, req);
+
+	return nftables_delflowtable_exec(ys, nlh);
+}
+
+int nftables_delflowtable(ynl_cpp::ynl_socket&  ys,
+			  nftables_delflowtable_req& req)
+{
+	auto ret = nftables_delflowtable_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delflowtable_prepare(ynl_cpp::ynl_socket&  ys,
+			      nftables_delflowtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2584, req._nlmsg_flags);
+	nftables_delflowtable_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_delflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	return nftables_delflowtable_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_delflowtable(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_delflowtable_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_delflowtable_batch(ynl_cpp::msg_batch& batch,
+			    nftables_delflowtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2584, req._nlmsg_flags);
+	nftables_delflowtable_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_flowtable_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+/* ============== DESTROYFLOWTABLE ============== */
+/* DESTROYFLOWTABLE - do */
+static void
+nftables_destroyflowtable_put(struct nlmsghdr *nlh,
+			      nftables_destroyflowtable_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, NFTABLES_A_FLOWTABLE_ATTRS_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+nftables_destroyflowtable_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &nftables_flowtable_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct nfgenmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+nftables_destroyflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			     nftables_destroyflowtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2592, req._nlmsg_flags);
+	nftables_destroyflowtable_put(nlh, req);
+
+	return nftables_destroyflowtable_exec(ys, nlh);
+}
+
+int nftables_destroyflowtable(ynl_cpp::ynl_socket&  ys,
+			      nftables_destroyflowtable_req& req)
+{
+	auto ret = nftables_destroyflowtable_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroyflowtable_prepare(ynl_cpp::ynl_socket&  ys,
+				  nftables_destroyflowtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, 2592, req._nlmsg_flags);
+	nftables_destroyflowtable_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct nfgenmsg));
+}
+
+ynl_cpp::result<void>
+nftables_destroyflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl)
+{
+	return nftables_destroyflowtable_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int nftables_destroyflowtable(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl)
+{
+	auto ret = nftables_destroyflowtable_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+nftables_destroyflowtable_batch(ynl_cpp::msg_batch& batch,
+				nftables_destroyflowtable_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(2592, req._nlmsg_flags);
+	nftables_destroyflowtable_put(nlh, req);
+	return batch.msg_end(nlh, &nftables_flowtable_attrs_nest, sizeof(struct nfgenmsg));
+}
+
+static const struct ynl_mcast_grp nftables_mcast_groups[] = {
+	{ "mgmt", 7 },
+};
+
+const struct ynl_family ynl_nftables_family =  {
+	.name		= "nftables",
+	.hdr_len	= 0,
+	.is_classic	= true,
+	.classic_id	= 12,
+	.mcast_groups	= nftables_mcast_groups,
+	.n_mcast_groups	= std::size(nftables_mcast_groups),
+};
+const struct ynl_family& get_ynl_nftables_family() {
+	return ynl_nftables_family;
+};
+} //namespace ynl_cpp
@@ -0,0 +1,1690 @@
+/* SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause) */
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user header */
+
+#ifndef _LINUX_NFTABLES_GEN_H
+#define _LINUX_NFTABLES_GEN_H
+
+#include <linux/types.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ynl.hpp"
+
+#include <linux/netlink.h>
+
+namespace ynl_cpp {
+/* Definitions */
+enum nftables_meta_keys {
+	NFTABLES_META_KEYS_LEN = 0,
+	NFTABLES_META_KEYS_PROTOCOL = 1,
+	NFTABLES_META_KEYS_PRIORITY = 2,
+	NFTABLES_META_KEYS_MARK = 3,
+	NFTABLES_META_KEYS_IIF = 4,
+	NFTABLES_META_KEYS_OIF = 5,
+	NFTABLES_META_KEYS_IIFNAME = 6,
+	NFTABLES_META_KEYS_OIFNAME = 7,
+	NFTABLES_META_KEYS_IFTYPE = 8,
+	NFTABLES_META_KEYS_OIFTYPE = 9,
+	NFTABLES_META_KEYS_SKUID = 10,
+	NFTABLES_META_KEYS_SKGID = 11,
+	NFTABLES_META_KEYS_NFTRACE = 12,
+	NFTABLES_META_KEYS_RTCLASSID = 13,
+	NFTABLES_META_KEYS_SECMARK = 14,
+	NFTABLES_META_KEYS_NFPROTO = 15,
+	NFTABLES_META_KEYS_L4_PROTO = 16,
+	NFTABLES_META_KEYS_BRI_IIFNAME = 17,
+	NFTABLES_META_KEYS_BRI_OIFNAME = 18,
+	NFTABLES_META_KEYS_PKTTYPE = 19,
+	NFTABLES_META_KEYS_CPU = 20,
+	NFTABLES_META_KEYS_IIFGROUP = 21,
+	NFTABLES_META_KEYS_OIFGROUP = 22,
+	NFTABLES_META_KEYS_CGROUP = 23,
+	NFTABLES_META_KEYS_PRANDOM = 24,
+	NFTABLES_META_KEYS_SECPATH = 25,
+	NFTABLES_META_KEYS_IIFKIND = 26,
+	NFTABLES_META_KEYS_OIFKIND = 27,
+	NFTABLES_META_KEYS_BRI_IIFPVID = 28,
+	NFTABLES_META_KEYS_BRI_IIFVPROTO = 29,
+	NFTABLES_META_KEYS_TIME_NS = 30,
+	NFTABLES_META_KEYS_TIME_DAY = 31,
+	NFTABLES_META_KEYS_TIME_HOUR = 32,
+	NFTABLES_META_KEYS_SDIF = 33,
+	NFTABLES_META_KEYS_SDIFNAME = 34,
+	NFTABLES_META_KEYS_BRI_BROUTE = 35,
+};
+
+enum nftables_bitwise_ops {
+	NFTABLES_BITWISE_OPS_BOOL = 0,
+	NFTABLES_BITWISE_OPS_LSHIFT = 1,
+	NFTABLES_BITWISE_OPS_RSHIFT = 2,
+};
+
+enum nftables_cmp_ops {
+	NFTABLES_CMP_OPS_EQ = 0,
+	NFTABLES_CMP_OPS_NEQ = 1,
+	NFTABLES_CMP_OPS_LT = 2,
+	NFTABLES_CMP_OPS_LTE = 3,
+	NFTABLES_CMP_OPS_GT = 4,
+	NFTABLES_CMP_OPS_GTE = 5,
+};
+
+enum nftables_object_type {
+	NFTABLES_OBJECT_TYPE_UNSPEC = 0,
+	NFTABLES_OBJECT_TYPE_COUNTER = 1,
+	NFTABLES_OBJECT_TYPE_QUOTA = 2,
+	NFTABLES_OBJECT_TYPE_CT_HELPER = 3,
+	NFTABLES_OBJECT_TYPE_LIMIT = 4,
+	NFTABLES_OBJECT_TYPE_CONNLIMIT = 5,
+	NFTABLES_OBJECT_TYPE_TUNNEL = 6,
+	NFTABLES_OBJECT_TYPE_CT_TIMEOUT = 7,
+	NFTABLES_OBJECT_TYPE_SECMARK = 8,
+	NFTABLES_OBJECT_TYPE_CT_EXPECT = 9,
+	NFTABLES_OBJECT_TYPE_SYNPROXY = 10,
+};
+
+enum nftables_nat_range_flags {
+	NFTABLES_NAT_RANGE_FLAGS_MAP_IPS = 1,
+	NFTABLES_NAT_RANGE_FLAGS_PROTO_SPECIFIED = 2,
+	NFTABLES_NAT_RANGE_FLAGS_PROTO_RANDOM = 4,
+	NFTABLES_NAT_RANGE_FLAGS_PERSISTENT = 8,
+	NFTABLES_NAT_RANGE_FLAGS_PROTO_RANDOM_FULLY = 16,
+	NFTABLES_NAT_RANGE_FLAGS_PROTO_OFFSET = 32,
+	NFTABLES_NAT_RANGE_FLAGS_NETMAP = 64,
+};
+
+enum nftables_table_flags {
+	NFTABLES_TABLE_FLAGS_DORMANT = 1,
+	NFTABLES_TABLE_FLAGS_OWNER = 2,
+	NFTABLES_TABLE_FLAGS_PERSIST = 4,
+};
+
+enum nftables_chain_flags {
+	NFTABLES_CHAIN_FLAGS_BASE = 1,
+	NFTABLES_CHAIN_FLAGS_HW_OFFLOAD = 2,
+	NFTABLES_CHAIN_FLAGS_BINDING = 4,
+};
+
+enum nftables_set_flags {
+	NFTABLES_SET_FLAGS_ANONYMOUS = 1,
+	NFTABLES_SET_FLAGS_CONSTANT = 2,
+	NFTABLES_SET_FLAGS_INTERVAL = 4,
+	NFTABLES_SET_FLAGS_MAP = 8,
+	NFTABLES_SET_FLAGS_TIMEOUT = 16,
+	NFTABLES_SET_FLAGS_EVAL = 32,
+	NFTABLES_SET_FLAGS_OBJECT = 64,
+	NFTABLES_SET_FLAGS_CONCAT = 128,
+	NFTABLES_SET_FLAGS_EXPR = 256,
+};
+
+enum nftables_lookup_flags {
+	NFTABLES_LOOKUP_FLAGS_INVERT = 1,
+};
+
+enum nftables_ct_keys {
+	NFTABLES_CT_KEYS_STATE = 0,
+	NFTABLES_CT_KEYS_DIRECTION = 1,
+	NFTABLES_CT_KEYS_STATUS = 2,
+	NFTABLES_CT_KEYS_MARK = 3,
+	NFTABLES_CT_KEYS_SECMARK = 4,
+	NFTABLES_CT_KEYS_EXPIRATION = 5,
+	NFTABLES_CT_KEYS_HELPER = 6,
+	NFTABLES_CT_KEYS_L3PROTOCOL = 7,
+	NFTABLES_CT_KEYS_SRC = 8,
+	NFTABLES_CT_KEYS_DST = 9,
+	NFTABLES_CT_KEYS_PROTOCOL = 10,
+	NFTABLES_CT_KEYS_PROTO_SRC = 11,
+	NFTABLES_CT_KEYS_PROTO_DST = 12,
+	NFTABLES_CT_KEYS_LABELS = 13,
+	NFTABLES_CT_KEYS_PKTS = 14,
+	NFTABLES_CT_KEYS_BYTES = 15,
+	NFTABLES_CT_KEYS_AVGPKT = 16,
+	NFTABLES_CT_KEYS_ZONE = 17,
+	NFTABLES_CT_KEYS_EVENTMASK = 18,
+	NFTABLES_CT_KEYS_SRC_IP = 19,
+	NFTABLES_CT_KEYS_DST_IP = 20,
+	NFTABLES_CT_KEYS_SRC_IP6 = 21,
+	NFTABLES_CT_KEYS_DST_IP6 = 22,
+	NFTABLES_CT_KEYS_CT_ID = 23,
+};
+
+enum nftables_ct_direction {
+	NFTABLES_CT_DIRECTION_ORIGINAL = 0,
+	NFTABLES_CT_DIRECTION_REPLY = 1,
+};
+
+enum nftables_quota_flags {
+	NFTABLES_QUOTA_FLAGS_INVERT = 1,
+	NFTABLES_QUOTA_FLAGS_DEPLETED = 2,
+};
+
+enum nftables_verdict_code {
+	NFTABLES_VERDICT_CODE_CONTINUE = 4294967295,
+	NFTABLES_VERDICT_CODE_BREAK = 4294967294,
+	NFTABLES_VERDICT_CODE_JUMP = 4294967293,
+	NFTABLES_VERDICT_CODE_GOTO = 4294967292,
+	NFTABLES_VERDICT_CODE_RETURN = 4294967291,
+	NFTABLES_VERDICT_CODE_DROP = 0,
+	NFTABLES_VERDICT_CODE_ACCEPT = 1,
+	NFTABLES_VERDICT_CODE_STOLEN = 2,
+	NFTABLES_VERDICT_CODE_QUEUE = 3,
+	NFTABLES_VERDICT_CODE_REPEAT = 4,
+};
+
+enum nftables_fib_result {
+	NFTABLES_FIB_RESULT_OIF = 0,
+	NFTABLES_FIB_RESULT_OIFNAME = 1,
+	NFTABLES_FIB_RESULT_ADDRTYPE = 2,
+};
+
+enum nftables_fib_flags {
+	NFTABLES_FIB_FLAGS_SADDR = 1,
+	NFTABLES_FIB_FLAGS_DADDR = 2,
+	NFTABLES_FIB_FLAGS_MARK = 4,
+	NFTABLES_FIB_FLAGS_IIF = 8,
+	NFTABLES_FIB_FLAGS_OIF = 16,
+	NFTABLES_FIB_FLAGS_PRESENT = 32,
+};
+
+enum nftables_reject_types {
+	NFTABLES_REJECT_TYPES_ICMP_UNREACH = 0,
+	NFTABLES_REJECT_TYPES_TCP_RST = 1,
+	NFTABLES_REJECT_TYPES_ICMPX_UNREACH = 2,
+};
+
+struct nfgenmsg {
+	__u8 nfgen_family;
+	__u8 version;
+	__be16 res_id;
+};
+
+/* Attributes */
+enum {
+	NFTABLES_A_EMPTY_ATTRS_NAME = 1,
+};
+
+enum {
+	NFTABLES_A_BATCH_ATTRS_GENID = 1,
+};
+
+enum {
+	NFTABLES_A_TABLE_ATTRS_NAME = 1,
+	NFTABLES_A_TABLE_ATTRS_FLAGS = 2,
+	NFTABLES_A_TABLE_ATTRS_USE = 3,
+	NFTABLES_A_TABLE_ATTRS_HANDLE = 4,
+	NFTABLES_A_TABLE_ATTRS_USERDATA = 5,
+};
+
+enum {
+	NFTABLES_A_CHAIN_ATTRS_TABLE = 1,
+	NFTABLES_A_CHAIN_ATTRS_HANDLE = 2,
+	NFTABLES_A_CHAIN_ATTRS_NAME = 3,
+	NFTABLES_A_CHAIN_ATTRS_HOOK = 4,
+	NFTABLES_A_CHAIN_ATTRS_POLICY = 5,
+	NFTABLES_A_CHAIN_ATTRS_USE = 6,
+	NFTABLES_A_CHAIN_ATTRS_TYPE = 7,
+	NFTABLES_A_CHAIN_ATTRS_COUNTERS = 8,
+	NFTABLES_A_CHAIN_ATTRS_FLAGS = 9,
+	NFTABLES_A_CHAIN_ATTRS_ID = 10,
+	NFTABLES_A_CHAIN_ATTRS_USERDATA = 11,
+};
+
+enum {
+	NFTABLES_A_COUNTER_ATTRS_BYTES = 1,
+	NFTABLES_A_COUNTER_ATTRS_PACKETS = 2,
+	NFTABLES_A_COUNTER_ATTRS_PAD = 3,
+};
+
+enum {
+	NFTABLES_A_NFT_HOOK_ATTRS_NUM = 1,
+	NFTABLES_A_NFT_HOOK_ATTRS_PRIORITY = 2,
+	NFTABLES_A_NFT_HOOK_ATTRS_DEV = 3,
+	NFTABLES_A_NFT_HOOK_ATTRS_DEVS = 4,
+};
+
+enum {
+	NFTABLES_A_HOOK_DEV_ATTRS_NAME = 1,
+};
+
+enum {
+	NFTABLES_A_NFT_COUNTER_ATTRS_BYTES = 1,
+	NFTABLES_A_NFT_COUNTER_ATTRS_PACKETS = 2,
+};
+
+enum {
+	NFTABLES_A_RULE_ATTRS_TABLE = 1,
+	NFTABLES_A_RULE_ATTRS_CHAIN = 2,
+	NFTABLES_A_RULE_ATTRS_HANDLE = 3,
+	NFTABLES_A_RULE_ATTRS_EXPRESSIONS = 4,
+	NFTABLES_A_RULE_ATTRS_COMPAT = 5,
+	NFTABLES_A_RULE_ATTRS_POSITION = 6,
+	NFTABLES_A_RULE_ATTRS_USERDATA = 7,
+	NFTABLES_A_RULE_ATTRS_ID = 8,
+	NFTABLES_A_RULE_ATTRS_POSITION_ID = 9,
+	NFTABLES_A_RULE_ATTRS_CHAIN_ID = 10,
+};
+
+enum {
+	NFTABLES_A_EXPR_LIST_ATTRS_ELEM = 1,
+};
+
+enum {
+	NFTABLES_A_EXPR_ATTRS_NAME = 1,
+	NFTABLES_A_EXPR_ATTRS_DATA = 2,
+};
+
+enum {
+	NFTABLES_A_RULE_COMPAT_ATTRS_PROTO = 1,
+	NFTABLES_A_RULE_COMPAT_ATTRS_FLAGS = 2,
+};
+
+enum {
+	NFTABLES_A_SET_ATTRS_TABLE = 1,
+	NFTABLES_A_SET_ATTRS_NAME = 2,
+	NFTABLES_A_SET_ATTRS_FLAGS = 3,
+	NFTABLES_A_SET_ATTRS_KEY_TYPE = 4,
+	NFTABLES_A_SET_ATTRS_KEY_LEN = 5,
+	NFTABLES_A_SET_ATTRS_DATA_TYPE = 6,
+	NFTABLES_A_SET_ATTRS_DATA_LEN = 7,
+	NFTABLES_A_SET_ATTRS_POLICY = 8,
+	NFTABLES_A_SET_ATTRS_DESC = 9,
+	NFTABLES_A_SET_ATTRS_ID = 10,
+	NFTABLES_A_SET_ATTRS_TIMEOUT = 11,
+	NFTABLES_A_SET_ATTRS_GC_INTERVAL = 12,
+	NFTABLES_A_SET_ATTRS_USERDATA = 13,
+	NFTABLES_A_SET_ATTRS_PAD = 14,
+	NFTABLES_A_SET_ATTRS_OBJ_TYPE = 15,
+	NFTABLES_A_SET_ATTRS_HANDLE = 16,
+	NFTABLES_A_SET_ATTRS_EXPR = 17,
+	NFTABLES_A_SET_ATTRS_EXPRESSIONS = 18,
+};
+
+enum {
+	NFTABLES_A_SET_DESC_ATTRS_SIZE = 1,
+	NFTABLES_A_SET_DESC_ATTRS_CONCAT = 2,
+};
+
+enum {
+	NFTABLES_A_SET_DESC_CONCAT_ATTRS_ELEM = 1,
+};
+
+enum {
+	NFTABLES_A_SET_FIELD_ATTRS_LEN = 1,
+};
+
+enum {
+	NFTABLES_A_SET_LIST_ATTRS_ELEM = 1,
+};
+
+enum {
+	NFTABLES_A_SETELEM_ATTRS_KEY = 1,
+	NFTABLES_A_SETELEM_ATTRS_DATA = 2,
+	NFTABLES_A_SETELEM_ATTRS_FLAGS = 3,
+	NFTABLES_A_SETELEM_ATTRS_TIMEOUT = 4,
+	NFTABLES_A_SETELEM_ATTRS_EXPIRATION = 5,
+	NFTABLES_A_SETELEM_ATTRS_USERDATA = 6,
+	NFTABLES_A_SETELEM_ATTRS_EXPR = 7,
+	NFTABLES_A_SETELEM_ATTRS_OBJREF = 8,
+	NFTABLES_A_SETELEM_ATTRS_KEY_END = 9,
+	NFTABLES_A_SETELEM_ATTRS_EXPRESSIONS = 10,
+};
+
+enum {
+	NFTABLES_A_SETELEM_LIST_ELEM_ATTRS_ELEM = 1,
+};
+
+enum {
+	NFTABLES_A_SETELEM_LIST_ATTRS_TABLE = 1,
+	NFTABLES_A_SETELEM_LIST_ATTRS_SET = 2,
+	NFTABLES_A_SETELEM_LIST_ATTRS_ELEMENTS = 3,
+	NFTABLES_A_SETELEM_LIST_ATTRS_SET_ID = 4,
+};
+
+enum {
+	NFTABLES_A_GEN_ATTRS_ID = 1,
+	NFTABLES_A_GEN_ATTRS_PROC_PID = 2,
+	NFTABLES_A_GEN_ATTRS_PROC_NAME = 3,
+};
+
+enum {
+	NFTABLES_A_OBJ_ATTRS_TABLE = 1,
+	NFTABLES_A_OBJ_ATTRS_NAME = 2,
+	NFTABLES_A_OBJ_ATTRS_TYPE = 3,
+	NFTABLES_A_OBJ_ATTRS_DATA = 4,
+	NFTABLES_A_OBJ_ATTRS_USE = 5,
+	NFTABLES_A_OBJ_ATTRS_HANDLE = 6,
+	NFTABLES_A_OBJ_ATTRS_PAD = 7,
+	NFTABLES_A_OBJ_ATTRS_USERDATA = 8,
+};
+
+enum {
+	NFTABLES_A_QUOTA_ATTRS_BYTES = 1,
+	NFTABLES_A_QUOTA_ATTRS_FLAGS = 2,
+	NFTABLES_A_QUOTA_ATTRS_PAD = 3,
+	NFTABLES_A_QUOTA_ATTRS_CONSUMED = 4,
+};
+
+enum {
+	NFTABLES_A_FLOWTABLE_ATTRS_TABLE = 1,
+	NFTABLES_A_FLOWTABLE_ATTRS_NAME = 2,
+	NFTABLES_A_FLOWTABLE_ATTRS_HOOK = 3,
+	NFTABLES_A_FLOWTABLE_ATTRS_USE = 4,
+	NFTABLES_A_FLOWTABLE_ATTRS_HANDLE = 5,
+	NFTABLES_A_FLOWTABLE_ATTRS_PAD = 6,
+	NFTABLES_A_FLOWTABLE_ATTRS_FLAGS = 7,
+};
+
+enum {
+	NFTABLES_A_FLOWTABLE_HOOK_ATTRS_NUM = 1,
+	NFTABLES_A_FLOWTABLE_HOOK_ATTRS_PRIORITY = 2,
+	NFTABLES_A_FLOWTABLE_HOOK_ATTRS_DEVS = 3,
+};
+
+enum {
+	NFTABLES_A_EXPR_BITWISE_ATTRS_SREG = 1,
+	NFTABLES_A_EXPR_BITWISE_ATTRS_DREG = 2,
+	NFTABLES_A_EXPR_BITWISE_ATTRS_LEN = 3,
+	NFTABLES_A_EXPR_BITWISE_ATTRS_MASK = 4,
+	NFTABLES_A_EXPR_BITWISE_ATTRS_XOR = 5,
+	NFTABLES_A_EXPR_BITWISE_ATTRS_OP = 6,
+	NFTABLES_A_EXPR_BITWISE_ATTRS_DATA = 7,
+};
+
+enum {
+	NFTABLES_A_EXPR_CMP_ATTRS_SREG = 1,
+	NFTABLES_A_EXPR_CMP_ATTRS_OP = 2,
+	NFTABLES_A_EXPR_CMP_ATTRS_DATA = 3,
+};
+
+enum {
+	NFTABLES_A_DATA_ATTRS_VALUE = 1,
+	NFTABLES_A_DATA_ATTRS_VERDICT = 2,
+};
+
+enum {
+	NFTABLES_A_VERDICT_ATTRS_CODE = 1,
+	NFTABLES_A_VERDICT_ATTRS_CHAIN = 2,
+	NFTABLES_A_VERDICT_ATTRS_CHAIN_ID = 3,
+};
+
+enum {
+	NFTABLES_A_EXPR_COUNTER_ATTRS_BYTES = 1,
+	NFTABLES_A_EXPR_COUNTER_ATTRS_PACKETS = 2,
+	NFTABLES_A_EXPR_COUNTER_ATTRS_PAD = 3,
+};
+
+enum {
+	NFTABLES_A_EXPR_FIB_ATTRS_DREG = 1,
+	NFTABLES_A_EXPR_FIB_ATTRS_RESULT = 2,
+	NFTABLES_A_EXPR_FIB_ATTRS_FLAGS = 3,
+};
+
+enum {
+	NFTABLES_A_EXPR_CT_ATTRS_DREG = 1,
+	NFTABLES_A_EXPR_CT_ATTRS_KEY = 2,
+	NFTABLES_A_EXPR_CT_ATTRS_DIRECTION = 3,
+	NFTABLES_A_EXPR_CT_ATTRS_SREG = 4,
+};
+
+enum {
+	NFTABLES_A_EXPR_FLOW_OFFLOAD_ATTRS_NAME = 1,
+};
+
+enum {
+	NFTABLES_A_EXPR_IMMEDIATE_ATTRS_DREG = 1,
+	NFTABLES_A_EXPR_IMMEDIATE_ATTRS_DATA = 2,
+};
+
+enum {
+	NFTABLES_A_EXPR_LOOKUP_ATTRS_SET = 1,
+	NFTABLES_A_EXPR_LOOKUP_ATTRS_SET_ID = 2,
+	NFTABLES_A_EXPR_LOOKUP_ATTRS_SREG = 3,
+	NFTABLES_A_EXPR_LOOKUP_ATTRS_DREG = 4,
+	NFTABLES_A_EXPR_LOOKUP_ATTRS_FLAGS = 5,
+};
+
+enum {
+	NFTABLES_A_EXPR_META_ATTRS_DREG = 1,
+	NFTABLES_A_EXPR_META_ATTRS_KEY = 2,
+	NFTABLES_A_EXPR_META_ATTRS_SREG = 3,
+};
+
+enum {
+	NFTABLES_A_EXPR_NAT_ATTRS_TYPE = 1,
+	NFTABLES_A_EXPR_NAT_ATTRS_FAMILY = 2,
+	NFTABLES_A_EXPR_NAT_ATTRS_REG_ADDR_MIN = 3,
+	NFTABLES_A_EXPR_NAT_ATTRS_REG_ADDR_MAX = 4,
+	NFTABLES_A_EXPR_NAT_ATTRS_REG_PROTO_MIN = 5,
+	NFTABLES_A_EXPR_NAT_ATTRS_REG_PROTO_MAX = 6,
+	NFTABLES_A_EXPR_NAT_ATTRS_FLAGS = 7,
+};
+
+enum {
+	NFTABLES_A_EXPR_PAYLOAD_ATTRS_DREG = 1,
+	NFTABLES_A_EXPR_PAYLOAD_ATTRS_BASE = 2,
+	NFTABLES_A_EXPR_PAYLOAD_ATTRS_OFFSET = 3,
+	NFTABLES_A_EXPR_PAYLOAD_ATTRS_LEN = 4,
+	NFTABLES_A_EXPR_PAYLOAD_ATTRS_SREG = 5,
+	NFTABLES_A_EXPR_PAYLOAD_ATTRS_CSUM_TYPE = 6,
+	NFTABLES_A_EXPR_PAYLOAD_ATTRS_CSUM_OFFSET = 7,
+	NFTABLES_A_EXPR_PAYLOAD_ATTRS_CSUM_FLAGS = 8,
+};
+
+enum {
+	NFTABLES_A_EXPR_REJECT_ATTRS_TYPE = 1,
+	NFTABLES_A_EXPR_REJECT_ATTRS_ICMP_CODE = 2,
+};
+
+enum {
+	NFTABLES_A_EXPR_TARGET_ATTRS_NAME = 1,
+	NFTABLES_A_EXPR_TARGET_ATTRS_REV = 2,
+	NFTABLES_A_EXPR_TARGET_ATTRS_INFO = 3,
+};
+
+enum {
+	NFTABLES_A_EXPR_TPROXY_ATTRS_FAMILY = 1,
+	NFTABLES_A_EXPR_TPROXY_ATTRS_REG_ADDR = 2,
+	NFTABLES_A_EXPR_TPROXY_ATTRS_REG_PORT = 3,
+};
+
+enum {
+	NFTABLES_A_EXPR_OBJREF_ATTRS_IMM_TYPE = 1,
+	NFTABLES_A_EXPR_OBJREF_ATTRS_IMM_NAME = 2,
+	NFTABLES_A_EXPR_OBJREF_ATTRS_SET_SREG = 3,
+	NFTABLES_A_EXPR_OBJREF_ATTRS_SET_NAME = 4,
+	NFTABLES_A_EXPR_OBJREF_ATTRS_SET_ID = 5,
+};
+
+const struct ynl_family& get_ynl_nftables_family();
+
+/* Enums */
+std::string_view nftables_op_str(int op);
+std::string_view nftables_meta_keys_str(nftables_meta_keys value);
+std::string_view nftables_bitwise_ops_str(nftables_bitwise_ops value);
+std::string_view nftables_cmp_ops_str(nftables_cmp_ops value);
+std::string_view nftables_object_type_str(nftables_object_type value);
+std::string_view nftables_nat_range_flags_str(nftables_nat_range_flags value);
+std::string_view nftables_table_flags_str(nftables_table_flags value);
+std::string_view nftables_chain_flags_str(nftables_chain_flags value);
+std::string_view nftables_set_flags_str(nftables_set_flags value);
+std::string_view nftables_lookup_flags_str(nftables_lookup_flags value);
+std::string_view nftables_ct_keys_str(nftables_ct_keys value);
+std::string_view nftables_ct_direction_str(nftables_ct_direction value);
+std::string_view nftables_quota_flags_str(nftables_quota_flags value);
+std::string_view nftables_verdict_code_str(nftables_verdict_code value);
+std::string_view nftables_fib_result_str(nftables_fib_result value);
+std::string_view nftables_fib_flags_str(nftables_fib_flags value);
+std::string_view nftables_reject_types_str(nftables_reject_types value);
+
+/* Common nested types */
+struct nftables_nft_counter_attrs {
+	std::optional<__u64> bytes /* big-endian */;
+	std::optional<__u64> packets /* big-endian */;
+};
+
+struct nftables_rule_compat_attrs {
+	std::vector<__u8> proto;
+	std::vector<__u8> flags;
+};
+
+struct nftables_expr_attrs {
+	std::string name;
+	std::vector<__u8> data;
+};
+
+struct nftables_set_list_attrs {
+	std::vector<nftables_expr_attrs> elem;
+};
+
+struct nftables_hook_dev_attrs {
+	std::vector<std::string> name;
+};
+
+struct nftables_set_field_attrs {
+	std::optional<__u32> len /* big-endian */;
+};
+
+struct nftables_verdict_attrs {
+	std::optional<nftables_verdict_code> code /* big-endian */;
+	std::string chain;
+	std::optional<__u32> chain_id /* big-endian */;
+};
+
+struct nftables_nft_hook_attrs {
+	std::optional<__u32> num /* big-endian */;
+	std::optional<__s32> priority /* big-endian */;
+	std::string dev;
+	std::optional<nftables_hook_dev_attrs> devs;
+};
+
+struct nftables_expr_list_attrs {
+	std::vector<nftables_expr_attrs> elem;
+};
+
+struct nftables_flowtable_hook_attrs {
+	std::optional<__u32> num /* big-endian */;
+	std::optional<__u32> priority /* big-endian */;
+	std::optional<nftables_hook_dev_attrs> devs;
+};
+
+struct nftables_set_desc_concat_attrs {
+	std::optional<nftables_set_field_attrs> elem;
+};
+
+struct nftables_data_attrs {
+	std::vector<__u8> value;
+	std::optional<nftables_verdict_attrs> verdict;
+};
+
+struct nftables_set_desc_attrs {
+	std::optional<__u32> size /* big-endian */;
+	std::vector<nftables_set_desc_concat_attrs> concat;
+};
+
+struct nftables_setelem_attrs {
+	std::optional<nftables_data_attrs> key;
+	std::optional<nftables_data_attrs> data;
+	std::vector<__u8> flags;
+	std::optional<__u64> timeout /* big-endian */;
+	std::optional<__u64> expiration /* big-endian */;
+	std::vector<__u8> userdata;
+	std::optional<nftables_expr_attrs> expr;
+	std::string objref;
+	std::optional<nftables_data_attrs> key_end;
+	std::optional<nftables_expr_list_attrs> expressions;
+};
+
+struct nftables_setelem_list_elem_attrs {
+	std::vector<nftables_setelem_attrs> elem;
+};
+
+/* Policies and nested encoders */
+extern struct ynl_policy_nest nftables_nft_counter_attrs_nest;
+extern struct ynl_policy_nest nftables_rule_compat_attrs_nest;
+extern struct ynl_policy_nest nftables_expr_attrs_nest;
+extern struct ynl_policy_nest nftables_set_list_attrs_nest;
+extern struct ynl_policy_nest nftables_hook_dev_attrs_nest;
+extern struct ynl_policy_nest nftables_set_field_attrs_nest;
+extern struct ynl_policy_nest nftables_verdict_attrs_nest;
+extern struct ynl_policy_nest nftables_nft_hook_attrs_nest;
+extern struct ynl_policy_nest nftables_expr_list_attrs_nest;
+extern struct ynl_policy_nest nftables_flowtable_hook_attrs_nest;
+extern struct ynl_policy_nest nftables_set_desc_concat_attrs_nest;
+extern struct ynl_policy_nest nftables_data_attrs_nest;
+extern struct ynl_policy_nest nftables_set_desc_attrs_nest;
+extern struct ynl_policy_nest nftables_setelem_attrs_nest;
+extern struct ynl_policy_nest nftables_setelem_list_elem_attrs_nest;
+extern struct ynl_policy_nest nftables_batch_attrs_nest;
+extern struct ynl_policy_nest nftables_table_attrs_nest;
+extern struct ynl_policy_nest nftables_chain_attrs_nest;
+extern struct ynl_policy_nest nftables_rule_attrs_nest;
+extern struct ynl_policy_nest nftables_set_attrs_nest;
+extern struct ynl_policy_nest nftables_setelem_list_attrs_nest;
+extern struct ynl_policy_nest nftables_gen_attrs_nest;
+extern struct ynl_policy_nest nftables_obj_attrs_nest;
+extern struct ynl_policy_nest nftables_flowtable_attrs_nest;
+int nftables_nft_counter_attrs_put(struct nlmsghdr *nlh,
+				   unsigned int attr_type,
+				   const nftables_nft_counter_attrs&  obj);
+int nftables_rule_compat_attrs_put(struct nlmsghdr *nlh,
+				   unsigned int attr_type,
+				   const nftables_rule_compat_attrs&  obj);
+int nftables_expr_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			    const nftables_expr_attrs&  obj);
+int nftables_hook_dev_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				const nftables_hook_dev_attrs&  obj);
+int nftables_set_field_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				 const nftables_set_field_attrs&  obj);
+int nftables_verdict_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const nftables_verdict_attrs&  obj);
+int nftables_nft_hook_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				const nftables_nft_hook_attrs&  obj);
+int nftables_expr_list_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				 const nftables_expr_list_attrs&  obj);
+int nftables_set_desc_concat_attrs_put(struct nlmsghdr *nlh,
+				       unsigned int attr_type,
+				       const nftables_set_desc_concat_attrs&  obj);
+int nftables_data_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			    const nftables_data_attrs&  obj);
+int nftables_set_desc_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				const nftables_set_desc_attrs&  obj);
+int nftables_setelem_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const nftables_setelem_attrs&  obj);
+int nftables_setelem_list_elem_attrs_put(struct nlmsghdr *nlh,
+					 unsigned int attr_type,
+					 const nftables_setelem_list_elem_attrs&  obj);
+
+/* ============== BATCH_BEGIN ============== */
+/* BATCH_BEGIN - do */
+struct nftables_batch_begin_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::optional<__u32> genid /* big-endian */;
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t nftables_batch_begin_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 8;
+
+struct nftables_batch_begin_rsp {
+	struct nfgenmsg _hdr{};
+
+	std::optional<__u32> genid /* big-endian */;
+};
+
+/*
+ * Start a batch of operations
+ */
+std::unique_ptr<nftables_batch_begin_rsp>
+nftables_batch_begin(ynl_cpp::ynl_socket&  ys, nftables_batch_begin_req& req);
+ynl_cpp::result<std::unique_ptr<nftables_batch_begin_rsp>>
+nftables_batch_begin_ex(ynl_cpp::ynl_socket&  ys,
+			nftables_batch_begin_req& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_batch_begin_prepare(ynl_cpp::ynl_socket&  ys,
+			     nftables_batch_begin_req& req);
+std::unique_ptr<nftables_batch_begin_rsp>
+nftables_batch_begin(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nftables_batch_begin_rsp>>
+nftables_batch_begin_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
+
+/* ============== BATCH_END ============== */
+/* BATCH_END - do */
+struct nftables_batch_end_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::optional<__u32> genid /* big-endian */;
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t nftables_batch_end_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 8;
+
+/*
+ * Finish a batch of operations
+ */
+int nftables_batch_end(ynl_cpp::ynl_socket&  ys, nftables_batch_end_req& req);
+ynl_cpp::result<void>
+nftables_batch_end_ex(ynl_cpp::ynl_socket&  ys, nftables_batch_end_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_batch_end_prepare(ynl_cpp::ynl_socket&  ys,
+			   nftables_batch_end_req& req);
+int nftables_batch_end(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_batch_end_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_batch_end_batch(ynl_cpp::msg_batch& batch,
+			 nftables_batch_end_req& req);
+
+/* ============== NEWTABLE ============== */
+/* NEWTABLE - do */
+struct nftables_newtable_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+	std::optional<__u32> flags /* big-endian */;
+	std::vector<__u8> userdata;
+};
+
+/*
+ * Create a new table.
+ */
+int nftables_newtable(ynl_cpp::ynl_socket&  ys, nftables_newtable_req& req);
+ynl_cpp::result<void>
+nftables_newtable_ex(ynl_cpp::ynl_socket&  ys, nftables_newtable_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newtable_prepare(ynl_cpp::ynl_socket&  ys, nftables_newtable_req& req);
+int nftables_newtable(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_newtable_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_newtable_batch(ynl_cpp::msg_batch& batch, nftables_newtable_req& req);
+
+/* ============== GETTABLE ============== */
+/* GETTABLE - do */
+struct nftables_gettable_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+struct nftables_gettable_rsp {
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+/*
+ * Get / dump tables.
+ */
+std::unique_ptr<nftables_gettable_rsp>
+nftables_gettable(ynl_cpp::ynl_socket&  ys, nftables_gettable_req& req);
+ynl_cpp::result<std::unique_ptr<nftables_gettable_rsp>>
+nftables_gettable_ex(ynl_cpp::ynl_socket&  ys, nftables_gettable_req& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_gettable_prepare(ynl_cpp::ynl_socket&  ys, nftables_gettable_req& req);
+std::unique_ptr<nftables_gettable_rsp>
+nftables_gettable(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nftables_gettable_rsp>>
+nftables_gettable_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
+
+/* ============== DELTABLE ============== */
+/* DELTABLE - do */
+struct nftables_deltable_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+	std::optional<__u64> handle /* big-endian */;
+};
+
+/*
+ * Delete an existing table.
+ */
+int nftables_deltable(ynl_cpp::ynl_socket&  ys, nftables_deltable_req& req);
+ynl_cpp::result<void>
+nftables_deltable_ex(ynl_cpp::ynl_socket&  ys, nftables_deltable_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_deltable_prepare(ynl_cpp::ynl_socket&  ys, nftables_deltable_req& req);
+int nftables_deltable(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_deltable_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_deltable_batch(ynl_cpp::msg_batch& batch, nftables_deltable_req& req);
+
+/* ============== DESTROYTABLE ============== */
+/* DESTROYTABLE - do */
+struct nftables_destroytable_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+	std::optional<__u64> handle /* big-endian */;
+};
+
+/*
+ * Delete an existing table with destroy semantics (ignoring ENOENT errors).
+ */
+int nftables_destroytable(ynl_cpp::ynl_socket&  ys,
+			  nftables_destroytable_req& req);
+ynl_cpp::result<void>
+nftables_destroytable_ex(ynl_cpp::ynl_socket&  ys,
+			 nftables_destroytable_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroytable_prepare(ynl_cpp::ynl_socket&  ys,
+			      nftables_destroytable_req& req);
+int nftables_destroytable(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_destroytable_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_destroytable_batch(ynl_cpp::msg_batch& batch,
+			    nftables_destroytable_req& req);
+
+/* ============== NEWCHAIN ============== */
+/* NEWCHAIN - do */
+struct nftables_newchain_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::optional<__u64> handle /* big-endian */;
+	std::string name;
+	std::optional<nftables_nft_hook_attrs> hook;
+	std::optional<__u32> policy /* big-endian */;
+	std::string type;
+	std::optional<nftables_nft_counter_attrs> counters;
+	std::optional<__u32> flags /* big-endian */;
+	std::optional<__u32> id /* big-endian */;
+	std::vector<__u8> userdata;
+};
+
+/*
+ * Create a new chain.
+ */
+int nftables_newchain(ynl_cpp::ynl_socket&  ys, nftables_newchain_req& req);
+ynl_cpp::result<void>
+nftables_newchain_ex(ynl_cpp::ynl_socket&  ys, nftables_newchain_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newchain_prepare(ynl_cpp::ynl_socket&  ys, nftables_newchain_req& req);
+int nftables_newchain(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_newchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_newchain_batch(ynl_cpp::msg_batch& batch, nftables_newchain_req& req);
+
+/* ============== GETCHAIN ============== */
+/* GETCHAIN - do */
+struct nftables_getchain_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+struct nftables_getchain_rsp {
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+/*
+ * Get / dump chains.
+ */
+std::unique_ptr<nftables_getchain_rsp>
+nftables_getchain(ynl_cpp::ynl_socket&  ys, nftables_getchain_req& req);
+ynl_cpp::result<std::unique_ptr<nftables_getchain_rsp>>
+nftables_getchain_ex(ynl_cpp::ynl_socket&  ys, nftables_getchain_req& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getchain_prepare(ynl_cpp::ynl_socket&  ys, nftables_getchain_req& req);
+std::unique_ptr<nftables_getchain_rsp>
+nftables_getchain(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nftables_getchain_rsp>>
+nftables_getchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
+
+/* ============== DELCHAIN ============== */
+/* DELCHAIN - do */
+struct nftables_delchain_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::optional<__u64> handle /* big-endian */;
+	std::string name;
+};
+
+/*
+ * Delete an existing chain.
+ */
+int nftables_delchain(ynl_cpp::ynl_socket&  ys, nftables_delchain_req& req);
+ynl_cpp::result<void>
+nftables_delchain_ex(ynl_cpp::ynl_socket&  ys, nftables_delchain_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delchain_prepare(ynl_cpp::ynl_socket&  ys, nftables_delchain_req& req);
+int nftables_delchain(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_delchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_delchain_batch(ynl_cpp::msg_batch& batch, nftables_delchain_req& req);
+
+/* ============== DESTROYCHAIN ============== */
+/* DESTROYCHAIN - do */
+struct nftables_destroychain_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::optional<__u64> handle /* big-endian */;
+	std::string name;
+};
+
+/*
+ * Delete an existing chain with destroy semantics (ignoring ENOENT errors).
+ */
+int nftables_destroychain(ynl_cpp::ynl_socket&  ys,
+			  nftables_destroychain_req& req);
+ynl_cpp::result<void>
+nftables_destroychain_ex(ynl_cpp::ynl_socket&  ys,
+			 nftables_destroychain_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroychain_prepare(ynl_cpp::ynl_socket&  ys,
+			      nftables_destroychain_req& req);
+int nftables_destroychain(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_destroychain_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_destroychain_batch(ynl_cpp::msg_batch& batch,
+			    nftables_destroychain_req& req);
+
+/* ============== NEWRULE ============== */
+/* NEWRULE - do */
+struct nftables_newrule_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::string chain;
+	std::optional<__u64> handle /* big-endian */;
+	std::optional<nftables_expr_list_attrs> expressions;
+	std::optional<nftables_rule_compat_attrs> compat;
+	std::optional<__u64> position /* big-endian */;
+	std::vector<__u8> userdata;
+	std::optional<__u32> id /* big-endian */;
+	std::optional<__u32> position_id /* big-endian */;
+	std::optional<__u32> chain_id /* big-endian */;
+};
+
+/*
+ * Create a new rule.
+ */
+int nftables_newrule(ynl_cpp::ynl_socket&  ys, nftables_newrule_req& req);
+ynl_cpp::result<void>
+nftables_newrule_ex(ynl_cpp::ynl_socket&  ys, nftables_newrule_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newrule_prepare(ynl_cpp::ynl_socket&  ys, nftables_newrule_req& req);
+int nftables_newrule(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_newrule_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_newrule_batch(ynl_cpp::msg_batch& batch, nftables_newrule_req& req);
+
+/* ============== GETRULE ============== */
+/* GETRULE - do */
+struct nftables_getrule_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t nftables_getrule_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 0;
+
+struct nftables_getrule_rsp {
+	struct nfgenmsg _hdr{};
+};
+
+/*
+ * Get / dump rules.
+ */
+std::unique_ptr<nftables_getrule_rsp>
+nftables_getrule(ynl_cpp::ynl_socket&  ys, nftables_getrule_req& req);
+ynl_cpp::result<std::unique_ptr<nftables_getrule_rsp>>
+nftables_getrule_ex(ynl_cpp::ynl_socket&  ys, nftables_getrule_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getrule_prepare(ynl_cpp::ynl_socket&  ys, nftables_getrule_req& req);
+std::unique_ptr<nftables_getrule_rsp>
+nftables_getrule(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nftables_getrule_rsp>>
+nftables_getrule_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
+
+/* ============== GETRULE_RESET ============== */
+/* GETRULE_RESET - do */
+struct nftables_getrule_reset_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t nftables_getrule_reset_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 0;
+
+struct nftables_getrule_reset_rsp {
+	struct nfgenmsg _hdr{};
+};
+
+/*
+ * Get / dump rules and reset stateful expressions.
+ */
+std::unique_ptr<nftables_getrule_reset_rsp>
+nftables_getrule_reset(ynl_cpp::ynl_socket&  ys,
+		       nftables_getrule_reset_req& req);
+ynl_cpp::result<std::unique_ptr<nftables_getrule_reset_rsp>>
+nftables_getrule_reset_ex(ynl_cpp::ynl_socket&  ys,
+			  nftables_getrule_reset_req& req,
+			  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getrule_reset_prepare(ynl_cpp::ynl_socket&  ys,
+			       nftables_getrule_reset_req& req);
+std::unique_ptr<nftables_getrule_reset_rsp>
+nftables_getrule_reset(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nftables_getrule_reset_rsp>>
+nftables_getrule_reset_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj = nullptr);
+
+/* ============== DELRULE ============== */
+/* DELRULE - do */
+struct nftables_delrule_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::string chain;
+	std::optional<__u64> handle /* big-endian */;
+	std::optional<__u32> id /* big-endian */;
+};
+
+/*
+ * Delete an existing rule.
+ */
+int nftables_delrule(ynl_cpp::ynl_socket&  ys, nftables_delrule_req& req);
+ynl_cpp::result<void>
+nftables_delrule_ex(ynl_cpp::ynl_socket&  ys, nftables_delrule_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delrule_prepare(ynl_cpp::ynl_socket&  ys, nftables_delrule_req& req);
+int nftables_delrule(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_delrule_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_delrule_batch(ynl_cpp::msg_batch& batch, nftables_delrule_req& req);
+
+/* ============== DESTROYRULE ============== */
+/* DESTROYRULE - do */
+struct nftables_destroyrule_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::string chain;
+	std::optional<__u64> handle /* big-endian */;
+	std::optional<__u32> id /* big-endian */;
+};
+
+/*
+ * Delete an existing rule with destroy semantics (ignoring ENOENT errors).
+ */
+int nftables_destroyrule(ynl_cpp::ynl_socket&  ys,
+			 nftables_destroyrule_req& req);
+ynl_cpp::result<void>
+nftables_destroyrule_ex(ynl_cpp::ynl_socket&  ys,
+			nftables_destroyrule_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroyrule_prepare(ynl_cpp::ynl_socket&  ys,
+			     nftables_destroyrule_req& req);
+int nftables_destroyrule(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_destroyrule_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_destroyrule_batch(ynl_cpp::msg_batch& batch,
+			   nftables_destroyrule_req& req);
+
+/* ============== NEWSET ============== */
+/* NEWSET - do */
+struct nftables_newset_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::string name;
+	std::optional<__u32> flags /* big-endian */;
+	std::optional<__u32> key_type /* big-endian */;
+	std::optional<__u32> key_len /* big-endian */;
+	std::optional<__u32> data_type /* big-endian */;
+	std::optional<__u32> data_len /* big-endian */;
+	std::optional<__u32> policy /* big-endian */;
+	std::optional<nftables_set_desc_attrs> desc;
+	std::optional<__u32> id /* big-endian */;
+	std::optional<__u64> timeout /* big-endian */;
+	std::optional<__u32> gc_interval /* big-endian */;
+	std::vector<__u8> userdata;
+	std::optional<__u32> obj_type /* big-endian */;
+};
+
+/*
+ * Create a new set.
+ */
+int nftables_newset(ynl_cpp::ynl_socket&  ys, nftables_newset_req& req);
+ynl_cpp::result<void>
+nftables_newset_ex(ynl_cpp::ynl_socket&  ys, nftables_newset_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newset_prepare(ynl_cpp::ynl_socket&  ys, nftables_newset_req& req);
+int nftables_newset(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_newset_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_newset_batch(ynl_cpp::msg_batch& batch, nftables_newset_req& req);
+
+/* ============== GETSET ============== */
+/* GETSET - do */
+struct nftables_getset_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+struct nftables_getset_rsp {
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+/*
+ * Get / dump sets.
+ */
+std::unique_ptr<nftables_getset_rsp>
+nftables_getset(ynl_cpp::ynl_socket&  ys, nftables_getset_req& req);
+ynl_cpp::result<std::unique_ptr<nftables_getset_rsp>>
+nftables_getset_ex(ynl_cpp::ynl_socket&  ys, nftables_getset_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getset_prepare(ynl_cpp::ynl_socket&  ys, nftables_getset_req& req);
+std::unique_ptr<nftables_getset_rsp>
+nftables_getset(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nftables_getset_rsp>>
+nftables_getset_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
+
+/* ============== DELSET ============== */
+/* DELSET - do */
+struct nftables_delset_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::string name;
+	std::optional<__u64> handle /* big-endian */;
+};
+
+/*
+ * Delete an existing set.
+ */
+int nftables_delset(ynl_cpp::ynl_socket&  ys, nftables_delset_req& req);
+ynl_cpp::result<void>
+nftables_delset_ex(ynl_cpp::ynl_socket&  ys, nftables_delset_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delset_prepare(ynl_cpp::ynl_socket&  ys, nftables_delset_req& req);
+int nftables_delset(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_delset_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_delset_batch(ynl_cpp::msg_batch& batch, nftables_delset_req& req);
+
+/* ============== DESTROYSET ============== */
+/* DESTROYSET - do */
+struct nftables_destroyset_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::string name;
+	std::optional<__u64> handle /* big-endian */;
+};
+
+/*
+ * Delete an existing set with destroy semantics (ignoring ENOENT errors).
+ */
+int nftables_destroyset(ynl_cpp::ynl_socket&  ys, nftables_destroyset_req& req);
+ynl_cpp::result<void>
+nftables_destroyset_ex(ynl_cpp::ynl_socket&  ys, nftables_destroyset_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroyset_prepare(ynl_cpp::ynl_socket&  ys,
+			    nftables_destroyset_req& req);
+int nftables_destroyset(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_destroyset_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_destroyset_batch(ynl_cpp::msg_batch& batch,
+			  nftables_destroyset_req& req);
+
+/* ============== NEWSETELEM ============== */
+/* NEWSETELEM - do */
+struct nftables_newsetelem_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::string set;
+	std::optional<nftables_setelem_list_elem_attrs> elements;
+	std::optional<__u32> set_id /* big-endian */;
+};
+
+/*
+ * Create a new set element.
+ */
+int nftables_newsetelem(ynl_cpp::ynl_socket&  ys, nftables_newsetelem_req& req);
+ynl_cpp::result<void>
+nftables_newsetelem_ex(ynl_cpp::ynl_socket&  ys, nftables_newsetelem_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newsetelem_prepare(ynl_cpp::ynl_socket&  ys,
+			    nftables_newsetelem_req& req);
+int nftables_newsetelem(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_newsetelem_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_newsetelem_batch(ynl_cpp::msg_batch& batch,
+			  nftables_newsetelem_req& req);
+
+/* ============== GETSETELEM ============== */
+/* GETSETELEM - do */
+struct nftables_getsetelem_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t nftables_getsetelem_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 0;
+
+struct nftables_getsetelem_rsp {
+	struct nfgenmsg _hdr{};
+};
+
+/*
+ * Get / dump set elements.
+ */
+std::unique_ptr<nftables_getsetelem_rsp>
+nftables_getsetelem(ynl_cpp::ynl_socket&  ys, nftables_getsetelem_req& req);
+ynl_cpp::result<std::unique_ptr<nftables_getsetelem_rsp>>
+nftables_getsetelem_ex(ynl_cpp::ynl_socket&  ys, nftables_getsetelem_req& req,
+		       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getsetelem_prepare(ynl_cpp::ynl_socket&  ys,
+			    nftables_getsetelem_req& req);
+std::unique_ptr<nftables_getsetelem_rsp>
+nftables_getsetelem(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nftables_getsetelem_rsp>>
+nftables_getsetelem_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl,
+		       const ynl_cpp::projection *proj = nullptr);
+
+/* ============== GETSETELEM_RESET ============== */
+/* GETSETELEM_RESET - do */
+struct nftables_getsetelem_reset_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t nftables_getsetelem_reset_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 0;
+
+struct nftables_getsetelem_reset_rsp {
+	struct nfgenmsg _hdr{};
+};
+
+/*
+ * Get / dump set elements and reset stateful expressions.
+ */
+std::unique_ptr<nftables_getsetelem_reset_rsp>
+nftables_getsetelem_reset(ynl_cpp::ynl_socket&  ys,
+			  nftables_getsetelem_reset_req& req);
+ynl_cpp::result<std::unique_ptr<nftables_getsetelem_reset_rsp>>
+nftables_getsetelem_reset_ex(ynl_cpp::ynl_socket&  ys,
+			     nftables_getsetelem_reset_req& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getsetelem_reset_prepare(ynl_cpp::ynl_socket&  ys,
+				  nftables_getsetelem_reset_req& req);
+std::unique_ptr<nftables_getsetelem_reset_rsp>
+nftables_getsetelem_reset(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nftables_getsetelem_reset_rsp>>
+nftables_getsetelem_reset_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
+
+/* ============== DELSETELEM ============== */
+/* DELSETELEM - do */
+struct nftables_delsetelem_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::string set;
+	std::optional<nftables_setelem_list_elem_attrs> elements;
+	std::optional<__u32> set_id /* big-endian */;
+};
+
+/*
+ * Delete an existing set element.
+ */
+int nftables_delsetelem(ynl_cpp::ynl_socket&  ys, nftables_delsetelem_req& req);
+ynl_cpp::result<void>
+nftables_delsetelem_ex(ynl_cpp::ynl_socket&  ys, nftables_delsetelem_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delsetelem_prepare(ynl_cpp::ynl_socket&  ys,
+			    nftables_delsetelem_req& req);
+int nftables_delsetelem(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_delsetelem_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_delsetelem_batch(ynl_cpp::msg_batch& batch,
+			  nftables_delsetelem_req& req);
+
+/* ============== DESTROYSETELEM ============== */
+/* DESTROYSETELEM - do */
+struct nftables_destroysetelem_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string table;
+	std::string set;
+	std::optional<nftables_setelem_list_elem_attrs> elements;
+	std::optional<__u32> set_id /* big-endian */;
+};
+
+/*
+ * Delete an existing set element with destroy semantics.
+ */
+int nftables_destroysetelem(ynl_cpp::ynl_socket&  ys,
+			    nftables_destroysetelem_req& req);
+ynl_cpp::result<void>
+nftables_destroysetelem_ex(ynl_cpp::ynl_socket&  ys,
+			   nftables_destroysetelem_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroysetelem_prepare(ynl_cpp::ynl_socket&  ys,
+				nftables_destroysetelem_req& req);
+int nftables_destroysetelem(ynl_cpp::ynl_socket&  ys,
+			    ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_destroysetelem_ex(ynl_cpp::ynl_socket&  ys,
+			   ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_destroysetelem_batch(ynl_cpp::msg_batch& batch,
+			      nftables_destroysetelem_req& req);
+
+/* ============== GETGEN ============== */
+/* GETGEN - do */
+struct nftables_getgen_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t nftables_getgen_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct nfgenmsg)) + 0;
+
+struct nftables_getgen_rsp {
+	struct nfgenmsg _hdr{};
+};
+
+/*
+ * Get / dump rule-set generation.
+ */
+std::unique_ptr<nftables_getgen_rsp>
+nftables_getgen(ynl_cpp::ynl_socket&  ys, nftables_getgen_req& req);
+ynl_cpp::result<std::unique_ptr<nftables_getgen_rsp>>
+nftables_getgen_ex(ynl_cpp::ynl_socket&  ys, nftables_getgen_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getgen_prepare(ynl_cpp::ynl_socket&  ys, nftables_getgen_req& req);
+std::unique_ptr<nftables_getgen_rsp>
+nftables_getgen(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nftables_getgen_rsp>>
+nftables_getgen_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
+
+/* ============== NEWOBJ ============== */
+/* NEWOBJ - do */
+struct nftables_newobj_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+/*
+ * Create a new stateful object.
+ */
+int nftables_newobj(ynl_cpp::ynl_socket&  ys, nftables_newobj_req& req);
+ynl_cpp::result<void>
+nftables_newobj_ex(ynl_cpp::ynl_socket&  ys, nftables_newobj_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newobj_prepare(ynl_cpp::ynl_socket&  ys, nftables_newobj_req& req);
+int nftables_newobj(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_newobj_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_newobj_batch(ynl_cpp::msg_batch& batch, nftables_newobj_req& req);
+
+/* ============== GETOBJ ============== */
+/* GETOBJ - do */
+struct nftables_getobj_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+struct nftables_getobj_rsp {
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+/*
+ * Get / dump stateful objects.
+ */
+std::unique_ptr<nftables_getobj_rsp>
+nftables_getobj(ynl_cpp::ynl_socket&  ys, nftables_getobj_req& req);
+ynl_cpp::result<std::unique_ptr<nftables_getobj_rsp>>
+nftables_getobj_ex(ynl_cpp::ynl_socket&  ys, nftables_getobj_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getobj_prepare(ynl_cpp::ynl_socket&  ys, nftables_getobj_req& req);
+std::unique_ptr<nftables_getobj_rsp>
+nftables_getobj(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nftables_getobj_rsp>>
+nftables_getobj_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
+
+/* ============== DELOBJ ============== */
+/* DELOBJ - do */
+struct nftables_delobj_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+/*
+ * Delete an existing stateful object.
+ */
+int nftables_delobj(ynl_cpp::ynl_socket&  ys, nftables_delobj_req& req);
+ynl_cpp::result<void>
+nftables_delobj_ex(ynl_cpp::ynl_socket&  ys, nftables_delobj_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delobj_prepare(ynl_cpp::ynl_socket&  ys, nftables_delobj_req& req);
+int nftables_delobj(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_delobj_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_delobj_batch(ynl_cpp::msg_batch& batch, nftables_delobj_req& req);
+
+/* ============== DESTROYOBJ ============== */
+/* DESTROYOBJ - do */
+struct nftables_destroyobj_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+/*
+ * Delete an existing stateful object with destroy semantics.
+ */
+int nftables_destroyobj(ynl_cpp::ynl_socket&  ys, nftables_destroyobj_req& req);
+ynl_cpp::result<void>
+nftables_destroyobj_ex(ynl_cpp::ynl_socket&  ys, nftables_destroyobj_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroyobj_prepare(ynl_cpp::ynl_socket&  ys,
+			    nftables_destroyobj_req& req);
+int nftables_destroyobj(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_destroyobj_ex(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_destroyobj_batch(ynl_cpp::msg_batch& batch,
+			  nftables_destroyobj_req& req);
+
+/* ============== NEWFLOWTABLE ============== */
+/* NEWFLOWTABLE - do */
+struct nftables_newflowtable_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+/*
+ * Create a new flow table.
+ */
+int nftables_newflowtable(ynl_cpp::ynl_socket&  ys,
+			  nftables_newflowtable_req& req);
+ynl_cpp::result<void>
+nftables_newflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 nftables_newflowtable_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_newflowtable_prepare(ynl_cpp::ynl_socket&  ys,
+			      nftables_newflowtable_req& req);
+int nftables_newflowtable(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_newflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_newflowtable_batch(ynl_cpp::msg_batch& batch,
+			    nftables_newflowtable_req& req);
+
+/* ============== GETFLOWTABLE ============== */
+/* GETFLOWTABLE - do */
+struct nftables_getflowtable_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+struct nftables_getflowtable_rsp {
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+/*
+ * Get / dump flow tables.
+ */
+std::unique_ptr<nftables_getflowtable_rsp>
+nftables_getflowtable(ynl_cpp::ynl_socket&  ys, nftables_getflowtable_req& req);
+ynl_cpp::result<std::unique_ptr<nftables_getflowtable_rsp>>
+nftables_getflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 nftables_getflowtable_req& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_getflowtable_prepare(ynl_cpp::ynl_socket&  ys,
+			      nftables_getflowtable_req& req);
+std::unique_ptr<nftables_getflowtable_rsp>
+nftables_getflowtable(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nftables_getflowtable_rsp>>
+nftables_getflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
+
+/* ============== DELFLOWTABLE ============== */
+/* DELFLOWTABLE - do */
+struct nftables_delflowtable_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+/*
+ * Delete an existing flow table.
+ */
+int nftables_delflowtable(ynl_cpp::ynl_socket&  ys,
+			  nftables_delflowtable_req& req);
+ynl_cpp::result<void>
+nftables_delflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 nftables_delflowtable_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_delflowtable_prepare(ynl_cpp::ynl_socket&  ys,
+			      nftables_delflowtable_req& req);
+int nftables_delflowtable(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_delflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_delflowtable_batch(ynl_cpp::msg_batch& batch,
+			    nftables_delflowtable_req& req);
+
+/* ============== DESTROYFLOWTABLE ============== */
+/* DESTROYFLOWTABLE - do */
+struct nftables_destroyflowtable_req {
+	__u16 _nlmsg_flags{};
+
+	struct nfgenmsg _hdr{};
+
+	std::string name;
+};
+
+/*
+ * Delete an existing flow table with destroy semantics.
+ */
+int nftables_destroyflowtable(ynl_cpp::ynl_socket&  ys,
+			      nftables_destroyflowtable_req& req);
+ynl_cpp::result<void>
+nftables_destroyflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			     nftables_destroyflowtable_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+nftables_destroyflowtable_prepare(ynl_cpp::ynl_socket&  ys,
+				  nftables_destroyflowtable_req& req);
+int nftables_destroyflowtable(ynl_cpp::ynl_socket&  ys,
+			      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+nftables_destroyflowtable_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+nftables_destroyflowtable_batch(ynl_cpp::msg_batch& batch,
+				nftables_destroyflowtable_req& req);
+
+} //namespace ynl_cpp
+#endif /* _LINUX_NFTABLES_GEN_H */
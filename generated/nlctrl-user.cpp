@@ -168,12 +168,12 @@ int nlctrl_op_attrs_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == CTRL_ATTR_OP_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == CTRL_ATTR_OP_FLAGS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->flags = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -193,12 +193,12 @@ int nlctrl_mcast_group_attrs_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == CTRL_ATTR_MCAST_GRP_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
 		} else if (type == CTRL_ATTR_MCAST_GRP_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -220,48 +220,48 @@ int nlctrl_policy_attrs_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == NL_POLICY_TYPE_ATTR_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->type = (netlink_attribute_type)ynl_attr_get_u32(attr);
 		} else if (type == NL_POLICY_TYPE_ATTR_MIN_VALUE_S) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s64))
+				return ynl_attr_invalid(yarg, attr, "s64");
 			dst->min_value_s = (__s64)ynl_attr_get_s64(attr);
 		} else if (type == NL_POLICY_TYPE_ATTR_MAX_VALUE_S) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__s64))
+				return ynl_attr_invalid(yarg, attr, "s64");
 			dst->max_value_s = (__s64)ynl_attr_get_s64(attr);
 		} else if (type == NL_POLICY_TYPE_ATTR_MIN_VALUE_U) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->min_value_u = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == NL_POLICY_TYPE_ATTR_MAX_VALUE_U) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->max_value_u = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == NL_POLICY_TYPE_ATTR_MIN_LENGTH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->min_length = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NL_POLICY_TYPE_ATTR_MAX_LENGTH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->max_length = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NL_POLICY_TYPE_ATTR_POLICY_IDX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->policy_idx = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NL_POLICY_TYPE_ATTR_POLICY_MAXTYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->policy_maxtype = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NL_POLICY_TYPE_ATTR_BITFIELD32_MASK) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->bitfield32_mask = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == NL_POLICY_TYPE_ATTR_MASK) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->mask = (__u64)ynl_attr_get_u64(attr);
 		}
 	}
@@ -281,12 +281,12 @@ int nlctrl_op_policy_attrs_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == CTRL_ATTR_POLICY_DO) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->do_ = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == CTRL_ATTR_POLICY_DUMP) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dump = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -319,37 +319,40 @@ int nlctrl_getfamily_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == CTRL_ATTR_FAMILY_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->family_id = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == CTRL_ATTR_FAMILY_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->family_name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->family_name.assign(ynl_attr_get_str(attr));
 		} else if (type == CTRL_ATTR_HDRSIZE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->hdrsize = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == CTRL_ATTR_MAXATTR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->maxattr = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == CTRL_ATTR_MCAST_GROUPS) {
 			const struct nlattr *attr2;
 
 			attr_mcast_groups = attr;
 			ynl_attr_for_each_nested(attr2, attr)
-				dst->n_mcast_groups++;
+				n_mcast_groups++;
 		} else if (type == CTRL_ATTR_OPS) {
 			const struct nlattr *attr2;
 
 			attr_ops = attr;
 			ynl_attr_for_each_nested(attr2, attr)
-				dst->n_ops++;
+				n_ops++;
 		} else if (type == CTRL_ATTR_VERSION) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->version = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -380,58 +383,129 @@ int nlctrl_getfamily_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<nlctrl_getfamily_rsp>
-nlctrl_getfamily(ynl_cpp::ynl_socket&  ys, nlctrl_getfamily_req& req)
+static void
+nlctrl_getfamily_put(struct nlmsghdr *nlh, nlctrl_getfamily_req& req)
+{
+	if (req.family_name.size() > 0)
+		ynl_attr_put_str(nlh, CTRL_ATTR_FAMILY_NAME, req.family_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<nlctrl_getfamily_rsp>>
+nlctrl_getfamily_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<nlctrl_getfamily_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, CTRL_CMD_GETFAMILY, 1);
 	((struct ynl_sock*)ys)->req_policy = &nlctrl_ctrl_attrs_nest;
 	yrs.yarg.rsp_policy = &nlctrl_ctrl_attrs_nest;
 
-	if (req.family_name.size() > 0)
-		ynl_attr_put_str(nlh, CTRL_ATTR_FAMILY_NAME, req.family_name.data());
-
 	rsp.reset(new nlctrl_getfamily_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = nlctrl_getfamily_rsp_parse;
 	yrs.rsp_cmd = 1;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<nlctrl_getfamily_rsp>>
+nlctrl_getfamily_ex(ynl_cpp::ynl_socket&  ys, nlctrl_getfamily_req& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, CTRL_CMD_GETFAMILY, 1);
+	nlctrl_getfamily_put(nlh, req);
+
+	return nlctrl_getfamily_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nlctrl_getfamily_rsp>
+nlctrl_getfamily(ynl_cpp::ynl_socket&  ys, nlctrl_getfamily_req& req)
+{
+	auto ret = nlctrl_getfamily_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nlctrl_getfamily_prepare(ynl_cpp::ynl_socket&  ys, nlctrl_getfamily_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, CTRL_CMD_GETFAMILY, 1);
+	nlctrl_getfamily_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<nlctrl_getfamily_rsp>>
+nlctrl_getfamily_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return nlctrl_getfamily_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nlctrl_getfamily_rsp>
+nlctrl_getfamily(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = nlctrl_getfamily_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* CTRL_CMD_GETFAMILY - dump */
-std::unique_ptr<nlctrl_getfamily_list>
-nlctrl_getfamily_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<nlctrl_getfamily_list>>
+nlctrl_getfamily_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<nlctrl_getfamily_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &nlctrl_ctrl_attrs_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<nlctrl_getfamily_list*>(arg)->objs.emplace_back());};
 	yds.cb = nlctrl_getfamily_rsp_parse;
 	yds.rsp_cmd = 1;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, CTRL_CMD_GETFAMILY, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<nlctrl_getfamily_list>>
+nlctrl_getfamily_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, CTRL_CMD_GETFAMILY, 1);
+
+	return nlctrl_getfamily_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nlctrl_getfamily_list>
+nlctrl_getfamily_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = nlctrl_getfamily_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== CTRL_CMD_GETPOLICY ============== */
 /* CTRL_CMD_GETPOLICY - dump */
 int nlctrl_getpolicy_rsp_dump_parse(const struct nlmsghdr *nlh,
@@ -447,34 +521,37 @@ int nlctrl_getpolicy_rsp_dump_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == CTRL_ATTR_FAMILY_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->family_id = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == CTRL_ATTR_OP_POLICY) {
 			const struct nlattr *attr_op_id;
 			__u32 op_id;
 
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &nlctrl_op_policy_attrs_nest;
-			parg.data = &dst->op_policy;
-			attr_op_id = ynl_attr_data(attr);
+			parg.data = &dst->op_policy.emplace();
+			attr_op_id = (const struct nlattr *)ynl_attr_data(attr);
 			op_id = ynl_attr_type(attr_op_id);
 			nlctrl_op_policy_attrs_parse(&parg, attr_op_id, op_id);
 		} else if (type == CTRL_ATTR_POLICY) {
 			const struct nlattr *attr_policy_id, *attr_attr_id;
 			__u32 policy_id, attr_id;
 
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &nlctrl_policy_attrs_nest;
-			parg.data = &dst->policy;
-			attr_policy_id = ynl_attr_data(attr);
+			parg.data = &dst->policy.emplace();
+			attr_policy_id = (const struct nlattr *)ynl_attr_data(attr);
 			policy_id = ynl_attr_type(attr_policy_id);
-			attr_attr_id = ynl_attr_data(attr_policy_id);
+			attr_attr_id = (const struct nlattr *)ynl_attr_data(attr_policy_id);
 			attr_id = ynl_attr_type(attr_attr_id);
 			nlctrl_policy_attrs_parse(&parg, attr_attr_id, policy_id, attr_id);
 		}
@@ -483,38 +560,95 @@ int nlctrl_getpolicy_rsp_dump_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<nlctrl_getpolicy_rsp_list>
-nlctrl_getpolicy_dump(ynl_cpp::ynl_socket&  ys, nlctrl_getpolicy_req_dump& req)
+static void
+nlctrl_getpolicy_dump_put(struct nlmsghdr *nlh, nlctrl_getpolicy_req_dump& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.family_id.has_value())
+		ynl_attr_put_u16_unchecked(nlh, CTRL_ATTR_FAMILY_ID, req.family_id.value());
+	if (req.op.has_value())
+		ynl_attr_put_u32_unchecked(nlh, CTRL_ATTR_OP, req.op.value());
+	if (req.family_name.size() > 0)
+		ynl_attr_put_str(nlh, CTRL_ATTR_FAMILY_NAME, req.family_name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<nlctrl_getpolicy_rsp_list>>
+nlctrl_getpolicy_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<nlctrl_getpolicy_rsp_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &nlctrl_ctrl_attrs_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<nlctrl_getpolicy_rsp_list*>(arg)->objs.emplace_back());};
 	yds.cb = nlctrl_getpolicy_rsp_dump_parse;
 	yds.rsp_cmd = CTRL_CMD_GETPOLICY;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, CTRL_CMD_GETPOLICY, 1);
 	((struct ynl_sock*)ys)->req_policy = &nlctrl_ctrl_attrs_nest;
 
-	if (req.family_name.size() > 0)
-		ynl_attr_put_str(nlh, CTRL_ATTR_FAMILY_NAME, req.family_name.data());
-	if (req.family_id.has_value())
-		ynl_attr_put_u16(nlh, CTRL_ATTR_FAMILY_ID, req.family_id.value());
-	if (req.op.has_value())
-		ynl_attr_put_u32(nlh, CTRL_ATTR_OP, req.op.value());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<nlctrl_getpolicy_rsp_list>>
+nlctrl_getpolicy_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 nlctrl_getpolicy_req_dump& req,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, CTRL_CMD_GETPOLICY, 1);
+	nlctrl_getpolicy_dump_put(nlh, req);
+
+	return nlctrl_getpolicy_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<nlctrl_getpolicy_rsp_list>
+nlctrl_getpolicy_dump(ynl_cpp::ynl_socket&  ys, nlctrl_getpolicy_req_dump& req)
+{
+	auto ret = nlctrl_getpolicy_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+nlctrl_getpolicy_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      nlctrl_getpolicy_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, CTRL_CMD_GETPOLICY, 1);
+	nlctrl_getpolicy_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<nlctrl_getpolicy_rsp_list>>
+nlctrl_getpolicy_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return nlctrl_getpolicy_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<nlctrl_getpolicy_rsp_list>
+nlctrl_getpolicy_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = nlctrl_getpolicy_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 const struct ynl_family ynl_nlctrl_family =  {
 	.name		= "nlctrl",
 	.hdr_len	= sizeof(struct genlmsghdr),
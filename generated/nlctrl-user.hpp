@@ -64,6 +64,13 @@ struct nlctrl_op_policy_attrs {
 	std::optional<__u32> dump;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest nlctrl_op_attrs_nest;
+extern struct ynl_policy_nest nlctrl_mcast_group_attrs_nest;
+extern struct ynl_policy_nest nlctrl_policy_attrs_nest;
+extern struct ynl_policy_nest nlctrl_op_policy_attrs_nest;
+extern struct ynl_policy_nest nlctrl_ctrl_attrs_nest;
+
 /* ============== CTRL_CMD_GETFAMILY ============== */
 /* CTRL_CMD_GETFAMILY - do */
 struct nlctrl_getfamily_req {
@@ -85,6 +92,16 @@ struct nlctrl_getfamily_rsp {
  */
 std::unique_ptr<nlctrl_getfamily_rsp>
 nlctrl_getfamily(ynl_cpp::ynl_socket&  ys, nlctrl_getfamily_req& req);
+ynl_cpp::result<std::unique_ptr<nlctrl_getfamily_rsp>>
+nlctrl_getfamily_ex(ynl_cpp::ynl_socket&  ys, nlctrl_getfamily_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nlctrl_getfamily_prepare(ynl_cpp::ynl_socket&  ys, nlctrl_getfamily_req& req);
+std::unique_ptr<nlctrl_getfamily_rsp>
+nlctrl_getfamily(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nlctrl_getfamily_rsp>>
+nlctrl_getfamily_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* CTRL_CMD_GETFAMILY - dump */
 struct nlctrl_getfamily_list {
@@ -93,6 +110,9 @@ struct nlctrl_getfamily_list {
 
 std::unique_ptr<nlctrl_getfamily_list>
 nlctrl_getfamily_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<nlctrl_getfamily_list>>
+nlctrl_getfamily_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* ============== CTRL_CMD_GETPOLICY ============== */
 /* CTRL_CMD_GETPOLICY - dump */
@@ -114,6 +134,20 @@ struct nlctrl_getpolicy_rsp_list {
 
 std::unique_ptr<nlctrl_getpolicy_rsp_list>
 nlctrl_getpolicy_dump(ynl_cpp::ynl_socket&  ys, nlctrl_getpolicy_req_dump& req);
+ynl_cpp::result<std::unique_ptr<nlctrl_getpolicy_rsp_list>>
+nlctrl_getpolicy_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 nlctrl_getpolicy_req_dump& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+nlctrl_getpolicy_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      nlctrl_getpolicy_req_dump& req);
+std::unique_ptr<nlctrl_getpolicy_rsp_list>
+nlctrl_getpolicy_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<nlctrl_getpolicy_rsp_list>>
+nlctrl_getpolicy_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_NLCTRL_GEN_H */
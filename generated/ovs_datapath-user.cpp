@@ -14,8 +14,8 @@
 namespace ynl_cpp {
 
 /* Enums */
-static constexpr std::array<std::string_view, OVS_DP_CMD_DEL + 1> ovs_datapath_op_strmap = []() {
-	std::array<std::string_view, OVS_DP_CMD_DEL + 1> arr{};
+static constexpr std::array<std::string_view, OVS_DP_CMD_GET + 1> ovs_datapath_op_strmap = []() {
+	std::array<std::string_view, OVS_DP_CMD_GET + 1> arr{};
 	arr[OVS_DP_CMD_GET] = "get";
 	arr[OVS_DP_CMD_NEW] = "new";
 	arr[OVS_DP_CMD_DEL] = "del";
@@ -84,37 +84,34 @@ int ovs_datapath_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == OVS_DP_ATTR_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
 		} else if (type == OVS_DP_ATTR_UPCALL_PID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->upcall_pid = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == OVS_DP_ATTR_STATS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->stats.assign(data, data + len);
 		} else if (type == OVS_DP_ATTR_MEGAFLOW_STATS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->megaflow_stats.assign(data, data + len);
 		} else if (type == OVS_DP_ATTR_USER_FEATURES) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->user_features = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == OVS_DP_ATTR_MASKS_CACHE_SIZE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->masks_cache_size = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == OVS_DP_ATTR_PER_CPU_PIDS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->per_cpu_pids.assign(data, data + len);
@@ -124,130 +121,349 @@ int ovs_datapath_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<ovs_datapath_get_rsp>
-ovs_datapath_get(ynl_cpp::ynl_socket&  ys, ovs_datapath_get_req& req)
+static void
+ovs_datapath_get_put(struct nlmsghdr *nlh, ovs_datapath_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<ovs_datapath_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	size_t hdr_len;
 	void *hdr;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &ovs_datapath_datapath_nest;
-	yrs.yarg.rsp_policy = &ovs_datapath_datapath_nest;
 
-	hdr_len = sizeof(req->_hdr);
+	hdr_len = sizeof(req._hdr);
 	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
-	memcpy(hdr, &req->_hdr, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
 
 	if (req.name.size() > 0)
 		ynl_attr_put_str(nlh, OVS_DP_ATTR_NAME, req.name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<ovs_datapath_get_rsp>>
+ovs_datapath_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<ovs_datapath_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ovs_datapath_datapath_nest;
+	yrs.yarg.rsp_policy = &ovs_datapath_datapath_nest;
 
 	rsp.reset(new ovs_datapath_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = ovs_datapath_get_rsp_parse;
 	yrs.rsp_cmd = OVS_DP_CMD_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
-/* OVS_DP_CMD_GET - dump */
-std::unique_ptr<ovs_datapath_get_list>
-ovs_datapath_get_dump(ynl_cpp::ynl_socket&  ys, ovs_datapath_get_req_dump& req)
+ynl_cpp::result<std::unique_ptr<ovs_datapath_get_rsp>>
+ovs_datapath_get_ex(ynl_cpp::ynl_socket&  ys, ovs_datapath_get_req& req,
+		    const ynl_cpp::projection *proj)
 {
-	struct ynl_dump_no_alloc_state yds = {};
 	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_GET, 1);
+	ovs_datapath_get_put(nlh, req);
+
+	return ovs_datapath_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ovs_datapath_get_rsp>
+ovs_datapath_get(ynl_cpp::ynl_socket&  ys, ovs_datapath_get_req& req)
+{
+	auto ret = ovs_datapath_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_datapath_get_prepare(ynl_cpp::ynl_socket&  ys, ovs_datapath_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_GET, 1);
+	ovs_datapath_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ovs_datapath_get_rsp>>
+ovs_datapath_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return ovs_datapath_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ovs_datapath_get_rsp>
+ovs_datapath_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_datapath_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* OVS_DP_CMD_GET - dump */
+static void
+ovs_datapath_get_dump_put(struct nlmsghdr *nlh, ovs_datapath_get_req_dump& req)
+{
 	size_t hdr_len;
 	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, OVS_DP_ATTR_NAME, req.name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<ovs_datapath_get_list>>
+ovs_datapath_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
 	int err;
 
 	auto ret = std::make_unique<ovs_datapath_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &ovs_datapath_datapath_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ovs_datapath_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = ovs_datapath_get_rsp_parse;
 	yds.rsp_cmd = OVS_DP_CMD_GET;
-
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_GET, 1);
-	hdr_len = sizeof(req->_hdr);
-	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
-	memcpy(hdr, &req->_hdr, hdr_len);
-
 	((struct ynl_sock*)ys)->req_policy = &ovs_datapath_datapath_nest;
 
-	if (req.name.size() > 0)
-		ynl_attr_put_str(nlh, OVS_DP_ATTR_NAME, req.name.data());
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<ovs_datapath_get_list>>
+ovs_datapath_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ovs_datapath_get_req_dump& req,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_GET, 1);
+	ovs_datapath_get_dump_put(nlh, req);
+
+	return ovs_datapath_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ovs_datapath_get_list>
+ovs_datapath_get_dump(ynl_cpp::ynl_socket&  ys, ovs_datapath_get_req_dump& req)
+{
+	auto ret = ovs_datapath_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_datapath_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      ovs_datapath_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_GET, 1);
+	ovs_datapath_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ovs_datapath_get_list>>
+ovs_datapath_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return ovs_datapath_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ovs_datapath_get_list>
+ovs_datapath_get_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_datapath_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== OVS_DP_CMD_NEW ============== */
 /* OVS_DP_CMD_NEW - do */
-int ovs_datapath_new(ynl_cpp::ynl_socket&  ys, ovs_datapath_new_req& req)
+static void
+ovs_datapath_new_put(struct nlmsghdr *nlh, ovs_datapath_new_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	size_t hdr_len;
 	void *hdr;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_NEW, 1);
-	((struct ynl_sock*)ys)->req_policy = &ovs_datapath_datapath_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + NLMSG_ALIGN(sizeof(struct ovs_header)) + 16 <= YNL_SOCKET_BUFFER_SIZE);
 
-	hdr_len = sizeof(req->_hdr);
+	hdr_len = sizeof(req._hdr);
 	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
-	memcpy(hdr, &req->_hdr, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
 
-	if (req.name.size() > 0)
-		ynl_attr_put_str(nlh, OVS_DP_ATTR_NAME, req.name.data());
 	if (req.upcall_pid.has_value())
-		ynl_attr_put_u32(nlh, OVS_DP_ATTR_UPCALL_PID, req.upcall_pid.value());
+		ynl_attr_put_u32_unchecked(nlh, OVS_DP_ATTR_UPCALL_PID, req.upcall_pid.value());
 	if (req.user_features.has_value())
-		ynl_attr_put_u32(nlh, OVS_DP_ATTR_USER_FEATURES, req.user_features.value());
+		ynl_attr_put_u32_unchecked(nlh, OVS_DP_ATTR_USER_FEATURES, req.user_features.value());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, OVS_DP_ATTR_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+ovs_datapath_new_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ovs_datapath_datapath_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+ovs_datapath_new_ex(ynl_cpp::ynl_socket&  ys, ovs_datapath_new_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_NEW, 1);
+	ovs_datapath_new_put(nlh, req);
+
+	return ovs_datapath_new_exec(ys, nlh);
+}
+
+int ovs_datapath_new(ynl_cpp::ynl_socket&  ys, ovs_datapath_new_req& req)
+{
+	auto ret = ovs_datapath_new_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_datapath_new_prepare(ynl_cpp::ynl_socket&  ys, ovs_datapath_new_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_NEW, 1);
+	ovs_datapath_new_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ovs_datapath_new_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ovs_datapath_new_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ovs_datapath_new(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_datapath_new_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ovs_datapath_new_batch(ynl_cpp::msg_batch& batch, ovs_datapath_new_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(OVS_DP_CMD_NEW, 1);
+	ovs_datapath_new_put(nlh, req);
+	return batch.msg_end(nlh, &ovs_datapath_datapath_nest);
 }
 
 /* ============== OVS_DP_CMD_DEL ============== */
 /* OVS_DP_CMD_DEL - do */
-int ovs_datapath_del(ynl_cpp::ynl_socket&  ys, ovs_datapath_del_req& req)
+static void
+ovs_datapath_del_put(struct nlmsghdr *nlh, ovs_datapath_del_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	struct nlmsghdr *nlh;
 	size_t hdr_len;
 	void *hdr;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_DEL, 1);
-	((struct ynl_sock*)ys)->req_policy = &ovs_datapath_datapath_nest;
 
-	hdr_len = sizeof(req->_hdr);
+	hdr_len = sizeof(req._hdr);
 	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
-	memcpy(hdr, &req->_hdr, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
 
 	if (req.name.size() > 0)
 		ynl_attr_put_str(nlh, OVS_DP_ATTR_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+ovs_datapath_del_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ovs_datapath_datapath_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+ovs_datapath_del_ex(ynl_cpp::ynl_socket&  ys, ovs_datapath_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_DEL, 1);
+	ovs_datapath_del_put(nlh, req);
+
+	return ovs_datapath_del_exec(ys, nlh);
+}
+
+int ovs_datapath_del(ynl_cpp::ynl_socket&  ys, ovs_datapath_del_req& req)
+{
+	auto ret = ovs_datapath_del_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_datapath_del_prepare(ynl_cpp::ynl_socket&  ys, ovs_datapath_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_DP_CMD_DEL, 1);
+	ovs_datapath_del_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ovs_datapath_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ovs_datapath_del_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ovs_datapath_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_datapath_del_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ovs_datapath_del_batch(ynl_cpp::msg_batch& batch, ovs_datapath_del_req& req)
+{
+	struct nlmsghdr *nlh;
 
-	return 0;
+	nlh = batch.gemsg_start(OVS_DP_CMD_DEL, 1);
+	ovs_datapath_del_put(nlh, req);
+	return batch.msg_end(nlh, &ovs_datapath_datapath_nest);
 }
 
 const struct ynl_family ynl_ovs_datapath_family =  {
@@ -29,16 +29,19 @@ std::string_view ovs_datapath_op_str(int op);
 std::string_view ovs_datapath_user_features_str(int value);
 
 /* Common nested types */
+/* Policies and nested encoders */
+extern struct ynl_policy_nest ovs_datapath_datapath_nest;
+
 /* ============== OVS_DP_CMD_GET ============== */
 /* OVS_DP_CMD_GET - do */
 struct ovs_datapath_get_req {
-	struct ovs_header _hdr;
+	struct ovs_header _hdr{};
 
 	std::string name;
 };
 
 struct ovs_datapath_get_rsp {
-	struct ovs_header _hdr;
+	struct ovs_header _hdr{};
 
 	std::string name;
 	std::optional<__u32> upcall_pid;
@@ -54,10 +57,20 @@ struct ovs_datapath_get_rsp {
  */
 std::unique_ptr<ovs_datapath_get_rsp>
 ovs_datapath_get(ynl_cpp::ynl_socket&  ys, ovs_datapath_get_req& req);
+ynl_cpp::result<std::unique_ptr<ovs_datapath_get_rsp>>
+ovs_datapath_get_ex(ynl_cpp::ynl_socket&  ys, ovs_datapath_get_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_datapath_get_prepare(ynl_cpp::ynl_socket&  ys, ovs_datapath_get_req& req);
+std::unique_ptr<ovs_datapath_get_rsp>
+ovs_datapath_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ovs_datapath_get_rsp>>
+ovs_datapath_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* OVS_DP_CMD_GET - dump */
 struct ovs_datapath_get_req_dump {
-	struct ovs_header _hdr;
+	struct ovs_header _hdr{};
 
 	std::string name;
 };
@@ -68,11 +81,25 @@ struct ovs_datapath_get_list {
 
 std::unique_ptr<ovs_datapath_get_list>
 ovs_datapath_get_dump(ynl_cpp::ynl_socket&  ys, ovs_datapath_get_req_dump& req);
+ynl_cpp::result<std::unique_ptr<ovs_datapath_get_list>>
+ovs_datapath_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ovs_datapath_get_req_dump& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_datapath_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      ovs_datapath_get_req_dump& req);
+std::unique_ptr<ovs_datapath_get_list>
+ovs_datapath_get_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<ovs_datapath_get_list>>
+ovs_datapath_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
 
 /* ============== OVS_DP_CMD_NEW ============== */
 /* OVS_DP_CMD_NEW - do */
 struct ovs_datapath_new_req {
-	struct ovs_header _hdr;
+	struct ovs_header _hdr{};
 
 	std::string name;
 	std::optional<__u32> upcall_pid;
@@ -83,11 +110,20 @@ struct ovs_datapath_new_req {
  * Create new OVS data path
  */
 int ovs_datapath_new(ynl_cpp::ynl_socket&  ys, ovs_datapath_new_req& req);
+ynl_cpp::result<void>
+ovs_datapath_new_ex(ynl_cpp::ynl_socket&  ys, ovs_datapath_new_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_datapath_new_prepare(ynl_cpp::ynl_socket&  ys, ovs_datapath_new_req& req);
+int ovs_datapath_new(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ovs_datapath_new_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ovs_datapath_new_batch(ynl_cpp::msg_batch& batch, ovs_datapath_new_req& req);
 
 /* ============== OVS_DP_CMD_DEL ============== */
 /* OVS_DP_CMD_DEL - do */
 struct ovs_datapath_del_req {
-	struct ovs_header _hdr;
+	struct ovs_header _hdr{};
 
 	std::string name;
 };
@@ -96,6 +132,15 @@ struct ovs_datapath_del_req {
  * Delete existing OVS data path
  */
 int ovs_datapath_del(ynl_cpp::ynl_socket&  ys, ovs_datapath_del_req& req);
+ynl_cpp::result<void>
+ovs_datapath_del_ex(ynl_cpp::ynl_socket&  ys, ovs_datapath_del_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_datapath_del_prepare(ynl_cpp::ynl_socket&  ys, ovs_datapath_del_req& req);
+int ovs_datapath_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+ovs_datapath_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+ovs_datapath_del_batch(ynl_cpp::msg_batch& batch, ovs_datapath_del_req& req);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_OVS_DATAPATH_GEN_H */
@@ -0,0 +1,1854 @@
+// SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause)
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user source */
+
+#include "ovs_flow-user.hpp"
+
+#include <array>
+
+#include <linux/openvswitch.h>
+
+#include <linux/genetlink.h>
+
+namespace ynl_cpp {
+
+/* Enums */
+static constexpr std::array<std::string_view, OVS_FLOW_CMD_GET + 1> ovs_flow_op_strmap = []() {
+	std::array<std::string_view, OVS_FLOW_CMD_GET + 1> arr{};
+	arr[OVS_FLOW_CMD_GET] = "get";
+	arr[OVS_FLOW_CMD_NEW] = "new";
+	arr[OVS_FLOW_CMD_DEL] = "del";
+	return arr;
+} ();
+
+std::string_view ovs_flow_op_str(int op)
+{
+	if (op < 0 || op >= (int)(ovs_flow_op_strmap.size()))
+		return "";
+	return ovs_flow_op_strmap[op];
+}
+
+static constexpr std::array<std::string_view, 255 + 1> ovs_flow_ovs_frag_type_strmap = []() {
+	std::array<std::string_view, 255 + 1> arr{};
+	arr[0] = "none";
+	arr[1] = "first";
+	arr[2] = "later";
+	arr[255] = "any";
+	return arr;
+} ();
+
+std::string_view ovs_flow_ovs_frag_type_str(ovs_frag_type value)
+{
+	if (value < 0 || value >= (int)(ovs_flow_ovs_frag_type_strmap.size()))
+		return "";
+	return ovs_flow_ovs_frag_type_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 2 + 1> ovs_flow_ovs_ufid_flags_strmap = []() {
+	std::array<std::string_view, 2 + 1> arr{};
+	arr[0] = "omit-key";
+	arr[1] = "omit-mask";
+	arr[2] = "omit-actions";
+	return arr;
+} ();
+
+std::string_view ovs_flow_ovs_ufid_flags_str(int value)
+{
+	value = (int)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(ovs_flow_ovs_ufid_flags_strmap.size()))
+		return "";
+	return ovs_flow_ovs_ufid_flags_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 0 + 1> ovs_flow_ovs_hash_alg_strmap = []() {
+	std::array<std::string_view, 0 + 1> arr{};
+	arr[0] = "ovs-hash-alg-l4";
+	return arr;
+} ();
+
+std::string_view ovs_flow_ovs_hash_alg_str(ovs_hash_alg value)
+{
+	if (value < 0 || value >= (int)(ovs_flow_ovs_hash_alg_strmap.size()))
+		return "";
+	return ovs_flow_ovs_hash_alg_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 7 + 1> ovs_flow_ct_state_flags_strmap = []() {
+	std::array<std::string_view, 7 + 1> arr{};
+	arr[0] = "new";
+	arr[1] = "established";
+	arr[2] = "related";
+	arr[3] = "reply-dir";
+	arr[4] = "invalid";
+	arr[5] = "tracked";
+	arr[6] = "src-nat";
+	arr[7] = "dst-nat";
+	return arr;
+} ();
+
+std::string_view ovs_flow_ct_state_flags_str(int value)
+{
+	value = (int)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(ovs_flow_ct_state_flags_strmap.size()))
+		return "";
+	return ovs_flow_ct_state_flags_strmap[value];
+}
+
+/* Policies */
+extern struct ynl_policy_nest ovs_flow_key_attrs_nest;
+extern struct ynl_policy_nest ovs_flow_action_attrs_nest;
+
+static std::array<ynl_policy_attr,OVS_NSH_KEY_ATTR_MAX + 1> ovs_flow_ovs_nsh_key_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_NSH_KEY_ATTR_MAX + 1> arr{};
+	arr[OVS_NSH_KEY_ATTR_BASE] = { .name = "base", .type = YNL_PT_BINARY,};
+	arr[OVS_NSH_KEY_ATTR_MD1] = { .name = "md1", .type = YNL_PT_BINARY,};
+	arr[OVS_NSH_KEY_ATTR_MD2] = { .name = "md2", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_ovs_nsh_key_attrs_nest = {
+	.max_attr = OVS_NSH_KEY_ATTR_MAX,
+	.table = ovs_flow_ovs_nsh_key_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_USERSPACE_ATTR_MAX + 1> ovs_flow_userspace_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_USERSPACE_ATTR_MAX + 1> arr{};
+	arr[OVS_USERSPACE_ATTR_PID] = { .name = "pid", .type = YNL_PT_U32, };
+	arr[OVS_USERSPACE_ATTR_USERDATA] = { .name = "userdata", .type = YNL_PT_BINARY,};
+	arr[OVS_USERSPACE_ATTR_EGRESS_TUN_PORT] = { .name = "egress-tun-port", .type = YNL_PT_U32, };
+	arr[OVS_USERSPACE_ATTR_ACTIONS] = { .name = "actions", .type = YNL_PT_FLAG, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_userspace_attrs_nest = {
+	.max_attr = OVS_USERSPACE_ATTR_MAX,
+	.table = ovs_flow_userspace_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_PSAMPLE_ATTR_MAX + 1> ovs_flow_psample_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_PSAMPLE_ATTR_MAX + 1> arr{};
+	arr[OVS_PSAMPLE_ATTR_GROUP] = { .name = "group", .type = YNL_PT_U32, };
+	arr[OVS_PSAMPLE_ATTR_COOKIE] = { .name = "cookie", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_psample_attrs_nest = {
+	.max_attr = OVS_PSAMPLE_ATTR_MAX,
+	.table = ovs_flow_psample_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_VXLAN_EXT_MAX + 1> ovs_flow_vxlan_ext_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_VXLAN_EXT_MAX + 1> arr{};
+	arr[OVS_VXLAN_EXT_GBP] = { .name = "gbp", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_vxlan_ext_attrs_nest = {
+	.max_attr = OVS_VXLAN_EXT_MAX,
+	.table = ovs_flow_vxlan_ext_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_NAT_ATTR_MAX + 1> ovs_flow_nat_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_NAT_ATTR_MAX + 1> arr{};
+	arr[OVS_NAT_ATTR_SRC] = { .name = "src", .type = YNL_PT_FLAG, };
+	arr[OVS_NAT_ATTR_DST] = { .name = "dst", .type = YNL_PT_FLAG, };
+	arr[OVS_NAT_ATTR_IP_MIN] = { .name = "ip-min", .type = YNL_PT_BINARY,};
+	arr[OVS_NAT_ATTR_IP_MAX] = { .name = "ip-max", .type = YNL_PT_BINARY,};
+	arr[OVS_NAT_ATTR_PROTO_MIN] = { .name = "proto-min", .type = YNL_PT_U16, };
+	arr[OVS_NAT_ATTR_PROTO_MAX] = { .name = "proto-max", .type = YNL_PT_U16, };
+	arr[OVS_NAT_ATTR_PERSISTENT] = { .name = "persistent", .type = YNL_PT_FLAG, };
+	arr[OVS_NAT_ATTR_PROTO_HASH] = { .name = "proto-hash", .type = YNL_PT_FLAG, };
+	arr[OVS_NAT_ATTR_PROTO_RANDOM] = { .name = "proto-random", .type = YNL_PT_FLAG, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_nat_attrs_nest = {
+	.max_attr = OVS_NAT_ATTR_MAX,
+	.table = ovs_flow_nat_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_TUNNEL_KEY_ATTR_MAX + 1> ovs_flow_tunnel_key_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_TUNNEL_KEY_ATTR_MAX + 1> arr{};
+	arr[OVS_TUNNEL_KEY_ATTR_ID] = { .name = "id", .type = YNL_PT_U64, };
+	arr[OVS_TUNNEL_KEY_ATTR_IPV4_SRC] = { .name = "ipv4-src", .type = YNL_PT_U32, };
+	arr[OVS_TUNNEL_KEY_ATTR_IPV4_DST] = { .name = "ipv4-dst", .type = YNL_PT_U32, };
+	arr[OVS_TUNNEL_KEY_ATTR_TOS] = { .name = "tos", .type = YNL_PT_U8, };
+	arr[OVS_TUNNEL_KEY_ATTR_TTL] = { .name = "ttl", .type = YNL_PT_U8, };
+	arr[OVS_TUNNEL_KEY_ATTR_DONT_FRAGMENT] = { .name = "dont-fragment", .type = YNL_PT_FLAG, };
+	arr[OVS_TUNNEL_KEY_ATTR_CSUM] = { .name = "csum", .type = YNL_PT_FLAG, };
+	arr[OVS_TUNNEL_KEY_ATTR_OAM] = { .name = "oam", .type = YNL_PT_FLAG, };
+	arr[OVS_TUNNEL_KEY_ATTR_GENEVE_OPTS] = { .name = "geneve-opts", .type = YNL_PT_BINARY,};
+	arr[OVS_TUNNEL_KEY_ATTR_TP_SRC] = { .name = "tp-src", .type = YNL_PT_U16, };
+	arr[OVS_TUNNEL_KEY_ATTR_TP_DST] = { .name = "tp-dst", .type = YNL_PT_U16, };
+	arr[OVS_TUNNEL_KEY_ATTR_VXLAN_OPTS] = { .name = "vxlan-opts", .type = YNL_PT_NEST, .nest = &ovs_flow_vxlan_ext_attrs_nest, };
+	arr[OVS_TUNNEL_KEY_ATTR_IPV6_SRC] = { .name = "ipv6-src", .type = YNL_PT_BINARY,};
+	arr[OVS_TUNNEL_KEY_ATTR_IPV6_DST] = { .name = "ipv6-dst", .type = YNL_PT_BINARY,};
+	arr[OVS_TUNNEL_KEY_ATTR_PAD] = { .name = "pad", .type = YNL_PT_BINARY,};
+	arr[OVS_TUNNEL_KEY_ATTR_ERSPAN_OPTS] = { .name = "erspan-opts", .type = YNL_PT_BINARY,};
+	arr[OVS_TUNNEL_KEY_ATTR_IPV4_INFO_BRIDGE] = { .name = "ipv4-info-bridge", .type = YNL_PT_FLAG, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_tunnel_key_attrs_nest = {
+	.max_attr = OVS_TUNNEL_KEY_ATTR_MAX,
+	.table = ovs_flow_tunnel_key_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_CT_ATTR_MAX + 1> ovs_flow_ct_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_CT_ATTR_MAX + 1> arr{};
+	arr[OVS_CT_ATTR_COMMIT] = { .name = "commit", .type = YNL_PT_FLAG, };
+	arr[OVS_CT_ATTR_ZONE] = { .name = "zone", .type = YNL_PT_U16, };
+	arr[OVS_CT_ATTR_MARK] = { .name = "mark", .type = YNL_PT_BINARY,};
+	arr[OVS_CT_ATTR_LABELS] = { .name = "labels", .type = YNL_PT_BINARY,};
+	arr[OVS_CT_ATTR_HELPER] = { .name = "helper", .type = YNL_PT_NUL_STR, };
+	arr[OVS_CT_ATTR_NAT] = { .name = "nat", .type = YNL_PT_NEST, .nest = &ovs_flow_nat_attrs_nest, };
+	arr[OVS_CT_ATTR_FORCE_COMMIT] = { .name = "force-commit", .type = YNL_PT_FLAG, };
+	arr[OVS_CT_ATTR_EVENTMASK] = { .name = "eventmask", .type = YNL_PT_U32, };
+	arr[OVS_CT_ATTR_TIMEOUT] = { .name = "timeout", .type = YNL_PT_NUL_STR, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_ct_attrs_nest = {
+	.max_attr = OVS_CT_ATTR_MAX,
+	.table = ovs_flow_ct_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_KEY_ATTR_MAX + 1> ovs_flow_key_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_KEY_ATTR_MAX + 1> arr{};
+	arr[OVS_KEY_ATTR_ENCAP] = { .name = "encap", .type = YNL_PT_NEST, .nest = &ovs_flow_key_attrs_nest, };
+	arr[OVS_KEY_ATTR_PRIORITY] = { .name = "priority", .type = YNL_PT_U32, };
+	arr[OVS_KEY_ATTR_IN_PORT] = { .name = "in-port", .type = YNL_PT_U32, };
+	arr[OVS_KEY_ATTR_ETHERNET] = { .name = "ethernet", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_VLAN] = { .name = "vlan", .type = YNL_PT_U16, };
+	arr[OVS_KEY_ATTR_ETHERTYPE] = { .name = "ethertype", .type = YNL_PT_U16, };
+	arr[OVS_KEY_ATTR_IPV4] = { .name = "ipv4", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_IPV6] = { .name = "ipv6", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_TCP] = { .name = "tcp", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_UDP] = { .name = "udp", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_ICMP] = { .name = "icmp", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_ICMPV6] = { .name = "icmpv6", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_ARP] = { .name = "arp", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_ND] = { .name = "nd", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_SKB_MARK] = { .name = "skb-mark", .type = YNL_PT_U32, };
+	arr[OVS_KEY_ATTR_TUNNEL] = { .name = "tunnel", .type = YNL_PT_NEST, .nest = &ovs_flow_tunnel_key_attrs_nest, };
+	arr[OVS_KEY_ATTR_SCTP] = { .name = "sctp", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_TCP_FLAGS] = { .name = "tcp-flags", .type = YNL_PT_U16, };
+	arr[OVS_KEY_ATTR_DP_HASH] = { .name = "dp-hash", .type = YNL_PT_U32, };
+	arr[OVS_KEY_ATTR_RECIRC_ID] = { .name = "recirc-id", .type = YNL_PT_U32, };
+	arr[OVS_KEY_ATTR_MPLS] = { .name = "mpls", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_CT_STATE] = { .name = "ct-state", .type = YNL_PT_U32, };
+	arr[OVS_KEY_ATTR_CT_ZONE] = { .name = "ct-zone", .type = YNL_PT_U16, };
+	arr[OVS_KEY_ATTR_CT_MARK] = { .name = "ct-mark", .type = YNL_PT_U32, };
+	arr[OVS_KEY_ATTR_CT_LABELS] = { .name = "ct-labels", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_CT_ORIG_TUPLE_IPV4] = { .name = "ct-orig-tuple-ipv4", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_CT_ORIG_TUPLE_IPV6] = { .name = "ct-orig-tuple-ipv6", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_NSH] = { .name = "nsh", .type = YNL_PT_NEST, .nest = &ovs_flow_ovs_nsh_key_attrs_nest, };
+	arr[OVS_KEY_ATTR_PACKET_TYPE] = { .name = "packet-type", .type = YNL_PT_U32, };
+	arr[OVS_KEY_ATTR_ND_EXTENSIONS] = { .name = "nd-extensions", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_TUNNEL_INFO] = { .name = "tunnel-info", .type = YNL_PT_BINARY,};
+	arr[OVS_KEY_ATTR_IPV6_EXTHDRS] = { .name = "ipv6-exthdrs", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_key_attrs_nest = {
+	.max_attr = OVS_KEY_ATTR_MAX,
+	.table = ovs_flow_key_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_SAMPLE_ATTR_MAX + 1> ovs_flow_sample_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_SAMPLE_ATTR_MAX + 1> arr{};
+	arr[OVS_SAMPLE_ATTR_PROBABILITY] = { .name = "probability", .type = YNL_PT_U32, };
+	arr[OVS_SAMPLE_ATTR_ACTIONS] = { .name = "actions", .type = YNL_PT_NEST, .nest = &ovs_flow_action_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_sample_attrs_nest = {
+	.max_attr = OVS_SAMPLE_ATTR_MAX,
+	.table = ovs_flow_sample_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_CHECK_PKT_LEN_ATTR_MAX + 1> ovs_flow_check_pkt_len_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_CHECK_PKT_LEN_ATTR_MAX + 1> arr{};
+	arr[OVS_CHECK_PKT_LEN_ATTR_PKT_LEN] = { .name = "pkt-len", .type = YNL_PT_U16, };
+	arr[OVS_CHECK_PKT_LEN_ATTR_ACTIONS_IF_GREATER] = { .name = "actions-if-greater", .type = YNL_PT_NEST, .nest = &ovs_flow_action_attrs_nest, };
+	arr[OVS_CHECK_PKT_LEN_ATTR_ACTIONS_IF_LESS_EQUAL] = { .name = "actions-if-less-equal", .type = YNL_PT_NEST, .nest = &ovs_flow_action_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_check_pkt_len_attrs_nest = {
+	.max_attr = OVS_CHECK_PKT_LEN_ATTR_MAX,
+	.table = ovs_flow_check_pkt_len_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_DEC_TTL_ATTR_MAX + 1> ovs_flow_dec_ttl_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_DEC_TTL_ATTR_MAX + 1> arr{};
+	arr[OVS_DEC_TTL_ATTR_ACTION] = { .name = "action", .type = YNL_PT_NEST, .nest = &ovs_flow_action_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_dec_ttl_attrs_nest = {
+	.max_attr = OVS_DEC_TTL_ATTR_MAX,
+	.table = ovs_flow_dec_ttl_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_ACTION_ATTR_MAX + 1> ovs_flow_action_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_ACTION_ATTR_MAX + 1> arr{};
+	arr[OVS_ACTION_ATTR_OUTPUT] = { .name = "output", .type = YNL_PT_U32, };
+	arr[OVS_ACTION_ATTR_USERSPACE] = { .name = "userspace", .type = YNL_PT_NEST, .nest = &ovs_flow_userspace_attrs_nest, };
+	arr[OVS_ACTION_ATTR_SET] = { .name = "set", .type = YNL_PT_NEST, .nest = &ovs_flow_key_attrs_nest, };
+	arr[OVS_ACTION_ATTR_PUSH_VLAN] = { .name = "push-vlan", .type = YNL_PT_BINARY,};
+	arr[OVS_ACTION_ATTR_POP_VLAN] = { .name = "pop-vlan", .type = YNL_PT_FLAG, };
+	arr[OVS_ACTION_ATTR_SAMPLE] = { .name = "sample", .type = YNL_PT_NEST, .nest = &ovs_flow_sample_attrs_nest, };
+	arr[OVS_ACTION_ATTR_RECIRC] = { .name = "recirc", .type = YNL_PT_U32, };
+	arr[OVS_ACTION_ATTR_HASH] = { .name = "hash", .type = YNL_PT_BINARY,};
+	arr[OVS_ACTION_ATTR_PUSH_MPLS] = { .name = "push-mpls", .type = YNL_PT_BINARY,};
+	arr[OVS_ACTION_ATTR_POP_MPLS] = { .name = "pop-mpls", .type = YNL_PT_U16, };
+	arr[OVS_ACTION_ATTR_SET_MASKED] = { .name = "set-masked", .type = YNL_PT_NEST, .nest = &ovs_flow_key_attrs_nest, };
+	arr[OVS_ACTION_ATTR_CT] = { .name = "ct", .type = YNL_PT_NEST, .nest = &ovs_flow_ct_attrs_nest, };
+	arr[OVS_ACTION_ATTR_TRUNC] = { .name = "trunc", .type = YNL_PT_U32, };
+	arr[OVS_ACTION_ATTR_PUSH_ETH] = { .name = "push-eth", .type = YNL_PT_BINARY,};
+	arr[OVS_ACTION_ATTR_POP_ETH] = { .name = "pop-eth", .type = YNL_PT_FLAG, };
+	arr[OVS_ACTION_ATTR_CT_CLEAR] = { .name = "ct-clear", .type = YNL_PT_FLAG, };
+	arr[OVS_ACTION_ATTR_PUSH_NSH] = { .name = "push-nsh", .type = YNL_PT_NEST, .nest = &ovs_flow_ovs_nsh_key_attrs_nest, };
+	arr[OVS_ACTION_ATTR_POP_NSH] = { .name = "pop-nsh", .type = YNL_PT_FLAG, };
+	arr[OVS_ACTION_ATTR_METER] = { .name = "meter", .type = YNL_PT_U32, };
+	arr[OVS_ACTION_ATTR_CLONE] = { .name = "clone", .type = YNL_PT_NEST, .nest = &ovs_flow_action_attrs_nest, };
+	arr[OVS_ACTION_ATTR_CHECK_PKT_LEN] = { .name = "check-pkt-len", .type = YNL_PT_NEST, .nest = &ovs_flow_check_pkt_len_attrs_nest, };
+	arr[OVS_ACTION_ATTR_ADD_MPLS] = { .name = "add-mpls", .type = YNL_PT_BINARY,};
+	arr[OVS_ACTION_ATTR_DEC_TTL] = { .name = "dec-ttl", .type = YNL_PT_NEST, .nest = &ovs_flow_dec_ttl_attrs_nest, };
+	arr[OVS_ACTION_ATTR_PSAMPLE] = { .name = "psample", .type = YNL_PT_NEST, .nest = &ovs_flow_psample_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_action_attrs_nest = {
+	.max_attr = OVS_ACTION_ATTR_MAX,
+	.table = ovs_flow_action_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_FLOW_ATTR_MAX + 1> ovs_flow_flow_attrs_policy = []() {
+	std::array<ynl_policy_attr,OVS_FLOW_ATTR_MAX + 1> arr{};
+	arr[OVS_FLOW_ATTR_KEY] = { .name = "key", .type = YNL_PT_NEST, .nest = &ovs_flow_key_attrs_nest, };
+	arr[OVS_FLOW_ATTR_ACTIONS] = { .name = "actions", .type = YNL_PT_NEST, .nest = &ovs_flow_action_attrs_nest, };
+	arr[OVS_FLOW_ATTR_STATS] = { .name = "stats", .type = YNL_PT_BINARY,};
+	arr[OVS_FLOW_ATTR_TCP_FLAGS] = { .name = "tcp-flags", .type = YNL_PT_U8, };
+	arr[OVS_FLOW_ATTR_USED] = { .name = "used", .type = YNL_PT_U64, };
+	arr[OVS_FLOW_ATTR_CLEAR] = { .name = "clear", .type = YNL_PT_FLAG, };
+	arr[OVS_FLOW_ATTR_MASK] = { .name = "mask", .type = YNL_PT_NEST, .nest = &ovs_flow_key_attrs_nest, };
+	arr[OVS_FLOW_ATTR_PROBE] = { .name = "probe", .type = YNL_PT_BINARY,};
+	arr[OVS_FLOW_ATTR_UFID] = { .name = "ufid", .type = YNL_PT_BINARY,};
+	arr[OVS_FLOW_ATTR_UFID_FLAGS] = { .name = "ufid-flags", .type = YNL_PT_U32, };
+	arr[OVS_FLOW_ATTR_PAD] = { .name = "pad", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_flow_flow_attrs_nest = {
+	.max_attr = OVS_FLOW_ATTR_MAX,
+	.table = ovs_flow_flow_attrs_policy.data(),
+};
+
+/* Common nested types */
+int ovs_flow_ovs_nsh_key_attrs_put(struct nlmsghdr *nlh,
+				   unsigned int attr_type,
+				   const ovs_flow_ovs_nsh_key_attrs&  obj);
+int ovs_flow_ovs_nsh_key_attrs_parse(struct ynl_parse_arg *yarg,
+				     const struct nlattr *nested);
+int ovs_flow_userspace_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				 const ovs_flow_userspace_attrs&  obj);
+int ovs_flow_userspace_attrs_parse(struct ynl_parse_arg *yarg,
+				   const struct nlattr *nested);
+int ovs_flow_psample_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const ovs_flow_psample_attrs&  obj);
+int ovs_flow_psample_attrs_parse(struct ynl_parse_arg *yarg,
+				 const struct nlattr *nested);
+int ovs_flow_vxlan_ext_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				 const ovs_flow_vxlan_ext_attrs&  obj);
+int ovs_flow_vxlan_ext_attrs_parse(struct ynl_parse_arg *yarg,
+				   const struct nlattr *nested);
+int ovs_flow_nat_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			   const ovs_flow_nat_attrs&  obj);
+int ovs_flow_nat_attrs_parse(struct ynl_parse_arg *yarg,
+			     const struct nlattr *nested);
+int ovs_flow_tunnel_key_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				  const ovs_flow_tunnel_key_attrs&  obj);
+int ovs_flow_tunnel_key_attrs_parse(struct ynl_parse_arg *yarg,
+				    const struct nlattr *nested);
+int ovs_flow_ct_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			  const ovs_flow_ct_attrs&  obj);
+int ovs_flow_ct_attrs_parse(struct ynl_parse_arg *yarg,
+			    const struct nlattr *nested);
+int ovs_flow_key_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			   const ovs_flow_key_attrs&  obj);
+int ovs_flow_key_attrs_parse(struct ynl_parse_arg *yarg,
+			     const struct nlattr *nested);
+int ovs_flow_sample_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			      const ovs_flow_sample_attrs&  obj);
+int ovs_flow_sample_attrs_parse(struct ynl_parse_arg *yarg,
+				const struct nlattr *nested);
+int ovs_flow_check_pkt_len_attrs_put(struct nlmsghdr *nlh,
+				     unsigned int attr_type,
+				     const ovs_flow_check_pkt_len_attrs&  obj);
+int ovs_flow_check_pkt_len_attrs_parse(struct ynl_parse_arg *yarg,
+				       const struct nlattr *nested);
+int ovs_flow_dec_ttl_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const ovs_flow_dec_ttl_attrs&  obj);
+int ovs_flow_dec_ttl_attrs_parse(struct ynl_parse_arg *yarg,
+				 const struct nlattr *nested);
+int ovs_flow_action_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			      const ovs_flow_action_attrs&  obj);
+int ovs_flow_action_attrs_parse(struct ynl_parse_arg *yarg,
+				const struct nlattr *nested);
+
+int ovs_flow_ovs_nsh_key_attrs_put(struct nlmsghdr *nlh,
+				   unsigned int attr_type,
+				   const ovs_flow_ovs_nsh_key_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.base.size() > 0)
+		ynl_attr_put(nlh, OVS_NSH_KEY_ATTR_BASE, obj.base.data(), obj.base.size());
+	if (obj.md1.size() > 0)
+		ynl_attr_put(nlh, OVS_NSH_KEY_ATTR_MD1, obj.md1.data(), obj.md1.size());
+	if (obj.md2.size() > 0)
+		ynl_attr_put(nlh, OVS_NSH_KEY_ATTR_MD2, obj.md2.data(), obj.md2.size());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_ovs_nsh_key_attrs_parse(struct ynl_parse_arg *yarg,
+				     const struct nlattr *nested)
+{
+	ovs_flow_ovs_nsh_key_attrs *dst = (ovs_flow_ovs_nsh_key_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_NSH_KEY_ATTR_BASE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->base.assign(data, data + len);
+		} else if (type == OVS_NSH_KEY_ATTR_MD1) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->md1.assign(data, data + len);
+		} else if (type == OVS_NSH_KEY_ATTR_MD2) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->md2.assign(data, data + len);
+		}
+	}
+
+	return 0;
+}
+
+int ovs_flow_userspace_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				 const ovs_flow_userspace_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.pid.has_value())
+		ynl_attr_put_u32(nlh, OVS_USERSPACE_ATTR_PID, obj.pid.value());
+	if (obj.userdata.size() > 0)
+		ynl_attr_put(nlh, OVS_USERSPACE_ATTR_USERDATA, obj.userdata.data(), obj.userdata.size());
+	if (obj.egress_tun_port.has_value())
+		ynl_attr_put_u32(nlh, OVS_USERSPACE_ATTR_EGRESS_TUN_PORT, obj.egress_tun_port.value());
+	if (obj.actions)
+		ynl_attr_put(nlh, OVS_USERSPACE_ATTR_ACTIONS, NULL, 0);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_userspace_attrs_parse(struct ynl_parse_arg *yarg,
+				   const struct nlattr *nested)
+{
+	ovs_flow_userspace_attrs *dst = (ovs_flow_userspace_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_USERSPACE_ATTR_PID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->pid = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_USERSPACE_ATTR_USERDATA) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->userdata.assign(data, data + len);
+		} else if (type == OVS_USERSPACE_ATTR_EGRESS_TUN_PORT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->egress_tun_port = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_USERSPACE_ATTR_ACTIONS) {
+			dst->actions = true;
+		}
+	}
+
+	return 0;
+}
+
+int ovs_flow_psample_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const ovs_flow_psample_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.group.has_value())
+		ynl_attr_put_u32(nlh, OVS_PSAMPLE_ATTR_GROUP, obj.group.value());
+	if (obj.cookie.size() > 0)
+		ynl_attr_put(nlh, OVS_PSAMPLE_ATTR_COOKIE, obj.cookie.data(), obj.cookie.size());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_psample_attrs_parse(struct ynl_parse_arg *yarg,
+				 const struct nlattr *nested)
+{
+	ovs_flow_psample_attrs *dst = (ovs_flow_psample_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_PSAMPLE_ATTR_GROUP) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->group = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_PSAMPLE_ATTR_COOKIE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->cookie.assign(data, data + len);
+		}
+	}
+
+	return 0;
+}
+
+int ovs_flow_vxlan_ext_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				 const ovs_flow_vxlan_ext_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.gbp.has_value())
+		ynl_attr_put_u32(nlh, OVS_VXLAN_EXT_GBP, obj.gbp.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_vxlan_ext_attrs_parse(struct ynl_parse_arg *yarg,
+				   const struct nlattr *nested)
+{
+	ovs_flow_vxlan_ext_attrs *dst = (ovs_flow_vxlan_ext_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_VXLAN_EXT_GBP) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->gbp = (__u32)ynl_attr_get_u32(attr);
+		}
+	}
+
+	return 0;
+}
+
+int ovs_flow_nat_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			   const ovs_flow_nat_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.src)
+		ynl_attr_put(nlh, OVS_NAT_ATTR_SRC, NULL, 0);
+	if (obj.dst)
+		ynl_attr_put(nlh, OVS_NAT_ATTR_DST, NULL, 0);
+	if (obj.ip_min.size() > 0)
+		ynl_attr_put(nlh, OVS_NAT_ATTR_IP_MIN, obj.ip_min.data(), obj.ip_min.size());
+	if (obj.ip_max.size() > 0)
+		ynl_attr_put(nlh, OVS_NAT_ATTR_IP_MAX, obj.ip_max.data(), obj.ip_max.size());
+	if (obj.proto_min.has_value())
+		ynl_attr_put_u16(nlh, OVS_NAT_ATTR_PROTO_MIN, obj.proto_min.value());
+	if (obj.proto_max.has_value())
+		ynl_attr_put_u16(nlh, OVS_NAT_ATTR_PROTO_MAX, obj.proto_max.value());
+	if (obj.persistent)
+		ynl_attr_put(nlh, OVS_NAT_ATTR_PERSISTENT, NULL, 0);
+	if (obj.proto_hash)
+		ynl_attr_put(nlh, OVS_NAT_ATTR_PROTO_HASH, NULL, 0);
+	if (obj.proto_random)
+		ynl_attr_put(nlh, OVS_NAT_ATTR_PROTO_RANDOM, NULL, 0);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_nat_attrs_parse(struct ynl_parse_arg *yarg,
+			     const struct nlattr *nested)
+{
+	ovs_flow_nat_attrs *dst = (ovs_flow_nat_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_NAT_ATTR_SRC) {
+			dst->src = true;
+		} else if (type == OVS_NAT_ATTR_DST) {
+			dst->dst = true;
+		} else if (type == OVS_NAT_ATTR_IP_MIN) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ip_min.assign(data, data + len);
+		} else if (type == OVS_NAT_ATTR_IP_MAX) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ip_max.assign(data, data + len);
+		} else if (type == OVS_NAT_ATTR_PROTO_MIN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->proto_min = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == OVS_NAT_ATTR_PROTO_MAX) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->proto_max = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == OVS_NAT_ATTR_PERSISTENT) {
+			dst->persistent = true;
+		} else if (type == OVS_NAT_ATTR_PROTO_HASH) {
+			dst->proto_hash = true;
+		} else if (type == OVS_NAT_ATTR_PROTO_RANDOM) {
+			dst->proto_random = true;
+		}
+	}
+
+	return 0;
+}
+
+int ovs_flow_tunnel_key_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				  const ovs_flow_tunnel_key_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.id.has_value())
+		ynl_attr_put_u64(nlh, OVS_TUNNEL_KEY_ATTR_ID, obj.id.value());
+	if (obj.ipv4_src.has_value())
+		ynl_attr_put_u32(nlh, OVS_TUNNEL_KEY_ATTR_IPV4_SRC, obj.ipv4_src.value());
+	if (obj.ipv4_dst.has_value())
+		ynl_attr_put_u32(nlh, OVS_TUNNEL_KEY_ATTR_IPV4_DST, obj.ipv4_dst.value());
+	if (obj.tos.has_value())
+		ynl_attr_put_u8(nlh, OVS_TUNNEL_KEY_ATTR_TOS, obj.tos.value());
+	if (obj.ttl.has_value())
+		ynl_attr_put_u8(nlh, OVS_TUNNEL_KEY_ATTR_TTL, obj.ttl.value());
+	if (obj.dont_fragment)
+		ynl_attr_put(nlh, OVS_TUNNEL_KEY_ATTR_DONT_FRAGMENT, NULL, 0);
+	if (obj.csum)
+		ynl_attr_put(nlh, OVS_TUNNEL_KEY_ATTR_CSUM, NULL, 0);
+	if (obj.oam)
+		ynl_attr_put(nlh, OVS_TUNNEL_KEY_ATTR_OAM, NULL, 0);
+	if (obj.geneve_opts.size() > 0)
+		ynl_attr_put(nlh, OVS_TUNNEL_KEY_ATTR_GENEVE_OPTS, obj.geneve_opts.data(), obj.geneve_opts.size());
+	if (obj.tp_src.has_value())
+		ynl_attr_put_u16(nlh, OVS_TUNNEL_KEY_ATTR_TP_SRC, obj.tp_src.value());
+	if (obj.tp_dst.has_value())
+		ynl_attr_put_u16(nlh, OVS_TUNNEL_KEY_ATTR_TP_DST, obj.tp_dst.value());
+	if (obj.vxlan_opts.has_value())
+		ovs_flow_vxlan_ext_attrs_put(nlh, OVS_TUNNEL_KEY_ATTR_VXLAN_OPTS, obj.vxlan_opts.value());
+	if (obj.ipv6_src.size() > 0)
+		ynl_attr_put(nlh, OVS_TUNNEL_KEY_ATTR_IPV6_SRC, obj.ipv6_src.data(), obj.ipv6_src.size());
+	if (obj.ipv6_dst.size() > 0)
+		ynl_attr_put(nlh, OVS_TUNNEL_KEY_ATTR_IPV6_DST, obj.ipv6_dst.data(), obj.ipv6_dst.size());
+	if (obj.pad.size() > 0)
+		ynl_attr_put(nlh, OVS_TUNNEL_KEY_ATTR_PAD, obj.pad.data(), obj.pad.size());
+	if (obj.erspan_opts.size() > 0)
+		ynl_attr_put(nlh, OVS_TUNNEL_KEY_ATTR_ERSPAN_OPTS, obj.erspan_opts.data(), obj.erspan_opts.size());
+	if (obj.ipv4_info_bridge)
+		ynl_attr_put(nlh, OVS_TUNNEL_KEY_ATTR_IPV4_INFO_BRIDGE, NULL, 0);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_tunnel_key_attrs_parse(struct ynl_parse_arg *yarg,
+				    const struct nlattr *nested)
+{
+	ovs_flow_tunnel_key_attrs *dst = (ovs_flow_tunnel_key_attrs *)yarg->data;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+
+	parg.ys = yarg->ys;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_TUNNEL_KEY_ATTR_ID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->id = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_IPV4_SRC) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ipv4_src = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_IPV4_DST) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ipv4_dst = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_TOS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->tos = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_TTL) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->ttl = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_DONT_FRAGMENT) {
+			dst->dont_fragment = true;
+		} else if (type == OVS_TUNNEL_KEY_ATTR_CSUM) {
+			dst->csum = true;
+		} else if (type == OVS_TUNNEL_KEY_ATTR_OAM) {
+			dst->oam = true;
+		} else if (type == OVS_TUNNEL_KEY_ATTR_GENEVE_OPTS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->geneve_opts.assign(data, data + len);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_TP_SRC) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->tp_src = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_TP_DST) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->tp_dst = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_VXLAN_OPTS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_vxlan_ext_attrs_nest;
+			parg.data = &dst->vxlan_opts.emplace();
+			if (ovs_flow_vxlan_ext_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_TUNNEL_KEY_ATTR_IPV6_SRC) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ipv6_src.assign(data, data + len);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_IPV6_DST) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ipv6_dst.assign(data, data + len);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_PAD) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->pad.assign(data, data + len);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_ERSPAN_OPTS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->erspan_opts.assign(data, data + len);
+		} else if (type == OVS_TUNNEL_KEY_ATTR_IPV4_INFO_BRIDGE) {
+			dst->ipv4_info_bridge = true;
+		}
+	}
+
+	return 0;
+}
+
+int ovs_flow_ct_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			  const ovs_flow_ct_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.commit)
+		ynl_attr_put(nlh, OVS_CT_ATTR_COMMIT, NULL, 0);
+	if (obj.zone.has_value())
+		ynl_attr_put_u16(nlh, OVS_CT_ATTR_ZONE, obj.zone.value());
+	if (obj.mark.size() > 0)
+		ynl_attr_put(nlh, OVS_CT_ATTR_MARK, obj.mark.data(), obj.mark.size());
+	if (obj.labels.size() > 0)
+		ynl_attr_put(nlh, OVS_CT_ATTR_LABELS, obj.labels.data(), obj.labels.size());
+	if (obj.helper.size() > 0)
+		ynl_attr_put_str(nlh, OVS_CT_ATTR_HELPER, obj.helper.data());
+	if (obj.nat.has_value())
+		ovs_flow_nat_attrs_put(nlh, OVS_CT_ATTR_NAT, obj.nat.value());
+	if (obj.force_commit)
+		ynl_attr_put(nlh, OVS_CT_ATTR_FORCE_COMMIT, NULL, 0);
+	if (obj.eventmask.has_value())
+		ynl_attr_put_u32(nlh, OVS_CT_ATTR_EVENTMASK, obj.eventmask.value());
+	if (obj.timeout.size() > 0)
+		ynl_attr_put_str(nlh, OVS_CT_ATTR_TIMEOUT, obj.timeout.data());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_ct_attrs_parse(struct ynl_parse_arg *yarg,
+			    const struct nlattr *nested)
+{
+	ovs_flow_ct_attrs *dst = (ovs_flow_ct_attrs *)yarg->data;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+
+	parg.ys = yarg->ys;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_CT_ATTR_COMMIT) {
+			dst->commit = true;
+		} else if (type == OVS_CT_ATTR_ZONE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->zone = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == OVS_CT_ATTR_MARK) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->mark.assign(data, data + len);
+		} else if (type == OVS_CT_ATTR_LABELS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->labels.assign(data, data + len);
+		} else if (type == OVS_CT_ATTR_HELPER) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->helper.assign(ynl_attr_get_str(attr));
+		} else if (type == OVS_CT_ATTR_NAT) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_nat_attrs_nest;
+			parg.data = &dst->nat.emplace();
+			if (ovs_flow_nat_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_CT_ATTR_FORCE_COMMIT) {
+			dst->force_commit = true;
+		} else if (type == OVS_CT_ATTR_EVENTMASK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->eventmask = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_CT_ATTR_TIMEOUT) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->timeout.assign(ynl_attr_get_str(attr));
+		}
+	}
+
+	return 0;
+}
+
+int ovs_flow_key_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			   const ovs_flow_key_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.encap.size() > 0)
+		ovs_flow_key_attrs_put(nlh, OVS_KEY_ATTR_ENCAP, obj.encap[0]);
+	if (obj.priority.has_value())
+		ynl_attr_put_u32(nlh, OVS_KEY_ATTR_PRIORITY, obj.priority.value());
+	if (obj.in_port.has_value())
+		ynl_attr_put_u32(nlh, OVS_KEY_ATTR_IN_PORT, obj.in_port.value());
+	if (obj.ethernet.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_ETHERNET, obj.ethernet.data(), obj.ethernet.size());
+	if (obj.vlan.has_value())
+		ynl_attr_put_u16(nlh, OVS_KEY_ATTR_VLAN, obj.vlan.value());
+	if (obj.ethertype.has_value())
+		ynl_attr_put_u16(nlh, OVS_KEY_ATTR_ETHERTYPE, obj.ethertype.value());
+	if (obj.ipv4.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_IPV4, obj.ipv4.data(), obj.ipv4.size());
+	if (obj.ipv6.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_IPV6, obj.ipv6.data(), obj.ipv6.size());
+	if (obj.tcp.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_TCP, obj.tcp.data(), obj.tcp.size());
+	if (obj.udp.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_UDP, obj.udp.data(), obj.udp.size());
+	if (obj.icmp.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_ICMP, obj.icmp.data(), obj.icmp.size());
+	if (obj.icmpv6.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_ICMPV6, obj.icmpv6.data(), obj.icmpv6.size());
+	if (obj.arp.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_ARP, obj.arp.data(), obj.arp.size());
+	if (obj.nd.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_ND, obj.nd.data(), obj.nd.size());
+	if (obj.skb_mark.has_value())
+		ynl_attr_put_u32(nlh, OVS_KEY_ATTR_SKB_MARK, obj.skb_mark.value());
+	if (obj.tunnel.has_value())
+		ovs_flow_tunnel_key_attrs_put(nlh, OVS_KEY_ATTR_TUNNEL, obj.tunnel.value());
+	if (obj.sctp.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_SCTP, obj.sctp.data(), obj.sctp.size());
+	if (obj.tcp_flags.has_value())
+		ynl_attr_put_u16(nlh, OVS_KEY_ATTR_TCP_FLAGS, obj.tcp_flags.value());
+	if (obj.dp_hash.has_value())
+		ynl_attr_put_u32(nlh, OVS_KEY_ATTR_DP_HASH, obj.dp_hash.value());
+	if (obj.recirc_id.has_value())
+		ynl_attr_put_u32(nlh, OVS_KEY_ATTR_RECIRC_ID, obj.recirc_id.value());
+	if (obj.mpls.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_MPLS, obj.mpls.data(), obj.mpls.size());
+	if (obj.ct_state.has_value())
+		ynl_attr_put_u32(nlh, OVS_KEY_ATTR_CT_STATE, obj.ct_state.value());
+	if (obj.ct_zone.has_value())
+		ynl_attr_put_u16(nlh, OVS_KEY_ATTR_CT_ZONE, obj.ct_zone.value());
+	if (obj.ct_mark.has_value())
+		ynl_attr_put_u32(nlh, OVS_KEY_ATTR_CT_MARK, obj.ct_mark.value());
+	if (obj.ct_labels.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_CT_LABELS, obj.ct_labels.data(), obj.ct_labels.size());
+	if (obj.ct_orig_tuple_ipv4.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_CT_ORIG_TUPLE_IPV4, obj.ct_orig_tuple_ipv4.data(), obj.ct_orig_tuple_ipv4.size());
+	if (obj.ct_orig_tuple_ipv6.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_CT_ORIG_TUPLE_IPV6, obj.ct_orig_tuple_ipv6.data(), obj.ct_orig_tuple_ipv6.size());
+	if (obj.nsh.has_value())
+		ovs_flow_ovs_nsh_key_attrs_put(nlh, OVS_KEY_ATTR_NSH, obj.nsh.value());
+	if (obj.packet_type.has_value())
+		ynl_attr_put_u32(nlh, OVS_KEY_ATTR_PACKET_TYPE, obj.packet_type.value());
+	if (obj.nd_extensions.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_ND_EXTENSIONS, obj.nd_extensions.data(), obj.nd_extensions.size());
+	if (obj.tunnel_info.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_TUNNEL_INFO, obj.tunnel_info.data(), obj.tunnel_info.size());
+	if (obj.ipv6_exthdrs.size() > 0)
+		ynl_attr_put(nlh, OVS_KEY_ATTR_IPV6_EXTHDRS, obj.ipv6_exthdrs.data(), obj.ipv6_exthdrs.size());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_key_attrs_parse(struct ynl_parse_arg *yarg,
+			     const struct nlattr *nested)
+{
+	ovs_flow_key_attrs *dst = (ovs_flow_key_attrs *)yarg->data;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+
+	parg.ys = yarg->ys;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_KEY_ATTR_ENCAP) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_key_attrs_nest;
+			dst->encap.resize(1);
+			parg.data = dst->encap.data();
+			if (ovs_flow_key_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_KEY_ATTR_PRIORITY) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->priority = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_KEY_ATTR_IN_PORT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->in_port = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_KEY_ATTR_ETHERNET) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ethernet.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_VLAN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->vlan = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == OVS_KEY_ATTR_ETHERTYPE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->ethertype = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == OVS_KEY_ATTR_IPV4) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ipv4.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_IPV6) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ipv6.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_TCP) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->tcp.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_UDP) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->udp.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_ICMP) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->icmp.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_ICMPV6) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->icmpv6.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_ARP) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->arp.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_ND) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->nd.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_SKB_MARK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->skb_mark = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_KEY_ATTR_TUNNEL) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_tunnel_key_attrs_nest;
+			parg.data = &dst->tunnel.emplace();
+			if (ovs_flow_tunnel_key_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_KEY_ATTR_SCTP) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->sctp.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_TCP_FLAGS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->tcp_flags = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == OVS_KEY_ATTR_DP_HASH) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->dp_hash = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_KEY_ATTR_RECIRC_ID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->recirc_id = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_KEY_ATTR_MPLS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->mpls.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_CT_STATE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ct_state = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_KEY_ATTR_CT_ZONE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->ct_zone = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == OVS_KEY_ATTR_CT_MARK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ct_mark = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_KEY_ATTR_CT_LABELS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ct_labels.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_CT_ORIG_TUPLE_IPV4) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ct_orig_tuple_ipv4.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_CT_ORIG_TUPLE_IPV6) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ct_orig_tuple_ipv6.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_NSH) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_ovs_nsh_key_attrs_nest;
+			parg.data = &dst->nsh.emplace();
+			if (ovs_flow_ovs_nsh_key_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_KEY_ATTR_PACKET_TYPE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->packet_type = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_KEY_ATTR_ND_EXTENSIONS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->nd_extensions.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_TUNNEL_INFO) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->tunnel_info.assign(data, data + len);
+		} else if (type == OVS_KEY_ATTR_IPV6_EXTHDRS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ipv6_exthdrs.assign(data, data + len);
+		}
+	}
+
+	return 0;
+}
+
+int ovs_flow_sample_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			      const ovs_flow_sample_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.probability.has_value())
+		ynl_attr_put_u32(nlh, OVS_SAMPLE_ATTR_PROBABILITY, obj.probability.value());
+	if (obj.actions.size() > 0)
+		ovs_flow_action_attrs_put(nlh, OVS_SAMPLE_ATTR_ACTIONS, obj.actions[0]);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_sample_attrs_parse(struct ynl_parse_arg *yarg,
+				const struct nlattr *nested)
+{
+	ovs_flow_sample_attrs *dst = (ovs_flow_sample_attrs *)yarg->data;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+
+	parg.ys = yarg->ys;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_SAMPLE_ATTR_PROBABILITY) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->probability = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_SAMPLE_ATTR_ACTIONS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_action_attrs_nest;
+			dst->actions.resize(1);
+			parg.data = dst->actions.data();
+			if (ovs_flow_action_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		}
+	}
+
+	return 0;
+}
+
+int ovs_flow_check_pkt_len_attrs_put(struct nlmsghdr *nlh,
+				     unsigned int attr_type,
+				     const ovs_flow_check_pkt_len_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.pkt_len.has_value())
+		ynl_attr_put_u16(nlh, OVS_CHECK_PKT_LEN_ATTR_PKT_LEN, obj.pkt_len.value());
+	if (obj.actions_if_greater.size() > 0)
+		ovs_flow_action_attrs_put(nlh, OVS_CHECK_PKT_LEN_ATTR_ACTIONS_IF_GREATER, obj.actions_if_greater[0]);
+	if (obj.actions_if_less_equal.size() > 0)
+		ovs_flow_action_attrs_put(nlh, OVS_CHECK_PKT_LEN_ATTR_ACTIONS_IF_LESS_EQUAL, obj.actions_if_less_equal[0]);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_check_pkt_len_attrs_parse(struct ynl_parse_arg *yarg,
+				       const struct nlattr *nested)
+{
+	ovs_flow_check_pkt_len_attrs *dst = (ovs_flow_check_pkt_len_attrs *)yarg->data;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+
+	parg.ys = yarg->ys;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_CHECK_PKT_LEN_ATTR_PKT_LEN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->pkt_len = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == OVS_CHECK_PKT_LEN_ATTR_ACTIONS_IF_GREATER) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_action_attrs_nest;
+			dst->actions_if_greater.resize(1);
+			parg.data = dst->actions_if_greater.data();
+			if (ovs_flow_action_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_CHECK_PKT_LEN_ATTR_ACTIONS_IF_LESS_EQUAL) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_action_attrs_nest;
+			dst->actions_if_less_equal.resize(1);
+			parg.data = dst->actions_if_less_equal.data();
+			if (ovs_flow_action_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		}
+	}
+
+	return 0;
+}
+
+int ovs_flow_dec_ttl_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const ovs_flow_dec_ttl_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.action.size() > 0)
+		ovs_flow_action_attrs_put(nlh, OVS_DEC_TTL_ATTR_ACTION, obj.action[0]);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_dec_ttl_attrs_parse(struct ynl_parse_arg *yarg,
+				 const struct nlattr *nested)
+{
+	ovs_flow_dec_ttl_attrs *dst = (ovs_flow_dec_ttl_attrs *)yarg->data;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+
+	parg.ys = yarg->ys;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_DEC_TTL_ATTR_ACTION) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_action_attrs_nest;
+			dst->action.resize(1);
+			parg.data = dst->action.data();
+			if (ovs_flow_action_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		}
+	}
+
+	return 0;
+}
+
+int ovs_flow_action_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			      const ovs_flow_action_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.output.has_value())
+		ynl_attr_put_u32(nlh, OVS_ACTION_ATTR_OUTPUT, obj.output.value());
+	if (obj.userspace.has_value())
+		ovs_flow_userspace_attrs_put(nlh, OVS_ACTION_ATTR_USERSPACE, obj.userspace.value());
+	if (obj.set.size() > 0)
+		ovs_flow_key_attrs_put(nlh, OVS_ACTION_ATTR_SET, obj.set[0]);
+	if (obj.push_vlan.size() > 0)
+		ynl_attr_put(nlh, OVS_ACTION_ATTR_PUSH_VLAN, obj.push_vlan.data(), obj.push_vlan.size());
+	if (obj.pop_vlan)
+		ynl_attr_put(nlh, OVS_ACTION_ATTR_POP_VLAN, NULL, 0);
+	if (obj.sample.has_value())
+		ovs_flow_sample_attrs_put(nlh, OVS_ACTION_ATTR_SAMPLE, obj.sample.value());
+	if (obj.recirc.has_value())
+		ynl_attr_put_u32(nlh, OVS_ACTION_ATTR_RECIRC, obj.recirc.value());
+	if (obj.hash.size() > 0)
+		ynl_attr_put(nlh, OVS_ACTION_ATTR_HASH, obj.hash.data(), obj.hash.size());
+	if (obj.push_mpls.size() > 0)
+		ynl_attr_put(nlh, OVS_ACTION_ATTR_PUSH_MPLS, obj.push_mpls.data(), obj.push_mpls.size());
+	if (obj.pop_mpls.has_value())
+		ynl_attr_put_u16(nlh, OVS_ACTION_ATTR_POP_MPLS, obj.pop_mpls.value());
+	if (obj.set_masked.size() > 0)
+		ovs_flow_key_attrs_put(nlh, OVS_ACTION_ATTR_SET_MASKED, obj.set_masked[0]);
+	if (obj.ct.has_value())
+		ovs_flow_ct_attrs_put(nlh, OVS_ACTION_ATTR_CT, obj.ct.value());
+	if (obj.trunc.has_value())
+		ynl_attr_put_u32(nlh, OVS_ACTION_ATTR_TRUNC, obj.trunc.value());
+	if (obj.push_eth.size() > 0)
+		ynl_attr_put(nlh, OVS_ACTION_ATTR_PUSH_ETH, obj.push_eth.data(), obj.push_eth.size());
+	if (obj.pop_eth)
+		ynl_attr_put(nlh, OVS_ACTION_ATTR_POP_ETH, NULL, 0);
+	if (obj.ct_clear)
+		ynl_attr_put(nlh, OVS_ACTION_ATTR_CT_CLEAR, NULL, 0);
+	if (obj.push_nsh.has_value())
+		ovs_flow_ovs_nsh_key_attrs_put(nlh, OVS_ACTION_ATTR_PUSH_NSH, obj.push_nsh.value());
+	if (obj.pop_nsh)
+		ynl_attr_put(nlh, OVS_ACTION_ATTR_POP_NSH, NULL, 0);
+	if (obj.meter.has_value())
+		ynl_attr_put_u32(nlh, OVS_ACTION_ATTR_METER, obj.meter.value());
+	if (obj.clone.size() > 0)
+		ovs_flow_action_attrs_put(nlh, OVS_ACTION_ATTR_CLONE, obj.clone[0]);
+	if (obj.check_pkt_len.has_value())
+		ovs_flow_check_pkt_len_attrs_put(nlh, OVS_ACTION_ATTR_CHECK_PKT_LEN, obj.check_pkt_len.value());
+	if (obj.add_mpls.size() > 0)
+		ynl_attr_put(nlh, OVS_ACTION_ATTR_ADD_MPLS, obj.add_mpls.data(), obj.add_mpls.size());
+	if (obj.dec_ttl.has_value())
+		ovs_flow_dec_ttl_attrs_put(nlh, OVS_ACTION_ATTR_DEC_TTL, obj.dec_ttl.value());
+	if (obj.psample.has_value())
+		ovs_flow_psample_attrs_put(nlh, OVS_ACTION_ATTR_PSAMPLE, obj.psample.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_flow_action_attrs_parse(struct ynl_parse_arg *yarg,
+				const struct nlattr *nested)
+{
+	ovs_flow_action_attrs *dst = (ovs_flow_action_attrs *)yarg->data;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+
+	parg.ys = yarg->ys;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_ACTION_ATTR_OUTPUT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->output = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_ACTION_ATTR_USERSPACE) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_userspace_attrs_nest;
+			parg.data = &dst->userspace.emplace();
+			if (ovs_flow_userspace_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_ACTION_ATTR_SET) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_key_attrs_nest;
+			dst->set.resize(1);
+			parg.data = dst->set.data();
+			if (ovs_flow_key_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_ACTION_ATTR_PUSH_VLAN) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->push_vlan.assign(data, data + len);
+		} else if (type == OVS_ACTION_ATTR_POP_VLAN) {
+			dst->pop_vlan = true;
+		} else if (type == OVS_ACTION_ATTR_SAMPLE) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_sample_attrs_nest;
+			parg.data = &dst->sample.emplace();
+			if (ovs_flow_sample_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_ACTION_ATTR_RECIRC) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->recirc = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_ACTION_ATTR_HASH) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->hash.assign(data, data + len);
+		} else if (type == OVS_ACTION_ATTR_PUSH_MPLS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->push_mpls.assign(data, data + len);
+		} else if (type == OVS_ACTION_ATTR_POP_MPLS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->pop_mpls = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == OVS_ACTION_ATTR_SET_MASKED) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_key_attrs_nest;
+			dst->set_masked.resize(1);
+			parg.data = dst->set_masked.data();
+			if (ovs_flow_key_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_ACTION_ATTR_CT) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_ct_attrs_nest;
+			parg.data = &dst->ct.emplace();
+			if (ovs_flow_ct_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_ACTION_ATTR_TRUNC) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->trunc = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_ACTION_ATTR_PUSH_ETH) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->push_eth.assign(data, data + len);
+		} else if (type == OVS_ACTION_ATTR_POP_ETH) {
+			dst->pop_eth = true;
+		} else if (type == OVS_ACTION_ATTR_CT_CLEAR) {
+			dst->ct_clear = true;
+		} else if (type == OVS_ACTION_ATTR_PUSH_NSH) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_ovs_nsh_key_attrs_nest;
+			parg.data = &dst->push_nsh.emplace();
+			if (ovs_flow_ovs_nsh_key_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_ACTION_ATTR_POP_NSH) {
+			dst->pop_nsh = true;
+		} else if (type == OVS_ACTION_ATTR_METER) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->meter = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_ACTION_ATTR_CLONE) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_action_attrs_nest;
+			dst->clone.resize(1);
+			parg.data = dst->clone.data();
+			if (ovs_flow_action_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_ACTION_ATTR_CHECK_PKT_LEN) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_check_pkt_len_attrs_nest;
+			parg.data = &dst->check_pkt_len.emplace();
+			if (ovs_flow_check_pkt_len_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_ACTION_ATTR_ADD_MPLS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->add_mpls.assign(data, data + len);
+		} else if (type == OVS_ACTION_ATTR_DEC_TTL) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_dec_ttl_attrs_nest;
+			parg.data = &dst->dec_ttl.emplace();
+			if (ovs_flow_dec_ttl_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_ACTION_ATTR_PSAMPLE) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_psample_attrs_nest;
+			parg.data = &dst->psample.emplace();
+			if (ovs_flow_psample_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		}
+	}
+
+	return 0;
+}
+
+/* ============== OVS_FLOW_CMD_GET ============== */
+/* OVS_FLOW_CMD_GET - do */
+int ovs_flow_get_rsp_parse(const struct nlmsghdr *nlh,
+			   struct ynl_parse_arg *yarg)
+{
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	ovs_flow_get_rsp *dst;
+	void *hdr;
+
+	dst = (ovs_flow_get_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	hdr = ynl_nlmsg_data_offset(nlh, sizeof(struct genlmsghdr));
+	memcpy(&dst->_hdr, hdr, sizeof(struct ovs_header));
+
+	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == OVS_FLOW_ATTR_KEY) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_key_attrs_nest;
+			parg.data = &dst->key.emplace();
+			if (ovs_flow_key_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_FLOW_ATTR_UFID) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ufid.assign(data, data + len);
+		} else if (type == OVS_FLOW_ATTR_MASK) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_key_attrs_nest;
+			parg.data = &dst->mask.emplace();
+			if (ovs_flow_key_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == OVS_FLOW_ATTR_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->stats.assign(data, data + len);
+		} else if (type == OVS_FLOW_ATTR_ACTIONS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_flow_action_attrs_nest;
+			parg.data = &dst->actions.emplace();
+			if (ovs_flow_action_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void ovs_flow_get_put(struct nlmsghdr *nlh, ovs_flow_get_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + NLMSG_ALIGN(sizeof(struct ovs_header)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.ufid_flags.has_value())
+		ynl_attr_put_u32_unchecked(nlh, OVS_FLOW_ATTR_UFID_FLAGS, req.ufid_flags.value());
+	if (req.key.has_value())
+		ovs_flow_key_attrs_put(nlh, OVS_FLOW_ATTR_KEY, req.key.value());
+	if (req.ufid.size() > 0)
+		ynl_attr_put(nlh, OVS_FLOW_ATTR_UFID, req.ufid.data(), req.ufid.size());
+}
+
+static ynl_cpp::result<std::unique_ptr<ovs_flow_get_rsp>>
+ovs_flow_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		  const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<ovs_flow_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ovs_flow_flow_attrs_nest;
+	yrs.yarg.rsp_policy = &ovs_flow_flow_attrs_nest;
+
+	rsp.reset(new ovs_flow_get_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = ovs_flow_get_rsp_parse;
+	yrs.rsp_cmd = OVS_FLOW_CMD_GET;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<ovs_flow_get_rsp>>
+ovs_flow_get_ex(ynl_cpp::ynl_socket&  ys, ovs_flow_get_req& req,
+		const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_FLOW_CMD_GET, 1);
+	ovs_flow_get_put(nlh, req);
+
+	return ovs_flow_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ovs_flow_get_rsp>
+ovs_flow_get(ynl_cpp::ynl_socket&  ys, ovs_flow_get_req& req)
+{
+	auto ret = ovs_flow_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_flow_get_prepare(ynl_cpp::ynl_socket&  ys, ovs_flow_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_FLOW_CMD_GET, 1);
+	ovs_flow_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ovs_flow_get_rsp>>
+ovs_flow_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		const ynl_cpp::projection *proj)
+{
+	return ovs_flow_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ovs_flow_get_rsp>
+ovs_flow_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_flow_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* OVS_FLOW_CMD_GET - dump */
+static void
+ovs_flow_get_dump_put(struct nlmsghdr *nlh, ovs_flow_get_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + NLMSG_ALIGN(sizeof(struct ovs_header)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.ufid_flags.has_value())
+		ynl_attr_put_u32_unchecked(nlh, OVS_FLOW_ATTR_UFID_FLAGS, req.ufid_flags.value());
+	if (req.key.has_value())
+		ovs_flow_key_attrs_put(nlh, OVS_FLOW_ATTR_KEY, req.key.value());
+	if (req.ufid.size() > 0)
+		ynl_attr_put(nlh, OVS_FLOW_ATTR_UFID, req.ufid.data(), req.ufid.size());
+}
+
+static ynl_cpp::result<std::unique_ptr<ovs_flow_get_list>>
+ovs_flow_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<ovs_flow_get_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &ovs_flow_flow_attrs_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ovs_flow_get_list*>(arg)->objs.emplace_back());};
+	yds.cb = ovs_flow_get_rsp_parse;
+	yds.rsp_cmd = OVS_FLOW_CMD_GET;
+	((struct ynl_sock*)ys)->req_policy = &ovs_flow_flow_attrs_nest;
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<ovs_flow_get_list>>
+ovs_flow_get_dump_ex(ynl_cpp::ynl_socket&  ys, ovs_flow_get_req_dump& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, OVS_FLOW_CMD_GET, 1);
+	ovs_flow_get_dump_put(nlh, req);
+
+	return ovs_flow_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ovs_flow_get_list>
+ovs_flow_get_dump(ynl_cpp::ynl_socket&  ys, ovs_flow_get_req_dump& req)
+{
+	auto ret = ovs_flow_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_flow_get_dump_prepare(ynl_cpp::ynl_socket&  ys, ovs_flow_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, OVS_FLOW_CMD_GET, 1);
+	ovs_flow_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<ovs_flow_get_list>>
+ovs_flow_get_dump_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return ovs_flow_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ovs_flow_get_list>
+ovs_flow_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_flow_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== OVS_FLOW_CMD_NEW ============== */
+/* OVS_FLOW_CMD_NEW - do */
+static void ovs_flow_new_put(struct nlmsghdr *nlh, ovs_flow_new_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.key.has_value())
+		ovs_flow_key_attrs_put(nlh, OVS_FLOW_ATTR_KEY, req.key.value());
+	if (req.ufid.size() > 0)
+		ynl_attr_put(nlh, OVS_FLOW_ATTR_UFID, req.ufid.data(), req.ufid.size());
+	if (req.mask.has_value())
+		ovs_flow_key_attrs_put(nlh, OVS_FLOW_ATTR_MASK, req.mask.value());
+	if (req.actions.has_value())
+		ovs_flow_action_attrs_put(nlh, OVS_FLOW_ATTR_ACTIONS, req.actions.value());
+}
+
+static ynl_cpp::result<void>
+ovs_flow_new_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ovs_flow_flow_attrs_nest;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+ovs_flow_new_ex(ynl_cpp::ynl_socket&  ys, ovs_flow_new_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_FLOW_CMD_NEW, 1);
+	ovs_flow_new_put(nlh, req);
+
+	return ovs_flow_new_exec(ys, nlh);
+}
+
+int ovs_flow_new(ynl_cpp::ynl_socket&  ys, ovs_flow_new_req& req)
+{
+	auto ret = ovs_flow_new_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_flow_new_prepare(ynl_cpp::ynl_socket&  ys, ovs_flow_new_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_FLOW_CMD_NEW, 1);
+	ovs_flow_new_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ovs_flow_new_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ovs_flow_new_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ovs_flow_new(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_flow_new_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ovs_flow_new_batch(ynl_cpp::msg_batch& batch, ovs_flow_new_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(OVS_FLOW_CMD_NEW, 1);
+	ovs_flow_new_put(nlh, req);
+	return batch.msg_end(nlh, &ovs_flow_flow_attrs_nest);
+}
+
+/* ============== OVS_FLOW_CMD_DEL ============== */
+/* OVS_FLOW_CMD_DEL - do */
+static void ovs_flow_del_put(struct nlmsghdr *nlh, ovs_flow_del_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + NLMSG_ALIGN(sizeof(struct ovs_header)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.ufid_flags.has_value())
+		ynl_attr_put_u32_unchecked(nlh, OVS_FLOW_ATTR_UFID_FLAGS, req.ufid_flags.value());
+	if (req.key.has_value())
+		ovs_flow_key_attrs_put(nlh, OVS_FLOW_ATTR_KEY, req.key.value());
+	if (req.ufid.size() > 0)
+		ynl_attr_put(nlh, OVS_FLOW_ATTR_UFID, req.ufid.data(), req.ufid.size());
+}
+
+static ynl_cpp::result<void>
+ovs_flow_del_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ovs_flow_flow_attrs_nest;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+ovs_flow_del_ex(ynl_cpp::ynl_socket&  ys, ovs_flow_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_FLOW_CMD_DEL, 1);
+	ovs_flow_del_put(nlh, req);
+
+	return ovs_flow_del_exec(ys, nlh);
+}
+
+int ovs_flow_del(ynl_cpp::ynl_socket&  ys, ovs_flow_del_req& req)
+{
+	auto ret = ovs_flow_del_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_flow_del_prepare(ynl_cpp::ynl_socket&  ys, ovs_flow_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_FLOW_CMD_DEL, 1);
+	ovs_flow_del_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+ovs_flow_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ovs_flow_del_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ovs_flow_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_flow_del_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ovs_flow_del_batch(ynl_cpp::msg_batch& batch, ovs_flow_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(OVS_FLOW_CMD_DEL, 1);
+	ovs_flow_del_put(nlh, req);
+	return batch.msg_end(nlh, &ovs_flow_flow_attrs_nest);
+}
+
+const struct ynl_family ynl_ovs_flow_family =  {
+	.name		= "ovs_flow",
+	.hdr_len	= sizeof(struct genlmsghdr) + sizeof(struct ovs_header),
+};
+const struct ynl_family& get_ynl_ovs_flow_family() {
+	return ynl_ovs_flow_family;
+};
+} //namespace ynl_cpp
@@ -0,0 +1,560 @@
+// SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause)
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user source */
+
+#include "ovs_vport-user.hpp"
+
+#include <array>
+
+#include <linux/openvswitch.h>
+
+#include <linux/genetlink.h>
+
+namespace ynl_cpp {
+
+/* Enums */
+static constexpr std::array<std::string_view, OVS_VPORT_CMD_GET + 1> ovs_vport_op_strmap = []() {
+	std::array<std::string_view, OVS_VPORT_CMD_GET + 1> arr{};
+	arr[OVS_VPORT_CMD_NEW] = "new";
+	arr[OVS_VPORT_CMD_DEL] = "del";
+	arr[OVS_VPORT_CMD_GET] = "get";
+	return arr;
+} ();
+
+std::string_view ovs_vport_op_str(int op)
+{
+	if (op < 0 || op >= (int)(ovs_vport_op_strmap.size()))
+		return "";
+	return ovs_vport_op_strmap[op];
+}
+
+static constexpr std::array<std::string_view, 5 + 1> ovs_vport_vport_type_strmap = []() {
+	std::array<std::string_view, 5 + 1> arr{};
+	arr[0] = "unspec";
+	arr[1] = "netdev";
+	arr[2] = "internal";
+	arr[3] = "gre";
+	arr[4] = "vxlan";
+	arr[5] = "geneve";
+	return arr;
+} ();
+
+std::string_view ovs_vport_vport_type_str(ovs_vport_type value)
+{
+	if (value < 0 || value >= (int)(ovs_vport_vport_type_strmap.size()))
+		return "";
+	return ovs_vport_vport_type_strmap[value];
+}
+
+/* Policies */
+static std::array<ynl_policy_attr,OVS_TUNNEL_ATTR_MAX + 1> ovs_vport_vport_options_policy = []() {
+	std::array<ynl_policy_attr,OVS_TUNNEL_ATTR_MAX + 1> arr{};
+	arr[OVS_TUNNEL_ATTR_DST_PORT] = { .name = "dst-port", .type = YNL_PT_U32, };
+	arr[OVS_TUNNEL_ATTR_EXTENSION] = { .name = "extension", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_vport_vport_options_nest = {
+	.max_attr = OVS_TUNNEL_ATTR_MAX,
+	.table = ovs_vport_vport_options_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_VPORT_UPCALL_ATTR_MAX + 1> ovs_vport_upcall_stats_policy = []() {
+	std::array<ynl_policy_attr,OVS_VPORT_UPCALL_ATTR_MAX + 1> arr{};
+	arr[OVS_VPORT_UPCALL_ATTR_SUCCESS] = { .name = "success", .type = YNL_PT_U64, };
+	arr[OVS_VPORT_UPCALL_ATTR_FAIL] = { .name = "fail", .type = YNL_PT_U64, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_vport_upcall_stats_nest = {
+	.max_attr = OVS_VPORT_UPCALL_ATTR_MAX,
+	.table = ovs_vport_upcall_stats_policy.data(),
+};
+
+static std::array<ynl_policy_attr,OVS_VPORT_ATTR_MAX + 1> ovs_vport_vport_policy = []() {
+	std::array<ynl_policy_attr,OVS_VPORT_ATTR_MAX + 1> arr{};
+	arr[OVS_VPORT_ATTR_UNSPEC] = { .name = "unspec", .type = YNL_PT_REJECT, };
+	arr[OVS_VPORT_ATTR_PORT_NO] = { .name = "port-no", .type = YNL_PT_U32, };
+	arr[OVS_VPORT_ATTR_TYPE] = { .name = "type", .type = YNL_PT_U32, };
+	arr[OVS_VPORT_ATTR_NAME] = { .name = "name", .type = YNL_PT_NUL_STR, };
+	arr[OVS_VPORT_ATTR_OPTIONS] = { .name = "options", .type = YNL_PT_NEST, .nest = &ovs_vport_vport_options_nest, };
+	arr[OVS_VPORT_ATTR_UPCALL_PID] = { .name = "upcall-pid", .type = YNL_PT_BINARY,};
+	arr[OVS_VPORT_ATTR_STATS] = { .name = "stats", .type = YNL_PT_BINARY,};
+	arr[OVS_VPORT_ATTR_PAD] = { .name = "pad", .type = YNL_PT_REJECT, };
+	arr[OVS_VPORT_ATTR_IFINDEX] = { .name = "ifindex", .type = YNL_PT_U32, };
+	arr[OVS_VPORT_ATTR_NETNSID] = { .name = "netnsid", .type = YNL_PT_U32, };
+	arr[OVS_VPORT_ATTR_UPCALL_STATS] = { .name = "upcall-stats", .type = YNL_PT_NEST, .nest = &ovs_vport_upcall_stats_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest ovs_vport_vport_nest = {
+	.max_attr = OVS_VPORT_ATTR_MAX,
+	.table = ovs_vport_vport_policy.data(),
+};
+
+/* Common nested types */
+int ovs_vport_vport_options_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				const ovs_vport_vport_options&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.dst_port.has_value())
+		ynl_attr_put_u32(nlh, OVS_TUNNEL_ATTR_DST_PORT, obj.dst_port.value());
+	if (obj.extension.has_value())
+		ynl_attr_put_u32(nlh, OVS_TUNNEL_ATTR_EXTENSION, obj.extension.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int ovs_vport_upcall_stats_parse(struct ynl_parse_arg *yarg,
+				 const struct nlattr *nested)
+{
+	ovs_vport_upcall_stats *dst = (ovs_vport_upcall_stats *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == OVS_VPORT_UPCALL_ATTR_SUCCESS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->success = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == OVS_VPORT_UPCALL_ATTR_FAIL) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->fail = (__u64)ynl_attr_get_u64(attr);
+		}
+	}
+
+	return 0;
+}
+
+/* ============== OVS_VPORT_CMD_NEW ============== */
+/* OVS_VPORT_CMD_NEW - do */
+static void ovs_vport_new_put(struct nlmsghdr *nlh, ovs_vport_new_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + NLMSG_ALIGN(sizeof(struct ovs_header)) + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.type.has_value())
+		ynl_attr_put_u32_unchecked(nlh, OVS_VPORT_ATTR_TYPE, req.type.value());
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, OVS_VPORT_ATTR_IFINDEX, req.ifindex.value());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, OVS_VPORT_ATTR_NAME, req.name.data());
+	if (req.upcall_pid.size() > 0)
+		ynl_attr_put(nlh, OVS_VPORT_ATTR_UPCALL_PID, req.upcall_pid.data(), req.upcall_pid.size());
+	if (req.options.has_value())
+		ovs_vport_vport_options_put(nlh, OVS_VPORT_ATTR_OPTIONS, req.options.value());
+}
+
+static ynl_cpp::result<void>
+ovs_vport_new_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ovs_vport_vport_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct genlmsghdr) + sizeof(struct ovs_header);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+ovs_vport_new_ex(ynl_cpp::ynl_socket&  ys, ovs_vport_new_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_VPORT_CMD_NEW, 1);
+	ovs_vport_new_put(nlh, req);
+
+	return ovs_vport_new_exec(ys, nlh);
+}
+
+int ovs_vport_new(ynl_cpp::ynl_socket&  ys, ovs_vport_new_req& req)
+{
+	auto ret = ovs_vport_new_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_vport_new_prepare(ynl_cpp::ynl_socket&  ys, ovs_vport_new_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_VPORT_CMD_NEW, 1);
+	ovs_vport_new_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct genlmsghdr) + sizeof(struct ovs_header));
+}
+
+ynl_cpp::result<void>
+ovs_vport_new_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ovs_vport_new_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ovs_vport_new(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_vport_new_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ovs_vport_new_batch(ynl_cpp::msg_batch& batch, ovs_vport_new_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(OVS_VPORT_CMD_NEW, 1);
+	ovs_vport_new_put(nlh, req);
+	return batch.msg_end(nlh, &ovs_vport_vport_nest, sizeof(struct genlmsghdr) + sizeof(struct ovs_header));
+}
+
+/* ============== OVS_VPORT_CMD_DEL ============== */
+/* OVS_VPORT_CMD_DEL - do */
+static void ovs_vport_del_put(struct nlmsghdr *nlh, ovs_vport_del_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + NLMSG_ALIGN(sizeof(struct ovs_header)) + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.port_no.has_value())
+		ynl_attr_put_u32_unchecked(nlh, OVS_VPORT_ATTR_PORT_NO, req.port_no.value());
+	if (req.type.has_value())
+		ynl_attr_put_u32_unchecked(nlh, OVS_VPORT_ATTR_TYPE, req.type.value());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, OVS_VPORT_ATTR_NAME, req.name.data());
+}
+
+static ynl_cpp::result<void>
+ovs_vport_del_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ovs_vport_vport_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct genlmsghdr) + sizeof(struct ovs_header);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+ovs_vport_del_ex(ynl_cpp::ynl_socket&  ys, ovs_vport_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_VPORT_CMD_DEL, 1);
+	ovs_vport_del_put(nlh, req);
+
+	return ovs_vport_del_exec(ys, nlh);
+}
+
+int ovs_vport_del(ynl_cpp::ynl_socket&  ys, ovs_vport_del_req& req)
+{
+	auto ret = ovs_vport_del_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_vport_del_prepare(ynl_cpp::ynl_socket&  ys, ovs_vport_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_VPORT_CMD_DEL, 1);
+	ovs_vport_del_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct genlmsghdr) + sizeof(struct ovs_header));
+}
+
+ynl_cpp::result<void>
+ovs_vport_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return ovs_vport_del_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int ovs_vport_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_vport_del_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+ovs_vport_del_batch(ynl_cpp::msg_batch& batch, ovs_vport_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(OVS_VPORT_CMD_DEL, 1);
+	ovs_vport_del_put(nlh, req);
+	return batch.msg_end(nlh, &ovs_vport_vport_nest, sizeof(struct genlmsghdr) + sizeof(struct ovs_header));
+}
+
+/* ============== OVS_VPORT_CMD_GET ============== */
+/* OVS_VPORT_CMD_GET - do */
+int ovs_vport_get_rsp_parse(const struct nlmsghdr *nlh,
+			    struct ynl_parse_arg *yarg)
+{
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	ovs_vport_get_rsp *dst;
+	void *hdr;
+
+	dst = (ovs_vport_get_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	hdr = ynl_nlmsg_data_offset(nlh, sizeof(struct genlmsghdr));
+	memcpy(&dst->_hdr, hdr, sizeof(struct ovs_header));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct genlmsghdr) + sizeof(struct ovs_header)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == OVS_VPORT_ATTR_PORT_NO) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->port_no = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_VPORT_ATTR_TYPE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->type = (ovs_vport_type)ynl_attr_get_u32(attr);
+		} else if (type == OVS_VPORT_ATTR_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
+		} else if (type == OVS_VPORT_ATTR_UPCALL_PID) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->upcall_pid.assign(data, data + len);
+		} else if (type == OVS_VPORT_ATTR_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->stats.assign(data, data + len);
+		} else if (type == OVS_VPORT_ATTR_IFINDEX) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_VPORT_ATTR_NETNSID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->netnsid = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == OVS_VPORT_ATTR_UPCALL_STATS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &ovs_vport_upcall_stats_nest;
+			parg.data = &dst->upcall_stats.emplace();
+			if (ovs_vport_upcall_stats_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void ovs_vport_get_put(struct nlmsghdr *nlh, ovs_vport_get_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, OVS_VPORT_ATTR_NAME, req.name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<ovs_vport_get_rsp>>
+ovs_vport_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		   const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<ovs_vport_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &ovs_vport_vport_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct genlmsghdr) + sizeof(struct ovs_header);
+	yrs.yarg.rsp_policy = &ovs_vport_vport_nest;
+
+	rsp.reset(new ovs_vport_get_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = ovs_vport_get_rsp_parse;
+	yrs.rsp_cmd = OVS_VPORT_CMD_GET;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<ovs_vport_get_rsp>>
+ovs_vport_get_ex(ynl_cpp::ynl_socket&  ys, ovs_vport_get_req& req,
+		 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_VPORT_CMD_GET, 1);
+	ovs_vport_get_put(nlh, req);
+
+	return ovs_vport_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ovs_vport_get_rsp>
+ovs_vport_get(ynl_cpp::ynl_socket&  ys, ovs_vport_get_req& req)
+{
+	auto ret = ovs_vport_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_vport_get_prepare(ynl_cpp::ynl_socket&  ys, ovs_vport_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, OVS_VPORT_CMD_GET, 1);
+	ovs_vport_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct genlmsghdr) + sizeof(struct ovs_header));
+}
+
+ynl_cpp::result<std::unique_ptr<ovs_vport_get_rsp>>
+ovs_vport_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		 const ynl_cpp::projection *proj)
+{
+	return ovs_vport_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ovs_vport_get_rsp>
+ovs_vport_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_vport_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* OVS_VPORT_CMD_GET - dump */
+static void
+ovs_vport_get_dump_put(struct nlmsghdr *nlh, ovs_vport_get_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, OVS_VPORT_ATTR_NAME, req.name.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<ovs_vport_get_list>>
+ovs_vport_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<ovs_vport_get_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &ovs_vport_vport_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<ovs_vport_get_list*>(arg)->objs.emplace_back());};
+	yds.cb = ovs_vport_get_rsp_parse;
+	yds.rsp_cmd = OVS_VPORT_CMD_GET;
+	((struct ynl_sock*)ys)->req_policy = &ovs_vport_vport_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct genlmsghdr) + sizeof(struct ovs_header);
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<ovs_vport_get_list>>
+ovs_vport_get_dump_ex(ynl_cpp::ynl_socket&  ys, ovs_vport_get_req_dump& req,
+		      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, OVS_VPORT_CMD_GET, 1);
+	ovs_vport_get_dump_put(nlh, req);
+
+	return ovs_vport_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<ovs_vport_get_list>
+ovs_vport_get_dump(ynl_cpp::ynl_socket&  ys, ovs_vport_get_req_dump& req)
+{
+	auto ret = ovs_vport_get_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+ovs_vport_get_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			   ovs_vport_get_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, OVS_VPORT_CMD_GET, 1);
+	ovs_vport_get_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct genlmsghdr) + sizeof(struct ovs_header));
+}
+
+ynl_cpp::result<std::unique_ptr<ovs_vport_get_list>>
+ovs_vport_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj)
+{
+	return ovs_vport_get_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<ovs_vport_get_list>
+ovs_vport_get_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = ovs_vport_get_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+const struct ynl_family ynl_ovs_vport_family =  {
+	.name		= "ovs_vport",
+	.hdr_len	= sizeof(struct genlmsghdr),
+};
+const struct ynl_family& get_ynl_ovs_vport_family() {
+	return ynl_ovs_vport_family;
+};
+} //namespace ynl_cpp
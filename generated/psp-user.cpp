@@ -140,14 +140,12 @@ int psp_keys_parse(struct ynl_parse_arg *yarg, const struct nlattr *nested)
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == PSP_A_KEYS_KEY) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->key.assign(data, data + len);
 		} else if (type == PSP_A_KEYS_SPI) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->spi = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -168,21 +166,24 @@ int psp_dev_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == PSP_A_DEV_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == PSP_A_DEV_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == PSP_A_DEV_PSP_VERSIONS_CAP) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->psp_versions_cap = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == PSP_A_DEV_PSP_VERSIONS_ENA) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->psp_versions_ena = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -190,58 +191,144 @@ int psp_dev_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<psp_dev_get_rsp>
-psp_dev_get(ynl_cpp::ynl_socket&  ys, psp_dev_get_req& req)
+static void psp_dev_get_put(struct nlmsghdr *nlh, psp_dev_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, PSP_A_DEV_ID, req.id.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<psp_dev_get_rsp>>
+psp_dev_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		 const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<psp_dev_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_DEV_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &psp_dev_nest;
 	yrs.yarg.rsp_policy = &psp_dev_nest;
 
-	if (req.id.has_value())
-		ynl_attr_put_u32(nlh, PSP_A_DEV_ID, req.id.value());
-
 	rsp.reset(new psp_dev_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = psp_dev_get_rsp_parse;
 	yrs.rsp_cmd = PSP_CMD_DEV_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<psp_dev_get_rsp>>
+psp_dev_get_ex(ynl_cpp::ynl_socket&  ys, psp_dev_get_req& req,
+	       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_DEV_GET, 1);
+	psp_dev_get_put(nlh, req);
+
+	return psp_dev_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<psp_dev_get_rsp>
+psp_dev_get(ynl_cpp::ynl_socket&  ys, psp_dev_get_req& req)
+{
+	auto ret = psp_dev_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+psp_dev_get_prepare(ynl_cpp::ynl_socket&  ys, psp_dev_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_DEV_GET, 1);
+	psp_dev_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<psp_dev_get_rsp>>
+psp_dev_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	       const ynl_cpp::projection *proj)
+{
+	return psp_dev_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<psp_dev_get_rsp>
+psp_dev_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = psp_dev_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* PSP_CMD_DEV_GET - dump */
-std::unique_ptr<psp_dev_get_list> psp_dev_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<psp_dev_get_list>>
+psp_dev_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<psp_dev_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &psp_dev_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<psp_dev_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = psp_dev_get_rsp_parse;
 	yds.rsp_cmd = PSP_CMD_DEV_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_DEV_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<psp_dev_get_list>>
+psp_dev_get_dump_ex(ynl_cpp::ynl_socket&  ys, const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_DEV_GET, 1);
+
+	return psp_dev_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<psp_dev_get_list> psp_dev_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = psp_dev_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* PSP_CMD_DEV_GET - notify */
+static_assert(ynl_cpp::ntf_layout_matches<psp_dev_get_ntf>());
+
+static void *psp_dev_get_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) psp_dev_get_ntf())->obj;
+}
+
+static void psp_dev_get_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	psp_dev_get_ntf *rsp = (psp_dev_get_ntf *)ntf;
+
+	rsp->~psp_dev_get_ntf();
+	::free(rsp);
+}
+
 /* ============== PSP_CMD_DEV_SET ============== */
 /* PSP_CMD_DEV_SET - do */
 int psp_dev_set_rsp_parse(const struct nlmsghdr *nlh,
@@ -250,35 +337,88 @@ int psp_dev_set_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<psp_dev_set_rsp>
-psp_dev_set(ynl_cpp::ynl_socket&  ys, psp_dev_set_req& req)
+static void psp_dev_set_put(struct nlmsghdr *nlh, psp_dev_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, PSP_A_DEV_ID, req.id.value());
+	if (req.psp_versions_ena.has_value())
+		ynl_attr_put_u32_unchecked(nlh, PSP_A_DEV_PSP_VERSIONS_ENA, req.psp_versions_ena.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<psp_dev_set_rsp>>
+psp_dev_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		 const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<psp_dev_set_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_DEV_SET, 1);
 	((struct ynl_sock*)ys)->req_policy = &psp_dev_nest;
 	yrs.yarg.rsp_policy = &psp_dev_nest;
 
-	if (req.id.has_value())
-		ynl_attr_put_u32(nlh, PSP_A_DEV_ID, req.id.value());
-	if (req.psp_versions_ena.has_value())
-		ynl_attr_put_u32(nlh, PSP_A_DEV_PSP_VERSIONS_ENA, req.psp_versions_ena.value());
-
 	rsp.reset(new psp_dev_set_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = psp_dev_set_rsp_parse;
 	yrs.rsp_cmd = PSP_CMD_DEV_SET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<psp_dev_set_rsp>>
+psp_dev_set_ex(ynl_cpp::ynl_socket&  ys, psp_dev_set_req& req,
+	       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_DEV_SET, 1);
+	psp_dev_set_put(nlh, req);
+
+	return psp_dev_set_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<psp_dev_set_rsp>
+psp_dev_set(ynl_cpp::ynl_socket&  ys, psp_dev_set_req& req)
+{
+	auto ret = psp_dev_set_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+psp_dev_set_prepare(ynl_cpp::ynl_socket&  ys, psp_dev_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_DEV_SET, 1);
+	psp_dev_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<psp_dev_set_rsp>>
+psp_dev_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	       const ynl_cpp::projection *proj)
+{
+	return psp_dev_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<psp_dev_set_rsp>
+psp_dev_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = psp_dev_set_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== PSP_CMD_KEY_ROTATE ============== */
 /* PSP_CMD_KEY_ROTATE - do */
 int psp_key_rotate_rsp_parse(const struct nlmsghdr *nlh,
@@ -292,9 +432,12 @@ int psp_key_rotate_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == PSP_A_DEV_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->id = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -302,34 +445,102 @@ int psp_key_rotate_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<psp_key_rotate_rsp>
-psp_key_rotate(ynl_cpp::ynl_socket&  ys, psp_key_rotate_req& req)
+static void psp_key_rotate_put(struct nlmsghdr *nlh, psp_key_rotate_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, PSP_A_DEV_ID, req.id.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<psp_key_rotate_rsp>>
+psp_key_rotate_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		    const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<psp_key_rotate_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_KEY_ROTATE, 1);
 	((struct ynl_sock*)ys)->req_policy = &psp_dev_nest;
 	yrs.yarg.rsp_policy = &psp_dev_nest;
 
-	if (req.id.has_value())
-		ynl_attr_put_u32(nlh, PSP_A_DEV_ID, req.id.value());
-
 	rsp.reset(new psp_key_rotate_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = psp_key_rotate_rsp_parse;
 	yrs.rsp_cmd = PSP_CMD_KEY_ROTATE;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<psp_key_rotate_rsp>>
+psp_key_rotate_ex(ynl_cpp::ynl_socket&  ys, psp_key_rotate_req& req,
+		  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_KEY_ROTATE, 1);
+	psp_key_rotate_put(nlh, req);
+
+	return psp_key_rotate_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<psp_key_rotate_rsp>
+psp_key_rotate(ynl_cpp::ynl_socket&  ys, psp_key_rotate_req& req)
+{
+	auto ret = psp_key_rotate_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+psp_key_rotate_prepare(ynl_cpp::ynl_socket&  ys, psp_key_rotate_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_KEY_ROTATE, 1);
+	psp_key_rotate_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<psp_key_rotate_rsp>>
+psp_key_rotate_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj)
+{
+	return psp_key_rotate_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<psp_key_rotate_rsp>
+psp_key_rotate(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = psp_key_rotate_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* PSP_CMD_KEY_ROTATE - notify */
+static_assert(ynl_cpp::ntf_layout_matches<psp_key_rotate_ntf>());
+
+static void *psp_key_rotate_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) psp_key_rotate_ntf())->obj;
+}
+
+static void psp_key_rotate_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	psp_key_rotate_ntf *rsp = (psp_key_rotate_ntf *)ntf;
+
+	rsp->~psp_key_rotate_ntf();
+	::free(rsp);
+}
+
 /* ============== PSP_CMD_RX_ASSOC ============== */
 /* PSP_CMD_RX_ASSOC - do */
 int psp_rx_assoc_rsp_parse(const struct nlmsghdr *nlh,
@@ -345,20 +556,23 @@ int psp_rx_assoc_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == PSP_A_ASSOC_DEV_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dev_id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == PSP_A_ASSOC_VERSION) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->version = (psp_version)ynl_attr_get_u32(attr);
 		} else if (type == PSP_A_ASSOC_RX_KEY) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &psp_keys_nest;
-			parg.data = &dst->rx_key;
+			parg.data = &dst->rx_key.emplace();
 			if (psp_keys_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -367,37 +581,90 @@ int psp_rx_assoc_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<psp_rx_assoc_rsp>
-psp_rx_assoc(ynl_cpp::ynl_socket&  ys, psp_rx_assoc_req& req)
+static void psp_rx_assoc_put(struct nlmsghdr *nlh, psp_rx_assoc_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.dev_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, PSP_A_ASSOC_DEV_ID, req.dev_id.value());
+	if (req.version.has_value())
+		ynl_attr_put_u32_unchecked(nlh, PSP_A_ASSOC_VERSION, req.version.value());
+	if (req.sock_fd.has_value())
+		ynl_attr_put_u32_unchecked(nlh, PSP_A_ASSOC_SOCK_FD, req.sock_fd.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<psp_rx_assoc_rsp>>
+psp_rx_assoc_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		  const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<psp_rx_assoc_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_RX_ASSOC, 1);
 	((struct ynl_sock*)ys)->req_policy = &psp_assoc_nest;
 	yrs.yarg.rsp_policy = &psp_assoc_nest;
 
-	if (req.dev_id.has_value())
-		ynl_attr_put_u32(nlh, PSP_A_ASSOC_DEV_ID, req.dev_id.value());
-	if (req.version.has_value())
-		ynl_attr_put_u32(nlh, PSP_A_ASSOC_VERSION, req.version.value());
-	if (req.sock_fd.has_value())
-		ynl_attr_put_u32(nlh, PSP_A_ASSOC_SOCK_FD, req.sock_fd.value());
-
 	rsp.reset(new psp_rx_assoc_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = psp_rx_assoc_rsp_parse;
 	yrs.rsp_cmd = PSP_CMD_RX_ASSOC;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<psp_rx_assoc_rsp>>
+psp_rx_assoc_ex(ynl_cpp::ynl_socket&  ys, psp_rx_assoc_req& req,
+		const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_RX_ASSOC, 1);
+	psp_rx_assoc_put(nlh, req);
+
+	return psp_rx_assoc_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<psp_rx_assoc_rsp>
+psp_rx_assoc(ynl_cpp::ynl_socket&  ys, psp_rx_assoc_req& req)
+{
+	auto ret = psp_rx_assoc_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+psp_rx_assoc_prepare(ynl_cpp::ynl_socket&  ys, psp_rx_assoc_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_RX_ASSOC, 1);
+	psp_rx_assoc_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<psp_rx_assoc_rsp>>
+psp_rx_assoc_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		const ynl_cpp::projection *proj)
+{
+	return psp_rx_assoc_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<psp_rx_assoc_rsp>
+psp_rx_assoc(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = psp_rx_assoc_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== PSP_CMD_TX_ASSOC ============== */
 /* PSP_CMD_TX_ASSOC - do */
 int psp_tx_assoc_rsp_parse(const struct nlmsghdr *nlh,
@@ -406,39 +673,92 @@ int psp_tx_assoc_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<psp_tx_assoc_rsp>
-psp_tx_assoc(ynl_cpp::ynl_socket&  ys, psp_tx_assoc_req& req)
+static void psp_tx_assoc_put(struct nlmsghdr *nlh, psp_tx_assoc_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.dev_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, PSP_A_ASSOC_DEV_ID, req.dev_id.value());
+	if (req.version.has_value())
+		ynl_attr_put_u32_unchecked(nlh, PSP_A_ASSOC_VERSION, req.version.value());
+	if (req.sock_fd.has_value())
+		ynl_attr_put_u32_unchecked(nlh, PSP_A_ASSOC_SOCK_FD, req.sock_fd.value());
+	if (req.tx_key.has_value())
+		psp_keys_put(nlh, PSP_A_ASSOC_TX_KEY, req.tx_key.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<psp_tx_assoc_rsp>>
+psp_tx_assoc_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		  const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<psp_tx_assoc_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_TX_ASSOC, 1);
 	((struct ynl_sock*)ys)->req_policy = &psp_assoc_nest;
 	yrs.yarg.rsp_policy = &psp_assoc_nest;
 
-	if (req.dev_id.has_value())
-		ynl_attr_put_u32(nlh, PSP_A_ASSOC_DEV_ID, req.dev_id.value());
-	if (req.version.has_value())
-		ynl_attr_put_u32(nlh, PSP_A_ASSOC_VERSION, req.version.value());
-	if (req.tx_key.has_value())
-		psp_keys_put(nlh, PSP_A_ASSOC_TX_KEY, req.tx_key.value());
-	if (req.sock_fd.has_value())
-		ynl_attr_put_u32(nlh, PSP_A_ASSOC_SOCK_FD, req.sock_fd.value());
-
 	rsp.reset(new psp_tx_assoc_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = psp_tx_assoc_rsp_parse;
 	yrs.rsp_cmd = PSP_CMD_TX_ASSOC;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<psp_tx_assoc_rsp>>
+psp_tx_assoc_ex(ynl_cpp::ynl_socket&  ys, psp_tx_assoc_req& req,
+		const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_TX_ASSOC, 1);
+	psp_tx_assoc_put(nlh, req);
+
+	return psp_tx_assoc_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<psp_tx_assoc_rsp>
+psp_tx_assoc(ynl_cpp::ynl_socket&  ys, psp_tx_assoc_req& req)
+{
+	auto ret = psp_tx_assoc_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+psp_tx_assoc_prepare(ynl_cpp::ynl_socket&  ys, psp_tx_assoc_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_TX_ASSOC, 1);
+	psp_tx_assoc_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<psp_tx_assoc_rsp>>
+psp_tx_assoc_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		const ynl_cpp::projection *proj)
+{
+	return psp_tx_assoc_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<psp_tx_assoc_rsp>
+psp_tx_assoc(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = psp_tx_assoc_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== PSP_CMD_GET_STATS ============== */
 /* PSP_CMD_GET_STATS - do */
 int psp_get_stats_rsp_parse(const struct nlmsghdr *nlh,
@@ -452,17 +772,20 @@ int psp_get_stats_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == PSP_A_STATS_DEV_ID) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->dev_id = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == PSP_A_STATS_KEY_ROTATIONS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->key_rotations = (__u64)ynl_attr_get_uint(attr);
 		} else if (type == PSP_A_STATS_STALE_EVENTS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "uint");
 			dst->stale_events = (__u64)ynl_attr_get_uint(attr);
 		}
 	}
@@ -470,75 +793,159 @@ int psp_get_stats_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<psp_get_stats_rsp>
-psp_get_stats(ynl_cpp::ynl_socket&  ys, psp_get_stats_req& req)
+static void psp_get_stats_put(struct nlmsghdr *nlh, psp_get_stats_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.dev_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, PSP_A_STATS_DEV_ID, req.dev_id.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<psp_get_stats_rsp>>
+psp_get_stats_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		   const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<psp_get_stats_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_GET_STATS, 1);
 	((struct ynl_sock*)ys)->req_policy = &psp_stats_nest;
 	yrs.yarg.rsp_policy = &psp_stats_nest;
 
-	if (req.dev_id.has_value())
-		ynl_attr_put_u32(nlh, PSP_A_STATS_DEV_ID, req.dev_id.value());
-
 	rsp.reset(new psp_get_stats_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = psp_get_stats_rsp_parse;
 	yrs.rsp_cmd = PSP_CMD_GET_STATS;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<psp_get_stats_rsp>>
+psp_get_stats_ex(ynl_cpp::ynl_socket&  ys, psp_get_stats_req& req,
+		 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_GET_STATS, 1);
+	psp_get_stats_put(nlh, req);
+
+	return psp_get_stats_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<psp_get_stats_rsp>
+psp_get_stats(ynl_cpp::ynl_socket&  ys, psp_get_stats_req& req)
+{
+	auto ret = psp_get_stats_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+psp_get_stats_prepare(ynl_cpp::ynl_socket&  ys, psp_get_stats_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_GET_STATS, 1);
+	psp_get_stats_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<psp_get_stats_rsp>>
+psp_get_stats_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		 const ynl_cpp::projection *proj)
+{
+	return psp_get_stats_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<psp_get_stats_rsp>
+psp_get_stats(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = psp_get_stats_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* PSP_CMD_GET_STATS - dump */
-std::unique_ptr<psp_get_stats_list>
-psp_get_stats_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<psp_get_stats_list>>
+psp_get_stats_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<psp_get_stats_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &psp_stats_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<psp_get_stats_list*>(arg)->objs.emplace_back());};
 	yds.cb = psp_get_stats_rsp_parse;
 	yds.rsp_cmd = PSP_CMD_GET_STATS;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_GET_STATS, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
+ynl_cpp::result<std::unique_ptr<psp_get_stats_list>>
+psp_get_stats_dump_ex(ynl_cpp::ynl_socket&  ys,
+		      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, PSP_CMD_GET_STATS, 1);
+
+	return psp_get_stats_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<psp_get_stats_list>
+psp_get_stats_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = psp_get_stats_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 static constexpr std::array<ynl_ntf_info, PSP_CMD_KEY_ROTATE_NTF + 1> psp_ntf_info = []() {
 	std::array<ynl_ntf_info, PSP_CMD_KEY_ROTATE_NTF + 1> arr{};
 	arr[PSP_CMD_DEV_ADD_NTF] =  {
 		.cb		= psp_dev_get_rsp_parse,
 		.policy		= &psp_dev_nest,
+		.alloc_sz	= sizeof(psp_dev_get_ntf),
+		.free		= psp_dev_get_ntf_free,
+		.init		= psp_dev_get_ntf_init,
 	};
 	arr[PSP_CMD_DEV_DEL_NTF] =  {
 		.cb		= psp_dev_get_rsp_parse,
 		.policy		= &psp_dev_nest,
+		.alloc_sz	= sizeof(psp_dev_get_ntf),
+		.free		= psp_dev_get_ntf_free,
+		.init		= psp_dev_get_ntf_init,
 	};
 	arr[PSP_CMD_DEV_CHANGE_NTF] =  {
 		.cb		= psp_dev_get_rsp_parse,
 		.policy		= &psp_dev_nest,
+		.alloc_sz	= sizeof(psp_dev_get_ntf),
+		.free		= psp_dev_get_ntf_free,
+		.init		= psp_dev_get_ntf_init,
 	};
 	arr[PSP_CMD_KEY_ROTATE_NTF] =  {
 		.cb		= psp_key_rotate_rsp_parse,
 		.policy		= &psp_dev_nest,
+		.alloc_sz	= sizeof(psp_key_rotate_ntf),
+		.free		= psp_key_rotate_ntf_free,
+		.init		= psp_key_rotate_ntf_init,
 	};
 	return arr;
 } ();
@@ -34,12 +34,23 @@ struct psp_keys {
 	std::optional<__u32> spi;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest psp_keys_nest;
+extern struct ynl_policy_nest psp_dev_nest;
+extern struct ynl_policy_nest psp_assoc_nest;
+extern struct ynl_policy_nest psp_stats_nest;
+int psp_keys_put(struct nlmsghdr *nlh, unsigned int attr_type,
+		 const psp_keys&  obj);
+
 /* ============== PSP_CMD_DEV_GET ============== */
 /* PSP_CMD_DEV_GET - do */
 struct psp_dev_get_req {
 	std::optional<__u32> id;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t psp_dev_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct psp_dev_get_rsp {
 	std::optional<__u32> id;
 	std::optional<__u32> ifindex;
@@ -52,6 +63,16 @@ struct psp_dev_get_rsp {
  */
 std::unique_ptr<psp_dev_get_rsp>
 psp_dev_get(ynl_cpp::ynl_socket&  ys, psp_dev_get_req& req);
+ynl_cpp::result<std::unique_ptr<psp_dev_get_rsp>>
+psp_dev_get_ex(ynl_cpp::ynl_socket&  ys, psp_dev_get_req& req,
+	       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+psp_dev_get_prepare(ynl_cpp::ynl_socket&  ys, psp_dev_get_req& req);
+std::unique_ptr<psp_dev_get_rsp>
+psp_dev_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<psp_dev_get_rsp>>
+psp_dev_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	       const ynl_cpp::projection *proj = nullptr);
 
 /* PSP_CMD_DEV_GET - dump */
 struct psp_dev_get_list {
@@ -59,9 +80,18 @@ struct psp_dev_get_list {
 };
 
 std::unique_ptr<psp_dev_get_list> psp_dev_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<psp_dev_get_list>>
+psp_dev_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* PSP_CMD_DEV_GET - notify */
 struct psp_dev_get_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	psp_dev_get_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== PSP_CMD_DEV_SET ============== */
@@ -71,6 +101,9 @@ struct psp_dev_set_req {
 	std::optional<__u32> psp_versions_ena;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t psp_dev_set_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 16;
+
 struct psp_dev_set_rsp {
 };
 
@@ -79,6 +112,16 @@ struct psp_dev_set_rsp {
  */
 std::unique_ptr<psp_dev_set_rsp>
 psp_dev_set(ynl_cpp::ynl_socket&  ys, psp_dev_set_req& req);
+ynl_cpp::result<std::unique_ptr<psp_dev_set_rsp>>
+psp_dev_set_ex(ynl_cpp::ynl_socket&  ys, psp_dev_set_req& req,
+	       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+psp_dev_set_prepare(ynl_cpp::ynl_socket&  ys, psp_dev_set_req& req);
+std::unique_ptr<psp_dev_set_rsp>
+psp_dev_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<psp_dev_set_rsp>>
+psp_dev_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	       const ynl_cpp::projection *proj = nullptr);
 
 /* ============== PSP_CMD_KEY_ROTATE ============== */
 /* PSP_CMD_KEY_ROTATE - do */
@@ -86,6 +129,9 @@ struct psp_key_rotate_req {
 	std::optional<__u32> id;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t psp_key_rotate_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct psp_key_rotate_rsp {
 	std::optional<__u32> id;
 };
@@ -95,9 +141,25 @@ struct psp_key_rotate_rsp {
  */
 std::unique_ptr<psp_key_rotate_rsp>
 psp_key_rotate(ynl_cpp::ynl_socket&  ys, psp_key_rotate_req& req);
+ynl_cpp::result<std::unique_ptr<psp_key_rotate_rsp>>
+psp_key_rotate_ex(ynl_cpp::ynl_socket&  ys, psp_key_rotate_req& req,
+		  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+psp_key_rotate_prepare(ynl_cpp::ynl_socket&  ys, psp_key_rotate_req& req);
+std::unique_ptr<psp_key_rotate_rsp>
+psp_key_rotate(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<psp_key_rotate_rsp>>
+psp_key_rotate_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		  const ynl_cpp::projection *proj = nullptr);
 
 /* PSP_CMD_KEY_ROTATE - notify */
 struct psp_key_rotate_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	psp_key_rotate_rsp obj __attribute__((aligned(8)));
 };
 
 /* ============== PSP_CMD_RX_ASSOC ============== */
@@ -108,6 +170,9 @@ struct psp_rx_assoc_req {
 	std::optional<__u32> sock_fd;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t psp_rx_assoc_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 24;
+
 struct psp_rx_assoc_rsp {
 	std::optional<__u32> dev_id;
 	std::optional<psp_version> version;
@@ -119,6 +184,16 @@ struct psp_rx_assoc_rsp {
  */
 std::unique_ptr<psp_rx_assoc_rsp>
 psp_rx_assoc(ynl_cpp::ynl_socket&  ys, psp_rx_assoc_req& req);
+ynl_cpp::result<std::unique_ptr<psp_rx_assoc_rsp>>
+psp_rx_assoc_ex(ynl_cpp::ynl_socket&  ys, psp_rx_assoc_req& req,
+		const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+psp_rx_assoc_prepare(ynl_cpp::ynl_socket&  ys, psp_rx_assoc_req& req);
+std::unique_ptr<psp_rx_assoc_rsp>
+psp_rx_assoc(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<psp_rx_assoc_rsp>>
+psp_rx_assoc_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		const ynl_cpp::projection *proj = nullptr);
 
 /* ============== PSP_CMD_TX_ASSOC ============== */
 /* PSP_CMD_TX_ASSOC - do */
@@ -137,6 +212,16 @@ struct psp_tx_assoc_rsp {
  */
 std::unique_ptr<psp_tx_assoc_rsp>
 psp_tx_assoc(ynl_cpp::ynl_socket&  ys, psp_tx_assoc_req& req);
+ynl_cpp::result<std::unique_ptr<psp_tx_assoc_rsp>>
+psp_tx_assoc_ex(ynl_cpp::ynl_socket&  ys, psp_tx_assoc_req& req,
+		const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+psp_tx_assoc_prepare(ynl_cpp::ynl_socket&  ys, psp_tx_assoc_req& req);
+std::unique_ptr<psp_tx_assoc_rsp>
+psp_tx_assoc(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<psp_tx_assoc_rsp>>
+psp_tx_assoc_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		const ynl_cpp::projection *proj = nullptr);
 
 /* ============== PSP_CMD_GET_STATS ============== */
 /* PSP_CMD_GET_STATS - do */
@@ -144,6 +229,9 @@ struct psp_get_stats_req {
 	std::optional<__u32> dev_id;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t psp_get_stats_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct psp_get_stats_rsp {
 	std::optional<__u32> dev_id;
 	std::optional<__u64> key_rotations;
@@ -155,6 +243,16 @@ struct psp_get_stats_rsp {
  */
 std::unique_ptr<psp_get_stats_rsp>
 psp_get_stats(ynl_cpp::ynl_socket&  ys, psp_get_stats_req& req);
+ynl_cpp::result<std::unique_ptr<psp_get_stats_rsp>>
+psp_get_stats_ex(ynl_cpp::ynl_socket&  ys, psp_get_stats_req& req,
+		 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+psp_get_stats_prepare(ynl_cpp::ynl_socket&  ys, psp_get_stats_req& req);
+std::unique_ptr<psp_get_stats_rsp>
+psp_get_stats(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<psp_get_stats_rsp>>
+psp_get_stats_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		 const ynl_cpp::projection *proj = nullptr);
 
 /* PSP_CMD_GET_STATS - dump */
 struct psp_get_stats_list {
@@ -163,6 +261,9 @@ struct psp_get_stats_list {
 
 std::unique_ptr<psp_get_stats_list>
 psp_get_stats_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<psp_get_stats_list>>
+psp_get_stats_dump_ex(ynl_cpp::ynl_socket&  ys,
+		      const ynl_cpp::projection *proj = nullptr);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_PSP_GEN_H */
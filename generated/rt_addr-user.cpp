@@ -0,0 +1,401 @@
+// SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause)
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user source */
+
+#include "rt_addr-user.hpp"
+
+#include <array>
+
+#include <linux/genetlink.h>
+#include <linux/rtnetlink.h>
+
+namespace ynl_cpp {
+
+/* Enums */
+static constexpr std::array<std::string_view, RTM_NEWADDR + 1> rt_addr_op_strmap = []() {
+	std::array<std::string_view, RTM_NEWADDR + 1> arr{};
+	arr[RTM_NEWADDR] = "getaddr";
+	return arr;
+} ();
+
+std::string_view rt_addr_op_str(int op)
+{
+	if (op < 0 || op >= (int)(rt_addr_op_strmap.size()))
+		return "";
+	return rt_addr_op_strmap[op];
+}
+
+static constexpr std::array<std::string_view, 11 + 1> rt_addr_ifa_flags_strmap = []() {
+	std::array<std::string_view, 11 + 1> arr{};
+	arr[0] = "secondary";
+	arr[1] = "nodad";
+	arr[2] = "optimistic";
+	arr[3] = "dadfailed";
+	arr[4] = "homeaddress";
+	arr[5] = "deprecated";
+	arr[6] = "tentative";
+	arr[7] = "permanent";
+	arr[8] = "managetempaddr";
+	arr[9] = "noprefixroute";
+	arr[10] = "mcautojoin";
+	arr[11] = "stable-privacy";
+	return arr;
+} ();
+
+std::string_view rt_addr_ifa_flags_str(rt_addr_ifa_flags value)
+{
+	value = (rt_addr_ifa_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(rt_addr_ifa_flags_strmap.size()))
+		return "";
+	return rt_addr_ifa_flags_strmap[value];
+}
+
+/* Policies */
+static std::array<ynl_policy_attr,11 + 1> rt_addr_addr_attrs_policy = []() {
+	std::array<ynl_policy_attr,11 + 1> arr{};
+	arr[RT_ADDR_A_ADDR_ATTRS_IFA_ADDRESS] = { .name = "ifa-address", .type = YNL_PT_BINARY,};
+	arr[RT_ADDR_A_ADDR_ATTRS_IFA_LOCAL] = { .name = "ifa-local", .type = YNL_PT_BINARY,};
+	arr[RT_ADDR_A_ADDR_ATTRS_IFA_LABEL] = { .name = "ifa-label", .type = YNL_PT_NUL_STR, };
+	arr[RT_ADDR_A_ADDR_ATTRS_IFA_BROADCAST] = { .name = "ifa-broadcast", .type = YNL_PT_BINARY,};
+	arr[RT_ADDR_A_ADDR_ATTRS_IFA_ANYCAST] = { .name = "ifa-anycast", .type = YNL_PT_BINARY,};
+	arr[RT_ADDR_A_ADDR_ATTRS_IFA_CACHEINFO] = { .name = "ifa-cacheinfo", .type = YNL_PT_BINARY,};
+	arr[RT_ADDR_A_ADDR_ATTRS_IFA_MULTICAST] = { .name = "ifa-multicast", .type = YNL_PT_BINARY,};
+	arr[RT_ADDR_A_ADDR_ATTRS_IFA_FLAGS] = { .name = "ifa-flags", .type = YNL_PT_U32, };
+	arr[RT_ADDR_A_ADDR_ATTRS_IFA_RT_PRIORITY] = { .name = "ifa-rt-priority", .type = YNL_PT_U32, };
+	arr[RT_ADDR_A_ADDR_ATTRS_IFA_TARGET_NETNSID] = { .name = "ifa-target-netnsid", .type = YNL_PT_BINARY,};
+	arr[RT_ADDR_A_ADDR_ATTRS_IFA_PROTO] = { .name = "ifa-proto", .type = YNL_PT_U8, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_addr_addr_attrs_nest = {
+	.max_attr = 11,
+	.table = rt_addr_addr_attrs_policy.data(),
+};
+
+/* Common nested types */
+/* ============== NEWADDR ============== */
+/* NEWADDR - do */
+static void rt_addr_newaddr_put(struct nlmsghdr *nlh, rt_addr_newaddr_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ifaddrmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.ifa_flags.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ADDR_A_ADDR_ATTRS_IFA_FLAGS, req.ifa_flags.value());
+	if (req.ifa_address.size() > 0)
+		ynl_attr_put(nlh, RT_ADDR_A_ADDR_ATTRS_IFA_ADDRESS, req.ifa_address.data(), req.ifa_address.size());
+	if (req.ifa_label.size() > 0)
+		ynl_attr_put_str(nlh, RT_ADDR_A_ADDR_ATTRS_IFA_LABEL, req.ifa_label.data());
+	if (req.ifa_local.size() > 0)
+		ynl_attr_put(nlh, RT_ADDR_A_ADDR_ATTRS_IFA_LOCAL, req.ifa_local.data(), req.ifa_local.size());
+	if (req.ifa_cacheinfo.size() > 0)
+		ynl_attr_put(nlh, RT_ADDR_A_ADDR_ATTRS_IFA_CACHEINFO, req.ifa_cacheinfo.data(), req.ifa_cacheinfo.size());
+}
+
+static ynl_cpp::result<void>
+rt_addr_newaddr_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_addr_addr_attrs_nest;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_addr_newaddr_ex(ynl_cpp::ynl_socket&  ys, rt_addr_newaddr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWADDR, req._nlmsg_flags);
+	rt_addr_newaddr_put(nlh, req);
+
+	return rt_addr_newaddr_exec(ys, nlh);
+}
+
+int rt_addr_newaddr(ynl_cpp::ynl_socket&  ys, rt_addr_newaddr_req& req)
+{
+	auto ret = rt_addr_newaddr_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_addr_newaddr_prepare(ynl_cpp::ynl_socket&  ys, rt_addr_newaddr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWADDR, req._nlmsg_flags);
+	rt_addr_newaddr_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+rt_addr_newaddr_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return rt_addr_newaddr_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_addr_newaddr(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_addr_newaddr_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_addr_newaddr_batch(ynl_cpp::msg_batch& batch, rt_addr_newaddr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_NEWADDR, req._nlmsg_flags);
+	rt_addr_newaddr_put(nlh, req);
+	return batch.msg_end(nlh, &rt_addr_addr_attrs_nest);
+}
+
+/* ============== DELADDR ============== */
+/* DELADDR - do */
+static void rt_addr_deladdr_put(struct nlmsghdr *nlh, rt_addr_deladdr_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ifaddrmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.ifa_flags.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ADDR_A_ADDR_ATTRS_IFA_FLAGS, req.ifa_flags.value());
+	if (req.ifa_address.size() > 0)
+		ynl_attr_put(nlh, RT_ADDR_A_ADDR_ATTRS_IFA_ADDRESS, req.ifa_address.data(), req.ifa_address.size());
+	if (req.ifa_local.size() > 0)
+		ynl_attr_put(nlh, RT_ADDR_A_ADDR_ATTRS_IFA_LOCAL, req.ifa_local.data(), req.ifa_local.size());
+}
+
+static ynl_cpp::result<void>
+rt_addr_deladdr_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_addr_addr_attrs_nest;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_addr_deladdr_ex(ynl_cpp::ynl_socket&  ys, rt_addr_deladdr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELADDR, req._nlmsg_flags);
+	rt_addr_deladdr_put(nlh, req);
+
+	return rt_addr_deladdr_exec(ys, nlh);
+}
+
+int rt_addr_deladdr(ynl_cpp::ynl_socket&  ys, rt_addr_deladdr_req& req)
+{
+	auto ret = rt_addr_deladdr_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_addr_deladdr_prepare(ynl_cpp::ynl_socket&  ys, rt_addr_deladdr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELADDR, req._nlmsg_flags);
+	rt_addr_deladdr_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+rt_addr_deladdr_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return rt_addr_deladdr_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_addr_deladdr(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_addr_deladdr_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_addr_deladdr_batch(ynl_cpp::msg_batch& batch, rt_addr_deladdr_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_DELADDR, req._nlmsg_flags);
+	rt_addr_deladdr_put(nlh, req);
+	return batch.msg_end(nlh, &rt_addr_addr_attrs_nest);
+}
+
+/* ============== GETADDR ============== */
+/* GETADDR - dump */
+int rt_addr_getaddr_rsp_dump_parse(const struct nlmsghdr *nlh,
+				   struct ynl_parse_arg *yarg)
+{
+	rt_addr_getaddr_rsp_dump *dst;
+	const struct nlattr *attr;
+	void *hdr;
+
+	dst = (rt_addr_getaddr_rsp_dump*)yarg->data;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct ifaddrmsg));
+
+	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == RT_ADDR_A_ADDR_ATTRS_IFA_FLAGS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ifa_flags = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ADDR_A_ADDR_ATTRS_IFA_ADDRESS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ifa_address.assign(data, data + len);
+		} else if (type == RT_ADDR_A_ADDR_ATTRS_IFA_LABEL) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->ifa_label.assign(ynl_attr_get_str(attr));
+		} else if (type == RT_ADDR_A_ADDR_ATTRS_IFA_LOCAL) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ifa_local.assign(data, data + len);
+		} else if (type == RT_ADDR_A_ADDR_ATTRS_IFA_CACHEINFO) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ifa_cacheinfo.assign(data, data + len);
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+rt_addr_getaddr_dump_put(struct nlmsghdr *nlh, rt_addr_getaddr_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<rt_addr_getaddr_rsp_list>>
+rt_addr_getaddr_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<rt_addr_getaddr_rsp_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &rt_addr_addr_attrs_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<rt_addr_getaddr_rsp_list*>(arg)->objs.emplace_back());};
+	yds.cb = rt_addr_getaddr_rsp_dump_parse;
+	yds.rsp_cmd = RTM_NEWADDR;
+	((struct ynl_sock*)ys)->req_policy = &rt_addr_addr_attrs_nest;
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<rt_addr_getaddr_rsp_list>>
+rt_addr_getaddr_dump_ex(ynl_cpp::ynl_socket&  ys,
+			rt_addr_getaddr_req_dump& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETADDR);
+	rt_addr_getaddr_dump_put(nlh, req);
+
+	return rt_addr_getaddr_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<rt_addr_getaddr_rsp_list>
+rt_addr_getaddr_dump(ynl_cpp::ynl_socket&  ys, rt_addr_getaddr_req_dump& req)
+{
+	auto ret = rt_addr_getaddr_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_addr_getaddr_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     rt_addr_getaddr_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETADDR);
+	rt_addr_getaddr_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<rt_addr_getaddr_rsp_list>>
+rt_addr_getaddr_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return rt_addr_getaddr_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<rt_addr_getaddr_rsp_list>
+rt_addr_getaddr_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_addr_getaddr_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+static const struct ynl_mcast_grp rt_addr_mcast_groups[] = {
+	{ "rtnlgrp-ipv4-ifaddr", 5 },
+	{ "rtnlgrp-ipv6-ifaddr", 9 },
+};
+
+const struct ynl_family ynl_rt_addr_family =  {
+	.name		= "rt_addr",
+	.hdr_len	= sizeof(struct ifaddrmsg),
+	.is_classic	= true,
+	.classic_id	= 0,
+	.mcast_groups	= rt_addr_mcast_groups,
+	.n_mcast_groups	= std::size(rt_addr_mcast_groups),
+};
+const struct ynl_family& get_ynl_rt_addr_family() {
+	return ynl_rt_addr_family;
+};
+} //namespace ynl_cpp
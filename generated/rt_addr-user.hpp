@@ -0,0 +1,175 @@
+/* SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause) */
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user header */
+
+#ifndef _LINUX_RT_ADDR_GEN_H
+#define _LINUX_RT_ADDR_GEN_H
+
+#include <linux/types.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ynl.hpp"
+
+#include <linux/netlink.h>
+
+namespace ynl_cpp {
+/* Definitions */
+enum rt_addr_ifa_flags {
+	RT_ADDR_IFA_FLAGS_SECONDARY = 1,
+	RT_ADDR_IFA_FLAGS_NODAD = 2,
+	RT_ADDR_IFA_FLAGS_OPTIMISTIC = 4,
+	RT_ADDR_IFA_FLAGS_DADFAILED = 8,
+	RT_ADDR_IFA_FLAGS_HOMEADDRESS = 16,
+	RT_ADDR_IFA_FLAGS_DEPRECATED = 32,
+	RT_ADDR_IFA_FLAGS_TENTATIVE = 64,
+	RT_ADDR_IFA_FLAGS_PERMANENT = 128,
+	RT_ADDR_IFA_FLAGS_MANAGETEMPADDR = 256,
+	RT_ADDR_IFA_FLAGS_NOPREFIXROUTE = 512,
+	RT_ADDR_IFA_FLAGS_MCAUTOJOIN = 1024,
+	RT_ADDR_IFA_FLAGS_STABLE_PRIVACY = 2048,
+};
+
+struct ifaddrmsg {
+	__u8 ifa_family;
+	__u8 ifa_prefixlen;
+	__u8 ifa_flags;
+	__u8 ifa_scope;
+	__u32 ifa_index;
+};
+
+struct ifa_cacheinfo {
+	__u32 ifa_prefered;
+	__u32 ifa_valid;
+	__u32 cstamp;
+	__u32 tstamp;
+};
+
+/* Attributes */
+enum {
+	RT_ADDR_A_ADDR_ATTRS_IFA_ADDRESS = 1,
+	RT_ADDR_A_ADDR_ATTRS_IFA_LOCAL = 2,
+	RT_ADDR_A_ADDR_ATTRS_IFA_LABEL = 3,
+	RT_ADDR_A_ADDR_ATTRS_IFA_BROADCAST = 4,
+	RT_ADDR_A_ADDR_ATTRS_IFA_ANYCAST = 5,
+	RT_ADDR_A_ADDR_ATTRS_IFA_CACHEINFO = 6,
+	RT_ADDR_A_ADDR_ATTRS_IFA_MULTICAST = 7,
+	RT_ADDR_A_ADDR_ATTRS_IFA_FLAGS = 8,
+	RT_ADDR_A_ADDR_ATTRS_IFA_RT_PRIORITY = 9,
+	RT_ADDR_A_ADDR_ATTRS_IFA_TARGET_NETNSID = 10,
+	RT_ADDR_A_ADDR_ATTRS_IFA_PROTO = 11,
+};
+
+const struct ynl_family& get_ynl_rt_addr_family();
+
+/* Enums */
+std::string_view rt_addr_op_str(int op);
+std::string_view rt_addr_ifa_flags_str(rt_addr_ifa_flags value);
+
+/* Common nested types */
+/* Policies and nested encoders */
+extern struct ynl_policy_nest rt_addr_addr_attrs_nest;
+
+/* ============== NEWADDR ============== */
+/* NEWADDR - do */
+struct rt_addr_newaddr_req {
+	__u16 _nlmsg_flags{};
+
+	struct ifaddrmsg _hdr{};
+
+	std::optional<__u32> ifa_flags;
+	std::vector<__u8> ifa_address;
+	std::string ifa_label;
+	std::vector<__u8> ifa_local;
+	std::vector<__u8> ifa_cacheinfo;
+};
+
+/*
+ * Add new address
+ */
+int rt_addr_newaddr(ynl_cpp::ynl_socket&  ys, rt_addr_newaddr_req& req);
+ynl_cpp::result<void>
+rt_addr_newaddr_ex(ynl_cpp::ynl_socket&  ys, rt_addr_newaddr_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_addr_newaddr_prepare(ynl_cpp::ynl_socket&  ys, rt_addr_newaddr_req& req);
+int rt_addr_newaddr(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_addr_newaddr_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_addr_newaddr_batch(ynl_cpp::msg_batch& batch, rt_addr_newaddr_req& req);
+
+/* ============== DELADDR ============== */
+/* DELADDR - do */
+struct rt_addr_deladdr_req {
+	__u16 _nlmsg_flags{};
+
+	struct ifaddrmsg _hdr{};
+
+	std::optional<__u32> ifa_flags;
+	std::vector<__u8> ifa_address;
+	std::vector<__u8> ifa_local;
+};
+
+/*
+ * Remove address
+ */
+int rt_addr_deladdr(ynl_cpp::ynl_socket&  ys, rt_addr_deladdr_req& req);
+ynl_cpp::result<void>
+rt_addr_deladdr_ex(ynl_cpp::ynl_socket&  ys, rt_addr_deladdr_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_addr_deladdr_prepare(ynl_cpp::ynl_socket&  ys, rt_addr_deladdr_req& req);
+int rt_addr_deladdr(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_addr_deladdr_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_addr_deladdr_batch(ynl_cpp::msg_batch& batch, rt_addr_deladdr_req& req);
+
+/* ============== GETADDR ============== */
+/* GETADDR - dump */
+struct rt_addr_getaddr_req_dump {
+	struct ifaddrmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t rt_addr_getaddr_req_dump_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ifaddrmsg)) + 0;
+
+struct rt_addr_getaddr_rsp_dump {
+	struct ifaddrmsg _hdr{};
+
+	std::optional<__u32> ifa_flags;
+	std::vector<__u8> ifa_address;
+	std::string ifa_label;
+	std::vector<__u8> ifa_local;
+	std::vector<__u8> ifa_cacheinfo;
+};
+
+struct rt_addr_getaddr_rsp_list {
+	std::list<rt_addr_getaddr_rsp_dump> objs;
+};
+
+std::unique_ptr<rt_addr_getaddr_rsp_list>
+rt_addr_getaddr_dump(ynl_cpp::ynl_socket&  ys, rt_addr_getaddr_req_dump& req);
+ynl_cpp::result<std::unique_ptr<rt_addr_getaddr_rsp_list>>
+rt_addr_getaddr_dump_ex(ynl_cpp::ynl_socket&  ys,
+			rt_addr_getaddr_req_dump& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_addr_getaddr_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     rt_addr_getaddr_req_dump& req);
+std::unique_ptr<rt_addr_getaddr_rsp_list>
+rt_addr_getaddr_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<rt_addr_getaddr_rsp_list>>
+rt_addr_getaddr_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
+
+} //namespace ynl_cpp
+#endif /* _LINUX_RT_ADDR_GEN_H */
@@ -0,0 +1,2392 @@
+// SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause)
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user source */
+
+#include "rt_link-user.hpp"
+
+#include <array>
+
+#include <linux/genetlink.h>
+#include <linux/rtnetlink.h>
+
+namespace ynl_cpp {
+
+/* Enums */
+static constexpr std::array<std::string_view, 92 + 1> rt_link_op_strmap = []() {
+	std::array<std::string_view, 92 + 1> arr{};
+	arr[RTM_NEWLINK] = "getlink";
+	arr[92] = "getstats";
+	return arr;
+} ();
+
+std::string_view rt_link_op_str(int op)
+{
+	if (op < 0 || op >= (int)(rt_link_op_strmap.size()))
+		return "";
+	return rt_link_op_strmap[op];
+}
+
+static constexpr std::array<std::string_view, 18 + 1> rt_link_ifinfo_flags_strmap = []() {
+	std::array<std::string_view, 18 + 1> arr{};
+	arr[0] = "up";
+	arr[1] = "broadcast";
+	arr[2] = "debug";
+	arr[3] = "loopback";
+	arr[4] = "point-to-point";
+	arr[5] = "no-trailers";
+	arr[6] = "running";
+	arr[7] = "no-arp";
+	arr[8] = "promisc";
+	arr[9] = "all-multi";
+	arr[10] = "master";
+	arr[11] = "slave";
+	arr[12] = "multicast";
+	arr[13] = "portsel";
+	arr[14] = "auto-media";
+	arr[15] = "dynamic";
+	arr[16] = "lower-up";
+	arr[17] = "dormant";
+	arr[18] = "echo";
+	return arr;
+} ();
+
+std::string_view rt_link_ifinfo_flags_str(rt_link_ifinfo_flags value)
+{
+	value = (rt_link_ifinfo_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(rt_link_ifinfo_flags_strmap.size()))
+		return "";
+	return rt_link_ifinfo_flags_strmap[value];
+}
+
+std::string_view rt_link_vlan_protocols_str(rt_link_vlan_protocols value)
+{
+	switch ((__u32)value) {
+	case 0x8100:
+		return "8021q";
+	case 0x88a8:
+		return "8021ad";
+	}
+	return "";
+}
+
+static constexpr std::array<std::string_view, 4 + 1> rt_link_vlan_flags_strmap = []() {
+	std::array<std::string_view, 4 + 1> arr{};
+	arr[0] = "reorder-hdr";
+	arr[1] = "gvrp";
+	arr[2] = "loose-binding";
+	arr[3] = "mvrp";
+	arr[4] = "bridge-binding";
+	return arr;
+} ();
+
+std::string_view rt_link_vlan_flags_str(rt_link_vlan_flags value)
+{
+	value = (rt_link_vlan_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(rt_link_vlan_flags_strmap.size()))
+		return "";
+	return rt_link_vlan_flags_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 2 + 1> rt_link_ifla_vf_link_state_enum_strmap = []() {
+	std::array<std::string_view, 2 + 1> arr{};
+	arr[0] = "auto";
+	arr[1] = "enable";
+	arr[2] = "disable";
+	return arr;
+} ();
+
+std::string_view
+rt_link_ifla_vf_link_state_enum_str(rt_link_ifla_vf_link_state_enum value)
+{
+	if (value < 0 || value >= (int)(rt_link_ifla_vf_link_state_enum_strmap.size()))
+		return "";
+	return rt_link_ifla_vf_link_state_enum_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 7 + 1> rt_link_rtext_filter_strmap = []() {
+	std::array<std::string_view, 7 + 1> arr{};
+	arr[0] = "vf";
+	arr[1] = "brvlan";
+	arr[2] = "brvlan-compressed";
+	arr[3] = "skip-stats";
+	arr[4] = "mrp";
+	arr[5] = "cfm-config";
+	arr[6] = "cfm-status";
+	arr[7] = "mst";
+	return arr;
+} ();
+
+std::string_view rt_link_rtext_filter_str(rt_link_rtext_filter value)
+{
+	value = (rt_link_rtext_filter)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(rt_link_rtext_filter_strmap.size()))
+		return "";
+	return rt_link_rtext_filter_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 2 + 1> rt_link_netkit_policy_strmap = []() {
+	std::array<std::string_view, 2 + 1> arr{};
+	arr[0] = "forward";
+	arr[2] = "blackhole";
+	return arr;
+} ();
+
+std::string_view rt_link_netkit_policy_str(rt_link_netkit_policy value)
+{
+	if (value < 0 || value >= (int)(rt_link_netkit_policy_strmap.size()))
+		return "";
+	return rt_link_netkit_policy_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 1 + 1> rt_link_netkit_mode_strmap = []() {
+	std::array<std::string_view, 1 + 1> arr{};
+	arr[0] = "l2";
+	arr[1] = "l3";
+	return arr;
+} ();
+
+std::string_view rt_link_netkit_mode_str(rt_link_netkit_mode value)
+{
+	if (value < 0 || value >= (int)(rt_link_netkit_mode_strmap.size()))
+		return "";
+	return rt_link_netkit_mode_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 1 + 1> rt_link_netkit_scrub_strmap = []() {
+	std::array<std::string_view, 1 + 1> arr{};
+	arr[0] = "none";
+	arr[1] = "default";
+	return arr;
+} ();
+
+std::string_view rt_link_netkit_scrub_str(rt_link_netkit_scrub value)
+{
+	if (value < 0 || value >= (int)(rt_link_netkit_scrub_strmap.size()))
+		return "";
+	return rt_link_netkit_scrub_strmap[value];
+}
+
+/* Policies */
+static std::array<ynl_policy_attr,5 + 1> rt_link_linkinfo_attrs_policy = []() {
+	std::array<ynl_policy_attr,5 + 1> arr{};
+	arr[RT_LINK_A_LINKINFO_ATTRS_KIND] = { .name = "kind", .type = YNL_PT_NUL_STR, };
+	arr[RT_LINK_A_LINKINFO_ATTRS_DATA] = { .name = "data", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_LINKINFO_ATTRS_XSTATS] = { .name = "xstats", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_LINKINFO_ATTRS_SLAVE_KIND] = { .name = "slave-kind", .type = YNL_PT_NUL_STR, };
+	arr[RT_LINK_A_LINKINFO_ATTRS_SLAVE_DATA] = { .name = "slave-data", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_linkinfo_attrs_nest = {
+	.max_attr = 5,
+	.table = rt_link_linkinfo_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,0 + 1> rt_link_vf_ports_attrs_policy = []() {
+	std::array<ynl_policy_attr,0 + 1> arr{};
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_vf_ports_attrs_nest = {
+	.max_attr = 0,
+	.table = rt_link_vf_ports_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,0 + 1> rt_link_port_self_attrs_policy = []() {
+	std::array<ynl_policy_attr,0 + 1> arr{};
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_port_self_attrs_nest = {
+	.max_attr = 0,
+	.table = rt_link_port_self_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,8 + 1> rt_link_xdp_attrs_policy = []() {
+	std::array<ynl_policy_attr,8 + 1> arr{};
+	arr[RT_LINK_A_XDP_ATTRS_FD] = { .name = "fd", .type = YNL_PT_U32, };
+	arr[RT_LINK_A_XDP_ATTRS_ATTACHED] = { .name = "attached", .type = YNL_PT_U8, };
+	arr[RT_LINK_A_XDP_ATTRS_FLAGS] = { .name = "flags", .type = YNL_PT_U32, };
+	arr[RT_LINK_A_XDP_ATTRS_PROG_ID] = { .name = "prog-id", .type = YNL_PT_U32, };
+	arr[RT_LINK_A_XDP_ATTRS_DRV_PROG_ID] = { .name = "drv-prog-id", .type = YNL_PT_U32, };
+	arr[RT_LINK_A_XDP_ATTRS_SKB_PROG_ID] = { .name = "skb-prog-id", .type = YNL_PT_U32, };
+	arr[RT_LINK_A_XDP_ATTRS_HW_PROG_ID] = { .name = "hw-prog-id", .type = YNL_PT_U32, };
+	arr[RT_LINK_A_XDP_ATTRS_EXPECTED_FD] = { .name = "expected-fd", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_xdp_attrs_nest = {
+	.max_attr = 8,
+	.table = rt_link_xdp_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,1 + 1> rt_link_link_dpll_pin_attrs_policy = []() {
+	std::array<ynl_policy_attr,1 + 1> arr{};
+	arr[RT_LINK_A_LINK_DPLL_PIN_ATTRS_ID] = { .name = "id", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_link_dpll_pin_attrs_nest = {
+	.max_attr = 1,
+	.table = rt_link_link_dpll_pin_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,1 + 1> rt_link_ifla_attrs_policy = []() {
+	std::array<ynl_policy_attr,1 + 1> arr{};
+	arr[RT_LINK_A_IFLA_ATTRS_CONF] = { .name = "conf", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_ifla_attrs_nest = {
+	.max_attr = 1,
+	.table = rt_link_ifla_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,9 + 1> rt_link_ifla6_attrs_policy = []() {
+	std::array<ynl_policy_attr,9 + 1> arr{};
+	arr[RT_LINK_A_IFLA6_ATTRS_FLAGS] = { .name = "flags", .type = YNL_PT_U32, };
+	arr[RT_LINK_A_IFLA6_ATTRS_CONF] = { .name = "conf", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_IFLA6_ATTRS_STATS] = { .name = "stats", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_IFLA6_ATTRS_MCAST] = { .name = "mcast", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_IFLA6_ATTRS_CACHEINFO] = { .name = "cacheinfo", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_IFLA6_ATTRS_ICMP6_STATS] = { .name = "icmp6-stats", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_IFLA6_ATTRS_TOKEN] = { .name = "token", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_IFLA6_ATTRS_ADDR_GEN_MODE] = { .name = "addr-gen-mode", .type = YNL_PT_U8, };
+	arr[RT_LINK_A_IFLA6_ATTRS_RA_MTU] = { .name = "ra-mtu", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_ifla6_attrs_nest = {
+	.max_attr = 9,
+	.table = rt_link_ifla6_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,2 + 1> rt_link_mctp_attrs_policy = []() {
+	std::array<ynl_policy_attr,2 + 1> arr{};
+	arr[RT_LINK_A_MCTP_ATTRS_MCTP_NET] = { .name = "mctp-net", .type = YNL_PT_U32, };
+	arr[RT_LINK_A_MCTP_ATTRS_PHYS_BINDING] = { .name = "phys-binding", .type = YNL_PT_U8, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_mctp_attrs_nest = {
+	.max_attr = 2,
+	.table = rt_link_mctp_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,2 + 1> rt_link_hw_s_info_one_policy = []() {
+	std::array<ynl_policy_attr,2 + 1> arr{};
+	arr[RT_LINK_A_HW_S_INFO_ONE_REQUEST] = { .name = "request", .type = YNL_PT_U8, };
+	arr[RT_LINK_A_HW_S_INFO_ONE_USED] = { .name = "used", .type = YNL_PT_U8, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_hw_s_info_one_nest = {
+	.max_attr = 2,
+	.table = rt_link_hw_s_info_one_policy.data(),
+};
+
+static std::array<ynl_policy_attr,8 + 1> rt_link_vf_stats_attrs_policy = []() {
+	std::array<ynl_policy_attr,8 + 1> arr{};
+	arr[RT_LINK_A_VF_STATS_ATTRS_RX_PACKETS] = { .name = "rx-packets", .type = YNL_PT_U64, };
+	arr[RT_LINK_A_VF_STATS_ATTRS_TX_PACKETS] = { .name = "tx-packets", .type = YNL_PT_U64, };
+	arr[RT_LINK_A_VF_STATS_ATTRS_RX_BYTES] = { .name = "rx-bytes", .type = YNL_PT_U64, };
+	arr[RT_LINK_A_VF_STATS_ATTRS_TX_BYTES] = { .name = "tx-bytes", .type = YNL_PT_U64, };
+	arr[RT_LINK_A_VF_STATS_ATTRS_BROADCAST] = { .name = "broadcast", .type = YNL_PT_U64, };
+	arr[RT_LINK_A_VF_STATS_ATTRS_MULTICAST] = { .name = "multicast", .type = YNL_PT_U64, };
+	arr[RT_LINK_A_VF_STATS_ATTRS_PAD] = { .name = "pad", .type = YNL_PT_IGNORE, };
+	arr[RT_LINK_A_VF_STATS_ATTRS_RX_DROPPED] = { .name = "rx-dropped", .type = YNL_PT_U64, };
+	arr[RT_LINK_A_VF_STATS_ATTRS_TX_DROPPED] = { .name = "tx-dropped", .type = YNL_PT_U64, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_vf_stats_attrs_nest = {
+	.max_attr = 8,
+	.table = rt_link_vf_stats_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,1 + 1> rt_link_vf_vlan_attrs_policy = []() {
+	std::array<ynl_policy_attr,1 + 1> arr{};
+	arr[RT_LINK_A_VF_VLAN_ATTRS_INFO] = { .name = "info", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_vf_vlan_attrs_nest = {
+	.max_attr = 1,
+	.table = rt_link_vf_vlan_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,45 + 1> rt_link_af_spec_attrs_policy = []() {
+	std::array<ynl_policy_attr,45 + 1> arr{};
+	arr[RT_LINK_A_AF_SPEC_ATTRS_INET] = { .name = "inet", .type = YNL_PT_NEST, .nest = &rt_link_ifla_attrs_nest, };
+	arr[RT_LINK_A_AF_SPEC_ATTRS_INET6] = { .name = "inet6", .type = YNL_PT_NEST, .nest = &rt_link_ifla6_attrs_nest, };
+	arr[RT_LINK_A_AF_SPEC_ATTRS_MCTP] = { .name = "mctp", .type = YNL_PT_NEST, .nest = &rt_link_mctp_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_af_spec_attrs_nest = {
+	.max_attr = 45,
+	.table = rt_link_af_spec_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,3 + 1> rt_link_link_offload_xstats_policy = []() {
+	std::array<ynl_policy_attr,3 + 1> arr{};
+	arr[RT_LINK_A_LINK_OFFLOAD_XSTATS_CPU_HIT] = { .name = "cpu-hit", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_LINK_OFFLOAD_XSTATS_HW_S_INFO] = { .name = "hw-s-info", .type = YNL_PT_NEST, .nest = &rt_link_hw_s_info_one_nest, };
+	arr[RT_LINK_A_LINK_OFFLOAD_XSTATS_L3_STATS] = { .name = "l3-stats", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_link_offload_xstats_nest = {
+	.max_attr = 3,
+	.table = rt_link_link_offload_xstats_policy.data(),
+};
+
+static std::array<ynl_policy_attr,13 + 1> rt_link_vfinfo_attrs_policy = []() {
+	std::array<ynl_policy_attr,13 + 1> arr{};
+	arr[RT_LINK_A_VFINFO_ATTRS_MAC] = { .name = "mac", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_VFINFO_ATTRS_VLAN] = { .name = "vlan", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_VFINFO_ATTRS_TX_RATE] = { .name = "tx-rate", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_VFINFO_ATTRS_SPOOFCHK] = { .name = "spoofchk", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_VFINFO_ATTRS_LINK_STATE] = { .name = "link-state", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_VFINFO_ATTRS_RATE] = { .name = "rate", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_VFINFO_ATTRS_RSS_QUERY_EN] = { .name = "rss-query-en", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_VFINFO_ATTRS_STATS] = { .name = "stats", .type = YNL_PT_NEST, .nest = &rt_link_vf_stats_attrs_nest, };
+	arr[RT_LINK_A_VFINFO_ATTRS_TRUST] = { .name = "trust", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_VFINFO_ATTRS_IB_NODE_GUID] = { .name = "ib-node-guid", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_VFINFO_ATTRS_IB_PORT_GUID] = { .name = "ib-port-guid", .type = YNL_PT_BINARY,};
+	arr[RT_LINK_A_VFINFO_ATTRS_VLAN_LIST] = { .name = "vlan-list", .type = YNL_PT_NEST, .nest = &rt_link_vf_vlan_attrs_nest, };
+	arr[RT_LINK_A_VFINFO_ATTRS_BROADCAST] = { .name = "broadcast", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_vfinfo_attrs_nest = {
+	.max_attr = 13,
+	.table = rt_link_vfinfo_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,1 + 1> rt_link_vfinfo_list_attrs_policy = []() {
+	std::array<ynl_policy_attr,1 + 1> arr{};
+	arr[RT_LINK_A_VFINFO_LIST_ATTRS_INFO] = { .name = "info", .type = YNL_PT_NEST, .nest = &rt_link_vfinfo_attrs_nest, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_vfinfo_list_attrs_nest = {
+	.max_attr = 1,
+	.table = rt_link_vfinfo_list_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,66 + 1> rt_link_link_attrs_policy = []() {
+	std::array<ynl_policy_attr,66 + 1> arr{};
+	arr[IFLA_ADDRESS] = { .name = "address", .type = YNL_PT_BINARY,};
+	arr[IFLA_BROADCAST] = { .name = "broadcast", .type = YNL_PT_BINARY,};
+	arr[IFLA_IFNAME] = { .name = "ifname", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_MTU] = { .name = "mtu", .type = YNL_PT_U32, };
+	arr[IFLA_LINK] = { .name = "link", .type = YNL_PT_U32, };
+	arr[IFLA_QDISC] = { .name = "qdisc", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_STATS] = { .name = "stats", .type = YNL_PT_BINARY,};
+	arr[IFLA_COST] = { .name = "cost", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_PRIORITY] = { .name = "priority", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_MASTER] = { .name = "master", .type = YNL_PT_U32, };
+	arr[IFLA_WIRELESS] = { .name = "wireless", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_PROTINFO] = { .name = "protinfo", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_TXQLEN] = { .name = "txqlen", .type = YNL_PT_U32, };
+	arr[IFLA_MAP] = { .name = "map", .type = YNL_PT_BINARY,};
+	arr[IFLA_WEIGHT] = { .name = "weight", .type = YNL_PT_U32, };
+	arr[IFLA_OPERSTATE] = { .name = "operstate", .type = YNL_PT_U8, };
+	arr[IFLA_LINKMODE] = { .name = "linkmode", .type = YNL_PT_U8, };
+	arr[IFLA_LINKINFO] = { .name = "linkinfo", .type = YNL_PT_NEST, .nest = &rt_link_linkinfo_attrs_nest, };
+	arr[IFLA_NET_NS_PID] = { .name = "net-ns-pid", .type = YNL_PT_U32, };
+	arr[IFLA_IFALIAS] = { .name = "ifalias", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_NUM_VF] = { .name = "num-vf", .type = YNL_PT_U32, };
+	arr[IFLA_VFINFO_LIST] = { .name = "vfinfo-list", .type = YNL_PT_NEST, .nest = &rt_link_vfinfo_list_attrs_nest, };
+	arr[IFLA_STATS64] = { .name = "stats64", .type = YNL_PT_BINARY,};
+	arr[IFLA_VF_PORTS] = { .name = "vf-ports", .type = YNL_PT_NEST, .nest = &rt_link_vf_ports_attrs_nest, };
+	arr[IFLA_PORT_SELF] = { .name = "port-self", .type = YNL_PT_NEST, .nest = &rt_link_port_self_attrs_nest, };
+	arr[IFLA_AF_SPEC] = { .name = "af-spec", .type = YNL_PT_NEST, .nest = &rt_link_af_spec_attrs_nest, };
+	arr[IFLA_GROUP] = { .name = "group", .type = YNL_PT_U32, };
+	arr[IFLA_NET_NS_FD] = { .name = "net-ns-fd", .type = YNL_PT_U32, };
+	arr[IFLA_EXT_MASK] = { .name = "ext-mask", .type = YNL_PT_U32, };
+	arr[IFLA_PROMISCUITY] = { .name = "promiscuity", .type = YNL_PT_U32, };
+	arr[IFLA_NUM_TX_QUEUES] = { .name = "num-tx-queues", .type = YNL_PT_U32, };
+	arr[IFLA_NUM_RX_QUEUES] = { .name = "num-rx-queues", .type = YNL_PT_U32, };
+	arr[IFLA_CARRIER] = { .name = "carrier", .type = YNL_PT_U8, };
+	arr[IFLA_PHYS_PORT_ID] = { .name = "phys-port-id", .type = YNL_PT_BINARY,};
+	arr[IFLA_CARRIER_CHANGES] = { .name = "carrier-changes", .type = YNL_PT_U32, };
+	arr[IFLA_PHYS_SWITCH_ID] = { .name = "phys-switch-id", .type = YNL_PT_BINARY,};
+	arr[IFLA_LINK_NETNSID] = { .name = "link-netnsid", .type = YNL_PT_U32, };
+	arr[IFLA_PHYS_PORT_NAME] = { .name = "phys-port-name", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_PROTO_DOWN] = { .name = "proto-down", .type = YNL_PT_U8, };
+	arr[IFLA_GSO_MAX_SEGS] = { .name = "gso-max-segs", .type = YNL_PT_U32, };
+	arr[IFLA_GSO_MAX_SIZE] = { .name = "gso-max-size", .type = YNL_PT_U32, };
+	arr[IFLA_PAD] = { .name = "pad", .type = YNL_PT_IGNORE, };
+	arr[IFLA_XDP] = { .name = "xdp", .type = YNL_PT_NEST, .nest = &rt_link_xdp_attrs_nest, };
+	arr[IFLA_EVENT] = { .name = "event", .type = YNL_PT_U32, };
+	arr[IFLA_NEW_NETNSID] = { .name = "new-netnsid", .type = YNL_PT_U32, };
+	arr[IFLA_TARGET_NETNSID] = { .name = "target-netnsid", .type = YNL_PT_U32, };
+	arr[IFLA_CARRIER_UP_COUNT] = { .name = "carrier-up-count", .type = YNL_PT_U32, };
+	arr[IFLA_CARRIER_DOWN_COUNT] = { .name = "carrier-down-count", .type = YNL_PT_U32, };
+	arr[IFLA_NEW_IFINDEX] = { .name = "new-ifindex", .type = YNL_PT_U32, };
+	arr[IFLA_MIN_MTU] = { .name = "min-mtu", .type = YNL_PT_U32, };
+	arr[IFLA_MAX_MTU] = { .name = "max-mtu", .type = YNL_PT_U32, };
+	arr[IFLA_PROP_LIST] = { .name = "prop-list", .type = YNL_PT_BINARY,};
+	arr[IFLA_ALT_IFNAME] = { .name = "alt-ifname", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_PERM_ADDRESS] = { .name = "perm-address", .type = YNL_PT_BINARY,};
+	arr[IFLA_PROTO_DOWN_REASON] = { .name = "proto-down-reason", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_PARENT_DEV_NAME] = { .name = "parent-dev-name", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_PARENT_DEV_BUS_NAME] = { .name = "parent-dev-bus-name", .type = YNL_PT_NUL_STR, };
+	arr[IFLA_GRO_MAX_SIZE] = { .name = "gro-max-size", .type = YNL_PT_U32, };
+	arr[IFLA_TSO_MAX_SIZE] = { .name = "tso-max-size", .type = YNL_PT_U32, };
+	arr[IFLA_TSO_MAX_SEGS] = { .name = "tso-max-segs", .type = YNL_PT_U32, };
+	arr[IFLA_ALLMULTI] = { .name = "allmulti", .type = YNL_PT_U32, };
+	arr[IFLA_DEVLINK_PORT] = { .name = "devlink-port", .type = YNL_PT_BINARY,};
+	arr[IFLA_GSO_IPV4_MAX_SIZE] = { .name = "gso-ipv4-max-size", .type = YNL_PT_U32, };
+	arr[IFLA_GRO_IPV4_MAX_SIZE] = { .name = "gro-ipv4-max-size", .type = YNL_PT_U32, };
+	arr[IFLA_DPLL_PIN] = { .name = "dpll-pin", .type = YNL_PT_NEST, .nest = &rt_link_link_dpll_pin_attrs_nest, };
+	arr[IFLA_MAX_PACING_OFFLOAD_HORIZON] = { .name = "max-pacing-offload-horizon", .type = YNL_PT_UINT, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_link_attrs_nest = {
+	.max_attr = 66,
+	.table = rt_link_link_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,5 + 1> rt_link_stats_attrs_policy = []() {
+	std::array<ynl_policy_attr,5 + 1> arr{};
+	arr[IFLA_STATS_LINK_64] = { .name = "link-64", .type = YNL_PT_BINARY,};
+	arr[IFLA_STATS_LINK_XSTATS] = { .name = "link-xstats", .type = YNL_PT_BINARY,};
+	arr[IFLA_STATS_LINK_XSTATS_SLAVE] = { .name = "link-xstats-slave", .type = YNL_PT_BINARY,};
+	arr[IFLA_STATS_LINK_OFFLOAD_XSTATS] = { .name = "link-offload-xstats", .type = YNL_PT_NEST, .nest = &rt_link_link_offload_xstats_nest, };
+	arr[IFLA_STATS_AF_SPEC] = { .name = "af-spec", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_link_stats_attrs_nest = {
+	.max_attr = 5,
+	.table = rt_link_stats_attrs_policy.data(),
+};
+
+/* Common nested types */
+int rt_link_linkinfo_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const rt_link_linkinfo_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.kind.size() > 0)
+		ynl_attr_put_str(nlh, RT_LINK_A_LINKINFO_ATTRS_KIND, obj.kind.data());
+	if (obj.data.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_LINKINFO_ATTRS_DATA, obj.data.data(), obj.data.size());
+	if (obj.xstats.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_LINKINFO_ATTRS_XSTATS, obj.xstats.data(), obj.xstats.size());
+	if (obj.slave_kind.size() > 0)
+		ynl_attr_put_str(nlh, RT_LINK_A_LINKINFO_ATTRS_SLAVE_KIND, obj.slave_kind.data());
+	if (obj.slave_data.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_LINKINFO_ATTRS_SLAVE_DATA, obj.slave_data.data(), obj.slave_data.size());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_linkinfo_attrs_parse(struct ynl_parse_arg *yarg,
+				 const struct nlattr *nested)
+{
+	rt_link_linkinfo_attrs *dst = (rt_link_linkinfo_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_LINKINFO_ATTRS_KIND) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->kind.assign(ynl_attr_get_str(attr));
+		} else if (type == RT_LINK_A_LINKINFO_ATTRS_DATA) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "sub-message");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->data.assign(data, data + len);
+		} else if (type == RT_LINK_A_LINKINFO_ATTRS_XSTATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->xstats.assign(data, data + len);
+		} else if (type == RT_LINK_A_LINKINFO_ATTRS_SLAVE_KIND) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->slave_kind.assign(ynl_attr_get_str(attr));
+		} else if (type == RT_LINK_A_LINKINFO_ATTRS_SLAVE_DATA) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "sub-message");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->slave_data.assign(data, data + len);
+		}
+	}
+
+	return 0;
+}
+
+int rt_link_vf_ports_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const rt_link_vf_ports_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_vf_ports_attrs_parse(struct ynl_parse_arg *yarg,
+				 const struct nlattr *nested)
+{
+	rt_link_vf_ports_attrs *dst = (rt_link_vf_ports_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+	}
+
+	return 0;
+}
+
+int rt_link_port_self_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				const rt_link_port_self_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_port_self_attrs_parse(struct ynl_parse_arg *yarg,
+				  const struct nlattr *nested)
+{
+	rt_link_port_self_attrs *dst = (rt_link_port_self_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+	}
+
+	return 0;
+}
+
+int rt_link_xdp_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			  const rt_link_xdp_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.fd.has_value())
+		ynl_attr_put_s32(nlh, RT_LINK_A_XDP_ATTRS_FD, obj.fd.value());
+	if (obj.attached.has_value())
+		ynl_attr_put_u8(nlh, RT_LINK_A_XDP_ATTRS_ATTACHED, obj.attached.value());
+	if (obj.flags.has_value())
+		ynl_attr_put_u32(nlh, RT_LINK_A_XDP_ATTRS_FLAGS, obj.flags.value());
+	if (obj.prog_id.has_value())
+		ynl_attr_put_u32(nlh, RT_LINK_A_XDP_ATTRS_PROG_ID, obj.prog_id.value());
+	if (obj.drv_prog_id.has_value())
+		ynl_attr_put_u32(nlh, RT_LINK_A_XDP_ATTRS_DRV_PROG_ID, obj.drv_prog_id.value());
+	if (obj.skb_prog_id.has_value())
+		ynl_attr_put_u32(nlh, RT_LINK_A_XDP_ATTRS_SKB_PROG_ID, obj.skb_prog_id.value());
+	if (obj.hw_prog_id.has_value())
+		ynl_attr_put_u32(nlh, RT_LINK_A_XDP_ATTRS_HW_PROG_ID, obj.hw_prog_id.value());
+	if (obj.expected_fd.has_value())
+		ynl_attr_put_s32(nlh, RT_LINK_A_XDP_ATTRS_EXPECTED_FD, obj.expected_fd.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_xdp_attrs_parse(struct ynl_parse_arg *yarg,
+			    const struct nlattr *nested)
+{
+	rt_link_xdp_attrs *dst = (rt_link_xdp_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_XDP_ATTRS_FD) {
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
+			dst->fd = (__s32)ynl_attr_get_s32(attr);
+		} else if (type == RT_LINK_A_XDP_ATTRS_ATTACHED) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->attached = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == RT_LINK_A_XDP_ATTRS_FLAGS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->flags = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_LINK_A_XDP_ATTRS_PROG_ID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->prog_id = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_LINK_A_XDP_ATTRS_DRV_PROG_ID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->drv_prog_id = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_LINK_A_XDP_ATTRS_SKB_PROG_ID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->skb_prog_id = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_LINK_A_XDP_ATTRS_HW_PROG_ID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->hw_prog_id = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_LINK_A_XDP_ATTRS_EXPECTED_FD) {
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
+			dst->expected_fd = (__s32)ynl_attr_get_s32(attr);
+		}
+	}
+
+	return 0;
+}
+
+int rt_link_ifla_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			   const rt_link_ifla_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.conf.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_IFLA_ATTRS_CONF, obj.conf.data(), obj.conf.size());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_ifla_attrs_parse(struct ynl_parse_arg *yarg,
+			     const struct nlattr *nested)
+{
+	rt_link_ifla_attrs *dst = (rt_link_ifla_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_IFLA_ATTRS_CONF) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->conf.assign(data, data + len);
+		}
+	}
+
+	return 0;
+}
+
+int rt_link_ifla6_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			    const rt_link_ifla6_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.flags.has_value())
+		ynl_attr_put_u32(nlh, RT_LINK_A_IFLA6_ATTRS_FLAGS, obj.flags.value());
+	if (obj.conf.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_IFLA6_ATTRS_CONF, obj.conf.data(), obj.conf.size());
+	if (obj.stats.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_IFLA6_ATTRS_STATS, obj.stats.data(), obj.stats.size());
+	if (obj.mcast.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_IFLA6_ATTRS_MCAST, obj.mcast.data(), obj.mcast.size());
+	if (obj.cacheinfo.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_IFLA6_ATTRS_CACHEINFO, obj.cacheinfo.data(), obj.cacheinfo.size());
+	if (obj.icmp6_stats.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_IFLA6_ATTRS_ICMP6_STATS, obj.icmp6_stats.data(), obj.icmp6_stats.size());
+	if (obj.token.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_IFLA6_ATTRS_TOKEN, obj.token.data(), obj.token.size());
+	if (obj.addr_gen_mode.has_value())
+		ynl_attr_put_u8(nlh, RT_LINK_A_IFLA6_ATTRS_ADDR_GEN_MODE, obj.addr_gen_mode.value());
+	if (obj.ra_mtu.has_value())
+		ynl_attr_put_u32(nlh, RT_LINK_A_IFLA6_ATTRS_RA_MTU, obj.ra_mtu.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_ifla6_attrs_parse(struct ynl_parse_arg *yarg,
+			      const struct nlattr *nested)
+{
+	rt_link_ifla6_attrs *dst = (rt_link_ifla6_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_IFLA6_ATTRS_FLAGS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->flags = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_LINK_A_IFLA6_ATTRS_CONF) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->conf.assign(data, data + len);
+		} else if (type == RT_LINK_A_IFLA6_ATTRS_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->stats.assign(data, data + len);
+		} else if (type == RT_LINK_A_IFLA6_ATTRS_MCAST) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->mcast.assign(data, data + len);
+		} else if (type == RT_LINK_A_IFLA6_ATTRS_CACHEINFO) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->cacheinfo.assign(data, data + len);
+		} else if (type == RT_LINK_A_IFLA6_ATTRS_ICMP6_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->icmp6_stats.assign(data, data + len);
+		} else if (type == RT_LINK_A_IFLA6_ATTRS_TOKEN) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->token.assign(data, data + len);
+		} else if (type == RT_LINK_A_IFLA6_ATTRS_ADDR_GEN_MODE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->addr_gen_mode = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == RT_LINK_A_IFLA6_ATTRS_RA_MTU) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ra_mtu = (__u32)ynl_attr_get_u32(attr);
+		}
+	}
+
+	return 0;
+}
+
+int rt_link_mctp_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			   const rt_link_mctp_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.mctp_net.has_value())
+		ynl_attr_put_u32(nlh, RT_LINK_A_MCTP_ATTRS_MCTP_NET, obj.mctp_net.value());
+	if (obj.phys_binding.has_value())
+		ynl_attr_put_u8(nlh, RT_LINK_A_MCTP_ATTRS_PHYS_BINDING, obj.phys_binding.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_mctp_attrs_parse(struct ynl_parse_arg *yarg,
+			     const struct nlattr *nested)
+{
+	rt_link_mctp_attrs *dst = (rt_link_mctp_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_MCTP_ATTRS_MCTP_NET) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->mctp_net = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_LINK_A_MCTP_ATTRS_PHYS_BINDING) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->phys_binding = (__u8)ynl_attr_get_u8(attr);
+		}
+	}
+
+	return 0;
+}
+
+int rt_link_hw_s_info_one_parse(struct ynl_parse_arg *yarg,
+				const struct nlattr *nested, __u32 idx)
+{
+	rt_link_hw_s_info_one *dst = (rt_link_hw_s_info_one *)yarg->data;
+	const struct nlattr *attr;
+
+	dst->idx = idx;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_HW_S_INFO_ONE_REQUEST) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->request = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == RT_LINK_A_HW_S_INFO_ONE_USED) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->used = (__u8)ynl_attr_get_u8(attr);
+		}
+	}
+
+	return 0;
+}
+
+int rt_link_vf_stats_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const rt_link_vf_stats_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.rx_packets.has_value())
+		ynl_attr_put_u64(nlh, RT_LINK_A_VF_STATS_ATTRS_RX_PACKETS, obj.rx_packets.value());
+	if (obj.tx_packets.has_value())
+		ynl_attr_put_u64(nlh, RT_LINK_A_VF_STATS_ATTRS_TX_PACKETS, obj.tx_packets.value());
+	if (obj.rx_bytes.has_value())
+		ynl_attr_put_u64(nlh, RT_LINK_A_VF_STATS_ATTRS_RX_BYTES, obj.rx_bytes.value());
+	if (obj.tx_bytes.has_value())
+		ynl_attr_put_u64(nlh, RT_LINK_A_VF_STATS_ATTRS_TX_BYTES, obj.tx_bytes.value());
+	if (obj.broadcast.has_value())
+		ynl_attr_put_u64(nlh, RT_LINK_A_VF_STATS_ATTRS_BROADCAST, obj.broadcast.value());
+	if (obj.multicast.has_value())
+		ynl_attr_put_u64(nlh, RT_LINK_A_VF_STATS_ATTRS_MULTICAST, obj.multicast.value());
+	if (obj.rx_dropped.has_value())
+		ynl_attr_put_u64(nlh, RT_LINK_A_VF_STATS_ATTRS_RX_DROPPED, obj.rx_dropped.value());
+	if (obj.tx_dropped.has_value())
+		ynl_attr_put_u64(nlh, RT_LINK_A_VF_STATS_ATTRS_TX_DROPPED, obj.tx_dropped.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_vf_stats_attrs_parse(struct ynl_parse_arg *yarg,
+				 const struct nlattr *nested)
+{
+	rt_link_vf_stats_attrs *dst = (rt_link_vf_stats_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_VF_STATS_ATTRS_RX_PACKETS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->rx_packets = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_LINK_A_VF_STATS_ATTRS_TX_PACKETS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->tx_packets = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_LINK_A_VF_STATS_ATTRS_RX_BYTES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->rx_bytes = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_LINK_A_VF_STATS_ATTRS_TX_BYTES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->tx_bytes = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_LINK_A_VF_STATS_ATTRS_BROADCAST) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->broadcast = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_LINK_A_VF_STATS_ATTRS_MULTICAST) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->multicast = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_LINK_A_VF_STATS_ATTRS_RX_DROPPED) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->rx_dropped = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_LINK_A_VF_STATS_ATTRS_TX_DROPPED) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->tx_dropped = (__u64)ynl_attr_get_u64(attr);
+		}
+	}
+
+	return 0;
+}
+
+int rt_link_vf_vlan_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			      const rt_link_vf_vlan_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	for (unsigned int i = 0; i < obj.info.size(); i++)
+		ynl_attr_put(nlh, RT_LINK_A_VF_VLAN_ATTRS_INFO, obj.info[i].data(), obj.info[i].size());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_vf_vlan_attrs_parse(struct ynl_parse_arg *yarg,
+				const struct nlattr *nested)
+{
+	rt_link_vf_vlan_attrs *dst = (rt_link_vf_vlan_attrs *)yarg->data;
+	const struct nlattr *attr;
+	unsigned int n_info = 0;
+	int i;
+
+	if (dst->info.size() > 0)
+		return ynl_error_parse(yarg, "attribute already present (vf-vlan-attrs.info)");
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_VF_VLAN_ATTRS_INFO) {
+			n_info++;
+		}
+	}
+
+	if (n_info) {
+		dst->info.resize(n_info);
+		i = 0;
+		ynl_attr_for_each_nested(attr, nested) {
+			if (ynl_attr_type(attr) == RT_LINK_A_VF_VLAN_ATTRS_INFO) {
+				__u8 *data = (__u8*)ynl_attr_data(attr);
+
+				dst->info[i].assign(data, data + ynl_attr_data_len(attr));
+				i++;
+			}
+		}
+	}
+
+	return 0;
+}
+
+int rt_link_af_spec_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			      const rt_link_af_spec_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.inet.has_value())
+		rt_link_ifla_attrs_put(nlh, RT_LINK_A_AF_SPEC_ATTRS_INET, obj.inet.value());
+	if (obj.inet6.has_value())
+		rt_link_ifla6_attrs_put(nlh, RT_LINK_A_AF_SPEC_ATTRS_INET6, obj.inet6.value());
+	if (obj.mctp.has_value())
+		rt_link_mctp_attrs_put(nlh, RT_LINK_A_AF_SPEC_ATTRS_MCTP, obj.mctp.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_af_spec_attrs_parse(struct ynl_parse_arg *yarg,
+				const struct nlattr *nested)
+{
+	rt_link_af_spec_attrs *dst = (rt_link_af_spec_attrs *)yarg->data;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+
+	parg.ys = yarg->ys;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_AF_SPEC_ATTRS_INET) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_ifla_attrs_nest;
+			parg.data = &dst->inet.emplace();
+			if (rt_link_ifla_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == RT_LINK_A_AF_SPEC_ATTRS_INET6) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_ifla6_attrs_nest;
+			parg.data = &dst->inet6.emplace();
+			if (rt_link_ifla6_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == RT_LINK_A_AF_SPEC_ATTRS_MCTP) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_mctp_attrs_nest;
+			parg.data = &dst->mctp.emplace();
+			if (rt_link_mctp_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		}
+	}
+
+	return 0;
+}
+
+int rt_link_link_offload_xstats_parse(struct ynl_parse_arg *yarg,
+				      const struct nlattr *nested)
+{
+	rt_link_link_offload_xstats *dst = (rt_link_link_offload_xstats *)yarg->data;
+	const struct nlattr *attr_hw_s_info;
+	unsigned int n_hw_s_info = 0;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	int i;
+
+	parg.ys = yarg->ys;
+
+	if (dst->hw_s_info.size() > 0)
+		return ynl_error_parse(yarg, "attribute already present (link-offload-xstats.hw-s-info)");
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_LINK_OFFLOAD_XSTATS_CPU_HIT) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->cpu_hit.assign(data, data + len);
+		} else if (type == RT_LINK_A_LINK_OFFLOAD_XSTATS_HW_S_INFO) {
+			const struct nlattr *attr2;
+
+			attr_hw_s_info = attr;
+			ynl_attr_for_each_nested(attr2, attr)
+				n_hw_s_info++;
+		} else if (type == RT_LINK_A_LINK_OFFLOAD_XSTATS_L3_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->l3_stats.assign(data, data + len);
+		}
+	}
+
+	if (n_hw_s_info) {
+		dst->hw_s_info.resize(n_hw_s_info);
+		i = 0;
+		parg.rsp_policy = &rt_link_hw_s_info_one_nest;
+		ynl_attr_for_each_nested(attr, attr_hw_s_info) {
+			parg.data = &dst->hw_s_info[i];
+			if (rt_link_hw_s_info_one_parse(&parg, attr, ynl_attr_type(attr)))
+				return YNL_PARSE_CB_ERROR;
+			i++;
+		}
+	}
+
+	return 0;
+}
+
+int rt_link_vfinfo_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			     const rt_link_vfinfo_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.mac.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_VFINFO_ATTRS_MAC, obj.mac.data(), obj.mac.size());
+	if (obj.vlan.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_VFINFO_ATTRS_VLAN, obj.vlan.data(), obj.vlan.size());
+	if (obj.tx_rate.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_VFINFO_ATTRS_TX_RATE, obj.tx_rate.data(), obj.tx_rate.size());
+	if (obj.spoofchk.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_VFINFO_ATTRS_SPOOFCHK, obj.spoofchk.data(), obj.spoofchk.size());
+	if (obj.link_state.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_VFINFO_ATTRS_LINK_STATE, obj.link_state.data(), obj.link_state.size());
+	if (obj.rate.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_VFINFO_ATTRS_RATE, obj.rate.data(), obj.rate.size());
+	if (obj.rss_query_en.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_VFINFO_ATTRS_RSS_QUERY_EN, obj.rss_query_en.data(), obj.rss_query_en.size());
+	if (obj.stats.has_value())
+		rt_link_vf_stats_attrs_put(nlh, RT_LINK_A_VFINFO_ATTRS_STATS, obj.stats.value());
+	if (obj.trust.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_VFINFO_ATTRS_TRUST, obj.trust.data(), obj.trust.size());
+	if (obj.ib_node_guid.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_VFINFO_ATTRS_IB_NODE_GUID, obj.ib_node_guid.data(), obj.ib_node_guid.size());
+	if (obj.ib_port_guid.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_VFINFO_ATTRS_IB_PORT_GUID, obj.ib_port_guid.data(), obj.ib_port_guid.size());
+	if (obj.vlan_list.has_value())
+		rt_link_vf_vlan_attrs_put(nlh, RT_LINK_A_VFINFO_ATTRS_VLAN_LIST, obj.vlan_list.value());
+	if (obj.broadcast.size() > 0)
+		ynl_attr_put(nlh, RT_LINK_A_VFINFO_ATTRS_BROADCAST, obj.broadcast.data(), obj.broadcast.size());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_vfinfo_attrs_parse(struct ynl_parse_arg *yarg,
+			       const struct nlattr *nested)
+{
+	rt_link_vfinfo_attrs *dst = (rt_link_vfinfo_attrs *)yarg->data;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+
+	parg.ys = yarg->ys;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_VFINFO_ATTRS_MAC) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->mac.assign(data, data + len);
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_VLAN) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->vlan.assign(data, data + len);
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_TX_RATE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->tx_rate.assign(data, data + len);
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_SPOOFCHK) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->spoofchk.assign(data, data + len);
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_LINK_STATE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->link_state.assign(data, data + len);
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_RATE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rate.assign(data, data + len);
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_RSS_QUERY_EN) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rss_query_en.assign(data, data + len);
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_STATS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_vf_stats_attrs_nest;
+			parg.data = &dst->stats.emplace();
+			if (rt_link_vf_stats_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_TRUST) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->trust.assign(data, data + len);
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_IB_NODE_GUID) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ib_node_guid.assign(data, data + len);
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_IB_PORT_GUID) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->ib_port_guid.assign(data, data + len);
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_VLAN_LIST) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_vf_vlan_attrs_nest;
+			parg.data = &dst->vlan_list.emplace();
+			if (rt_link_vf_vlan_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == RT_LINK_A_VFINFO_ATTRS_BROADCAST) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->broadcast.assign(data, data + len);
+		}
+	}
+
+	return 0;
+}
+
+int rt_link_vfinfo_list_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				  const rt_link_vfinfo_list_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	for (unsigned int i = 0; i < obj.info.size(); i++)
+		rt_link_vfinfo_attrs_put(nlh, RT_LINK_A_VFINFO_LIST_ATTRS_INFO, obj.info[i]);
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_link_vfinfo_list_attrs_parse(struct ynl_parse_arg *yarg,
+				    const struct nlattr *nested)
+{
+	rt_link_vfinfo_list_attrs *dst = (rt_link_vfinfo_list_attrs *)yarg->data;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	unsigned int n_info = 0;
+	int i;
+
+	parg.ys = yarg->ys;
+
+	if (dst->info.size() > 0)
+		return ynl_error_parse(yarg, "attribute already present (vfinfo-list-attrs.info)");
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_LINK_A_VFINFO_LIST_ATTRS_INFO) {
+			n_info++;
+		}
+	}
+
+	if (n_info) {
+		dst->info.resize(n_info);
+		i = 0;
+		parg.rsp_policy = &rt_link_vfinfo_attrs_nest;
+		ynl_attr_for_each_nested(attr, nested) {
+			if (ynl_attr_type(attr) == RT_LINK_A_VFINFO_LIST_ATTRS_INFO) {
+				parg.data = &dst->info[i];
+				if (rt_link_vfinfo_attrs_parse(&parg, attr))
+					return YNL_PARSE_CB_ERROR;
+				i++;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/* ============== NEWLINK ============== */
+/* NEWLINK - do */
+static void rt_link_newlink_put(struct nlmsghdr *nlh, rt_link_newlink_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ifinfomsg)) + 128 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.net_ns_pid.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_NET_NS_PID, req.net_ns_pid.value());
+	if (req.net_ns_fd.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_NET_NS_FD, req.net_ns_fd.value());
+	if (req.target_netnsid.has_value())
+		ynl_attr_put_s32_unchecked(nlh, IFLA_TARGET_NETNSID, req.target_netnsid.value());
+	if (req.link_netnsid.has_value())
+		ynl_attr_put_s32_unchecked(nlh, IFLA_LINK_NETNSID, req.link_netnsid.value());
+	if (req.group.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GROUP, req.group.value());
+	if (req.num_tx_queues.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_NUM_TX_QUEUES, req.num_tx_queues.value());
+	if (req.num_rx_queues.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_NUM_RX_QUEUES, req.num_rx_queues.value());
+	if (req.mtu.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_MTU, req.mtu.value());
+	if (req.txqlen.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_TXQLEN, req.txqlen.value());
+	if (req.operstate.has_value())
+		ynl_attr_put_u8_unchecked(nlh, IFLA_OPERSTATE, req.operstate.value());
+	if (req.linkmode.has_value())
+		ynl_attr_put_u8_unchecked(nlh, IFLA_LINKMODE, req.linkmode.value());
+	if (req.gso_max_size.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GSO_MAX_SIZE, req.gso_max_size.value());
+	if (req.gso_max_segs.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GSO_MAX_SEGS, req.gso_max_segs.value());
+	if (req.gro_max_size.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GRO_MAX_SIZE, req.gro_max_size.value());
+	if (req.gso_ipv4_max_size.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GSO_IPV4_MAX_SIZE, req.gso_ipv4_max_size.value());
+	if (req.gro_ipv4_max_size.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GRO_IPV4_MAX_SIZE, req.gro_ipv4_max_size.value());
+	if (req.ifname.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_IFNAME, req.ifname.data());
+	if (req.linkinfo.has_value())
+		rt_link_linkinfo_attrs_put(nlh, IFLA_LINKINFO, req.linkinfo.value());
+	if (req.address.size() > 0)
+		ynl_attr_put(nlh, IFLA_ADDRESS, req.address.data(), req.address.size());
+	if (req.broadcast.size() > 0)
+		ynl_attr_put(nlh, IFLA_BROADCAST, req.broadcast.data(), req.broadcast.size());
+	if (req.af_spec.has_value())
+		rt_link_af_spec_attrs_put(nlh, IFLA_AF_SPEC, req.af_spec.value());
+}
+
+static ynl_cpp::result<void>
+rt_link_newlink_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_link_link_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct ifinfomsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_link_newlink_ex(ynl_cpp::ynl_socket&  ys, rt_link_newlink_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWLINK, req._nlmsg_flags);
+	rt_link_newlink_put(nlh, req);
+
+	return rt_link_newlink_exec(ys, nlh);
+}
+
+int rt_link_newlink(ynl_cpp::ynl_socket&  ys, rt_link_newlink_req& req)
+{
+	auto ret = rt_link_newlink_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_newlink_prepare(ynl_cpp::ynl_socket&  ys, rt_link_newlink_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWLINK, req._nlmsg_flags);
+	rt_link_newlink_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct ifinfomsg));
+}
+
+ynl_cpp::result<void>
+rt_link_newlink_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return rt_link_newlink_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_link_newlink(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_link_newlink_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_link_newlink_batch(ynl_cpp::msg_batch& batch, rt_link_newlink_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_NEWLINK, req._nlmsg_flags);
+	rt_link_newlink_put(nlh, req);
+	return batch.msg_end(nlh, &rt_link_link_attrs_nest, sizeof(struct ifinfomsg));
+}
+
+/* ============== DELLINK ============== */
+/* DELLINK - do */
+static void rt_link_dellink_put(struct nlmsghdr *nlh, rt_link_dellink_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.ifname.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_IFNAME, req.ifname.data());
+}
+
+static ynl_cpp::result<void>
+rt_link_dellink_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_link_link_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct ifinfomsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_link_dellink_ex(ynl_cpp::ynl_socket&  ys, rt_link_dellink_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELLINK, req._nlmsg_flags);
+	rt_link_dellink_put(nlh, req);
+
+	return rt_link_dellink_exec(ys, nlh);
+}
+
+int rt_link_dellink(ynl_cpp::ynl_socket&  ys, rt_link_dellink_req& req)
+{
+	auto ret = rt_link_dellink_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_dellink_prepare(ynl_cpp::ynl_socket&  ys, rt_link_dellink_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELLINK, req._nlmsg_flags);
+	rt_link_dellink_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct ifinfomsg));
+}
+
+ynl_cpp::result<void>
+rt_link_dellink_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return rt_link_dellink_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_link_dellink(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_link_dellink_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_link_dellink_batch(ynl_cpp::msg_batch& batch, rt_link_dellink_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_DELLINK, req._nlmsg_flags);
+	rt_link_dellink_put(nlh, req);
+	return batch.msg_end(nlh, &rt_link_link_attrs_nest, sizeof(struct ifinfomsg));
+}
+
+/* ============== GETLINK ============== */
+/* GETLINK - do */
+int rt_link_getlink_rsp_parse(const struct nlmsghdr *nlh,
+			      struct ynl_parse_arg *yarg)
+{
+	unsigned int n_alt_ifname = 0;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	rt_link_getlink_rsp *dst;
+	void *hdr;
+	int i;
+
+	dst = (rt_link_getlink_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct ifinfomsg));
+	if (dst->alt_ifname.size() > 0)
+		return ynl_error_parse(yarg, "attribute already present (link-attrs.alt-ifname)");
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct ifinfomsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == IFLA_ADDRESS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->address.assign(data, data + len);
+		} else if (type == IFLA_BROADCAST) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->broadcast.assign(data, data + len);
+		} else if (type == IFLA_IFNAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->ifname.assign(ynl_attr_get_str(attr));
+		} else if (type == IFLA_MTU) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->mtu = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_LINK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->link = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_QDISC) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->qdisc.assign(ynl_attr_get_str(attr));
+		} else if (type == IFLA_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->stats.assign(data, data + len);
+		} else if (type == IFLA_COST) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->cost.assign(ynl_attr_get_str(attr));
+		} else if (type == IFLA_PRIORITY) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->priority.assign(ynl_attr_get_str(attr));
+		} else if (type == IFLA_MASTER) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->master = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_WIRELESS) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->wireless.assign(ynl_attr_get_str(attr));
+		} else if (type == IFLA_PROTINFO) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->protinfo.assign(ynl_attr_get_str(attr));
+		} else if (type == IFLA_TXQLEN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->txqlen = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_MAP) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->map.assign(data, data + len);
+		} else if (type == IFLA_WEIGHT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->weight = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_OPERSTATE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->operstate = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == IFLA_LINKMODE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->linkmode = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == IFLA_LINKINFO) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_linkinfo_attrs_nest;
+			parg.data = &dst->linkinfo.emplace();
+			if (rt_link_linkinfo_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == IFLA_NET_NS_PID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->net_ns_pid = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_IFALIAS) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->ifalias.assign(ynl_attr_get_str(attr));
+		} else if (type == IFLA_NUM_VF) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->num_vf = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_VFINFO_LIST) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_vfinfo_list_attrs_nest;
+			parg.data = &dst->vfinfo_list.emplace();
+			if (rt_link_vfinfo_list_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == IFLA_STATS64) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->stats64.assign(data, data + len);
+		} else if (type == IFLA_VF_PORTS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_vf_ports_attrs_nest;
+			parg.data = &dst->vf_ports.emplace();
+			if (rt_link_vf_ports_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == IFLA_PORT_SELF) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_port_self_attrs_nest;
+			parg.data = &dst->port_self.emplace();
+			if (rt_link_port_self_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == IFLA_AF_SPEC) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_af_spec_attrs_nest;
+			parg.data = &dst->af_spec.emplace();
+			if (rt_link_af_spec_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == IFLA_GROUP) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->group = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_NET_NS_FD) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->net_ns_fd = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_EXT_MASK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ext_mask = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_PROMISCUITY) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->promiscuity = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_NUM_TX_QUEUES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->num_tx_queues = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_NUM_RX_QUEUES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->num_rx_queues = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_CARRIER) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->carrier = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == IFLA_PHYS_PORT_ID) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->phys_port_id.assign(data, data + len);
+		} else if (type == IFLA_CARRIER_CHANGES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->carrier_changes = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_PHYS_SWITCH_ID) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->phys_switch_id.assign(data, data + len);
+		} else if (type == IFLA_LINK_NETNSID) {
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
+			dst->link_netnsid = (__s32)ynl_attr_get_s32(attr);
+		} else if (type == IFLA_PHYS_PORT_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->phys_port_name.assign(ynl_attr_get_str(attr));
+		} else if (type == IFLA_PROTO_DOWN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->proto_down = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == IFLA_GSO_MAX_SEGS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->gso_max_segs = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_GSO_MAX_SIZE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->gso_max_size = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_XDP) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_xdp_attrs_nest;
+			parg.data = &dst->xdp.emplace();
+			if (rt_link_xdp_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == IFLA_EVENT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->event = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_NEW_NETNSID) {
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
+			dst->new_netnsid = (__s32)ynl_attr_get_s32(attr);
+		} else if (type == IFLA_TARGET_NETNSID) {
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
+			dst->target_netnsid = (__s32)ynl_attr_get_s32(attr);
+		} else if (type == IFLA_CARRIER_UP_COUNT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->carrier_up_count = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_CARRIER_DOWN_COUNT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->carrier_down_count = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_NEW_IFINDEX) {
+			if (ynl_attr_data_len(attr) != sizeof(__s32))
+				return ynl_attr_invalid(yarg, attr, "s32");
+			dst->new_ifindex = (__s32)ynl_attr_get_s32(attr);
+		} else if (type == IFLA_MIN_MTU) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->min_mtu = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_MAX_MTU) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->max_mtu = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_PROP_LIST) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->prop_list.assign(data, data + len);
+		} else if (type == IFLA_ALT_IFNAME) {
+			n_alt_ifname++;
+		} else if (type == IFLA_PERM_ADDRESS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->perm_address.assign(data, data + len);
+		} else if (type == IFLA_PROTO_DOWN_REASON) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->proto_down_reason.assign(ynl_attr_get_str(attr));
+		} else if (type == IFLA_PARENT_DEV_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->parent_dev_name.assign(ynl_attr_get_str(attr));
+		} else if (type == IFLA_PARENT_DEV_BUS_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->parent_dev_bus_name.assign(ynl_attr_get_str(attr));
+		} else if (type == IFLA_GRO_MAX_SIZE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->gro_max_size = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_TSO_MAX_SIZE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->tso_max_size = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_TSO_MAX_SEGS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->tso_max_segs = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_ALLMULTI) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->allmulti = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_DEVLINK_PORT) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->devlink_port.assign(data, data + len);
+		} else if (type == IFLA_GSO_IPV4_MAX_SIZE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->gso_ipv4_max_size = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == IFLA_GRO_IPV4_MAX_SIZE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->gro_ipv4_max_size = (__u32)ynl_attr_get_u32(attr);
+		}
+	}
+
+	if (n_alt_ifname) {
+		dst->alt_ifname.resize(n_alt_ifname);
+		i = 0;
+		ynl_attr_for_each(attr, nlh, sizeof(struct ifinfomsg)) {
+			if (ynl_attr_type(attr) == IFLA_ALT_IFNAME) {
+				if (!ynl_attr_str_valid(attr))
+					return ynl_attr_invalid(yarg, attr, "string");
+				dst->alt_ifname[i].assign(ynl_attr_get_str(attr));
+				i++;
+			}
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void rt_link_getlink_put(struct nlmsghdr *nlh, rt_link_getlink_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ifinfomsg)) + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.ext_mask.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_EXT_MASK, req.ext_mask.value());
+	if (req.target_netnsid.has_value())
+		ynl_attr_put_s32_unchecked(nlh, IFLA_TARGET_NETNSID, req.target_netnsid.value());
+	if (req.ifname.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_IFNAME, req.ifname.data());
+	for (unsigned int i = 0; i < req.alt_ifname.size(); i++)
+		ynl_attr_put_str(nlh, IFLA_ALT_IFNAME, req.alt_ifname[i].c_str());
+}
+
+static ynl_cpp::result<std::unique_ptr<rt_link_getlink_rsp>>
+rt_link_getlink_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<rt_link_getlink_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_link_link_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct ifinfomsg);
+	yrs.yarg.rsp_policy = &rt_link_link_attrs_nest;
+
+	rsp.reset(new rt_link_getlink_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = rt_link_getlink_rsp_parse;
+	yrs.rsp_cmd = RTM_NEWLINK;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<rt_link_getlink_rsp>>
+rt_link_getlink_ex(ynl_cpp::ynl_socket&  ys, rt_link_getlink_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETLINK, req._nlmsg_flags);
+	rt_link_getlink_put(nlh, req);
+
+	return rt_link_getlink_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<rt_link_getlink_rsp>
+rt_link_getlink(ynl_cpp::ynl_socket&  ys, rt_link_getlink_req& req)
+{
+	auto ret = rt_link_getlink_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_getlink_prepare(ynl_cpp::ynl_socket&  ys, rt_link_getlink_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETLINK, req._nlmsg_flags);
+	rt_link_getlink_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct ifinfomsg));
+}
+
+ynl_cpp::result<std::unique_ptr<rt_link_getlink_rsp>>
+rt_link_getlink_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return rt_link_getlink_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<rt_link_getlink_rsp>
+rt_link_getlink(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_link_getlink_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* GETLINK - dump */
+static void
+rt_link_getlink_dump_put(struct nlmsghdr *nlh, rt_link_getlink_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ifinfomsg)) + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.target_netnsid.has_value())
+		ynl_attr_put_s32_unchecked(nlh, IFLA_TARGET_NETNSID, req.target_netnsid.value());
+	if (req.ext_mask.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_EXT_MASK, req.ext_mask.value());
+	if (req.master.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_MASTER, req.master.value());
+	if (req.linkinfo.has_value())
+		rt_link_linkinfo_attrs_put(nlh, IFLA_LINKINFO, req.linkinfo.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<rt_link_getlink_list>>
+rt_link_getlink_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<rt_link_getlink_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &rt_link_link_attrs_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<rt_link_getlink_list*>(arg)->objs.emplace_back());};
+	yds.cb = rt_link_getlink_rsp_parse;
+	yds.rsp_cmd = RTM_NEWLINK;
+	((struct ynl_sock*)ys)->req_policy = &rt_link_link_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct ifinfomsg);
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<rt_link_getlink_list>>
+rt_link_getlink_dump_ex(ynl_cpp::ynl_socket&  ys,
+			rt_link_getlink_req_dump& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETLINK);
+	rt_link_getlink_dump_put(nlh, req);
+
+	return rt_link_getlink_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<rt_link_getlink_list>
+rt_link_getlink_dump(ynl_cpp::ynl_socket&  ys, rt_link_getlink_req_dump& req)
+{
+	auto ret = rt_link_getlink_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_getlink_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     rt_link_getlink_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETLINK);
+	rt_link_getlink_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct ifinfomsg));
+}
+
+ynl_cpp::result<std::unique_ptr<rt_link_getlink_list>>
+rt_link_getlink_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return rt_link_getlink_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<rt_link_getlink_list>
+rt_link_getlink_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_link_getlink_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== SETLINK ============== */
+/* SETLINK - do */
+static void rt_link_setlink_put(struct nlmsghdr *nlh, rt_link_setlink_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ifinfomsg)) + 280 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.mtu.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_MTU, req.mtu.value());
+	if (req.link.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_LINK, req.link.value());
+	if (req.master.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_MASTER, req.master.value());
+	if (req.txqlen.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_TXQLEN, req.txqlen.value());
+	if (req.weight.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_WEIGHT, req.weight.value());
+	if (req.operstate.has_value())
+		ynl_attr_put_u8_unchecked(nlh, IFLA_OPERSTATE, req.operstate.value());
+	if (req.linkmode.has_value())
+		ynl_attr_put_u8_unchecked(nlh, IFLA_LINKMODE, req.linkmode.value());
+	if (req.net_ns_pid.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_NET_NS_PID, req.net_ns_pid.value());
+	if (req.num_vf.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_NUM_VF, req.num_vf.value());
+	if (req.group.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GROUP, req.group.value());
+	if (req.net_ns_fd.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_NET_NS_FD, req.net_ns_fd.value());
+	if (req.ext_mask.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_EXT_MASK, req.ext_mask.value());
+	if (req.promiscuity.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_PROMISCUITY, req.promiscuity.value());
+	if (req.num_tx_queues.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_NUM_TX_QUEUES, req.num_tx_queues.value());
+	if (req.num_rx_queues.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_NUM_RX_QUEUES, req.num_rx_queues.value());
+	if (req.carrier.has_value())
+		ynl_attr_put_u8_unchecked(nlh, IFLA_CARRIER, req.carrier.value());
+	if (req.carrier_changes.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_CARRIER_CHANGES, req.carrier_changes.value());
+	if (req.link_netnsid.has_value())
+		ynl_attr_put_s32_unchecked(nlh, IFLA_LINK_NETNSID, req.link_netnsid.value());
+	if (req.proto_down.has_value())
+		ynl_attr_put_u8_unchecked(nlh, IFLA_PROTO_DOWN, req.proto_down.value());
+	if (req.gso_max_segs.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GSO_MAX_SEGS, req.gso_max_segs.value());
+	if (req.gso_max_size.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GSO_MAX_SIZE, req.gso_max_size.value());
+	if (req.event.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_EVENT, req.event.value());
+	if (req.new_netnsid.has_value())
+		ynl_attr_put_s32_unchecked(nlh, IFLA_NEW_NETNSID, req.new_netnsid.value());
+	if (req.target_netnsid.has_value())
+		ynl_attr_put_s32_unchecked(nlh, IFLA_TARGET_NETNSID, req.target_netnsid.value());
+	if (req.carrier_up_count.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_CARRIER_UP_COUNT, req.carrier_up_count.value());
+	if (req.carrier_down_count.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_CARRIER_DOWN_COUNT, req.carrier_down_count.value());
+	if (req.new_ifindex.has_value())
+		ynl_attr_put_s32_unchecked(nlh, IFLA_NEW_IFINDEX, req.new_ifindex.value());
+	if (req.min_mtu.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_MIN_MTU, req.min_mtu.value());
+	if (req.max_mtu.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_MAX_MTU, req.max_mtu.value());
+	if (req.gro_max_size.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GRO_MAX_SIZE, req.gro_max_size.value());
+	if (req.tso_max_size.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_TSO_MAX_SIZE, req.tso_max_size.value());
+	if (req.tso_max_segs.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_TSO_MAX_SEGS, req.tso_max_segs.value());
+	if (req.allmulti.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_ALLMULTI, req.allmulti.value());
+	if (req.gso_ipv4_max_size.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GSO_IPV4_MAX_SIZE, req.gso_ipv4_max_size.value());
+	if (req.gro_ipv4_max_size.has_value())
+		ynl_attr_put_u32_unchecked(nlh, IFLA_GRO_IPV4_MAX_SIZE, req.gro_ipv4_max_size.value());
+	if (req.address.size() > 0)
+		ynl_attr_put(nlh, IFLA_ADDRESS, req.address.data(), req.address.size());
+	if (req.broadcast.size() > 0)
+		ynl_attr_put(nlh, IFLA_BROADCAST, req.broadcast.data(), req.broadcast.size());
+	if (req.ifname.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_IFNAME, req.ifname.data());
+	if (req.qdisc.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_QDISC, req.qdisc.data());
+	if (req.stats.size() > 0)
+		ynl_attr_put(nlh, IFLA_STATS, req.stats.data(), req.stats.size());
+	if (req.cost.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_COST, req.cost.data());
+	if (req.priority.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_PRIORITY, req.priority.data());
+	if (req.wireless.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_WIRELESS, req.wireless.data());
+	if (req.protinfo.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_PROTINFO, req.protinfo.data());
+	if (req.map.size() > 0)
+		ynl_attr_put(nlh, IFLA_MAP, req.map.data(), req.map.size());
+	if (req.linkinfo.has_value())
+		rt_link_linkinfo_attrs_put(nlh, IFLA_LINKINFO, req.linkinfo.value());
+	if (req.ifalias.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_IFALIAS, req.ifalias.data());
+	if (req.vfinfo_list.has_value())
+		rt_link_vfinfo_list_attrs_put(nlh, IFLA_VFINFO_LIST, req.vfinfo_list.value());
+	if (req.stats64.size() > 0)
+		ynl_attr_put(nlh, IFLA_STATS64, req.stats64.data(), req.stats64.size());
+	if (req.vf_ports.has_value())
+		rt_link_vf_ports_attrs_put(nlh, IFLA_VF_PORTS, req.vf_ports.value());
+	if (req.port_self.has_value())
+		rt_link_port_self_attrs_put(nlh, IFLA_PORT_SELF, req.port_self.value());
+	if (req.af_spec.has_value())
+		rt_link_af_spec_attrs_put(nlh, IFLA_AF_SPEC, req.af_spec.value());
+	if (req.phys_port_id.size() > 0)
+		ynl_attr_put(nlh, IFLA_PHYS_PORT_ID, req.phys_port_id.data(), req.phys_port_id.size());
+	if (req.phys_switch_id.size() > 0)
+		ynl_attr_put(nlh, IFLA_PHYS_SWITCH_ID, req.phys_switch_id.data(), req.phys_switch_id.size());
+	if (req.phys_port_name.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_PHYS_PORT_NAME, req.phys_port_name.data());
+	if (req.xdp.has_value())
+		rt_link_xdp_attrs_put(nlh, IFLA_XDP, req.xdp.value());
+	if (req.prop_list.size() > 0)
+		ynl_attr_put(nlh, IFLA_PROP_LIST, req.prop_list.data(), req.prop_list.size());
+	for (unsigned int i = 0; i < req.alt_ifname.size(); i++)
+		ynl_attr_put_str(nlh, IFLA_ALT_IFNAME, req.alt_ifname[i].c_str());
+	if (req.perm_address.size() > 0)
+		ynl_attr_put(nlh, IFLA_PERM_ADDRESS, req.perm_address.data(), req.perm_address.size());
+	if (req.proto_down_reason.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_PROTO_DOWN_REASON, req.proto_down_reason.data());
+	if (req.parent_dev_name.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_PARENT_DEV_NAME, req.parent_dev_name.data());
+	if (req.parent_dev_bus_name.size() > 0)
+		ynl_attr_put_str(nlh, IFLA_PARENT_DEV_BUS_NAME, req.parent_dev_bus_name.data());
+	if (req.devlink_port.size() > 0)
+		ynl_attr_put(nlh, IFLA_DEVLINK_PORT, req.devlink_port.data(), req.devlink_port.size());
+}
+
+static ynl_cpp::result<void>
+rt_link_setlink_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_link_link_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct ifinfomsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_link_setlink_ex(ynl_cpp::ynl_socket&  ys, rt_link_setlink_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_SETLINK, req._nlmsg_flags);
+	rt_link_setlink_put(nlh, req);
+
+	return rt_link_setlink_exec(ys, nlh);
+}
+
+int rt_link_setlink(ynl_cpp::ynl_socket&  ys, rt_link_setlink_req& req)
+{
+	auto ret = rt_link_setlink_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_setlink_prepare(ynl_cpp::ynl_socket&  ys, rt_link_setlink_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_SETLINK, req._nlmsg_flags);
+	rt_link_setlink_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct ifinfomsg));
+}
+
+ynl_cpp::result<void>
+rt_link_setlink_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return rt_link_setlink_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_link_setlink(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_link_setlink_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_link_setlink_batch(ynl_cpp::msg_batch& batch, rt_link_setlink_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_SETLINK, req._nlmsg_flags);
+	rt_link_setlink_put(nlh, req);
+	return batch.msg_end(nlh, &rt_link_link_attrs_nest, sizeof(struct ifinfomsg));
+}
+
+/* ============== GETSTATS ============== */
+/* GETSTATS - do */
+int rt_link_getstats_rsp_parse(const struct nlmsghdr *nlh,
+			       struct ynl_parse_arg *yarg)
+{
+	rt_link_getstats_rsp *dst;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	void *hdr;
+
+	dst = (rt_link_getstats_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct if_stats_msg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct if_stats_msg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == IFLA_STATS_LINK_64) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->link_64.assign(data, data + len);
+		} else if (type == IFLA_STATS_LINK_XSTATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->link_xstats.assign(data, data + len);
+		} else if (type == IFLA_STATS_LINK_XSTATS_SLAVE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->link_xstats_slave.assign(data, data + len);
+		} else if (type == IFLA_STATS_LINK_OFFLOAD_XSTATS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_link_link_offload_xstats_nest;
+			parg.data = &dst->link_offload_xstats.emplace();
+			if (rt_link_link_offload_xstats_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == IFLA_STATS_AF_SPEC) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->af_spec.assign(data, data + len);
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+rt_link_getstats_put(struct nlmsghdr *nlh, rt_link_getstats_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<rt_link_getstats_rsp>>
+rt_link_getstats_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<rt_link_getstats_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_link_stats_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct if_stats_msg);
+	yrs.yarg.rsp_policy = &rt_link_stats_attrs_nest;
+
+	rsp.reset(new rt_link_getstats_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = rt_link_getstats_rsp_parse;
+	yrs.rsp_cmd = 92;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<rt_link_getstats_rsp>>
+rt_link_getstats_ex(ynl_cpp::ynl_socket&  ys, rt_link_getstats_req& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETSTATS, req._nlmsg_flags);
+	rt_link_getstats_put(nlh, req);
+
+	return rt_link_getstats_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<rt_link_getstats_rsp>
+rt_link_getstats(ynl_cpp::ynl_socket&  ys, rt_link_getstats_req& req)
+{
+	auto ret = rt_link_getstats_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_getstats_prepare(ynl_cpp::ynl_socket&  ys, rt_link_getstats_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETSTATS, req._nlmsg_flags);
+	rt_link_getstats_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct if_stats_msg));
+}
+
+ynl_cpp::result<std::unique_ptr<rt_link_getstats_rsp>>
+rt_link_getstats_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return rt_link_getstats_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<rt_link_getstats_rsp>
+rt_link_getstats(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_link_getstats_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* GETSTATS - dump */
+static void
+rt_link_getstats_dump_put(struct nlmsghdr *nlh, rt_link_getstats_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<rt_link_getstats_list>>
+rt_link_getstats_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			   const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<rt_link_getstats_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &rt_link_stats_attrs_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<rt_link_getstats_list*>(arg)->objs.emplace_back());};
+	yds.cb = rt_link_getstats_rsp_parse;
+	yds.rsp_cmd = 92;
+	((struct ynl_sock*)ys)->req_policy = &rt_link_stats_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct if_stats_msg);
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<rt_link_getstats_list>>
+rt_link_getstats_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 rt_link_getstats_req_dump& req,
+			 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETSTATS);
+	rt_link_getstats_dump_put(nlh, req);
+
+	return rt_link_getstats_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<rt_link_getstats_list>
+rt_link_getstats_dump(ynl_cpp::ynl_socket&  ys, rt_link_getstats_req_dump& req)
+{
+	auto ret = rt_link_getstats_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_getstats_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      rt_link_getstats_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETSTATS);
+	rt_link_getstats_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct if_stats_msg));
+}
+
+ynl_cpp::result<std::unique_ptr<rt_link_getstats_list>>
+rt_link_getstats_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj)
+{
+	return rt_link_getstats_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<rt_link_getstats_list>
+rt_link_getstats_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_link_getstats_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+static const struct ynl_mcast_grp rt_link_mcast_groups[] = {
+	{ "rtnlgrp-link", 1 },
+	{ "rtnlgrp-stats", 36 },
+};
+
+const struct ynl_family ynl_rt_link_family =  {
+	.name		= "rt_link",
+	.hdr_len	= 0,
+	.is_classic	= true,
+	.classic_id	= 0,
+	.mcast_groups	= rt_link_mcast_groups,
+	.n_mcast_groups	= std::size(rt_link_mcast_groups),
+};
+const struct ynl_family& get_ynl_rt_link_family() {
+	return ynl_rt_link_family;
+};
+} //namespace ynl_cpp
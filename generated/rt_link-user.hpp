@@ -0,0 +1,1359 @@
+/* SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause) */
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user header */
+
+#ifndef _LINUX_RT_LINK_GEN_H
+#define _LINUX_RT_LINK_GEN_H
+
+#include <linux/types.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ynl.hpp"
+
+#include <linux/netlink.h>
+
+namespace ynl_cpp {
+/* Definitions */
+enum rt_link_ifinfo_flags {
+	RT_LINK_IFINFO_FLAGS_UP = 1,
+	RT_LINK_IFINFO_FLAGS_BROADCAST = 2,
+	RT_LINK_IFINFO_FLAGS_DEBUG = 4,
+	RT_LINK_IFINFO_FLAGS_LOOPBACK = 8,
+	RT_LINK_IFINFO_FLAGS_POINT_TO_POINT = 16,
+	RT_LINK_IFINFO_FLAGS_NO_TRAILERS = 32,
+	RT_LINK_IFINFO_FLAGS_RUNNING = 64,
+	RT_LINK_IFINFO_FLAGS_NO_ARP = 128,
+	RT_LINK_IFINFO_FLAGS_PROMISC = 256,
+	RT_LINK_IFINFO_FLAGS_ALL_MULTI = 512,
+	RT_LINK_IFINFO_FLAGS_MASTER = 1024,
+	RT_LINK_IFINFO_FLAGS_SLAVE = 2048,
+	RT_LINK_IFINFO_FLAGS_MULTICAST = 4096,
+	RT_LINK_IFINFO_FLAGS_PORTSEL = 8192,
+	RT_LINK_IFINFO_FLAGS_AUTO_MEDIA = 16384,
+	RT_LINK_IFINFO_FLAGS_DYNAMIC = 32768,
+	RT_LINK_IFINFO_FLAGS_LOWER_UP = 65536,
+	RT_LINK_IFINFO_FLAGS_DORMANT = 131072,
+	RT_LINK_IFINFO_FLAGS_ECHO = 262144,
+};
+
+enum rt_link_vlan_protocols {
+	RT_LINK_VLAN_PROTOCOLS_8021Q = 33024,
+	RT_LINK_VLAN_PROTOCOLS_8021AD = 34984,
+};
+
+enum rt_link_vlan_flags {
+	RT_LINK_VLAN_FLAGS_REORDER_HDR = 1,
+	RT_LINK_VLAN_FLAGS_GVRP = 2,
+	RT_LINK_VLAN_FLAGS_LOOSE_BINDING = 4,
+	RT_LINK_VLAN_FLAGS_MVRP = 8,
+	RT_LINK_VLAN_FLAGS_BRIDGE_BINDING = 16,
+};
+
+enum rt_link_ifla_vf_link_state_enum {
+	RT_LINK_IFLA_VF_LINK_STATE_ENUM_AUTO = 0,
+	RT_LINK_IFLA_VF_LINK_STATE_ENUM_ENABLE = 1,
+	RT_LINK_IFLA_VF_LINK_STATE_ENUM_DISABLE = 2,
+};
+
+enum rt_link_rtext_filter {
+	RT_LINK_RTEXT_FILTER_VF = 1,
+	RT_LINK_RTEXT_FILTER_BRVLAN = 2,
+	RT_LINK_RTEXT_FILTER_BRVLAN_COMPRESSED = 4,
+	RT_LINK_RTEXT_FILTER_SKIP_STATS = 8,
+	RT_LINK_RTEXT_FILTER_MRP = 16,
+	RT_LINK_RTEXT_FILTER_CFM_CONFIG = 32,
+	RT_LINK_RTEXT_FILTER_CFM_STATUS = 64,
+	RT_LINK_RTEXT_FILTER_MST = 128,
+};
+
+enum rt_link_netkit_policy {
+	RT_LINK_NETKIT_POLICY_FORWARD = 0,
+	RT_LINK_NETKIT_POLICY_BLACKHOLE = 2,
+};
+
+enum rt_link_netkit_mode {
+	RT_LINK_NETKIT_MODE_L2 = 0,
+	RT_LINK_NETKIT_MODE_L3 = 1,
+};
+
+enum rt_link_netkit_scrub {
+	RT_LINK_NETKIT_SCRUB_NONE = 0,
+	RT_LINK_NETKIT_SCRUB_DEFAULT = 1,
+};
+
+struct ifinfomsg {
+	__u8 ifi_family;
+	__u8 pad[1];
+	__u16 ifi_type;
+	__s32 ifi_index;
+	__u32 ifi_flags;
+	__u32 ifi_change;
+};
+
+struct if_stats_msg {
+	__u8 family;
+	__u8 pad[3];
+	__u32 ifindex;
+	__u32 filter_mask;
+};
+
+struct rtnl_link_stats {
+	__u32 rx_packets;
+	__u32 tx_packets;
+	__u32 rx_bytes;
+	__u32 tx_bytes;
+	__u32 rx_errors;
+	__u32 tx_errors;
+	__u32 rx_dropped;
+	__u32 tx_dropped;
+	__u32 multicast;
+	__u32 collisions;
+	__u32 rx_length_errors;
+	__u32 rx_over_errors;
+	__u32 rx_crc_errors;
+	__u32 rx_frame_errors;
+	__u32 rx_fifo_errors;
+	__u32 rx_missed_errors;
+	__u32 tx_aborted_errors;
+	__u32 tx_carrier_errors;
+	__u32 tx_fifo_errors;
+	__u32 tx_heartbeat_errors;
+	__u32 tx_window_errors;
+	__u32 rx_compressed;
+	__u32 tx_compressed;
+	__u32 rx_nohandler;
+};
+
+struct rtnl_link_ifmap {
+	__u64 mem_start;
+	__u64 mem_end;
+	__u64 base_addr;
+	__u16 irq;
+	__u8 dma;
+	__u8 port;
+};
+
+struct rtnl_link_stats64 {
+	__u64 rx_packets;
+	__u64 tx_packets;
+	__u64 rx_bytes;
+	__u64 tx_bytes;
+	__u64 rx_errors;
+	__u64 tx_errors;
+	__u64 rx_dropped;
+	__u64 tx_dropped;
+	__u64 multicast;
+	__u64 collisions;
+	__u64 rx_length_errors;
+	__u64 rx_over_errors;
+	__u64 rx_crc_errors;
+	__u64 rx_frame_errors;
+	__u64 rx_fifo_errors;
+	__u64 rx_missed_errors;
+	__u64 tx_aborted_errors;
+	__u64 tx_carrier_errors;
+	__u64 tx_fifo_errors;
+	__u64 tx_heartbeat_errors;
+	__u64 tx_window_errors;
+	__u64 rx_compressed;
+	__u64 tx_compressed;
+	__u64 rx_nohandler;
+	__u64 rx_otherhost_dropped;
+};
+
+struct ifla_vf_mac {
+	__u32 vf;
+	__u8 mac[32];
+};
+
+struct ifla_vf_vlan {
+	__u32 vf;
+	__u32 vlan;
+	__u32 qos;
+};
+
+struct ifla_vf_tx_rate {
+	__u32 vf;
+	__u32 rate;
+};
+
+struct ifla_vf_spoofchk {
+	__u32 vf;
+	__u32 setting;
+};
+
+struct ifla_vf_link_state {
+	__u32 vf;
+	__u32 link_state;
+};
+
+struct ifla_vf_rate {
+	__u32 vf;
+	__u32 min_tx_rate;
+	__u32 max_tx_rate;
+};
+
+struct ifla_vf_rss_query_en {
+	__u32 vf;
+	__u32 setting;
+};
+
+struct ifla_vf_trust {
+	__u32 vf;
+	__u32 setting;
+};
+
+struct ifla_vf_guid {
+	__u32 vf;
+	__u64 guid;
+};
+
+struct ifla_vf_vlan_info {
+	__u32 vf;
+	__u32 vlan;
+	__u32 qos;
+	__u32 vlan_proto;
+};
+
+struct ifla_bridge_id {
+	__u16 prio;
+	__u8 addr[6];
+};
+
+struct br_boolopt_multi {
+	__u32 optval;
+	__u32 optmask;
+};
+
+struct ifla_vlan_flags {
+	__u32 flags;
+	__u32 mask;
+};
+
+struct ifla_vlan_qos_mapping {
+	__u32 from;
+	__u32 to;
+};
+
+struct ipv4_devconf {
+	__u32 forwarding;
+	__u32 mc_forwarding;
+	__u32 proxy_arp;
+	__u32 accept_redirects;
+	__u32 secure_redirects;
+	__u32 send_redirects;
+	__u32 shared_media;
+	__u32 rp_filter;
+	__u32 accept_source_route;
+	__u32 bootp_relay;
+	__u32 log_martians;
+	__u32 tag;
+	__u32 arpfilter;
+	__u32 medium_id;
+	__u32 noxfrm;
+	__u32 nopolicy;
+	__u32 force_igmp_version;
+	__u32 arp_announce;
+	__u32 arp_ignore;
+	__u32 promote_secondaries;
+	__u32 arp_accept;
+	__u32 arp_notify;
+	__u32 accept_local;
+	__u32 src_vmark;
+	__u32 proxy_arp_pvlan;
+	__u32 route_localnet;
+	__u32 igmpv2_unsolicited_report_interval;
+	__u32 igmpv3_unsolicited_report_interval;
+	__u32 ignore_routes_with_linkdown;
+	__u32 drop_unicast_in_l2_multicast;
+	__u32 drop_gratuitous_arp;
+	__u32 bc_forwarding;
+	__u32 arp_evict_nocarrier;
+};
+
+struct ipv6_devconf {
+	__u32 forwarding;
+	__u32 hoplimit;
+	__u32 mtu6;
+	__u32 accept_ra;
+	__u32 accept_redirects;
+	__u32 autoconf;
+	__u32 dad_transmits;
+	__u32 rtr_solicits;
+	__u32 rtr_solicit_interval;
+	__u32 rtr_solicit_delay;
+	__u32 use_tempaddr;
+	__u32 temp_valid_lft;
+	__u32 temp_prefered_lft;
+	__u32 regen_max_retry;
+	__u32 max_desync_factor;
+	__u32 max_addresses;
+	__u32 force_mld_version;
+	__u32 accept_ra_defrtr;
+	__u32 accept_ra_pinfo;
+	__u32 accept_ra_rtr_pref;
+	__u32 rtr_probe_interval;
+	__u32 accept_ra_rt_info_max_plen;
+	__u32 proxy_ndp;
+	__u32 optimistic_dad;
+	__u32 accept_source_route;
+	__u32 mc_forwarding;
+	__u32 disable_ipv6;
+	__u32 accept_dad;
+	__u32 force_tllao;
+	__u32 ndisc_notify;
+	__u32 mldv1_unsolicited_report_interval;
+	__u32 mldv2_unsolicited_report_interval;
+	__u32 suppress_frag_ndisc;
+	__u32 accept_ra_from_local;
+	__u32 use_optimistic;
+	__u32 accept_ra_mtu;
+	__u32 stable_secret;
+	__u32 use_oif_addrs_only;
+	__u32 accept_ra_min_hop_limit;
+	__u32 ignore_routes_with_linkdown;
+	__u32 drop_unicast_in_l2_multicast;
+	__u32 drop_unsolicited_na;
+	__u32 keep_addr_on_down;
+	__u32 rtr_solicit_max_interval;
+	__u32 seg6_enabled;
+	__u32 seg6_require_hmac;
+	__u32 enhanced_dad;
+	__u8 addr_gen_mode;
+	__u32 disable_policy;
+	__u32 accept_ra_rt_info_min_plen;
+	__u32 ndisc_tclass;
+	__u32 rpl_seg_enabled;
+	__u32 ra_defrtr_metric;
+	__u32 ioam6_enabled;
+	__u32 ioam6_id;
+	__u32 ioam6_id_wide;
+	__u32 ndisc_evict_nocarrier;
+	__u32 accept_untracked_na;
+};
+
+struct ifla_inet6_stats {
+	__u64 inpkts;
+	__u64 inoctets;
+	__u64 indelivers;
+	__u64 outforwdatagrams;
+	__u64 outpkts;
+	__u64 outoctets;
+	__u64 inhdrerrors;
+	__u64 intoobigerrors;
+	__u64 innoroutes;
+	__u64 inaddrerrors;
+	__u64 inunknownprotos;
+	__u64 intruncatedpkts;
+	__u64 indiscards;
+	__u64 outdiscards;
+	__u64 outnoroutes;
+	__u64 reasmtimeout;
+	__u64 reasmreqds;
+	__u64 reasmoks;
+	__u64 reasmfails;
+	__u64 fragoks;
+	__u64 fragfails;
+	__u64 fragcreates;
+	__u64 inmcastpkts;
+	__u64 outmcastpkts;
+	__u64 inbcastpkts;
+	__u64 outbcastpkts;
+	__u64 inmcastoctets;
+	__u64 outmcastoctets;
+	__u64 inbcastoctets;
+	__u64 outbcastoctets;
+	__u64 csumerrors;
+	__u64 noectpkts;
+	__u64 ect1_pkts;
+	__u64 ect0_pkts;
+	__u64 cepkts;
+	__u64 reasm_overlaps;
+};
+
+struct ifla_cacheinfo {
+	__u32 max_reasm_len;
+	__u32 tstamp;
+	__s32 reachable_time;
+	__u32 retrans_time;
+};
+
+struct ifla_icmp6_stats {
+	__u64 inmsgs;
+	__u64 inerrors;
+	__u64 outmsgs;
+	__u64 outerrors;
+	__u64 csumerrors;
+	__u64 ratelimithost;
+};
+
+/* Attributes */
+enum {
+	IFLA_ADDRESS = 1,
+	IFLA_BROADCAST = 2,
+	IFLA_IFNAME = 3,
+	IFLA_MTU = 4,
+	IFLA_LINK = 5,
+	IFLA_QDISC = 6,
+	IFLA_STATS = 7,
+	IFLA_COST = 8,
+	IFLA_PRIORITY = 9,
+	IFLA_MASTER = 10,
+	IFLA_WIRELESS = 11,
+	IFLA_PROTINFO = 12,
+	IFLA_TXQLEN = 13,
+	IFLA_MAP = 14,
+	IFLA_WEIGHT = 15,
+	IFLA_OPERSTATE = 16,
+	IFLA_LINKMODE = 17,
+	IFLA_LINKINFO = 18,
+	IFLA_NET_NS_PID = 19,
+	IFLA_IFALIAS = 20,
+	IFLA_NUM_VF = 21,
+	IFLA_VFINFO_LIST = 22,
+	IFLA_STATS64 = 23,
+	IFLA_VF_PORTS = 24,
+	IFLA_PORT_SELF = 25,
+	IFLA_AF_SPEC = 26,
+	IFLA_GROUP = 27,
+	IFLA_NET_NS_FD = 28,
+	IFLA_EXT_MASK = 29,
+	IFLA_PROMISCUITY = 30,
+	IFLA_NUM_TX_QUEUES = 31,
+	IFLA_NUM_RX_QUEUES = 32,
+	IFLA_CARRIER = 33,
+	IFLA_PHYS_PORT_ID = 34,
+	IFLA_CARRIER_CHANGES = 35,
+	IFLA_PHYS_SWITCH_ID = 36,
+	IFLA_LINK_NETNSID = 37,
+	IFLA_PHYS_PORT_NAME = 38,
+	IFLA_PROTO_DOWN = 39,
+	IFLA_GSO_MAX_SEGS = 40,
+	IFLA_GSO_MAX_SIZE = 41,
+	IFLA_PAD = 42,
+	IFLA_XDP = 43,
+	IFLA_EVENT = 44,
+	IFLA_NEW_NETNSID = 45,
+	IFLA_TARGET_NETNSID = 46,
+	IFLA_CARRIER_UP_COUNT = 47,
+	IFLA_CARRIER_DOWN_COUNT = 48,
+	IFLA_NEW_IFINDEX = 49,
+	IFLA_MIN_MTU = 50,
+	IFLA_MAX_MTU = 51,
+	IFLA_PROP_LIST = 52,
+	IFLA_ALT_IFNAME = 53,
+	IFLA_PERM_ADDRESS = 54,
+	IFLA_PROTO_DOWN_REASON = 55,
+	IFLA_PARENT_DEV_NAME = 56,
+	IFLA_PARENT_DEV_BUS_NAME = 57,
+	IFLA_GRO_MAX_SIZE = 58,
+	IFLA_TSO_MAX_SIZE = 59,
+	IFLA_TSO_MAX_SEGS = 60,
+	IFLA_ALLMULTI = 61,
+	IFLA_DEVLINK_PORT = 62,
+	IFLA_GSO_IPV4_MAX_SIZE = 63,
+	IFLA_GRO_IPV4_MAX_SIZE = 64,
+	IFLA_DPLL_PIN = 65,
+	IFLA_MAX_PACING_OFFLOAD_HORIZON = 66,
+};
+
+enum {
+	RT_LINK_A_AF_SPEC_ATTRS_INET = 2,
+	RT_LINK_A_AF_SPEC_ATTRS_INET6 = 10,
+	RT_LINK_A_AF_SPEC_ATTRS_MCTP = 45,
+};
+
+enum {
+	RT_LINK_A_VFINFO_LIST_ATTRS_INFO = 1,
+};
+
+enum {
+	RT_LINK_A_VFINFO_ATTRS_MAC = 1,
+	RT_LINK_A_VFINFO_ATTRS_VLAN = 2,
+	RT_LINK_A_VFINFO_ATTRS_TX_RATE = 3,
+	RT_LINK_A_VFINFO_ATTRS_SPOOFCHK = 4,
+	RT_LINK_A_VFINFO_ATTRS_LINK_STATE = 5,
+	RT_LINK_A_VFINFO_ATTRS_RATE = 6,
+	RT_LINK_A_VFINFO_ATTRS_RSS_QUERY_EN = 7,
+	RT_LINK_A_VFINFO_ATTRS_STATS = 8,
+	RT_LINK_A_VFINFO_ATTRS_TRUST = 9,
+	RT_LINK_A_VFINFO_ATTRS_IB_NODE_GUID = 10,
+	RT_LINK_A_VFINFO_ATTRS_IB_PORT_GUID = 11,
+	RT_LINK_A_VFINFO_ATTRS_VLAN_LIST = 12,
+	RT_LINK_A_VFINFO_ATTRS_BROADCAST = 13,
+};
+
+enum {
+	RT_LINK_A_VF_STATS_ATTRS_RX_PACKETS = 0,
+	RT_LINK_A_VF_STATS_ATTRS_TX_PACKETS = 1,
+	RT_LINK_A_VF_STATS_ATTRS_RX_BYTES = 2,
+	RT_LINK_A_VF_STATS_ATTRS_TX_BYTES = 3,
+	RT_LINK_A_VF_STATS_ATTRS_BROADCAST = 4,
+	RT_LINK_A_VF_STATS_ATTRS_MULTICAST = 5,
+	RT_LINK_A_VF_STATS_ATTRS_PAD = 6,
+	RT_LINK_A_VF_STATS_ATTRS_RX_DROPPED = 7,
+	RT_LINK_A_VF_STATS_ATTRS_TX_DROPPED = 8,
+};
+
+enum {
+	RT_LINK_A_VF_VLAN_ATTRS_INFO = 1,
+};
+
+enum {
+};
+
+enum {
+};
+
+enum {
+	RT_LINK_A_LINKINFO_ATTRS_KIND = 1,
+	RT_LINK_A_LINKINFO_ATTRS_DATA = 2,
+	RT_LINK_A_LINKINFO_ATTRS_XSTATS = 3,
+	RT_LINK_A_LINKINFO_ATTRS_SLAVE_KIND = 4,
+	RT_LINK_A_LINKINFO_ATTRS_SLAVE_DATA = 5,
+};
+
+enum {
+	IFLA_BOND_MODE = 1,
+	IFLA_BOND_ACTIVE_SLAVE = 2,
+	IFLA_BOND_MIIMON = 3,
+	IFLA_BOND_UPDELAY = 4,
+	IFLA_BOND_DOWNDELAY = 5,
+	IFLA_BOND_USE_CARRIER = 6,
+	IFLA_BOND_ARP_INTERVAL = 7,
+	IFLA_BOND_ARP_IP_TARGET = 8,
+	IFLA_BOND_ARP_VALIDATE = 9,
+	IFLA_BOND_ARP_ALL_TARGETS = 10,
+	IFLA_BOND_PRIMARY = 11,
+	IFLA_BOND_PRIMARY_RESELECT = 12,
+	IFLA_BOND_FAIL_OVER_MAC = 13,
+	IFLA_BOND_XMIT_HASH_POLICY = 14,
+	IFLA_BOND_RESEND_IGMP = 15,
+	IFLA_BOND_NUM_PEER_NOTIF = 16,
+	IFLA_BOND_ALL_SLAVES_ACTIVE = 17,
+	IFLA_BOND_MIN_LINKS = 18,
+	IFLA_BOND_LP_INTERVAL = 19,
+	IFLA_BOND_PACKETS_PER_SLAVE = 20,
+	IFLA_BOND_AD_LACP_RATE = 21,
+	IFLA_BOND_AD_SELECT = 22,
+	IFLA_BOND_AD_INFO = 23,
+	IFLA_BOND_AD_ACTOR_SYS_PRIO = 24,
+	IFLA_BOND_AD_USER_PORT_KEY = 25,
+	IFLA_BOND_AD_ACTOR_SYSTEM = 26,
+	IFLA_BOND_TLB_DYNAMIC_LB = 27,
+	IFLA_BOND_PEER_NOTIF_DELAY = 28,
+	IFLA_BOND_AD_LACP_ACTIVE = 29,
+	IFLA_BOND_MISSED_MAX = 30,
+	IFLA_BOND_NS_IP6_TARGET = 31,
+	IFLA_BOND_COUPLED_CONTROL = 32,
+};
+
+enum {
+	IFLA_BOND_AD_INFO_AGGREGATOR = 1,
+	IFLA_BOND_AD_INFO_NUM_PORTS = 2,
+	IFLA_BOND_AD_INFO_ACTOR_KEY = 3,
+	IFLA_BOND_AD_INFO_PARTNER_KEY = 4,
+	IFLA_BOND_AD_INFO_PARTNER_MAC = 5,
+};
+
+enum {
+	IFLA_BOND_SLAVE_STATE = 1,
+	IFLA_BOND_SLAVE_MII_STATUS = 2,
+	IFLA_BOND_SLAVE_LINK_FAILURE_COUNT = 3,
+	IFLA_BOND_SLAVE_PERM_HWADDR = 4,
+	IFLA_BOND_SLAVE_QUEUE_ID = 5,
+	IFLA_BOND_SLAVE_AD_AGGREGATOR_ID = 6,
+	IFLA_BOND_SLAVE_AD_ACTOR_OPER_PORT_STATE = 7,
+	IFLA_BOND_SLAVE_AD_PARTNER_OPER_PORT_STATE = 8,
+	IFLA_BOND_SLAVE_PRIO = 9,
+};
+
+enum {
+	IFLA_BR_FORWARD_DELAY = 1,
+	IFLA_BR_HELLO_TIME = 2,
+	IFLA_BR_MAX_AGE = 3,
+	IFLA_BR_AGEING_TIME = 4,
+	IFLA_BR_STP_STATE = 5,
+	IFLA_BR_PRIORITY = 6,
+	IFLA_BR_VLAN_FILTERING = 7,
+	IFLA_BR_VLAN_PROTOCOL = 8,
+	IFLA_BR_GROUP_FWD_MASK = 9,
+	IFLA_BR_ROOT_ID = 10,
+	IFLA_BR_BRIDGE_ID = 11,
+	IFLA_BR_ROOT_PORT = 12,
+	IFLA_BR_ROOT_PATH_COST = 13,
+	IFLA_BR_TOPOLOGY_CHANGE = 14,
+	IFLA_BR_TOPOLOGY_CHANGE_DETECTED = 15,
+	IFLA_BR_HELLO_TIMER = 16,
+	IFLA_BR_TCN_TIMER = 17,
+	IFLA_BR_TOPOLOGY_CHANGE_TIMER = 18,
+	IFLA_BR_GC_TIMER = 19,
+	IFLA_BR_GROUP_ADDR = 20,
+	IFLA_BR_FDB_FLUSH = 21,
+	IFLA_BR_MCAST_ROUTER = 22,
+	IFLA_BR_MCAST_SNOOPING = 23,
+	IFLA_BR_MCAST_QUERY_USE_IFADDR = 24,
+	IFLA_BR_MCAST_QUERIER = 25,
+	IFLA_BR_MCAST_HASH_ELASTICITY = 26,
+	IFLA_BR_MCAST_HASH_MAX = 27,
+	IFLA_BR_MCAST_LAST_MEMBER_CNT = 28,
+	IFLA_BR_MCAST_STARTUP_QUERY_CNT = 29,
+	IFLA_BR_MCAST_LAST_MEMBER_INTVL = 30,
+	IFLA_BR_MCAST_MEMBERSHIP_INTVL = 31,
+	IFLA_BR_MCAST_QUERIER_INTVL = 32,
+	IFLA_BR_MCAST_QUERY_INTVL = 33,
+	IFLA_BR_MCAST_QUERY_RESPONSE_INTVL = 34,
+	IFLA_BR_MCAST_STARTUP_QUERY_INTVL = 35,
+	IFLA_BR_NF_CALL_IPTABLES = 36,
+	IFLA_BR_NF_CALL_IP6_TABLES = 37,
+	IFLA_BR_NF_CALL_ARPTABLES = 38,
+	IFLA_BR_VLAN_DEFAULT_PVID = 39,
+	IFLA_BR_PAD = 40,
+	IFLA_BR_VLAN_STATS_ENABLED = 41,
+	IFLA_BR_MCAST_STATS_ENABLED = 42,
+	IFLA_BR_MCAST_IGMP_VERSION = 43,
+	IFLA_BR_MCAST_MLD_VERSION = 44,
+	IFLA_BR_VLAN_STATS_PER_PORT = 45,
+	IFLA_BR_MULTI_BOOLOPT = 46,
+	IFLA_BR_MCAST_QUERIER_STATE = 47,
+	IFLA_BR_FDB_N_LEARNED = 48,
+	IFLA_BR_FDB_MAX_LEARNED = 49,
+};
+
+enum {
+	IFLA_BRPORT_STATE = 1,
+	IFLA_BRPORT_PRIORITY = 2,
+	IFLA_BRPORT_COST = 3,
+	IFLA_BRPORT_MODE = 4,
+	IFLA_BRPORT_GUARD = 5,
+	IFLA_BRPORT_PROTECT = 6,
+	IFLA_BRPORT_FAST_LEAVE = 7,
+	IFLA_BRPORT_LEARNING = 8,
+	IFLA_BRPORT_UNICAST_FLOOD = 9,
+	IFLA_BRPORT_PROXYARP = 10,
+	IFLA_BRPORT_LEARNING_SYNC = 11,
+	IFLA_BRPORT_PROXYARP_WIFI = 12,
+	IFLA_BRPORT_ROOT_ID = 13,
+	IFLA_BRPORT_BRIDGE_ID = 14,
+	IFLA_BRPORT_DESIGNATED_PORT = 15,
+	IFLA_BRPORT_DESIGNATED_COST = 16,
+	IFLA_BRPORT_ID = 17,
+	IFLA_BRPORT_NO = 18,
+	IFLA_BRPORT_TOPOLOGY_CHANGE_ACK = 19,
+	IFLA_BRPORT_CONFIG_PENDING = 20,
+	IFLA_BRPORT_MESSAGE_AGE_TIMER = 21,
+	IFLA_BRPORT_FORWARD_DELAY_TIMER = 22,
+	IFLA_BRPORT_HOLD_TIMER = 23,
+	IFLA_BRPORT_FLUSH = 24,
+	IFLA_BRPORT_MULTICAST_ROUTER = 25,
+	IFLA_BRPORT_PAD = 26,
+	IFLA_BRPORT_MCAST_FLOOD = 27,
+	IFLA_BRPORT_MCAST_TO_UCAST = 28,
+	IFLA_BRPORT_VLAN_TUNNEL = 29,
+	IFLA_BRPORT_BCAST_FLOOD = 30,
+	IFLA_BRPORT_GROUP_FWD_MASK = 31,
+	IFLA_BRPORT_NEIGH_SUPPRESS = 32,
+	IFLA_BRPORT_ISOLATED = 33,
+	IFLA_BRPORT_BACKUP_PORT = 34,
+	IFLA_BRPORT_MRP_RING_OPEN = 35,
+	IFLA_BRPORT_MRP_IN_OPEN = 36,
+	IFLA_BRPORT_MCAST_EHT_HOSTS_LIMIT = 37,
+	IFLA_BRPORT_MCAST_EHT_HOSTS_CNT = 38,
+	IFLA_BRPORT_LOCKED = 39,
+	IFLA_BRPORT_MAB = 40,
+	IFLA_BRPORT_MCAST_N_GROUPS = 41,
+	IFLA_BRPORT_MCAST_MAX_GROUPS = 42,
+	IFLA_BRPORT_NEIGH_VLAN_SUPPRESS = 43,
+	IFLA_BRPORT_BACKUP_NHID = 44,
+};
+
+enum {
+	IFLA_GRE_LINK = 1,
+	IFLA_GRE_IFLAGS = 2,
+	IFLA_GRE_OFLAGS = 3,
+	IFLA_GRE_IKEY = 4,
+	IFLA_GRE_OKEY = 5,
+	IFLA_GRE_LOCAL = 6,
+	IFLA_GRE_REMOTE = 7,
+	IFLA_GRE_TTL = 8,
+	IFLA_GRE_TOS = 9,
+	IFLA_GRE_PMTUDISC = 10,
+	IFLA_GRE_ENCAP_LIMIT = 11,
+	IFLA_GRE_FLOWINFO = 12,
+	IFLA_GRE_FLAGS = 13,
+	IFLA_GRE_ENCAP_TYPE = 14,
+	IFLA_GRE_ENCAP_FLAGS = 15,
+	IFLA_GRE_ENCAP_SPORT = 16,
+	IFLA_GRE_ENCAP_DPORT = 17,
+	IFLA_GRE_COLLECT_METADATA = 18,
+	IFLA_GRE_IGNORE_DF = 19,
+	IFLA_GRE_FWMARK = 20,
+	IFLA_GRE_ERSPAN_INDEX = 21,
+	IFLA_GRE_ERSPAN_VER = 22,
+	IFLA_GRE_ERSPAN_DIR = 23,
+	IFLA_GRE_ERSPAN_HWID = 24,
+};
+
+enum {
+	IFLA_VTI_LINK = 1,
+	IFLA_VTI_IKEY = 2,
+	IFLA_VTI_OKEY = 3,
+	IFLA_VTI_LOCAL = 4,
+	IFLA_VTI_REMOTE = 5,
+	IFLA_VTI_FWMARK = 6,
+};
+
+enum {
+	IFLA_GENEVE_ID = 1,
+	IFLA_GENEVE_REMOTE = 2,
+	IFLA_GENEVE_TTL = 3,
+	IFLA_GENEVE_TOS = 4,
+	IFLA_GENEVE_PORT = 5,
+	IFLA_GENEVE_COLLECT_METADATA = 6,
+	IFLA_GENEVE_REMOTE6 = 7,
+	IFLA_GENEVE_UDP_CSUM = 8,
+	IFLA_GENEVE_UDP_ZERO_CSUM6_TX = 9,
+	IFLA_GENEVE_UDP_ZERO_CSUM6_RX = 10,
+	IFLA_GENEVE_LABEL = 11,
+	IFLA_GENEVE_TTL_INHERIT = 12,
+	IFLA_GENEVE_DF = 13,
+	IFLA_GENEVE_INNER_PROTO_INHERIT = 14,
+};
+
+enum {
+	IFLA_IPTUN_LINK = 1,
+	IFLA_IPTUN_LOCAL = 2,
+	IFLA_IPTUN_REMOTE = 3,
+	IFLA_IPTUN_TTL = 4,
+	IFLA_IPTUN_TOS = 5,
+	IFLA_IPTUN_ENCAP_LIMIT = 6,
+	IFLA_IPTUN_FLOWINFO = 7,
+	IFLA_IPTUN_FLAGS = 8,
+	IFLA_IPTUN_PROTO = 9,
+	IFLA_IPTUN_PMTUDISC = 10,
+	IFLA_IPTUN_6RD_PREFIX = 11,
+	IFLA_IPTUN_6RD_RELAY_PREFIX = 12,
+	IFLA_IPTUN_6RD_PREFIXLEN = 13,
+	IFLA_IPTUN_6RD_RELAY_PREFIXLEN = 14,
+	IFLA_IPTUN_ENCAP_TYPE = 15,
+	IFLA_IPTUN_ENCAP_FLAGS = 16,
+	IFLA_IPTUN_ENCAP_SPORT = 17,
+	IFLA_IPTUN_ENCAP_DPORT = 18,
+	IFLA_IPTUN_COLLECT_METADATA = 19,
+	IFLA_IPTUN_FWMARK = 20,
+};
+
+enum {
+	IFLA_TUN_OWNER = 1,
+	IFLA_TUN_GROUP = 2,
+	IFLA_TUN_TYPE = 3,
+	IFLA_TUN_PI = 4,
+	IFLA_TUN_VNET_HDR = 5,
+	IFLA_TUN_PERSIST = 6,
+	IFLA_TUN_MULTI_QUEUE = 7,
+	IFLA_TUN_NUM_QUEUES = 8,
+	IFLA_TUN_NUM_DISABLED_QUEUES = 9,
+};
+
+enum {
+	IFLA_VLAN_ID = 1,
+	IFLA_VLAN_FLAG = 2,
+	IFLA_VLAN_EGRESS_QOS = 3,
+	IFLA_VLAN_INGRESS_QOS = 4,
+	IFLA_VLAN_PROTOCOL = 5,
+};
+
+enum {
+	IFLA_VLAN_QOSMAPPING = 1,
+};
+
+enum {
+	IFLA_VRF_TABLE = 1,
+};
+
+enum {
+	RT_LINK_A_XDP_ATTRS_FD = 1,
+	RT_LINK_A_XDP_ATTRS_ATTACHED = 2,
+	RT_LINK_A_XDP_ATTRS_FLAGS = 3,
+	RT_LINK_A_XDP_ATTRS_PROG_ID = 4,
+	RT_LINK_A_XDP_ATTRS_DRV_PROG_ID = 5,
+	RT_LINK_A_XDP_ATTRS_SKB_PROG_ID = 6,
+	RT_LINK_A_XDP_ATTRS_HW_PROG_ID = 7,
+	RT_LINK_A_XDP_ATTRS_EXPECTED_FD = 8,
+};
+
+enum {
+	RT_LINK_A_IFLA_ATTRS_CONF = 1,
+};
+
+enum {
+	RT_LINK_A_IFLA6_ATTRS_FLAGS = 1,
+	RT_LINK_A_IFLA6_ATTRS_CONF = 2,
+	RT_LINK_A_IFLA6_ATTRS_STATS = 3,
+	RT_LINK_A_IFLA6_ATTRS_MCAST = 4,
+	RT_LINK_A_IFLA6_ATTRS_CACHEINFO = 5,
+	RT_LINK_A_IFLA6_ATTRS_ICMP6_STATS = 6,
+	RT_LINK_A_IFLA6_ATTRS_TOKEN = 7,
+	RT_LINK_A_IFLA6_ATTRS_ADDR_GEN_MODE = 8,
+	RT_LINK_A_IFLA6_ATTRS_RA_MTU = 9,
+};
+
+enum {
+	RT_LINK_A_MCTP_ATTRS_MCTP_NET = 1,
+	RT_LINK_A_MCTP_ATTRS_PHYS_BINDING = 2,
+};
+
+enum {
+	IFLA_STATS_LINK_64 = 1,
+	IFLA_STATS_LINK_XSTATS = 2,
+	IFLA_STATS_LINK_XSTATS_SLAVE = 3,
+	IFLA_STATS_LINK_OFFLOAD_XSTATS = 4,
+	IFLA_STATS_AF_SPEC = 5,
+};
+
+enum {
+	RT_LINK_A_LINK_OFFLOAD_XSTATS_CPU_HIT = 1,
+	RT_LINK_A_LINK_OFFLOAD_XSTATS_HW_S_INFO = 2,
+	RT_LINK_A_LINK_OFFLOAD_XSTATS_L3_STATS = 3,
+};
+
+enum {
+	RT_LINK_A_HW_S_INFO_ONE_REQUEST = 1,
+	RT_LINK_A_HW_S_INFO_ONE_USED = 2,
+};
+
+enum {
+	RT_LINK_A_LINK_DPLL_PIN_ATTRS_ID = 1,
+};
+
+enum {
+	IFLA_NETKIT_PEER_INFO = 1,
+	IFLA_NETKIT_PRIMARY = 2,
+	IFLA_NETKIT_POLICY = 3,
+	IFLA_NETKIT_PEER_POLICY = 4,
+	IFLA_NETKIT_MODE = 5,
+	IFLA_NETKIT_SCRUB = 6,
+	IFLA_NETKIT_PEER_SCRUB = 7,
+	IFLA_NETKIT_HEADROOM = 8,
+	IFLA_NETKIT_TAILROOM = 9,
+};
+
+const struct ynl_family& get_ynl_rt_link_family();
+
+/* Enums */
+std::string_view rt_link_op_str(int op);
+std::string_view rt_link_ifinfo_flags_str(rt_link_ifinfo_flags value);
+std::string_view rt_link_vlan_protocols_str(rt_link_vlan_protocols value);
+std::string_view rt_link_vlan_flags_str(rt_link_vlan_flags value);
+std::string_view
+rt_link_ifla_vf_link_state_enum_str(rt_link_ifla_vf_link_state_enum value);
+std::string_view rt_link_rtext_filter_str(rt_link_rtext_filter value);
+std::string_view rt_link_netkit_policy_str(rt_link_netkit_policy value);
+std::string_view rt_link_netkit_mode_str(rt_link_netkit_mode value);
+std::string_view rt_link_netkit_scrub_str(rt_link_netkit_scrub value);
+
+/* Common nested types */
+struct rt_link_linkinfo_attrs {
+	std::string kind;
+	std::vector<__u8> data;
+	std::vector<__u8> xstats;
+	std::string slave_kind;
+	std::vector<__u8> slave_data;
+};
+
+struct rt_link_vf_ports_attrs {
+};
+
+struct rt_link_port_self_attrs {
+};
+
+struct rt_link_xdp_attrs {
+	std::optional<__s32> fd;
+	std::optional<__u8> attached;
+	std::optional<__u32> flags;
+	std::optional<__u32> prog_id;
+	std::optional<__u32> drv_prog_id;
+	std::optional<__u32> skb_prog_id;
+	std::optional<__u32> hw_prog_id;
+	std::optional<__s32> expected_fd;
+};
+
+struct rt_link_link_dpll_pin_attrs {
+	std::optional<__u32> id;
+};
+
+struct rt_link_ifla_attrs {
+	std::vector<__u8> conf;
+};
+
+struct rt_link_ifla6_attrs {
+	std::optional<__u32> flags;
+	std::vector<__u8> conf;
+	std::vector<__u8> stats;
+	std::vector<__u8> mcast;
+	std::vector<__u8> cacheinfo;
+	std::vector<__u8> icmp6_stats;
+	std::vector<__u8> token;
+	std::optional<__u8> addr_gen_mode;
+	std::optional<__u32> ra_mtu;
+};
+
+struct rt_link_mctp_attrs {
+	std::optional<__u32> mctp_net;
+	std::optional<__u8> phys_binding;
+};
+
+struct rt_link_hw_s_info_one {
+	std::optional<__u32> idx;
+	std::optional<__u8> request;
+	std::optional<__u8> used;
+};
+
+struct rt_link_vf_stats_attrs {
+	std::optional<__u64> rx_packets;
+	std::optional<__u64> tx_packets;
+	std::optional<__u64> rx_bytes;
+	std::optional<__u64> tx_bytes;
+	std::optional<__u64> broadcast;
+	std::optional<__u64> multicast;
+	std::optional<__u64> rx_dropped;
+	std::optional<__u64> tx_dropped;
+};
+
+struct rt_link_vf_vlan_attrs {
+	std::vector<std::vector<__u8>> info;
+};
+
+struct rt_link_af_spec_attrs {
+	std::optional<rt_link_ifla_attrs> inet;
+	std::optional<rt_link_ifla6_attrs> inet6;
+	std::optional<rt_link_mctp_attrs> mctp;
+};
+
+struct rt_link_link_offload_xstats {
+	std::vector<__u8> cpu_hit;
+	std::vector<rt_link_hw_s_info_one> hw_s_info;
+	std::vector<__u8> l3_stats;
+};
+
+struct rt_link_vfinfo_attrs {
+	std::vector<__u8> mac;
+	std::vector<__u8> vlan;
+	std::vector<__u8> tx_rate;
+	std::vector<__u8> spoofchk;
+	std::vector<__u8> link_state;
+	std::vector<__u8> rate;
+	std::vector<__u8> rss_query_en;
+	std::optional<rt_link_vf_stats_attrs> stats;
+	std::vector<__u8> trust;
+	std::vector<__u8> ib_node_guid;
+	std::vector<__u8> ib_port_guid;
+	std::optional<rt_link_vf_vlan_attrs> vlan_list;
+	std::vector<__u8> broadcast;
+};
+
+struct rt_link_vfinfo_list_attrs {
+	std::vector<rt_link_vfinfo_attrs> info;
+};
+
+/* Policies and nested encoders */
+extern struct ynl_policy_nest rt_link_linkinfo_attrs_nest;
+extern struct ynl_policy_nest rt_link_vf_ports_attrs_nest;
+extern struct ynl_policy_nest rt_link_port_self_attrs_nest;
+extern struct ynl_policy_nest rt_link_xdp_attrs_nest;
+extern struct ynl_policy_nest rt_link_link_dpll_pin_attrs_nest;
+extern struct ynl_policy_nest rt_link_ifla_attrs_nest;
+extern struct ynl_policy_nest rt_link_ifla6_attrs_nest;
+extern struct ynl_policy_nest rt_link_mctp_attrs_nest;
+extern struct ynl_policy_nest rt_link_hw_s_info_one_nest;
+extern struct ynl_policy_nest rt_link_vf_stats_attrs_nest;
+extern struct ynl_policy_nest rt_link_vf_vlan_attrs_nest;
+extern struct ynl_policy_nest rt_link_af_spec_attrs_nest;
+extern struct ynl_policy_nest rt_link_link_offload_xstats_nest;
+extern struct ynl_policy_nest rt_link_vfinfo_attrs_nest;
+extern struct ynl_policy_nest rt_link_vfinfo_list_attrs_nest;
+extern struct ynl_policy_nest rt_link_link_attrs_nest;
+extern struct ynl_policy_nest rt_link_stats_attrs_nest;
+int rt_link_linkinfo_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const rt_link_linkinfo_attrs&  obj);
+int rt_link_vf_ports_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const rt_link_vf_ports_attrs&  obj);
+int rt_link_port_self_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				const rt_link_port_self_attrs&  obj);
+int rt_link_xdp_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			  const rt_link_xdp_attrs&  obj);
+int rt_link_ifla_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			   const rt_link_ifla_attrs&  obj);
+int rt_link_ifla6_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			    const rt_link_ifla6_attrs&  obj);
+int rt_link_mctp_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			   const rt_link_mctp_attrs&  obj);
+int rt_link_vf_stats_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			       const rt_link_vf_stats_attrs&  obj);
+int rt_link_vf_vlan_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			      const rt_link_vf_vlan_attrs&  obj);
+int rt_link_af_spec_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			      const rt_link_af_spec_attrs&  obj);
+int rt_link_vfinfo_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			     const rt_link_vfinfo_attrs&  obj);
+int rt_link_vfinfo_list_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+				  const rt_link_vfinfo_list_attrs&  obj);
+
+/* ============== NEWLINK ============== */
+/* NEWLINK - do */
+struct rt_link_newlink_req {
+	__u16 _nlmsg_flags{};
+
+	struct ifinfomsg _hdr{};
+
+	std::string ifname;
+	std::optional<__u32> net_ns_pid;
+	std::optional<__u32> net_ns_fd;
+	std::optional<__s32> target_netnsid;
+	std::optional<__s32> link_netnsid;
+	std::optional<rt_link_linkinfo_attrs> linkinfo;
+	std::optional<__u32> group;
+	std::optional<__u32> num_tx_queues;
+	std::optional<__u32> num_rx_queues;
+	std::vector<__u8> address;
+	std::vector<__u8> broadcast;
+	std::optional<__u32> mtu;
+	std::optional<__u32> txqlen;
+	std::optional<__u8> operstate;
+	std::optional<__u8> linkmode;
+	std::optional<__u32> gso_max_size;
+	std::optional<__u32> gso_max_segs;
+	std::optional<__u32> gro_max_size;
+	std::optional<__u32> gso_ipv4_max_size;
+	std::optional<__u32> gro_ipv4_max_size;
+	std::optional<rt_link_af_spec_attrs> af_spec;
+};
+
+/*
+ * Create a new link.
+ */
+int rt_link_newlink(ynl_cpp::ynl_socket&  ys, rt_link_newlink_req& req);
+ynl_cpp::result<void>
+rt_link_newlink_ex(ynl_cpp::ynl_socket&  ys, rt_link_newlink_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_newlink_prepare(ynl_cpp::ynl_socket&  ys, rt_link_newlink_req& req);
+int rt_link_newlink(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_link_newlink_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_link_newlink_batch(ynl_cpp::msg_batch& batch, rt_link_newlink_req& req);
+
+/* ============== DELLINK ============== */
+/* DELLINK - do */
+struct rt_link_dellink_req {
+	__u16 _nlmsg_flags{};
+
+	struct ifinfomsg _hdr{};
+
+	std::string ifname;
+};
+
+/*
+ * Delete an existing link.
+ */
+int rt_link_dellink(ynl_cpp::ynl_socket&  ys, rt_link_dellink_req& req);
+ynl_cpp::result<void>
+rt_link_dellink_ex(ynl_cpp::ynl_socket&  ys, rt_link_dellink_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_dellink_prepare(ynl_cpp::ynl_socket&  ys, rt_link_dellink_req& req);
+int rt_link_dellink(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_link_dellink_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_link_dellink_batch(ynl_cpp::msg_batch& batch, rt_link_dellink_req& req);
+
+/* ============== GETLINK ============== */
+/* GETLINK - do */
+struct rt_link_getlink_req {
+	__u16 _nlmsg_flags{};
+
+	struct ifinfomsg _hdr{};
+
+	std::string ifname;
+	std::vector<std::string> alt_ifname;
+	std::optional<__u32> ext_mask;
+	std::optional<__s32> target_netnsid;
+};
+
+struct rt_link_getlink_rsp {
+	struct ifinfomsg _hdr{};
+
+	std::vector<__u8> address;
+	std::vector<__u8> broadcast;
+	std::string ifname;
+	std::optional<__u32> mtu;
+	std::optional<__u32> link;
+	std::string qdisc;
+	std::vector<__u8> stats;
+	std::string cost;
+	std::string priority;
+	std::optional<__u32> master;
+	std::string wireless;
+	std::string protinfo;
+	std::optional<__u32> txqlen;
+	std::vector<__u8> map;
+	std::optional<__u32> weight;
+	std::optional<__u8> operstate;
+	std::optional<__u8> linkmode;
+	std::optional<rt_link_linkinfo_attrs> linkinfo;
+	std::optional<__u32> net_ns_pid;
+	std::string ifalias;
+	std::optional<__u32> num_vf;
+	std::optional<rt_link_vfinfo_list_attrs> vfinfo_list;
+	std::vector<__u8> stats64;
+	std::optional<rt_link_vf_ports_attrs> vf_ports;
+	std::optional<rt_link_port_self_attrs> port_self;
+	std::optional<rt_link_af_spec_attrs> af_spec;
+	std::optional<__u32> group;
+	std::optional<__u32> net_ns_fd;
+	std::optional<__u32> ext_mask;
+	std::optional<__u32> promiscuity;
+	std::optional<__u32> num_tx_queues;
+	std::optional<__u32> num_rx_queues;
+	std::optional<__u8> carrier;
+	std::vector<__u8> phys_port_id;
+	std::optional<__u32> carrier_changes;
+	std::vector<__u8> phys_switch_id;
+	std::optional<__s32> link_netnsid;
+	std::string phys_port_name;
+	std::optional<__u8> proto_down;
+	std::optional<__u32> gso_max_segs;
+	std::optional<__u32> gso_max_size;
+	std::optional<rt_link_xdp_attrs> xdp;
+	std::optional<__u32> event;
+	std::optional<__s32> new_netnsid;
+	std::optional<__s32> target_netnsid;
+	std::optional<__u32> carrier_up_count;
+	std::optional<__u32> carrier_down_count;
+	std::optional<__s32> new_ifindex;
+	std::optional<__u32> min_mtu;
+	std::optional<__u32> max_mtu;
+	std::vector<__u8> prop_list;
+	std::vector<std::string> alt_ifname;
+	std::vector<__u8> perm_address;
+	std::string proto_down_reason;
+	std::string parent_dev_name;
+	std::string parent_dev_bus_name;
+	std::optional<__u32> gro_max_size;
+	std::optional<__u32> tso_max_size;
+	std::optional<__u32> tso_max_segs;
+	std::optional<__u32> allmulti;
+	std::vector<__u8> devlink_port;
+	std::optional<__u32> gso_ipv4_max_size;
+	std::optional<__u32> gro_ipv4_max_size;
+};
+
+/*
+ * Get / dump information about a link.
+ */
+std::unique_ptr<rt_link_getlink_rsp>
+rt_link_getlink(ynl_cpp::ynl_socket&  ys, rt_link_getlink_req& req);
+ynl_cpp::result<std::unique_ptr<rt_link_getlink_rsp>>
+rt_link_getlink_ex(ynl_cpp::ynl_socket&  ys, rt_link_getlink_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_getlink_prepare(ynl_cpp::ynl_socket&  ys, rt_link_getlink_req& req);
+std::unique_ptr<rt_link_getlink_rsp>
+rt_link_getlink(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<rt_link_getlink_rsp>>
+rt_link_getlink_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
+
+/* GETLINK - dump */
+struct rt_link_getlink_req_dump {
+	struct ifinfomsg _hdr{};
+
+	std::optional<__s32> target_netnsid;
+	std::optional<__u32> ext_mask;
+	std::optional<__u32> master;
+	std::optional<rt_link_linkinfo_attrs> linkinfo;
+};
+
+struct rt_link_getlink_list {
+	std::list<rt_link_getlink_rsp> objs;
+};
+
+std::unique_ptr<rt_link_getlink_list>
+rt_link_getlink_dump(ynl_cpp::ynl_socket&  ys, rt_link_getlink_req_dump& req);
+ynl_cpp::result<std::unique_ptr<rt_link_getlink_list>>
+rt_link_getlink_dump_ex(ynl_cpp::ynl_socket&  ys,
+			rt_link_getlink_req_dump& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_getlink_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     rt_link_getlink_req_dump& req);
+std::unique_ptr<rt_link_getlink_list>
+rt_link_getlink_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<rt_link_getlink_list>>
+rt_link_getlink_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
+
+/* ============== SETLINK ============== */
+/* SETLINK - do */
+struct rt_link_setlink_req {
+	__u16 _nlmsg_flags{};
+
+	struct ifinfomsg _hdr{};
+
+	std::vector<__u8> address;
+	std::vector<__u8> broadcast;
+	std::string ifname;
+	std::optional<__u32> mtu;
+	std::optional<__u32> link;
+	std::string qdisc;
+	std::vector<__u8> stats;
+	std::string cost;
+	std::string priority;
+	std::optional<__u32> master;
+	std::string wireless;
+	std::string protinfo;
+	std::optional<__u32> txqlen;
+	std::vector<__u8> map;
+	std::optional<__u32> weight;
+	std::optional<__u8> operstate;
+	std::optional<__u8> linkmode;
+	std::optional<rt_link_linkinfo_attrs> linkinfo;
+	std::optional<__u32> net_ns_pid;
+	std::string ifalias;
+	std::optional<__u32> num_vf;
+	std::optional<rt_link_vfinfo_list_attrs> vfinfo_list;
+	std::vector<__u8> stats64;
+	std::optional<rt_link_vf_ports_attrs> vf_ports;
+	std::optional<rt_link_port_self_attrs> port_self;
+	std::optional<rt_link_af_spec_attrs> af_spec;
+	std::optional<__u32> group;
+	std::optional<__u32> net_ns_fd;
+	std::optional<__u32> ext_mask;
+	std::optional<__u32> promiscuity;
+	std::optional<__u32> num_tx_queues;
+	std::optional<__u32> num_rx_queues;
+	std::optional<__u8> carrier;
+	std::vector<__u8> phys_port_id;
+	std::optional<__u32> carrier_changes;
+	std::vector<__u8> phys_switch_id;
+	std::optional<__s32> link_netnsid;
+	std::string phys_port_name;
+	std::optional<__u8> proto_down;
+	std::optional<__u32> gso_max_segs;
+	std::optional<__u32> gso_max_size;
+	std::optional<rt_link_xdp_attrs> xdp;
+	std::optional<__u32> event;
+	std::optional<__s32> new_netnsid;
+	std::optional<__s32> target_netnsid;
+	std::optional<__u32> carrier_up_count;
+	std::optional<__u32> carrier_down_count;
+	std::optional<__s32> new_ifindex;
+	std::optional<__u32> min_mtu;
+	std::optional<__u32> max_mtu;
+	std::vector<__u8> prop_list;
+	std::vector<std::string> alt_ifname;
+	std::vector<__u8> perm_address;
+	std::string proto_down_reason;
+	std::string parent_dev_name;
+	std::string parent_dev_bus_name;
+	std::optional<__u32> gro_max_size;
+	std::optional<__u32> tso_max_size;
+	std::optional<__u32> tso_max_segs;
+	std::optional<__u32> allmulti;
+	std::vector<__u8> devlink_port;
+	std::optional<__u32> gso_ipv4_max_size;
+	std::optional<__u32> gro_ipv4_max_size;
+};
+
+/*
+ * Set information about a link.
+ */
+int rt_link_setlink(ynl_cpp::ynl_socket&  ys, rt_link_setlink_req& req);
+ynl_cpp::result<void>
+rt_link_setlink_ex(ynl_cpp::ynl_socket&  ys, rt_link_setlink_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_setlink_prepare(ynl_cpp::ynl_socket&  ys, rt_link_setlink_req& req);
+int rt_link_setlink(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_link_setlink_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_link_setlink_batch(ynl_cpp::msg_batch& batch, rt_link_setlink_req& req);
+
+/* ============== GETSTATS ============== */
+/* GETSTATS - do */
+struct rt_link_getstats_req {
+	__u16 _nlmsg_flags{};
+
+	struct if_stats_msg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t rt_link_getstats_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct if_stats_msg)) + 0;
+
+struct rt_link_getstats_rsp {
+	struct if_stats_msg _hdr{};
+
+	std::vector<__u8> link_64;
+	std::vector<__u8> link_xstats;
+	std::vector<__u8> link_xstats_slave;
+	std::optional<rt_link_link_offload_xstats> link_offload_xstats;
+	std::vector<__u8> af_spec;
+};
+
+/*
+ * Get / dump link stats.
+ */
+std::unique_ptr<rt_link_getstats_rsp>
+rt_link_getstats(ynl_cpp::ynl_socket&  ys, rt_link_getstats_req& req);
+ynl_cpp::result<std::unique_ptr<rt_link_getstats_rsp>>
+rt_link_getstats_ex(ynl_cpp::ynl_socket&  ys, rt_link_getstats_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_getstats_prepare(ynl_cpp::ynl_socket&  ys, rt_link_getstats_req& req);
+std::unique_ptr<rt_link_getstats_rsp>
+rt_link_getstats(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<rt_link_getstats_rsp>>
+rt_link_getstats_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
+
+/* GETSTATS - dump */
+struct rt_link_getstats_req_dump {
+	struct if_stats_msg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t rt_link_getstats_req_dump_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct if_stats_msg)) + 0;
+
+struct rt_link_getstats_list {
+	std::list<rt_link_getstats_rsp> objs;
+};
+
+std::unique_ptr<rt_link_getstats_list>
+rt_link_getstats_dump(ynl_cpp::ynl_socket&  ys, rt_link_getstats_req_dump& req);
+ynl_cpp::result<std::unique_ptr<rt_link_getstats_list>>
+rt_link_getstats_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 rt_link_getstats_req_dump& req,
+			 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_link_getstats_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			      rt_link_getstats_req_dump& req);
+std::unique_ptr<rt_link_getstats_list>
+rt_link_getstats_dump(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<rt_link_getstats_list>>
+rt_link_getstats_dump_ex(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl,
+			 const ynl_cpp::projection *proj = nullptr);
+
+} //namespace ynl_cpp
+#endif /* _LINUX_RT_LINK_GEN_H */
@@ -0,0 +1,1083 @@
+// SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause)
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user source */
+
+#include "rt_neigh-user.hpp"
+
+#include <array>
+
+#include <linux/genetlink.h>
+#include <linux/rtnetlink.h>
+
+namespace ynl_cpp {
+
+/* Enums */
+static constexpr std::array<std::string_view, 64 + 1> rt_neigh_op_strmap = []() {
+	std::array<std::string_view, 64 + 1> arr{};
+	arr[RTM_DELNEIGH] = "delneigh-ntf";
+	arr[RTM_NEWNEIGH] = "newneigh-ntf";
+	arr[64] = "getneightbl";
+	return arr;
+} ();
+
+std::string_view rt_neigh_op_str(int op)
+{
+	if (op < 0 || op >= (int)(rt_neigh_op_strmap.size()))
+		return "";
+	return rt_neigh_op_strmap[op];
+}
+
+static constexpr std::array<std::string_view, 7 + 1> rt_neigh_nud_state_strmap = []() {
+	std::array<std::string_view, 7 + 1> arr{};
+	arr[0] = "incomplete";
+	arr[1] = "reachable";
+	arr[2] = "stale";
+	arr[3] = "delay";
+	arr[4] = "probe";
+	arr[5] = "failed";
+	arr[6] = "noarp";
+	arr[7] = "permanent";
+	return arr;
+} ();
+
+std::string_view rt_neigh_nud_state_str(rt_neigh_nud_state value)
+{
+	value = (rt_neigh_nud_state)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(rt_neigh_nud_state_strmap.size()))
+		return "";
+	return rt_neigh_nud_state_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 7 + 1> rt_neigh_ntf_flags_strmap = []() {
+	std::array<std::string_view, 7 + 1> arr{};
+	arr[0] = "use";
+	arr[1] = "self";
+	arr[2] = "master";
+	arr[3] = "proxy";
+	arr[4] = "ext-learned";
+	arr[5] = "offloaded";
+	arr[6] = "sticky";
+	arr[7] = "router";
+	return arr;
+} ();
+
+std::string_view rt_neigh_ntf_flags_str(rt_neigh_ntf_flags value)
+{
+	value = (rt_neigh_ntf_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(rt_neigh_ntf_flags_strmap.size()))
+		return "";
+	return rt_neigh_ntf_flags_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 1 + 1> rt_neigh_ntf_ext_flags_strmap = []() {
+	std::array<std::string_view, 1 + 1> arr{};
+	arr[0] = "managed";
+	arr[1] = "locked";
+	return arr;
+} ();
+
+std::string_view rt_neigh_ntf_ext_flags_str(rt_neigh_ntf_ext_flags value)
+{
+	value = (rt_neigh_ntf_ext_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(rt_neigh_ntf_ext_flags_strmap.size()))
+		return "";
+	return rt_neigh_ntf_ext_flags_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 11 + 1> rt_neigh_rtm_type_strmap = []() {
+	std::array<std::string_view, 11 + 1> arr{};
+	arr[0] = "unspec";
+	arr[1] = "unicast";
+	arr[2] = "local";
+	arr[3] = "broadcast";
+	arr[4] = "anycast";
+	arr[5] = "multicast";
+	arr[6] = "blackhole";
+	arr[7] = "unreachable";
+	arr[8] = "prohibit";
+	arr[9] = "throw";
+	arr[10] = "nat";
+	arr[11] = "xresolve";
+	return arr;
+} ();
+
+std::string_view rt_neigh_rtm_type_str(rt_neigh_rtm_type value)
+{
+	if (value < 0 || value >= (int)(rt_neigh_rtm_type_strmap.size()))
+		return "";
+	return rt_neigh_rtm_type_strmap[value];
+}
+
+/* Policies */
+static std::array<ynl_policy_attr,19 + 1> rt_neigh_ndtpa_attrs_policy = []() {
+	std::array<ynl_policy_attr,19 + 1> arr{};
+	arr[RT_NEIGH_A_NDTPA_ATTRS_IFINDEX] = { .name = "ifindex", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_REFCNT] = { .name = "refcnt", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_REACHABLE_TIME] = { .name = "reachable-time", .type = YNL_PT_U64, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_BASE_REACHABLE_TIME] = { .name = "base-reachable-time", .type = YNL_PT_U64, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_RETRANS_TIME] = { .name = "retrans-time", .type = YNL_PT_U64, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_GC_STALETIME] = { .name = "gc-staletime", .type = YNL_PT_U64, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_DELAY_PROBE_TIME] = { .name = "delay-probe-time", .type = YNL_PT_U64, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_QUEUE_LEN] = { .name = "queue-len", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_APP_PROBES] = { .name = "app-probes", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_UCAST_PROBES] = { .name = "ucast-probes", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_MCAST_PROBES] = { .name = "mcast-probes", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_ANYCAST_DELAY] = { .name = "anycast-delay", .type = YNL_PT_U64, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_PROXY_DELAY] = { .name = "proxy-delay", .type = YNL_PT_U64, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_PROXY_QLEN] = { .name = "proxy-qlen", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_LOCKTIME] = { .name = "locktime", .type = YNL_PT_U64, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_QUEUE_LENBYTES] = { .name = "queue-lenbytes", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_MCAST_REPROBES] = { .name = "mcast-reprobes", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_PAD] = { .name = "pad", .type = YNL_PT_IGNORE, };
+	arr[RT_NEIGH_A_NDTPA_ATTRS_INTERVAL_PROBE_TIME_MS] = { .name = "interval-probe-time-ms", .type = YNL_PT_U64, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_neigh_ndtpa_attrs_nest = {
+	.max_attr = 19,
+	.table = rt_neigh_ndtpa_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,17 + 1> rt_neigh_neighbour_attrs_policy = []() {
+	std::array<ynl_policy_attr,17 + 1> arr{};
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_UNSPEC] = { .name = "unspec", .type = YNL_PT_BINARY,};
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_DST] = { .name = "dst", .type = YNL_PT_BINARY,};
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_LLADDR] = { .name = "lladdr", .type = YNL_PT_BINARY,};
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_CACHEINFO] = { .name = "cacheinfo", .type = YNL_PT_BINARY,};
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_PROBES] = { .name = "probes", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_VLAN] = { .name = "vlan", .type = YNL_PT_U16, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_PORT] = { .name = "port", .type = YNL_PT_U16, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_VNI] = { .name = "vni", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_IFINDEX] = { .name = "ifindex", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_MASTER] = { .name = "master", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_LINK_NETNSID] = { .name = "link-netnsid", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_SRC_VNI] = { .name = "src-vni", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_PROTOCOL] = { .name = "protocol", .type = YNL_PT_U8, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_NH_ID] = { .name = "nh-id", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_FDB_EXT_ATTRS] = { .name = "fdb-ext-attrs", .type = YNL_PT_BINARY,};
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_FLAGS_EXT] = { .name = "flags-ext", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_NDM_STATE_MASK] = { .name = "ndm-state-mask", .type = YNL_PT_U16, };
+	arr[RT_NEIGH_A_NEIGHBOUR_ATTRS_NDM_FLAGS_MASK] = { .name = "ndm-flags-mask", .type = YNL_PT_U8, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_neigh_neighbour_attrs_nest = {
+	.max_attr = 17,
+	.table = rt_neigh_neighbour_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,9 + 1> rt_neigh_ndt_attrs_policy = []() {
+	std::array<ynl_policy_attr,9 + 1> arr{};
+	arr[RT_NEIGH_A_NDT_ATTRS_NAME] = { .name = "name", .type = YNL_PT_NUL_STR, };
+	arr[RT_NEIGH_A_NDT_ATTRS_THRESH1] = { .name = "thresh1", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDT_ATTRS_THRESH2] = { .name = "thresh2", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDT_ATTRS_THRESH3] = { .name = "thresh3", .type = YNL_PT_U32, };
+	arr[RT_NEIGH_A_NDT_ATTRS_CONFIG] = { .name = "config", .type = YNL_PT_BINARY,};
+	arr[RT_NEIGH_A_NDT_ATTRS_PARMS] = { .name = "parms", .type = YNL_PT_NEST, .nest = &rt_neigh_ndtpa_attrs_nest, };
+	arr[RT_NEIGH_A_NDT_ATTRS_STATS] = { .name = "stats", .type = YNL_PT_BINARY,};
+	arr[RT_NEIGH_A_NDT_ATTRS_GC_INTERVAL] = { .name = "gc-interval", .type = YNL_PT_U64, };
+	arr[RT_NEIGH_A_NDT_ATTRS_PAD] = { .name = "pad", .type = YNL_PT_IGNORE, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_neigh_ndt_attrs_nest = {
+	.max_attr = 9,
+	.table = rt_neigh_ndt_attrs_policy.data(),
+};
+
+/* Common nested types */
+int rt_neigh_ndtpa_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			     const rt_neigh_ndtpa_attrs&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.ifindex.has_value())
+		ynl_attr_put_u32(nlh, RT_NEIGH_A_NDTPA_ATTRS_IFINDEX, obj.ifindex.value());
+	if (obj.refcnt.has_value())
+		ynl_attr_put_u32(nlh, RT_NEIGH_A_NDTPA_ATTRS_REFCNT, obj.refcnt.value());
+	if (obj.reachable_time.has_value())
+		ynl_attr_put_u64(nlh, RT_NEIGH_A_NDTPA_ATTRS_REACHABLE_TIME, obj.reachable_time.value());
+	if (obj.base_reachable_time.has_value())
+		ynl_attr_put_u64(nlh, RT_NEIGH_A_NDTPA_ATTRS_BASE_REACHABLE_TIME, obj.base_reachable_time.value());
+	if (obj.retrans_time.has_value())
+		ynl_attr_put_u64(nlh, RT_NEIGH_A_NDTPA_ATTRS_RETRANS_TIME, obj.retrans_time.value());
+	if (obj.gc_staletime.has_value())
+		ynl_attr_put_u64(nlh, RT_NEIGH_A_NDTPA_ATTRS_GC_STALETIME, obj.gc_staletime.value());
+	if (obj.delay_probe_time.has_value())
+		ynl_attr_put_u64(nlh, RT_NEIGH_A_NDTPA_ATTRS_DELAY_PROBE_TIME, obj.delay_probe_time.value());
+	if (obj.queue_len.has_value())
+		ynl_attr_put_u32(nlh, RT_NEIGH_A_NDTPA_ATTRS_QUEUE_LEN, obj.queue_len.value());
+	if (obj.app_probes.has_value())
+		ynl_attr_put_u32(nlh, RT_NEIGH_A_NDTPA_ATTRS_APP_PROBES, obj.app_probes.value());
+	if (obj.ucast_probes.has_value())
+		ynl_attr_put_u32(nlh, RT_NEIGH_A_NDTPA_ATTRS_UCAST_PROBES, obj.ucast_probes.value());
+	if (obj.mcast_probes.has_value())
+		ynl_attr_put_u32(nlh, RT_NEIGH_A_NDTPA_ATTRS_MCAST_PROBES, obj.mcast_probes.value());
+	if (obj.anycast_delay.has_value())
+		ynl_attr_put_u64(nlh, RT_NEIGH_A_NDTPA_ATTRS_ANYCAST_DELAY, obj.anycast_delay.value());
+	if (obj.proxy_delay.has_value())
+		ynl_attr_put_u64(nlh, RT_NEIGH_A_NDTPA_ATTRS_PROXY_DELAY, obj.proxy_delay.value());
+	if (obj.proxy_qlen.has_value())
+		ynl_attr_put_u32(nlh, RT_NEIGH_A_NDTPA_ATTRS_PROXY_QLEN, obj.proxy_qlen.value());
+	if (obj.locktime.has_value())
+		ynl_attr_put_u64(nlh, RT_NEIGH_A_NDTPA_ATTRS_LOCKTIME, obj.locktime.value());
+	if (obj.queue_lenbytes.has_value())
+		ynl_attr_put_u32(nlh, RT_NEIGH_A_NDTPA_ATTRS_QUEUE_LENBYTES, obj.queue_lenbytes.value());
+	if (obj.mcast_reprobes.has_value())
+		ynl_attr_put_u32(nlh, RT_NEIGH_A_NDTPA_ATTRS_MCAST_REPROBES, obj.mcast_reprobes.value());
+	if (obj.interval_probe_time_ms.has_value())
+		ynl_attr_put_u64(nlh, RT_NEIGH_A_NDTPA_ATTRS_INTERVAL_PROBE_TIME_MS, obj.interval_probe_time_ms.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_neigh_ndtpa_attrs_parse(struct ynl_parse_arg *yarg,
+			       const struct nlattr *nested)
+{
+	rt_neigh_ndtpa_attrs *dst = (rt_neigh_ndtpa_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_NEIGH_A_NDTPA_ATTRS_IFINDEX) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_REFCNT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->refcnt = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_REACHABLE_TIME) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->reachable_time = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_BASE_REACHABLE_TIME) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->base_reachable_time = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_RETRANS_TIME) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->retrans_time = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_GC_STALETIME) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->gc_staletime = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_DELAY_PROBE_TIME) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->delay_probe_time = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_QUEUE_LEN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->queue_len = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_APP_PROBES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->app_probes = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_UCAST_PROBES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ucast_probes = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_MCAST_PROBES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->mcast_probes = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_ANYCAST_DELAY) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->anycast_delay = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_PROXY_DELAY) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->proxy_delay = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_PROXY_QLEN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->proxy_qlen = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_LOCKTIME) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->locktime = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_QUEUE_LENBYTES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->queue_lenbytes = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_MCAST_REPROBES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->mcast_reprobes = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDTPA_ATTRS_INTERVAL_PROBE_TIME_MS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->interval_probe_time_ms = (__u64)ynl_attr_get_u64(attr);
+		}
+	}
+
+	return 0;
+}
+
+/* ============== NEWNEIGH ============== */
+/* NEWNEIGH - do */
+static void
+rt_neigh_newneigh_put(struct nlmsghdr *nlh, rt_neigh_newneigh_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ndmsg)) + 72 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.probes.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_PROBES, req.probes.value());
+	if (req.vlan.has_value())
+		ynl_attr_put_u16_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_VLAN, req.vlan.value());
+	if (req.port.has_value())
+		ynl_attr_put_u16_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_PORT, req.port.value());
+	if (req.vni.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_VNI, req.vni.value());
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_IFINDEX, req.ifindex.value());
+	if (req.master.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_MASTER, req.master.value());
+	if (req.protocol.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_PROTOCOL, req.protocol.value());
+	if (req.nh_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_NH_ID, req.nh_id.value());
+	if (req.flags_ext.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_FLAGS_EXT, req.flags_ext.value());
+	if (req.dst.size() > 0)
+		ynl_attr_put(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_DST, req.dst.data(), req.dst.size());
+	if (req.lladdr.size() > 0)
+		ynl_attr_put(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_LLADDR, req.lladdr.data(), req.lladdr.size());
+	if (req.fdb_ext_attrs.size() > 0)
+		ynl_attr_put(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_FDB_EXT_ATTRS, req.fdb_ext_attrs.data(), req.fdb_ext_attrs.size());
+}
+
+static ynl_cpp::result<void>
+rt_neigh_newneigh_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_neigh_neighbour_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct ndmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_neigh_newneigh_ex(ynl_cpp::ynl_socket&  ys, rt_neigh_newneigh_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWNEIGH, req._nlmsg_flags);
+	rt_neigh_newneigh_put(nlh, req);
+
+	return rt_neigh_newneigh_exec(ys, nlh);
+}
+
+int rt_neigh_newneigh(ynl_cpp::ynl_socket&  ys, rt_neigh_newneigh_req& req)
+{
+	auto ret = rt_neigh_newneigh_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_newneigh_prepare(ynl_cpp::ynl_socket&  ys, rt_neigh_newneigh_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWNEIGH, req._nlmsg_flags);
+	rt_neigh_newneigh_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct ndmsg));
+}
+
+ynl_cpp::result<void>
+rt_neigh_newneigh_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return rt_neigh_newneigh_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_neigh_newneigh(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_neigh_newneigh_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_neigh_newneigh_batch(ynl_cpp::msg_batch& batch, rt_neigh_newneigh_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_NEWNEIGH, req._nlmsg_flags);
+	rt_neigh_newneigh_put(nlh, req);
+	return batch.msg_end(nlh, &rt_neigh_neighbour_attrs_nest, sizeof(struct ndmsg));
+}
+
+/* ============== DELNEIGH ============== */
+/* DELNEIGH - do */
+static void
+rt_neigh_delneigh_put(struct nlmsghdr *nlh, rt_neigh_delneigh_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ndmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_IFINDEX, req.ifindex.value());
+	if (req.dst.size() > 0)
+		ynl_attr_put(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_DST, req.dst.data(), req.dst.size());
+}
+
+static ynl_cpp::result<void>
+rt_neigh_delneigh_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_neigh_neighbour_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct ndmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_neigh_delneigh_ex(ynl_cpp::ynl_socket&  ys, rt_neigh_delneigh_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELNEIGH, req._nlmsg_flags);
+	rt_neigh_delneigh_put(nlh, req);
+
+	return rt_neigh_delneigh_exec(ys, nlh);
+}
+
+int rt_neigh_delneigh(ynl_cpp::ynl_socket&  ys, rt_neigh_delneigh_req& req)
+{
+	auto ret = rt_neigh_delneigh_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_delneigh_prepare(ynl_cpp::ynl_socket&  ys, rt_neigh_delneigh_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELNEIGH, req._nlmsg_flags);
+	rt_neigh_delneigh_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct ndmsg));
+}
+
+ynl_cpp::result<void>
+rt_neigh_delneigh_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return rt_neigh_delneigh_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_neigh_delneigh(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_neigh_delneigh_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_neigh_delneigh_batch(ynl_cpp::msg_batch& batch, rt_neigh_delneigh_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_DELNEIGH, req._nlmsg_flags);
+	rt_neigh_delneigh_put(nlh, req);
+	return batch.msg_end(nlh, &rt_neigh_neighbour_attrs_nest, sizeof(struct ndmsg));
+}
+
+/* ============== GETNEIGH ============== */
+/* GETNEIGH - do */
+int rt_neigh_getneigh_rsp_parse(const struct nlmsghdr *nlh,
+				struct ynl_parse_arg *yarg)
+{
+	rt_neigh_getneigh_rsp *dst;
+	const struct nlattr *attr;
+	void *hdr;
+
+	dst = (rt_neigh_getneigh_rsp*)yarg->data;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct ndmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct ndmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_DST) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->dst.assign(data, data + len);
+		} else if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_LLADDR) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->lladdr.assign(data, data + len);
+		} else if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_PROBES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->probes = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_VLAN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->vlan = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_PORT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->port = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_VNI) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->vni = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_IFINDEX) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_MASTER) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->master = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_PROTOCOL) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->protocol = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_NH_ID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->nh_id = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_FLAGS_EXT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->flags_ext = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NEIGHBOUR_ATTRS_FDB_EXT_ATTRS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->fdb_ext_attrs.assign(data, data + len);
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+rt_neigh_getneigh_put(struct nlmsghdr *nlh, rt_neigh_getneigh_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.dst.size() > 0)
+		ynl_attr_put(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_DST, req.dst.data(), req.dst.size());
+}
+
+static ynl_cpp::result<std::unique_ptr<rt_neigh_getneigh_rsp>>
+rt_neigh_getneigh_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<rt_neigh_getneigh_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_neigh_neighbour_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct ndmsg);
+	yrs.yarg.rsp_policy = &rt_neigh_neighbour_attrs_nest;
+
+	rsp.reset(new rt_neigh_getneigh_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = rt_neigh_getneigh_rsp_parse;
+	yrs.rsp_cmd = RTM_NEWNEIGH;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneigh_rsp>>
+rt_neigh_getneigh_ex(ynl_cpp::ynl_socket&  ys, rt_neigh_getneigh_req& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETNEIGH, req._nlmsg_flags);
+	rt_neigh_getneigh_put(nlh, req);
+
+	return rt_neigh_getneigh_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<rt_neigh_getneigh_rsp>
+rt_neigh_getneigh(ynl_cpp::ynl_socket&  ys, rt_neigh_getneigh_req& req)
+{
+	auto ret = rt_neigh_getneigh_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_getneigh_prepare(ynl_cpp::ynl_socket&  ys, rt_neigh_getneigh_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETNEIGH, req._nlmsg_flags);
+	rt_neigh_getneigh_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct ndmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneigh_rsp>>
+rt_neigh_getneigh_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return rt_neigh_getneigh_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<rt_neigh_getneigh_rsp>
+rt_neigh_getneigh(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_neigh_getneigh_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* GETNEIGH - dump */
+static void
+rt_neigh_getneigh_dump_put(struct nlmsghdr *nlh,
+			   rt_neigh_getneigh_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ndmsg)) + 16 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_IFINDEX, req.ifindex.value());
+	if (req.master.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NEIGHBOUR_ATTRS_MASTER, req.master.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<rt_neigh_getneigh_list>>
+rt_neigh_getneigh_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<rt_neigh_getneigh_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &rt_neigh_neighbour_attrs_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<rt_neigh_getneigh_list*>(arg)->objs.emplace_back());};
+	yds.cb = rt_neigh_getneigh_rsp_parse;
+	yds.rsp_cmd = RTM_NEWNEIGH;
+	((struct ynl_sock*)ys)->req_policy = &rt_neigh_neighbour_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct ndmsg);
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneigh_list>>
+rt_neigh_getneigh_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  rt_neigh_getneigh_req_dump& req,
+			  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETNEIGH);
+	rt_neigh_getneigh_dump_put(nlh, req);
+
+	return rt_neigh_getneigh_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<rt_neigh_getneigh_list>
+rt_neigh_getneigh_dump(ynl_cpp::ynl_socket&  ys,
+		       rt_neigh_getneigh_req_dump& req)
+{
+	auto ret = rt_neigh_getneigh_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_getneigh_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       rt_neigh_getneigh_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETNEIGH);
+	rt_neigh_getneigh_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct ndmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneigh_list>>
+rt_neigh_getneigh_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj)
+{
+	return rt_neigh_getneigh_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<rt_neigh_getneigh_list>
+rt_neigh_getneigh_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_neigh_getneigh_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* GETNEIGH - notify */
+static_assert(ynl_cpp::ntf_layout_matches<rt_neigh_getneigh_ntf>());
+
+static void *rt_neigh_getneigh_ntf_init(struct ynl_ntf_base_type *ntf)
+{
+	return &(new (ntf) rt_neigh_getneigh_ntf())->obj;
+}
+
+static void rt_neigh_getneigh_ntf_free(struct ynl_ntf_base_type *ntf)
+{
+	rt_neigh_getneigh_ntf *rsp = (rt_neigh_getneigh_ntf *)ntf;
+
+	rsp->~rt_neigh_getneigh_ntf();
+	::free(rsp);
+}
+
+/* ============== GETNEIGHTBL ============== */
+/* GETNEIGHTBL - dump */
+int rt_neigh_getneightbl_rsp_dump_parse(const struct nlmsghdr *nlh,
+					struct ynl_parse_arg *yarg)
+{
+	rt_neigh_getneightbl_rsp_dump *dst;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	void *hdr;
+
+	dst = (rt_neigh_getneightbl_rsp_dump*)yarg->data;
+	parg.ys = yarg->ys;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct ndtmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct ndtmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == RT_NEIGH_A_NDT_ATTRS_NAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
+		} else if (type == RT_NEIGH_A_NDT_ATTRS_THRESH1) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->thresh1 = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDT_ATTRS_THRESH2) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->thresh2 = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDT_ATTRS_THRESH3) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->thresh3 = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_NEIGH_A_NDT_ATTRS_CONFIG) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->config.assign(data, data + len);
+		} else if (type == RT_NEIGH_A_NDT_ATTRS_PARMS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_neigh_ndtpa_attrs_nest;
+			parg.data = &dst->parms.emplace();
+			if (rt_neigh_ndtpa_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == RT_NEIGH_A_NDT_ATTRS_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->stats.assign(data, data + len);
+		} else if (type == RT_NEIGH_A_NDT_ATTRS_GC_INTERVAL) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->gc_interval = (__u64)ynl_attr_get_u64(attr);
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+rt_neigh_getneightbl_dump_put(struct nlmsghdr *nlh,
+			      rt_neigh_getneightbl_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<rt_neigh_getneightbl_rsp_list>>
+rt_neigh_getneightbl_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			       const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<rt_neigh_getneightbl_rsp_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &rt_neigh_ndt_attrs_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<rt_neigh_getneightbl_rsp_list*>(arg)->objs.emplace_back());};
+	yds.cb = rt_neigh_getneightbl_rsp_dump_parse;
+	yds.rsp_cmd = 64;
+	((struct ynl_sock*)ys)->req_policy = &rt_neigh_ndt_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct ndtmsg);
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneightbl_rsp_list>>
+rt_neigh_getneightbl_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     rt_neigh_getneightbl_req_dump& req,
+			     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETNEIGHTBL);
+	rt_neigh_getneightbl_dump_put(nlh, req);
+
+	return rt_neigh_getneightbl_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<rt_neigh_getneightbl_rsp_list>
+rt_neigh_getneightbl_dump(ynl_cpp::ynl_socket&  ys,
+			  rt_neigh_getneightbl_req_dump& req)
+{
+	auto ret = rt_neigh_getneightbl_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_getneightbl_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  rt_neigh_getneightbl_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETNEIGHTBL);
+	rt_neigh_getneightbl_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct ndtmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneightbl_rsp_list>>
+rt_neigh_getneightbl_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj)
+{
+	return rt_neigh_getneightbl_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<rt_neigh_getneightbl_rsp_list>
+rt_neigh_getneightbl_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_neigh_getneightbl_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== SETNEIGHTBL ============== */
+/* SETNEIGHTBL - do */
+static void
+rt_neigh_setneightbl_put(struct nlmsghdr *nlh, rt_neigh_setneightbl_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ndtmsg)) + 36 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.thresh1.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NDT_ATTRS_THRESH1, req.thresh1.value());
+	if (req.thresh2.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NDT_ATTRS_THRESH2, req.thresh2.value());
+	if (req.thresh3.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_NEIGH_A_NDT_ATTRS_THRESH3, req.thresh3.value());
+	if (req.gc_interval.has_value())
+		ynl_attr_put_u64_unchecked(nlh, RT_NEIGH_A_NDT_ATTRS_GC_INTERVAL, req.gc_interval.value());
+	if (req.name.size() > 0)
+		ynl_attr_put_str(nlh, RT_NEIGH_A_NDT_ATTRS_NAME, req.name.data());
+	if (req.parms.has_value())
+		rt_neigh_ndtpa_attrs_put(nlh, RT_NEIGH_A_NDT_ATTRS_PARMS, req.parms.value());
+}
+
+static ynl_cpp::result<void>
+rt_neigh_setneightbl_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_neigh_ndt_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct ndtmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_neigh_setneightbl_ex(ynl_cpp::ynl_socket&  ys,
+			rt_neigh_setneightbl_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_SETNEIGHTBL, req._nlmsg_flags);
+	rt_neigh_setneightbl_put(nlh, req);
+
+	return rt_neigh_setneightbl_exec(ys, nlh);
+}
+
+int rt_neigh_setneightbl(ynl_cpp::ynl_socket&  ys,
+			 rt_neigh_setneightbl_req& req)
+{
+	auto ret = rt_neigh_setneightbl_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_setneightbl_prepare(ynl_cpp::ynl_socket&  ys,
+			     rt_neigh_setneightbl_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_SETNEIGHTBL, req._nlmsg_flags);
+	rt_neigh_setneightbl_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct ndtmsg));
+}
+
+ynl_cpp::result<void>
+rt_neigh_setneightbl_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl)
+{
+	return rt_neigh_setneightbl_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_neigh_setneightbl(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_neigh_setneightbl_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_neigh_setneightbl_batch(ynl_cpp::msg_batch& batch,
+			   rt_neigh_setneightbl_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_SETNEIGHTBL, req._nlmsg_flags);
+	rt_neigh_setneightbl_put(nlh, req);
+	return batch.msg_end(nlh, &rt_neigh_ndt_attrs_nest, sizeof(struct ndtmsg));
+}
+
+static constexpr std::array<ynl_ntf_info, RTM_DELNEIGH + 1> rt_neigh_ntf_info = []() {
+	std::array<ynl_ntf_info, RTM_DELNEIGH + 1> arr{};
+	arr[RTM_DELNEIGH] =  {
+		.cb		= rt_neigh_getneigh_rsp_parse,
+		.policy		= &rt_neigh_neighbour_attrs_nest,
+		.alloc_sz	= sizeof(rt_neigh_getneigh_ntf),
+		.free		= rt_neigh_getneigh_ntf_free,
+		.init		= rt_neigh_getneigh_ntf_init,
+	};
+	arr[RTM_NEWNEIGH] =  {
+		.cb		= rt_neigh_getneigh_rsp_parse,
+		.policy		= &rt_neigh_neighbour_attrs_nest,
+		.alloc_sz	= sizeof(rt_neigh_getneigh_ntf),
+		.free		= rt_neigh_getneigh_ntf_free,
+		.init		= rt_neigh_getneigh_ntf_init,
+	};
+	return arr;
+} ();
+
+static const struct ynl_mcast_grp rt_neigh_mcast_groups[] = {
+	{ "rtnlgrp-neigh", 3 },
+};
+
+const struct ynl_family ynl_rt_neigh_family =  {
+	.name		= "rt_neigh",
+	.hdr_len	= 0,
+	.ntf_info	= rt_neigh_ntf_info.data(),
+	.ntf_info_size	= rt_neigh_ntf_info.size(),
+	.is_classic	= true,
+	.classic_id	= 0,
+	.mcast_groups	= rt_neigh_mcast_groups,
+	.n_mcast_groups	= std::size(rt_neigh_mcast_groups),
+};
+const struct ynl_family& get_ynl_rt_neigh_family() {
+	return ynl_rt_neigh_family;
+};
+} //namespace ynl_cpp
@@ -0,0 +1,437 @@
+/* SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause) */
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user header */
+
+#ifndef _LINUX_RT_NEIGH_GEN_H
+#define _LINUX_RT_NEIGH_GEN_H
+
+#include <linux/types.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ynl.hpp"
+
+#include <linux/netlink.h>
+
+namespace ynl_cpp {
+/* Definitions */
+enum rt_neigh_nud_state {
+	RT_NEIGH_NUD_STATE_INCOMPLETE = 1,
+	RT_NEIGH_NUD_STATE_REACHABLE = 2,
+	RT_NEIGH_NUD_STATE_STALE = 4,
+	RT_NEIGH_NUD_STATE_DELAY = 8,
+	RT_NEIGH_NUD_STATE_PROBE = 16,
+	RT_NEIGH_NUD_STATE_FAILED = 32,
+	RT_NEIGH_NUD_STATE_NOARP = 64,
+	RT_NEIGH_NUD_STATE_PERMANENT = 128,
+};
+
+enum rt_neigh_ntf_flags {
+	RT_NEIGH_NTF_FLAGS_USE = 1,
+	RT_NEIGH_NTF_FLAGS_SELF = 2,
+	RT_NEIGH_NTF_FLAGS_MASTER = 4,
+	RT_NEIGH_NTF_FLAGS_PROXY = 8,
+	RT_NEIGH_NTF_FLAGS_EXT_LEARNED = 16,
+	RT_NEIGH_NTF_FLAGS_OFFLOADED = 32,
+	RT_NEIGH_NTF_FLAGS_STICKY = 64,
+	RT_NEIGH_NTF_FLAGS_ROUTER = 128,
+};
+
+enum rt_neigh_ntf_ext_flags {
+	RT_NEIGH_NTF_EXT_FLAGS_MANAGED = 1,
+	RT_NEIGH_NTF_EXT_FLAGS_LOCKED = 2,
+};
+
+enum rt_neigh_rtm_type {
+	RT_NEIGH_RTM_TYPE_UNSPEC = 0,
+	RT_NEIGH_RTM_TYPE_UNICAST = 1,
+	RT_NEIGH_RTM_TYPE_LOCAL = 2,
+	RT_NEIGH_RTM_TYPE_BROADCAST = 3,
+	RT_NEIGH_RTM_TYPE_ANYCAST = 4,
+	RT_NEIGH_RTM_TYPE_MULTICAST = 5,
+	RT_NEIGH_RTM_TYPE_BLACKHOLE = 6,
+	RT_NEIGH_RTM_TYPE_UNREACHABLE = 7,
+	RT_NEIGH_RTM_TYPE_PROHIBIT = 8,
+	RT_NEIGH_RTM_TYPE_THROW = 9,
+	RT_NEIGH_RTM_TYPE_NAT = 10,
+	RT_NEIGH_RTM_TYPE_XRESOLVE = 11,
+};
+
+struct ndmsg {
+	__u8 family;
+	__u8 pad[3];
+	__s32 ifindex;
+	__u16 state;
+	__u8 flags;
+	__u8 type;
+};
+
+struct ndtmsg {
+	__u8 family;
+	__u8 pad[3];
+};
+
+struct nda_cacheinfo {
+	__u32 confirmed;
+	__u32 used;
+	__u32 updated;
+	__u32 refcnt;
+};
+
+struct ndt_config {
+	__u16 key_len;
+	__u16 entry_size;
+	__u32 entries;
+	__u32 last_flush;
+	__u32 last_rand;
+	__u32 hash_rnd;
+	__u32 hash_mask;
+	__u32 hash_chain_gc;
+	__u32 proxy_qlen;
+};
+
+struct ndt_stats {
+	__u64 allocs;
+	__u64 destroys;
+	__u64 hash_grows;
+	__u64 res_failed;
+	__u64 lookups;
+	__u64 hits;
+	__u64 rcv_probes_mcast;
+	__u64 rcv_probes_ucast;
+	__u64 periodic_gc_runs;
+	__u64 forced_gc_runs;
+	__u64 table_fulls;
+};
+
+/* Attributes */
+enum {
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_UNSPEC = 0,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_DST = 1,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_LLADDR = 2,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_CACHEINFO = 3,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_PROBES = 4,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_VLAN = 5,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_PORT = 6,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_VNI = 7,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_IFINDEX = 8,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_MASTER = 9,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_LINK_NETNSID = 10,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_SRC_VNI = 11,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_PROTOCOL = 12,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_NH_ID = 13,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_FDB_EXT_ATTRS = 14,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_FLAGS_EXT = 15,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_NDM_STATE_MASK = 16,
+	RT_NEIGH_A_NEIGHBOUR_ATTRS_NDM_FLAGS_MASK = 17,
+};
+
+enum {
+	RT_NEIGH_A_NDT_ATTRS_NAME = 1,
+	RT_NEIGH_A_NDT_ATTRS_THRESH1 = 2,
+	RT_NEIGH_A_NDT_ATTRS_THRESH2 = 3,
+	RT_NEIGH_A_NDT_ATTRS_THRESH3 = 4,
+	RT_NEIGH_A_NDT_ATTRS_CONFIG = 5,
+	RT_NEIGH_A_NDT_ATTRS_PARMS = 6,
+	RT_NEIGH_A_NDT_ATTRS_STATS = 7,
+	RT_NEIGH_A_NDT_ATTRS_GC_INTERVAL = 8,
+	RT_NEIGH_A_NDT_ATTRS_PAD = 9,
+};
+
+enum {
+	RT_NEIGH_A_NDTPA_ATTRS_IFINDEX = 1,
+	RT_NEIGH_A_NDTPA_ATTRS_REFCNT = 2,
+	RT_NEIGH_A_NDTPA_ATTRS_REACHABLE_TIME = 3,
+	RT_NEIGH_A_NDTPA_ATTRS_BASE_REACHABLE_TIME = 4,
+	RT_NEIGH_A_NDTPA_ATTRS_RETRANS_TIME = 5,
+	RT_NEIGH_A_NDTPA_ATTRS_GC_STALETIME = 6,
+	RT_NEIGH_A_NDTPA_ATTRS_DELAY_PROBE_TIME = 7,
+	RT_NEIGH_A_NDTPA_ATTRS_QUEUE_LEN = 8,
+	RT_NEIGH_A_NDTPA_ATTRS_APP_PROBES = 9,
+	RT_NEIGH_A_NDTPA_ATTRS_UCAST_PROBES = 10,
+	RT_NEIGH_A_NDTPA_ATTRS_MCAST_PROBES = 11,
+	RT_NEIGH_A_NDTPA_ATTRS_ANYCAST_DELAY = 12,
+	RT_NEIGH_A_NDTPA_ATTRS_PROXY_DELAY = 13,
+	RT_NEIGH_A_NDTPA_ATTRS_PROXY_QLEN = 14,
+	RT_NEIGH_A_NDTPA_ATTRS_LOCKTIME = 15,
+	RT_NEIGH_A_NDTPA_ATTRS_QUEUE_LENBYTES = 16,
+	RT_NEIGH_A_NDTPA_ATTRS_MCAST_REPROBES = 17,
+	RT_NEIGH_A_NDTPA_ATTRS_PAD = 18,
+	RT_NEIGH_A_NDTPA_ATTRS_INTERVAL_PROBE_TIME_MS = 19,
+};
+
+const struct ynl_family& get_ynl_rt_neigh_family();
+
+/* Enums */
+std::string_view rt_neigh_op_str(int op);
+std::string_view rt_neigh_nud_state_str(rt_neigh_nud_state value);
+std::string_view rt_neigh_ntf_flags_str(rt_neigh_ntf_flags value);
+std::string_view rt_neigh_ntf_ext_flags_str(rt_neigh_ntf_ext_flags value);
+std::string_view rt_neigh_rtm_type_str(rt_neigh_rtm_type value);
+
+/* Common nested types */
+struct rt_neigh_ndtpa_attrs {
+	std::optional<__u32> ifindex;
+	std::optional<__u32> refcnt;
+	std::optional<__u64> reachable_time;
+	std::optional<__u64> base_reachable_time;
+	std::optional<__u64> retrans_time;
+	std::optional<__u64> gc_staletime;
+	std::optional<__u64> delay_probe_time;
+	std::optional<__u32> queue_len;
+	std::optional<__u32> app_probes;
+	std::optional<__u32> ucast_probes;
+	std::optional<__u32> mcast_probes;
+	std::optional<__u64> anycast_delay;
+	std::optional<__u64> proxy_delay;
+	std::optional<__u32> proxy_qlen;
+	std::optional<__u64> locktime;
+	std::optional<__u32> queue_lenbytes;
+	std::optional<__u32> mcast_reprobes;
+	std::optional<__u64> interval_probe_time_ms;
+};
+
+/* Policies and nested encoders */
+extern struct ynl_policy_nest rt_neigh_ndtpa_attrs_nest;
+extern struct ynl_policy_nest rt_neigh_neighbour_attrs_nest;
+extern struct ynl_policy_nest rt_neigh_ndt_attrs_nest;
+int rt_neigh_ndtpa_attrs_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			     const rt_neigh_ndtpa_attrs&  obj);
+
+/* ============== NEWNEIGH ============== */
+/* NEWNEIGH - do */
+struct rt_neigh_newneigh_req {
+	__u16 _nlmsg_flags{};
+
+	struct ndmsg _hdr{};
+
+	std::vector<__u8> dst;
+	std::vector<__u8> lladdr;
+	std::optional<__u32> probes;
+	std::optional<__u16> vlan;
+	std::optional<__u16> port;
+	std::optional<__u32> vni;
+	std::optional<__u32> ifindex;
+	std::optional<__u32> master;
+	std::optional<__u8> protocol;
+	std::optional<__u32> nh_id;
+	std::optional<__u32> flags_ext;
+	std::vector<__u8> fdb_ext_attrs;
+};
+
+/*
+ * Add new neighbour entry
+ */
+int rt_neigh_newneigh(ynl_cpp::ynl_socket&  ys, rt_neigh_newneigh_req& req);
+ynl_cpp::result<void>
+rt_neigh_newneigh_ex(ynl_cpp::ynl_socket&  ys, rt_neigh_newneigh_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_newneigh_prepare(ynl_cpp::ynl_socket&  ys, rt_neigh_newneigh_req& req);
+int rt_neigh_newneigh(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_neigh_newneigh_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_neigh_newneigh_batch(ynl_cpp::msg_batch& batch, rt_neigh_newneigh_req& req);
+
+/* ============== DELNEIGH ============== */
+/* DELNEIGH - do */
+struct rt_neigh_delneigh_req {
+	__u16 _nlmsg_flags{};
+
+	struct ndmsg _hdr{};
+
+	std::vector<__u8> dst;
+	std::optional<__u32> ifindex;
+};
+
+/*
+ * Remove an existing neighbour entry
+ */
+int rt_neigh_delneigh(ynl_cpp::ynl_socket&  ys, rt_neigh_delneigh_req& req);
+ynl_cpp::result<void>
+rt_neigh_delneigh_ex(ynl_cpp::ynl_socket&  ys, rt_neigh_delneigh_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_delneigh_prepare(ynl_cpp::ynl_socket&  ys, rt_neigh_delneigh_req& req);
+int rt_neigh_delneigh(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_neigh_delneigh_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_neigh_delneigh_batch(ynl_cpp::msg_batch& batch, rt_neigh_delneigh_req& req);
+
+/* ============== GETNEIGH ============== */
+/* GETNEIGH - do */
+struct rt_neigh_getneigh_req {
+	__u16 _nlmsg_flags{};
+
+	struct ndmsg _hdr{};
+
+	std::vector<__u8> dst;
+};
+
+struct rt_neigh_getneigh_rsp {
+	struct ndmsg _hdr{};
+
+	std::vector<__u8> dst;
+	std::vector<__u8> lladdr;
+	std::optional<__u32> probes;
+	std::optional<__u16> vlan;
+	std::optional<__u16> port;
+	std::optional<__u32> vni;
+	std::optional<__u32> ifindex;
+	std::optional<__u32> master;
+	std::optional<__u8> protocol;
+	std::optional<__u32> nh_id;
+	std::optional<__u32> flags_ext;
+	std::vector<__u8> fdb_ext_attrs;
+};
+
+/*
+ * Get or dump neighbour entries
+ */
+std::unique_ptr<rt_neigh_getneigh_rsp>
+rt_neigh_getneigh(ynl_cpp::ynl_socket&  ys, rt_neigh_getneigh_req& req);
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneigh_rsp>>
+rt_neigh_getneigh_ex(ynl_cpp::ynl_socket&  ys, rt_neigh_getneigh_req& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_getneigh_prepare(ynl_cpp::ynl_socket&  ys, rt_neigh_getneigh_req& req);
+std::unique_ptr<rt_neigh_getneigh_rsp>
+rt_neigh_getneigh(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneigh_rsp>>
+rt_neigh_getneigh_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
+
+/* GETNEIGH - dump */
+struct rt_neigh_getneigh_req_dump {
+	struct ndmsg _hdr{};
+
+	std::optional<__u32> ifindex;
+	std::optional<__u32> master;
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t rt_neigh_getneigh_req_dump_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ndmsg)) + 16;
+
+struct rt_neigh_getneigh_list {
+	std::list<rt_neigh_getneigh_rsp> objs;
+};
+
+std::unique_ptr<rt_neigh_getneigh_list>
+rt_neigh_getneigh_dump(ynl_cpp::ynl_socket&  ys,
+		       rt_neigh_getneigh_req_dump& req);
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneigh_list>>
+rt_neigh_getneigh_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  rt_neigh_getneigh_req_dump& req,
+			  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_getneigh_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       rt_neigh_getneigh_req_dump& req);
+std::unique_ptr<rt_neigh_getneigh_list>
+rt_neigh_getneigh_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneigh_list>>
+rt_neigh_getneigh_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj = nullptr);
+
+/* GETNEIGH - notify */
+struct rt_neigh_getneigh_ntf {
+	__u16 family;
+	__u8 cmd;
+	int nsid;
+	struct ynl_ntf_base_type *next;
+	void (*free)(struct ynl_ntf_base_type *ntf);
+	rt_neigh_getneigh_rsp obj __attribute__((aligned(8)));
+};
+
+/* ============== GETNEIGHTBL ============== */
+/* GETNEIGHTBL - dump */
+struct rt_neigh_getneightbl_req_dump {
+	struct ndtmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t rt_neigh_getneightbl_req_dump_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct ndtmsg)) + 0;
+
+struct rt_neigh_getneightbl_rsp_dump {
+	struct ndtmsg _hdr{};
+
+	std::string name;
+	std::optional<__u32> thresh1;
+	std::optional<__u32> thresh2;
+	std::optional<__u32> thresh3;
+	std::vector<__u8> config;
+	std::optional<rt_neigh_ndtpa_attrs> parms;
+	std::vector<__u8> stats;
+	std::optional<__u64> gc_interval;
+};
+
+struct rt_neigh_getneightbl_rsp_list {
+	std::list<rt_neigh_getneightbl_rsp_dump> objs;
+};
+
+std::unique_ptr<rt_neigh_getneightbl_rsp_list>
+rt_neigh_getneightbl_dump(ynl_cpp::ynl_socket&  ys,
+			  rt_neigh_getneightbl_req_dump& req);
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneightbl_rsp_list>>
+rt_neigh_getneightbl_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     rt_neigh_getneightbl_req_dump& req,
+			     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_getneightbl_dump_prepare(ynl_cpp::ynl_socket&  ys,
+				  rt_neigh_getneightbl_req_dump& req);
+std::unique_ptr<rt_neigh_getneightbl_rsp_list>
+rt_neigh_getneightbl_dump(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<rt_neigh_getneightbl_rsp_list>>
+rt_neigh_getneightbl_dump_ex(ynl_cpp::ynl_socket&  ys,
+			     ynl_cpp::request_template& tmpl,
+			     const ynl_cpp::projection *proj = nullptr);
+
+/* ============== SETNEIGHTBL ============== */
+/* SETNEIGHTBL - do */
+struct rt_neigh_setneightbl_req {
+	__u16 _nlmsg_flags{};
+
+	struct ndtmsg _hdr{};
+
+	std::string name;
+	std::optional<__u32> thresh1;
+	std::optional<__u32> thresh2;
+	std::optional<__u32> thresh3;
+	std::optional<rt_neigh_ndtpa_attrs> parms;
+	std::optional<__u64> gc_interval;
+};
+
+/*
+ * Set neighbour tables
+ */
+int rt_neigh_setneightbl(ynl_cpp::ynl_socket&  ys,
+			 rt_neigh_setneightbl_req& req);
+ynl_cpp::result<void>
+rt_neigh_setneightbl_ex(ynl_cpp::ynl_socket&  ys,
+			rt_neigh_setneightbl_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_neigh_setneightbl_prepare(ynl_cpp::ynl_socket&  ys,
+			     rt_neigh_setneightbl_req& req);
+int rt_neigh_setneightbl(ynl_cpp::ynl_socket&  ys,
+			 ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_neigh_setneightbl_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_neigh_setneightbl_batch(ynl_cpp::msg_batch& batch,
+			   rt_neigh_setneightbl_req& req);
+
+} //namespace ynl_cpp
+#endif /* _LINUX_RT_NEIGH_GEN_H */
@@ -0,0 +1,881 @@
+// SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause)
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user source */
+
+#include "rt_route-user.hpp"
+
+#include <array>
+
+#include <linux/genetlink.h>
+#include <linux/rtnetlink.h>
+
+namespace ynl_cpp {
+
+/* Enums */
+static constexpr std::array<std::string_view, RTM_NEWROUTE + 1> rt_route_op_strmap = []() {
+	std::array<std::string_view, RTM_NEWROUTE + 1> arr{};
+	arr[RTM_NEWROUTE] = "getroute";
+	return arr;
+} ();
+
+std::string_view rt_route_op_str(int op)
+{
+	if (op < 0 || op >= (int)(rt_route_op_strmap.size()))
+		return "";
+	return rt_route_op_strmap[op];
+}
+
+static constexpr std::array<std::string_view, 11 + 1> rt_route_rtm_type_strmap = []() {
+	std::array<std::string_view, 11 + 1> arr{};
+	arr[0] = "unspec";
+	arr[1] = "unicast";
+	arr[2] = "local";
+	arr[3] = "broadcast";
+	arr[4] = "anycast";
+	arr[5] = "multicast";
+	arr[6] = "blackhole";
+	arr[7] = "unreachable";
+	arr[8] = "prohibit";
+	arr[9] = "throw";
+	arr[10] = "nat";
+	arr[11] = "xresolve";
+	return arr;
+} ();
+
+std::string_view rt_route_rtm_type_str(rt_route_rtm_type value)
+{
+	if (value < 0 || value >= (int)(rt_route_rtm_type_strmap.size()))
+		return "";
+	return rt_route_rtm_type_strmap[value];
+}
+
+/* Policies */
+static std::array<ynl_policy_attr,17 + 1> rt_route_rta_metrics_policy = []() {
+	std::array<ynl_policy_attr,17 + 1> arr{};
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_UNSPEC] = { .name = "rtax-unspec", .type = YNL_PT_REJECT, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_LOCK] = { .name = "rtax-lock", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_MTU] = { .name = "rtax-mtu", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_WINDOW] = { .name = "rtax-window", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_RTT] = { .name = "rtax-rtt", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_RTTVAR] = { .name = "rtax-rttvar", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_SSTHRESH] = { .name = "rtax-ssthresh", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_CWND] = { .name = "rtax-cwnd", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_ADVMSS] = { .name = "rtax-advmss", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_REORDERING] = { .name = "rtax-reordering", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_HOPLIMIT] = { .name = "rtax-hoplimit", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_INITCWND] = { .name = "rtax-initcwnd", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_FEATURES] = { .name = "rtax-features", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_RTO_MIN] = { .name = "rtax-rto-min", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_INITRWND] = { .name = "rtax-initrwnd", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_QUICKACK] = { .name = "rtax-quickack", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_CC_ALGO] = { .name = "rtax-cc-algo", .type = YNL_PT_NUL_STR, };
+	arr[RT_ROUTE_A_RTA_METRICS_RTAX_FASTOPEN_NO_COOKIE] = { .name = "rtax-fastopen-no-cookie", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_route_rta_metrics_nest = {
+	.max_attr = 17,
+	.table = rt_route_rta_metrics_policy.data(),
+};
+
+static std::array<ynl_policy_attr,31 + 1> rt_route_route_attrs_policy = []() {
+	std::array<ynl_policy_attr,31 + 1> arr{};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_DST] = { .name = "rta-dst", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_SRC] = { .name = "rta-src", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_IIF] = { .name = "rta-iif", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_OIF] = { .name = "rta-oif", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_GATEWAY] = { .name = "rta-gateway", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_PRIORITY] = { .name = "rta-priority", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_PREFSRC] = { .name = "rta-prefsrc", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_METRICS] = { .name = "rta-metrics", .type = YNL_PT_NEST, .nest = &rt_route_rta_metrics_nest, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_MULTIPATH] = { .name = "rta-multipath", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_PROTOINFO] = { .name = "rta-protoinfo", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_FLOW] = { .name = "rta-flow", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_CACHEINFO] = { .name = "rta-cacheinfo", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_SESSION] = { .name = "rta-session", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_MP_ALGO] = { .name = "rta-mp-algo", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_TABLE] = { .name = "rta-table", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_MARK] = { .name = "rta-mark", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_MFC_STATS] = { .name = "rta-mfc-stats", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_VIA] = { .name = "rta-via", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_NEWDST] = { .name = "rta-newdst", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_PREF] = { .name = "rta-pref", .type = YNL_PT_U8, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_ENCAP_TYPE] = { .name = "rta-encap-type", .type = YNL_PT_U16, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_ENCAP] = { .name = "rta-encap", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_EXPIRES] = { .name = "rta-expires", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_PAD] = { .name = "rta-pad", .type = YNL_PT_BINARY,};
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_UID] = { .name = "rta-uid", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_TTL_PROPAGATE] = { .name = "rta-ttl-propagate", .type = YNL_PT_U8, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_IP_PROTO] = { .name = "rta-ip-proto", .type = YNL_PT_U8, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_SPORT] = { .name = "rta-sport", .type = YNL_PT_U16, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_DPORT] = { .name = "rta-dport", .type = YNL_PT_U16, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_NH_ID] = { .name = "rta-nh-id", .type = YNL_PT_U32, };
+	arr[RT_ROUTE_A_ROUTE_ATTRS_RTA_FLOWLABEL] = { .name = "rta-flowlabel", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_route_route_attrs_nest = {
+	.max_attr = 31,
+	.table = rt_route_route_attrs_policy.data(),
+};
+
+/* Common nested types */
+int rt_route_rta_metrics_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			     const rt_route_rta_metrics&  obj)
+{
+	struct nlattr *nest;
+
+	nest = ynl_attr_nest_start(nlh, attr_type);
+	if (obj.rtax_lock.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_LOCK, obj.rtax_lock.value());
+	if (obj.rtax_mtu.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_MTU, obj.rtax_mtu.value());
+	if (obj.rtax_window.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_WINDOW, obj.rtax_window.value());
+	if (obj.rtax_rtt.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_RTT, obj.rtax_rtt.value());
+	if (obj.rtax_rttvar.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_RTTVAR, obj.rtax_rttvar.value());
+	if (obj.rtax_ssthresh.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_SSTHRESH, obj.rtax_ssthresh.value());
+	if (obj.rtax_cwnd.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_CWND, obj.rtax_cwnd.value());
+	if (obj.rtax_advmss.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_ADVMSS, obj.rtax_advmss.value());
+	if (obj.rtax_reordering.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_REORDERING, obj.rtax_reordering.value());
+	if (obj.rtax_hoplimit.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_HOPLIMIT, obj.rtax_hoplimit.value());
+	if (obj.rtax_initcwnd.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_INITCWND, obj.rtax_initcwnd.value());
+	if (obj.rtax_features.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_FEATURES, obj.rtax_features.value());
+	if (obj.rtax_rto_min.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_RTO_MIN, obj.rtax_rto_min.value());
+	if (obj.rtax_initrwnd.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_INITRWND, obj.rtax_initrwnd.value());
+	if (obj.rtax_quickack.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_QUICKACK, obj.rtax_quickack.value());
+	if (obj.rtax_cc_algo.size() > 0)
+		ynl_attr_put_str(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_CC_ALGO, obj.rtax_cc_algo.data());
+	if (obj.rtax_fastopen_no_cookie.has_value())
+		ynl_attr_put_u32(nlh, RT_ROUTE_A_RTA_METRICS_RTAX_FASTOPEN_NO_COOKIE, obj.rtax_fastopen_no_cookie.value());
+	ynl_attr_nest_end(nlh, nest);
+
+	return 0;
+}
+
+int rt_route_rta_metrics_parse(struct ynl_parse_arg *yarg,
+			       const struct nlattr *nested)
+{
+	rt_route_rta_metrics *dst = (rt_route_rta_metrics *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == RT_ROUTE_A_RTA_METRICS_RTAX_LOCK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_lock = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_MTU) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_mtu = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_WINDOW) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_window = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_RTT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_rtt = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_RTTVAR) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_rttvar = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_SSTHRESH) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_ssthresh = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_CWND) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_cwnd = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_ADVMSS) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_advmss = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_REORDERING) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_reordering = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_HOPLIMIT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_hoplimit = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_INITCWND) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_initcwnd = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_FEATURES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_features = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_RTO_MIN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_rto_min = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_INITRWND) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_initrwnd = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_QUICKACK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_quickack = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_CC_ALGO) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->rtax_cc_algo.assign(ynl_attr_get_str(attr));
+		} else if (type == RT_ROUTE_A_RTA_METRICS_RTAX_FASTOPEN_NO_COOKIE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rtax_fastopen_no_cookie = (__u32)ynl_attr_get_u32(attr);
+		}
+	}
+
+	return 0;
+}
+
+/* ============== GETROUTE ============== */
+/* GETROUTE - do */
+int rt_route_getroute_rsp_parse(const struct nlmsghdr *nlh,
+				struct ynl_parse_arg *yarg)
+{
+	rt_route_getroute_rsp *dst;
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	void *hdr;
+
+	dst = (rt_route_getroute_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct rtmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct rtmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_DST) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rta_dst.assign(data, data + len);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_SRC) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rta_src.assign(data, data + len);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_IIF) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rta_iif = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_OIF) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rta_oif = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_GATEWAY) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rta_gateway.assign(data, data + len);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_PRIORITY) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rta_priority = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_PREFSRC) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rta_prefsrc.assign(data, data + len);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_METRICS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &rt_route_rta_metrics_nest;
+			parg.data = &dst->rta_metrics.emplace();
+			if (rt_route_rta_metrics_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_MULTIPATH) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rta_multipath.assign(data, data + len);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_FLOW) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rta_flow = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_CACHEINFO) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rta_cacheinfo.assign(data, data + len);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_TABLE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rta_table = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_MARK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rta_mark = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_MFC_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rta_mfc_stats.assign(data, data + len);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_VIA) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rta_via.assign(data, data + len);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_NEWDST) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rta_newdst.assign(data, data + len);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_PREF) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->rta_pref = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_ENCAP_TYPE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->rta_encap_type = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_ENCAP) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rta_encap.assign(data, data + len);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_EXPIRES) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rta_expires = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_PAD) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rta_pad.assign(data, data + len);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_UID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rta_uid = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_TTL_PROPAGATE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->rta_ttl_propagate = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_IP_PROTO) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->rta_ip_proto = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_SPORT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->rta_sport = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_DPORT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
+			dst->rta_dport = (__u16)ynl_attr_get_u16(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_NH_ID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rta_nh_id = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_ROUTE_A_ROUTE_ATTRS_RTA_FLOWLABEL) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->rta_flowlabel = (__u32)ynl_attr_get_u32(attr);
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+rt_route_getroute_put(struct nlmsghdr *nlh, rt_route_getroute_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct rtmsg)) + 64 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.rta_iif.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_IIF, req.rta_iif.value());
+	if (req.rta_oif.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_OIF, req.rta_oif.value());
+	if (req.rta_ip_proto.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_IP_PROTO, req.rta_ip_proto.value());
+	if (req.rta_sport.has_value())
+		ynl_attr_put_u16_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_SPORT, req.rta_sport.value());
+	if (req.rta_dport.has_value())
+		ynl_attr_put_u16_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_DPORT, req.rta_dport.value());
+	if (req.rta_mark.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_MARK, req.rta_mark.value());
+	if (req.rta_uid.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_UID, req.rta_uid.value());
+	if (req.rta_flowlabel.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_FLOWLABEL, req.rta_flowlabel.value());
+	if (req.rta_src.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_SRC, req.rta_src.data(), req.rta_src.size());
+	if (req.rta_dst.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_DST, req.rta_dst.data(), req.rta_dst.size());
+}
+
+static ynl_cpp::result<std::unique_ptr<rt_route_getroute_rsp>>
+rt_route_getroute_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<rt_route_getroute_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_route_route_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct rtmsg);
+	yrs.yarg.rsp_policy = &rt_route_route_attrs_nest;
+
+	rsp.reset(new rt_route_getroute_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = rt_route_getroute_rsp_parse;
+	yrs.rsp_cmd = RTM_NEWROUTE;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<rt_route_getroute_rsp>>
+rt_route_getroute_ex(ynl_cpp::ynl_socket&  ys, rt_route_getroute_req& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETROUTE, req._nlmsg_flags);
+	rt_route_getroute_put(nlh, req);
+
+	return rt_route_getroute_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<rt_route_getroute_rsp>
+rt_route_getroute(ynl_cpp::ynl_socket&  ys, rt_route_getroute_req& req)
+{
+	auto ret = rt_route_getroute_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_route_getroute_prepare(ynl_cpp::ynl_socket&  ys, rt_route_getroute_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETROUTE, req._nlmsg_flags);
+	rt_route_getroute_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct rtmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<rt_route_getroute_rsp>>
+rt_route_getroute_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return rt_route_getroute_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<rt_route_getroute_rsp>
+rt_route_getroute(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_route_getroute_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* GETROUTE - dump */
+static void
+rt_route_getroute_dump_put(struct nlmsghdr *nlh,
+			   rt_route_getroute_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<rt_route_getroute_list>>
+rt_route_getroute_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			    const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<rt_route_getroute_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &rt_route_route_attrs_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<rt_route_getroute_list*>(arg)->objs.emplace_back());};
+	yds.cb = rt_route_getroute_rsp_parse;
+	yds.rsp_cmd = RTM_NEWROUTE;
+	((struct ynl_sock*)ys)->req_policy = &rt_route_route_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct rtmsg);
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<rt_route_getroute_list>>
+rt_route_getroute_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  rt_route_getroute_req_dump& req,
+			  const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETROUTE);
+	rt_route_getroute_dump_put(nlh, req);
+
+	return rt_route_getroute_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<rt_route_getroute_list>
+rt_route_getroute_dump(ynl_cpp::ynl_socket&  ys,
+		       rt_route_getroute_req_dump& req)
+{
+	auto ret = rt_route_getroute_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_route_getroute_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       rt_route_getroute_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETROUTE);
+	rt_route_getroute_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct rtmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<rt_route_getroute_list>>
+rt_route_getroute_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj)
+{
+	return rt_route_getroute_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<rt_route_getroute_list>
+rt_route_getroute_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_route_getroute_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== NEWROUTE ============== */
+/* NEWROUTE - do */
+static void
+rt_route_newroute_put(struct nlmsghdr *nlh, rt_route_newroute_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct rtmsg)) + 128 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.rta_iif.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_IIF, req.rta_iif.value());
+	if (req.rta_oif.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_OIF, req.rta_oif.value());
+	if (req.rta_priority.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_PRIORITY, req.rta_priority.value());
+	if (req.rta_flow.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_FLOW, req.rta_flow.value());
+	if (req.rta_table.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_TABLE, req.rta_table.value());
+	if (req.rta_mark.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_MARK, req.rta_mark.value());
+	if (req.rta_pref.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_PREF, req.rta_pref.value());
+	if (req.rta_encap_type.has_value())
+		ynl_attr_put_u16_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_ENCAP_TYPE, req.rta_encap_type.value());
+	if (req.rta_expires.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_EXPIRES, req.rta_expires.value());
+	if (req.rta_uid.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_UID, req.rta_uid.value());
+	if (req.rta_ttl_propagate.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_TTL_PROPAGATE, req.rta_ttl_propagate.value());
+	if (req.rta_ip_proto.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_IP_PROTO, req.rta_ip_proto.value());
+	if (req.rta_sport.has_value())
+		ynl_attr_put_u16_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_SPORT, req.rta_sport.value());
+	if (req.rta_dport.has_value())
+		ynl_attr_put_u16_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_DPORT, req.rta_dport.value());
+	if (req.rta_nh_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_NH_ID, req.rta_nh_id.value());
+	if (req.rta_flowlabel.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_FLOWLABEL, req.rta_flowlabel.value());
+	if (req.rta_dst.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_DST, req.rta_dst.data(), req.rta_dst.size());
+	if (req.rta_src.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_SRC, req.rta_src.data(), req.rta_src.size());
+	if (req.rta_gateway.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_GATEWAY, req.rta_gateway.data(), req.rta_gateway.size());
+	if (req.rta_prefsrc.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_PREFSRC, req.rta_prefsrc.data(), req.rta_prefsrc.size());
+	if (req.rta_metrics.has_value())
+		rt_route_rta_metrics_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_METRICS, req.rta_metrics.value());
+	if (req.rta_multipath.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_MULTIPATH, req.rta_multipath.data(), req.rta_multipath.size());
+	if (req.rta_cacheinfo.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_CACHEINFO, req.rta_cacheinfo.data(), req.rta_cacheinfo.size());
+	if (req.rta_mfc_stats.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_MFC_STATS, req.rta_mfc_stats.data(), req.rta_mfc_stats.size());
+	if (req.rta_via.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_VIA, req.rta_via.data(), req.rta_via.size());
+	if (req.rta_newdst.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_NEWDST, req.rta_newdst.data(), req.rta_newdst.size());
+	if (req.rta_encap.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_ENCAP, req.rta_encap.data(), req.rta_encap.size());
+	if (req.rta_pad.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_PAD, req.rta_pad.data(), req.rta_pad.size());
+}
+
+static ynl_cpp::result<void>
+rt_route_newroute_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_route_route_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct rtmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_route_newroute_ex(ynl_cpp::ynl_socket&  ys, rt_route_newroute_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWROUTE, req._nlmsg_flags);
+	rt_route_newroute_put(nlh, req);
+
+	return rt_route_newroute_exec(ys, nlh);
+}
+
+int rt_route_newroute(ynl_cpp::ynl_socket&  ys, rt_route_newroute_req& req)
+{
+	auto ret = rt_route_newroute_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_route_newroute_prepare(ynl_cpp::ynl_socket&  ys, rt_route_newroute_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWROUTE, req._nlmsg_flags);
+	rt_route_newroute_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct rtmsg));
+}
+
+ynl_cpp::result<void>
+rt_route_newroute_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return rt_route_newroute_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_route_newroute(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_route_newroute_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_route_newroute_batch(ynl_cpp::msg_batch& batch, rt_route_newroute_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_NEWROUTE, req._nlmsg_flags);
+	rt_route_newroute_put(nlh, req);
+	return batch.msg_end(nlh, &rt_route_route_attrs_nest, sizeof(struct rtmsg));
+}
+
+/* ============== DELROUTE ============== */
+/* DELROUTE - do */
+static void
+rt_route_delroute_put(struct nlmsghdr *nlh, rt_route_delroute_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct rtmsg)) + 128 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.rta_iif.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_IIF, req.rta_iif.value());
+	if (req.rta_oif.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_OIF, req.rta_oif.value());
+	if (req.rta_priority.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_PRIORITY, req.rta_priority.value());
+	if (req.rta_flow.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_FLOW, req.rta_flow.value());
+	if (req.rta_table.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_TABLE, req.rta_table.value());
+	if (req.rta_mark.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_MARK, req.rta_mark.value());
+	if (req.rta_pref.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_PREF, req.rta_pref.value());
+	if (req.rta_encap_type.has_value())
+		ynl_attr_put_u16_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_ENCAP_TYPE, req.rta_encap_type.value());
+	if (req.rta_expires.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_EXPIRES, req.rta_expires.value());
+	if (req.rta_uid.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_UID, req.rta_uid.value());
+	if (req.rta_ttl_propagate.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_TTL_PROPAGATE, req.rta_ttl_propagate.value());
+	if (req.rta_ip_proto.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_IP_PROTO, req.rta_ip_proto.value());
+	if (req.rta_sport.has_value())
+		ynl_attr_put_u16_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_SPORT, req.rta_sport.value());
+	if (req.rta_dport.has_value())
+		ynl_attr_put_u16_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_DPORT, req.rta_dport.value());
+	if (req.rta_nh_id.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_NH_ID, req.rta_nh_id.value());
+	if (req.rta_flowlabel.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_FLOWLABEL, req.rta_flowlabel.value());
+	if (req.rta_dst.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_DST, req.rta_dst.data(), req.rta_dst.size());
+	if (req.rta_src.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_SRC, req.rta_src.data(), req.rta_src.size());
+	if (req.rta_gateway.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_GATEWAY, req.rta_gateway.data(), req.rta_gateway.size());
+	if (req.rta_prefsrc.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_PREFSRC, req.rta_prefsrc.data(), req.rta_prefsrc.size());
+	if (req.rta_metrics.has_value())
+		rt_route_rta_metrics_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_METRICS, req.rta_metrics.value());
+	if (req.rta_multipath.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_MULTIPATH, req.rta_multipath.data(), req.rta_multipath.size());
+	if (req.rta_cacheinfo.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_CACHEINFO, req.rta_cacheinfo.data(), req.rta_cacheinfo.size());
+	if (req.rta_mfc_stats.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_MFC_STATS, req.rta_mfc_stats.data(), req.rta_mfc_stats.size());
+	if (req.rta_via.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_VIA, req.rta_via.data(), req.rta_via.size());
+	if (req.rta_newdst.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_NEWDST, req.rta_newdst.data(), req.rta_newdst.size());
+	if (req.rta_encap.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_ENCAP, req.rta_encap.data(), req.rta_encap.size());
+	if (req.rta_pad.size() > 0)
+		ynl_attr_put(nlh, RT_ROUTE_A_ROUTE_ATTRS_RTA_PAD, req.rta_pad.data(), req.rta_pad.size());
+}
+
+static ynl_cpp::result<void>
+rt_route_delroute_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_route_route_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct rtmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_route_delroute_ex(ynl_cpp::ynl_socket&  ys, rt_route_delroute_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELROUTE, req._nlmsg_flags);
+	rt_route_delroute_put(nlh, req);
+
+	return rt_route_delroute_exec(ys, nlh);
+}
+
+int rt_route_delroute(ynl_cpp::ynl_socket&  ys, rt_route_delroute_req& req)
+{
+	auto ret = rt_route_delroute_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_route_delroute_prepare(ynl_cpp::ynl_socket&  ys, rt_route_delroute_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELROUTE, req._nlmsg_flags);
+	rt_route_delroute_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct rtmsg));
+}
+
+ynl_cpp::result<void>
+rt_route_delroute_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return rt_route_delroute_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_route_delroute(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_route_delroute_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_route_delroute_batch(ynl_cpp::msg_batch& batch, rt_route_delroute_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_DELROUTE, req._nlmsg_flags);
+	rt_route_delroute_put(nlh, req);
+	return batch.msg_end(nlh, &rt_route_route_attrs_nest, sizeof(struct rtmsg));
+}
+
+const struct ynl_family ynl_rt_route_family =  {
+	.name		= "rt_route",
+	.hdr_len	= 0,
+	.is_classic	= true,
+	.classic_id	= 0,
+};
+const struct ynl_family& get_ynl_rt_route_family() {
+	return ynl_rt_route_family;
+};
+} //namespace ynl_cpp
@@ -0,0 +1,353 @@
+/* SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause) */
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user header */
+
+#ifndef _LINUX_RT_ROUTE_GEN_H
+#define _LINUX_RT_ROUTE_GEN_H
+
+#include <linux/types.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ynl.hpp"
+
+#include <linux/netlink.h>
+
+namespace ynl_cpp {
+/* Definitions */
+enum rt_route_rtm_type {
+	RTN_UNSPEC = 0,
+	RTN_UNICAST = 1,
+	RTN_LOCAL = 2,
+	RTN_BROADCAST = 3,
+	RTN_ANYCAST = 4,
+	RTN_MULTICAST = 5,
+	RTN_BLACKHOLE = 6,
+	RTN_UNREACHABLE = 7,
+	RTN_PROHIBIT = 8,
+	RTN_THROW = 9,
+	RTN_NAT = 10,
+	RTN_XRESOLVE = 11,
+};
+
+struct rtmsg {
+	__u8 rtm_family;
+	__u8 rtm_dst_len;
+	__u8 rtm_src_len;
+	__u8 rtm_tos;
+	__u8 rtm_table;
+	__u8 rtm_protocol;
+	__u8 rtm_scope;
+	__u8 rtm_type;
+	__u32 rtm_flags;
+};
+
+struct rta_cacheinfo {
+	__u32 rta_clntref;
+	__u32 rta_lastuse;
+	__u32 rta_expires;
+	__u32 rta_error;
+	__u32 rta_used;
+};
+
+/* Attributes */
+enum {
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_DST = 1,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_SRC = 2,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_IIF = 3,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_OIF = 4,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_GATEWAY = 5,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_PRIORITY = 6,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_PREFSRC = 7,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_METRICS = 8,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_MULTIPATH = 9,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_PROTOINFO = 10,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_FLOW = 11,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_CACHEINFO = 12,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_SESSION = 13,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_MP_ALGO = 14,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_TABLE = 15,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_MARK = 16,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_MFC_STATS = 17,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_VIA = 18,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_NEWDST = 19,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_PREF = 20,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_ENCAP_TYPE = 21,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_ENCAP = 22,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_EXPIRES = 23,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_PAD = 24,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_UID = 25,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_TTL_PROPAGATE = 26,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_IP_PROTO = 27,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_SPORT = 28,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_DPORT = 29,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_NH_ID = 30,
+	RT_ROUTE_A_ROUTE_ATTRS_RTA_FLOWLABEL = 31,
+};
+
+enum {
+	RT_ROUTE_A_RTA_METRICS_RTAX_UNSPEC = 0,
+	RT_ROUTE_A_RTA_METRICS_RTAX_LOCK = 1,
+	RT_ROUTE_A_RTA_METRICS_RTAX_MTU = 2,
+	RT_ROUTE_A_RTA_METRICS_RTAX_WINDOW = 3,
+	RT_ROUTE_A_RTA_METRICS_RTAX_RTT = 4,
+	RT_ROUTE_A_RTA_METRICS_RTAX_RTTVAR = 5,
+	RT_ROUTE_A_RTA_METRICS_RTAX_SSTHRESH = 6,
+	RT_ROUTE_A_RTA_METRICS_RTAX_CWND = 7,
+	RT_ROUTE_A_RTA_METRICS_RTAX_ADVMSS = 8,
+	RT_ROUTE_A_RTA_METRICS_RTAX_REORDERING = 9,
+	RT_ROUTE_A_RTA_METRICS_RTAX_HOPLIMIT = 10,
+	RT_ROUTE_A_RTA_METRICS_RTAX_INITCWND = 11,
+	RT_ROUTE_A_RTA_METRICS_RTAX_FEATURES = 12,
+	RT_ROUTE_A_RTA_METRICS_RTAX_RTO_MIN = 13,
+	RT_ROUTE_A_RTA_METRICS_RTAX_INITRWND = 14,
+	RT_ROUTE_A_RTA_METRICS_RTAX_QUICKACK = 15,
+	RT_ROUTE_A_RTA_METRICS_RTAX_CC_ALGO = 16,
+	RT_ROUTE_A_RTA_METRICS_RTAX_FASTOPEN_NO_COOKIE = 17,
+};
+
+const struct ynl_family& get_ynl_rt_route_family();
+
+/* Enums */
+std::string_view rt_route_op_str(int op);
+std::string_view rt_route_rtm_type_str(rt_route_rtm_type value);
+
+/* Common nested types */
+struct rt_route_rta_metrics {
+	std::optional<__u32> rtax_lock;
+	std::optional<__u32> rtax_mtu;
+	std::optional<__u32> rtax_window;
+	std::optional<__u32> rtax_rtt;
+	std::optional<__u32> rtax_rttvar;
+	std::optional<__u32> rtax_ssthresh;
+	std::optional<__u32> rtax_cwnd;
+	std::optional<__u32> rtax_advmss;
+	std::optional<__u32> rtax_reordering;
+	std::optional<__u32> rtax_hoplimit;
+	std::optional<__u32> rtax_initcwnd;
+	std::optional<__u32> rtax_features;
+	std::optional<__u32> rtax_rto_min;
+	std::optional<__u32> rtax_initrwnd;
+	std::optional<__u32> rtax_quickack;
+	std::string rtax_cc_algo;
+	std::optional<__u32> rtax_fastopen_no_cookie;
+};
+
+/* Policies and nested encoders */
+extern struct ynl_policy_nest rt_route_rta_metrics_nest;
+extern struct ynl_policy_nest rt_route_route_attrs_nest;
+int rt_route_rta_metrics_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			     const rt_route_rta_metrics&  obj);
+
+/* ============== GETROUTE ============== */
+/* GETROUTE - do */
+struct rt_route_getroute_req {
+	__u16 _nlmsg_flags{};
+
+	struct rtmsg _hdr{};
+
+	std::vector<__u8> rta_src;
+	std::vector<__u8> rta_dst;
+	std::optional<__u32> rta_iif;
+	std::optional<__u32> rta_oif;
+	std::optional<__u8> rta_ip_proto;
+	std::optional<__u16> rta_sport;
+	std::optional<__u16> rta_dport;
+	std::optional<__u32> rta_mark;
+	std::optional<__u32> rta_uid;
+	std::optional<__u32> rta_flowlabel /* big-endian */;
+};
+
+struct rt_route_getroute_rsp {
+	struct rtmsg _hdr{};
+
+	std::vector<__u8> rta_dst;
+	std::vector<__u8> rta_src;
+	std::optional<__u32> rta_iif;
+	std::optional<__u32> rta_oif;
+	std::vector<__u8> rta_gateway;
+	std::optional<__u32> rta_priority;
+	std::vector<__u8> rta_prefsrc;
+	std::optional<rt_route_rta_metrics> rta_metrics;
+	std::vector<__u8> rta_multipath;
+	std::optional<__u32> rta_flow;
+	std::vector<__u8> rta_cacheinfo;
+	std::optional<__u32> rta_table;
+	std::optional<__u32> rta_mark;
+	std::vector<__u8> rta_mfc_stats;
+	std::vector<__u8> rta_via;
+	std::vector<__u8> rta_newdst;
+	std::optional<__u8> rta_pref;
+	std::optional<__u16> rta_encap_type;
+	std::vector<__u8> rta_encap;
+	std::optional<__u32> rta_expires;
+	std::vector<__u8> rta_pad;
+	std::optional<__u32> rta_uid;
+	std::optional<__u8> rta_ttl_propagate;
+	std::optional<__u8> rta_ip_proto;
+	std::optional<__u16> rta_sport;
+	std::optional<__u16> rta_dport;
+	std::optional<__u32> rta_nh_id;
+	std::optional<__u32> rta_flowlabel /* big-endian */;
+};
+
+/*
+ * Dump route information.
+ */
+std::unique_ptr<rt_route_getroute_rsp>
+rt_route_getroute(ynl_cpp::ynl_socket&  ys, rt_route_getroute_req& req);
+ynl_cpp::result<std::unique_ptr<rt_route_getroute_rsp>>
+rt_route_getroute_ex(ynl_cpp::ynl_socket&  ys, rt_route_getroute_req& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_route_getroute_prepare(ynl_cpp::ynl_socket&  ys, rt_route_getroute_req& req);
+std::unique_ptr<rt_route_getroute_rsp>
+rt_route_getroute(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<rt_route_getroute_rsp>>
+rt_route_getroute_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
+
+/* GETROUTE - dump */
+struct rt_route_getroute_req_dump {
+	struct rtmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t rt_route_getroute_req_dump_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct rtmsg)) + 0;
+
+struct rt_route_getroute_list {
+	std::list<rt_route_getroute_rsp> objs;
+};
+
+std::unique_ptr<rt_route_getroute_list>
+rt_route_getroute_dump(ynl_cpp::ynl_socket&  ys,
+		       rt_route_getroute_req_dump& req);
+ynl_cpp::result<std::unique_ptr<rt_route_getroute_list>>
+rt_route_getroute_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  rt_route_getroute_req_dump& req,
+			  const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_route_getroute_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			       rt_route_getroute_req_dump& req);
+std::unique_ptr<rt_route_getroute_list>
+rt_route_getroute_dump(ynl_cpp::ynl_socket&  ys,
+		       ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<rt_route_getroute_list>>
+rt_route_getroute_dump_ex(ynl_cpp::ynl_socket&  ys,
+			  ynl_cpp::request_template& tmpl,
+			  const ynl_cpp::projection *proj = nullptr);
+
+/* ============== NEWROUTE ============== */
+/* NEWROUTE - do */
+struct rt_route_newroute_req {
+	__u16 _nlmsg_flags{};
+
+	struct rtmsg _hdr{};
+
+	std::vector<__u8> rta_dst;
+	std::vector<__u8> rta_src;
+	std::optional<__u32> rta_iif;
+	std::optional<__u32> rta_oif;
+	std::vector<__u8> rta_gateway;
+	std::optional<__u32> rta_priority;
+	std::vector<__u8> rta_prefsrc;
+	std::optional<rt_route_rta_metrics> rta_metrics;
+	std::vector<__u8> rta_multipath;
+	std::optional<__u32> rta_flow;
+	std::vector<__u8> rta_cacheinfo;
+	std::optional<__u32> rta_table;
+	std::optional<__u32> rta_mark;
+	std::vector<__u8> rta_mfc_stats;
+	std::vector<__u8> rta_via;
+	std::vector<__u8> rta_newdst;
+	std::optional<__u8> rta_pref;
+	std::optional<__u16> rta_encap_type;
+	std::vector<__u8> rta_encap;
+	std::optional<__u32> rta_expires;
+	std::vector<__u8> rta_pad;
+	std::optional<__u32> rta_uid;
+	std::optional<__u8> rta_ttl_propagate;
+	std::optional<__u8> rta_ip_proto;
+	std::optional<__u16> rta_sport;
+	std::optional<__u16> rta_dport;
+	std::optional<__u32> rta_nh_id;
+	std::optional<__u32> rta_flowlabel /* big-endian */;
+};
+
+/*
+ * Create a new route
+ */
+int rt_route_newroute(ynl_cpp::ynl_socket&  ys, rt_route_newroute_req& req);
+ynl_cpp::result<void>
+rt_route_newroute_ex(ynl_cpp::ynl_socket&  ys, rt_route_newroute_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_route_newroute_prepare(ynl_cpp::ynl_socket&  ys, rt_route_newroute_req& req);
+int rt_route_newroute(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_route_newroute_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_route_newroute_batch(ynl_cpp::msg_batch& batch, rt_route_newroute_req& req);
+
+/* ============== DELROUTE ============== */
+/* DELROUTE - do */
+struct rt_route_delroute_req {
+	__u16 _nlmsg_flags{};
+
+	struct rtmsg _hdr{};
+
+	std::vector<__u8> rta_dst;
+	std::vector<__u8> rta_src;
+	std::optional<__u32> rta_iif;
+	std::optional<__u32> rta_oif;
+	std::vector<__u8> rta_gateway;
+	std::optional<__u32> rta_priority;
+	std::vector<__u8> rta_prefsrc;
+	std::optional<rt_route_rta_metrics> rta_metrics;
+	std::vector<__u8> rta_multipath;
+	std::optional<__u32> rta_flow;
+	std::vector<__u8> rta_cacheinfo;
+	std::optional<__u32> rta_table;
+	std::optional<__u32> rta_mark;
+	std::vector<__u8> rta_mfc_stats;
+	std::vector<__u8> rta_via;
+	std::vector<__u8> rta_newdst;
+	std::optional<__u8> rta_pref;
+	std::optional<__u16> rta_encap_type;
+	std::vector<__u8> rta_encap;
+	std::optional<__u32> rta_expires;
+	std::vector<__u8> rta_pad;
+	std::optional<__u32> rta_uid;
+	std::optional<__u8> rta_ttl_propagate;
+	std::optional<__u8> rta_ip_proto;
+	std::optional<__u16> rta_sport;
+	std::optional<__u16> rta_dport;
+	std::optional<__u32> rta_nh_id;
+	std::optional<__u32> rta_flowlabel /* big-endian */;
+};
+
+/*
+ * Delete an existing route
+ */
+int rt_route_delroute(ynl_cpp::ynl_socket&  ys, rt_route_delroute_req& req);
+ynl_cpp::result<void>
+rt_route_delroute_ex(ynl_cpp::ynl_socket&  ys, rt_route_delroute_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_route_delroute_prepare(ynl_cpp::ynl_socket&  ys, rt_route_delroute_req& req);
+int rt_route_delroute(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_route_delroute_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_route_delroute_batch(ynl_cpp::msg_batch& batch, rt_route_delroute_req& req);
+
+} //namespace ynl_cpp
+#endif /* _LINUX_RT_ROUTE_GEN_H */
@@ -0,0 +1,538 @@
+// SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause)
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user source */
+
+#include "rt_rule-user.hpp"
+
+#include <array>
+
+#include <linux/genetlink.h>
+#include <linux/rtnetlink.h>
+
+namespace ynl_cpp {
+
+/* Enums */
+static constexpr std::array<std::string_view, RTM_DELRULE + 1> rt_rule_op_strmap = []() {
+	std::array<std::string_view, RTM_DELRULE + 1> arr{};
+	arr[RTM_DELRULE] = "delrule-ntf";
+	arr[RTM_NEWRULE] = "getrule";
+	return arr;
+} ();
+
+std::string_view rt_rule_op_str(int op)
+{
+	if (op < 0 || op >= (int)(rt_rule_op_strmap.size()))
+		return "";
+	return rt_rule_op_strmap[op];
+}
+
+static constexpr std::array<std::string_view, 8 + 1> rt_rule_fr_act_strmap = []() {
+	std::array<std::string_view, 8 + 1> arr{};
+	arr[0] = "unspec";
+	arr[1] = "to-tbl";
+	arr[2] = "goto";
+	arr[3] = "nop";
+	arr[4] = "res3";
+	arr[5] = "res4";
+	arr[6] = "blackhole";
+	arr[7] = "unreachable";
+	arr[8] = "prohibit";
+	return arr;
+} ();
+
+std::string_view rt_rule_fr_act_str(rt_rule_fr_act value)
+{
+	if (value < 0 || value >= (int)(rt_rule_fr_act_strmap.size()))
+		return "";
+	return rt_rule_fr_act_strmap[value];
+}
+
+/* Policies */
+static std::array<ynl_policy_attr,27 + 1> rt_rule_fib_rule_attrs_policy = []() {
+	std::array<ynl_policy_attr,27 + 1> arr{};
+	arr[RT_RULE_A_FIB_RULE_ATTRS_DST] = { .name = "dst", .type = YNL_PT_U32, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_SRC] = { .name = "src", .type = YNL_PT_U32, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_IIFNAME] = { .name = "iifname", .type = YNL_PT_NUL_STR, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_GOTO] = { .name = "goto", .type = YNL_PT_U32, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_UNUSED2] = { .name = "unused2", .type = YNL_PT_IGNORE, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_PRIORITY] = { .name = "priority", .type = YNL_PT_U32, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_UNUSED3] = { .name = "unused3", .type = YNL_PT_IGNORE, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_UNUSED4] = { .name = "unused4", .type = YNL_PT_IGNORE, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_UNUSED5] = { .name = "unused5", .type = YNL_PT_IGNORE, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_FWMARK] = { .name = "fwmark", .type = YNL_PT_U32, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_FLOW] = { .name = "flow", .type = YNL_PT_U32, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_TUN_ID] = { .name = "tun-id", .type = YNL_PT_U64, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_SUPPRESS_IFGROUP] = { .name = "suppress-ifgroup", .type = YNL_PT_U32, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_SUPPRESS_PREFIXLEN] = { .name = "suppress-prefixlen", .type = YNL_PT_U32, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_TABLE] = { .name = "table", .type = YNL_PT_U32, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_FWMASK] = { .name = "fwmask", .type = YNL_PT_U32, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_OIFNAME] = { .name = "oifname", .type = YNL_PT_NUL_STR, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_PAD] = { .name = "pad", .type = YNL_PT_IGNORE, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_L3MDEV] = { .name = "l3mdev", .type = YNL_PT_U8, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_UID_RANGE] = { .name = "uid-range", .type = YNL_PT_BINARY,};
+	arr[RT_RULE_A_FIB_RULE_ATTRS_PROTOCOL] = { .name = "protocol", .type = YNL_PT_U8, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_IP_PROTO] = { .name = "ip-proto", .type = YNL_PT_U8, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_SPORT_RANGE] = { .name = "sport-range", .type = YNL_PT_BINARY,};
+	arr[RT_RULE_A_FIB_RULE_ATTRS_DPORT_RANGE] = { .name = "dport-range", .type = YNL_PT_BINARY,};
+	arr[RT_RULE_A_FIB_RULE_ATTRS_DSCP] = { .name = "dscp", .type = YNL_PT_U8, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_FLOWLABEL] = { .name = "flowlabel", .type = YNL_PT_U32, };
+	arr[RT_RULE_A_FIB_RULE_ATTRS_FLOWLABEL_MASK] = { .name = "flowlabel-mask", .type = YNL_PT_U32, };
+	return arr;
+} ();
+
+struct ynl_policy_nest rt_rule_fib_rule_attrs_nest = {
+	.max_attr = 27,
+	.table = rt_rule_fib_rule_attrs_policy.data(),
+};
+
+/* Common nested types */
+/* ============== NEWRULE ============== */
+/* NEWRULE - do */
+static void rt_rule_newrule_put(struct nlmsghdr *nlh, rt_rule_newrule_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct fib_rule_hdr)) + 124 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.priority.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_PRIORITY, req.priority.value());
+	if (req.fwmark.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_FWMARK, req.fwmark.value());
+	if (req.flow.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_FLOW, req.flow.value());
+	if (req.tun_id.has_value())
+		ynl_attr_put_u64_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_TUN_ID, req.tun_id.value());
+	if (req.fwmask.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_FWMASK, req.fwmask.value());
+	if (req.table.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_TABLE, req.table.value());
+	if (req.suppress_prefixlen.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_SUPPRESS_PREFIXLEN, req.suppress_prefixlen.value());
+	if (req.suppress_ifgroup.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_SUPPRESS_IFGROUP, req.suppress_ifgroup.value());
+	if (req.goto_.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_GOTO, req.goto_.value());
+	if (req.l3mdev.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_L3MDEV, req.l3mdev.value());
+	if (req.protocol.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_PROTOCOL, req.protocol.value());
+	if (req.ip_proto.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_IP_PROTO, req.ip_proto.value());
+	if (req.dscp.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_DSCP, req.dscp.value());
+	if (req.flowlabel.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_FLOWLABEL, req.flowlabel.value());
+	if (req.flowlabel_mask.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_FLOWLABEL_MASK, req.flowlabel_mask.value());
+	if (req.iifname.size() > 0)
+		ynl_attr_put_str(nlh, RT_RULE_A_FIB_RULE_ATTRS_IIFNAME, req.iifname.data());
+	if (req.oifname.size() > 0)
+		ynl_attr_put_str(nlh, RT_RULE_A_FIB_RULE_ATTRS_OIFNAME, req.oifname.data());
+	if (req.uid_range.size() > 0)
+		ynl_attr_put(nlh, RT_RULE_A_FIB_RULE_ATTRS_UID_RANGE, req.uid_range.data(), req.uid_range.size());
+	if (req.sport_range.size() > 0)
+		ynl_attr_put(nlh, RT_RULE_A_FIB_RULE_ATTRS_SPORT_RANGE, req.sport_range.data(), req.sport_range.size());
+	if (req.dport_range.size() > 0)
+		ynl_attr_put(nlh, RT_RULE_A_FIB_RULE_ATTRS_DPORT_RANGE, req.dport_range.data(), req.dport_range.size());
+}
+
+static ynl_cpp::result<void>
+rt_rule_newrule_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_rule_fib_rule_attrs_nest;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_rule_newrule_ex(ynl_cpp::ynl_socket&  ys, rt_rule_newrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWRULE, req._nlmsg_flags);
+	rt_rule_newrule_put(nlh, req);
+
+	return rt_rule_newrule_exec(ys, nlh);
+}
+
+int rt_rule_newrule(ynl_cpp::ynl_socket&  ys, rt_rule_newrule_req& req)
+{
+	auto ret = rt_rule_newrule_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_rule_newrule_prepare(ynl_cpp::ynl_socket&  ys, rt_rule_newrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWRULE, req._nlmsg_flags);
+	rt_rule_newrule_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+rt_rule_newrule_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return rt_rule_newrule_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_rule_newrule(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_rule_newrule_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_rule_newrule_batch(ynl_cpp::msg_batch& batch, rt_rule_newrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_NEWRULE, req._nlmsg_flags);
+	rt_rule_newrule_put(nlh, req);
+	return batch.msg_end(nlh, &rt_rule_fib_rule_attrs_nest);
+}
+
+/* ============== DELRULE ============== */
+/* DELRULE - do */
+static void rt_rule_delrule_put(struct nlmsghdr *nlh, rt_rule_delrule_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct fib_rule_hdr)) + 124 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.priority.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_PRIORITY, req.priority.value());
+	if (req.fwmark.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_FWMARK, req.fwmark.value());
+	if (req.flow.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_FLOW, req.flow.value());
+	if (req.tun_id.has_value())
+		ynl_attr_put_u64_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_TUN_ID, req.tun_id.value());
+	if (req.fwmask.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_FWMASK, req.fwmask.value());
+	if (req.table.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_TABLE, req.table.value());
+	if (req.suppress_prefixlen.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_SUPPRESS_PREFIXLEN, req.suppress_prefixlen.value());
+	if (req.suppress_ifgroup.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_SUPPRESS_IFGROUP, req.suppress_ifgroup.value());
+	if (req.goto_.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_GOTO, req.goto_.value());
+	if (req.l3mdev.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_L3MDEV, req.l3mdev.value());
+	if (req.protocol.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_PROTOCOL, req.protocol.value());
+	if (req.ip_proto.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_IP_PROTO, req.ip_proto.value());
+	if (req.dscp.has_value())
+		ynl_attr_put_u8_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_DSCP, req.dscp.value());
+	if (req.flowlabel.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_FLOWLABEL, req.flowlabel.value());
+	if (req.flowlabel_mask.has_value())
+		ynl_attr_put_u32_unchecked(nlh, RT_RULE_A_FIB_RULE_ATTRS_FLOWLABEL_MASK, req.flowlabel_mask.value());
+	if (req.iifname.size() > 0)
+		ynl_attr_put_str(nlh, RT_RULE_A_FIB_RULE_ATTRS_IIFNAME, req.iifname.data());
+	if (req.oifname.size() > 0)
+		ynl_attr_put_str(nlh, RT_RULE_A_FIB_RULE_ATTRS_OIFNAME, req.oifname.data());
+	if (req.uid_range.size() > 0)
+		ynl_attr_put(nlh, RT_RULE_A_FIB_RULE_ATTRS_UID_RANGE, req.uid_range.data(), req.uid_range.size());
+	if (req.sport_range.size() > 0)
+		ynl_attr_put(nlh, RT_RULE_A_FIB_RULE_ATTRS_SPORT_RANGE, req.sport_range.data(), req.sport_range.size());
+	if (req.dport_range.size() > 0)
+		ynl_attr_put(nlh, RT_RULE_A_FIB_RULE_ATTRS_DPORT_RANGE, req.dport_range.data(), req.dport_range.size());
+}
+
+static ynl_cpp::result<void>
+rt_rule_delrule_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &rt_rule_fib_rule_attrs_nest;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+rt_rule_delrule_ex(ynl_cpp::ynl_socket&  ys, rt_rule_delrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELRULE, req._nlmsg_flags);
+	rt_rule_delrule_put(nlh, req);
+
+	return rt_rule_delrule_exec(ys, nlh);
+}
+
+int rt_rule_delrule(ynl_cpp::ynl_socket&  ys, rt_rule_delrule_req& req)
+{
+	auto ret = rt_rule_delrule_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_rule_delrule_prepare(ynl_cpp::ynl_socket&  ys, rt_rule_delrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELRULE, req._nlmsg_flags);
+	rt_rule_delrule_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+rt_rule_delrule_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return rt_rule_delrule_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int rt_rule_delrule(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_rule_delrule_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+rt_rule_delrule_batch(ynl_cpp::msg_batch& batch, rt_rule_delrule_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_DELRULE, req._nlmsg_flags);
+	rt_rule_delrule_put(nlh, req);
+	return batch.msg_end(nlh, &rt_rule_fib_rule_attrs_nest);
+}
+
+/* ============== GETRULE ============== */
+/* GETRULE - dump */
+int rt_rule_getrule_rsp_dump_parse(const struct nlmsghdr *nlh,
+				   struct ynl_parse_arg *yarg)
+{
+	rt_rule_getrule_rsp_dump *dst;
+	const struct nlattr *attr;
+	void *hdr;
+
+	dst = (rt_rule_getrule_rsp_dump*)yarg->data;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct fib_rule_hdr));
+
+	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == RT_RULE_A_FIB_RULE_ATTRS_IIFNAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->iifname.assign(ynl_attr_get_str(attr));
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_OIFNAME) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->oifname.assign(ynl_attr_get_str(attr));
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_PRIORITY) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->priority = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_FWMARK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->fwmark = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_FLOW) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->flow = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_TUN_ID) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->tun_id = (__u64)ynl_attr_get_u64(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_FWMASK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->fwmask = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_TABLE) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->table = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_SUPPRESS_PREFIXLEN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->suppress_prefixlen = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_SUPPRESS_IFGROUP) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->suppress_ifgroup = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_GOTO) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->goto_ = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_L3MDEV) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->l3mdev = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_UID_RANGE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->uid_range.assign(data, data + len);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_PROTOCOL) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->protocol = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_IP_PROTO) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->ip_proto = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_SPORT_RANGE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->sport_range.assign(data, data + len);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_DPORT_RANGE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->dport_range.assign(data, data + len);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_DSCP) {
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
+			dst->dscp = (__u8)ynl_attr_get_u8(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_FLOWLABEL) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->flowlabel = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == RT_RULE_A_FIB_RULE_ATTRS_FLOWLABEL_MASK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->flowlabel_mask = (__u32)ynl_attr_get_u32(attr);
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void
+rt_rule_getrule_dump_put(struct nlmsghdr *nlh, rt_rule_getrule_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<rt_rule_getrule_rsp_list>>
+rt_rule_getrule_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<rt_rule_getrule_rsp_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &rt_rule_fib_rule_attrs_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<rt_rule_getrule_rsp_list*>(arg)->objs.emplace_back());};
+	yds.cb = rt_rule_getrule_rsp_dump_parse;
+	yds.rsp_cmd = RTM_NEWRULE;
+	((struct ynl_sock*)ys)->req_policy = &rt_rule_fib_rule_attrs_nest;
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<rt_rule_getrule_rsp_list>>
+rt_rule_getrule_dump_ex(ynl_cpp::ynl_socket&  ys,
+			rt_rule_getrule_req_dump& req,
+			const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETRULE);
+	rt_rule_getrule_dump_put(nlh, req);
+
+	return rt_rule_getrule_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<rt_rule_getrule_rsp_list>
+rt_rule_getrule_dump(ynl_cpp::ynl_socket&  ys, rt_rule_getrule_req_dump& req)
+{
+	auto ret = rt_rule_getrule_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+rt_rule_getrule_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     rt_rule_getrule_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETRULE);
+	rt_rule_getrule_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<rt_rule_getrule_rsp_list>>
+rt_rule_getrule_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj)
+{
+	return rt_rule_getrule_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<rt_rule_getrule_rsp_list>
+rt_rule_getrule_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = rt_rule_getrule_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+static const struct ynl_mcast_grp rt_rule_mcast_groups[] = {
+	{ "rtnlgrp-ipv4-rule", 8 },
+	{ "rtnlgrp-ipv6-rule", 19 },
+};
+
+const struct ynl_family ynl_rt_rule_family =  {
+	.name		= "rt_rule",
+	.hdr_len	= sizeof(struct fib_rule_hdr),
+	.is_classic	= true,
+	.classic_id	= 0,
+	.mcast_groups	= rt_rule_mcast_groups,
+	.n_mcast_groups	= std::size(rt_rule_mcast_groups),
+};
+const struct ynl_family& get_ynl_rt_rule_family() {
+	return ynl_rt_rule_family;
+};
+} //namespace ynl_cpp
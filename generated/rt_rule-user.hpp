@@ -0,0 +1,242 @@
+/* SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause) */
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user header */
+
+#ifndef _LINUX_RT_RULE_GEN_H
+#define _LINUX_RT_RULE_GEN_H
+
+#include <linux/types.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ynl.hpp"
+
+#include <linux/netlink.h>
+
+namespace ynl_cpp {
+/* Definitions */
+enum rt_rule_fr_act {
+	RT_RULE_FR_ACT_UNSPEC = 0,
+	RT_RULE_FR_ACT_TO_TBL = 1,
+	RT_RULE_FR_ACT_GOTO = 2,
+	RT_RULE_FR_ACT_NOP = 3,
+	RT_RULE_FR_ACT_RES3 = 4,
+	RT_RULE_FR_ACT_RES4 = 5,
+	RT_RULE_FR_ACT_BLACKHOLE = 6,
+	RT_RULE_FR_ACT_UNREACHABLE = 7,
+	RT_RULE_FR_ACT_PROHIBIT = 8,
+};
+
+struct fib_rule_hdr {
+	__u8 family;
+	__u8 dst_len;
+	__u8 src_len;
+	__u8 tos;
+	__u8 table;
+	__u8 res1[1];
+	__u8 res21[1];
+	__u8 action;
+	__u32 flags;
+};
+
+struct fib_rule_uid_range {
+	__u32 start;
+	__u32 end;
+};
+
+struct fib_rule_port_range {
+	__u16 start;
+	__u16 end;
+};
+
+/* Attributes */
+enum {
+	RT_RULE_A_FIB_RULE_ATTRS_DST = 1,
+	RT_RULE_A_FIB_RULE_ATTRS_SRC = 2,
+	RT_RULE_A_FIB_RULE_ATTRS_IIFNAME = 3,
+	RT_RULE_A_FIB_RULE_ATTRS_GOTO = 4,
+	RT_RULE_A_FIB_RULE_ATTRS_UNUSED2 = 5,
+	RT_RULE_A_FIB_RULE_ATTRS_PRIORITY = 6,
+	RT_RULE_A_FIB_RULE_ATTRS_UNUSED3 = 7,
+	RT_RULE_A_FIB_RULE_ATTRS_UNUSED4 = 8,
+	RT_RULE_A_FIB_RULE_ATTRS_UNUSED5 = 9,
+	RT_RULE_A_FIB_RULE_ATTRS_FWMARK = 10,
+	RT_RULE_A_FIB_RULE_ATTRS_FLOW = 11,
+	RT_RULE_A_FIB_RULE_ATTRS_TUN_ID = 12,
+	RT_RULE_A_FIB_RULE_ATTRS_SUPPRESS_IFGROUP = 13,
+	RT_RULE_A_FIB_RULE_ATTRS_SUPPRESS_PREFIXLEN = 14,
+	RT_RULE_A_FIB_RULE_ATTRS_TABLE = 15,
+	RT_RULE_A_FIB_RULE_ATTRS_FWMASK = 16,
+	RT_RULE_A_FIB_RULE_ATTRS_OIFNAME = 17,
+	RT_RULE_A_FIB_RULE_ATTRS_PAD = 18,
+	RT_RULE_A_FIB_RULE_ATTRS_L3MDEV = 19,
+	RT_RULE_A_FIB_RULE_ATTRS_UID_RANGE = 20,
+	RT_RULE_A_FIB_RULE_ATTRS_PROTOCOL = 21,
+	RT_RULE_A_FIB_RULE_ATTRS_IP_PROTO = 22,
+	RT_RULE_A_FIB_RULE_ATTRS_SPORT_RANGE = 23,
+	RT_RULE_A_FIB_RULE_ATTRS_DPORT_RANGE = 24,
+	RT_RULE_A_FIB_RULE_ATTRS_DSCP = 25,
+	RT_RULE_A_FIB_RULE_ATTRS_FLOWLABEL = 26,
+	RT_RULE_A_FIB_RULE_ATTRS_FLOWLABEL_MASK = 27,
+};
+
+const struct ynl_family& get_ynl_rt_rule_family();
+
+/* Enums */
+std::string_view rt_rule_op_str(int op);
+std::string_view rt_rule_fr_act_str(rt_rule_fr_act value);
+
+/* Common nested types */
+/* Policies and nested encoders */
+extern struct ynl_policy_nest rt_rule_fib_rule_attrs_nest;
+
+/* ============== NEWRULE ============== */
+/* NEWRULE - do */
+struct rt_rule_newrule_req {
+	__u16 _nlmsg_flags{};
+
+	struct fib_rule_hdr _hdr{};
+
+	std::string iifname;
+	std::string oifname;
+	std::optional<__u32> priority;
+	std::optional<__u32> fwmark;
+	std::optional<__u32> flow;
+	std::optional<__u64> tun_id;
+	std::optional<__u32> fwmask;
+	std::optional<__u32> table;
+	std::optional<__u32> suppress_prefixlen;
+	std::optional<__u32> suppress_ifgroup;
+	std::optional<__u32> goto_;
+	std::optional<__u8> l3mdev;
+	std::vector<__u8> uid_range;
+	std::optional<__u8> protocol;
+	std::optional<__u8> ip_proto;
+	std::vector<__u8> sport_range;
+	std::vector<__u8> dport_range;
+	std::optional<__u8> dscp;
+	std::optional<__u32> flowlabel /* big-endian */;
+	std::optional<__u32> flowlabel_mask /* big-endian */;
+};
+
+/*
+ * Add new FIB rule
+ */
+int rt_rule_newrule(ynl_cpp::ynl_socket&  ys, rt_rule_newrule_req& req);
+ynl_cpp::result<void>
+rt_rule_newrule_ex(ynl_cpp::ynl_socket&  ys, rt_rule_newrule_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_rule_newrule_prepare(ynl_cpp::ynl_socket&  ys, rt_rule_newrule_req& req);
+int rt_rule_newrule(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_rule_newrule_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_rule_newrule_batch(ynl_cpp::msg_batch& batch, rt_rule_newrule_req& req);
+
+/* ============== DELRULE ============== */
+/* DELRULE - do */
+struct rt_rule_delrule_req {
+	__u16 _nlmsg_flags{};
+
+	struct fib_rule_hdr _hdr{};
+
+	std::string iifname;
+	std::string oifname;
+	std::optional<__u32> priority;
+	std::optional<__u32> fwmark;
+	std::optional<__u32> flow;
+	std::optional<__u64> tun_id;
+	std::optional<__u32> fwmask;
+	std::optional<__u32> table;
+	std::optional<__u32> suppress_prefixlen;
+	std::optional<__u32> suppress_ifgroup;
+	std::optional<__u32> goto_;
+	std::optional<__u8> l3mdev;
+	std::vector<__u8> uid_range;
+	std::optional<__u8> protocol;
+	std::optional<__u8> ip_proto;
+	std::vector<__u8> sport_range;
+	std::vector<__u8> dport_range;
+	std::optional<__u8> dscp;
+	std::optional<__u32> flowlabel /* big-endian */;
+	std::optional<__u32> flowlabel_mask /* big-endian */;
+};
+
+/*
+ * Remove an existing FIB rule
+ */
+int rt_rule_delrule(ynl_cpp::ynl_socket&  ys, rt_rule_delrule_req& req);
+ynl_cpp::result<void>
+rt_rule_delrule_ex(ynl_cpp::ynl_socket&  ys, rt_rule_delrule_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_rule_delrule_prepare(ynl_cpp::ynl_socket&  ys, rt_rule_delrule_req& req);
+int rt_rule_delrule(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+rt_rule_delrule_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+rt_rule_delrule_batch(ynl_cpp::msg_batch& batch, rt_rule_delrule_req& req);
+
+/* ============== GETRULE ============== */
+/* GETRULE - dump */
+struct rt_rule_getrule_req_dump {
+	struct fib_rule_hdr _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t rt_rule_getrule_req_dump_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct fib_rule_hdr)) + 0;
+
+struct rt_rule_getrule_rsp_dump {
+	struct fib_rule_hdr _hdr{};
+
+	std::string iifname;
+	std::string oifname;
+	std::optional<__u32> priority;
+	std::optional<__u32> fwmark;
+	std::optional<__u32> flow;
+	std::optional<__u64> tun_id;
+	std::optional<__u32> fwmask;
+	std::optional<__u32> table;
+	std::optional<__u32> suppress_prefixlen;
+	std::optional<__u32> suppress_ifgroup;
+	std::optional<__u32> goto_;
+	std::optional<__u8> l3mdev;
+	std::vector<__u8> uid_range;
+	std::optional<__u8> protocol;
+	std::optional<__u8> ip_proto;
+	std::vector<__u8> sport_range;
+	std::vector<__u8> dport_range;
+	std::optional<__u8> dscp;
+	std::optional<__u32> flowlabel /* big-endian */;
+	std::optional<__u32> flowlabel_mask /* big-endian */;
+};
+
+struct rt_rule_getrule_rsp_list {
+	std::list<rt_rule_getrule_rsp_dump> objs;
+};
+
+std::unique_ptr<rt_rule_getrule_rsp_list>
+rt_rule_getrule_dump(ynl_cpp::ynl_socket&  ys, rt_rule_getrule_req_dump& req);
+ynl_cpp::result<std::unique_ptr<rt_rule_getrule_rsp_list>>
+rt_rule_getrule_dump_ex(ynl_cpp::ynl_socket&  ys,
+			rt_rule_getrule_req_dump& req,
+			const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+rt_rule_getrule_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			     rt_rule_getrule_req_dump& req);
+std::unique_ptr<rt_rule_getrule_rsp_list>
+rt_rule_getrule_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<rt_rule_getrule_rsp_list>>
+rt_rule_getrule_dump_ex(ynl_cpp::ynl_socket&  ys,
+			ynl_cpp::request_template& tmpl,
+			const ynl_cpp::projection *proj = nullptr);
+
+} //namespace ynl_cpp
+#endif /* _LINUX_RT_RULE_GEN_H */
@@ -0,0 +1,1861 @@
+// SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause)
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user source */
+
+#include "tc-user.hpp"
+
+#include <array>
+
+#include <linux/genetlink.h>
+#include <linux/rtnetlink.h>
+
+namespace ynl_cpp {
+
+/* Enums */
+static constexpr std::array<std::string_view, RTM_NEWCHAIN + 1> tc_op_strmap = []() {
+	std::array<std::string_view, RTM_NEWCHAIN + 1> arr{};
+	arr[RTM_NEWQDISC] = "getqdisc";
+	arr[RTM_NEWTCLASS] = "gettclass";
+	arr[RTM_NEWTFILTER] = "gettfilter";
+	arr[RTM_NEWCHAIN] = "getchain";
+	return arr;
+} ();
+
+std::string_view tc_op_str(int op)
+{
+	if (op < 0 || op >= (int)(tc_op_strmap.size()))
+		return "";
+	return tc_op_strmap[op];
+}
+
+static constexpr std::array<std::string_view, 4 + 1> tc_tc_cls_flags_strmap = []() {
+	std::array<std::string_view, 4 + 1> arr{};
+	arr[0] = "skip-hw";
+	arr[1] = "skip-sw";
+	arr[2] = "in-hw";
+	arr[3] = "not-in-nw";
+	arr[4] = "verbose";
+	return arr;
+} ();
+
+std::string_view tc_tc_cls_flags_str(tc_tc_cls_flags value)
+{
+	value = (tc_tc_cls_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(tc_tc_cls_flags_strmap.size()))
+		return "";
+	return tc_tc_cls_flags_strmap[value];
+}
+
+static constexpr std::array<std::string_view, 5 + 1> tc_tc_flower_key_ctrl_flags_strmap = []() {
+	std::array<std::string_view, 5 + 1> arr{};
+	arr[0] = "frag";
+	arr[1] = "firstfrag";
+	arr[2] = "tuncsum";
+	arr[3] = "tundf";
+	arr[4] = "tunoam";
+	arr[5] = "tuncrit";
+	return arr;
+} ();
+
+std::string_view
+tc_tc_flower_key_ctrl_flags_str(tc_tc_flower_key_ctrl_flags value)
+{
+	value = (tc_tc_flower_key_ctrl_flags)(ffs(value) - 1);
+	if (value < 0 || value >= (int)(tc_tc_flower_key_ctrl_flags_strmap.size()))
+		return "";
+	return tc_tc_flower_key_ctrl_flags_strmap[value];
+}
+
+/* Policies */
+static std::array<ynl_policy_attr,8 + 1> tc_tca_stats_attrs_policy = []() {
+	std::array<ynl_policy_attr,8 + 1> arr{};
+	arr[TC_A_TCA_STATS_ATTRS_BASIC] = { .name = "basic", .type = YNL_PT_BINARY,};
+	arr[TC_A_TCA_STATS_ATTRS_RATE_EST] = { .name = "rate-est", .type = YNL_PT_BINARY,};
+	arr[TC_A_TCA_STATS_ATTRS_QUEUE] = { .name = "queue", .type = YNL_PT_BINARY,};
+	arr[TC_A_TCA_STATS_ATTRS_APP] = { .name = "app", .type = YNL_PT_BINARY,};
+	arr[TC_A_TCA_STATS_ATTRS_RATE_EST64] = { .name = "rate-est64", .type = YNL_PT_BINARY,};
+	arr[TC_A_TCA_STATS_ATTRS_PAD] = { .name = "pad", .type = YNL_PT_IGNORE, };
+	arr[TC_A_TCA_STATS_ATTRS_BASIC_HW] = { .name = "basic-hw", .type = YNL_PT_BINARY,};
+	arr[TC_A_TCA_STATS_ATTRS_PKT64] = { .name = "pkt64", .type = YNL_PT_U64, };
+	return arr;
+} ();
+
+struct ynl_policy_nest tc_tca_stats_attrs_nest = {
+	.max_attr = 8,
+	.table = tc_tca_stats_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,2 + 1> tc_tca_stab_attrs_policy = []() {
+	std::array<ynl_policy_attr,2 + 1> arr{};
+	arr[TC_A_TCA_STAB_ATTRS_BASE] = { .name = "base", .type = YNL_PT_BINARY,};
+	arr[TC_A_TCA_STAB_ATTRS_DATA] = { .name = "data", .type = YNL_PT_BINARY,};
+	return arr;
+} ();
+
+struct ynl_policy_nest tc_tca_stab_attrs_nest = {
+	.max_attr = 2,
+	.table = tc_tca_stab_attrs_policy.data(),
+};
+
+static std::array<ynl_policy_attr,16 + 1> tc_tc_attrs_policy = []() {
+	std::array<ynl_policy_attr,16 + 1> arr{};
+	arr[TC_A_TC_ATTRS_KIND] = { .name = "kind", .type = YNL_PT_NUL_STR, };
+	arr[TC_A_TC_ATTRS_OPTIONS] = { .name = "options", .type = YNL_PT_BINARY,};
+	arr[TC_A_TC_ATTRS_STATS] = { .name = "stats", .type = YNL_PT_BINARY,};
+	arr[TC_A_TC_ATTRS_XSTATS] = { .name = "xstats", .type = YNL_PT_BINARY,};
+	arr[TC_A_TC_ATTRS_RATE] = { .name = "rate", .type = YNL_PT_BINARY,};
+	arr[TC_A_TC_ATTRS_FCNT] = { .name = "fcnt", .type = YNL_PT_U32, };
+	arr[TC_A_TC_ATTRS_STATS2] = { .name = "stats2", .type = YNL_PT_NEST, .nest = &tc_tca_stats_attrs_nest, };
+	arr[TC_A_TC_ATTRS_STAB] = { .name = "stab", .type = YNL_PT_NEST, .nest = &tc_tca_stab_attrs_nest, };
+	arr[TC_A_TC_ATTRS_PAD] = { .name = "pad", .type = YNL_PT_IGNORE, };
+	arr[TC_A_TC_ATTRS_DUMP_INVISIBLE] = { .name = "dump-invisible", .type = YNL_PT_FLAG, };
+	arr[TC_A_TC_ATTRS_CHAIN] = { .name = "chain", .type = YNL_PT_U32, };
+	arr[TC_A_TC_ATTRS_HW_OFFLOAD] = { .name = "hw-offload", .type = YNL_PT_U8, };
+	arr[TC_A_TC_ATTRS_INGRESS_BLOCK] = { .name = "ingress-block", .type = YNL_PT_U32, };
+	arr[TC_A_TC_ATTRS_EGRESS_BLOCK] = { .name = "egress-block", .type = YNL_PT_U32, };
+	arr[TC_A_TC_ATTRS_DUMP_FLAGS] = { .name = "dump-flags", .type = YNL_PT_BITFIELD32, };
+	arr[TC_A_TC_ATTRS_EXT_WARN_MSG] = { .name = "ext-warn-msg", .type = YNL_PT_NUL_STR, };
+	return arr;
+} ();
+
+struct ynl_policy_nest tc_tc_attrs_nest = {
+	.max_attr = 16,
+	.table = tc_tc_attrs_policy.data(),
+};
+
+/* Common nested types */
+int tc_tca_stats_attrs_parse(struct ynl_parse_arg *yarg,
+			     const struct nlattr *nested)
+{
+	tc_tca_stats_attrs *dst = (tc_tca_stats_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == TC_A_TCA_STATS_ATTRS_BASIC) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->basic.assign(data, data + len);
+		} else if (type == TC_A_TCA_STATS_ATTRS_RATE_EST) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rate_est.assign(data, data + len);
+		} else if (type == TC_A_TCA_STATS_ATTRS_QUEUE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->queue.assign(data, data + len);
+		} else if (type == TC_A_TCA_STATS_ATTRS_APP) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "sub-message");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->app.assign(data, data + len);
+		} else if (type == TC_A_TCA_STATS_ATTRS_RATE_EST64) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rate_est64.assign(data, data + len);
+		} else if (type == TC_A_TCA_STATS_ATTRS_BASIC_HW) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->basic_hw.assign(data, data + len);
+		} else if (type == TC_A_TCA_STATS_ATTRS_PKT64) {
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
+			dst->pkt64 = (__u64)ynl_attr_get_u64(attr);
+		}
+	}
+
+	return 0;
+}
+
+int tc_tca_stab_attrs_parse(struct ynl_parse_arg *yarg,
+			    const struct nlattr *nested)
+{
+	tc_tca_stab_attrs *dst = (tc_tca_stab_attrs *)yarg->data;
+	const struct nlattr *attr;
+
+	ynl_attr_for_each_nested(attr, nested) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (type == TC_A_TCA_STAB_ATTRS_BASE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->base.assign(data, data + len);
+		} else if (type == TC_A_TCA_STAB_ATTRS_DATA) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->data.assign(data, data + len);
+		}
+	}
+
+	return 0;
+}
+
+/* ============== NEWQDISC ============== */
+/* NEWQDISC - do */
+static void tc_newqdisc_put(struct nlmsghdr *nlh, tc_newqdisc_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.chain.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_CHAIN, req.chain.value());
+	if (req.ingress_block.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_INGRESS_BLOCK, req.ingress_block.value());
+	if (req.egress_block.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_EGRESS_BLOCK, req.egress_block.value());
+	if (req.kind.size() > 0)
+		ynl_attr_put_str(nlh, TC_A_TC_ATTRS_KIND, req.kind.data());
+	if (req.options.size() > 0)
+		ynl_attr_put(nlh, TC_A_TC_ATTRS_OPTIONS, req.options.data(), req.options.size());
+	if (req.rate.size() > 0)
+		ynl_attr_put(nlh, TC_A_TC_ATTRS_RATE, req.rate.data(), req.rate.size());
+}
+
+static ynl_cpp::result<void>
+tc_newqdisc_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+tc_newqdisc_ex(ynl_cpp::ynl_socket&  ys, tc_newqdisc_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWQDISC, req._nlmsg_flags);
+	tc_newqdisc_put(nlh, req);
+
+	return tc_newqdisc_exec(ys, nlh);
+}
+
+int tc_newqdisc(ynl_cpp::ynl_socket&  ys, tc_newqdisc_req& req)
+{
+	auto ret = tc_newqdisc_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_newqdisc_prepare(ynl_cpp::ynl_socket&  ys, tc_newqdisc_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWQDISC, req._nlmsg_flags);
+	tc_newqdisc_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<void>
+tc_newqdisc_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return tc_newqdisc_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int tc_newqdisc(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_newqdisc_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+tc_newqdisc_batch(ynl_cpp::msg_batch& batch, tc_newqdisc_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_NEWQDISC, req._nlmsg_flags);
+	tc_newqdisc_put(nlh, req);
+	return batch.msg_end(nlh, &tc_tc_attrs_nest, sizeof(struct tcmsg));
+}
+
+/* ============== DELQDISC ============== */
+/* DELQDISC - do */
+static void tc_delqdisc_put(struct nlmsghdr *nlh, tc_delqdisc_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<void>
+tc_delqdisc_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+tc_delqdisc_ex(ynl_cpp::ynl_socket&  ys, tc_delqdisc_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELQDISC, req._nlmsg_flags);
+	tc_delqdisc_put(nlh, req);
+
+	return tc_delqdisc_exec(ys, nlh);
+}
+
+int tc_delqdisc(ynl_cpp::ynl_socket&  ys, tc_delqdisc_req& req)
+{
+	auto ret = tc_delqdisc_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_delqdisc_prepare(ynl_cpp::ynl_socket&  ys, tc_delqdisc_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELQDISC, req._nlmsg_flags);
+	tc_delqdisc_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<void>
+tc_delqdisc_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return tc_delqdisc_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int tc_delqdisc(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_delqdisc_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+tc_delqdisc_batch(ynl_cpp::msg_batch& batch, tc_delqdisc_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_DELQDISC, req._nlmsg_flags);
+	tc_delqdisc_put(nlh, req);
+	return batch.msg_end(nlh, &tc_tc_attrs_nest, sizeof(struct tcmsg));
+}
+
+/* ============== GETQDISC ============== */
+/* GETQDISC - do */
+int tc_getqdisc_rsp_parse(const struct nlmsghdr *nlh,
+			  struct ynl_parse_arg *yarg)
+{
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	tc_getqdisc_rsp *dst;
+	void *hdr;
+
+	dst = (tc_getqdisc_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct tcmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct tcmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == TC_A_TC_ATTRS_KIND) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->kind.assign(ynl_attr_get_str(attr));
+		} else if (type == TC_A_TC_ATTRS_OPTIONS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "sub-message");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->options.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->stats.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_XSTATS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "sub-message");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->xstats.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_RATE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rate.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_FCNT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->fcnt = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_STATS2) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &tc_tca_stats_attrs_nest;
+			parg.data = &dst->stats2.emplace();
+			if (tc_tca_stats_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == TC_A_TC_ATTRS_STAB) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &tc_tca_stab_attrs_nest;
+			parg.data = &dst->stab.emplace();
+			if (tc_tca_stab_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == TC_A_TC_ATTRS_CHAIN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->chain = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_INGRESS_BLOCK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ingress_block = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_EGRESS_BLOCK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->egress_block = (__u32)ynl_attr_get_u32(attr);
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void tc_getqdisc_put(struct nlmsghdr *nlh, tc_getqdisc_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 4 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.dump_invisible)
+		ynl_attr_put_unchecked(nlh, TC_A_TC_ATTRS_DUMP_INVISIBLE, NULL, 0);
+}
+
+static ynl_cpp::result<std::unique_ptr<tc_getqdisc_rsp>>
+tc_getqdisc_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		 const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<tc_getqdisc_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+	yrs.yarg.rsp_policy = &tc_tc_attrs_nest;
+
+	rsp.reset(new tc_getqdisc_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = tc_getqdisc_rsp_parse;
+	yrs.rsp_cmd = RTM_NEWQDISC;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<tc_getqdisc_rsp>>
+tc_getqdisc_ex(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req& req,
+	       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETQDISC, req._nlmsg_flags);
+	tc_getqdisc_put(nlh, req);
+
+	return tc_getqdisc_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<tc_getqdisc_rsp>
+tc_getqdisc(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req& req)
+{
+	auto ret = tc_getqdisc_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_getqdisc_prepare(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETQDISC, req._nlmsg_flags);
+	tc_getqdisc_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<tc_getqdisc_rsp>>
+tc_getqdisc_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	       const ynl_cpp::projection *proj)
+{
+	return tc_getqdisc_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<tc_getqdisc_rsp>
+tc_getqdisc(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_getqdisc_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* GETQDISC - dump */
+static void
+tc_getqdisc_dump_put(struct nlmsghdr *nlh, tc_getqdisc_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 4 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.dump_invisible)
+		ynl_attr_put_unchecked(nlh, TC_A_TC_ATTRS_DUMP_INVISIBLE, NULL, 0);
+}
+
+static ynl_cpp::result<std::unique_ptr<tc_getqdisc_list>>
+tc_getqdisc_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<tc_getqdisc_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &tc_tc_attrs_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<tc_getqdisc_list*>(arg)->objs.emplace_back());};
+	yds.cb = tc_getqdisc_rsp_parse;
+	yds.rsp_cmd = RTM_NEWQDISC;
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<tc_getqdisc_list>>
+tc_getqdisc_dump_ex(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req_dump& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETQDISC);
+	tc_getqdisc_dump_put(nlh, req);
+
+	return tc_getqdisc_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<tc_getqdisc_list>
+tc_getqdisc_dump(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req_dump& req)
+{
+	auto ret = tc_getqdisc_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_getqdisc_dump_prepare(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETQDISC);
+	tc_getqdisc_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<tc_getqdisc_list>>
+tc_getqdisc_dump_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return tc_getqdisc_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<tc_getqdisc_list>
+tc_getqdisc_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_getqdisc_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== NEWTCLASS ============== */
+/* NEWTCLASS - do */
+static void tc_newtclass_put(struct nlmsghdr *nlh, tc_newtclass_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.chain.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_CHAIN, req.chain.value());
+	if (req.ingress_block.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_INGRESS_BLOCK, req.ingress_block.value());
+	if (req.egress_block.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_EGRESS_BLOCK, req.egress_block.value());
+	if (req.kind.size() > 0)
+		ynl_attr_put_str(nlh, TC_A_TC_ATTRS_KIND, req.kind.data());
+	if (req.options.size() > 0)
+		ynl_attr_put(nlh, TC_A_TC_ATTRS_OPTIONS, req.options.data(), req.options.size());
+	if (req.rate.size() > 0)
+		ynl_attr_put(nlh, TC_A_TC_ATTRS_RATE, req.rate.data(), req.rate.size());
+}
+
+static ynl_cpp::result<void>
+tc_newtclass_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+tc_newtclass_ex(ynl_cpp::ynl_socket&  ys, tc_newtclass_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWTCLASS, req._nlmsg_flags);
+	tc_newtclass_put(nlh, req);
+
+	return tc_newtclass_exec(ys, nlh);
+}
+
+int tc_newtclass(ynl_cpp::ynl_socket&  ys, tc_newtclass_req& req)
+{
+	auto ret = tc_newtclass_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_newtclass_prepare(ynl_cpp::ynl_socket&  ys, tc_newtclass_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWTCLASS, req._nlmsg_flags);
+	tc_newtclass_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<void>
+tc_newtclass_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return tc_newtclass_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int tc_newtclass(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_newtclass_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+tc_newtclass_batch(ynl_cpp::msg_batch& batch, tc_newtclass_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_NEWTCLASS, req._nlmsg_flags);
+	tc_newtclass_put(nlh, req);
+	return batch.msg_end(nlh, &tc_tc_attrs_nest, sizeof(struct tcmsg));
+}
+
+/* ============== DELTCLASS ============== */
+/* DELTCLASS - do */
+static void tc_deltclass_put(struct nlmsghdr *nlh, tc_deltclass_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<void>
+tc_deltclass_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+tc_deltclass_ex(ynl_cpp::ynl_socket&  ys, tc_deltclass_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELTCLASS, req._nlmsg_flags);
+	tc_deltclass_put(nlh, req);
+
+	return tc_deltclass_exec(ys, nlh);
+}
+
+int tc_deltclass(ynl_cpp::ynl_socket&  ys, tc_deltclass_req& req)
+{
+	auto ret = tc_deltclass_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_deltclass_prepare(ynl_cpp::ynl_socket&  ys, tc_deltclass_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELTCLASS, req._nlmsg_flags);
+	tc_deltclass_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<void>
+tc_deltclass_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return tc_deltclass_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int tc_deltclass(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_deltclass_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+tc_deltclass_batch(ynl_cpp::msg_batch& batch, tc_deltclass_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_DELTCLASS, req._nlmsg_flags);
+	tc_deltclass_put(nlh, req);
+	return batch.msg_end(nlh, &tc_tc_attrs_nest, sizeof(struct tcmsg));
+}
+
+/* ============== GETTCLASS ============== */
+/* GETTCLASS - do */
+int tc_gettclass_rsp_parse(const struct nlmsghdr *nlh,
+			   struct ynl_parse_arg *yarg)
+{
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	tc_gettclass_rsp *dst;
+	void *hdr;
+
+	dst = (tc_gettclass_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct tcmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct tcmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == TC_A_TC_ATTRS_KIND) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->kind.assign(ynl_attr_get_str(attr));
+		} else if (type == TC_A_TC_ATTRS_OPTIONS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "sub-message");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->options.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->stats.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_XSTATS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "sub-message");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->xstats.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_RATE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rate.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_FCNT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->fcnt = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_STATS2) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &tc_tca_stats_attrs_nest;
+			parg.data = &dst->stats2.emplace();
+			if (tc_tca_stats_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == TC_A_TC_ATTRS_STAB) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &tc_tca_stab_attrs_nest;
+			parg.data = &dst->stab.emplace();
+			if (tc_tca_stab_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == TC_A_TC_ATTRS_CHAIN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->chain = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_INGRESS_BLOCK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ingress_block = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_EGRESS_BLOCK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->egress_block = (__u32)ynl_attr_get_u32(attr);
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void tc_gettclass_put(struct nlmsghdr *nlh, tc_gettclass_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<tc_gettclass_rsp>>
+tc_gettclass_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		  const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<tc_gettclass_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+	yrs.yarg.rsp_policy = &tc_tc_attrs_nest;
+
+	rsp.reset(new tc_gettclass_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = tc_gettclass_rsp_parse;
+	yrs.rsp_cmd = RTM_NEWTCLASS;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<tc_gettclass_rsp>>
+tc_gettclass_ex(ynl_cpp::ynl_socket&  ys, tc_gettclass_req& req,
+		const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETTCLASS, req._nlmsg_flags);
+	tc_gettclass_put(nlh, req);
+
+	return tc_gettclass_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<tc_gettclass_rsp>
+tc_gettclass(ynl_cpp::ynl_socket&  ys, tc_gettclass_req& req)
+{
+	auto ret = tc_gettclass_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_gettclass_prepare(ynl_cpp::ynl_socket&  ys, tc_gettclass_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETTCLASS, req._nlmsg_flags);
+	tc_gettclass_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<tc_gettclass_rsp>>
+tc_gettclass_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		const ynl_cpp::projection *proj)
+{
+	return tc_gettclass_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<tc_gettclass_rsp>
+tc_gettclass(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_gettclass_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* GETTCLASS - dump */
+static void
+tc_gettclass_dump_put(struct nlmsghdr *nlh, tc_gettclass_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+}
+
+static ynl_cpp::result<std::unique_ptr<tc_gettclass_list>>
+tc_gettclass_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		       const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<tc_gettclass_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &tc_tc_attrs_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<tc_gettclass_list*>(arg)->objs.emplace_back());};
+	yds.cb = tc_gettclass_rsp_parse;
+	yds.rsp_cmd = RTM_NEWTCLASS;
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<tc_gettclass_list>>
+tc_gettclass_dump_ex(ynl_cpp::ynl_socket&  ys, tc_gettclass_req_dump& req,
+		     const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETTCLASS);
+	tc_gettclass_dump_put(nlh, req);
+
+	return tc_gettclass_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<tc_gettclass_list>
+tc_gettclass_dump(ynl_cpp::ynl_socket&  ys, tc_gettclass_req_dump& req)
+{
+	auto ret = tc_gettclass_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_gettclass_dump_prepare(ynl_cpp::ynl_socket&  ys, tc_gettclass_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETTCLASS);
+	tc_gettclass_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<tc_gettclass_list>>
+tc_gettclass_dump_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj)
+{
+	return tc_gettclass_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<tc_gettclass_list>
+tc_gettclass_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_gettclass_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== NEWTFILTER ============== */
+/* NEWTFILTER - do */
+static void tc_newtfilter_put(struct nlmsghdr *nlh, tc_newtfilter_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.chain.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_CHAIN, req.chain.value());
+	if (req.ingress_block.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_INGRESS_BLOCK, req.ingress_block.value());
+	if (req.egress_block.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_EGRESS_BLOCK, req.egress_block.value());
+	if (req.kind.size() > 0)
+		ynl_attr_put_str(nlh, TC_A_TC_ATTRS_KIND, req.kind.data());
+	if (req.options.size() > 0)
+		ynl_attr_put(nlh, TC_A_TC_ATTRS_OPTIONS, req.options.data(), req.options.size());
+	if (req.rate.size() > 0)
+		ynl_attr_put(nlh, TC_A_TC_ATTRS_RATE, req.rate.data(), req.rate.size());
+}
+
+static ynl_cpp::result<void>
+tc_newtfilter_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+tc_newtfilter_ex(ynl_cpp::ynl_socket&  ys, tc_newtfilter_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWTFILTER, req._nlmsg_flags);
+	tc_newtfilter_put(nlh, req);
+
+	return tc_newtfilter_exec(ys, nlh);
+}
+
+int tc_newtfilter(ynl_cpp::ynl_socket&  ys, tc_newtfilter_req& req)
+{
+	auto ret = tc_newtfilter_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_newtfilter_prepare(ynl_cpp::ynl_socket&  ys, tc_newtfilter_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWTFILTER, req._nlmsg_flags);
+	tc_newtfilter_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<void>
+tc_newtfilter_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return tc_newtfilter_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int tc_newtfilter(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_newtfilter_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+tc_newtfilter_batch(ynl_cpp::msg_batch& batch, tc_newtfilter_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_NEWTFILTER, req._nlmsg_flags);
+	tc_newtfilter_put(nlh, req);
+	return batch.msg_end(nlh, &tc_tc_attrs_nest, sizeof(struct tcmsg));
+}
+
+/* ============== DELTFILTER ============== */
+/* DELTFILTER - do */
+static void tc_deltfilter_put(struct nlmsghdr *nlh, tc_deltfilter_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.chain.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_CHAIN, req.chain.value());
+	if (req.kind.size() > 0)
+		ynl_attr_put_str(nlh, TC_A_TC_ATTRS_KIND, req.kind.data());
+}
+
+static ynl_cpp::result<void>
+tc_deltfilter_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+tc_deltfilter_ex(ynl_cpp::ynl_socket&  ys, tc_deltfilter_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELTFILTER, req._nlmsg_flags);
+	tc_deltfilter_put(nlh, req);
+
+	return tc_deltfilter_exec(ys, nlh);
+}
+
+int tc_deltfilter(ynl_cpp::ynl_socket&  ys, tc_deltfilter_req& req)
+{
+	auto ret = tc_deltfilter_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_deltfilter_prepare(ynl_cpp::ynl_socket&  ys, tc_deltfilter_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELTFILTER, req._nlmsg_flags);
+	tc_deltfilter_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<void>
+tc_deltfilter_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return tc_deltfilter_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int tc_deltfilter(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_deltfilter_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+tc_deltfilter_batch(ynl_cpp::msg_batch& batch, tc_deltfilter_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_DELTFILTER, req._nlmsg_flags);
+	tc_deltfilter_put(nlh, req);
+	return batch.msg_end(nlh, &tc_tc_attrs_nest, sizeof(struct tcmsg));
+}
+
+/* ============== GETTFILTER ============== */
+/* GETTFILTER - do */
+int tc_gettfilter_rsp_parse(const struct nlmsghdr *nlh,
+			    struct ynl_parse_arg *yarg)
+{
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	tc_gettfilter_rsp *dst;
+	void *hdr;
+
+	dst = (tc_gettfilter_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct tcmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct tcmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == TC_A_TC_ATTRS_KIND) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->kind.assign(ynl_attr_get_str(attr));
+		} else if (type == TC_A_TC_ATTRS_OPTIONS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "sub-message");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->options.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->stats.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_XSTATS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "sub-message");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->xstats.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_RATE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rate.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_FCNT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->fcnt = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_STATS2) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &tc_tca_stats_attrs_nest;
+			parg.data = &dst->stats2.emplace();
+			if (tc_tca_stats_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == TC_A_TC_ATTRS_STAB) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &tc_tca_stab_attrs_nest;
+			parg.data = &dst->stab.emplace();
+			if (tc_tca_stab_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == TC_A_TC_ATTRS_CHAIN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->chain = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_INGRESS_BLOCK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ingress_block = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_EGRESS_BLOCK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->egress_block = (__u32)ynl_attr_get_u32(attr);
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void tc_gettfilter_put(struct nlmsghdr *nlh, tc_gettfilter_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.chain.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_CHAIN, req.chain.value());
+	if (req.kind.size() > 0)
+		ynl_attr_put_str(nlh, TC_A_TC_ATTRS_KIND, req.kind.data());
+}
+
+static ynl_cpp::result<std::unique_ptr<tc_gettfilter_rsp>>
+tc_gettfilter_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		   const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<tc_gettfilter_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+	yrs.yarg.rsp_policy = &tc_tc_attrs_nest;
+
+	rsp.reset(new tc_gettfilter_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = tc_gettfilter_rsp_parse;
+	yrs.rsp_cmd = RTM_NEWTFILTER;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<tc_gettfilter_rsp>>
+tc_gettfilter_ex(ynl_cpp::ynl_socket&  ys, tc_gettfilter_req& req,
+		 const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETTFILTER, req._nlmsg_flags);
+	tc_gettfilter_put(nlh, req);
+
+	return tc_gettfilter_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<tc_gettfilter_rsp>
+tc_gettfilter(ynl_cpp::ynl_socket&  ys, tc_gettfilter_req& req)
+{
+	auto ret = tc_gettfilter_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_gettfilter_prepare(ynl_cpp::ynl_socket&  ys, tc_gettfilter_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETTFILTER, req._nlmsg_flags);
+	tc_gettfilter_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<tc_gettfilter_rsp>>
+tc_gettfilter_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		 const ynl_cpp::projection *proj)
+{
+	return tc_gettfilter_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<tc_gettfilter_rsp>
+tc_gettfilter(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_gettfilter_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* GETTFILTER - dump */
+static void
+tc_gettfilter_dump_put(struct nlmsghdr *nlh, tc_gettfilter_req_dump& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 20 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.chain.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_CHAIN, req.chain.value());
+	if (req.dump_flags.has_value())
+		ynl_attr_put_unchecked(nlh, TC_A_TC_ATTRS_DUMP_FLAGS, &(*req.dump_flags), sizeof(struct nla_bitfield32));
+}
+
+static ynl_cpp::result<std::unique_ptr<tc_gettfilter_list>>
+tc_gettfilter_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
+{
+	struct ynl_dump_no_alloc_state yds = {};
+	int err;
+
+	auto ret = std::make_unique<tc_gettfilter_list>();
+	yds.yarg.ys = ys;
+	yds.yarg.rsp_policy = &tc_tc_attrs_nest;
+	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
+	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<tc_gettfilter_list*>(arg)->objs.emplace_back());};
+	yds.cb = tc_gettfilter_rsp_parse;
+	yds.rsp_cmd = RTM_NEWTFILTER;
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+
+	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return ret;
+}
+
+ynl_cpp::result<std::unique_ptr<tc_gettfilter_list>>
+tc_gettfilter_dump_ex(ynl_cpp::ynl_socket&  ys, tc_gettfilter_req_dump& req,
+		      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETTFILTER);
+	tc_gettfilter_dump_put(nlh, req);
+
+	return tc_gettfilter_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<tc_gettfilter_list>
+tc_gettfilter_dump(ynl_cpp::ynl_socket&  ys, tc_gettfilter_req_dump& req)
+{
+	auto ret = tc_gettfilter_dump_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_gettfilter_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			   tc_gettfilter_req_dump& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_dump(ys, RTM_GETTFILTER);
+	tc_gettfilter_dump_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<tc_gettfilter_list>>
+tc_gettfilter_dump_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj)
+{
+	return tc_gettfilter_dump_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<tc_gettfilter_list>
+tc_gettfilter_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_gettfilter_dump_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== NEWCHAIN ============== */
+/* NEWCHAIN - do */
+static void tc_newchain_put(struct nlmsghdr *nlh, tc_newchain_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 24 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.chain.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_CHAIN, req.chain.value());
+	if (req.ingress_block.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_INGRESS_BLOCK, req.ingress_block.value());
+	if (req.egress_block.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_EGRESS_BLOCK, req.egress_block.value());
+	if (req.kind.size() > 0)
+		ynl_attr_put_str(nlh, TC_A_TC_ATTRS_KIND, req.kind.data());
+	if (req.options.size() > 0)
+		ynl_attr_put(nlh, TC_A_TC_ATTRS_OPTIONS, req.options.data(), req.options.size());
+	if (req.rate.size() > 0)
+		ynl_attr_put(nlh, TC_A_TC_ATTRS_RATE, req.rate.data(), req.rate.size());
+}
+
+static ynl_cpp::result<void>
+tc_newchain_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+tc_newchain_ex(ynl_cpp::ynl_socket&  ys, tc_newchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWCHAIN, req._nlmsg_flags);
+	tc_newchain_put(nlh, req);
+
+	return tc_newchain_exec(ys, nlh);
+}
+
+int tc_newchain(ynl_cpp::ynl_socket&  ys, tc_newchain_req& req)
+{
+	auto ret = tc_newchain_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_newchain_prepare(ynl_cpp::ynl_socket&  ys, tc_newchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_NEWCHAIN, req._nlmsg_flags);
+	tc_newchain_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<void>
+tc_newchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return tc_newchain_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int tc_newchain(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_newchain_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+tc_newchain_batch(ynl_cpp::msg_batch& batch, tc_newchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_NEWCHAIN, req._nlmsg_flags);
+	tc_newchain_put(nlh, req);
+	return batch.msg_end(nlh, &tc_tc_attrs_nest, sizeof(struct tcmsg));
+}
+
+/* ============== DELCHAIN ============== */
+/* DELCHAIN - do */
+static void tc_delchain_put(struct nlmsghdr *nlh, tc_delchain_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.chain.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_CHAIN, req.chain.value());
+}
+
+static ynl_cpp::result<void>
+tc_delchain_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return {};
+}
+
+ynl_cpp::result<void>
+tc_delchain_ex(ynl_cpp::ynl_socket&  ys, tc_delchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELCHAIN, req._nlmsg_flags);
+	tc_delchain_put(nlh, req);
+
+	return tc_delchain_exec(ys, nlh);
+}
+
+int tc_delchain(ynl_cpp::ynl_socket&  ys, tc_delchain_req& req)
+{
+	auto ret = tc_delchain_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_delchain_prepare(ynl_cpp::ynl_socket&  ys, tc_delchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_DELCHAIN, req._nlmsg_flags);
+	tc_delchain_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<void>
+tc_delchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return tc_delchain_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int tc_delchain(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_delchain_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+tc_delchain_batch(ynl_cpp::msg_batch& batch, tc_delchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.msg_start(RTM_DELCHAIN, req._nlmsg_flags);
+	tc_delchain_put(nlh, req);
+	return batch.msg_end(nlh, &tc_tc_attrs_nest, sizeof(struct tcmsg));
+}
+
+/* ============== GETCHAIN ============== */
+/* GETCHAIN - do */
+int tc_getchain_rsp_parse(const struct nlmsghdr *nlh,
+			  struct ynl_parse_arg *yarg)
+{
+	const struct nlattr *attr;
+	struct ynl_parse_arg parg;
+	tc_getchain_rsp *dst;
+	void *hdr;
+
+	dst = (tc_getchain_rsp*)yarg->data;
+	parg.ys = yarg->ys;
+
+	hdr = ynl_nlmsg_data(nlh);
+	memcpy(&dst->_hdr, hdr, sizeof(struct tcmsg));
+
+	ynl_attr_for_each(attr, nlh, sizeof(struct tcmsg)) {
+		unsigned int type = ynl_attr_type(attr);
+
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
+		if (type == TC_A_TC_ATTRS_KIND) {
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->kind.assign(ynl_attr_get_str(attr));
+		} else if (type == TC_A_TC_ATTRS_OPTIONS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "sub-message");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->options.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_STATS) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->stats.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_XSTATS) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "sub-message");
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->xstats.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_RATE) {
+			unsigned int len = ynl_attr_data_len(attr);
+			__u8 *data = (__u8*)ynl_attr_data(attr);
+			dst->rate.assign(data, data + len);
+		} else if (type == TC_A_TC_ATTRS_FCNT) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->fcnt = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_STATS2) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &tc_tca_stats_attrs_nest;
+			parg.data = &dst->stats2.emplace();
+			if (tc_tca_stats_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == TC_A_TC_ATTRS_STAB) {
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
+
+			parg.rsp_policy = &tc_tca_stab_attrs_nest;
+			parg.data = &dst->stab.emplace();
+			if (tc_tca_stab_attrs_parse(&parg, attr))
+				return YNL_PARSE_CB_ERROR;
+		} else if (type == TC_A_TC_ATTRS_CHAIN) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->chain = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_INGRESS_BLOCK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->ingress_block = (__u32)ynl_attr_get_u32(attr);
+		} else if (type == TC_A_TC_ATTRS_EGRESS_BLOCK) {
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
+			dst->egress_block = (__u32)ynl_attr_get_u32(attr);
+		}
+	}
+
+	return YNL_PARSE_CB_OK;
+}
+
+static void tc_getchain_put(struct nlmsghdr *nlh, tc_getchain_req& req)
+{
+	size_t hdr_len;
+	void *hdr;
+
+	static_assert(NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	hdr_len = sizeof(req._hdr);
+	hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);
+	memcpy(hdr, &req._hdr, hdr_len);
+
+	if (req.chain.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TC_A_TC_ATTRS_CHAIN, req.chain.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<tc_getchain_rsp>>
+tc_getchain_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		 const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<tc_getchain_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tc_tc_attrs_nest;
+	((struct ynl_sock*)ys)->req_hdr_len = sizeof(struct tcmsg);
+	yrs.yarg.rsp_policy = &tc_tc_attrs_nest;
+
+	rsp.reset(new tc_getchain_rsp());
+	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
+	yrs.cb = tc_getchain_rsp_parse;
+	yrs.rsp_cmd = RTM_NEWCHAIN;
+
+	err = ynl_exec(ys, nlh, &yrs);
+	if (err < 0)
+		return std::unexpected(ynl_cpp::error(ys));
+
+	return rsp;
+}
+
+ynl_cpp::result<std::unique_ptr<tc_getchain_rsp>>
+tc_getchain_ex(ynl_cpp::ynl_socket&  ys, tc_getchain_req& req,
+	       const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETCHAIN, req._nlmsg_flags);
+	tc_getchain_put(nlh, req);
+
+	return tc_getchain_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<tc_getchain_rsp>
+tc_getchain(ynl_cpp::ynl_socket&  ys, tc_getchain_req& req)
+{
+	auto ret = tc_getchain_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tc_getchain_prepare(ynl_cpp::ynl_socket&  ys, tc_getchain_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_msg_start_req(ys, RTM_GETCHAIN, req._nlmsg_flags);
+	tc_getchain_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh, sizeof(struct tcmsg));
+}
+
+ynl_cpp::result<std::unique_ptr<tc_getchain_rsp>>
+tc_getchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	       const ynl_cpp::projection *proj)
+{
+	return tc_getchain_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<tc_getchain_rsp>
+tc_getchain(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tc_getchain_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+static const struct ynl_mcast_grp tc_mcast_groups[] = {
+	{ "rtnlgrp-tc", 4 },
+};
+
+const struct ynl_family ynl_tc_family =  {
+	.name		= "tc",
+	.hdr_len	= 0,
+	.is_classic	= true,
+	.classic_id	= 0,
+	.mcast_groups	= tc_mcast_groups,
+	.n_mcast_groups	= std::size(tc_mcast_groups),
+};
+const struct ynl_family& get_ynl_tc_family() {
+	return ynl_tc_family;
+};
+} //namespace ynl_cpp
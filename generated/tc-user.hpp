@@ -0,0 +1,1852 @@
+/* SPDX-License-Identifier: ((GPL-2.0 WITH Linux-syscall-note) OR BSD-3-Clause) */
+/* Do not edit directly, auto-generated from: */
+/*	 */
+/* YNL-GEN user header */
+
+#ifndef _LINUX_TC_GEN_H
+#define _LINUX_TC_GEN_H
+
+#include <linux/types.h>
+#include <linux/netlink.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ynl.hpp"
+
+#include <linux/netlink.h>
+
+namespace ynl_cpp {
+/* Definitions */
+enum tc_tc_cls_flags {
+	TC_TC_CLS_FLAGS_SKIP_HW = 1,
+	TC_TC_CLS_FLAGS_SKIP_SW = 2,
+	TC_TC_CLS_FLAGS_IN_HW = 4,
+	TC_TC_CLS_FLAGS_NOT_IN_NW = 8,
+	TC_TC_CLS_FLAGS_VERBOSE = 16,
+};
+
+enum tc_tc_flower_key_ctrl_flags {
+	TC_TC_FLOWER_KEY_CTRL_FLAGS_FRAG = 1,
+	TC_TC_FLOWER_KEY_CTRL_FLAGS_FIRSTFRAG = 2,
+	TC_TC_FLOWER_KEY_CTRL_FLAGS_TUNCSUM = 4,
+	TC_TC_FLOWER_KEY_CTRL_FLAGS_TUNDF = 8,
+	TC_TC_FLOWER_KEY_CTRL_FLAGS_TUNOAM = 16,
+	TC_TC_FLOWER_KEY_CTRL_FLAGS_TUNCRIT = 32,
+};
+
+struct tcmsg {
+	__u8 family;
+	__u8 pad[3];
+	__s32 ifindex;
+	__u32 handle;
+	__u32 parent;
+	__u32 info;
+};
+
+struct tc_stats {
+	__u64 bytes;
+	__u32 packets;
+	__u32 drops;
+	__u32 overlimits;
+	__u32 bps;
+	__u32 pps;
+	__u32 qlen;
+	__u32 backlog;
+};
+
+struct gnet_estimator {
+	__s8 interval;
+	__u8 ewma_log;
+};
+
+struct gnet_stats_basic {
+	__u64 bytes;
+	__u32 packets;
+};
+
+struct gnet_stats_rate_est {
+	__u32 bps;
+	__u32 pps;
+};
+
+struct gnet_stats_queue {
+	__u32 qlen;
+	__u32 backlog;
+	__u32 drops;
+	__u32 requeues;
+	__u32 overlimits;
+};
+
+struct gnet_stats_rate_est64 {
+	__u64 bps;
+	__u64 pps;
+};
+
+struct tcf_t {
+	__u64 install;
+	__u64 lastuse;
+	__u64 expires;
+	__u64 firstuse;
+};
+
+struct tc_mpls {
+	__u32 index;
+	__u32 capab;
+	__s32 action;
+	__s32 refcnt;
+	__s32 bindcnt;
+	__s32 m_action;
+};
+
+struct tc_pedit_key {
+	__u32 mask;
+	__u32 val;
+	__u32 off;
+	__u32 at;
+	__u32 offmask;
+	__u32 shift;
+};
+
+struct tc_pedit_sel {
+	__u32 index;
+	__u32 capab;
+	__s32 action;
+	__s32 refcnt;
+	__s32 bindcnt;
+	__u8 nkeys;
+	__u8 flags;
+	struct tc_pedit_key keys;
+};
+
+struct tc_ratespec {
+	__u8 cell_log;
+	__u8 linklayer;
+	__u8 overhead;
+	__u8 cell_align;
+	__u8 mpu;
+	__u32 rate;
+};
+
+struct tc_police {
+	__u32 index;
+	__s32 action;
+	__u32 limit;
+	__u32 burst;
+	__u32 mtu;
+	struct tc_ratespec rate;
+	struct tc_ratespec peakrate;
+	__s32 refcnt;
+	__s32 bindcnt;
+	__u32 capab;
+};
+
+struct tc_vlan {
+	__u32 index;
+	__u32 capab;
+	__s32 action;
+	__s32 refcnt;
+	__s32 bindcnt;
+	__s32 v_action;
+};
+
+struct tc_basic_pcnt {
+	__u64 rcnt;
+	__u64 rhit;
+};
+
+struct tc_cbs_qopt {
+	__u8 offload;
+	__u8 pad[3];
+	__s32 hicredit;
+	__s32 locredit;
+	__s32 idleslope;
+	__s32 sendslope;
+};
+
+struct tc_red_qopt {
+	__u32 limit;
+	__u32 qth_min;
+	__u32 qth_max;
+	__u8 wlog;
+	__u8 plog;
+	__u8 scell_log;
+	__u8 flags;
+};
+
+struct tcf_ematch_tree_hdr {
+	__u16 nmatches;
+	__u16 progid;
+};
+
+struct tc_gred_sopt {
+	__u32 dps;
+	__u32 def_dp;
+	__u8 grio;
+	__u8 flags;
+	__u8 pad[2];
+};
+
+struct tc_htb_opt {
+	struct tc_ratespec rate;
+	struct tc_ratespec ceil;
+	__u32 buffer;
+	__u32 cbuffer;
+	__u32 quantum;
+	__u32 level;
+	__u32 prio;
+};
+
+struct tc_htb_glob {
+	__u32 version;
+	__u32 rate2quantum;
+	__u32 defcls;
+	__u32 debug;
+	__u32 direct_pkts;
+};
+
+struct tc_matchall_pcnt {
+	__u64 rhit;
+};
+
+struct tc_etf_qopt {
+	__s32 delta;
+	__s32 clockid;
+	__s32 flags;
+};
+
+struct tc_prio_qopt {
+	__u32 bands;
+	__u8 priomap[16];
+};
+
+struct tc_netem_corr {
+	__u32 delay_corr;
+	__u32 loss_corr;
+	__u32 dup_corr;
+};
+
+struct tc_netem_reorder {
+	__u32 probability;
+	__u32 correlation;
+};
+
+struct tc_netem_corrupt {
+	__u32 probability;
+	__u32 correlation;
+};
+
+struct tc_netem_rate {
+	__u32 rate;
+	__s32 packet_overhead;
+	__u32 cell_size;
+	__s32 cell_overhead;
+};
+
+struct tc_netem_slot {
+	__s64 min_delay;
+	__s64 max_delay;
+	__s32 max_packets;
+	__s32 max_bytes;
+	__s64 dist_delay;
+	__s64 dist_jitter;
+};
+
+struct tc_netem_gimodel {
+	__u32 p13;
+	__u32 p31;
+	__u32 p32;
+	__u32 p14;
+	__u32 p23;
+};
+
+struct tc_netem_gemodel {
+	__u32 p;
+	__u32 r;
+	__u32 h;
+	__u32 k1;
+};
+
+struct tc_mqprio_qopt {
+	__u8 num_tc;
+	__u8 prio_tc_map[16];
+	__u8 hw;
+	__u8 count[32];
+	__u8 offset[32];
+};
+
+struct tc_tbf_qopt {
+	struct tc_ratespec rate;
+	struct tc_ratespec peakrate;
+	__u32 limit;
+	__u32 buffer;
+	__u32 mtu;
+};
+
+struct tc_gen_parms {
+	__u32 index;
+	__u32 capab;
+	__s32 action;
+	__s32 refcnt;
+	__s32 bindcnt;
+};
+
+struct tc_gact_p {
+	__u16 ptype;
+	__u16 pval;
+	__s32 paction;
+};
+
+struct tc_sizespec {
+	__u8 cell_log;
+	__u8 size_log;
+	__s16 cell_align;
+	__s32 overhead;
+	__u32 linklayer;
+	__u32 mpu;
+	__u32 mtu;
+	__u32 tsize;
+};
+
+struct tc_u32_key {
+	__be32 mask;
+	__be32 val;
+	__s32 off;
+	__s32 offmask;
+};
+
+struct tc_u32_sel {
+	__u8 flags;
+	__u8 offshift;
+	__u8 nkeys;
+	__be16 offmask;
+	__u16 off;
+	__s16 offoff;
+	__s16 hoff;
+	__be32 hmask;
+	struct tc_u32_key keys;
+};
+
+struct tc_u32_pcnt {
+	__u64 rcnt;
+	__u64 rhit;
+	__u64 kcnts;
+};
+
+struct tc_u32_mark {
+	__u32 val;
+	__u32 mask;
+	__u32 success;
+};
+
+struct tc_fifo_qopt {
+	__u32 limit;
+};
+
+struct tc_hfsc_qopt {
+	__u16 defcls;
+};
+
+struct tc_multiq_qopt {
+	__u16 bands;
+	__u16 max_bands;
+};
+
+struct tc_netem_qopt {
+	__u32 latency;
+	__u32 limit;
+	__u32 loss;
+	__u32 gap;
+	__u32 duplicate;
+	__u32 jitter;
+};
+
+struct tc_plug_qopt {
+	__s32 action;
+	__u32 limit;
+};
+
+struct tc_sfb_qopt {
+	__u32 rehash_interval;
+	__u32 warmup_time;
+	__u32 max;
+	__u32 bin_size;
+	__u32 increment;
+	__u32 decrement;
+	__u32 limit;
+	__u32 penalty_rate;
+	__u32 penalty_burst;
+};
+
+struct tc_sfq_qopt {
+	__u32 quantum;
+	__s32 perturb_period;
+	__u32 limit;
+	__u32 divisor;
+	__u32 flows;
+};
+
+struct tc_sfqred_stats {
+	__u32 prob_drop;
+	__u32 forced_drop;
+	__u32 prob_mark;
+	__u32 forced_mark;
+	__u32 prob_mark_head;
+	__u32 forced_mark_head;
+};
+
+struct tc_sfq_qopt_v1 {
+	struct tc_sfq_qopt v0;
+	__u32 depth;
+	__u32 headdrop;
+	__u32 limit;
+	__u32 qth_min;
+	__u32 qth_max;
+	__u8 wlog;
+	__u8 plog;
+	__u8 scell_log;
+	__u8 flags;
+	__u32 max_p;
+	struct tc_sfqred_stats stats;
+};
+
+struct tc_choke_xstats {
+	__u32 early;
+	__u32 pdrop;
+	__u32 other;
+	__u32 marked;
+	__u32 matched;
+};
+
+struct tc_codel_xstats {
+	__u32 maxpacket;
+	__u32 count;
+	__u32 lastcount;
+	__u32 ldelay;
+	__s32 drop_next;
+	__u32 drop_overlimit;
+	__u32 ecn_mark;
+	__u32 dropping;
+	__u32 ce_mark;
+};
+
+struct tc_fq_qd_stats {
+	__u64 gc_flows;
+	__u64 highprio_packets;
+	__u64 tcp_retrans;
+	__u64 throttled;
+	__u64 flows_plimit;
+	__u64 pkts_too_long;
+	__u64 allocation_errors;
+	__s64 time_next_delayed_flow;
+	__u32 flows;
+	__u32 inactive_flows;
+	__u32 throttled_flows;
+	__u32 unthrottle_latency_ns;
+	__u64 ce_mark;
+	__u64 horizon_drops;
+	__u64 horizon_caps;
+	__u64 fastpath_packets;
+	__u8 band_drops[24];
+	__u8 band_pkt_count[12];
+	__u8 pad[4];
+};
+
+struct tc_fq_codel_xstats {
+	__u32 type;
+	__u32 maxpacket;
+	__u32 drop_overlimit;
+	__u32 ecn_mark;
+	__u32 new_flow_count;
+	__u32 new_flows_len;
+	__u32 old_flows_len;
+	__u32 ce_mark;
+	__u32 memory_usage;
+	__u32 drop_overmemory;
+};
+
+struct tc_fq_pie_xstats {
+	__u32 packets_in;
+	__u32 dropped;
+	__u32 overlimit;
+	__u32 overmemory;
+	__u32 ecn_mark;
+	__u32 new_flow_count;
+	__u32 new_flows_len;
+	__u32 old_flows_len;
+	__u32 memory_usage;
+};
+
+struct tc_hhf_xstats {
+	__u32 drop_overlimit;
+	__u32 hh_overlimit;
+	__u32 hh_tot_count;
+	__u32 hh_cur_count;
+};
+
+struct tc_pie_xstats {
+	__u64 prob;
+	__u32 delay;
+	__u32 avg_dq_rate;
+	__u32 dq_rate_estimating;
+	__u32 packets_in;
+	__u32 dropped;
+	__u32 overlimit;
+	__u32 maxq;
+	__u32 ecn_mark;
+};
+
+struct tc_red_xstats {
+	__u32 early;
+	__u32 pdrop;
+	__u32 other;
+	__u32 marked;
+};
+
+struct tc_sfb_xstats {
+	__u32 earlydrop;
+	__u32 penaltydrop;
+	__u32 bucketdrop;
+	__u32 queuedrop;
+	__u32 childdrop;
+	__u32 marked;
+	__u32 maxqlen;
+	__u32 maxprob;
+	__u32 avgprob;
+};
+
+struct tc_sfq_xstats {
+	__s32 allot;
+};
+
+/* Attributes */
+enum {
+	TC_A_TC_ATTRS_KIND = 1,
+	TC_A_TC_ATTRS_OPTIONS = 2,
+	TC_A_TC_ATTRS_STATS = 3,
+	TC_A_TC_ATTRS_XSTATS = 4,
+	TC_A_TC_ATTRS_RATE = 5,
+	TC_A_TC_ATTRS_FCNT = 6,
+	TC_A_TC_ATTRS_STATS2 = 7,
+	TC_A_TC_ATTRS_STAB = 8,
+	TC_A_TC_ATTRS_PAD = 9,
+	TC_A_TC_ATTRS_DUMP_INVISIBLE = 10,
+	TC_A_TC_ATTRS_CHAIN = 11,
+	TC_A_TC_ATTRS_HW_OFFLOAD = 12,
+	TC_A_TC_ATTRS_INGRESS_BLOCK = 13,
+	TC_A_TC_ATTRS_EGRESS_BLOCK = 14,
+	TC_A_TC_ATTRS_DUMP_FLAGS = 15,
+	TC_A_TC_ATTRS_EXT_WARN_MSG = 16,
+};
+
+enum {
+	TC_A_TC_ACT_ATTRS_KIND = 1,
+	TC_A_TC_ACT_ATTRS_OPTIONS = 2,
+	TC_A_TC_ACT_ATTRS_INDEX = 3,
+	TC_A_TC_ACT_ATTRS_STATS = 4,
+	TC_A_TC_ACT_ATTRS_PAD = 5,
+	TC_A_TC_ACT_ATTRS_COOKIE = 6,
+	TC_A_TC_ACT_ATTRS_FLAGS = 7,
+	TC_A_TC_ACT_ATTRS_HW_STATS = 8,
+	TC_A_TC_ACT_ATTRS_USED_HW_STATS = 9,
+	TC_A_TC_ACT_ATTRS_IN_HW_COUNT = 10,
+};
+
+enum {
+	TC_A_TC_ACT_STATS_ATTRS_BASIC = 1,
+	TC_A_TC_ACT_STATS_ATTRS_RATE_EST = 2,
+	TC_A_TC_ACT_STATS_ATTRS_QUEUE = 3,
+	TC_A_TC_ACT_STATS_ATTRS_APP = 4,
+	TC_A_TC_ACT_STATS_ATTRS_RATE_EST64 = 5,
+	TC_A_TC_ACT_STATS_ATTRS_PAD = 6,
+	TC_A_TC_ACT_STATS_ATTRS_BASIC_HW = 7,
+	TC_A_TC_ACT_STATS_ATTRS_PKT64 = 8,
+};
+
+enum {
+	TC_A_TC_ACT_BPF_ATTRS_TM = 1,
+	TC_A_TC_ACT_BPF_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_BPF_ATTRS_OPS_LEN = 3,
+	TC_A_TC_ACT_BPF_ATTRS_OPS = 4,
+	TC_A_TC_ACT_BPF_ATTRS_FD = 5,
+	TC_A_TC_ACT_BPF_ATTRS_NAME = 6,
+	TC_A_TC_ACT_BPF_ATTRS_PAD = 7,
+	TC_A_TC_ACT_BPF_ATTRS_TAG = 8,
+	TC_A_TC_ACT_BPF_ATTRS_ID = 9,
+};
+
+enum {
+	TC_A_TC_ACT_CONNMARK_ATTRS_PARMS = 1,
+	TC_A_TC_ACT_CONNMARK_ATTRS_TM = 2,
+	TC_A_TC_ACT_CONNMARK_ATTRS_PAD = 3,
+};
+
+enum {
+	TC_A_TC_ACT_CSUM_ATTRS_PARMS = 1,
+	TC_A_TC_ACT_CSUM_ATTRS_TM = 2,
+	TC_A_TC_ACT_CSUM_ATTRS_PAD = 3,
+};
+
+enum {
+	TC_A_TC_ACT_CT_ATTRS_PARMS = 1,
+	TC_A_TC_ACT_CT_ATTRS_TM = 2,
+	TC_A_TC_ACT_CT_ATTRS_ACTION = 3,
+	TC_A_TC_ACT_CT_ATTRS_ZONE = 4,
+	TC_A_TC_ACT_CT_ATTRS_MARK = 5,
+	TC_A_TC_ACT_CT_ATTRS_MARK_MASK = 6,
+	TC_A_TC_ACT_CT_ATTRS_LABELS = 7,
+	TC_A_TC_ACT_CT_ATTRS_LABELS_MASK = 8,
+	TC_A_TC_ACT_CT_ATTRS_NAT_IPV4_MIN = 9,
+	TC_A_TC_ACT_CT_ATTRS_NAT_IPV4_MAX = 10,
+	TC_A_TC_ACT_CT_ATTRS_NAT_IPV6_MIN = 11,
+	TC_A_TC_ACT_CT_ATTRS_NAT_IPV6_MAX = 12,
+	TC_A_TC_ACT_CT_ATTRS_NAT_PORT_MIN = 13,
+	TC_A_TC_ACT_CT_ATTRS_NAT_PORT_MAX = 14,
+	TC_A_TC_ACT_CT_ATTRS_PAD = 15,
+	TC_A_TC_ACT_CT_ATTRS_HELPER_NAME = 16,
+	TC_A_TC_ACT_CT_ATTRS_HELPER_FAMILY = 17,
+	TC_A_TC_ACT_CT_ATTRS_HELPER_PROTO = 18,
+};
+
+enum {
+	TC_A_TC_ACT_CTINFO_ATTRS_PAD = 1,
+	TC_A_TC_ACT_CTINFO_ATTRS_TM = 2,
+	TC_A_TC_ACT_CTINFO_ATTRS_ACT = 3,
+	TC_A_TC_ACT_CTINFO_ATTRS_ZONE = 4,
+	TC_A_TC_ACT_CTINFO_ATTRS_PARMS_DSCP_MASK = 5,
+	TC_A_TC_ACT_CTINFO_ATTRS_PARMS_DSCP_STATEMASK = 6,
+	TC_A_TC_ACT_CTINFO_ATTRS_PARMS_CPMARK_MASK = 7,
+	TC_A_TC_ACT_CTINFO_ATTRS_STATS_DSCP_SET = 8,
+	TC_A_TC_ACT_CTINFO_ATTRS_STATS_DSCP_ERROR = 9,
+	TC_A_TC_ACT_CTINFO_ATTRS_STATS_CPMARK_SET = 10,
+};
+
+enum {
+	TC_A_TC_ACT_GATE_ATTRS_TM = 1,
+	TC_A_TC_ACT_GATE_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_GATE_ATTRS_PAD = 3,
+	TC_A_TC_ACT_GATE_ATTRS_PRIORITY = 4,
+	TC_A_TC_ACT_GATE_ATTRS_ENTRY_LIST = 5,
+	TC_A_TC_ACT_GATE_ATTRS_BASE_TIME = 6,
+	TC_A_TC_ACT_GATE_ATTRS_CYCLE_TIME = 7,
+	TC_A_TC_ACT_GATE_ATTRS_CYCLE_TIME_EXT = 8,
+	TC_A_TC_ACT_GATE_ATTRS_FLAGS = 9,
+	TC_A_TC_ACT_GATE_ATTRS_CLOCKID = 10,
+};
+
+enum {
+	TC_A_TC_ACT_IFE_ATTRS_PARMS = 1,
+	TC_A_TC_ACT_IFE_ATTRS_TM = 2,
+	TC_A_TC_ACT_IFE_ATTRS_DMAC = 3,
+	TC_A_TC_ACT_IFE_ATTRS_SMAC = 4,
+	TC_A_TC_ACT_IFE_ATTRS_TYPE = 5,
+	TC_A_TC_ACT_IFE_ATTRS_METALST = 6,
+	TC_A_TC_ACT_IFE_ATTRS_PAD = 7,
+};
+
+enum {
+	TC_A_TC_ACT_MIRRED_ATTRS_TM = 1,
+	TC_A_TC_ACT_MIRRED_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_MIRRED_ATTRS_PAD = 3,
+	TC_A_TC_ACT_MIRRED_ATTRS_BLOCKID = 4,
+};
+
+enum {
+	TC_A_TC_ACT_MPLS_ATTRS_TM = 1,
+	TC_A_TC_ACT_MPLS_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_MPLS_ATTRS_PAD = 3,
+	TC_A_TC_ACT_MPLS_ATTRS_PROTO = 4,
+	TC_A_TC_ACT_MPLS_ATTRS_LABEL = 5,
+	TC_A_TC_ACT_MPLS_ATTRS_TC = 6,
+	TC_A_TC_ACT_MPLS_ATTRS_TTL = 7,
+	TC_A_TC_ACT_MPLS_ATTRS_BOS = 8,
+};
+
+enum {
+	TC_A_TC_ACT_NAT_ATTRS_PARMS = 1,
+	TC_A_TC_ACT_NAT_ATTRS_TM = 2,
+	TC_A_TC_ACT_NAT_ATTRS_PAD = 3,
+};
+
+enum {
+	TC_A_TC_ACT_PEDIT_ATTRS_TM = 1,
+	TC_A_TC_ACT_PEDIT_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_PEDIT_ATTRS_PAD = 3,
+	TC_A_TC_ACT_PEDIT_ATTRS_PARMS_EX = 4,
+	TC_A_TC_ACT_PEDIT_ATTRS_KEYS_EX = 5,
+	TC_A_TC_ACT_PEDIT_ATTRS_KEY_EX = 6,
+};
+
+enum {
+	TC_A_TC_ACT_POLICE_ATTRS_TBF = 1,
+	TC_A_TC_ACT_POLICE_ATTRS_RATE = 2,
+	TC_A_TC_ACT_POLICE_ATTRS_PEAKRATE = 3,
+	TC_A_TC_ACT_POLICE_ATTRS_AVRATE = 4,
+	TC_A_TC_ACT_POLICE_ATTRS_RESULT = 5,
+	TC_A_TC_ACT_POLICE_ATTRS_TM = 6,
+	TC_A_TC_ACT_POLICE_ATTRS_PAD = 7,
+	TC_A_TC_ACT_POLICE_ATTRS_RATE64 = 8,
+	TC_A_TC_ACT_POLICE_ATTRS_PEAKRATE64 = 9,
+	TC_A_TC_ACT_POLICE_ATTRS_PKTRATE64 = 10,
+	TC_A_TC_ACT_POLICE_ATTRS_PKTBURST64 = 11,
+};
+
+enum {
+	TC_A_TC_ACT_SIMPLE_ATTRS_TM = 1,
+	TC_A_TC_ACT_SIMPLE_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_SIMPLE_ATTRS_DATA = 3,
+	TC_A_TC_ACT_SIMPLE_ATTRS_PAD = 4,
+};
+
+enum {
+	TC_A_TC_ACT_SKBEDIT_ATTRS_TM = 1,
+	TC_A_TC_ACT_SKBEDIT_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_SKBEDIT_ATTRS_PRIORITY = 3,
+	TC_A_TC_ACT_SKBEDIT_ATTRS_QUEUE_MAPPING = 4,
+	TC_A_TC_ACT_SKBEDIT_ATTRS_MARK = 5,
+	TC_A_TC_ACT_SKBEDIT_ATTRS_PAD = 6,
+	TC_A_TC_ACT_SKBEDIT_ATTRS_PTYPE = 7,
+	TC_A_TC_ACT_SKBEDIT_ATTRS_MASK = 8,
+	TC_A_TC_ACT_SKBEDIT_ATTRS_FLAGS = 9,
+	TC_A_TC_ACT_SKBEDIT_ATTRS_QUEUE_MAPPING_MAX = 10,
+};
+
+enum {
+	TC_A_TC_ACT_SKBMOD_ATTRS_TM = 1,
+	TC_A_TC_ACT_SKBMOD_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_SKBMOD_ATTRS_DMAC = 3,
+	TC_A_TC_ACT_SKBMOD_ATTRS_SMAC = 4,
+	TC_A_TC_ACT_SKBMOD_ATTRS_ETYPE = 5,
+	TC_A_TC_ACT_SKBMOD_ATTRS_PAD = 6,
+};
+
+enum {
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_TM = 1,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_ENC_IPV4_SRC = 3,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_ENC_IPV4_DST = 4,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_ENC_IPV6_SRC = 5,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_ENC_IPV6_DST = 6,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_ENC_KEY_ID = 7,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_PAD = 8,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_ENC_DST_PORT = 9,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_NO_CSUM = 10,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_ENC_OPTS = 11,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_ENC_TOS = 12,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_ENC_TTL = 13,
+	TC_A_TC_ACT_TUNNEL_KEY_ATTRS_NO_FRAG = 14,
+};
+
+enum {
+	TC_A_TC_ACT_VLAN_ATTRS_TM = 1,
+	TC_A_TC_ACT_VLAN_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_VLAN_ATTRS_PUSH_VLAN_ID = 3,
+	TC_A_TC_ACT_VLAN_ATTRS_PUSH_VLAN_PROTOCOL = 4,
+	TC_A_TC_ACT_VLAN_ATTRS_PAD = 5,
+	TC_A_TC_ACT_VLAN_ATTRS_PUSH_VLAN_PRIORITY = 6,
+	TC_A_TC_ACT_VLAN_ATTRS_PUSH_ETH_DST = 7,
+	TC_A_TC_ACT_VLAN_ATTRS_PUSH_ETH_SRC = 8,
+};
+
+enum {
+	TC_A_TC_BASIC_ATTRS_CLASSID = 1,
+	TC_A_TC_BASIC_ATTRS_EMATCHES = 2,
+	TC_A_TC_BASIC_ATTRS_ACT = 3,
+	TC_A_TC_BASIC_ATTRS_POLICE = 4,
+	TC_A_TC_BASIC_ATTRS_PCNT = 5,
+	TC_A_TC_BASIC_ATTRS_PAD = 6,
+};
+
+enum {
+	TC_A_TC_BPF_ATTRS_ACT = 1,
+	TC_A_TC_BPF_ATTRS_POLICE = 2,
+	TC_A_TC_BPF_ATTRS_CLASSID = 3,
+	TC_A_TC_BPF_ATTRS_OPS_LEN = 4,
+	TC_A_TC_BPF_ATTRS_OPS = 5,
+	TC_A_TC_BPF_ATTRS_FD = 6,
+	TC_A_TC_BPF_ATTRS_NAME = 7,
+	TC_A_TC_BPF_ATTRS_FLAGS = 8,
+	TC_A_TC_BPF_ATTRS_FLAGS_GEN = 9,
+	TC_A_TC_BPF_ATTRS_TAG = 10,
+	TC_A_TC_BPF_ATTRS_ID = 11,
+};
+
+enum {
+	TC_A_TC_CAKE_ATTRS_PAD = 1,
+	TC_A_TC_CAKE_ATTRS_BASE_RATE64 = 2,
+	TC_A_TC_CAKE_ATTRS_DIFFSERV_MODE = 3,
+	TC_A_TC_CAKE_ATTRS_ATM = 4,
+	TC_A_TC_CAKE_ATTRS_FLOW_MODE = 5,
+	TC_A_TC_CAKE_ATTRS_OVERHEAD = 6,
+	TC_A_TC_CAKE_ATTRS_RTT = 7,
+	TC_A_TC_CAKE_ATTRS_TARGET = 8,
+	TC_A_TC_CAKE_ATTRS_AUTORATE = 9,
+	TC_A_TC_CAKE_ATTRS_MEMORY = 10,
+	TC_A_TC_CAKE_ATTRS_NAT = 11,
+	TC_A_TC_CAKE_ATTRS_RAW = 12,
+	TC_A_TC_CAKE_ATTRS_WASH = 13,
+	TC_A_TC_CAKE_ATTRS_MPU = 14,
+	TC_A_TC_CAKE_ATTRS_INGRESS = 15,
+	TC_A_TC_CAKE_ATTRS_ACK_FILTER = 16,
+	TC_A_TC_CAKE_ATTRS_SPLIT_GSO = 17,
+	TC_A_TC_CAKE_ATTRS_FWMARK = 18,
+};
+
+enum {
+	TC_A_TC_CAKE_STATS_ATTRS_PAD = 1,
+	TC_A_TC_CAKE_STATS_ATTRS_CAPACITY_ESTIMATE64 = 2,
+	TC_A_TC_CAKE_STATS_ATTRS_MEMORY_LIMIT = 3,
+	TC_A_TC_CAKE_STATS_ATTRS_MEMORY_USED = 4,
+	TC_A_TC_CAKE_STATS_ATTRS_AVG_NETOFF = 5,
+	TC_A_TC_CAKE_STATS_ATTRS_MIN_NETLEN = 6,
+	TC_A_TC_CAKE_STATS_ATTRS_MAX_NETLEN = 7,
+	TC_A_TC_CAKE_STATS_ATTRS_MIN_ADJLEN = 8,
+	TC_A_TC_CAKE_STATS_ATTRS_MAX_ADJLEN = 9,
+	TC_A_TC_CAKE_STATS_ATTRS_TIN_STATS = 10,
+	TC_A_TC_CAKE_STATS_ATTRS_DEFICIT = 11,
+	TC_A_TC_CAKE_STATS_ATTRS_COBALT_COUNT = 12,
+	TC_A_TC_CAKE_STATS_ATTRS_DROPPING = 13,
+	TC_A_TC_CAKE_STATS_ATTRS_DROP_NEXT_US = 14,
+	TC_A_TC_CAKE_STATS_ATTRS_P_DROP = 15,
+	TC_A_TC_CAKE_STATS_ATTRS_BLUE_TIMER_US = 16,
+};
+
+enum {
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_PAD = 1,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_SENT_PACKETS = 2,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_SENT_BYTES64 = 3,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_DROPPED_PACKETS = 4,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_DROPPED_BYTES64 = 5,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_ACKS_DROPPED_PACKETS = 6,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_ACKS_DROPPED_BYTES64 = 7,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_ECN_MARKED_PACKETS = 8,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_ECN_MARKED_BYTES64 = 9,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_BACKLOG_PACKETS = 10,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_BACKLOG_BYTES = 11,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_THRESHOLD_RATE64 = 12,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_TARGET_US = 13,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_INTERVAL_US = 14,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_WAY_INDIRECT_HITS = 15,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_WAY_MISSES = 16,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_WAY_COLLISIONS = 17,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_PEAK_DELAY_US = 18,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_AVG_DELAY_US = 19,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_BASE_DELAY_US = 20,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_SPARSE_FLOWS = 21,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_BULK_FLOWS = 22,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_UNRESPONSIVE_FLOWS = 23,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_MAX_SKBLEN = 24,
+	TC_A_TC_CAKE_TIN_STATS_ATTRS_FLOW_QUANTUM = 25,
+};
+
+enum {
+	TC_A_TC_CBS_ATTRS_PARMS = 1,
+};
+
+enum {
+	TC_A_TC_CGROUP_ATTRS_ACT = 1,
+	TC_A_TC_CGROUP_ATTRS_POLICE = 2,
+	TC_A_TC_CGROUP_ATTRS_EMATCHES = 3,
+};
+
+enum {
+	TC_A_TC_CHOKE_ATTRS_PARMS = 1,
+	TC_A_TC_CHOKE_ATTRS_STAB = 2,
+	TC_A_TC_CHOKE_ATTRS_MAX_P = 3,
+};
+
+enum {
+	TC_A_TC_CODEL_ATTRS_TARGET = 1,
+	TC_A_TC_CODEL_ATTRS_LIMIT = 2,
+	TC_A_TC_CODEL_ATTRS_INTERVAL = 3,
+	TC_A_TC_CODEL_ATTRS_ECN = 4,
+	TC_A_TC_CODEL_ATTRS_CE_THRESHOLD = 5,
+};
+
+enum {
+	TC_A_TC_DRR_ATTRS_QUANTUM = 1,
+};
+
+enum {
+	TC_A_TC_EMATCH_ATTRS_TREE_HDR = 1,
+	TC_A_TC_EMATCH_ATTRS_TREE_LIST = 2,
+};
+
+enum {
+	TC_A_TC_FLOW_ATTRS_KEYS = 1,
+	TC_A_TC_FLOW_ATTRS_MODE = 2,
+	TC_A_TC_FLOW_ATTRS_BASECLASS = 3,
+	TC_A_TC_FLOW_ATTRS_RSHIFT = 4,
+	TC_A_TC_FLOW_ATTRS_ADDEND = 5,
+	TC_A_TC_FLOW_ATTRS_MASK = 6,
+	TC_A_TC_FLOW_ATTRS_XOR = 7,
+	TC_A_TC_FLOW_ATTRS_DIVISOR = 8,
+	TC_A_TC_FLOW_ATTRS_ACT = 9,
+	TC_A_TC_FLOW_ATTRS_POLICE = 10,
+	TC_A_TC_FLOW_ATTRS_EMATCHES = 11,
+	TC_A_TC_FLOW_ATTRS_PERTURB = 12,
+};
+
+enum {
+	TC_A_TC_FLOWER_ATTRS_CLASSID = 1,
+	TC_A_TC_FLOWER_ATTRS_INDEV = 2,
+	TC_A_TC_FLOWER_ATTRS_ACT = 3,
+	TC_A_TC_FLOWER_ATTRS_KEY_ETH_DST = 4,
+	TC_A_TC_FLOWER_ATTRS_KEY_ETH_DST_MASK = 5,
+	TC_A_TC_FLOWER_ATTRS_KEY_ETH_SRC = 6,
+	TC_A_TC_FLOWER_ATTRS_KEY_ETH_SRC_MASK = 7,
+	TC_A_TC_FLOWER_ATTRS_KEY_ETH_TYPE = 8,
+	TC_A_TC_FLOWER_ATTRS_KEY_IP_PROTO = 9,
+	TC_A_TC_FLOWER_ATTRS_KEY_IPV4_SRC = 10,
+	TC_A_TC_FLOWER_ATTRS_KEY_IPV4_SRC_MASK = 11,
+	TC_A_TC_FLOWER_ATTRS_KEY_IPV4_DST = 12,
+	TC_A_TC_FLOWER_ATTRS_KEY_IPV4_DST_MASK = 13,
+	TC_A_TC_FLOWER_ATTRS_KEY_IPV6_SRC = 14,
+	TC_A_TC_FLOWER_ATTRS_KEY_IPV6_SRC_MASK = 15,
+	TC_A_TC_FLOWER_ATTRS_KEY_IPV6_DST = 16,
+	TC_A_TC_FLOWER_ATTRS_KEY_IPV6_DST_MASK = 17,
+	TC_A_TC_FLOWER_ATTRS_KEY_TCP_SRC = 18,
+	TC_A_TC_FLOWER_ATTRS_KEY_TCP_DST = 19,
+	TC_A_TC_FLOWER_ATTRS_KEY_UDP_SRC = 20,
+	TC_A_TC_FLOWER_ATTRS_KEY_UDP_DST = 21,
+	TC_A_TC_FLOWER_ATTRS_FLAGS = 22,
+	TC_A_TC_FLOWER_ATTRS_KEY_VLAN_ID = 23,
+	TC_A_TC_FLOWER_ATTRS_KEY_VLAN_PRIO = 24,
+	TC_A_TC_FLOWER_ATTRS_KEY_VLAN_ETH_TYPE = 25,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_KEY_ID = 26,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IPV4_SRC = 27,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IPV4_SRC_MASK = 28,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IPV4_DST = 29,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IPV4_DST_MASK = 30,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IPV6_SRC = 31,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IPV6_SRC_MASK = 32,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IPV6_DST = 33,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IPV6_DST_MASK = 34,
+	TC_A_TC_FLOWER_ATTRS_KEY_TCP_SRC_MASK = 35,
+	TC_A_TC_FLOWER_ATTRS_KEY_TCP_DST_MASK = 36,
+	TC_A_TC_FLOWER_ATTRS_KEY_UDP_SRC_MASK = 37,
+	TC_A_TC_FLOWER_ATTRS_KEY_UDP_DST_MASK = 38,
+	TC_A_TC_FLOWER_ATTRS_KEY_SCTP_SRC_MASK = 39,
+	TC_A_TC_FLOWER_ATTRS_KEY_SCTP_DST_MASK = 40,
+	TC_A_TC_FLOWER_ATTRS_KEY_SCTP_SRC = 41,
+	TC_A_TC_FLOWER_ATTRS_KEY_SCTP_DST = 42,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_UDP_SRC_PORT = 43,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_UDP_SRC_PORT_MASK = 44,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_UDP_DST_PORT = 45,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_UDP_DST_PORT_MASK = 46,
+	TC_A_TC_FLOWER_ATTRS_KEY_FLAGS = 47,
+	TC_A_TC_FLOWER_ATTRS_KEY_FLAGS_MASK = 48,
+	TC_A_TC_FLOWER_ATTRS_KEY_ICMPV4_CODE = 49,
+	TC_A_TC_FLOWER_ATTRS_KEY_ICMPV4_CODE_MASK = 50,
+	TC_A_TC_FLOWER_ATTRS_KEY_ICMPV4_TYPE = 51,
+	TC_A_TC_FLOWER_ATTRS_KEY_ICMPV4_TYPE_MASK = 52,
+	TC_A_TC_FLOWER_ATTRS_KEY_ICMPV6_CODE = 53,
+	TC_A_TC_FLOWER_ATTRS_KEY_ICMPV6_CODE_MASK = 54,
+	TC_A_TC_FLOWER_ATTRS_KEY_ICMPV6_TYPE = 55,
+	TC_A_TC_FLOWER_ATTRS_KEY_ICMPV6_TYPE_MASK = 56,
+	TC_A_TC_FLOWER_ATTRS_KEY_ARP_SIP = 57,
+	TC_A_TC_FLOWER_ATTRS_KEY_ARP_SIP_MASK = 58,
+	TC_A_TC_FLOWER_ATTRS_KEY_ARP_TIP = 59,
+	TC_A_TC_FLOWER_ATTRS_KEY_ARP_TIP_MASK = 60,
+	TC_A_TC_FLOWER_ATTRS_KEY_ARP_OP = 61,
+	TC_A_TC_FLOWER_ATTRS_KEY_ARP_OP_MASK = 62,
+	TC_A_TC_FLOWER_ATTRS_KEY_ARP_SHA = 63,
+	TC_A_TC_FLOWER_ATTRS_KEY_ARP_SHA_MASK = 64,
+	TC_A_TC_FLOWER_ATTRS_KEY_ARP_THA = 65,
+	TC_A_TC_FLOWER_ATTRS_KEY_ARP_THA_MASK = 66,
+	TC_A_TC_FLOWER_ATTRS_KEY_MPLS_TTL = 67,
+	TC_A_TC_FLOWER_ATTRS_KEY_MPLS_BOS = 68,
+	TC_A_TC_FLOWER_ATTRS_KEY_MPLS_TC = 69,
+	TC_A_TC_FLOWER_ATTRS_KEY_MPLS_LABEL = 70,
+	TC_A_TC_FLOWER_ATTRS_KEY_TCP_FLAGS = 71,
+	TC_A_TC_FLOWER_ATTRS_KEY_TCP_FLAGS_MASK = 72,
+	TC_A_TC_FLOWER_ATTRS_KEY_IP_TOS = 73,
+	TC_A_TC_FLOWER_ATTRS_KEY_IP_TOS_MASK = 74,
+	TC_A_TC_FLOWER_ATTRS_KEY_IP_TTL = 75,
+	TC_A_TC_FLOWER_ATTRS_KEY_IP_TTL_MASK = 76,
+	TC_A_TC_FLOWER_ATTRS_KEY_CVLAN_ID = 77,
+	TC_A_TC_FLOWER_ATTRS_KEY_CVLAN_PRIO = 78,
+	TC_A_TC_FLOWER_ATTRS_KEY_CVLAN_ETH_TYPE = 79,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IP_TOS = 80,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IP_TOS_MASK = 81,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IP_TTL = 82,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_IP_TTL_MASK = 83,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_OPTS = 84,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_OPTS_MASK = 85,
+	TC_A_TC_FLOWER_ATTRS_IN_HW_COUNT = 86,
+	TC_A_TC_FLOWER_ATTRS_KEY_PORT_SRC_MIN = 87,
+	TC_A_TC_FLOWER_ATTRS_KEY_PORT_SRC_MAX = 88,
+	TC_A_TC_FLOWER_ATTRS_KEY_PORT_DST_MIN = 89,
+	TC_A_TC_FLOWER_ATTRS_KEY_PORT_DST_MAX = 90,
+	TC_A_TC_FLOWER_ATTRS_KEY_CT_STATE = 91,
+	TC_A_TC_FLOWER_ATTRS_KEY_CT_STATE_MASK = 92,
+	TC_A_TC_FLOWER_ATTRS_KEY_CT_ZONE = 93,
+	TC_A_TC_FLOWER_ATTRS_KEY_CT_ZONE_MASK = 94,
+	TC_A_TC_FLOWER_ATTRS_KEY_CT_MARK = 95,
+	TC_A_TC_FLOWER_ATTRS_KEY_CT_MARK_MASK = 96,
+	TC_A_TC_FLOWER_ATTRS_KEY_CT_LABELS = 97,
+	TC_A_TC_FLOWER_ATTRS_KEY_CT_LABELS_MASK = 98,
+	TC_A_TC_FLOWER_ATTRS_KEY_MPLS_OPTS = 99,
+	TC_A_TC_FLOWER_ATTRS_KEY_HASH = 100,
+	TC_A_TC_FLOWER_ATTRS_KEY_HASH_MASK = 101,
+	TC_A_TC_FLOWER_ATTRS_KEY_NUM_OF_VLANS = 102,
+	TC_A_TC_FLOWER_ATTRS_KEY_PPPOE_SID = 103,
+	TC_A_TC_FLOWER_ATTRS_KEY_PPP_PROTO = 104,
+	TC_A_TC_FLOWER_ATTRS_KEY_L2_TPV3_SID = 105,
+	TC_A_TC_FLOWER_ATTRS_L2_MISS = 106,
+	TC_A_TC_FLOWER_ATTRS_KEY_CFM = 107,
+	TC_A_TC_FLOWER_ATTRS_KEY_SPI = 108,
+	TC_A_TC_FLOWER_ATTRS_KEY_SPI_MASK = 109,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_FLAGS = 110,
+	TC_A_TC_FLOWER_ATTRS_KEY_ENC_FLAGS_MASK = 111,
+};
+
+enum {
+	TC_A_TC_FLOWER_KEY_ENC_OPTS_ATTRS_GENEVE = 1,
+	TC_A_TC_FLOWER_KEY_ENC_OPTS_ATTRS_VXLAN = 2,
+	TC_A_TC_FLOWER_KEY_ENC_OPTS_ATTRS_ERSPAN = 3,
+	TC_A_TC_FLOWER_KEY_ENC_OPTS_ATTRS_GTP = 4,
+};
+
+enum {
+	TC_A_TC_FLOWER_KEY_ENC_OPT_GENEVE_ATTRS_CLASS = 1,
+	TC_A_TC_FLOWER_KEY_ENC_OPT_GENEVE_ATTRS_TYPE = 2,
+	TC_A_TC_FLOWER_KEY_ENC_OPT_GENEVE_ATTRS_DATA = 3,
+};
+
+enum {
+	TC_A_TC_FLOWER_KEY_ENC_OPT_VXLAN_ATTRS_GBP = 1,
+};
+
+enum {
+	TC_A_TC_FLOWER_KEY_ENC_OPT_ERSPAN_ATTRS_VER = 1,
+	TC_A_TC_FLOWER_KEY_ENC_OPT_ERSPAN_ATTRS_INDEX = 2,
+	TC_A_TC_FLOWER_KEY_ENC_OPT_ERSPAN_ATTRS_DIR = 3,
+	TC_A_TC_FLOWER_KEY_ENC_OPT_ERSPAN_ATTRS_HWID = 4,
+};
+
+enum {
+	TC_A_TC_FLOWER_KEY_ENC_OPT_GTP_ATTRS_PDU_TYPE = 1,
+	TC_A_TC_FLOWER_KEY_ENC_OPT_GTP_ATTRS_QFI = 2,
+};
+
+enum {
+	TC_A_TC_FLOWER_KEY_MPLS_OPT_ATTRS_LSE_DEPTH = 1,
+	TC_A_TC_FLOWER_KEY_MPLS_OPT_ATTRS_LSE_TTL = 2,
+	TC_A_TC_FLOWER_KEY_MPLS_OPT_ATTRS_LSE_BOS = 3,
+	TC_A_TC_FLOWER_KEY_MPLS_OPT_ATTRS_LSE_TC = 4,
+	TC_A_TC_FLOWER_KEY_MPLS_OPT_ATTRS_LSE_LABEL = 5,
+};
+
+enum {
+	TC_A_TC_FLOWER_KEY_CFM_ATTRS_MD_LEVEL = 1,
+	TC_A_TC_FLOWER_KEY_CFM_ATTRS_OPCODE = 2,
+};
+
+enum {
+	TC_A_TC_FW_ATTRS_CLASSID = 1,
+	TC_A_TC_FW_ATTRS_POLICE = 2,
+	TC_A_TC_FW_ATTRS_INDEV = 3,
+	TC_A_TC_FW_ATTRS_ACT = 4,
+	TC_A_TC_FW_ATTRS_MASK = 5,
+};
+
+enum {
+	TC_A_TC_GRED_ATTRS_PARMS = 1,
+	TC_A_TC_GRED_ATTRS_STAB = 2,
+	TC_A_TC_GRED_ATTRS_DPS = 3,
+	TC_A_TC_GRED_ATTRS_MAX_P = 4,
+	TC_A_TC_GRED_ATTRS_LIMIT = 5,
+	TC_A_TC_GRED_ATTRS_VQ_LIST = 6,
+};
+
+enum {
+	TC_A_TCA_GRED_VQ_LIST_ATTRS_ENTRY = 1,
+};
+
+enum {
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_PAD = 1,
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_DP = 2,
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_STAT_BYTES = 3,
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_STAT_PACKETS = 4,
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_STAT_BACKLOG = 5,
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_STAT_PROB_DROP = 6,
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_STAT_PROB_MARK = 7,
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_STAT_FORCED_DROP = 8,
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_STAT_FORCED_MARK = 9,
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_STAT_PDROP = 10,
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_STAT_OTHER = 11,
+	TC_A_TCA_GRED_VQ_ENTRY_ATTRS_FLAGS = 12,
+};
+
+enum {
+	TC_A_TC_HFSC_ATTRS_RSC = 1,
+	TC_A_TC_HFSC_ATTRS_FSC = 2,
+	TC_A_TC_HFSC_ATTRS_USC = 3,
+};
+
+enum {
+	TC_A_TC_HHF_ATTRS_BACKLOG_LIMIT = 1,
+	TC_A_TC_HHF_ATTRS_QUANTUM = 2,
+	TC_A_TC_HHF_ATTRS_HH_FLOWS_LIMIT = 3,
+	TC_A_TC_HHF_ATTRS_RESET_TIMEOUT = 4,
+	TC_A_TC_HHF_ATTRS_ADMIT_BYTES = 5,
+	TC_A_TC_HHF_ATTRS_EVICT_TIMEOUT = 6,
+	TC_A_TC_HHF_ATTRS_NON_HH_WEIGHT = 7,
+};
+
+enum {
+	TC_A_TC_HTB_ATTRS_PARMS = 1,
+	TC_A_TC_HTB_ATTRS_INIT = 2,
+	TC_A_TC_HTB_ATTRS_CTAB = 3,
+	TC_A_TC_HTB_ATTRS_RTAB = 4,
+	TC_A_TC_HTB_ATTRS_DIRECT_QLEN = 5,
+	TC_A_TC_HTB_ATTRS_RATE64 = 6,
+	TC_A_TC_HTB_ATTRS_CEIL64 = 7,
+	TC_A_TC_HTB_ATTRS_PAD = 8,
+	TC_A_TC_HTB_ATTRS_OFFLOAD = 9,
+};
+
+enum {
+	TC_A_TC_MATCHALL_ATTRS_CLASSID = 1,
+	TC_A_TC_MATCHALL_ATTRS_ACT = 2,
+	TC_A_TC_MATCHALL_ATTRS_FLAGS = 3,
+	TC_A_TC_MATCHALL_ATTRS_PCNT = 4,
+	TC_A_TC_MATCHALL_ATTRS_PAD = 5,
+};
+
+enum {
+	TC_A_TC_ETF_ATTRS_PARMS = 1,
+};
+
+enum {
+	TC_A_TC_ETS_ATTRS_NBANDS = 1,
+	TC_A_TC_ETS_ATTRS_NSTRICT = 2,
+	TC_A_TC_ETS_ATTRS_QUANTA = 3,
+	TC_A_TC_ETS_ATTRS_QUANTA_BAND = 4,
+	TC_A_TC_ETS_ATTRS_PRIOMAP = 5,
+	TC_A_TC_ETS_ATTRS_PRIOMAP_BAND = 6,
+};
+
+enum {
+	TC_A_TC_FQ_ATTRS_PLIMIT = 1,
+	TC_A_TC_FQ_ATTRS_FLOW_PLIMIT = 2,
+	TC_A_TC_FQ_ATTRS_QUANTUM = 3,
+	TC_A_TC_FQ_ATTRS_INITIAL_QUANTUM = 4,
+	TC_A_TC_FQ_ATTRS_RATE_ENABLE = 5,
+	TC_A_TC_FQ_ATTRS_FLOW_DEFAULT_RATE = 6,
+	TC_A_TC_FQ_ATTRS_FLOW_MAX_RATE = 7,
+	TC_A_TC_FQ_ATTRS_BUCKETS_LOG = 8,
+	TC_A_TC_FQ_ATTRS_FLOW_REFILL_DELAY = 9,
+	TC_A_TC_FQ_ATTRS_ORPHAN_MASK = 10,
+	TC_A_TC_FQ_ATTRS_LOW_RATE_THRESHOLD = 11,
+	TC_A_TC_FQ_ATTRS_CE_THRESHOLD = 12,
+	TC_A_TC_FQ_ATTRS_TIMER_SLACK = 13,
+	TC_A_TC_FQ_ATTRS_HORIZON = 14,
+	TC_A_TC_FQ_ATTRS_HORIZON_DROP = 15,
+	TC_A_TC_FQ_ATTRS_PRIOMAP = 16,
+	TC_A_TC_FQ_ATTRS_WEIGHTS = 17,
+};
+
+enum {
+	TC_A_TC_FQ_CODEL_ATTRS_TARGET = 1,
+	TC_A_TC_FQ_CODEL_ATTRS_LIMIT = 2,
+	TC_A_TC_FQ_CODEL_ATTRS_INTERVAL = 3,
+	TC_A_TC_FQ_CODEL_ATTRS_ECN = 4,
+	TC_A_TC_FQ_CODEL_ATTRS_FLOWS = 5,
+	TC_A_TC_FQ_CODEL_ATTRS_QUANTUM = 6,
+	TC_A_TC_FQ_CODEL_ATTRS_CE_THRESHOLD = 7,
+	TC_A_TC_FQ_CODEL_ATTRS_DROP_BATCH_SIZE = 8,
+	TC_A_TC_FQ_CODEL_ATTRS_MEMORY_LIMIT = 9,
+	TC_A_TC_FQ_CODEL_ATTRS_CE_THRESHOLD_SELECTOR = 10,
+	TC_A_TC_FQ_CODEL_ATTRS_CE_THRESHOLD_MASK = 11,
+};
+
+enum {
+	TC_A_TC_FQ_PIE_ATTRS_LIMIT = 1,
+	TC_A_TC_FQ_PIE_ATTRS_FLOWS = 2,
+	TC_A_TC_FQ_PIE_ATTRS_TARGET = 3,
+	TC_A_TC_FQ_PIE_ATTRS_TUPDATE = 4,
+	TC_A_TC_FQ_PIE_ATTRS_ALPHA = 5,
+	TC_A_TC_FQ_PIE_ATTRS_BETA = 6,
+	TC_A_TC_FQ_PIE_ATTRS_QUANTUM = 7,
+	TC_A_TC_FQ_PIE_ATTRS_MEMORY_LIMIT = 8,
+	TC_A_TC_FQ_PIE_ATTRS_ECN_PROB = 9,
+	TC_A_TC_FQ_PIE_ATTRS_ECN = 10,
+	TC_A_TC_FQ_PIE_ATTRS_BYTEMODE = 11,
+	TC_A_TC_FQ_PIE_ATTRS_DQ_RATE_ESTIMATOR = 12,
+};
+
+enum {
+	TC_A_TC_NETEM_ATTRS_CORR = 1,
+	TC_A_TC_NETEM_ATTRS_DELAY_DIST = 2,
+	TC_A_TC_NETEM_ATTRS_REORDER = 3,
+	TC_A_TC_NETEM_ATTRS_CORRUPT = 4,
+	TC_A_TC_NETEM_ATTRS_LOSS = 5,
+	TC_A_TC_NETEM_ATTRS_RATE = 6,
+	TC_A_TC_NETEM_ATTRS_ECN = 7,
+	TC_A_TC_NETEM_ATTRS_RATE64 = 8,
+	TC_A_TC_NETEM_ATTRS_PAD = 9,
+	TC_A_TC_NETEM_ATTRS_LATENCY64 = 10,
+	TC_A_TC_NETEM_ATTRS_JITTER64 = 11,
+	TC_A_TC_NETEM_ATTRS_SLOT = 12,
+	TC_A_TC_NETEM_ATTRS_SLOT_DIST = 13,
+	TC_A_TC_NETEM_ATTRS_PRNG_SEED = 14,
+};
+
+enum {
+	TC_A_TC_NETEM_LOSS_ATTRS_GI = 1,
+	TC_A_TC_NETEM_LOSS_ATTRS_GE = 2,
+};
+
+enum {
+	TC_A_TC_PIE_ATTRS_TARGET = 1,
+	TC_A_TC_PIE_ATTRS_LIMIT = 2,
+	TC_A_TC_PIE_ATTRS_TUPDATE = 3,
+	TC_A_TC_PIE_ATTRS_ALPHA = 4,
+	TC_A_TC_PIE_ATTRS_BETA = 5,
+	TC_A_TC_PIE_ATTRS_ECN = 6,
+	TC_A_TC_PIE_ATTRS_BYTEMODE = 7,
+	TC_A_TC_PIE_ATTRS_DQ_RATE_ESTIMATOR = 8,
+};
+
+enum {
+	TC_A_TC_POLICE_ATTRS_TBF = 1,
+	TC_A_TC_POLICE_ATTRS_RATE = 2,
+	TC_A_TC_POLICE_ATTRS_PEAKRATE = 3,
+	TC_A_TC_POLICE_ATTRS_AVRATE = 4,
+	TC_A_TC_POLICE_ATTRS_RESULT = 5,
+	TC_A_TC_POLICE_ATTRS_TM = 6,
+	TC_A_TC_POLICE_ATTRS_PAD = 7,
+	TC_A_TC_POLICE_ATTRS_RATE64 = 8,
+	TC_A_TC_POLICE_ATTRS_PEAKRATE64 = 9,
+	TC_A_TC_POLICE_ATTRS_PKTRATE64 = 10,
+	TC_A_TC_POLICE_ATTRS_PKTBURST64 = 11,
+};
+
+enum {
+	TC_A_TC_QFQ_ATTRS_WEIGHT = 1,
+	TC_A_TC_QFQ_ATTRS_LMAX = 2,
+};
+
+enum {
+	TC_A_TC_RED_ATTRS_PARMS = 1,
+	TC_A_TC_RED_ATTRS_STAB = 2,
+	TC_A_TC_RED_ATTRS_MAX_P = 3,
+	TC_A_TC_RED_ATTRS_FLAGS = 4,
+	TC_A_TC_RED_ATTRS_EARLY_DROP_BLOCK = 5,
+	TC_A_TC_RED_ATTRS_MARK_BLOCK = 6,
+};
+
+enum {
+	TC_A_TC_ROUTE_ATTRS_CLASSID = 1,
+	TC_A_TC_ROUTE_ATTRS_TO = 2,
+	TC_A_TC_ROUTE_ATTRS_FROM = 3,
+	TC_A_TC_ROUTE_ATTRS_IIF = 4,
+	TC_A_TC_ROUTE_ATTRS_POLICE = 5,
+	TC_A_TC_ROUTE_ATTRS_ACT = 6,
+};
+
+enum {
+	TC_A_TC_TAPRIO_ATTRS_PRIOMAP = 1,
+	TC_A_TC_TAPRIO_ATTRS_SCHED_ENTRY_LIST = 2,
+	TC_A_TC_TAPRIO_ATTRS_SCHED_BASE_TIME = 3,
+	TC_A_TC_TAPRIO_ATTRS_SCHED_SINGLE_ENTRY = 4,
+	TC_A_TC_TAPRIO_ATTRS_SCHED_CLOCKID = 5,
+	TC_A_TC_TAPRIO_ATTRS_PAD = 6,
+	TC_A_TC_TAPRIO_ATTRS_ADMIN_SCHED = 7,
+	TC_A_TC_TAPRIO_ATTRS_SCHED_CYCLE_TIME = 8,
+	TC_A_TC_TAPRIO_ATTRS_SCHED_CYCLE_TIME_EXTENSION = 9,
+	TC_A_TC_TAPRIO_ATTRS_FLAGS = 10,
+	TC_A_TC_TAPRIO_ATTRS_TXTIME_DELAY = 11,
+	TC_A_TC_TAPRIO_ATTRS_TC_ENTRY = 12,
+};
+
+enum {
+	TC_A_TC_TAPRIO_SCHED_ENTRY_LIST_ENTRY = 1,
+};
+
+enum {
+	TC_A_TC_TAPRIO_SCHED_ENTRY_INDEX = 1,
+	TC_A_TC_TAPRIO_SCHED_ENTRY_CMD = 2,
+	TC_A_TC_TAPRIO_SCHED_ENTRY_GATE_MASK = 3,
+	TC_A_TC_TAPRIO_SCHED_ENTRY_INTERVAL = 4,
+};
+
+enum {
+	TC_A_TC_TAPRIO_TC_ENTRY_ATTRS_INDEX = 1,
+	TC_A_TC_TAPRIO_TC_ENTRY_ATTRS_MAX_SDU = 2,
+	TC_A_TC_TAPRIO_TC_ENTRY_ATTRS_FP = 3,
+};
+
+enum {
+	TC_A_TC_TBF_ATTRS_PARMS = 1,
+	TC_A_TC_TBF_ATTRS_RTAB = 2,
+	TC_A_TC_TBF_ATTRS_PTAB = 3,
+	TC_A_TC_TBF_ATTRS_RATE64 = 4,
+	TC_A_TC_TBF_ATTRS_PRATE4 = 5,
+	TC_A_TC_TBF_ATTRS_BURST = 6,
+	TC_A_TC_TBF_ATTRS_PBURST = 7,
+	TC_A_TC_TBF_ATTRS_PAD = 8,
+};
+
+enum {
+	TC_A_TC_ACT_SAMPLE_ATTRS_TM = 1,
+	TC_A_TC_ACT_SAMPLE_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_SAMPLE_ATTRS_RATE = 3,
+	TC_A_TC_ACT_SAMPLE_ATTRS_TRUNC_SIZE = 4,
+	TC_A_TC_ACT_SAMPLE_ATTRS_PSAMPLE_GROUP = 5,
+	TC_A_TC_ACT_SAMPLE_ATTRS_PAD = 6,
+};
+
+enum {
+	TC_A_TC_ACT_GACT_ATTRS_TM = 1,
+	TC_A_TC_ACT_GACT_ATTRS_PARMS = 2,
+	TC_A_TC_ACT_GACT_ATTRS_PROB = 3,
+	TC_A_TC_ACT_GACT_ATTRS_PAD = 4,
+};
+
+enum {
+	TC_A_TCA_STAB_ATTRS_BASE = 1,
+	TC_A_TCA_STAB_ATTRS_DATA = 2,
+};
+
+enum {
+	TC_A_TCA_STATS_ATTRS_BASIC = 1,
+	TC_A_TCA_STATS_ATTRS_RATE_EST = 2,
+	TC_A_TCA_STATS_ATTRS_QUEUE = 3,
+	TC_A_TCA_STATS_ATTRS_APP = 4,
+	TC_A_TCA_STATS_ATTRS_RATE_EST64 = 5,
+	TC_A_TCA_STATS_ATTRS_PAD = 6,
+	TC_A_TCA_STATS_ATTRS_BASIC_HW = 7,
+	TC_A_TCA_STATS_ATTRS_PKT64 = 8,
+};
+
+enum {
+	TC_A_TC_U32_ATTRS_CLASSID = 1,
+	TC_A_TC_U32_ATTRS_HASH = 2,
+	TC_A_TC_U32_ATTRS_LINK = 3,
+	TC_A_TC_U32_ATTRS_DIVISOR = 4,
+	TC_A_TC_U32_ATTRS_SEL = 5,
+	TC_A_TC_U32_ATTRS_POLICE = 6,
+	TC_A_TC_U32_ATTRS_ACT = 7,
+	TC_A_TC_U32_ATTRS_INDEV = 8,
+	TC_A_TC_U32_ATTRS_PCNT = 9,
+	TC_A_TC_U32_ATTRS_MARK = 10,
+	TC_A_TC_U32_ATTRS_FLAGS = 11,
+	TC_A_TC_U32_ATTRS_PAD = 12,
+};
+
+const struct ynl_family& get_ynl_tc_family();
+
+/* Enums */
+std::string_view tc_op_str(int op);
+std::string_view tc_tc_cls_flags_str(tc_tc_cls_flags value);
+std::string_view
+tc_tc_flower_key_ctrl_flags_str(tc_tc_flower_key_ctrl_flags value);
+
+/* Common nested types */
+struct tc_tca_stats_attrs {
+	std::vector<__u8> basic;
+	std::vector<__u8> rate_est;
+	std::vector<__u8> queue;
+	std::vector<__u8> app;
+	std::vector<__u8> rate_est64;
+	std::vector<__u8> basic_hw;
+	std::optional<__u64> pkt64;
+};
+
+struct tc_tca_stab_attrs {
+	std::vector<__u8> base;
+	std::vector<__u8> data;
+};
+
+/* Policies and nested encoders */
+extern struct ynl_policy_nest tc_tca_stats_attrs_nest;
+extern struct ynl_policy_nest tc_tca_stab_attrs_nest;
+extern struct ynl_policy_nest tc_tc_attrs_nest;
+
+/* ============== NEWQDISC ============== */
+/* NEWQDISC - do */
+struct tc_newqdisc_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+
+	std::string kind;
+	std::vector<__u8> options;
+	std::vector<__u8> rate;
+	std::optional<__u32> chain;
+	std::optional<__u32> ingress_block;
+	std::optional<__u32> egress_block;
+};
+
+/*
+ * Create new tc qdisc.
+ */
+int tc_newqdisc(ynl_cpp::ynl_socket&  ys, tc_newqdisc_req& req);
+ynl_cpp::result<void>
+tc_newqdisc_ex(ynl_cpp::ynl_socket&  ys, tc_newqdisc_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_newqdisc_prepare(ynl_cpp::ynl_socket&  ys, tc_newqdisc_req& req);
+int tc_newqdisc(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+tc_newqdisc_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+tc_newqdisc_batch(ynl_cpp::msg_batch& batch, tc_newqdisc_req& req);
+
+/* ============== DELQDISC ============== */
+/* DELQDISC - do */
+struct tc_delqdisc_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t tc_delqdisc_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 0;
+
+/*
+ * Delete existing tc qdisc.
+ */
+int tc_delqdisc(ynl_cpp::ynl_socket&  ys, tc_delqdisc_req& req);
+ynl_cpp::result<void>
+tc_delqdisc_ex(ynl_cpp::ynl_socket&  ys, tc_delqdisc_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_delqdisc_prepare(ynl_cpp::ynl_socket&  ys, tc_delqdisc_req& req);
+int tc_delqdisc(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+tc_delqdisc_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+tc_delqdisc_batch(ynl_cpp::msg_batch& batch, tc_delqdisc_req& req);
+
+/* ============== GETQDISC ============== */
+/* GETQDISC - do */
+struct tc_getqdisc_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+
+	bool dump_invisible{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t tc_getqdisc_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 4;
+
+struct tc_getqdisc_rsp {
+	struct tcmsg _hdr{};
+
+	std::string kind;
+	std::vector<__u8> options;
+	std::vector<__u8> stats;
+	std::vector<__u8> xstats;
+	std::vector<__u8> rate;
+	std::optional<__u32> fcnt;
+	std::optional<tc_tca_stats_attrs> stats2;
+	std::optional<tc_tca_stab_attrs> stab;
+	std::optional<__u32> chain;
+	std::optional<__u32> ingress_block;
+	std::optional<__u32> egress_block;
+};
+
+/*
+ * Get / dump tc qdisc information.
+ */
+std::unique_ptr<tc_getqdisc_rsp>
+tc_getqdisc(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req& req);
+ynl_cpp::result<std::unique_ptr<tc_getqdisc_rsp>>
+tc_getqdisc_ex(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req& req,
+	       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_getqdisc_prepare(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req& req);
+std::unique_ptr<tc_getqdisc_rsp>
+tc_getqdisc(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<tc_getqdisc_rsp>>
+tc_getqdisc_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	       const ynl_cpp::projection *proj = nullptr);
+
+/* GETQDISC - dump */
+struct tc_getqdisc_req_dump {
+	struct tcmsg _hdr{};
+
+	bool dump_invisible{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t tc_getqdisc_req_dump_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 4;
+
+struct tc_getqdisc_list {
+	std::list<tc_getqdisc_rsp> objs;
+};
+
+std::unique_ptr<tc_getqdisc_list>
+tc_getqdisc_dump(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req_dump& req);
+ynl_cpp::result<std::unique_ptr<tc_getqdisc_list>>
+tc_getqdisc_dump_ex(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req_dump& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_getqdisc_dump_prepare(ynl_cpp::ynl_socket&  ys, tc_getqdisc_req_dump& req);
+std::unique_ptr<tc_getqdisc_list>
+tc_getqdisc_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<tc_getqdisc_list>>
+tc_getqdisc_dump_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
+
+/* ============== NEWTCLASS ============== */
+/* NEWTCLASS - do */
+struct tc_newtclass_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+
+	std::string kind;
+	std::vector<__u8> options;
+	std::vector<__u8> rate;
+	std::optional<__u32> chain;
+	std::optional<__u32> ingress_block;
+	std::optional<__u32> egress_block;
+};
+
+/*
+ * Get / dump tc traffic class information.
+ */
+int tc_newtclass(ynl_cpp::ynl_socket&  ys, tc_newtclass_req& req);
+ynl_cpp::result<void>
+tc_newtclass_ex(ynl_cpp::ynl_socket&  ys, tc_newtclass_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_newtclass_prepare(ynl_cpp::ynl_socket&  ys, tc_newtclass_req& req);
+int tc_newtclass(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+tc_newtclass_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+tc_newtclass_batch(ynl_cpp::msg_batch& batch, tc_newtclass_req& req);
+
+/* ============== DELTCLASS ============== */
+/* DELTCLASS - do */
+struct tc_deltclass_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t tc_deltclass_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 0;
+
+/*
+ * Get / dump tc traffic class information.
+ */
+int tc_deltclass(ynl_cpp::ynl_socket&  ys, tc_deltclass_req& req);
+ynl_cpp::result<void>
+tc_deltclass_ex(ynl_cpp::ynl_socket&  ys, tc_deltclass_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_deltclass_prepare(ynl_cpp::ynl_socket&  ys, tc_deltclass_req& req);
+int tc_deltclass(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+tc_deltclass_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+tc_deltclass_batch(ynl_cpp::msg_batch& batch, tc_deltclass_req& req);
+
+/* ============== GETTCLASS ============== */
+/* GETTCLASS - do */
+struct tc_gettclass_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t tc_gettclass_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 0;
+
+struct tc_gettclass_rsp {
+	struct tcmsg _hdr{};
+
+	std::string kind;
+	std::vector<__u8> options;
+	std::vector<__u8> stats;
+	std::vector<__u8> xstats;
+	std::vector<__u8> rate;
+	std::optional<__u32> fcnt;
+	std::optional<tc_tca_stats_attrs> stats2;
+	std::optional<tc_tca_stab_attrs> stab;
+	std::optional<__u32> chain;
+	std::optional<__u32> ingress_block;
+	std::optional<__u32> egress_block;
+};
+
+/*
+ * Get / dump tc traffic class information.
+ */
+std::unique_ptr<tc_gettclass_rsp>
+tc_gettclass(ynl_cpp::ynl_socket&  ys, tc_gettclass_req& req);
+ynl_cpp::result<std::unique_ptr<tc_gettclass_rsp>>
+tc_gettclass_ex(ynl_cpp::ynl_socket&  ys, tc_gettclass_req& req,
+		const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_gettclass_prepare(ynl_cpp::ynl_socket&  ys, tc_gettclass_req& req);
+std::unique_ptr<tc_gettclass_rsp>
+tc_gettclass(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<tc_gettclass_rsp>>
+tc_gettclass_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		const ynl_cpp::projection *proj = nullptr);
+
+/* GETTCLASS - dump */
+struct tc_gettclass_req_dump {
+	struct tcmsg _hdr{};
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t tc_gettclass_req_dump_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 0;
+
+struct tc_gettclass_list {
+	std::list<tc_gettclass_rsp> objs;
+};
+
+std::unique_ptr<tc_gettclass_list>
+tc_gettclass_dump(ynl_cpp::ynl_socket&  ys, tc_gettclass_req_dump& req);
+ynl_cpp::result<std::unique_ptr<tc_gettclass_list>>
+tc_gettclass_dump_ex(ynl_cpp::ynl_socket&  ys, tc_gettclass_req_dump& req,
+		     const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_gettclass_dump_prepare(ynl_cpp::ynl_socket&  ys, tc_gettclass_req_dump& req);
+std::unique_ptr<tc_gettclass_list>
+tc_gettclass_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<tc_gettclass_list>>
+tc_gettclass_dump_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		     const ynl_cpp::projection *proj = nullptr);
+
+/* ============== NEWTFILTER ============== */
+/* NEWTFILTER - do */
+struct tc_newtfilter_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+
+	std::string kind;
+	std::vector<__u8> options;
+	std::vector<__u8> rate;
+	std::optional<__u32> chain;
+	std::optional<__u32> ingress_block;
+	std::optional<__u32> egress_block;
+};
+
+/*
+ * Get / dump tc filter information.
+ */
+int tc_newtfilter(ynl_cpp::ynl_socket&  ys, tc_newtfilter_req& req);
+ynl_cpp::result<void>
+tc_newtfilter_ex(ynl_cpp::ynl_socket&  ys, tc_newtfilter_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_newtfilter_prepare(ynl_cpp::ynl_socket&  ys, tc_newtfilter_req& req);
+int tc_newtfilter(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+tc_newtfilter_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+tc_newtfilter_batch(ynl_cpp::msg_batch& batch, tc_newtfilter_req& req);
+
+/* ============== DELTFILTER ============== */
+/* DELTFILTER - do */
+struct tc_deltfilter_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+
+	std::optional<__u32> chain;
+	std::string kind;
+};
+
+/*
+ * Get / dump tc filter information.
+ */
+int tc_deltfilter(ynl_cpp::ynl_socket&  ys, tc_deltfilter_req& req);
+ynl_cpp::result<void>
+tc_deltfilter_ex(ynl_cpp::ynl_socket&  ys, tc_deltfilter_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_deltfilter_prepare(ynl_cpp::ynl_socket&  ys, tc_deltfilter_req& req);
+int tc_deltfilter(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+tc_deltfilter_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+tc_deltfilter_batch(ynl_cpp::msg_batch& batch, tc_deltfilter_req& req);
+
+/* ============== GETTFILTER ============== */
+/* GETTFILTER - do */
+struct tc_gettfilter_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+
+	std::optional<__u32> chain;
+	std::string kind;
+};
+
+struct tc_gettfilter_rsp {
+	struct tcmsg _hdr{};
+
+	std::string kind;
+	std::vector<__u8> options;
+	std::vector<__u8> stats;
+	std::vector<__u8> xstats;
+	std::vector<__u8> rate;
+	std::optional<__u32> fcnt;
+	std::optional<tc_tca_stats_attrs> stats2;
+	std::optional<tc_tca_stab_attrs> stab;
+	std::optional<__u32> chain;
+	std::optional<__u32> ingress_block;
+	std::optional<__u32> egress_block;
+};
+
+/*
+ * Get / dump tc filter information.
+ */
+std::unique_ptr<tc_gettfilter_rsp>
+tc_gettfilter(ynl_cpp::ynl_socket&  ys, tc_gettfilter_req& req);
+ynl_cpp::result<std::unique_ptr<tc_gettfilter_rsp>>
+tc_gettfilter_ex(ynl_cpp::ynl_socket&  ys, tc_gettfilter_req& req,
+		 const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_gettfilter_prepare(ynl_cpp::ynl_socket&  ys, tc_gettfilter_req& req);
+std::unique_ptr<tc_gettfilter_rsp>
+tc_gettfilter(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<tc_gettfilter_rsp>>
+tc_gettfilter_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		 const ynl_cpp::projection *proj = nullptr);
+
+/* GETTFILTER - dump */
+struct tc_gettfilter_req_dump {
+	struct tcmsg _hdr{};
+
+	std::optional<__u32> chain;
+	std::optional<struct nla_bitfield32> dump_flags;
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t tc_gettfilter_req_dump_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 20;
+
+struct tc_gettfilter_list {
+	std::list<tc_gettfilter_rsp> objs;
+};
+
+std::unique_ptr<tc_gettfilter_list>
+tc_gettfilter_dump(ynl_cpp::ynl_socket&  ys, tc_gettfilter_req_dump& req);
+ynl_cpp::result<std::unique_ptr<tc_gettfilter_list>>
+tc_gettfilter_dump_ex(ynl_cpp::ynl_socket&  ys, tc_gettfilter_req_dump& req,
+		      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_gettfilter_dump_prepare(ynl_cpp::ynl_socket&  ys,
+			   tc_gettfilter_req_dump& req);
+std::unique_ptr<tc_gettfilter_list>
+tc_gettfilter_dump(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<tc_gettfilter_list>>
+tc_gettfilter_dump_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj = nullptr);
+
+/* ============== NEWCHAIN ============== */
+/* NEWCHAIN - do */
+struct tc_newchain_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+
+	std::string kind;
+	std::vector<__u8> options;
+	std::vector<__u8> rate;
+	std::optional<__u32> chain;
+	std::optional<__u32> ingress_block;
+	std::optional<__u32> egress_block;
+};
+
+/*
+ * Get / dump tc chain information.
+ */
+int tc_newchain(ynl_cpp::ynl_socket&  ys, tc_newchain_req& req);
+ynl_cpp::result<void>
+tc_newchain_ex(ynl_cpp::ynl_socket&  ys, tc_newchain_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_newchain_prepare(ynl_cpp::ynl_socket&  ys, tc_newchain_req& req);
+int tc_newchain(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+tc_newchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+tc_newchain_batch(ynl_cpp::msg_batch& batch, tc_newchain_req& req);
+
+/* ============== DELCHAIN ============== */
+/* DELCHAIN - do */
+struct tc_delchain_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+
+	std::optional<__u32> chain;
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t tc_delchain_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 8;
+
+/*
+ * Get / dump tc chain information.
+ */
+int tc_delchain(ynl_cpp::ynl_socket&  ys, tc_delchain_req& req);
+ynl_cpp::result<void>
+tc_delchain_ex(ynl_cpp::ynl_socket&  ys, tc_delchain_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_delchain_prepare(ynl_cpp::ynl_socket&  ys, tc_delchain_req& req);
+int tc_delchain(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+tc_delchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+tc_delchain_batch(ynl_cpp::msg_batch& batch, tc_delchain_req& req);
+
+/* ============== GETCHAIN ============== */
+/* GETCHAIN - do */
+struct tc_getchain_req {
+	__u16 _nlmsg_flags{};
+
+	struct tcmsg _hdr{};
+
+	std::optional<__u32> chain;
+};
+
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t tc_getchain_req_max_len = NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(struct tcmsg)) + 8;
+
+struct tc_getchain_rsp {
+	struct tcmsg _hdr{};
+
+	std::string kind;
+	std::vector<__u8> options;
+	std::vector<__u8> stats;
+	std::vector<__u8> xstats;
+	std::vector<__u8> rate;
+	std::optional<__u32> fcnt;
+	std::optional<tc_tca_stats_attrs> stats2;
+	std::optional<tc_tca_stab_attrs> stab;
+	std::optional<__u32> chain;
+	std::optional<__u32> ingress_block;
+	std::optional<__u32> egress_block;
+};
+
+/*
+ * Get / dump tc chain information.
+ */
+std::unique_ptr<tc_getchain_rsp>
+tc_getchain(ynl_cpp::ynl_socket&  ys, tc_getchain_req& req);
+ynl_cpp::result<std::unique_ptr<tc_getchain_rsp>>
+tc_getchain_ex(ynl_cpp::ynl_socket&  ys, tc_getchain_req& req,
+	       const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+tc_getchain_prepare(ynl_cpp::ynl_socket&  ys, tc_getchain_req& req);
+std::unique_ptr<tc_getchain_rsp>
+tc_getchain(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<tc_getchain_rsp>>
+tc_getchain_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+	       const ynl_cpp::projection *proj = nullptr);
+
+} //namespace ynl_cpp
+#endif /* _LINUX_TC_GEN_H */
@@ -80,32 +80,32 @@ int tcp_metrics_metrics_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == TCP_METRICS_A_METRICS_RTT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rtt = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TCP_METRICS_A_METRICS_RTTVAR) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rttvar = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TCP_METRICS_A_METRICS_SSTHRESH) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ssthresh = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TCP_METRICS_A_METRICS_CWND) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->cwnd = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TCP_METRICS_A_METRICS_REODERING) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->reodering = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TCP_METRICS_A_METRICS_RTT_US) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rtt_us = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TCP_METRICS_A_METRICS_RTTVAR_US) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->rttvar_us = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -128,53 +128,50 @@ int tcp_metrics_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == TCP_METRICS_ATTR_ADDR_IPV4) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->addr_ipv4 = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TCP_METRICS_ATTR_ADDR_IPV6) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->addr_ipv6.assign(data, data + len);
 		} else if (type == TCP_METRICS_ATTR_SADDR_IPV4) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->saddr_ipv4 = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TCP_METRICS_ATTR_SADDR_IPV6) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->saddr_ipv6.assign(data, data + len);
 		} else if (type == TCP_METRICS_ATTR_AGE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->age = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == TCP_METRICS_ATTR_VALS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &tcp_metrics_metrics_nest;
-			parg.data = &dst->vals;
+			parg.data = &dst->vals.emplace();
 			if (tcp_metrics_metrics_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		} else if (type == TCP_METRICS_ATTR_FOPEN_MSS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->fopen_mss = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == TCP_METRICS_ATTR_FOPEN_SYN_DROPS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u16))
+				return ynl_attr_invalid(yarg, attr, "u16");
 			dst->fopen_syn_drops = (__u16)ynl_attr_get_u16(attr);
 		} else if (type == TCP_METRICS_ATTR_FOPEN_SYN_DROP_TS) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u64))
+				return ynl_attr_invalid(yarg, attr, "u64");
 			dst->fopen_syn_drop_ts = (__u64)ynl_attr_get_u64(attr);
 		} else if (type == TCP_METRICS_ATTR_FOPEN_COOKIE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->fopen_cookie.assign(data, data + len);
@@ -184,89 +181,215 @@ int tcp_metrics_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<tcp_metrics_get_rsp>
-tcp_metrics_get(ynl_cpp::ynl_socket&  ys, tcp_metrics_get_req& req)
+static void tcp_metrics_get_put(struct nlmsghdr *nlh, tcp_metrics_get_req& req)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
-	std::unique_ptr<tcp_metrics_get_rsp> rsp;
-	struct nlmsghdr *nlh;
-	int err;
-
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TCP_METRICS_CMD_GET, 1);
-	((struct ynl_sock*)ys)->req_policy = &tcp_metrics_nest;
-	yrs.yarg.rsp_policy = &tcp_metrics_nest;
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
 
 	if (req.addr_ipv4.has_value())
-		ynl_attr_put_u32(nlh, TCP_METRICS_ATTR_ADDR_IPV4, req.addr_ipv4.value());
+		ynl_attr_put_u32_unchecked(nlh, TCP_METRICS_ATTR_ADDR_IPV4, req.addr_ipv4.value());
+	if (req.saddr_ipv4.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TCP_METRICS_ATTR_SADDR_IPV4, req.saddr_ipv4.value());
 	if (req.addr_ipv6.size() > 0)
 		ynl_attr_put(nlh, TCP_METRICS_ATTR_ADDR_IPV6, req.addr_ipv6.data(), req.addr_ipv6.size());
-	if (req.saddr_ipv4.has_value())
-		ynl_attr_put_u32(nlh, TCP_METRICS_ATTR_SADDR_IPV4, req.saddr_ipv4.value());
 	if (req.saddr_ipv6.size() > 0)
 		ynl_attr_put(nlh, TCP_METRICS_ATTR_SADDR_IPV6, req.saddr_ipv6.data(), req.saddr_ipv6.size());
+}
+
+static ynl_cpp::result<std::unique_ptr<tcp_metrics_get_rsp>>
+tcp_metrics_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		     const ynl_cpp::projection *proj)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	std::unique_ptr<tcp_metrics_get_rsp> rsp;
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tcp_metrics_nest;
+	yrs.yarg.rsp_policy = &tcp_metrics_nest;
 
 	rsp.reset(new tcp_metrics_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = tcp_metrics_get_rsp_parse;
 	yrs.rsp_cmd = TCP_METRICS_CMD_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<tcp_metrics_get_rsp>>
+tcp_metrics_get_ex(ynl_cpp::ynl_socket&  ys, tcp_metrics_get_req& req,
+		   const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TCP_METRICS_CMD_GET, 1);
+	tcp_metrics_get_put(nlh, req);
+
+	return tcp_metrics_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<tcp_metrics_get_rsp>
+tcp_metrics_get(ynl_cpp::ynl_socket&  ys, tcp_metrics_get_req& req)
+{
+	auto ret = tcp_metrics_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tcp_metrics_get_prepare(ynl_cpp::ynl_socket&  ys, tcp_metrics_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TCP_METRICS_CMD_GET, 1);
+	tcp_metrics_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<tcp_metrics_get_rsp>>
+tcp_metrics_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj)
+{
+	return tcp_metrics_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<tcp_metrics_get_rsp>
+tcp_metrics_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tcp_metrics_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* TCP_METRICS_CMD_GET - dump */
-std::unique_ptr<tcp_metrics_get_list>
-tcp_metrics_get_dump(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<tcp_metrics_get_list>>
+tcp_metrics_get_dump_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			  const ynl_cpp::projection *proj)
 {
 	struct ynl_dump_no_alloc_state yds = {};
-	struct nlmsghdr *nlh;
 	int err;
 
 	auto ret = std::make_unique<tcp_metrics_get_list>();
 	yds.yarg.ys = ys;
 	yds.yarg.rsp_policy = &tcp_metrics_nest;
 	yds.yarg.data = ret.get();
+	yds.yarg.proj = proj ? proj->words() : nullptr;
 	yds.alloc_cb = [](void* arg)->void*{return &(static_cast<tcp_metrics_get_list*>(arg)->objs.emplace_back());};
 	yds.cb = tcp_metrics_get_rsp_parse;
 	yds.rsp_cmd = TCP_METRICS_CMD_GET;
 
-	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, TCP_METRICS_CMD_GET, 1);
-
 	err = ynl_exec_dump_no_alloc(ys, nlh, &yds);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return ret;
 }
 
-/* ============== TCP_METRICS_CMD_DEL ============== */
-/* TCP_METRICS_CMD_DEL - do */
-int tcp_metrics_del(ynl_cpp::ynl_socket&  ys, tcp_metrics_del_req& req)
+ynl_cpp::result<std::unique_ptr<tcp_metrics_get_list>>
+tcp_metrics_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			const ynl_cpp::projection *proj)
 {
-	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	struct nlmsghdr *nlh;
-	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TCP_METRICS_CMD_DEL, 1);
-	((struct ynl_sock*)ys)->req_policy = &tcp_metrics_nest;
+	nlh = ynl_gemsg_start_dump(ys, ((struct ynl_sock*)ys)->family_id, TCP_METRICS_CMD_GET, 1);
+
+	return tcp_metrics_get_dump_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<tcp_metrics_get_list>
+tcp_metrics_get_dump(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = tcp_metrics_get_dump_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+/* ============== TCP_METRICS_CMD_DEL ============== */
+/* TCP_METRICS_CMD_DEL - do */
+static void tcp_metrics_del_put(struct nlmsghdr *nlh, tcp_metrics_del_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 16 <= YNL_SOCKET_BUFFER_SIZE);
 
 	if (req.addr_ipv4.has_value())
-		ynl_attr_put_u32(nlh, TCP_METRICS_ATTR_ADDR_IPV4, req.addr_ipv4.value());
+		ynl_attr_put_u32_unchecked(nlh, TCP_METRICS_ATTR_ADDR_IPV4, req.addr_ipv4.value());
+	if (req.saddr_ipv4.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TCP_METRICS_ATTR_SADDR_IPV4, req.saddr_ipv4.value());
 	if (req.addr_ipv6.size() > 0)
 		ynl_attr_put(nlh, TCP_METRICS_ATTR_ADDR_IPV6, req.addr_ipv6.data(), req.addr_ipv6.size());
-	if (req.saddr_ipv4.has_value())
-		ynl_attr_put_u32(nlh, TCP_METRICS_ATTR_SADDR_IPV4, req.saddr_ipv4.value());
 	if (req.saddr_ipv6.size() > 0)
 		ynl_attr_put(nlh, TCP_METRICS_ATTR_SADDR_IPV6, req.saddr_ipv6.data(), req.saddr_ipv6.size());
+}
+
+static ynl_cpp::result<void>
+tcp_metrics_del_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh)
+{
+	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
+	int err;
+
+	((struct ynl_sock*)ys)->req_policy = &tcp_metrics_nest;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return -1;
+		return std::unexpected(ynl_cpp::error(ys));
 
-	return 0;
+	return {};
+}
+
+ynl_cpp::result<void>
+tcp_metrics_del_ex(ynl_cpp::ynl_socket&  ys, tcp_metrics_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TCP_METRICS_CMD_DEL, 1);
+	tcp_metrics_del_put(nlh, req);
+
+	return tcp_metrics_del_exec(ys, nlh);
+}
+
+int tcp_metrics_del(ynl_cpp::ynl_socket&  ys, tcp_metrics_del_req& req)
+{
+	auto ret = tcp_metrics_del_ex(ys, req);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+tcp_metrics_del_prepare(ynl_cpp::ynl_socket&  ys, tcp_metrics_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TCP_METRICS_CMD_DEL, 1);
+	tcp_metrics_del_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<void>
+tcp_metrics_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	return tcp_metrics_del_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()));
+}
+
+int tcp_metrics_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = tcp_metrics_del_ex(ys, tmpl);
+	return ret ? 0 : -1;
+}
+
+ynl_cpp::result<size_t>
+tcp_metrics_del_batch(ynl_cpp::msg_batch& batch, tcp_metrics_del_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = batch.gemsg_start(TCP_METRICS_CMD_DEL, 1);
+	tcp_metrics_del_put(nlh, req);
+	return batch.msg_end(nlh, &tcp_metrics_nest);
 }
 
 const struct ynl_family ynl_tcp_metrics_family =  {
@@ -38,6 +38,10 @@ struct tcp_metrics_metrics {
 	std::optional<__u32> rttvar_us;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest tcp_metrics_metrics_nest;
+extern struct ynl_policy_nest tcp_metrics_nest;
+
 /* ============== TCP_METRICS_CMD_GET ============== */
 /* TCP_METRICS_CMD_GET - do */
 struct tcp_metrics_get_req {
@@ -65,6 +69,16 @@ struct tcp_metrics_get_rsp {
  */
 std::unique_ptr<tcp_metrics_get_rsp>
 tcp_metrics_get(ynl_cpp::ynl_socket&  ys, tcp_metrics_get_req& req);
+ynl_cpp::result<std::unique_ptr<tcp_metrics_get_rsp>>
+tcp_metrics_get_ex(ynl_cpp::ynl_socket&  ys, tcp_metrics_get_req& req,
+		   const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+tcp_metrics_get_prepare(ynl_cpp::ynl_socket&  ys, tcp_metrics_get_req& req);
+std::unique_ptr<tcp_metrics_get_rsp>
+tcp_metrics_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<tcp_metrics_get_rsp>>
+tcp_metrics_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		   const ynl_cpp::projection *proj = nullptr);
 
 /* TCP_METRICS_CMD_GET - dump */
 struct tcp_metrics_get_list {
@@ -73,6 +87,9 @@ struct tcp_metrics_get_list {
 
 std::unique_ptr<tcp_metrics_get_list>
 tcp_metrics_get_dump(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<tcp_metrics_get_list>>
+tcp_metrics_get_dump_ex(ynl_cpp::ynl_socket&  ys,
+			const ynl_cpp::projection *proj = nullptr);
 
 /* ============== TCP_METRICS_CMD_DEL ============== */
 /* TCP_METRICS_CMD_DEL - do */
@@ -87,6 +104,15 @@ struct tcp_metrics_del_req {
  * Delete metrics.
  */
 int tcp_metrics_del(ynl_cpp::ynl_socket&  ys, tcp_metrics_del_req& req);
+ynl_cpp::result<void>
+tcp_metrics_del_ex(ynl_cpp::ynl_socket&  ys, tcp_metrics_del_req& req);
+ynl_cpp::result<ynl_cpp::request_template>
+tcp_metrics_del_prepare(ynl_cpp::ynl_socket&  ys, tcp_metrics_del_req& req);
+int tcp_metrics_del(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<void>
+tcp_metrics_del_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<size_t>
+tcp_metrics_del_batch(ynl_cpp::msg_batch& batch, tcp_metrics_del_req& req);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_TCP_METRICS_GEN_H */
@@ -139,32 +139,28 @@ int team_attr_option_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == TEAM_ATTR_OPTION_NAME) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
-			dst->name.assign(ynl_attr_get_str(attr), ynl_attr_data_len(attr));
+			if (!ynl_attr_str_valid(attr))
+				return ynl_attr_invalid(yarg, attr, "string");
+			dst->name.assign(ynl_attr_get_str(attr));
 		} else if (type == TEAM_ATTR_OPTION_CHANGED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->changed = true;
 		} else if (type == TEAM_ATTR_OPTION_TYPE) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->type = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == TEAM_ATTR_OPTION_DATA) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
 			unsigned int len = ynl_attr_data_len(attr);
 			__u8 *data = (__u8*)ynl_attr_data(attr);
 			dst->data.assign(data, data + len);
 		} else if (type == TEAM_ATTR_OPTION_REMOVED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->removed = true;
 		} else if (type == TEAM_ATTR_OPTION_PORT_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->port_ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TEAM_ATTR_OPTION_ARRAY_INDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->array_index = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -182,26 +178,23 @@ int team_attr_port_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == TEAM_ATTR_PORT_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TEAM_ATTR_PORT_CHANGED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->changed = true;
 		} else if (type == TEAM_ATTR_PORT_LINKUP) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->linkup = true;
 		} else if (type == TEAM_ATTR_PORT_SPEED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->speed = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TEAM_ATTR_PORT_DUPLEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u8))
+				return ynl_attr_invalid(yarg, attr, "u8");
 			dst->duplex = (__u8)ynl_attr_get_u8(attr);
 		} else if (type == TEAM_ATTR_PORT_REMOVED) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			dst->removed = true;
 		}
 	}
 
@@ -234,11 +227,11 @@ int team_item_option_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == TEAM_ATTR_ITEM_OPTION) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &team_attr_option_nest;
-			parg.data = &dst->option;
+			parg.data = &dst->option.emplace();
 			if (team_attr_option_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -260,11 +253,11 @@ int team_item_port_parse(struct ynl_parse_arg *yarg,
 		unsigned int type = ynl_attr_type(attr);
 
 		if (type == TEAM_ATTR_ITEM_PORT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &team_attr_port_nest;
-			parg.data = &dst->port;
+			parg.data = &dst->port.emplace();
 			if (team_attr_port_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -285,9 +278,12 @@ int team_noop_rsp_parse(const struct nlmsghdr *nlh, struct ynl_parse_arg *yarg)
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == TEAM_ATTR_TEAM_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->team_ifindex = (__u32)ynl_attr_get_u32(attr);
 		}
 	}
@@ -295,29 +291,48 @@ int team_noop_rsp_parse(const struct nlmsghdr *nlh, struct ynl_parse_arg *yarg)
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<team_noop_rsp> team_noop(ynl_cpp::ynl_socket&  ys)
+static ynl_cpp::result<std::unique_ptr<team_noop_rsp>>
+team_noop_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+	       const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<team_noop_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TEAM_CMD_NOOP, 1);
 	((struct ynl_sock*)ys)->req_policy = &team_nest;
 	yrs.yarg.rsp_policy = &team_nest;
 
 	rsp.reset(new team_noop_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = team_noop_rsp_parse;
 	yrs.rsp_cmd = TEAM_CMD_NOOP;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<team_noop_rsp>>
+team_noop_ex(ynl_cpp::ynl_socket&  ys, const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TEAM_CMD_NOOP, 1);
+
+	return team_noop_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<team_noop_rsp> team_noop(ynl_cpp::ynl_socket&  ys)
+{
+	auto ret = team_noop_ex(ys);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== TEAM_CMD_OPTIONS_SET ============== */
 /* TEAM_CMD_OPTIONS_SET - do */
 int team_options_set_rsp_parse(const struct nlmsghdr *nlh,
@@ -333,16 +348,19 @@ int team_options_set_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == TEAM_ATTR_TEAM_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->team_ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TEAM_ATTR_LIST_OPTION) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &team_item_option_nest;
-			parg.data = &dst->list_option;
+			parg.data = &dst->list_option.emplace();
 			if (team_item_option_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -351,35 +369,89 @@ int team_options_set_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<team_options_set_rsp>
-team_options_set(ynl_cpp::ynl_socket&  ys, team_options_set_req& req)
+static void
+team_options_set_put(struct nlmsghdr *nlh, team_options_set_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.team_ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TEAM_ATTR_TEAM_IFINDEX, req.team_ifindex.value());
+	if (req.list_option.has_value())
+		team_item_option_put(nlh, TEAM_ATTR_LIST_OPTION, req.list_option.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<team_options_set_rsp>>
+team_options_set_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<team_options_set_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TEAM_CMD_OPTIONS_SET, 1);
 	((struct ynl_sock*)ys)->req_policy = &team_nest;
 	yrs.yarg.rsp_policy = &team_nest;
 
-	if (req.team_ifindex.has_value())
-		ynl_attr_put_u32(nlh, TEAM_ATTR_TEAM_IFINDEX, req.team_ifindex.value());
-	if (req.list_option.has_value())
-		team_item_option_put(nlh, TEAM_ATTR_LIST_OPTION, req.list_option.value());
-
 	rsp.reset(new team_options_set_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = team_options_set_rsp_parse;
 	yrs.rsp_cmd = TEAM_CMD_OPTIONS_SET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<team_options_set_rsp>>
+team_options_set_ex(ynl_cpp::ynl_socket&  ys, team_options_set_req& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TEAM_CMD_OPTIONS_SET, 1);
+	team_options_set_put(nlh, req);
+
+	return team_options_set_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<team_options_set_rsp>
+team_options_set(ynl_cpp::ynl_socket&  ys, team_options_set_req& req)
+{
+	auto ret = team_options_set_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+team_options_set_prepare(ynl_cpp::ynl_socket&  ys, team_options_set_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TEAM_CMD_OPTIONS_SET, 1);
+	team_options_set_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<team_options_set_rsp>>
+team_options_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return team_options_set_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<team_options_set_rsp>
+team_options_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = team_options_set_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== TEAM_CMD_OPTIONS_GET ============== */
 /* TEAM_CMD_OPTIONS_GET - do */
 int team_options_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -395,16 +467,19 @@ int team_options_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == TEAM_ATTR_TEAM_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->team_ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TEAM_ATTR_LIST_OPTION) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &team_item_option_nest;
-			parg.data = &dst->list_option;
+			parg.data = &dst->list_option.emplace();
 			if (team_item_option_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -413,33 +488,87 @@ int team_options_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<team_options_get_rsp>
-team_options_get(ynl_cpp::ynl_socket&  ys, team_options_get_req& req)
+static void
+team_options_get_put(struct nlmsghdr *nlh, team_options_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.team_ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TEAM_ATTR_TEAM_IFINDEX, req.team_ifindex.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<team_options_get_rsp>>
+team_options_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+		      const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<team_options_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TEAM_CMD_OPTIONS_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &team_nest;
 	yrs.yarg.rsp_policy = &team_nest;
 
-	if (req.team_ifindex.has_value())
-		ynl_attr_put_u32(nlh, TEAM_ATTR_TEAM_IFINDEX, req.team_ifindex.value());
-
 	rsp.reset(new team_options_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = team_options_get_rsp_parse;
 	yrs.rsp_cmd = TEAM_CMD_OPTIONS_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<team_options_get_rsp>>
+team_options_get_ex(ynl_cpp::ynl_socket&  ys, team_options_get_req& req,
+		    const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TEAM_CMD_OPTIONS_GET, 1);
+	team_options_get_put(nlh, req);
+
+	return team_options_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<team_options_get_rsp>
+team_options_get(ynl_cpp::ynl_socket&  ys, team_options_get_req& req)
+{
+	auto ret = team_options_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+team_options_get_prepare(ynl_cpp::ynl_socket&  ys, team_options_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TEAM_CMD_OPTIONS_GET, 1);
+	team_options_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<team_options_get_rsp>>
+team_options_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj)
+{
+	return team_options_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<team_options_get_rsp>
+team_options_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = team_options_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 /* ============== TEAM_CMD_PORT_LIST_GET ============== */
 /* TEAM_CMD_PORT_LIST_GET - do */
 int team_port_list_get_rsp_parse(const struct nlmsghdr *nlh,
@@ -455,16 +584,19 @@ int team_port_list_get_rsp_parse(const struct nlmsghdr *nlh,
 	ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len) {
 		unsigned int type = ynl_attr_type(attr);
 
+		if (!ynl_attr_projected(yarg, type))
+			continue;
+
 		if (type == TEAM_ATTR_TEAM_IFINDEX) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) != sizeof(__u32))
+				return ynl_attr_invalid(yarg, attr, "u32");
 			dst->team_ifindex = (__u32)ynl_attr_get_u32(attr);
 		} else if (type == TEAM_ATTR_LIST_PORT) {
-			if (ynl_attr_validate(yarg, attr))
-				return YNL_PARSE_CB_ERROR;
+			if (ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr))
+				return ynl_attr_invalid(yarg, attr, "nest");
 
 			parg.rsp_policy = &team_item_port_nest;
-			parg.data = &dst->list_port;
+			parg.data = &dst->list_port.emplace();
 			if (team_item_port_parse(&parg, attr))
 				return YNL_PARSE_CB_ERROR;
 		}
@@ -473,33 +605,89 @@ int team_port_list_get_rsp_parse(const struct nlmsghdr *nlh,
 	return YNL_PARSE_CB_OK;
 }
 
-std::unique_ptr<team_port_list_get_rsp>
-team_port_list_get(ynl_cpp::ynl_socket&  ys, team_port_list_get_req& req)
+static void
+team_port_list_get_put(struct nlmsghdr *nlh, team_port_list_get_req& req)
+{
+	static_assert(NLMSG_HDRLEN + GENL_HDRLEN + 8 <= YNL_SOCKET_BUFFER_SIZE);
+
+	if (req.team_ifindex.has_value())
+		ynl_attr_put_u32_unchecked(nlh, TEAM_ATTR_TEAM_IFINDEX, req.team_ifindex.value());
+}
+
+static ynl_cpp::result<std::unique_ptr<team_port_list_get_rsp>>
+team_port_list_get_exec(ynl_cpp::ynl_socket&  ys, struct nlmsghdr *nlh,
+			const ynl_cpp::projection *proj)
 {
 	struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };
 	std::unique_ptr<team_port_list_get_rsp> rsp;
-	struct nlmsghdr *nlh;
 	int err;
 
-	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TEAM_CMD_PORT_LIST_GET, 1);
 	((struct ynl_sock*)ys)->req_policy = &team_nest;
 	yrs.yarg.rsp_policy = &team_nest;
 
-	if (req.team_ifindex.has_value())
-		ynl_attr_put_u32(nlh, TEAM_ATTR_TEAM_IFINDEX, req.team_ifindex.value());
-
 	rsp.reset(new team_port_list_get_rsp());
 	yrs.yarg.data = rsp.get();
+	yrs.yarg.proj = proj ? proj->words() : nullptr;
 	yrs.cb = team_port_list_get_rsp_parse;
 	yrs.rsp_cmd = TEAM_CMD_PORT_LIST_GET;
 
 	err = ynl_exec(ys, nlh, &yrs);
 	if (err < 0)
-		return nullptr;
+		return std::unexpected(ynl_cpp::error(ys));
 
 	return rsp;
 }
 
+ynl_cpp::result<std::unique_ptr<team_port_list_get_rsp>>
+team_port_list_get_ex(ynl_cpp::ynl_socket&  ys, team_port_list_get_req& req,
+		      const ynl_cpp::projection *proj)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TEAM_CMD_PORT_LIST_GET, 1);
+	team_port_list_get_put(nlh, req);
+
+	return team_port_list_get_exec(ys, nlh, proj);
+}
+
+std::unique_ptr<team_port_list_get_rsp>
+team_port_list_get(ynl_cpp::ynl_socket&  ys, team_port_list_get_req& req)
+{
+	auto ret = team_port_list_get_ex(ys, req);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
+ynl_cpp::result<ynl_cpp::request_template>
+team_port_list_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   team_port_list_get_req& req)
+{
+	struct nlmsghdr *nlh;
+
+	nlh = ynl_gemsg_start_req(ys, ((struct ynl_sock*)ys)->family_id, TEAM_CMD_PORT_LIST_GET, 1);
+	team_port_list_get_put(nlh, req);
+
+	return ynl_cpp::request_template::capture(ys, nlh);
+}
+
+ynl_cpp::result<std::unique_ptr<team_port_list_get_rsp>>
+team_port_list_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj)
+{
+	return team_port_list_get_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()), proj);
+}
+
+std::unique_ptr<team_port_list_get_rsp>
+team_port_list_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl)
+{
+	auto ret = team_port_list_get_ex(ys, tmpl);
+	if (!ret)
+		return nullptr;
+	return std::move(*ret);
+}
+
 const struct ynl_family ynl_team_family =  {
 	.name		= "team",
 	.hdr_len	= sizeof(struct genlmsghdr),
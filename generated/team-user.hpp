@@ -55,6 +55,17 @@ struct team_item_port {
 	std::optional<team_attr_port> port;
 };
 
+/* Policies and nested encoders */
+extern struct ynl_policy_nest team_attr_option_nest;
+extern struct ynl_policy_nest team_attr_port_nest;
+extern struct ynl_policy_nest team_item_option_nest;
+extern struct ynl_policy_nest team_item_port_nest;
+extern struct ynl_policy_nest team_nest;
+int team_attr_option_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			 const team_attr_option&  obj);
+int team_item_option_put(struct nlmsghdr *nlh, unsigned int attr_type,
+			 const team_item_option&  obj);
+
 /* ============== TEAM_CMD_NOOP ============== */
 /* TEAM_CMD_NOOP - do */
 
@@ -66,6 +77,9 @@ struct team_noop_rsp {
  * No operation
  */
 std::unique_ptr<team_noop_rsp> team_noop(ynl_cpp::ynl_socket&  ys);
+ynl_cpp::result<std::unique_ptr<team_noop_rsp>>
+team_noop_ex(ynl_cpp::ynl_socket&  ys,
+	     const ynl_cpp::projection *proj = nullptr);
 
 /* ============== TEAM_CMD_OPTIONS_SET ============== */
 /* TEAM_CMD_OPTIONS_SET - do */
@@ -84,6 +98,16 @@ struct team_options_set_rsp {
  */
 std::unique_ptr<team_options_set_rsp>
 team_options_set(ynl_cpp::ynl_socket&  ys, team_options_set_req& req);
+ynl_cpp::result<std::unique_ptr<team_options_set_rsp>>
+team_options_set_ex(ynl_cpp::ynl_socket&  ys, team_options_set_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+team_options_set_prepare(ynl_cpp::ynl_socket&  ys, team_options_set_req& req);
+std::unique_ptr<team_options_set_rsp>
+team_options_set(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<team_options_set_rsp>>
+team_options_set_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== TEAM_CMD_OPTIONS_GET ============== */
 /* TEAM_CMD_OPTIONS_GET - do */
@@ -91,6 +115,9 @@ struct team_options_get_req {
 	std::optional<__u32> team_ifindex;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t team_options_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct team_options_get_rsp {
 	std::optional<__u32> team_ifindex;
 	std::optional<team_item_option> list_option;
@@ -101,6 +128,16 @@ struct team_options_get_rsp {
  */
 std::unique_ptr<team_options_get_rsp>
 team_options_get(ynl_cpp::ynl_socket&  ys, team_options_get_req& req);
+ynl_cpp::result<std::unique_ptr<team_options_get_rsp>>
+team_options_get_ex(ynl_cpp::ynl_socket&  ys, team_options_get_req& req,
+		    const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+team_options_get_prepare(ynl_cpp::ynl_socket&  ys, team_options_get_req& req);
+std::unique_ptr<team_options_get_rsp>
+team_options_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<team_options_get_rsp>>
+team_options_get_ex(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl,
+		    const ynl_cpp::projection *proj = nullptr);
 
 /* ============== TEAM_CMD_PORT_LIST_GET ============== */
 /* TEAM_CMD_PORT_LIST_GET - do */
@@ -108,6 +145,9 @@ struct team_port_list_get_req {
 	std::optional<__u32> team_ifindex;
 };
 
+/* Upper bound of the encoded request size, for sizing buffers */
+inline constexpr size_t team_port_list_get_req_max_len = NLMSG_HDRLEN + GENL_HDRLEN + 8;
+
 struct team_port_list_get_rsp {
 	std::optional<__u32> team_ifindex;
 	std::optional<team_item_port> list_port;
@@ -118,6 +158,18 @@ struct team_port_list_get_rsp {
  */
 std::unique_ptr<team_port_list_get_rsp>
 team_port_list_get(ynl_cpp::ynl_socket&  ys, team_port_list_get_req& req);
+ynl_cpp::result<std::unique_ptr<team_port_list_get_rsp>>
+team_port_list_get_ex(ynl_cpp::ynl_socket&  ys, team_port_list_get_req& req,
+		      const ynl_cpp::projection *proj = nullptr);
+ynl_cpp::result<ynl_cpp::request_template>
+team_port_list_get_prepare(ynl_cpp::ynl_socket&  ys,
+			   team_port_list_get_req& req);
+std::unique_ptr<team_port_list_get_rsp>
+team_port_list_get(ynl_cpp::ynl_socket&  ys, ynl_cpp::request_template& tmpl);
+ynl_cpp::result<std::unique_ptr<team_port_list_get_rsp>>
+team_port_list_get_ex(ynl_cpp::ynl_socket&  ys,
+		      ynl_cpp::request_template& tmpl,
+		      const ynl_cpp::projection *proj = nullptr);
 
 } //namespace ynl_cpp
 #endif /* _LINUX_TEAM_GEN_H */
@@ -1,15 +1,339 @@
 // SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
 #include "ynl.hpp"
 
+#include <stdio.h>
+
+#include <algorithm>
+
 namespace ynl_cpp {
 ynl_socket::ynl_socket(const ynl_family& family, struct ynl_error* err) {
   sock_ = ynl_sock_create(&family, err);
 }
 
+ynl_socket::ynl_socket(
+    const ynl_family& family,
+    int netns_fd,
+    struct ynl_error* err) {
+  sock_ = ynl_sock_create_netns(&family, netns_fd, err);
+}
+
 ynl_socket::~ynl_socket() {
   if (sock_) {
     ynl_sock_destroy(sock_);
   }
 }
 
+error::error(const struct ynl_error& yerr)
+    : code_(yerr.code), attr_offs_(yerr.attr_offs) {
+  if (yerr.msg[0]) {
+    msg_.assign(yerr.msg);
+  }
+}
+
+const std::string& error::message() const {
+  if (!msg_.empty() || code_ == YNL_ERROR_NONE) {
+    return msg_;
+  }
+
+  if (sys_errno()) {
+    msg_.assign(strerror(sys_errno()));
+  } else {
+    msg_.assign("YNL error " + std::to_string(code_));
+  }
+  return msg_;
+}
+
+result<request_template> request_template::capture(
+    struct ynl_sock* ys,
+    struct nlmsghdr* nlh,
+    unsigned int hdr_len) {
+  request_template tmpl;
+
+  if (ynl_msg_end(ys, nlh) < 0) {
+    return std::unexpected(error(ys));
+  }
+
+  tmpl.hdr_len_ = hdr_len ?: ys->family->hdr_len;
+  tmpl.buf_.assign(
+      (unsigned char*)nlh, (unsigned char*)nlh + nlh->nlmsg_len);
+  return tmpl;
+}
+
+struct nlattr* request_template::find_attr(
+    std::initializer_list<unsigned int> path) {
+  struct nlmsghdr* msg = nlh();
+  unsigned char* start;
+  struct nlattr* attr;
+  size_t len;
+
+  start = (unsigned char*)ynl_nlmsg_data_offset(msg, hdr_len_);
+  len = (unsigned char*)ynl_nlmsg_end_addr(msg) - start;
+  attr = nullptr;
+
+  for (unsigned int type : path) {
+    ynl_attr_for_each_payload(start, len, attr) {
+      if (ynl_attr_type(attr) == type) {
+        break;
+      }
+    }
+    if (!attr) {
+      return nullptr;
+    }
+    start = (unsigned char*)ynl_attr_data(attr);
+    len = ynl_attr_data_len(attr);
+  }
+
+  return attr;
+}
+
+msg_batch::msg_batch(ynl_socket& ys, bool ack) : ys_(ys), ack_(ack) {}
+
+void msg_batch::clear() {
+  len_ = 0;
+  offs_.clear();
+  policies_.clear();
+  hdr_lens_.clear();
+}
+
+void msg_batch::pop_back() {
+  len_ = offs_.back();
+  offs_.pop_back();
+  policies_.pop_back();
+  hdr_lens_.pop_back();
+}
+
+struct nlmsghdr* msg_batch::msg_start(__u16 type, __u16 flags) {
+  struct nlmsghdr* nlh;
+
+  /* Generated encoders put fixed size attributes without bounds checks,
+   * they count on a message buffer of YNL_SOCKET_BUFFER_SIZE.
+   */
+  if (buf_.size() < len_ + YNL_SOCKET_BUFFER_SIZE) {
+    buf_.resize(std::max(buf_.size() * 2, len_ + YNL_SOCKET_BUFFER_SIZE));
+  }
+
+  nlh = ynl_nlmsg_put_header(&buf_[len_]);
+  nlh->nlmsg_type = type;
+  nlh->nlmsg_flags = NLM_F_REQUEST | flags | (ack_ ? NLM_F_ACK : 0);
+  /* buffer length, see ynl_msg_start() */
+  nlh->nlmsg_pid = YNL_SOCKET_BUFFER_SIZE;
+
+  return nlh;
+}
+
+struct nlmsghdr* msg_batch::gemsg_start(__u8 cmd, __u8 version) {
+  struct nlmsghdr* nlh = msg_start(ys_->family_id, 0);
+  struct genlmsghdr gehdr = {};
+
+  gehdr.cmd = cmd;
+  gehdr.version = version;
+  memcpy(
+      ynl_nlmsg_put_extra_header(nlh, sizeof(gehdr)), &gehdr, sizeof(gehdr));
+
+  return nlh;
+}
+
+result<size_t> msg_batch::msg_end(
+    struct nlmsghdr* nlh,
+    struct ynl_policy_nest* policy,
+    unsigned int hdr_len) {
+  if (ynl_msg_end(ys_, nlh) < 0) {
+    return std::unexpected(error(ys_));
+  }
+
+  offs_.push_back(len_);
+  policies_.push_back(policy);
+  hdr_lens_.push_back(hdr_len);
+  len_ += NLMSG_ALIGN(nlh->nlmsg_len);
+  return offs_.size() - 1;
+}
+
+struct msg_batch_acks {
+  msg_batch* batch;
+  struct ynl_sock* ys;
+  std::vector<struct ynl_policy_nest*>* policies;
+  std::vector<unsigned int>* hdr_lens;
+  std::vector<msg_batch::failure>* failures;
+  __u32 base;
+  /* messages [first, last) of the last send */
+  size_t first;
+  size_t last;
+  size_t acked;
+  /* replies, for send_recv() */
+  bool (*reply_cb)(size_t index, const struct nlmsghdr* nlh, void* data);
+  void* reply_data;
+  size_t replied;
+  bool reply_bad;
+};
+
+static int msg_batch_reply(const struct nlmsghdr* nlh, void* data) {
+  auto* a = (struct msg_batch_acks*)data;
+  size_t idx = nlh->nlmsg_seq - a->base;
+
+  /* stale answer, or a notification */
+  if (idx < a->first || idx >= a->last) {
+    return 0;
+  }
+  a->replied++;
+  if (!a->reply_cb(idx, nlh, a->reply_data)) {
+    a->reply_bad = true;
+    return -1;
+  }
+  return 0;
+}
+
+result<std::vector<msg_batch::failure>> msg_batch::send(bool atomic) {
+  return send(atomic, nullptr, nullptr, 0);
+}
+
+result<std::vector<msg_batch::failure>> msg_batch::send(
+    bool atomic,
+    reply_cb cb,
+    void* cb_data,
+    size_t window) {
+  std::vector<failure> failures;
+  struct msg_batch_acks acks = {};
+  size_t i, j, expected;
+  ssize_t max, limit;
+
+  acks.batch = this;
+  acks.ys = ys_;
+  acks.policies = &policies_;
+  acks.hdr_lens = &hdr_lens_;
+  acks.failures = &failures;
+  acks.base = ys_->seq + 1;
+  acks.reply_cb = cb;
+  acks.reply_data = cb_data;
+
+  for (i = 0; i < size(); i++) {
+    msg(i)->nlmsg_seq = acks.base + i;
+  }
+  ys_->seq += size();
+
+  max = ynl_batch_sndbuf(ys_, atomic ? len_ : 0);
+  if (max < 0) {
+    return std::unexpected(error(ys_));
+  }
+  if (atomic && (size_t)max < len_) {
+    struct ynl_error yerr = {};
+
+    yerr.code = (enum ynl_error_code)EMSGSIZE;
+    snprintf(
+        yerr.msg,
+        sizeof(yerr.msg),
+        "Batch of %zu bytes exceeds the socket send buffer (%zd)",
+        len_,
+        max);
+    return std::unexpected(error(yerr));
+  }
+
+  /* Any message may be answered, by an ACK or an error, and the answers
+   * of a send() are queued before they are read. An atomic batch can't be
+   * split, it only gets as much room as the socket allows.
+   */
+  limit = ynl_batch_rcvbuf(ys_, atomic ? size() : 0);
+  if (limit < 0) {
+    return std::unexpected(error(ys_));
+  }
+  if (atomic) {
+    limit = size();
+  } else if (window && window < (size_t)limit) {
+    limit = window;
+  }
+
+  for (i = 0; i < size(); i = j) {
+    size_t end, failed = failures.size();
+
+    /* As many messages as fit, but at least one */
+    expected = !!(msg(i)->nlmsg_flags & NLM_F_ACK);
+    for (j = i + 1; j < size() && j - i < (size_t)limit; j++) {
+      end = j + 1 < size() ? offs_[j + 1] : len_;
+      if (end - offs_[i] > (size_t)max) {
+        break;
+      }
+      expected += !!(msg(j)->nlmsg_flags & NLM_F_ACK);
+    }
+    end = j < size() ? offs_[j] : len_;
+
+    if (ynl_batch_send(ys_, &buf_[offs_[i]], end - offs_[i]) < 0) {
+      return std::unexpected(error(ys_));
+    }
+
+    acks.first = i;
+    acks.last = j;
+    acks.acked = 0;
+    acks.replied = 0;
+    acks.reply_bad = false;
+    if (ynl_batch_recv_acks(
+            ys_,
+            [](const struct nlmsghdr* ack, void* data) -> int {
+              auto* a = (struct msg_batch_acks*)data;
+              const struct nlmsgerr* err =
+                  (const struct nlmsgerr*)ynl_nlmsg_data(ack);
+              size_t idx = ack->nlmsg_seq - a->base;
+
+              /* stale answer, e.g. to an earlier batch which failed */
+              if (idx < a->first || idx >= a->last) {
+                return 0;
+              }
+              a->acked++;
+              if (!err->error) {
+                return 0;
+              }
+
+              ynl_batch_ack_decode(
+                  a->ys,
+                  ack,
+                  a->batch->msg(idx),
+                  (*a->policies)[idx],
+                  (*a->hdr_lens)[idx]);
+              a->failures->push_back({idx, error(a->ys)});
+              return 0;
+            },
+            cb ? msg_batch_reply : nullptr,
+            &acks) < 0) {
+      if (acks.reply_bad) {
+        struct ynl_error yerr = {};
+
+        yerr.code = YNL_ERROR_INV_RESP;
+        snprintf(
+            yerr.msg,
+            sizeof(yerr.msg),
+            "Error parsing response: malformed message");
+        return std::unexpected(error(yerr));
+      }
+      return std::unexpected(error(ys_));
+    }
+
+    /* Every message gets either its reply or an error */
+    if (cb && acks.replied + failures.size() - failed < j - i) {
+      struct ynl_error yerr = {};
+
+      yerr.code = YNL_ERROR_INV_RESP;
+      snprintf(
+          yerr.msg,
+          sizeof(yerr.msg),
+          "Expected %zu replies for the batch, got %zu",
+          j - i - (failures.size() - failed),
+          acks.replied);
+      return std::unexpected(error(yerr));
+    }
+
+    if (acks.acked < expected) {
+      struct ynl_error yerr = {};
+
+      yerr.code = YNL_ERROR_EXPECT_ACK;
+      snprintf(
+          yerr.msg,
+          sizeof(yerr.msg),
+          "Expected %zu ACKs for the batch, got %zu",
+          expected,
+          acks.acked);
+      return std::unexpected(error(yerr));
+    }
+  }
+
+  return failures;
+}
+
 } // namespace ynl_cpp
@@ -0,0 +1,882 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "ynl-dyn.hpp"
+
+#include <endian.h>
+#include <errno.h>
+#include <stdio.h>
+
+#include <fstream>
+#include <iterator>
+
+namespace ynl_cpp {
+
+/* Header of the binary spec, see render_blob() in ynl-gen-cpp.py */
+#define DYN_BLOB_MAGIC 0x424c4e59
+#define DYN_BLOB_VERSION 2
+#define DYN_BLOB_NONE 0xffff
+/* Fixed headers are a few dozen bytes, anything bigger is a broken blob */
+#define DYN_BLOB_MAX_STRUCT 1024
+
+static error dyn_error(enum ynl_error_code code, const std::string& msg) {
+  struct ynl_error yerr = {};
+
+  yerr.code = code;
+  snprintf(yerr.msg, sizeof(yerr.msg), "%s", msg.c_str());
+  return error(yerr);
+}
+
+/* Bounds checked little endian reader, any overrun sticks in @ok */
+struct dyn_blob_reader {
+  const unsigned char* p;
+  const unsigned char* end;
+  bool ok{true};
+
+  bool have(size_t n) {
+    ok = ok && (size_t)(end - p) >= n;
+    return ok;
+  }
+
+  __u8 u8() {
+    return have(1) ? *p++ : 0;
+  }
+
+  __u16 u16() {
+    __u16 v;
+
+    if (!have(2)) {
+      return 0;
+    }
+    memcpy(&v, p, 2);
+    p += 2;
+    return le16toh(v);
+  }
+
+  __u32 u32() {
+    __u32 v;
+
+    if (!have(4)) {
+      return 0;
+    }
+    memcpy(&v, p, 4);
+    p += 4;
+    return le32toh(v);
+  }
+
+  std::string str() {
+    __u16 len = u16();
+    std::string s;
+
+    if (have(len)) {
+      s.assign((const char*)p, len);
+      p += len;
+    }
+    return s;
+  }
+};
+
+static bool dyn_type_valid(__u8 type) {
+  return type <= (__u8)dyn_type::bitfield32;
+}
+
+/* Length a fixed header member of @kind must have, 0 for any, -1 if none */
+static int dyn_member_len(dyn_type kind) {
+  switch (kind) {
+    case dyn_type::unused:
+    case dyn_type::binary:
+      return 0;
+    case dyn_type::u8:
+    case dyn_type::s8:
+      return 1;
+    case dyn_type::u16:
+    case dyn_type::s16:
+      return 2;
+    case dyn_type::u32:
+    case dyn_type::s32:
+      return 4;
+    case dyn_type::u64:
+    case dyn_type::s64:
+      return 8;
+    default:
+      return -1;
+  }
+}
+
+static enum ynl_policy_type dyn_policy_type(dyn_type kind) {
+  switch (kind) {
+    case dyn_type::flag:
+      return YNL_PT_FLAG;
+    case dyn_type::u8:
+    case dyn_type::s8:
+      return YNL_PT_U8;
+    case dyn_type::u16:
+    case dyn_type::s16:
+      return YNL_PT_U16;
+    case dyn_type::u32:
+    case dyn_type::s32:
+      return YNL_PT_U32;
+    case dyn_type::u64:
+    case dyn_type::s64:
+      return YNL_PT_U64;
+    case dyn_type::uint:
+    case dyn_type::sint:
+      return YNL_PT_UINT;
+    case dyn_type::string:
+      return YNL_PT_NUL_STR;
+    case dyn_type::binary:
+      return YNL_PT_BINARY;
+    case dyn_type::nest:
+    case dyn_type::indexed_array:
+    case dyn_type::nest_type_value:
+      return YNL_PT_NEST;
+    case dyn_type::bitfield32:
+      return YNL_PT_BITFIELD32;
+    default:
+      return YNL_PT_IGNORE;
+  }
+}
+
+const dyn_attr* dyn_attr_set::find(std::string_view attr_name) const {
+  auto it = by_name.find(attr_name);
+
+  return it == by_name.end() ? nullptr : it->second;
+}
+
+const dyn_struct_member* dyn_struct::find(std::string_view member) const {
+  for (const auto& m : members) {
+    if (m.name == member) {
+      return &m;
+    }
+  }
+  return nullptr;
+}
+
+const dyn_value* dyn_value::get(std::string_view attr_name) const {
+  for (const auto& v : nest) {
+    if (v.attr && v.attr->name == attr_name) {
+      return &v;
+    }
+  }
+  return nullptr;
+}
+
+result<std::unique_ptr<dyn_family>> dyn_family::load(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+
+  if (!in) {
+    return std::unexpected(dyn_error(
+        (enum ynl_error_code)errno,
+        "failed to open " + path + ": " + strerror(errno)));
+  }
+  std::vector<unsigned char> blob(
+      (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+  return parse(blob);
+}
+
+result<std::unique_ptr<dyn_family>> dyn_family::parse(
+    std::span<const unsigned char> blob) {
+  std::unique_ptr<dyn_family> fam(new dyn_family());
+
+  if (!fam->parse_blob(blob)) {
+    return std::unexpected(
+        dyn_error(YNL_ERROR_INPUT_INVALID, "invalid or unsupported spec blob"));
+  }
+  return fam;
+}
+
+bool dyn_family::parse_blob(std::span<const unsigned char> blob) {
+  dyn_blob_reader r{blob.data(), blob.data() + blob.size()};
+  std::vector<std::vector<__u16>> nested_idx;
+  __u16 n, hdr_idx;
+  bool classic;
+  __u8 protonum;
+
+  if (r.u32() != DYN_BLOB_MAGIC || r.u16() != DYN_BLOB_VERSION) {
+    return false;
+  }
+  r.u16(); /* flags */
+  name_ = r.str();
+  classic = r.u8();
+  protonum = r.u8();
+  version_ = r.u8();
+
+  n = r.u16();
+  for (__u16 i = 0; i < n && r.ok; i++) {
+    auto& st = structs_.emplace_back(std::make_unique<dyn_struct>());
+    __u16 n_members;
+
+    st->name = r.str();
+    st->size = 0;
+    n_members = r.u16();
+    for (__u16 j = 0; j < n_members && r.ok; j++) {
+      auto& m = st->members.emplace_back();
+      __u8 kind;
+
+      int want;
+
+      m.name = r.str();
+      kind = r.u8();
+      m.big_endian = r.u8();
+      m.offset = r.u16();
+      m.len = r.u16();
+      if (!dyn_type_valid(kind)) {
+        return false;
+      }
+      m.kind = (dyn_type)kind;
+      /* set_hdr() writes as many bytes as the kind says */
+      want = dyn_member_len(m.kind);
+      if (want < 0 || (want && m.len != (unsigned int)want) ||
+          m.offset + m.len > DYN_BLOB_MAX_STRUCT) {
+        return false;
+      }
+      st->size = std::max(st->size, m.offset + m.len);
+    }
+  }
+  hdr_idx = r.u16();
+  if (hdr_idx != DYN_BLOB_NONE && hdr_idx >= structs_.size()) {
+    return false;
+  }
+
+  n = r.u16();
+  for (__u16 i = 0; i < n && r.ok; i++) {
+    auto& set = sets_.emplace_back(std::make_unique<dyn_attr_set>());
+    auto& nested = nested_idx.emplace_back();
+    __u16 n_attrs;
+
+    set->name = r.str();
+    n_attrs = r.u16();
+    for (__u16 j = 0; j < n_attrs && r.ok; j++) {
+      auto& a = set->attrs.emplace_back();
+      __u8 kind, sub_kind, flags;
+
+      a.name = r.str();
+      a.type = r.u16();
+      kind = r.u8();
+      flags = r.u8();
+      sub_kind = r.u8();
+      nested.push_back(r.u16());
+      a.len = r.u16();
+      if (!dyn_type_valid(kind) || !dyn_type_valid(sub_kind)) {
+        return false;
+      }
+      a.kind = (dyn_type)kind;
+      a.sub_kind = (dyn_type)sub_kind;
+      a.big_endian = flags & 1;
+      a.multi = flags & 2;
+      a.nested = nullptr;
+    }
+  }
+
+  n = r.u16();
+  for (__u16 i = 0; i < n && r.ok; i++) {
+    auto& op = ops_.emplace_back(std::make_unique<dyn_op>());
+    __u16 set_idx, op_hdr_idx;
+    __u8 modes;
+
+    op->name = r.str();
+    op->req_value = r.u32();
+    op->rsp_value = r.u32();
+    set_idx = r.u16();
+    op_hdr_idx = r.u16();
+    modes = r.u8();
+    if ((set_idx != DYN_BLOB_NONE && set_idx >= sets_.size()) ||
+        (op_hdr_idx != DYN_BLOB_NONE && op_hdr_idx >= structs_.size())) {
+      return false;
+    }
+    op->set = set_idx == DYN_BLOB_NONE ? nullptr : sets_[set_idx].get();
+    op->hdr =
+        op_hdr_idx == DYN_BLOB_NONE ? nullptr : structs_[op_hdr_idx].get();
+    op->has_do = modes & 1;
+    op->has_dump = modes & 2;
+    op->do_reply = modes & 4;
+  }
+
+  n = r.u16();
+  for (__u16 i = 0; i < n && r.ok; i++) {
+    grp_names_.push_back(r.str());
+    grps_.push_back({nullptr, r.u32()});
+  }
+  if (!r.ok) {
+    return false;
+  }
+
+  /* All sets are read, resolve nests and build the lookup tables */
+  for (size_t i = 0; i < sets_.size(); i++) {
+    auto& set = *sets_[i];
+    unsigned int max_type = 0;
+
+    for (size_t j = 0; j < set.attrs.size(); j++) {
+      auto& a = set.attrs[j];
+
+      if (nested_idx[i][j] != DYN_BLOB_NONE) {
+        if (nested_idx[i][j] >= sets_.size()) {
+          return false;
+        }
+        a.nested = sets_[nested_idx[i][j]].get();
+      }
+      max_type = std::max<unsigned int>(max_type, a.type);
+    }
+
+    set.by_type.assign(max_type + 1, nullptr);
+    set.policy_table.assign(max_type + 1, {});
+    for (auto& a : set.attrs) {
+      set.by_type[a.type] = &a;
+      set.by_name.emplace(a.name, &a);
+      set.policy_table[a.type] = {
+          .name = a.name.c_str(),
+          .type = dyn_policy_type(a.kind),
+          .len = a.kind == dyn_type::binary ? a.len : 0,
+          .nest = nullptr,
+      };
+    }
+    set.policy.max_attr = max_type;
+    set.policy.table = set.policy_table.data();
+  }
+  for (auto& set : sets_) {
+    for (auto& a : set->attrs) {
+      if (a.nested) {
+        set->policy_table[a.type].nest =
+            const_cast<struct ynl_policy_nest*>(&a.nested->policy);
+      }
+    }
+  }
+  for (auto& op : ops_) {
+    ops_by_name_.emplace(op->name, op.get());
+  }
+  for (size_t i = 0; i < grps_.size(); i++) {
+    grps_[i].name = grp_names_[i].c_str();
+  }
+
+  yf_.name = name_.c_str();
+  yf_.hdr_len = hdr_idx == DYN_BLOB_NONE ? 0 : structs_[hdr_idx]->size;
+  if (!classic) {
+    yf_.hdr_len += sizeof(struct genlmsghdr);
+  }
+  yf_.is_classic = classic;
+  yf_.classic_id = protonum;
+  /* Generic Netlink groups are resolved by name by the controller */
+  if (classic) {
+    yf_.mcast_groups = grps_.data();
+    yf_.n_mcast_groups = grps_.size();
+  }
+  return true;
+}
+
+const dyn_op* dyn_family::op(std::string_view op_name) const {
+  auto it = ops_by_name_.find(op_name);
+
+  return it == ops_by_name_.end() ? nullptr : it->second;
+}
+
+const dyn_attr_set* dyn_family::attr_set(std::string_view set_name) const {
+  for (const auto& set : sets_) {
+    if (set->name == set_name) {
+      return set.get();
+    }
+  }
+  return nullptr;
+}
+
+unsigned int dyn_family::hdr_len(const dyn_op& op) const {
+  unsigned int len = op.hdr ? op.hdr->size : 0;
+
+  return is_classic() ? len : len + sizeof(struct genlmsghdr);
+}
+
+static __u64 dyn_get_int(const struct nlattr* attr, unsigned int len, bool be) {
+  const void* data = ynl_attr_data(attr);
+  __u16 v16;
+  __u32 v32;
+  __u64 v64;
+
+  switch (len) {
+    case 1:
+      return *(const __u8*)data;
+    case 2:
+      memcpy(&v16, data, 2);
+      return be ? be16toh(v16) : v16;
+    case 4:
+      memcpy(&v32, data, 4);
+      return be ? be32toh(v32) : v32;
+    default:
+      memcpy(&v64, data, 8);
+      return be ? be64toh(v64) : v64;
+  }
+}
+
+static __u64 dyn_sign_extend(__u64 v, unsigned int len) {
+  unsigned int shift = 64 - len * 8;
+
+  return (__u64)((__s64)(v << shift) >> shift);
+}
+
+bool dyn_family::decode_entry(
+    const dyn_attr& spec,
+    dyn_type kind,
+    unsigned int levels,
+    const struct nlattr* attr,
+    dyn_value& val) const {
+  const unsigned char* data = (const unsigned char*)ynl_attr_data(attr);
+  unsigned int len = ynl_attr_data_len(attr);
+  const struct nlattr* entry;
+
+  val.attr = &spec;
+  val.type = ynl_attr_type(attr);
+
+  switch (kind) {
+    case dyn_type::flag:
+      val.num = 1;
+      return true;
+    case dyn_type::u8:
+    case dyn_type::u16:
+    case dyn_type::u32:
+    case dyn_type::u64:
+      if (len != 1U << ((unsigned int)kind - (unsigned int)dyn_type::u8)) {
+        return false;
+      }
+      val.num = dyn_get_int(attr, len, spec.big_endian);
+      return true;
+    case dyn_type::s8:
+    case dyn_type::s16:
+    case dyn_type::s32:
+    case dyn_type::s64:
+      if (len != 1U << ((unsigned int)kind - (unsigned int)dyn_type::s8)) {
+        return false;
+      }
+      val.num = dyn_sign_extend(dyn_get_int(attr, len, spec.big_endian), len);
+      return true;
+    case dyn_type::uint:
+    case dyn_type::sint:
+      if (len != 4 && len != 8) {
+        return false;
+      }
+      val.num = dyn_get_int(attr, len, spec.big_endian);
+      if (kind == dyn_type::sint) {
+        val.num = dyn_sign_extend(val.num, len);
+      }
+      return true;
+    case dyn_type::string:
+      val.data.assign((const char*)data, strnlen((const char*)data, len));
+      return true;
+    case dyn_type::bitfield32:
+      if (len != sizeof(struct nla_bitfield32)) {
+        return false;
+      }
+      val.num = dyn_get_int(attr, 8, false);
+      return true;
+    case dyn_type::nest:
+      return decode_attrs(spec.nested, data, len, val.nest);
+    case dyn_type::indexed_array:
+      ynl_attr_for_each_payload(data, len, entry) {
+        if (!decode_entry(
+                spec, spec.sub_kind, 0, entry, val.nest.emplace_back())) {
+          return false;
+        }
+      }
+      return true;
+    case dyn_type::nest_type_value:
+      if (!levels) {
+        return decode_attrs(spec.nested, data, len, val.nest);
+      }
+      ynl_attr_for_each_payload(data, len, entry) {
+        if (!decode_entry(
+                spec, kind, levels - 1, entry, val.nest.emplace_back())) {
+          return false;
+        }
+      }
+      return true;
+    default:
+      val.data.assign((const char*)data, len);
+      return true;
+  }
+}
+
+bool dyn_family::decode_attrs(
+    const dyn_attr_set* set,
+    const unsigned char* start,
+    size_t len,
+    std::vector<dyn_value>& out) const {
+  const struct nlattr* attr;
+
+  ynl_attr_for_each_payload(start, len, attr) {
+    const dyn_attr* spec = set ? set->find(ynl_attr_type(attr)) : nullptr;
+    dyn_value& val = out.emplace_back();
+
+    if (!spec) {
+      val.type = ynl_attr_type(attr);
+      val.data.assign(
+          (const char*)ynl_attr_data(attr), ynl_attr_data_len(attr));
+      continue;
+    }
+    if (!decode_entry(*spec, spec->kind, spec->len, attr, val)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool dyn_family::decode(
+    const dyn_op& op,
+    const struct nlmsghdr* nlh,
+    dyn_value& out) const {
+  unsigned int hlen = hdr_len(op), fixed = op.hdr ? op.hdr->size : 0;
+
+  if (nlh->nlmsg_len < NLMSG_HDRLEN + hlen) {
+    return false;
+  }
+
+  out.attr = nullptr;
+  out.type = 0;
+  out.data.assign(
+      (const char*)ynl_nlmsg_data_offset(nlh, hlen - fixed), fixed);
+  out.nest.clear();
+  return decode_attrs(
+      op.set,
+      (const unsigned char*)ynl_nlmsg_data_offset(nlh, hlen),
+      nlh->nlmsg_len - NLMSG_HDRLEN - hlen,
+      out.nest);
+}
+
+static void dyn_sock_err(struct ynl_sock* ys, const error& err) {
+  ys->err.code = err.code();
+  ys->err.attr_offs = 0;
+  snprintf(ys->err.msg, sizeof(ys->err.msg), "%s", err.message().c_str());
+}
+
+struct nlmsghdr* dyn_family::start(ynl_socket& ys, dyn_request& req) const {
+  struct nlmsghdr* nlh = req.nlh();
+  struct ynl_sock* sock = ys;
+
+  if (!req.err_ && !req.nests_.empty()) {
+    req.fail(YNL_ERROR_INPUT_INVALID, "Request has unterminated nests");
+  }
+  if (!req.err_ && nlh->nlmsg_pid == YNL_MSG_OVERFLOW) {
+    req.fail(
+        YNL_ERROR_INPUT_TOO_BIG,
+        "Constructed message longer than the request buffer");
+  }
+  if (req.err_) {
+    dyn_sock_err(sock, *req.err_);
+    return nullptr;
+  }
+
+  if (!is_classic()) {
+    nlh->nlmsg_type = sock->family_id;
+  }
+  ynl_msg_reuse(sock, nlh);
+  sock->req_hdr_len = hdr_len(req.op());
+  sock->req_policy =
+      req.op().set ? const_cast<struct ynl_policy_nest*>(&req.op().set->policy)
+                   : nullptr;
+  return nlh;
+}
+
+struct dyn_parse_arg {
+  const dyn_family* fam;
+  const dyn_op* op;
+  dyn_value* val;
+};
+
+result<dyn_value> dyn_family::exec(ynl_socket& ys, dyn_request& req) const {
+  struct dyn_parse_arg arg = {this, &req.op(), nullptr};
+  struct ynl_req_state yrs = {};
+  struct nlmsghdr* nlh;
+  dyn_value val;
+
+  yrs.yarg.ys = ys;
+  if (req.is_dump()) {
+    return std::unexpected(
+        dyn_error(YNL_ERROR_INPUT_INVALID, "Dump request passed to exec()"));
+  }
+  nlh = start(ys, req);
+  if (!nlh) {
+    return std::unexpected(error(ys));
+  }
+
+  if (req.op().do_reply) {
+    arg.val = &val;
+    yrs.yarg.data = &arg;
+    yrs.cb = [](const struct nlmsghdr* msg, struct ynl_parse_arg* yarg) -> int {
+      auto* a = (struct dyn_parse_arg*)yarg->data;
+
+      if (!a->fam->decode(*a->op, msg, *a->val)) {
+        return ynl_error_parse(yarg, "malformed message");
+      }
+      return YNL_PARSE_CB_OK;
+    };
+    yrs.rsp_cmd = req.op().rsp_value;
+  }
+
+  if (ynl_exec(ys, nlh, &yrs) < 0) {
+    return std::unexpected(error(ys));
+  }
+  return val;
+}
+
+result<std::vector<dyn_value>> dyn_family::dump(
+    ynl_socket& ys,
+    dyn_request& req) const {
+  const dyn_op& op = req.op();
+  std::vector<dyn_value> out;
+
+  if (!req.is_dump()) {
+    return std::unexpected(
+        dyn_error(YNL_ERROR_INPUT_INVALID, "Do request passed to dump()"));
+  }
+
+  auto ret = dump_raw(ys, req, [&](const struct nlmsghdr* nlh) {
+    return decode(op, nlh, out.emplace_back());
+  });
+  if (!ret) {
+    return std::unexpected(ret.error());
+  }
+  return out;
+}
+
+dyn_request::dyn_request(
+    const dyn_family& family,
+    const dyn_op& op,
+    bool dump,
+    __u16 flags,
+    size_t max_len)
+    : op_(&op), dump_(dump), buf_(max_len), max_len_(max_len) {
+  size_t hdrs = NLMSG_HDRLEN + family.hdr_len(op);
+  struct nlmsghdr* msg;
+
+  /* Fail rather than overflow, the headers are encoded regardless */
+  if (NLMSG_ALIGN(hdrs) > max_len) {
+    buf_.resize(NLMSG_ALIGN(hdrs));
+    fail(
+        YNL_ERROR_INPUT_INVALID,
+        "Headers of " + op.name + " (" + std::to_string(hdrs) +
+            " bytes) exceed the message length of " +
+            std::to_string(max_len));
+  }
+  msg = ynl_nlmsg_put_header(buf_.data());
+
+  msg->nlmsg_type = family.is_classic() ? op.req_value : 0;
+  msg->nlmsg_flags =
+      NLM_F_REQUEST | NLM_F_ACK | (dump ? NLM_F_DUMP : 0) | flags;
+  /* buffer length, see ynl_msg_start() */
+  msg->nlmsg_pid = max_len;
+
+  if (!family.is_classic()) {
+    struct genlmsghdr gehdr = {};
+
+    gehdr.cmd = op.req_value;
+    gehdr.version = family.version();
+    memcpy(
+        ynl_nlmsg_put_extra_header(msg, sizeof(gehdr)), &gehdr, sizeof(gehdr));
+  }
+  hdr_off_ = msg->nlmsg_len;
+  if (op.hdr) {
+    ynl_nlmsg_put_extra_header(msg, op.hdr->size);
+  }
+
+  if (dump ? !op.has_dump : !op.has_do) {
+    fail(
+        YNL_ERROR_INPUT_INVALID,
+        "Operation " + op.name + " has no " + (dump ? "dump" : "do"));
+  }
+}
+
+void dyn_request::fail(enum ynl_error_code code, const std::string& msg) {
+  if (!err_) {
+    err_ = dyn_error(code, msg);
+  }
+}
+
+std::span<unsigned char> dyn_request::hdr() {
+  return {&buf_[hdr_off_], op_->hdr ? op_->hdr->size : 0};
+}
+
+dyn_request& dyn_request::set_hdr(std::string_view member, __u64 value) {
+  const dyn_struct_member* m = op_->hdr ? op_->hdr->find(member) : nullptr;
+  unsigned char* dst;
+
+  if (!m) {
+    fail(
+        YNL_ERROR_INPUT_INVALID,
+        "Unknown fixed header member " + std::string(member));
+    return *this;
+  }
+  dst = &buf_[hdr_off_ + m->offset];
+
+  switch (m->kind) {
+    case dyn_type::u8:
+    case dyn_type::s8:
+      *dst = value;
+      break;
+    case dyn_type::u16:
+    case dyn_type::s16: {
+      __u16 v = m->big_endian ? htobe16(value) : value;
+
+      memcpy(dst, &v, sizeof(v));
+      break;
+    }
+    case dyn_type::u32:
+    case dyn_type::s32: {
+      __u32 v = m->big_endian ? htobe32(value) : value;
+
+      memcpy(dst, &v, sizeof(v));
+      break;
+    }
+    case dyn_type::u64:
+    case dyn_type::s64: {
+      __u64 v = m->big_endian ? htobe64(value) : value;
+
+      memcpy(dst, &v, sizeof(v));
+      break;
+    }
+    default:
+      fail(
+          YNL_ERROR_INPUT_INVALID,
+          "Fixed header member " + m->name + " is not a number");
+  }
+  return *this;
+}
+
+const dyn_attr* dyn_request::lookup(std::string_view name) {
+  const dyn_attr_set* set;
+  const dyn_attr* attr;
+
+  if (err_) {
+    return nullptr;
+  }
+  /* Executed, the length stashed for overflow checks has been cleared */
+  if (!nlh()->nlmsg_pid) {
+    nlh()->nlmsg_pid = max_len_;
+  }
+
+  set = nests_.empty() ? op_->set : nests_.back().second;
+  attr = set ? set->find(name) : nullptr;
+  if (!attr) {
+    fail(YNL_ERROR_INPUT_INVALID, "Unknown attribute " + std::string(name));
+  }
+  return attr;
+}
+
+dyn_request& dyn_request::put(std::string_view name, __u64 value) {
+  const dyn_attr* attr = lookup(name);
+  struct nlmsghdr* msg = nlh();
+
+  if (!attr) {
+    return *this;
+  }
+
+  switch (attr->kind) {
+    case dyn_type::flag:
+      if (value) {
+        ynl_attr_put(msg, attr->type, nullptr, 0);
+      }
+      break;
+    case dyn_type::u8:
+    case dyn_type::s8:
+      ynl_attr_put_u8(msg, attr->type, value);
+      break;
+    case dyn_type::u16:
+    case dyn_type::s16:
+      ynl_attr_put_u16(
+          msg, attr->type, attr->big_endian ? htobe16(value) : value);
+      break;
+    case dyn_type::u32:
+    case dyn_type::s32:
+      ynl_attr_put_u32(
+          msg, attr->type, attr->big_endian ? htobe32(value) : value);
+      break;
+    case dyn_type::u64:
+    case dyn_type::s64:
+      ynl_attr_put_u64(
+          msg, attr->type, attr->big_endian ? htobe64(value) : value);
+      break;
+    case dyn_type::uint:
+      ynl_attr_put_uint(msg, attr->type, value);
+      break;
+    case dyn_type::sint:
+      ynl_attr_put_sint(msg, attr->type, (__s64)value);
+      break;
+    case dyn_type::bitfield32: {
+      struct nla_bitfield32 bf = {};
+
+      bf.value = value;
+      bf.selector = value >> 32;
+      ynl_attr_put(msg, attr->type, &bf, sizeof(bf));
+      break;
+    }
+    default:
+      fail(
+          YNL_ERROR_INPUT_INVALID,
+          "Attribute " + attr->name + " is not a number");
+  }
+  return *this;
+}
+
+dyn_request& dyn_request::put(std::string_view name, std::string_view str) {
+  const dyn_attr* attr = lookup(name);
+  struct nlmsghdr* msg = nlh();
+  struct nlattr* nla;
+
+  if (!attr) {
+    return *this;
+  }
+
+  switch (attr->kind) {
+    case dyn_type::string:
+      /* Include the terminating NUL, kernel NUL strings must have it */
+      if (__ynl_attr_put_overflow(msg, str.size() + 1)) {
+        break;
+      }
+      nla = (struct nlattr*)ynl_nlmsg_end_addr(msg);
+      nla->nla_type = attr->type;
+      nla->nla_len = NLA_HDRLEN + str.size() + 1;
+      memcpy(ynl_attr_data(nla), str.data(), str.size());
+      ((char*)ynl_attr_data(nla))[str.size()] = 0;
+      msg->nlmsg_len += NLMSG_ALIGN(nla->nla_len);
+      break;
+    case dyn_type::binary:
+      ynl_attr_put(msg, attr->type, str.data(), str.size());
+      break;
+    default:
+      fail(
+          YNL_ERROR_INPUT_INVALID,
+          "Attribute " + attr->name + " is not a string");
+  }
+  return *this;
+}
+
+dyn_request& dyn_request::put(
+    std::string_view name,
+    std::span<const __u8> data) {
+  return put(name, std::string_view((const char*)data.data(), data.size()));
+}
+
+dyn_request& dyn_request::nest_start(std::string_view name) {
+  const dyn_attr* attr = lookup(name);
+
+  if (!attr) {
+    return *this;
+  }
+  if (attr->kind != dyn_type::nest) {
+    fail(YNL_ERROR_INPUT_INVALID, "Attribute " + attr->name + " is not a nest");
+    return *this;
+  }
+
+  nests_.emplace_back(ynl_attr_nest_start(nlh(), attr->type), attr->nested);
+  return *this;
+}
+
+dyn_request& dyn_request::nest_end() {
+  if (err_) {
+    return *this;
+  }
+  if (nests_.empty()) {
+    fail(YNL_ERROR_INPUT_INVALID, "No nest to end");
+    return *this;
+  }
+
+  ynl_attr_nest_end(nlh(), nests_.back().first);
+  nests_.pop_back();
+  return *this;
+}
+
+} // namespace ynl_cpp
@@ -0,0 +1,308 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_DYN_H
+#define __YNL_CPP_DYN_H 1
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ynl.hpp"
+
+namespace ynl_cpp {
+
+/* Attribute and struct member types, as numbered by ynl-gen-cpp.py */
+enum class dyn_type : __u8 {
+  unused,
+  flag,
+  u8,
+  u16,
+  u32,
+  u64,
+  s8,
+  s16,
+  s32,
+  s64,
+  uint,
+  sint,
+  string,
+  binary,
+  nest,
+  indexed_array,
+  nest_type_value,
+  bitfield32,
+};
+
+struct dyn_attr_set;
+
+struct dyn_attr {
+  std::string name;
+  __u16 type;
+  dyn_type kind;
+  /* type of the entries of an indexed-array */
+  dyn_type sub_kind;
+  bool big_endian;
+  bool multi;
+  /* length of fixed size binaries, levels of a nest-type-value */
+  unsigned int len;
+  const dyn_attr_set* nested;
+};
+
+struct dyn_attr_set {
+  std::string name;
+  std::vector<dyn_attr> attrs;
+
+  const dyn_attr* find(__u16 type) const {
+    return type < by_type.size() ? by_type[type] : nullptr;
+  }
+  const dyn_attr* find(std::string_view name) const;
+
+  /* private: */
+  std::vector<const dyn_attr*> by_type;
+  std::unordered_map<std::string_view, const dyn_attr*> by_name;
+  /* the runtime's view, names attributes in extack errors */
+  std::vector<struct ynl_policy_attr> policy_table;
+  struct ynl_policy_nest policy;
+};
+
+struct dyn_struct_member {
+  std::string name;
+  dyn_type kind;
+  bool big_endian;
+  unsigned int offset;
+  unsigned int len;
+};
+
+/* Fixed header, members are packed as the spec lists them */
+struct dyn_struct {
+  std::string name;
+  std::vector<dyn_struct_member> members;
+  unsigned int size;
+
+  const dyn_struct_member* find(std::string_view name) const;
+};
+
+struct dyn_op {
+  std::string name;
+  __u32 req_value;
+  __u32 rsp_value;
+  const dyn_attr_set* set;
+  const dyn_struct* hdr;
+  bool has_do;
+  bool has_dump;
+  /* do requests are answered with a message, not only an ACK */
+  bool do_reply;
+};
+
+/**
+ * struct dyn_value - decoded attribute
+ *
+ * Integers of all widths and byte orders land in @num, signed ones sign
+ * extended (see snum()), flags are 1 and bitfield32 holds the selector in
+ * the upper half. Strings (without the NUL) and binaries land in @data,
+ * nests in @nest. Entries of indexed arrays and nest-type-values are
+ * values of the array attribute, with the index or key as @type.
+ * A decoded message is a value too: @nest holds its attributes, @data
+ * the fixed header if the family has one.
+ */
+struct dyn_value {
+  /* nullptr for attributes the spec doesn't know */
+  const dyn_attr* attr{nullptr};
+  __u16 type{0};
+  __u64 num{0};
+  std::string data;
+  std::vector<dyn_value> nest;
+
+  std::string_view name() const {
+    return attr ? std::string_view(attr->name) : std::string_view();
+  }
+
+  __s64 snum() const {
+    return (__s64)num;
+  }
+
+  /* First nested attribute called @name */
+  const dyn_value* get(std::string_view name) const;
+};
+
+class dyn_family;
+
+/**
+ * class dyn_request - request of a dyn_family operation
+ *
+ * Attributes are looked up by name in the attribute set of the operation
+ * (or of the innermost open nest) and encoded straight into the message,
+ * sized and byte swapped as the spec says. The first failure (unknown
+ * name, value of the wrong kind, message too long) is kept in err() and
+ * fails the execution, so calls can be chained without checks:
+ *
+ *   ynl_cpp::dyn_request req(*fam, *fam->op("napi-set"));
+ *   req.put("id", napi_id).put("defer-hard-irqs", 2);
+ *
+ * The message stays valid after execution and can be sent again.
+ */
+class dyn_request {
+ public:
+  dyn_request(
+      const dyn_family& family,
+      const dyn_op& op,
+      bool dump = false,
+      __u16 flags = 0,
+      size_t max_len = 8192);
+
+  const dyn_op& op() const {
+    return *op_;
+  }
+
+  bool is_dump() const {
+    return dump_;
+  }
+
+  /* Fixed header of the operation, zeroed, empty if it has none */
+  std::span<unsigned char> hdr();
+  dyn_request& set_hdr(std::string_view member, __u64 value);
+
+  dyn_request& put(std::string_view name, __u64 value);
+  /* strings, or the bytes of a binary */
+  dyn_request& put(std::string_view name, std::string_view str);
+  dyn_request& put(std::string_view name, std::span<const __u8> data);
+  dyn_request& nest_start(std::string_view name);
+  dyn_request& nest_end();
+
+  const std::optional<error>& err() const {
+    return err_;
+  }
+
+  struct nlmsghdr* nlh() {
+    return (struct nlmsghdr*)buf_.data();
+  }
+
+ private:
+  friend class dyn_family;
+
+  const dyn_attr* lookup(std::string_view name);
+  void fail(enum ynl_error_code code, const std::string& msg);
+
+  const dyn_op* op_;
+  bool dump_;
+  std::vector<unsigned char> buf_;
+  size_t max_len_;
+  unsigned int hdr_off_{0};
+  std::vector<std::pair<struct nlattr*, const dyn_attr_set*>> nests_;
+  std::optional<error> err_;
+};
+
+/**
+ * class dyn_family - netlink family loaded from a spec at runtime
+ *
+ * For families which are not compiled in. ynl-gen-cpp.py compiles
+ * a spec into a small binary (--mode blob), load() turns it into
+ * attribute lookup tables indexed by type and name. Replies are decoded
+ * either into a generic dyn_value tree or, without any allocation, by
+ * walk() calling a visitor for each attribute.
+ */
+class dyn_family {
+ public:
+  static result<std::unique_ptr<dyn_family>> load(const std::string& path);
+  static result<std::unique_ptr<dyn_family>> parse(
+      std::span<const unsigned char> blob);
+
+  dyn_family(const dyn_family&) = delete;
+  dyn_family& operator=(const dyn_family&) = delete;
+
+  const std::string& name() const {
+    return name_;
+  }
+
+  bool is_classic() const {
+    return yf_.is_classic;
+  }
+
+  /* Generic Netlink family version, put in the genlmsghdr of requests */
+  __u8 version() const {
+    return version_;
+  }
+
+  /* Family description to create sockets with */
+  const ynl_family& family() const {
+    return yf_;
+  }
+
+  const dyn_op* op(std::string_view name) const;
+  const dyn_attr_set* attr_set(std::string_view name) const;
+
+  /* Length of the headers in front of the attributes of @op */
+  unsigned int hdr_len(const dyn_op& op) const;
+
+  /* Decode a reply to @op, false if malformed */
+  bool decode(const dyn_op& op, const struct nlmsghdr* nlh, dyn_value& out)
+      const;
+
+  /*
+   * Call bool fn(const dyn_attr *, const struct nlattr *) for each top
+   * level attribute of a reply to @op, the spec is nullptr for unknown
+   * attributes. Returning false stops the walk, and fails it.
+   */
+  template <typename F>
+  bool walk(const dyn_op& op, const struct nlmsghdr* nlh, F&& fn) const {
+    const struct nlattr* attr;
+
+    if (nlh->nlmsg_len < NLMSG_HDRLEN + hdr_len(op)) {
+      return false;
+    }
+    ynl_attr_for_each(attr, nlh, hdr_len(op)) {
+      if (!fn(op.set ? op.set->find(ynl_attr_type(attr)) : nullptr, attr)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /* Execute a do request, the value is empty for ops without a reply */
+  result<dyn_value> exec(ynl_socket& ys, dyn_request& req) const;
+  result<std::vector<dyn_value>> dump(ynl_socket& ys, dyn_request& req) const;
+
+  /* Run a dump request, see ynl_cpp::dump_raw() */
+  template <typename F>
+  result<void> dump_raw(ynl_socket& ys, dyn_request& req, F&& fn) const {
+    struct nlmsghdr* nlh = start(ys, req);
+
+    if (!nlh) {
+      return std::unexpected(error(ys));
+    }
+    return ynl_cpp::dump_raw(ys, nlh, req.op().rsp_value, fn);
+  }
+
+ private:
+  dyn_family() = default;
+  bool parse_blob(std::span<const unsigned char> blob);
+  bool decode_attrs(
+      const dyn_attr_set* set,
+      const unsigned char* start,
+      size_t len,
+      std::vector<dyn_value>& out) const;
+  bool decode_entry(
+      const dyn_attr& spec,
+      dyn_type kind,
+      unsigned int levels,
+      const struct nlattr* attr,
+      dyn_value& val) const;
+  struct nlmsghdr* start(ynl_socket& ys, dyn_request& req) const;
+
+  std::string name_;
+  __u8 version_{1};
+  struct ynl_family yf_ {};
+  std::vector<std::unique_ptr<dyn_struct>> structs_;
+  std::vector<std::unique_ptr<dyn_attr_set>> sets_;
+  std::vector<std::unique_ptr<dyn_op>> ops_;
+  std::unordered_map<std::string_view, const dyn_op*> ops_by_name_;
+  std::vector<std::string> grp_names_;
+  std::vector<struct ynl_mcast_grp> grps_;
+};
+
+} // namespace ynl_cpp
+
+#endif
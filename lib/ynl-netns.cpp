@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#include "ynl-netns.hpp"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <unordered_set>
+
+namespace ynl_cpp {
+
+static error netns_errno(const char* what, const std::string& name) {
+  struct ynl_error yerr = {};
+
+  yerr.code = (enum ynl_error_code)errno;
+  snprintf(
+      yerr.msg,
+      sizeof(yerr.msg),
+      "%s%s%s: %s",
+      what,
+      name.empty() ? "" : " ",
+      name.c_str(),
+      strerror(errno));
+  return error(yerr);
+}
+
+result<netns> netns::adopt(int fd, std::string name) {
+  struct stat st;
+  netns ns;
+
+  ns.fd_ = fd;
+  ns.name_ = std::move(name);
+  if (fstat(fd, &st)) {
+    return std::unexpected(netns_errno("failed to stat namespace", ns.name_));
+  }
+  ns.id_ = st.st_ino;
+  return ns;
+}
+
+result<netns> netns::open(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+  if (fd < 0) {
+    return std::unexpected(netns_errno("failed to open namespace", path));
+  }
+  return adopt(fd, path);
+}
+
+result<netns> netns::create() {
+  std::optional<error> err;
+  int self, fd;
+
+  self = ::open("/proc/thread-self/ns/net", O_RDONLY | O_CLOEXEC);
+  if (self < 0) {
+    return std::unexpected(netns_errno("failed to open namespace", ""));
+  }
+
+  if (unshare(CLONE_NEWNET)) {
+    err = netns_errno("failed to create namespace", "");
+    close(self);
+    return std::unexpected(*err);
+  }
+  fd = ::open("/proc/thread-self/ns/net", O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    err = netns_errno("failed to open new namespace", "");
+  }
+
+  /* unshare() moved the thread, put it back before anything else */
+  if (setns(self, CLONE_NEWNET)) {
+    err = netns_errno("failed to return to the original namespace", "");
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+  close(self);
+
+  if (err) {
+    return std::unexpected(*err);
+  }
+  return adopt(fd, "");
+}
+
+netns::netns(netns&& other) noexcept
+    : fd_(other.fd_), id_(other.id_), name_(std::move(other.name_)) {
+  other.fd_ = -1;
+}
+
+netns& netns::operator=(netns&& other) noexcept {
+  if (this != &other) {
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+    fd_ = other.fd_;
+    id_ = other.id_;
+    name_ = std::move(other.name_);
+    other.fd_ = -1;
+  }
+  return *this;
+}
+
+netns::~netns() {
+  if (fd_ >= 0) {
+    close(fd_);
+  }
+}
+
+result<std::vector<netns>> named_netns() {
+  std::vector<netns> nss;
+  struct dirent* de;
+  DIR* dir;
+
+  dir = opendir("/run/netns");
+  if (!dir) {
+    if (errno == ENOENT) {
+      return nss;
+    }
+    return std::unexpected(netns_errno("failed to list", "/run/netns"));
+  }
+
+  while ((de = readdir(dir))) {
+    if (de->d_name[0] == '.') {
+      continue;
+    }
+
+    auto ns = netns::open(std::string("/run/netns/") + de->d_name);
+    if (!ns) {
+      /* deleted while listing */
+      if (ns.error().sys_errno() == ENOENT) {
+        continue;
+      }
+      closedir(dir);
+      return std::unexpected(ns.error());
+    }
+    nss.push_back(std::move(*ns));
+  }
+  closedir(dir);
+
+  return nss;
+}
+
+result<ynl_socket*> netns_pool::get(const netns& ns) {
+  struct ynl_error yerr = {};
+
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = socks_.find(ns.id());
+
+    if (it != socks_.end()) {
+      return it->second.get();
+    }
+  }
+
+  /* Entering the namespace is slow, don't hold up the other threads */
+  auto ys = std::make_unique<ynl_socket>(family_, ns.fd(), &yerr);
+  if (!*ys) {
+    return std::unexpected(error(yerr));
+  }
+
+  std::lock_guard<std::mutex> guard(lock_);
+  auto [it, inserted] = socks_.try_emplace(ns.id(), std::move(ys));
+  return it->second.get();
+}
+
+void netns_pool::erase(const netns& ns) {
+  std::lock_guard<std::mutex> guard(lock_);
+
+  socks_.erase(ns.id());
+}
+
+size_t netns_pool::size() const {
+  std::lock_guard<std::mutex> guard(lock_);
+
+  return socks_.size();
+}
+
+std::vector<bool> netns_duplicates(std::span<const netns> nss) {
+  std::unordered_set<__u64> seen;
+  std::vector<bool> dups(nss.size());
+
+  seen.reserve(nss.size());
+  for (size_t i = 0; i < nss.size(); i++) {
+    dups[i] = !seen.insert(nss[i].id()).second;
+  }
+  return dups;
+}
+
+error netns_duplicate_error(const netns& ns) {
+  struct ynl_error yerr = {};
+
+  yerr.code = (enum ynl_error_code)EINVAL;
+  snprintf(
+      yerr.msg,
+      sizeof(yerr.msg),
+      "Namespace %s listed more than once",
+      ns.name().empty() ? std::to_string(ns.id()).c_str() : ns.name().c_str());
+  return error(yerr);
+}
+
+} // namespace ynl_cpp
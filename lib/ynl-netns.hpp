@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#ifndef __YNL_CPP_NETNS_H
+#define __YNL_CPP_NETNS_H 1
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "ynl.hpp"
+
+namespace ynl_cpp {
+
+/**
+ * class netns - handle of a network namespace
+ *
+ * Holds an fd of the namespace, which keeps it alive, and the inode number
+ * of its nsfs file, which identifies it: handles of the same namespace
+ * opened through different paths (e.g. /run/netns/foo and
+ * /proc/<pid>/ns/net) have the same id().
+ */
+class netns {
+ public:
+  /* e.g. "/run/netns/<name>" or "/proc/<pid>/ns/net" */
+  static result<netns> open(const std::string& path);
+  /* A new, empty namespace which only lives as long as its handles */
+  static result<netns> create();
+
+  netns(netns&& other) noexcept;
+  netns& operator=(netns&& other) noexcept;
+  ~netns();
+
+  int fd() const {
+    return fd_;
+  }
+
+  __u64 id() const {
+    return id_;
+  }
+
+  /* Path it was opened with, empty for create() */
+  const std::string& name() const {
+    return name_;
+  }
+
+ private:
+  netns() = default;
+  static result<netns> adopt(int fd, std::string name);
+
+  int fd_{-1};
+  __u64 id_{0};
+  std::string name_;
+};
+
+/* The namespaces named by iproute2 in /run/netns, none if it doesn't exist */
+result<std::vector<netns>> named_netns();
+
+/**
+ * class netns_pool - sockets of one family, one per network namespace
+ *
+ * Sockets are created on first use and kept for later calls, keyed by
+ * netns::id(). get() may be called from many threads at once, each socket
+ * must still only be used by one thread at a time.
+ */
+class netns_pool {
+ public:
+  explicit netns_pool(const ynl_family& family) : family_(family) {}
+
+  /* Socket of @ns, valid until erase() of @ns or the pool goes away */
+  result<ynl_socket*> get(const netns& ns);
+  /* Close the socket of @ns, e.g. once the namespace is gone */
+  void erase(const netns& ns);
+
+  size_t size() const;
+
+ private:
+  const ynl_family& family_;
+  mutable std::mutex lock_;
+  std::unordered_map<__u64, std::unique_ptr<ynl_socket>> socks_;
+};
+
+/* Entries of @nss naming a namespace already listed earlier */
+std::vector<bool> netns_duplicates(std::span<const netns> nss);
+error netns_duplicate_error(const netns& ns);
+
+/**
+ * for_each_netns() - run a request against many namespaces in parallel
+ *
+ * @fn is called as result<T> fn(ynl_socket&) with the pool's socket of
+ * each namespace of @nss, typically wrapping a generated _ex() call:
+ *
+ *   auto devs = ynl_cpp::for_each_netns(pool, nss, [](auto& ys) {
+ *     return ynl_cpp::netdev_dev_get_dump_ex(ys);
+ *   });
+ *
+ * Up to @threads namespaces (0 for one per CPU) are handled concurrently,
+ * so @fn must be safe to call from several threads. Entry i of the
+ * returned vector is the result for nss[i]. A socket which can't be
+ * created fails only the entries of its namespace, as does listing
+ * a namespace twice.
+ */
+template <typename F>
+auto for_each_netns(
+    netns_pool& pool,
+    std::span<const netns> nss,
+    F&& fn,
+    unsigned int threads = 0)
+    -> std::vector<std::invoke_result_t<F&, ynl_socket&>> {
+  using R = std::invoke_result_t<F&, ynl_socket&>;
+  std::vector<bool> dups = netns_duplicates(nss);
+  std::vector<std::optional<R>> out(nss.size());
+  std::atomic<size_t> next{0};
+  std::vector<R> ret;
+
+  auto worker = [&]() {
+    size_t i;
+
+    while ((i = next.fetch_add(1, std::memory_order_relaxed)) < nss.size()) {
+      if (dups[i]) {
+        out[i].emplace(std::unexpected(netns_duplicate_error(nss[i])));
+        continue;
+      }
+
+      auto ys = pool.get(nss[i]);
+      if (ys) {
+        out[i].emplace(fn(**ys));
+      } else {
+        out[i].emplace(std::unexpected(ys.error()));
+      }
+    }
+  };
+
+  if (!threads) {
+    threads = std::max(1U, std::thread::hardware_concurrency());
+  }
+  threads = std::min<size_t>(threads, nss.size());
+
+  {
+    std::vector<std::jthread> workers;
+
+    /* the calling thread is one of the workers */
+    for (unsigned int i = 1; i < threads; i++) {
+      workers.emplace_back(worker);
+    }
+    worker();
+  }
+
+  ret.reserve(out.size());
+  for (auto& r : out) {
+    ret.push_back(std::move(*r));
+  }
+  return ret;
+}
+
+} // namespace ynl_cpp
+
+#endif
@@ -59,8 +59,21 @@ struct ynl_parse_arg {
   struct ynl_sock* ys;
   struct ynl_policy_nest* rsp_policy;
   void* data;
+  /* bitmap of top level attrs to decode, NULL means all */
+  const __u64* proj;
 };
 
+/* Attr types at or above this limit can't be projected out */
+#define YNL_PROJ_MAX_ATTR 256
+
+static inline bool ynl_attr_projected(
+    const struct ynl_parse_arg* yarg,
+    unsigned int type) {
+  if (!yarg->proj || type >= YNL_PROJ_MAX_ATTR)
+    return true;
+  return yarg->proj[type / 64] & (1ULL << (type % 64));
+}
+
 struct ynl_dump_list_type {
   struct ynl_dump_list_type* next;
   unsigned char data[] __attribute__((aligned(8)));
@@ -89,17 +102,29 @@ static inline void* ynl_dump_obj_next(void* obj) {
 struct ynl_ntf_base_type {
   __u16 family;
   __u8 cmd;
+  /* peer netns ID, NETNSA_NSID_NOT_ASSIGNED unless listening to all */
+  int nsid;
   struct ynl_ntf_base_type* next;
   void (*free)(struct ynl_ntf_base_type* ntf);
   unsigned char data[] __attribute__((aligned(8)));
 };
 
+struct nlmsghdr* ynl_msg_start_req(struct ynl_sock* ys, __u32 id, __u16 flags);
+struct nlmsghdr* ynl_msg_start_dump(struct ynl_sock* ys, __u32 id);
 struct nlmsghdr*
 ynl_gemsg_start_req(struct ynl_sock* ys, __u32 id, __u8 cmd, __u8 version);
 struct nlmsghdr*
 ynl_gemsg_start_dump(struct ynl_sock* ys, __u32 id, __u8 cmd, __u8 version);
 
+int ynl_msg_end(struct ynl_sock* ys, struct nlmsghdr* nlh);
+struct nlmsghdr* ynl_msg_reuse(struct ynl_sock* ys, struct nlmsghdr* nlh);
+
 int ynl_attr_validate(struct ynl_parse_arg* yarg, const struct nlattr* attr);
+/* Error path of the inline attr checks in generated parsers */
+int ynl_attr_invalid(
+    struct ynl_parse_arg* yarg,
+    const struct nlattr* attr,
+    const char* kind) __attribute__((cold));
 
 /* YNL specific helpers used by the auto-generated code */
 
@@ -132,6 +157,8 @@ struct ynl_ntf_info {
   struct ynl_policy_nest* policy;
   size_t alloc_sz;
   void (*free)(struct ynl_ntf_base_type* ntf);
+  /* construct the object in zeroed memory, returns the parse destination */
+  void* (*init)(struct ynl_ntf_base_type* ntf);
 };
 
 int ynl_exec(
@@ -146,6 +173,26 @@ int ynl_exec_dump_no_alloc(
     struct ynl_sock* ys,
     struct nlmsghdr* req_nlh,
     struct ynl_dump_no_alloc_state* yds);
+int ynl_ntf_check_raw(struct ynl_sock* ys, ynl_parse_cb_t cb, void* data);
+
+/* Batched requests, see ynl_cpp::msg_batch */
+/* Receive buffer truesize of an ACK or error, with room to spare */
+#define YNL_BATCH_ANSWER_SIZE 1024
+
+ssize_t ynl_batch_sndbuf(struct ynl_sock* ys, size_t len);
+ssize_t ynl_batch_rcvbuf(struct ynl_sock* ys, size_t answers);
+int ynl_batch_send(struct ynl_sock* ys, const void* buf, size_t len);
+int ynl_batch_recv_acks(
+    struct ynl_sock* ys,
+    int (*cb)(const struct nlmsghdr* ack, void* data),
+    int (*reply_cb)(const struct nlmsghdr* nlh, void* data),
+    void* data);
+int ynl_batch_ack_decode(
+    struct ynl_sock* ys,
+    const struct nlmsghdr* ack,
+    struct nlmsghdr* req,
+    struct ynl_policy_nest* policy,
+    unsigned int hdr_len);
 
 void ynl_error_unknown_notification(struct ynl_sock* ys, __u8 cmd);
 int ynl_error_parse(struct ynl_parse_arg* yarg, const char* msg);
@@ -284,16 +331,18 @@ static inline void ynl_attr_nest_end(
   attr->nla_len = (char*)ynl_nlmsg_end_addr(nlh) - (char*)attr;
 }
 
-static inline void ynl_attr_put(
+/*
+ * Unchecked put, for callers which have proven that the message fits
+ * in the buffer (generated code does so at build time for requests made
+ * of fixed size attributes only).
+ */
+static inline void ynl_attr_put_unchecked(
     struct nlmsghdr* nlh,
     unsigned int attr_type,
     const void* value,
     size_t size) {
   struct nlattr* attr;
 
-  if (__ynl_attr_put_overflow(nlh, size))
-    return;
-
   attr = (struct nlattr*)ynl_nlmsg_end_addr(nlh);
   attr->nla_type = attr_type;
   attr->nla_len = NLA_HDRLEN + size;
@@ -303,6 +352,17 @@ static inline void ynl_attr_put(
   nlh->nlmsg_len += NLMSG_ALIGN(attr->nla_len);
 }
 
+static inline void ynl_attr_put(
+    struct nlmsghdr* nlh,
+    unsigned int attr_type,
+    const void* value,
+    size_t size) {
+  if (__ynl_attr_put_overflow(nlh, size))
+    return;
+
+  ynl_attr_put_unchecked(nlh, attr_type, value, size);
+}
+
 static inline void ynl_attr_put_str(
     struct nlmsghdr* nlh,
     unsigned int attr_type,
@@ -310,15 +370,16 @@ static inline void ynl_attr_put_str(
   struct nlattr* attr;
   size_t len;
 
-  len = strlen(str);
+  /* Include the terminating NUL, kernel NUL strings must have it */
+  len = strlen(str) + 1;
   if (__ynl_attr_put_overflow(nlh, len))
     return;
 
   attr = (struct nlattr*)ynl_nlmsg_end_addr(nlh);
   attr->nla_type = attr_type;
 
-  strcpy((char*)ynl_attr_data(attr), str);
-  attr->nla_len = NLA_HDRLEN + NLA_ALIGN(len);
+  memcpy(ynl_attr_data(attr), str, len);
+  attr->nla_len = NLA_HDRLEN + len;
 
   nlh->nlmsg_len += NLMSG_ALIGN(attr->nla_len);
 }
@@ -327,6 +388,12 @@ static inline const char* ynl_attr_get_str(const struct nlattr* attr) {
   return (const char*)ynl_attr_data(attr);
 }
 
+static inline bool ynl_attr_str_valid(const struct nlattr* attr) {
+  unsigned int len = ynl_attr_data_len(attr);
+
+  return len && !((const char*)ynl_attr_data(attr))[len - 1];
+}
+
 static inline __s8 ynl_attr_get_s8(const struct nlattr* attr) {
   return *(__s8*)ynl_attr_data(attr);
 }
@@ -405,6 +472,62 @@ ynl_attr_put_u64(struct nlmsghdr* nlh, unsigned int attr_type, __u64 value) {
   ynl_attr_put(nlh, attr_type, &value, sizeof(value));
 }
 
+static inline void ynl_attr_put_s8_unchecked(
+    struct nlmsghdr* nlh,
+    unsigned int attr_type,
+    __s8 value) {
+  ynl_attr_put_unchecked(nlh, attr_type, &value, sizeof(value));
+}
+
+static inline void ynl_attr_put_s16_unchecked(
+    struct nlmsghdr* nlh,
+    unsigned int attr_type,
+    __s16 value) {
+  ynl_attr_put_unchecked(nlh, attr_type, &value, sizeof(value));
+}
+
+static inline void ynl_attr_put_s32_unchecked(
+    struct nlmsghdr* nlh,
+    unsigned int attr_type,
+    __s32 value) {
+  ynl_attr_put_unchecked(nlh, attr_type, &value, sizeof(value));
+}
+
+static inline void ynl_attr_put_s64_unchecked(
+    struct nlmsghdr* nlh,
+    unsigned int attr_type,
+    __s64 value) {
+  ynl_attr_put_unchecked(nlh, attr_type, &value, sizeof(value));
+}
+
+static inline void ynl_attr_put_u8_unchecked(
+    struct nlmsghdr* nlh,
+    unsigned int attr_type,
+    __u8 value) {
+  ynl_attr_put_unchecked(nlh, attr_type, &value, sizeof(value));
+}
+
+static inline void ynl_attr_put_u16_unchecked(
+    struct nlmsghdr* nlh,
+    unsigned int attr_type,
+    __u16 value) {
+  ynl_attr_put_unchecked(nlh, attr_type, &value, sizeof(value));
+}
+
+static inline void ynl_attr_put_u32_unchecked(
+    struct nlmsghdr* nlh,
+    unsigned int attr_type,
+    __u32 value) {
+  ynl_attr_put_unchecked(nlh, attr_type, &value, sizeof(value));
+}
+
+static inline void ynl_attr_put_u64_unchecked(
+    struct nlmsghdr* nlh,
+    unsigned int attr_type,
+    __u64 value) {
+  ynl_attr_put_unchecked(nlh, attr_type, &value, sizeof(value));
+}
+
 static inline __u64 ynl_attr_get_uint(const struct nlattr* attr) {
   switch (ynl_attr_data_len(attr)) {
     case 4:
@@ -442,4 +565,19 @@ ynl_attr_put_sint(struct nlmsghdr* nlh, __u16 type, __s64 data) {
   else
     ynl_attr_put_s64(nlh, type, data);
 }
+static inline void
+ynl_attr_put_uint_unchecked(struct nlmsghdr* nlh, __u16 type, __u64 data) {
+  if ((__u32)data == (__u64)data)
+    ynl_attr_put_u32_unchecked(nlh, type, data);
+  else
+    ynl_attr_put_u64_unchecked(nlh, type, data);
+}
+
+static inline void
+ynl_attr_put_sint_unchecked(struct nlmsghdr* nlh, __u16 type, __s64 data) {
+  if ((__s32)data == (__s64)data)
+    ynl_attr_put_s32_unchecked(nlh, type, data);
+  else
+    ynl_attr_put_s64_unchecked(nlh, type, data);
+}
 #endif
@@ -1,10 +1,15 @@
 // (c) Meta Platforms, Inc. and affiliates. Confidential and proprietary.
 
 // SPDX-License-Identifier: GPL-2.0 OR BSD-3-Clause
+#define _GNU_SOURCE /* setns() */
 #include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
 #include <linux/genetlink.h>
+#include <linux/net_namespace.h>
 #include <linux/types.h>
 #include <poll.h>
+#include <sched.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -161,8 +166,10 @@ static int ynl_ext_ack_check(
   const struct nlattr* attr;
   const char* str = NULL;
 
+  /* Plain ACK, don't pay for formatting a message nobody will read */
   if (!(nlh->nlmsg_flags & NLM_F_ACK_TLVS)) {
-    yerr_msg(ys, "%s", strerror(ys->err.code));
+    if (ys->err.code)
+      yerr_msg(ys, "%s", strerror(ys->err.code));
     return YNL_PARSE_CB_OK;
   }
 
@@ -206,12 +213,12 @@ static int ynl_ext_ack_check(
     n = snprintf(
         bad_attr, sizeof(bad_attr), "%sbad attribute: ", str ? " (" : "");
 
-    start = ynl_nlmsg_data_offset(ys->nlh, ys->family->hdr_len);
+    start = ynl_nlmsg_data_offset(ys->nlh, ys->req_hdr_len);
     end = ynl_nlmsg_end_addr(ys->nlh);
 
     off = ys->err.attr_offs;
     off -= sizeof(struct nlmsghdr);
-    off -= ys->family->hdr_len;
+    off -= ys->req_hdr_len;
 
     n += ynl_err_walk(
         ys,
@@ -241,14 +248,14 @@ static int ynl_ext_ack_check(
         "%smissing attribute: ",
         bad_attr[0] ? ", " : (str ? " (" : ""));
 
-    start = ynl_nlmsg_data_offset(ys->nlh, ys->family->hdr_len);
+    start = ynl_nlmsg_data_offset(ys->nlh, ys->req_hdr_len);
     end = ynl_nlmsg_end_addr(ys->nlh);
 
     nest_pol = ys->req_policy;
     if (tb[NLMSGERR_ATTR_MISS_NEST]) {
       off = ynl_attr_get_u32(tb[NLMSGERR_ATTR_MISS_NEST]);
       off -= sizeof(struct nlmsghdr);
-      off -= ys->family->hdr_len;
+      off -= ys->req_hdr_len;
 
       n += ynl_err_walk(
           ys,
@@ -288,7 +295,7 @@ static int ynl_ext_ack_check(
         ys->err.code ? "error" : "warning",
         bad_attr,
         miss_attr);
-  else
+  else if (ys->err.code)
     yerr_msg(ys, "%s", strerror(ys->err.code));
 
   return YNL_PARSE_CB_OK;
@@ -455,6 +462,25 @@ int ynl_attr_validate(struct ynl_parse_arg* yarg, const struct nlattr* attr) {
   return 0;
 }
 
+int ynl_attr_invalid(
+    struct ynl_parse_arg* yarg,
+    const struct nlattr* attr,
+    const char* kind) {
+  unsigned int type = ynl_attr_type(attr);
+  const char* name = NULL;
+
+  if (type <= yarg->rsp_policy->max_attr)
+    name = yarg->rsp_policy->table[type].name;
+
+  yerr(
+      yarg->ys,
+      YNL_ERROR_ATTR_INVALID,
+      "Invalid attribute (%s %s)",
+      kind,
+      name ?: "unknown");
+  return YNL_PARSE_CB_ERROR;
+}
+
 /* Generic code */
 
 static void ynl_err_reset(struct ynl_sock* ys) {
@@ -467,6 +493,7 @@ struct nlmsghdr* ynl_msg_start(struct ynl_sock* ys, __u32 id, __u16 flags) {
   struct nlmsghdr* nlh;
 
   ynl_err_reset(ys);
+  ys->req_hdr_len = ys->family->hdr_len;
 
   nlh = ys->nlh = ynl_nlmsg_put_header(ys->tx_buf);
   nlh->nlmsg_type = id;
@@ -482,7 +509,7 @@ struct nlmsghdr* ynl_msg_start(struct ynl_sock* ys, __u32 id, __u16 flags) {
   return nlh;
 }
 
-static int ynl_msg_end(struct ynl_sock* ys, struct nlmsghdr* nlh) {
+int ynl_msg_end(struct ynl_sock* ys, struct nlmsghdr* nlh) {
   /* We stash buffer length in nlmsg_pid. */
   if (nlh->nlmsg_pid == 0) {
     yerr(ys, YNL_ERROR_INPUT_INVALID, "Unknown input buffer length");
@@ -500,6 +527,20 @@ static int ynl_msg_end(struct ynl_sock* ys, struct nlmsghdr* nlh) {
   return 0;
 }
 
+struct nlmsghdr* ynl_msg_reuse(struct ynl_sock* ys, struct nlmsghdr* nlh) {
+  ynl_err_reset(ys);
+  ys->req_hdr_len = ys->family->hdr_len;
+
+  ys->nlh = nlh;
+  nlh->nlmsg_seq = ++ys->seq;
+  /* Already terminated by ynl_msg_end(), so it can't overflow, just
+   * make the stashed length look valid for the next ynl_msg_end().
+   */
+  nlh->nlmsg_pid = nlh->nlmsg_len;
+
+  return nlh;
+}
+
 struct nlmsghdr* ynl_gemsg_start(
     struct ynl_sock* ys,
     __u32 id,
@@ -522,12 +563,12 @@ struct nlmsghdr* ynl_gemsg_start(
   return nlh;
 }
 
-void ynl_msg_start_req(struct ynl_sock* ys, __u32 id) {
-  ynl_msg_start(ys, id, NLM_F_REQUEST | NLM_F_ACK);
+struct nlmsghdr* ynl_msg_start_req(struct ynl_sock* ys, __u32 id, __u16 flags) {
+  return ynl_msg_start(ys, id, NLM_F_REQUEST | NLM_F_ACK | flags);
 }
 
-void ynl_msg_start_dump(struct ynl_sock* ys, __u32 id) {
-  ynl_msg_start(ys, id, NLM_F_REQUEST | NLM_F_ACK | NLM_F_DUMP);
+struct nlmsghdr* ynl_msg_start_dump(struct ynl_sock* ys, __u32 id) {
+  return ynl_msg_start(ys, id, NLM_F_REQUEST | NLM_F_ACK | NLM_F_DUMP);
 }
 
 struct nlmsghdr*
@@ -550,6 +591,38 @@ static int ynl_cb_null(const struct nlmsghdr* nlh, struct ynl_parse_arg* yarg) {
   return YNL_PARSE_CB_ERROR;
 }
 
+/* recv() which also records the netns ID the message came from */
+static ssize_t ynl_sock_recv_nsid(struct ynl_sock* ys, int flags) {
+  char cbuf[CMSG_SPACE(sizeof(int))];
+  struct iovec iov = {
+      .iov_base = ys->rx_buf,
+      .iov_len = YNL_SOCKET_BUFFER_SIZE,
+  };
+  struct msghdr msg = {
+      .msg_iov = &iov,
+      .msg_iovlen = 1,
+      .msg_control = cbuf,
+      .msg_controllen = sizeof(cbuf),
+  };
+  struct cmsghdr* cmsg;
+  ssize_t len;
+
+  len = recvmsg(ys->socket, &msg, flags);
+  if (len < 0)
+    return len;
+
+  /* No cmsg for messages of the socket's own namespace */
+  ys->rx_nsid = NETNSA_NSID_NOT_ASSIGNED;
+  for (cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level == SOL_NETLINK &&
+        cmsg->cmsg_type == NETLINK_LISTEN_ALL_NSID &&
+        cmsg->cmsg_len == CMSG_LEN(sizeof(int)))
+      memcpy(&ys->rx_nsid, CMSG_DATA(cmsg), sizeof(int));
+  }
+
+  return len;
+}
+
 static int
 __ynl_sock_read_msgs(struct ynl_parse_arg* yarg, ynl_parse_cb_t cb, int flags) {
   struct ynl_sock* ys = yarg->ys;
@@ -557,10 +630,15 @@ __ynl_sock_read_msgs(struct ynl_parse_arg* yarg, ynl_parse_cb_t cb, int flags) {
   ssize_t len, rem;
   int ret;
 
-  len = recv(ys->socket, ys->rx_buf, YNL_SOCKET_BUFFER_SIZE, flags);
+  if (ys->listen_all_nsid) {
+    len = ynl_sock_recv_nsid(ys, flags);
+  } else {
+    len = recv(ys->socket, ys->rx_buf, YNL_SOCKET_BUFFER_SIZE, flags);
+  }
   if (len < 0) {
     if (flags & MSG_DONTWAIT && errno == EAGAIN)
       return YNL_PARSE_CB_STOP;
+    perr(ys, "failed to receive from the netlink socket");
     return len;
   }
 
@@ -605,6 +683,9 @@ __ynl_sock_read_msgs(struct ynl_parse_arg* yarg, ynl_parse_cb_t cb, int flags) {
         ret = cb(nlh, yarg);
         break;
     }
+    /* Don't let a DONE in the same datagram hide the error */
+    if (ret < 0)
+      return ret;
   }
 
   return ret;
@@ -727,6 +808,28 @@ static int ynl_sock_read_family(struct ynl_sock* ys, const char* family_name) {
   return 0;
 }
 
+/* Classic families have no controller, group IDs come from the spec */
+static int ynl_sock_classic_mcast(struct ynl_sock* ys) {
+  const struct ynl_family* yf = ys->family;
+  unsigned int i;
+
+  if (!yf->n_mcast_groups)
+    return 0;
+
+  ys->mcast_groups = calloc(yf->n_mcast_groups, sizeof(*ys->mcast_groups));
+  if (!ys->mcast_groups)
+    return -1;
+  ys->n_mcast_groups = yf->n_mcast_groups;
+
+  for (i = 0; i < yf->n_mcast_groups; i++) {
+    ys->mcast_groups[i].id = yf->mcast_groups[i].id;
+    strncpy(
+        ys->mcast_groups[i].name, yf->mcast_groups[i].name, GENL_NAMSIZ - 1);
+  }
+
+  return 0;
+}
+
 struct ynl_sock* ynl_sock_create(
     const struct ynl_family* yf,
     struct ynl_error* yse) {
@@ -744,8 +847,10 @@ struct ynl_sock* ynl_sock_create(
   ys->tx_buf = &ys->raw_buf[0];
   ys->rx_buf = &ys->raw_buf[YNL_SOCKET_BUFFER_SIZE];
   ys->ntf_last_next = &ys->ntf_first;
+  ys->rx_nsid = NETNSA_NSID_NOT_ASSIGNED;
 
-  ys->socket = socket(AF_NETLINK, SOCK_RAW, NETLINK_GENERIC);
+  ys->socket = socket(
+      AF_NETLINK, SOCK_RAW, yf->is_classic ? yf->classic_id : NETLINK_GENERIC);
   if (ys->socket < 0) {
     __perr(yse, "failed to create a netlink socket");
     goto err_free_sock;
@@ -759,6 +864,13 @@ struct ynl_sock* ynl_sock_create(
     __perr(yse, "failed to enable netlink ext ACK");
     goto err_close_sock;
   }
+  /* Make classic families validate the fixed header of dump requests */
+  if (yf->is_classic &&
+      setsockopt(
+          ys->socket, SOL_NETLINK, NETLINK_GET_STRICT_CHK, &one, sizeof(one))) {
+    __perr(yse, "failed to enable netlink strict checking");
+    goto err_close_sock;
+  }
 
   memset(&addr, 0, sizeof(addr));
   addr.nl_family = AF_NETLINK;
@@ -778,7 +890,12 @@ struct ynl_sock* ynl_sock_create(
   ys->portid = addr.nl_pid;
   ys->seq = random();
 
-  if (ynl_sock_read_family(ys, yf->name)) {
+  if (yf->is_classic) {
+    if (ynl_sock_classic_mcast(ys)) {
+      __perr(yse, "failed to allocate multicast group table");
+      goto err_close_sock;
+    }
+  } else if (ynl_sock_read_family(ys, yf->name)) {
     if (yse)
       memcpy(yse, &ys->err, sizeof(*yse));
     goto err_close_sock;
@@ -793,6 +910,48 @@ err_free_sock:
   return NULL;
 }
 
+/**
+ * ynl_sock_create_netns() - create a YNL socket in another network namespace
+ * @yf:		family description
+ * @netns_fd:	fd of the namespace, e.g. an open /run/netns/<name>
+ * @yse:	error descriptor, may be NULL
+ *
+ * Netlink sockets stay bound to the namespace they were created in,
+ * the calling thread only enters @netns_fd for the duration of the call.
+ * Other threads of the process are not affected.
+ */
+struct ynl_sock* ynl_sock_create_netns(
+    const struct ynl_family* yf,
+    int netns_fd,
+    struct ynl_error* yse) {
+  struct ynl_sock* ys;
+  int self;
+
+  self = open("/proc/thread-self/ns/net", O_RDONLY | O_CLOEXEC);
+  if (self < 0) {
+    __perr(yse, "failed to open the current network namespace");
+    return NULL;
+  }
+
+  if (setns(netns_fd, CLONE_NEWNET)) {
+    __perr(yse, "failed to enter the network namespace");
+    close(self);
+    return NULL;
+  }
+
+  ys = ynl_sock_create(yf, yse);
+
+  if (setns(self, CLONE_NEWNET)) {
+    __perr(yse, "failed to return to the original network namespace");
+    if (ys)
+      ynl_sock_destroy(ys);
+    ys = NULL;
+  }
+  close(self);
+
+  return ys;
+}
+
 void ynl_sock_destroy(struct ynl_sock* ys) {
   struct ynl_ntf_base_type* ntf;
 
@@ -835,6 +994,31 @@ int ynl_subscribe(struct ynl_sock* ys, const char* grp_name) {
   return 0;
 }
 
+/**
+ * ynl_sock_listen_all_nsid() - receive notifications of peer namespaces
+ * @ys: active YNL socket
+ *
+ * Multicast messages of all namespaces which have an ID assigned in the
+ * socket's namespace are delivered too. The ID is reported in the nsid
+ * member of dequeued notifications.
+ */
+int ynl_sock_listen_all_nsid(struct ynl_sock* ys) {
+  int one = 1;
+
+  if (setsockopt(
+          ys->socket,
+          SOL_NETLINK,
+          NETLINK_LISTEN_ALL_NSID,
+          &one,
+          sizeof(one)) < 0) {
+    perr(ys, "failed to listen to all namespaces");
+    return -1;
+  }
+  ys->listen_all_nsid = true;
+
+  return 0;
+}
+
 int ynl_socket_get_fd(struct ynl_sock* ys) {
   return ys->socket;
 }
@@ -860,18 +1044,27 @@ static int ynl_ntf_parse(struct ynl_sock* ys, const struct nlmsghdr* nlh) {
   const struct ynl_ntf_info* info;
   struct ynl_ntf_base_type* rsp;
   struct genlmsghdr* gehdr;
+  unsigned int cmd;
   int ret;
 
-  gehdr = ynl_nlmsg_data(nlh);
-  if (gehdr->cmd >= ys->family->ntf_info_size)
+  if (ys->family->is_classic) {
+    cmd = nlh->nlmsg_type;
+  } else {
+    gehdr = ynl_nlmsg_data(nlh);
+    cmd = gehdr->cmd;
+  }
+
+  if (cmd >= ys->family->ntf_info_size)
     return YNL_PARSE_CB_ERROR;
-  info = &ys->family->ntf_info[gehdr->cmd];
+  info = &ys->family->ntf_info[cmd];
   if (!info->cb)
     return YNL_PARSE_CB_ERROR;
 
   rsp = calloc(1, info->alloc_sz);
+  if (!rsp)
+    return YNL_PARSE_CB_ERROR;
+  yarg.data = info->init ? info->init(rsp) : rsp->data;
   rsp->free = info->free;
-  yarg.data = rsp->data;
   yarg.rsp_policy = info->policy;
 
   ret = info->cb(nlh, &yarg);
@@ -879,7 +1072,8 @@ static int ynl_ntf_parse(struct ynl_sock* ys, const struct nlmsghdr* nlh) {
     goto err_free;
 
   rsp->family = nlh->nlmsg_type;
-  rsp->cmd = gehdr->cmd;
+  rsp->cmd = cmd;
+  rsp->nsid = ys->rx_nsid;
 
   *ys->ntf_last_next = rsp;
   ys->ntf_last_next = &rsp->next;
@@ -912,10 +1106,178 @@ int ynl_ntf_check(struct ynl_sock* ys) {
   return 0;
 }
 
+/*
+ * As ynl_ntf_check(), but hands the notifications to @cb unparsed rather
+ * than queueing generated objects. @data is passed in yarg->data.
+ */
+int ynl_ntf_check_raw(struct ynl_sock* ys, ynl_parse_cb_t cb, void* data) {
+  struct ynl_parse_arg yarg = {
+      .ys = ys,
+      .data = data,
+  };
+  int err;
+
+  do {
+    err = __ynl_sock_read_msgs(&yarg, cb, MSG_DONTWAIT);
+    if (err < 0)
+      return err;
+  } while (err > 0);
+
+  return 0;
+}
+
 /* YNL specific helpers used by the auto-generated code */
 
 struct ynl_dump_list_type* YNL_LIST_END = (void*)(0xb4d123);
 
+/* Batches */
+
+/*
+ * Make room for sending @len bytes in one go, netlink_sendmsg() refuses
+ * anything above sk_sndbuf - 32. SO_SNDBUFFORCE needs CAP_NET_ADMIN,
+ * fall back to SO_SNDBUF (capped by wmem_max). Returns the largest send
+ * the socket accepts now, which may still be below @len.
+ */
+ssize_t ynl_batch_sndbuf(struct ynl_sock* ys, size_t len) {
+  socklen_t optlen = sizeof(int);
+  int val, want;
+
+  if (getsockopt(ys->socket, SOL_SOCKET, SO_SNDBUF, &val, &optlen) < 0) {
+    perr(ys, "failed to read the socket send buffer size");
+    return -1;
+  }
+  if ((size_t)val >= len + 32 || len > INT_MAX / 2 - 32) {
+    return val - 32;
+  }
+
+  /* The kernel doubles the value for bookkeeping overhead */
+  want = (len + 32 + 1) / 2;
+  if (setsockopt(ys->socket, SOL_SOCKET, SO_SNDBUFFORCE, &want, sizeof(want)))
+    setsockopt(ys->socket, SOL_SOCKET, SO_SNDBUF, &want, sizeof(want));
+
+  if (getsockopt(ys->socket, SOL_SOCKET, SO_SNDBUF, &val, &optlen) < 0) {
+    perr(ys, "failed to read the socket send buffer size");
+    return -1;
+  }
+  return val - 32;
+}
+
+/*
+ * Make room for @answers ACKs or errors in the receive buffer, which the
+ * kernel queues during the send() and drops (ENOBUFS) once it's full.
+ * Each costs about YNL_BATCH_ANSWER_SIZE of skb truesize. Grows the buffer
+ * like ynl_batch_sndbuf(), capped by rmem_max without CAP_NET_ADMIN.
+ * Returns how many answers fit now, at least 1.
+ */
+ssize_t ynl_batch_rcvbuf(struct ynl_sock* ys, size_t answers) {
+  socklen_t optlen = sizeof(int);
+  int val, want;
+
+  if (getsockopt(ys->socket, SOL_SOCKET, SO_RCVBUF, &val, &optlen) < 0) {
+    perr(ys, "failed to read the socket receive buffer size");
+    return -1;
+  }
+  if ((size_t)val / YNL_BATCH_ANSWER_SIZE < answers &&
+      answers < INT_MAX / YNL_BATCH_ANSWER_SIZE) {
+    /* The kernel doubles the value for bookkeeping overhead */
+    want = answers * YNL_BATCH_ANSWER_SIZE / 2;
+    if (setsockopt(
+            ys->socket, SOL_SOCKET, SO_RCVBUFFORCE, &want, sizeof(want)))
+      setsockopt(ys->socket, SOL_SOCKET, SO_RCVBUF, &want, sizeof(want));
+
+    if (getsockopt(ys->socket, SOL_SOCKET, SO_RCVBUF, &val, &optlen) < 0) {
+      perr(ys, "failed to read the socket receive buffer size");
+      return -1;
+    }
+  }
+  if (val < YNL_BATCH_ANSWER_SIZE)
+    return 1;
+  return val / YNL_BATCH_ANSWER_SIZE;
+}
+
+int ynl_batch_send(struct ynl_sock* ys, const void* buf, size_t len) {
+  ssize_t ret;
+
+  ret = send(ys->socket, buf, len, 0);
+  if (ret < 0) {
+    perr(ys, "failed to send the batch");
+    return -1;
+  }
+  return 0;
+}
+
+/*
+ * Hand all queued ACKs and errors to @cb, without blocking. The kernel
+ * processes a send() in the context of the sender, so everything it will
+ * answer is already queued once the send() returned. Other messages
+ * (replies, notifications) go to @reply_cb, or are skipped if it's NULL.
+ * Fails with ENOBUFS if answers were dropped because the receive buffer
+ * overflowed.
+ */
+int ynl_batch_recv_acks(
+    struct ynl_sock* ys,
+    int (*cb)(const struct nlmsghdr* ack, void* data),
+    int (*reply_cb)(const struct nlmsghdr* nlh, void* data),
+    void* data) {
+  const struct nlmsghdr* nlh;
+  ssize_t len, rem;
+
+  for (;;) {
+    len = recv(ys->socket, ys->rx_buf, YNL_SOCKET_BUFFER_SIZE, MSG_DONTWAIT);
+    if (len < 0) {
+      if (errno == EAGAIN)
+        return 0;
+      perr(ys, "failed to receive batch ACKs");
+      return -1;
+    }
+
+    for (rem = len; rem > 0; NLMSG_NEXT(nlh, rem)) {
+      nlh = (struct nlmsghdr*)&ys->rx_buf[len - rem];
+      if (!NLMSG_OK(nlh, rem)) {
+        yerr(
+            ys,
+            YNL_ERROR_INV_RESP,
+            "Invalid message or trailing data in the response.");
+        return -1;
+      }
+      if (nlh->nlmsg_type != NLMSG_ERROR) {
+        if (reply_cb && nlh->nlmsg_type != NLMSG_DONE && reply_cb(nlh, data))
+          return -1;
+        continue;
+      }
+      if (ynl_nlmsg_data_len(nlh) < sizeof(struct nlmsgerr)) {
+        yerr(ys, YNL_ERROR_INV_RESP, "Kernel responded with truncated ACK");
+        return -1;
+      }
+      if (cb(nlh, data))
+        return -1;
+    }
+  }
+}
+
+/*
+ * Decode the error in @ack into ys->err, resolving extack attribute
+ * offsets against @req, which was encoded according to @policy.
+ */
+int ynl_batch_ack_decode(
+    struct ynl_sock* ys,
+    const struct nlmsghdr* ack,
+    struct nlmsghdr* req,
+    struct ynl_policy_nest* policy,
+    unsigned int hdr_len) {
+  struct ynl_parse_arg yarg = {
+      .ys = ys,
+  };
+
+  ynl_err_reset(ys);
+  ys->nlh = req;
+  ys->req_policy = policy;
+  ys->req_hdr_len = hdr_len ?: ys->family->hdr_len;
+
+  ynl_cb_error(ack, &yarg);
+  return ys->err.code;
+}
+
 void ynl_error_unknown_notification(struct ynl_sock* ys, __u8 cmd) {
   yerr(
       ys, YNL_ERROR_UNKNOWN_NTF, "Unknown notification message type '%d'", cmd);
@@ -932,6 +1294,12 @@ static int ynl_check_alien(
     __u32 rsp_cmd) {
   struct genlmsghdr* gehdr;
 
+  if (ys->family->is_classic) {
+    if (nlh->nlmsg_type != rsp_cmd)
+      return ynl_ntf_parse(ys, nlh);
+    return 0;
+  }
+
   if (ynl_nlmsg_data_len(nlh) < sizeof(*gehdr)) {
     yerr(ys, YNL_ERROR_INV_RESP, "Kernel responded with truncated message");
     return -1;
@@ -968,8 +1336,10 @@ int ynl_exec(
     return err;
 
   err = send(ys->socket, req_nlh, req_nlh->nlmsg_len, 0);
-  if (err < 0)
+  if (err < 0) {
+    perr(ys, "failed to send the request");
     return err;
+  }
 
   do {
     err = ynl_sock_read_msgs(&yrs->yarg, ynl_req_trampoline);
@@ -1042,8 +1412,10 @@ int ynl_exec_dump(
     return err;
 
   err = send(ys->socket, req_nlh, req_nlh->nlmsg_len, 0);
-  if (err < 0)
+  if (err < 0) {
+    perr(ys, "failed to send the request");
     return err;
+  }
 
   do {
     err = ynl_sock_read_msgs(&yds->yarg, ynl_dump_trampoline);
@@ -1070,8 +1442,10 @@ int ynl_exec_dump_no_alloc(
     return err;
 
   err = send(ys->socket, req_nlh, req_nlh->nlmsg_len, 0);
-  if (err < 0)
+  if (err < 0) {
+    perr(ys, "failed to send the request");
     return err;
+  }
 
   do {
     err = ynl_sock_read_msgs(&yds->yarg, ynl_dump_no_alloc_trampoline);
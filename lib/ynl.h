@@ -40,6 +40,12 @@ struct ynl_error {
   char msg[512];
 };
 
+/* Multicast group with a static ID, for classic netlink families */
+struct ynl_mcast_grp {
+  const char* name;
+  unsigned int id;
+};
+
 /**
  * struct ynl_family - YNL family info
  * Family description generated by codegen. Pass to ynl_sock_create().
@@ -50,6 +56,11 @@ struct ynl_family {
   size_t hdr_len;
   const struct ynl_ntf_info* ntf_info;
   unsigned int ntf_info_size;
+  /* classic (netlink-raw) families use a fixed protocol and message IDs */
+  bool is_classic;
+  __u16 classic_id;
+  const struct ynl_mcast_grp* mcast_groups;
+  unsigned int n_mcast_groups;
 };
 
 /**
@@ -75,8 +86,12 @@ struct ynl_sock {
   struct ynl_ntf_base_type* ntf_first;
   struct ynl_ntf_base_type** ntf_last_next;
 
+  bool listen_all_nsid;
+  int rx_nsid;
+
   struct nlmsghdr* nlh;
   struct ynl_policy_nest* req_policy;
+  size_t req_hdr_len;
   unsigned char* tx_buf;
   unsigned char* rx_buf;
   unsigned char raw_buf[];
@@ -85,6 +100,10 @@ struct ynl_sock {
 struct ynl_sock* ynl_sock_create(
     const struct ynl_family* yf,
     struct ynl_error* e);
+struct ynl_sock* ynl_sock_create_netns(
+    const struct ynl_family* yf,
+    int netns_fd,
+    struct ynl_error* e);
 void ynl_sock_destroy(struct ynl_sock* ys);
 
 #define ynl_dump_foreach(dump, iter)                                      \
@@ -103,6 +122,7 @@ static inline bool ynl_dump_empty(void* dump) {
 }
 
 int ynl_subscribe(struct ynl_sock* ys, const char* grp_name);
+int ynl_sock_listen_all_nsid(struct ynl_sock* ys);
 int ynl_socket_get_fd(struct ynl_sock* ys);
 int ynl_ntf_check(struct ynl_sock* ys);
 
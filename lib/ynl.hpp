@@ -4,7 +4,11 @@
 
 #include <string.h>
 
+#include <expected>
+#include <initializer_list>
 #include <iostream>
+#include <string>
+#include <type_traits>
 #include <vector>
 extern "C" {
 #include "ynl.h"
@@ -14,6 +18,8 @@ namespace ynl_cpp {
 class ynl_socket {
  public:
   explicit ynl_socket(const ynl_family& family, ynl_error* err = nullptr);
+  /* Socket bound to the network namespace @netns_fd refers to */
+  ynl_socket(const ynl_family& family, int netns_fd, ynl_error* err = nullptr);
   ~ynl_socket();
 
   operator bool() const {
@@ -27,6 +33,312 @@ class ynl_socket {
  private:
   struct ynl_sock* sock_{nullptr};
 };
+
+/**
+ * class error - error returned by the std::expected flavour of calls
+ *
+ * Small value type holding a snapshot of the socket error state taken
+ * at the point of failure, so it remains valid after the socket is used
+ * for the next request. Text is only copied when the failure happened,
+ * messages for plain errno failures are formatted on first access.
+ */
+class error {
+ public:
+  error() = default;
+  explicit error(const struct ynl_error& yerr);
+  explicit error(const struct ynl_sock* ys) : error(ys->err) {}
+
+  enum ynl_error_code code() const {
+    return code_;
+  }
+
+  /* errno value if the failure came from the kernel or a syscall, else 0 */
+  int sys_errno() const {
+    return code_ < __YNL_ERRNO_END ? code_ : 0;
+  }
+
+  /* offset of the bad attribute in the request, as reported by extack */
+  unsigned int attr_offs() const {
+    return attr_offs_;
+  }
+
+  const std::string& message() const;
+
+ private:
+  enum ynl_error_code code_ { YNL_ERROR_NONE };
+  unsigned int attr_offs_{0};
+  mutable std::string msg_;
+};
+
+template <typename T>
+using result = std::expected<T, error>;
+
+/**
+ * class projection - set of top level reply attributes to decode
+ *
+ * Passed to the std::expected flavour of do and dump calls. Attributes
+ * outside of the set are skipped by the reply parser without validation,
+ * nests are not descended into. Members of the reply which were not
+ * projected are left default-initialized. Usually built at compile time:
+ *
+ *   constexpr ynl_cpp::projection proj{NETDEV_A_QSTATS_RX_PACKETS};
+ */
+class projection {
+ public:
+  constexpr projection(std::initializer_list<unsigned int> attrs) {
+    for (unsigned int type : attrs) {
+      if (type < YNL_PROJ_MAX_ATTR) {
+        words_[type / 64] |= 1ULL << (type % 64);
+      }
+    }
+  }
+
+  constexpr bool test(unsigned int type) const {
+    return type >= YNL_PROJ_MAX_ATTR ||
+        (words_[type / 64] & (1ULL << (type % 64)));
+  }
+
+  const __u64* words() const {
+    return words_;
+  }
+
+ private:
+  __u64 words_[YNL_PROJ_MAX_ATTR / 64]{};
+};
+
+/**
+ * class request_template - prebuilt, reusable request message
+ *
+ * Created by the generated *_prepare() calls for high-frequency requests.
+ * Holds the fully encoded message so that each execution only bumps the
+ * sequence number and sends straight out of this buffer. Fixed size
+ * attributes (e.g. an ifindex) can be patched in place with set_attr().
+ */
+class request_template {
+ public:
+  /*
+   * @hdr_len is the length of the op's fixed header, if it differs from
+   * the family's (classic families declare one per op).
+   */
+  static result<request_template> capture(
+      struct ynl_sock* ys,
+      struct nlmsghdr* nlh,
+      unsigned int hdr_len = 0);
+
+  struct nlmsghdr* nlh() {
+    return (struct nlmsghdr*)buf_.data();
+  }
+
+  size_t size() const {
+    return buf_.size();
+  }
+
+  /*
+   * Overwrite the value of an already encoded attribute. @path lists attr
+   * types starting at the top level, going down through nests. Fails if
+   * the attribute is not present or was encoded with a different size.
+   */
+  template <typename T>
+  bool set_attr(std::initializer_list<unsigned int> path, T value) {
+    struct nlattr* attr = find_attr(path);
+
+    if (!attr || ynl_attr_data_len(attr) != sizeof(T)) {
+      return false;
+    }
+    memcpy(ynl_attr_data(attr), &value, sizeof(T));
+    return true;
+  }
+
+ private:
+  struct nlattr* find_attr(std::initializer_list<unsigned int> path);
+
+  size_t hdr_len_{0};
+  std::vector<unsigned char> buf_;
+};
+
+/**
+ * class msg_batch - many requests, few syscalls
+ *
+ * Requests are encoded back to back into one buffer, by the generated
+ * *_batch() calls or by hand between msg_start() and msg_end(). send()
+ * then hands them to the kernel in as few send() calls as the socket
+ * buffers allow and matches the answers to messages by sequence number.
+ * A send() carries no more messages than the receive buffer has room to
+ * answer, so a batch in which every message fails still reports each.
+ *
+ * Unless the batch is created with @ack, messages go out without NLM_F_ACK
+ * and the kernel only answers the ones which failed, which keeps the
+ * receive side small even for huge batches.
+ */
+class msg_batch {
+ public:
+  /* A message of the batch which the kernel rejected */
+  struct failure {
+    size_t index;
+    error err;
+  };
+
+  explicit msg_batch(ynl_socket& ys, bool ack = false);
+
+  /* Number of messages */
+  size_t size() const {
+    return offs_.size();
+  }
+
+  size_t bytes() const {
+    return len_;
+  }
+
+  /* Forget all messages, memory is kept for the next batch */
+  void clear();
+
+  /* Forget the last message */
+  void pop_back();
+
+  /* Message @i, in the order they were added */
+  struct nlmsghdr* msg(size_t i) {
+    return (struct nlmsghdr*)&buf_[offs_[i]];
+  }
+
+  /* Start a classic / Generic Netlink message, encode it in place ... */
+  struct nlmsghdr* msg_start(__u16 type, __u16 flags);
+  struct nlmsghdr* gemsg_start(__u8 cmd, __u8 version);
+  /*
+   * ... and finish it, returns its index. @policy of the request and
+   * @hdr_len, the length of its fixed header (0 for the family's), are only
+   * used to name the offending attribute if the kernel rejects it.
+   */
+  result<size_t> msg_end(
+      struct nlmsghdr* nlh,
+      struct ynl_policy_nest* policy,
+      unsigned int hdr_len = 0);
+
+  /*
+   * Send all messages and collect the ones which failed. With @atomic the
+   * whole batch goes out in a single send(), growing the socket buffers
+   * if needed, nfnetlink only treats the messages of one send() as a
+   * transaction. Failing to send or to collect the answers fails the
+   * call, messages of later sends are then not processed at all.
+   */
+  result<std::vector<failure>> send(bool atomic = false);
+
+  /*
+   * As send(), for requests which get a reply (e.g. do requests of gets):
+   * @fn is called as bool fn(size_t index, const struct nlmsghdr *) for
+   * the reply to message @index, returning false fails the call with a
+   * parse error. At most @window messages go out per send(), so that
+   * their replies fit in the socket receive buffer.
+   */
+  template <typename F>
+  result<std::vector<failure>> send_recv(F&& fn, size_t window = 64) {
+    return send(
+        false,
+        [](size_t index, const struct nlmsghdr* nlh, void* data) -> bool {
+          return (*static_cast<std::remove_reference_t<F>*>(data))(
+              index, nlh);
+        },
+        (void*)&fn,
+        window);
+  }
+
+ private:
+  using reply_cb =
+      bool (*)(size_t index, const struct nlmsghdr* nlh, void* data);
+
+  result<std::vector<failure>>
+  send(bool atomic, reply_cb cb, void* cb_data, size_t window);
+
+  struct ynl_sock* ys_;
+  bool ack_;
+
+  std::vector<unsigned char> buf_;
+  size_t len_{0};
+  std::vector<size_t> offs_;
+  std::vector<struct ynl_policy_nest*> policies_;
+  std::vector<unsigned int> hdr_lens_;
+};
+
+/**
+ * dump_raw() - run a dump, handing each reply message to @fn unparsed
+ *
+ * For consumers which decode straight into their own storage (e.g.
+ * columnar tables) and don't want a generated object per message.
+ * @fn is called as bool fn(const struct nlmsghdr *) for every message
+ * of type @rsp_cmd, returning false aborts the dump with a parse error.
+ * Memory use is bounded by the socket buffer, regardless of dump size.
+ */
+template <typename F>
+result<void> dump_raw(
+    struct ynl_sock* ys,
+    struct nlmsghdr* req_nlh,
+    __u32 rsp_cmd,
+    F&& fn) {
+  struct ynl_dump_no_alloc_state yds = {};
+
+  yds.yarg.ys = ys;
+  yds.yarg.data = (void*)&fn;
+  yds.alloc_cb = [](void* arg) -> void* { return arg; };
+  yds.cb = [](const struct nlmsghdr* nlh, struct ynl_parse_arg* yarg) -> int {
+    auto& cb = *static_cast<std::remove_reference_t<F>*>(yarg->data);
+
+    if (!cb(nlh)) {
+      return ynl_error_parse(yarg, "malformed message");
+    }
+    return YNL_PARSE_CB_OK;
+  };
+  yds.rsp_cmd = rsp_cmd;
+
+  if (ynl_exec_dump_no_alloc(ys, req_nlh, &yds) < 0) {
+    return std::unexpected(error(ys));
+  }
+  return {};
+}
+
+/*
+ * The generated notification types repeat the fields of struct
+ * ynl_ntf_base_type, which the library queues and frees them by. They hold
+ * C++ members, so offsetof() on them is only conditionally supported.
+ */
+template <typename T>
+constexpr bool ntf_layout_matches() {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+  using base = struct ynl_ntf_base_type;
+
+  return offsetof(T, family) == offsetof(base, family) &&
+      offsetof(T, cmd) == offsetof(base, cmd) &&
+      offsetof(T, nsid) == offsetof(base, nsid) &&
+      offsetof(T, next) == offsetof(base, next) &&
+      offsetof(T, free) == offsetof(base, free) &&
+      offsetof(T, obj) == offsetof(base, data);
+#pragma GCC diagnostic pop
+}
+
+/**
+ * ntf_raw() - hand the notifications queued on a socket to @fn unparsed
+ *
+ * Like ynl_ntf_check(), doesn't block. For notifications carrying more than
+ * the generated types hold, or consumers decoding into their own storage.
+ * @fn is called as bool fn(const struct nlmsghdr *) for every message,
+ * returning false stops with a parse error. Don't mix with ynl_ntf_check()
+ * or requests on the same socket, those parse notifications themselves.
+ */
+template <typename F>
+result<void> ntf_raw(struct ynl_sock* ys, F&& fn) {
+  auto cb = [](const struct nlmsghdr* nlh, struct ynl_parse_arg* yarg) -> int {
+    auto& ntf_cb = *static_cast<std::remove_reference_t<F>*>(yarg->data);
+
+    if (!ntf_cb(nlh)) {
+      return ynl_error_parse(yarg, "malformed notification");
+    }
+    return YNL_PARSE_CB_OK;
+  };
+
+  if (ynl_ntf_check_raw(ys, cb, (void*)&fn) < 0) {
+    return std::unexpected(error(ys));
+  }
+  return {};
+}
 } // namespace ynl_cpp
 
 #endif
@@ -44,11 +44,12 @@ int main(int argc, char* argv[]) {
   if (ifindex > 0) {
     ynl_cpp::netdev_dev_get_req req;
     req.ifindex = ifindex;
-    auto ret = ynl_cpp::netdev_dev_get(ys, req);
+    auto ret = ynl_cpp::netdev_dev_get_ex(ys, req);
     if (ret) {
-      std::cout << *ret << std::endl;
+      std::cout << **ret << std::endl;
     } else {
-      std::cerr << "netdev_dev_get error" << std::endl;
+      std::cerr << "netdev_dev_get error: " << ret.error().message()
+                << std::endl;
     }
   } else if (!ifindex) {
     auto ret = ynl_cpp::netdev_dev_get_dump(ys);
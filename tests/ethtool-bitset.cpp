@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+
+#include <ynl.hpp>
+
+#include "ethtool-bitset.hpp"
+#include "ynl-fake-kernel.hpp"
+
+/*
+ * compact_bitset decoding: bits past the compiled-in size, as newer kernels
+ * report, are dropped and flagged rather than failing the decode.
+ */
+
+/* A compact bitset nest of @words value and mask words */
+static std::vector<__u8>
+compact_nest(const std::vector<__u32>& value, const std::vector<__u32>& mask) {
+  std::vector<__u8> buf(512);
+  struct nlmsghdr* nlh = ynl_nlmsg_put_header(buf.data());
+  struct nlattr* nest;
+  size_t len = value.size() * sizeof(__u32);
+
+  nlh->nlmsg_pid = buf.size();
+  nest = ynl_attr_nest_start(nlh, ETHTOOL_A_LINKMODES_OURS);
+  ynl_attr_put_u32(nlh, ETHTOOL_A_BITSET_SIZE, value.size() * 32);
+  ynl_attr_put(nlh, ETHTOOL_A_BITSET_VALUE, value.data(), len);
+  ynl_attr_put(nlh, ETHTOOL_A_BITSET_MASK, mask.data(), len);
+  ynl_attr_nest_end(nlh, nest);
+
+  buf.erase(buf.begin(), buf.begin() + NLMSG_HDRLEN);
+  return buf;
+}
+
+int main() {
+  /* Bits 3, 45 and 70 set, all of the 96 covered */
+  auto nest = compact_nest({1U << 3, 1U << 13, 1U << 6}, {~0U, ~0U, ~0U});
+  const struct nlattr* attr = (const struct nlattr*)nest.data();
+
+  ynl_cpp::compact_bitset<128> wide;
+  CHECK(wide.decode(attr));
+  CHECK(!wide.truncated);
+  CHECK(wide.size == 96);
+  CHECK(wide.count() == 3);
+  CHECK(wide.test(70) && wide.covers(95) && !wide.covers(96));
+
+  /* A word short, bit 70 is dropped */
+  ynl_cpp::compact_bitset<64> word;
+  CHECK(word.decode(attr));
+  CHECK(word.truncated);
+  CHECK(word.count() == 2);
+  CHECK(word.test(3) && word.test(45));
+
+  /* Within the last word, bit 45 is dropped too */
+  ynl_cpp::compact_bitset<40> odd;
+  CHECK(odd.decode(attr));
+  CHECK(odd.truncated);
+  CHECK(odd.count() == 1);
+  CHECK(odd.test(3) && odd.covers(39) && !odd.covers(40));
+
+  /* Only bits which fit, nothing is dropped */
+  auto low = compact_nest({1U << 3, 0, 0}, {~0U, 0, 0});
+  ynl_cpp::compact_bitset<40> fits;
+  CHECK(fits.decode((const struct nlattr*)low.data()));
+  CHECK(!fits.truncated);
+  CHECK(fits.count() == 1);
+
+  /* Verbose bitsets, a bit index past the end */
+  ynl_cpp::ethtool_bitset bs;
+  bs.nomask = true;
+  bs.bits.emplace();
+  for (__u32 index : {5, 200}) {
+    bs.bits->bit.emplace_back();
+    bs.bits->bit.back().index = index;
+  }
+  ynl_cpp::compact_bitset<64> verbose;
+  CHECK(verbose.decode(bs));
+  CHECK(verbose.truncated);
+  CHECK(verbose.count() == 1 && verbose.test(5));
+
+  return check_failures ? 1 : 0;
+}
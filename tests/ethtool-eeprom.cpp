@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <map>
+
+#include <ynl.hpp>
+
+#include "ethtool-eeprom.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/ethtool_netlink.h>
+#include <linux/genetlink.h>
+
+/*
+ * module_eeprom_reader against fake modules: the lower page decides which
+ * upper pages are read, static pages are read once per module, a module
+ * swap or a failing page is noticed, and the DOM accessors decode what
+ * was read.
+ */
+
+using ynl_cpp::cmis_half_len;
+using ynl_cpp::module_eeprom;
+using ynl_cpp::module_eeprom_reader;
+
+/* A plugged in module, answering for the pages it has */
+struct module {
+  __u8 id;
+  bool flat;
+  /* pages failing with an error */
+  std::map<__u8, int> fail;
+  /* length of the data it answers with */
+  size_t len{cmis_half_len};
+};
+
+/* The half page at @offset of @page of @mod */
+static std::vector<__u8>
+module_mem(const module& mod, __u8 page, __u32 offset) {
+  std::vector<__u8> mem(cmis_half_len, page ^ mod.id);
+
+  if (!offset) {
+    mem[0] = mod.id;
+    mem[0x02] = mod.flat ? 0x80 : 0;
+    /* 25.5 C, 3.3 V */
+    mem[0x0e] = 0x19;
+    mem[0x0f] = 0x80;
+    mem[0x10] = 33000 >> 8;
+    mem[0x11] = 33000 & 0xff;
+  } else if (page == 0x01) {
+    /* tx bias multiplier 2 */
+    mem[0xa0 - 0x80] = 1 << 3;
+  } else if (page == 0x11) {
+    for (unsigned int lane = 0; lane < ynl_cpp::cmis_lanes; lane++) {
+      __u16 tx = 1000 + lane, bias = 3000 + lane, rx = 2000 + lane;
+
+      mem[0x9a - 0x80 + lane * 2] = tx >> 8;
+      mem[0x9a - 0x80 + lane * 2 + 1] = tx & 0xff;
+      mem[0xaa - 0x80 + lane * 2] = bias >> 8;
+      mem[0xaa - 0x80 + lane * 2 + 1] = bias & 0xff;
+      mem[0xba - 0x80 + lane * 2] = rx >> 8;
+      mem[0xba - 0x80 + lane * 2 + 1] = rx & 0xff;
+    }
+  }
+  return mem;
+}
+
+/* A module-eeprom-get request as the kernel sees it */
+struct eeprom_req {
+  __u32 ifindex{0};
+  __u32 offset{0};
+  __u32 length{0};
+  __u8 page{0};
+  __u8 bank{0xff};
+  __u8 i2c{0};
+};
+
+static eeprom_req parse_req(const struct nlmsghdr* nlh) {
+  const struct nlattr *attr, *hdr;
+  eeprom_req req;
+
+  ynl_attr_for_each(attr, nlh, GENL_HDRLEN) {
+    switch (ynl_attr_type(attr)) {
+      case ETHTOOL_A_MODULE_EEPROM_HEADER:
+        ynl_attr_for_each_nested(hdr, attr) {
+          if (ynl_attr_type(hdr) == ETHTOOL_A_HEADER_DEV_INDEX) {
+            req.ifindex = ynl_attr_get_u32(hdr);
+          }
+        }
+        break;
+      case ETHTOOL_A_MODULE_EEPROM_OFFSET:
+        req.offset = ynl_attr_get_u32(attr);
+        break;
+      case ETHTOOL_A_MODULE_EEPROM_LENGTH:
+        req.length = ynl_attr_get_u32(attr);
+        break;
+      case ETHTOOL_A_MODULE_EEPROM_PAGE:
+        req.page = ynl_attr_get_u8(attr);
+        break;
+      case ETHTOOL_A_MODULE_EEPROM_BANK:
+        req.bank = ynl_attr_get_u8(attr);
+        break;
+      case ETHTOOL_A_MODULE_EEPROM_I2C_ADDRESS:
+        req.i2c = ynl_attr_get_u8(attr);
+        break;
+    }
+  }
+  return req;
+}
+
+int main() {
+  std::map<__u32, module> ports;
+  std::vector<eeprom_req> asked;
+  module_eeprom_reader reader;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_ethtool_family(), &yerr);
+  if (!ys) {
+    printf("skip: %s\n", yerr.msg);
+    return 0;
+  }
+  fake_kernel kernel(ys);
+  struct ynl_sock* sock = ys;
+
+  /* Each request answered by the module of its port, if there is one */
+  kernel.answer([&](const struct nlmsghdr* nlh) {
+    alignas(NLMSG_ALIGNTO) __u8 buf[512] = {};
+    struct nlmsghdr* rsp = (struct nlmsghdr*)buf;
+    eeprom_req req = parse_req(nlh);
+    struct genlmsghdr* gehdr;
+
+    asked.push_back(req);
+    auto it = ports.find(req.ifindex);
+    if (it == ports.end()) {
+      return ENODEV;
+    }
+    const module& mod = it->second;
+    if (mod.fail.count(req.page)) {
+      return mod.fail.at(req.page);
+    }
+
+    std::vector<__u8> mem = module_mem(mod, req.page, req.offset);
+    rsp->nlmsg_len = NLMSG_HDRLEN;
+    rsp->nlmsg_pid = sizeof(buf);
+    gehdr = (struct genlmsghdr*)ynl_nlmsg_put_extra_header(rsp, GENL_HDRLEN);
+    gehdr->cmd = ETHTOOL_MSG_MODULE_EEPROM_GET_REPLY;
+    ynl_attr_put(rsp, ETHTOOL_A_MODULE_EEPROM_DATA, mem.data(), mod.len);
+    kernel.reply(
+        nlh->nlmsg_seq,
+        sock->family_id,
+        buf + NLMSG_HDRLEN,
+        rsp->nlmsg_len - NLMSG_HDRLEN);
+    return 0;
+  });
+
+  /* Paged QSFP-DD, flat memory CMIS, a non-CMIS SFP, an empty cage */
+  ports[2] = {0x18, false, {}};
+  ports[3] = {0x1e, true, {}};
+  ports[4] = {0x03, false, {}};
+  std::vector<module_eeprom> mods(4);
+  for (size_t i = 0; i < mods.size(); i++) {
+    mods[i].ifindex = 2 + i;
+  }
+
+  /* The lower pages first, then what they say the modules have */
+  CHECK(reader.read(ys, mods));
+  CHECK(kernel.sends() == 2 && reader.requests() == 4 + 4 + 1 + 1);
+  kernel.sent();
+  CHECK(asked.size() == 10);
+  for (size_t i = 0; i < asked.size(); i++) {
+    const eeprom_req& req = asked[i];
+
+    CHECK(req.length == cmis_half_len && req.bank == 0 && req.i2c == 0x50);
+    CHECK(i < 4 ? !req.page && !req.offset : req.offset == cmis_half_len);
+  }
+  asked.clear();
+
+  const module_eeprom& dd = mods[0];
+  CHECK(dd.valid == (1U << ynl_cpp::cmis_half_cnt) - 1 && !dd.err);
+  CHECK(dd.cmis() && !dd.flat() && dd.identifier() == 0x18);
+  CHECK(dd.temperature() == 0x1980 && dd.vcc() == 33000);
+  CHECK(dd.half(ynl_cpp::cmis_page_00h)[0] == (0x00 ^ 0x18));
+  CHECK(dd.half(ynl_cpp::cmis_page_02h)[0] == (0x02 ^ 0x18));
+  CHECK(dd.tx_power(0) == 1000 && dd.tx_power(7) == 1007);
+  CHECK(dd.rx_power(3) == 2003 && !dd.rx_power(8));
+  /* 2 uA units, times 2 */
+  CHECK(dd.tx_bias(1) == 3001 * 4);
+
+  const module_eeprom& flat = mods[1];
+  CHECK(flat.cmis() && flat.flat() && !flat.err);
+  CHECK(flat.valid == ((1U << ynl_cpp::cmis_lower) |
+                       (1U << ynl_cpp::cmis_page_00h)));
+  CHECK(flat.temperature() == 0x1980 && !flat.tx_power(0));
+
+  const module_eeprom& sfp = mods[2];
+  CHECK(!sfp.cmis() && sfp.identifier() == 0x03);
+  CHECK(sfp.has(ynl_cpp::cmis_page_00h) && !sfp.temperature());
+
+  const module_eeprom& empty = mods[3];
+  CHECK(!empty.valid && empty.err && empty.err->sys_errno() == ENODEV);
+  CHECK(!empty.identifier() && !empty.vcc());
+
+  /* Steady state: the lower pages and the lane monitors only */
+  CHECK(reader.read(ys, mods));
+  CHECK(kernel.sends() == 1 && reader.requests() == 4 + 1);
+  CHECK(asked.size() == 5 && asked[1].ifindex == 2 && asked[1].page == 0x11);
+  CHECK(dd.valid == (1U << ynl_cpp::cmis_half_cnt) - 1 && empty.err);
+  kernel.sent();
+  asked.clear();
+
+  /* Another module in port 2, its static pages are read again */
+  ports[2] = {0x19, false, {{0x02, EIO}}};
+  CHECK(reader.read(ys, mods));
+  CHECK(kernel.sends() == 2 && reader.requests() == 4 + 1 + 3);
+  CHECK(dd.identifier() == 0x19 && dd.cmis());
+  CHECK(dd.half(ynl_cpp::cmis_page_00h)[0] == (0x00 ^ 0x19));
+  CHECK(dd.half(ynl_cpp::cmis_page_01h)[0] == (0x01 ^ 0x19));
+  /* Its thresholds page failed, the rest is there */
+  CHECK(!dd.has(ynl_cpp::cmis_page_02h) && dd.err);
+  CHECK(dd.err && dd.err->sys_errno() == EIO);
+  CHECK(dd.tx_bias(0) == 3000 * 4);
+  CHECK(!flat.err && flat.has(ynl_cpp::cmis_page_00h));
+  kernel.sent();
+  asked.clear();
+
+  /* Then it is asked for again, until it works */
+  ports[2].fail.clear();
+  CHECK(reader.read(ys, mods));
+  CHECK(reader.requests() == 4 + 1 + 1);
+  CHECK(dd.has(ynl_cpp::cmis_page_02h) && !dd.err);
+  kernel.sent();
+
+  /* A reply of the wrong length fails the read */
+  ports[3].len = cmis_half_len / 2;
+  CHECK(!reader.read(ys, mods));
+  kernel.sent();
+  kernel.answer(nullptr);
+
+  return check_failures ? 1 : 0;
+}
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <errno.h>
+#include <stdio.h>
+
+#include <ynl.hpp>
+
+#include "ethtool-rss.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/genetlink.h>
+
+/*
+ * rss_tables against a fake kernel: only the attributes which differ are
+ * sent, failures index the wanted contexts, failed sets leave the held
+ * configuration alone, and tables of the wrong size are not sent at all.
+ */
+
+static ynl_cpp::rss_context
+make_ctx(__u32 ifindex, __u32 context, __u32 queues) {
+  ynl_cpp::rss_context ctx;
+
+  ctx.ifindex = ifindex;
+  ctx.context = context;
+  ctx.hfunc = 1;
+  ctx.indir.resize(8);
+  for (size_t i = 0; i < ctx.indir.size(); i++) {
+    ctx.indir[i] = i % queues;
+  }
+  return ctx;
+}
+
+/* Queue the rss-get reply of @ctx for the message with @seq */
+static void
+reply_ctx(fake_kernel& kernel, __u32 seq, const ynl_cpp::rss_context& ctx) {
+  alignas(NLMSG_ALIGNTO) __u8 buf[256] = {};
+  struct nlmsghdr* nlh = (struct nlmsghdr*)buf;
+  struct nlattr* nest;
+
+  nlh->nlmsg_len = NLMSG_HDRLEN + GENL_HDRLEN;
+  nlh->nlmsg_pid = sizeof(buf);
+  nest = ynl_attr_nest_start(nlh, ETHTOOL_A_RSS_HEADER);
+  ynl_attr_put_u32(nlh, ETHTOOL_A_HEADER_DEV_INDEX, ctx.ifindex);
+  ynl_attr_nest_end(nlh, nest);
+  ynl_attr_put_u32(nlh, ETHTOOL_A_RSS_HFUNC, *ctx.hfunc);
+  ynl_attr_put(
+      nlh,
+      ETHTOOL_A_RSS_INDIR,
+      ctx.indir.data(),
+      ctx.indir.size() * sizeof(__u32));
+  kernel.reply(
+      seq,
+      GENL_ID_CTRL + 1,
+      buf + NLMSG_HDRLEN,
+      nlh->nlmsg_len - NLMSG_HDRLEN);
+}
+
+/* Attribute @type of a sent rss-set, nullptr if it has none */
+static const struct nlattr*
+sent_attr(const std::vector<__u8>& msg, unsigned int type) {
+  const struct nlmsghdr* nlh = (const struct nlmsghdr*)msg.data();
+  const struct nlattr* attr;
+
+  ynl_attr_for_each(attr, nlh, GENL_HDRLEN) {
+    if (ynl_attr_type(attr) == type) {
+      return attr;
+    }
+  }
+  return nullptr;
+}
+
+int main() {
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_ethtool_family(), &yerr);
+  if (!ys) {
+    printf("skip: %s\n", yerr.msg);
+    return 0;
+  }
+  fake_kernel kernel(ys);
+  ynl_cpp::rss_tables tables;
+
+  tables.assume(make_ctx(1, 0, 4));
+  tables.assume(make_ctx(1, 1, 4));
+  tables.assume(make_ctx(2, 0, 4));
+
+  /* Unchanged, a new table, a new hash function which the device rejects */
+  std::vector<ynl_cpp::rss_context> wants = {
+      make_ctx(1, 0, 4), make_ctx(1, 1, 2), make_ctx(2, 0, 4)};
+  wants[2].hfunc = 2;
+  kernel.ack(kernel.seq(1), EOPNOTSUPP);
+
+  auto failures = tables.update(ys, wants);
+  CHECK(failures && failures->size() == 1);
+  if (failures && failures->size() == 1) {
+    CHECK((*failures)[0].index == 2);
+    CHECK((*failures)[0].err.sys_errno() == EOPNOTSUPP);
+  }
+  CHECK(tables.sets() == 2);
+  CHECK(tables.unchanged() == 1);
+
+  auto sent = kernel.sent();
+  CHECK(sent.size() == 2);
+  if (sent.size() == 2) {
+    const struct nlattr* attr;
+
+    attr = sent_attr(sent[0], ETHTOOL_A_RSS_CONTEXT);
+    CHECK(attr && ynl_attr_get_u32(attr) == 1);
+    attr = sent_attr(sent[0], ETHTOOL_A_RSS_INDIR);
+    CHECK(attr && ynl_attr_data_len(attr) == 8 * sizeof(__u32));
+    CHECK(!sent_attr(sent[0], ETHTOOL_A_RSS_HFUNC));
+
+    CHECK(!sent_attr(sent[1], ETHTOOL_A_RSS_CONTEXT));
+    CHECK(!sent_attr(sent[1], ETHTOOL_A_RSS_INDIR));
+    attr = sent_attr(sent[1], ETHTOOL_A_RSS_HFUNC);
+    CHECK(attr && ynl_attr_get_u32(attr) == 2);
+  }
+
+  /* The applied set is held, the failed one isn't */
+  const ynl_cpp::rss_context* held = tables.find(1, 1);
+  CHECK(held && held->indir == wants[1].indir);
+  held = tables.find(2, 0);
+  CHECK(held && held->hfunc == 1u);
+
+  /* Nothing changed any more, nothing is sent */
+  wants[2].hfunc = 1;
+  failures = tables.update(ys, wants);
+  CHECK(failures && failures->empty());
+  CHECK(kernel.sent().empty());
+
+  /* A table of another size than the device's isn't sent */
+  ynl_cpp::rss_context want = make_ctx(1, 0, 4);
+  want.indir.resize(4);
+  auto ret = tables.update(ys, want);
+  CHECK(!ret && ret.error().sys_errno() == EINVAL);
+  CHECK(kernel.sent().empty());
+
+  /* Contexts not held are read first, failing reads fail the context */
+  wants = {make_ctx(3, 0, 2), make_ctx(4, 0, 2)};
+  reply_ctx(kernel, kernel.seq(0), make_ctx(3, 0, 4));
+  kernel.ack(kernel.seq(1), ENODEV);
+
+  failures = tables.update(ys, wants);
+  CHECK(failures && failures->size() == 1);
+  if (failures && failures->size() == 1) {
+    CHECK((*failures)[0].index == 1);
+  }
+  held = tables.find(3, 0);
+  CHECK(held && held->indir == wants[0].indir);
+  CHECK(!tables.find(4, 0));
+  /* Two rss-gets, then the one rss-set */
+  CHECK(kernel.sent().size() == 3);
+
+  return check_failures ? 1 : 0;
+}
@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <string.h>
+
+#include <ynl.hpp>
+
+#include "ethtool-stats.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/ethtool.h>
+#include <linux/ethtool_netlink.h>
+#include <linux/genetlink.h>
+
+/*
+ * ethtool_stats_scraper on replayed stats-get dumps: the request asks for
+ * the chosen groups and is reused, counters and histogram buckets land
+ * in the device records, groups without counters aren't flagged, and a
+ * re-scrape starts over.
+ */
+
+using ynl_cpp::ethtool_stat_not_set;
+using ynl_cpp::ethtool_stats_scraper;
+
+/* Group @id with one counter @stat = @val, or none if @stat is 0 */
+static void
+put_grp(struct nlmsghdr* nlh, __u32 id, __u16 stat = 0, __u64 val = 0) {
+  struct nlattr *grp, *counter;
+
+  grp = ynl_attr_nest_start(nlh, ETHTOOL_A_STATS_GRP);
+  ynl_attr_put_u32(nlh, ETHTOOL_A_STATS_GRP_ID, id);
+  if (stat) {
+    counter = ynl_attr_nest_start(nlh, ETHTOOL_A_STATS_GRP_STAT);
+    ynl_attr_put_u64(nlh, stat, val);
+    ynl_attr_nest_end(nlh, counter);
+  }
+  ynl_attr_nest_end(nlh, grp);
+}
+
+/* Start a stats-get reply of device @ifindex in @buf */
+static struct nlmsghdr* stats_start(std::vector<__u8>& buf, __u32 ifindex) {
+  struct nlmsghdr* nlh = (struct nlmsghdr*)buf.data();
+  struct genlmsghdr* gehdr;
+  struct nlattr* hdr;
+
+  nlh->nlmsg_len = NLMSG_HDRLEN;
+  nlh->nlmsg_pid = buf.size();
+  gehdr = (struct genlmsghdr*)ynl_nlmsg_put_extra_header(nlh, GENL_HDRLEN);
+  gehdr->cmd = ETHTOOL_MSG_STATS_GET_REPLY;
+  hdr = ynl_attr_nest_start(nlh, ETHTOOL_A_STATS_HEADER);
+  ynl_attr_put_u32(nlh, ETHTOOL_A_HEADER_DEV_INDEX, ifindex);
+  ynl_attr_nest_end(nlh, hdr);
+  return nlh;
+}
+
+/* stats-get reply body of device @ifindex, @buckets rx histogram buckets */
+static std::vector<__u8>
+stats_body(__u32 ifindex, __u64 rx, size_t buckets) {
+  std::vector<__u8> buf(8192);
+  struct nlmsghdr* nlh = stats_start(buf, ifindex);
+  struct nlattr *grp, *counter, *bkt;
+
+  put_grp(nlh, ETHTOOL_STATS_ETH_MAC, ETHTOOL_A_STATS_ETH_MAC_5_RX_PKT, rx);
+  /* Asked for, but the driver has none */
+  put_grp(nlh, ETHTOOL_STATS_ETH_CTRL);
+  /* A group from a newer kernel */
+  put_grp(nlh, 30, 3, 3);
+
+  grp = ynl_attr_nest_start(nlh, ETHTOOL_A_STATS_GRP);
+  ynl_attr_put_u32(nlh, ETHTOOL_A_STATS_GRP_ID, ETHTOOL_STATS_RMON);
+  counter = ynl_attr_nest_start(nlh, ETHTOOL_A_STATS_GRP_STAT);
+  ynl_attr_put_u64(nlh, ETHTOOL_A_STATS_RMON_UNDERSIZE, 7);
+  ynl_attr_nest_end(nlh, counter);
+  for (size_t i = 0; i < buckets; i++) {
+    bkt = ynl_attr_nest_start(nlh, ETHTOOL_A_STATS_GRP_HIST_RX);
+    ynl_attr_put_u32(nlh, ETHTOOL_A_STATS_GRP_HIST_BKT_LOW, 64 << i);
+    ynl_attr_put_u32(nlh, ETHTOOL_A_STATS_GRP_HIST_BKT_HI, (128 << i) - 1);
+    ynl_attr_put_u64(nlh, ETHTOOL_A_STATS_GRP_HIST_VAL, 1000 + i);
+    ynl_attr_nest_end(nlh, bkt);
+  }
+  ynl_attr_nest_end(nlh, grp);
+
+  return {buf.begin() + NLMSG_HDRLEN, buf.begin() + nlh->nlmsg_len};
+}
+
+/* The one message sent, with its sequence number cleared */
+static std::vector<__u8> unseq(std::vector<std::vector<__u8>> sent) {
+  if (sent.size() != 1) {
+    return {};
+  }
+  ((struct nlmsghdr*)sent[0].data())->nlmsg_seq = 0;
+  return sent[0];
+}
+
+int main() {
+  const __u32 groups = (1U << ETHTOOL_STATS_ETH_MAC) |
+      (1U << ETHTOOL_STATS_ETH_CTRL) | (1U << ETHTOOL_STATS_RMON);
+  ethtool_stats_scraper scraper(groups);
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_ethtool_family(), &yerr);
+  if (!ys) {
+    printf("skip: %s\n", yerr.msg);
+    return 0;
+  }
+  fake_kernel kernel(ys);
+  struct ynl_sock* sock = ys;
+
+  kernel.dump(
+      kernel.seq(0),
+      sock->family_id,
+      {stats_body(2, 100, 3), stats_body(5, 200, 12)});
+  CHECK(scraper.scrape(ys));
+  auto req = unseq(kernel.sent());
+  CHECK(!req.empty());
+
+  /* A compact bitset of the groups asked for */
+  if (!req.empty()) {
+    const struct nlmsghdr* nlh = (const struct nlmsghdr*)req.data();
+    const struct nlattr *attr, *bit;
+    bool nomask = false;
+    __u32 value = 0;
+
+    CHECK(nlh->nlmsg_flags & NLM_F_DUMP);
+    ynl_attr_for_each(attr, nlh, GENL_HDRLEN) {
+      if (ynl_attr_type(attr) != ETHTOOL_A_STATS_GROUPS) {
+        continue;
+      }
+      ynl_attr_for_each_nested(bit, attr) {
+        if (ynl_attr_type(bit) == ETHTOOL_A_BITSET_NOMASK) {
+          nomask = true;
+        } else if (ynl_attr_type(bit) == ETHTOOL_A_BITSET_VALUE) {
+          memcpy(&value, ynl_attr_data(bit), sizeof(value));
+        }
+      }
+    }
+    CHECK(nomask && value == groups);
+  }
+
+  CHECK(scraper.size() == 2);
+  auto row = scraper.find(5);
+  CHECK(row && scraper.devs[*row].ifindex == 5);
+  CHECK(!scraper.find(3));
+  if (row) {
+    const auto& st = scraper.devs[*row];
+
+    CHECK(st.groups == ((1U << ETHTOOL_STATS_ETH_MAC) |
+                        (1U << ETHTOOL_STATS_RMON)));
+    CHECK(st.eth_mac[ETHTOOL_A_STATS_ETH_MAC_5_RX_PKT] == 200);
+    CHECK(st.eth_mac[ETHTOOL_A_STATS_ETH_MAC_2_TX_PKT] ==
+          ethtool_stat_not_set);
+    CHECK(st.eth_ctrl[ETHTOOL_A_STATS_ETH_CTRL_3_TX] == ethtool_stat_not_set);
+    CHECK(st.rmon[ETHTOOL_A_STATS_RMON_UNDERSIZE] == 7);
+    CHECK(st.eth_phy[0] == ethtool_stat_not_set);
+    /* More buckets than the kernel has today, the first ones are kept */
+    CHECK(st.rmon_rx.n == ynl_cpp::ethtool_rmon_hist_max);
+    CHECK(st.rmon_rx.low[9] == 64 << 9 && st.rmon_rx.high[9] == 65535);
+    CHECK(st.rmon_rx.val[9] == 1009 && st.rmon_tx.n == 0);
+  }
+  row = scraper.find(2);
+  CHECK(row && scraper.devs[*row].rmon_rx.n == 3);
+
+  /* The same request again, the records start over */
+  kernel.dump(kernel.seq(0), sock->family_id, {stats_body(5, 300, 1)});
+  CHECK(scraper.scrape(ys));
+  CHECK(unseq(kernel.sent()) == req);
+  CHECK(scraper.size() == 1 && !scraper.find(2));
+  row = scraper.find(5);
+  if (row) {
+    const auto& st = scraper.devs[*row];
+
+    CHECK(st.rmon_rx.n == 1);
+    CHECK(st.eth_mac[ETHTOOL_A_STATS_ETH_MAC_5_RX_PKT] == 300);
+  }
+
+  /* Stitched together from messages of elsewhere, devices repeat */
+  scraper.clear();
+  scraper.reserve(4);
+  for (__u32 ifindex : {7, 8, 7}) {
+    std::vector<__u8> body = stats_body(ifindex, ifindex, 0);
+    std::vector<__u8> msg(NLMSG_HDRLEN + body.size());
+    struct nlmsghdr* nlh = (struct nlmsghdr*)msg.data();
+
+    nlh->nlmsg_len = msg.size();
+    memcpy(msg.data() + NLMSG_HDRLEN, body.data(), body.size());
+    CHECK(scraper.add(nlh));
+  }
+  CHECK(scraper.size() == 2 && scraper.find(7) && scraper.find(8));
+
+  /* A group without its id fails the scrape */
+  std::vector<__u8> buf(256);
+  struct nlmsghdr* nlh = stats_start(buf, 9);
+  ynl_attr_nest_end(nlh, ynl_attr_nest_start(nlh, ETHTOOL_A_STATS_GRP));
+  std::vector<__u8> bad(
+      buf.begin() + NLMSG_HDRLEN, buf.begin() + nlh->nlmsg_len);
+  kernel.dump(kernel.seq(0), sock->family_id, {bad});
+  CHECK(!scraper.scrape(ys));
+  kernel.sent();
+
+  return check_failures ? 1 : 0;
+}
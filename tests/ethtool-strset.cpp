@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#include <ynl.hpp>
+
+#include "ethtool-strset.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/ethtool.h>
+#include <linux/ethtool_netlink.h>
+#include <linux/genetlink.h>
+
+/*
+ * strset_cache against a fake kernel: sets are fetched once, device
+ * independent ones once for all devices, names shared between devices
+ * are stored once, and views survive invalidation.
+ */
+
+using ynl_cpp::strset_cache;
+
+/* strset-get reply body of @sets, counts @short_by below their names */
+static std::vector<__u8> strset_body(
+    std::initializer_list<std::pair<__u32, std::vector<std::string>>> sets,
+    __u32 short_by = 0) {
+  std::vector<__u8> buf(1 << 16);
+  struct nlmsghdr* nlh = (struct nlmsghdr*)buf.data();
+  struct nlattr *outer, *set, *strings, *string;
+  struct genlmsghdr* gehdr;
+
+  nlh->nlmsg_len = NLMSG_HDRLEN;
+  nlh->nlmsg_pid = buf.size();
+  gehdr = (struct genlmsghdr*)ynl_nlmsg_put_extra_header(nlh, GENL_HDRLEN);
+  gehdr->cmd = ETHTOOL_MSG_STRSET_GET_REPLY;
+  outer = ynl_attr_nest_start(nlh, ETHTOOL_A_STRSET_STRINGSETS);
+  for (const auto& [id, names] : sets) {
+    set = ynl_attr_nest_start(nlh, ETHTOOL_A_STRINGSETS_STRINGSET);
+    ynl_attr_put_u32(nlh, ETHTOOL_A_STRINGSET_ID, id);
+    ynl_attr_put_u32(nlh, ETHTOOL_A_STRINGSET_COUNT, names.size() - short_by);
+    strings = ynl_attr_nest_start(nlh, ETHTOOL_A_STRINGSET_STRINGS);
+    for (size_t i = 0; i < names.size(); i++) {
+      string = ynl_attr_nest_start(nlh, ETHTOOL_A_STRINGS_STRING);
+      ynl_attr_put_u32(nlh, ETHTOOL_A_STRING_INDEX, i);
+      ynl_attr_put_str(nlh, ETHTOOL_A_STRING_VALUE, names[i].c_str());
+      ynl_attr_nest_end(nlh, string);
+    }
+    ynl_attr_nest_end(nlh, strings);
+    ynl_attr_nest_end(nlh, set);
+  }
+  ynl_attr_nest_end(nlh, outer);
+
+  return {buf.begin() + NLMSG_HDRLEN, buf.begin() + nlh->nlmsg_len};
+}
+
+/* Answer the next request with @body, then ACK it */
+static void answer(
+    fake_kernel& kernel,
+    struct ynl_sock* sock,
+    const std::vector<__u8>& body) {
+  kernel.reply(kernel.seq(0), sock->family_id, body.data(), body.size());
+  kernel.ack(kernel.seq(0), 0);
+}
+
+/* ETHTOOL_A_HEADER_DEV_INDEX of a sent strset-get, 0 if none */
+static __u32 sent_dev(const std::vector<std::vector<__u8>>& sent) {
+  const struct nlattr *attr, *hdr;
+  const struct nlmsghdr* nlh;
+
+  if (sent.size() != 1) {
+    return ~0U;
+  }
+  nlh = (const struct nlmsghdr*)sent[0].data();
+  ynl_attr_for_each(attr, nlh, GENL_HDRLEN) {
+    if (ynl_attr_type(attr) != ETHTOOL_A_STRSET_HEADER) {
+      continue;
+    }
+    ynl_attr_for_each_nested(hdr, attr) {
+      if (ynl_attr_type(hdr) == ETHTOOL_A_HEADER_DEV_INDEX) {
+        return ynl_attr_get_u32(hdr);
+      }
+    }
+  }
+  return 0;
+}
+
+int main() {
+  const std::vector<std::string> stats = {"rx_packets", "tx_packets", "drops"};
+  strset_cache cache;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_ethtool_family(), &yerr);
+  if (!ys) {
+    printf("skip: %s\n", yerr.msg);
+    return 0;
+  }
+  fake_kernel kernel(ys);
+  struct ynl_sock* sock = ys;
+
+  /* Fetched for the device, then served from the cache */
+  answer(kernel, sock, strset_body({{ETH_SS_STATS, stats}}));
+  auto names = cache.get(ys, 2, ETH_SS_STATS);
+  CHECK(names && names->size() == 3);
+  CHECK(sent_dev(kernel.sent()) == 2);
+  if (!names || names->size() != 3) {
+    return 1;
+  }
+  std::string_view rx = (*names)[0];
+  CHECK(rx == "rx_packets" && (*names)[2] == "drops");
+  size_t bytes = cache.arena_bytes();
+  CHECK(bytes == 11 + 11 + 6);
+
+  auto again = cache.name(ys, 2, ETH_SS_STATS, 1);
+  CHECK(again && *again == "tx_packets");
+  CHECK(cache.name(ys, 2, ETH_SS_STATS, 3) == "");
+  CHECK(cache.fetches() == 1 && kernel.sent().empty());
+
+  /* Another port of the same NIC, names shared */
+  answer(kernel, sock, strset_body({{ETH_SS_STATS, stats}}));
+  auto port = cache.get(ys, 3, ETH_SS_STATS);
+  CHECK(port && port->size() == 3);
+  CHECK(sent_dev(kernel.sent()) == 3);
+  CHECK(port && (*port)[0].data() == rx.data());
+  CHECK(cache.arena_bytes() == bytes && cache.fetches() == 2);
+
+  /* Link modes are the same for every device, fetched once */
+  answer(kernel, sock, strset_body({{ETH_SS_LINK_MODES, {"10baseT/Half"}}}));
+  CHECK(cache.name(ys, 2, ETH_SS_LINK_MODES, 0) == "10baseT/Half");
+  CHECK(sent_dev(kernel.sent()) == 0);
+  CHECK(cache.name(ys, 5, ETH_SS_LINK_MODES, 0) == "10baseT/Half");
+  CHECK(cache.fetches() == 3);
+
+  /* Bits resolved to names, past the end of the set without one */
+  const __u32 words[] = {0x5, 0x100};
+  std::vector<std::pair<__u32, std::string_view>> bits;
+  auto ret = cache.for_each_bit(
+      ys, 2, ETH_SS_STATS, words, [&](__u32 bit, std::string_view name) {
+        bits.emplace_back(bit, name);
+      });
+  CHECK(ret && bits.size() == 3);
+  if (bits.size() == 3) {
+    CHECK(bits[0].first == 0 && bits[0].second == "rx_packets");
+    CHECK(bits[1].first == 2 && bits[1].second == "drops");
+    CHECK(bits[2].first == 40 && bits[2].second.empty());
+  }
+
+  /* Several sets in one request, one reply */
+  answer(
+      kernel,
+      sock,
+      strset_body({{ETH_SS_STATS, stats}, {ETH_SS_PRIV_FLAGS, {"legacy"}}}));
+  CHECK(cache.fetch(ys, 4, {ETH_SS_STATS, ETH_SS_PRIV_FLAGS}));
+  CHECK(cache.fetches() == 4 && sent_dev(kernel.sent()) == 4);
+  CHECK(cache.find(4, ETH_SS_STATS) && cache.find(4, ETH_SS_PRIV_FLAGS));
+  CHECK(cache.fetch(ys, 4, {ETH_SS_STATS}) && cache.fetches() == 4);
+
+  /* Invalidation drops the device's own sets, views stay valid */
+  cache.invalidate(2);
+  CHECK(!cache.find(2, ETH_SS_STATS));
+  CHECK(cache.find(3, ETH_SS_STATS) && cache.find(2, ETH_SS_LINK_MODES));
+  CHECK(rx == "rx_packets");
+  answer(kernel, sock, strset_body({{ETH_SS_STATS, {"rx_bytes"}}}));
+  CHECK(cache.name(ys, 2, ETH_SS_STATS, 0) == "rx_bytes");
+  CHECK(cache.fetches() == 5 && rx == "rx_packets");
+
+  /* Enough names to grow the interning table, all kept apart */
+  std::vector<std::string> many;
+  for (int i = 0; i < 1500; i++) {
+    many.push_back("queue_" + std::to_string(i) + "_packets");
+  }
+  answer(kernel, sock, strset_body({{ETH_SS_STATS, many}}));
+  auto big = cache.get(ys, 6, ETH_SS_STATS);
+  CHECK(big && big->size() == many.size());
+  for (size_t i = 0; big && i < big->size(); i++) {
+    CHECK((*big)[i] == many[i]);
+  }
+  answer(kernel, sock, strset_body({{ETH_SS_STATS, many}}));
+  bytes = cache.arena_bytes();
+  auto twin = cache.get(ys, 7, ETH_SS_STATS);
+  CHECK(twin && cache.arena_bytes() == bytes);
+  CHECK(twin && big && (*twin)[1499].data() == (*big)[1499].data());
+
+  /* A string past the advertised count fails the fetch */
+  answer(kernel, sock, strset_body({{ETH_SS_STATS, stats}}, 1));
+  CHECK(!cache.get(ys, 8, ETH_SS_STATS));
+  kernel.sent();
+
+  return check_failures ? 1 : 0;
+}
@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <errno.h>
+#include <glob.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <ynl.hpp>
+
+#include "netdev-user.hpp"
+#include "ynl-dyn.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/genetlink.h>
+#include <linux/netdev.h>
+
+/*
+ * dyn_family on the generated spec blobs and hand made ones: every blob
+ * of the tree loads, requests encode the same bytes as the generated
+ * code, replies decode, and blobs whose fixed headers don't add up are
+ * rejected, or fail the request, rather than overflowing its buffer.
+ */
+
+/* Little endian writer for hand made blobs, see render_blob() */
+struct blob_writer {
+  std::vector<unsigned char> buf;
+
+  void u8(__u8 v) {
+    buf.push_back(v);
+  }
+  void u16(__u16 v) {
+    u8(v);
+    u8(v >> 8);
+  }
+  void u32(__u32 v) {
+    u16(v);
+    u16(v >> 16);
+  }
+  void str(const char* s) {
+    u16(strlen(s));
+    buf.insert(buf.end(), s, s + strlen(s));
+  }
+};
+
+/* Classic family, op "get" with a fixed header of one member */
+static std::vector<unsigned char>
+hdr_blob(ynl_cpp::dyn_type kind, __u16 offset, __u16 len) {
+  blob_writer w;
+
+  w.u32(0x424c4e59);
+  w.u16(2);
+  w.u16(0);
+  w.str("test");
+  w.u8(1); /* classic */
+  w.u8(0);
+  w.u8(0);
+  /* structs */
+  w.u16(1);
+  w.str("hdr");
+  w.u16(1);
+  w.str("member");
+  w.u8((__u8)kind);
+  w.u8(0);
+  w.u16(offset);
+  w.u16(len);
+  w.u16(0); /* fixed header */
+  /* sets */
+  w.u16(0);
+  /* ops */
+  w.u16(1);
+  w.str("get");
+  w.u32(16);
+  w.u32(16);
+  w.u16(0xffff);
+  w.u16(0);
+  w.u8(1);
+  /* groups */
+  w.u16(0);
+  return w.buf;
+}
+
+/* The one message sent, with its sequence number cleared */
+static std::vector<__u8> unseq(std::vector<std::vector<__u8>> sent) {
+  struct nlmsghdr* nlh;
+
+  if (sent.size() != 1) {
+    return {};
+  }
+  nlh = (struct nlmsghdr*)sent[0].data();
+  nlh->nlmsg_seq = 0;
+  return sent[0];
+}
+
+int main() {
+  glob_t blobs = {};
+  ynl_error yerr;
+
+  /* Every blob of the tree loads */
+  if (glob("../generated/*.ynlb", 0, nullptr, &blobs) == 0) {
+    for (size_t i = 0; i < blobs.gl_pathc; i++) {
+      auto fam = ynl_cpp::dyn_family::load(blobs.gl_pathv[i]);
+
+      if (!fam) {
+        fprintf(
+            stderr,
+            "%s: %s\n",
+            blobs.gl_pathv[i],
+            fam.error().message().c_str());
+      }
+      CHECK(fam);
+    }
+  }
+  CHECK(blobs.gl_pathc > 1);
+  globfree(&blobs);
+
+  /* Fixed header members of the length their kind says */
+  using ynl_cpp::dyn_type;
+  CHECK(ynl_cpp::dyn_family::parse(hdr_blob(dyn_type::u32, 4, 4)));
+  CHECK(!ynl_cpp::dyn_family::parse(hdr_blob(dyn_type::u32, 4, 2)));
+  CHECK(!ynl_cpp::dyn_family::parse(hdr_blob(dyn_type::u64, 0, 4)));
+  CHECK(!ynl_cpp::dyn_family::parse(hdr_blob(dyn_type::string, 0, 4)));
+  CHECK(ynl_cpp::dyn_family::parse(hdr_blob(dyn_type::binary, 0, 1000)));
+  CHECK(!ynl_cpp::dyn_family::parse(hdr_blob(dyn_type::binary, 0, 5000)));
+  CHECK(!ynl_cpp::dyn_family::parse(hdr_blob(dyn_type::u8, 65000, 1)));
+
+  {
+    auto fam = ynl_cpp::dyn_family::parse(hdr_blob(dyn_type::u32, 4, 4));
+    if (fam) {
+      ynl_cpp::dyn_request req(**fam, *(*fam)->op("get"));
+      __u32 val;
+
+      req.set_hdr("member", 0x01020304);
+      CHECK(!req.err());
+      CHECK(req.hdr().size() == 8);
+      memcpy(&val, req.hdr().data() + 4, sizeof(val));
+      CHECK(val == 0x01020304);
+    }
+
+    /* A header bigger than the message fails the request */
+    fam = ynl_cpp::dyn_family::parse(hdr_blob(dyn_type::binary, 0, 1000));
+    if (fam) {
+      ynl_cpp::dyn_request req(**fam, *(*fam)->op("get"), false, 0, 512);
+
+      CHECK(req.err());
+      CHECK(req.err() && req.err()->code() == YNL_ERROR_INPUT_INVALID);
+      req.put("anything", 1);
+      CHECK(req.nlh()->nlmsg_len <= NLMSG_HDRLEN + 1000);
+    }
+  }
+
+  /* The runtime family encodes what the generated code does */
+  auto fam = ynl_cpp::dyn_family::load("../generated/netdev.ynlb");
+  CHECK(fam);
+  if (!fam) {
+    return 1;
+  }
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_netdev_family(), &yerr);
+  if (!ys) {
+    printf("skip: %s\n", yerr.msg);
+    return check_failures ? 1 : 0;
+  }
+  fake_kernel kernel(ys);
+  kernel.answer([](const struct nlmsghdr*) { return 0; });
+
+  ynl_cpp::netdev_napi_set_req set;
+  set.id = 1000;
+  set.defer_hard_irqs = 100;
+  set.gro_flush_timeout = 20000;
+  CHECK(ynl_cpp::netdev_napi_set(ys, set) == 0);
+  auto want = unseq(kernel.sent());
+
+  ynl_cpp::dyn_request req(**fam, *(*fam)->op("napi-set"));
+  req.put("id", 1000).put("defer-hard-irqs", 100);
+  req.put("gro-flush-timeout", 20000);
+  CHECK(!req.err());
+  CHECK((*fam)->exec(ys, req));
+  auto got = unseq(kernel.sent());
+  CHECK(!want.empty() && got == want);
+
+  /* A failing request reports the kernel's error */
+  kernel.answer([](const struct nlmsghdr*) { return ENOENT; });
+  auto ret = (*fam)->exec(ys, req);
+  CHECK(!ret && ret.error().sys_errno() == ENOENT);
+  kernel.answer(nullptr);
+  kernel.sent();
+
+  /* A napi-get reply decodes by name */
+  {
+    alignas(NLMSG_ALIGNTO) __u8 buf[128] = {};
+    struct nlmsghdr* nlh = (struct nlmsghdr*)buf;
+    const ynl_cpp::dyn_op* op = (*fam)->op("napi-get");
+    struct genlmsghdr* gehdr;
+    ynl_cpp::dyn_value val;
+
+    nlh->nlmsg_len = NLMSG_HDRLEN;
+    nlh->nlmsg_pid = sizeof(buf);
+    gehdr = (struct genlmsghdr*)ynl_nlmsg_put_extra_header(nlh, GENL_HDRLEN);
+    gehdr->cmd = NETDEV_CMD_NAPI_GET;
+    ynl_attr_put_u32(nlh, NETDEV_A_NAPI_IFINDEX, 2);
+    ynl_attr_put_u32(nlh, NETDEV_A_NAPI_ID, 1000);
+    ynl_attr_put_u64(nlh, NETDEV_A_NAPI_GRO_FLUSH_TIMEOUT, 20000);
+
+    CHECK(op && (*fam)->decode(*op, nlh, val));
+    CHECK(val.get("ifindex") && val.get("ifindex")->num == 2);
+    CHECK(val.get("id") && val.get("id")->num == 1000);
+    CHECK(val.get("gro-flush-timeout"));
+    CHECK(!val.get("irq"));
+
+    /* Cut into the genlmsghdr */
+    nlh->nlmsg_len = NLMSG_HDRLEN + 2;
+    CHECK(op && !(*fam)->decode(*op, nlh, val));
+  }
+
+  return check_failures ? 1 : 0;
+}
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <errno.h>
+#include <stdio.h>
+
+#include <ynl.hpp>
+
+#include "netdev-napi.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/genetlink.h>
+#include <linux/netdev.h>
+
+/*
+ * napi_tuner against a fake kernel: only the settings which differ are
+ * sent, and on a host with hundreds of NAPIs a kernel rejecting every
+ * napi-set fails each NAPI's own result rather than the call.
+ */
+
+/* napi-get dump reply body of NAPI @id of @ifindex */
+static std::vector<__u8> napi_body(__u32 ifindex, __u32 id, __u32 defer) {
+  alignas(NLMSG_ALIGNTO) __u8 buf[128] = {};
+  struct nlmsghdr* nlh = (struct nlmsghdr*)buf;
+  struct genlmsghdr* gehdr;
+
+  nlh->nlmsg_len = NLMSG_HDRLEN;
+  nlh->nlmsg_pid = sizeof(buf);
+  gehdr = (struct genlmsghdr*)ynl_nlmsg_put_extra_header(nlh, GENL_HDRLEN);
+  gehdr->cmd = NETDEV_CMD_NAPI_GET;
+  ynl_attr_put_u32(nlh, NETDEV_A_NAPI_IFINDEX, ifindex);
+  ynl_attr_put_u32(nlh, NETDEV_A_NAPI_ID, id);
+  ynl_attr_put_u32(nlh, NETDEV_A_NAPI_DEFER_HARD_IRQS, defer);
+
+  return {buf + NLMSG_HDRLEN, buf + nlh->nlmsg_len};
+}
+
+/* napi-set attribute @type of a sent message, nullptr if it has none */
+static const struct nlattr*
+sent_attr(const struct nlmsghdr* nlh, unsigned int type) {
+  const struct nlattr* attr;
+
+  ynl_attr_for_each(attr, nlh, GENL_HDRLEN) {
+    if (ynl_attr_type(attr) == type) {
+      return attr;
+    }
+  }
+  return nullptr;
+}
+
+int main() {
+  const size_t n = 512;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_netdev_family(), &yerr);
+  if (!ys) {
+    printf("skip: %s\n", yerr.msg);
+    return 0;
+  }
+  fake_kernel kernel(ys);
+  struct ynl_sock* sock = ys;
+
+  /* 512 NAPIs, every tenth one already set up */
+  std::vector<std::vector<__u8>> napis;
+  for (size_t i = 0; i < n; i++) {
+    napis.push_back(napi_body(2, 1000 + i, i % 10 ? 0 : 100));
+  }
+
+  ynl_cpp::napi_tuner tuner({
+      {.config = {.defer_hard_irqs = 100}},
+  });
+
+  /* A kernel without the attribute, every napi-set fails */
+  kernel.dump(kernel.seq(0), sock->family_id, napis);
+  kernel.answer([](const struct nlmsghdr* nlh) {
+    CHECK(sent_attr(nlh, NETDEV_A_NAPI_DEFER_HARD_IRQS));
+    CHECK(!sent_attr(nlh, NETDEV_A_NAPI_GRO_FLUSH_TIMEOUT));
+    return EOPNOTSUPP;
+  });
+
+  auto ret = tuner.apply(ys);
+  CHECK(ret);
+  CHECK(tuner.results.size() == n);
+  for (size_t i = 0; i < tuner.results.size(); i++) {
+    const auto& res = tuner.results[i];
+
+    CHECK(res.id == 1000 + i);
+    CHECK(!res.changed());
+    if (i % 10) {
+      CHECK(res.err && res.err->sys_errno() == EOPNOTSUPP);
+    } else {
+      CHECK(res.change.empty() && !res.err);
+    }
+  }
+  CHECK(kernel.dropped() == 0);
+  CHECK(kernel.sends() > 2);
+  kernel.sent();
+
+  /* Only some rejected */
+  kernel.dump(kernel.seq(0), sock->family_id, napis);
+  kernel.answer([](const struct nlmsghdr* nlh) {
+    const struct nlattr* id = sent_attr(nlh, NETDEV_A_NAPI_ID);
+
+    return id && ynl_attr_get_u32(id) % 2 ? EINVAL : 0;
+  });
+
+  ret = tuner.apply(ys);
+  CHECK(ret);
+  size_t changed = 0, failed = 0;
+  for (const auto& res : tuner.results) {
+    changed += res.changed();
+    failed += !!res.err;
+    CHECK(!res.err || res.id % 2);
+  }
+  CHECK(changed + failed == n - n / 10 - 1);
+  /* Odd ids, none of which is a tenth one */
+  CHECK(failed == n / 2);
+  CHECK(kernel.dropped() == 0);
+  kernel.answer(nullptr);
+  kernel.sent();
+
+  return check_failures ? 1 : 0;
+}
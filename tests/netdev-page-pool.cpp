@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <errno.h>
+#include <stdio.h>
+
+#include <functional>
+
+#include <ynl.hpp>
+
+#include "netdev-page-pool.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/genetlink.h>
+#include <linux/netdev.h>
+
+/*
+ * page_pool_monitor on replayed page-pool dumps and notifications: pools
+ * and their counters are joined, detached pools draining are followed
+ * until they go away, and a kernel without page pool stats is asked
+ * only once.
+ */
+
+using ynl_cpp::page_pool_monitor;
+
+struct pool {
+  __u64 id;
+  __u32 ifindex;
+  __u64 napi_id;
+  __u64 inflight;
+  __u64 detach_time;
+};
+
+struct counters {
+  __u64 id;
+  __u64 recycled;
+  __u64 released;
+};
+
+static std::vector<__u8> genl_body(
+    __u8 cmd,
+    const std::function<void(struct nlmsghdr*)>& put) {
+  alignas(NLMSG_ALIGNTO) __u8 buf[256] = {};
+  struct nlmsghdr* nlh = (struct nlmsghdr*)buf;
+  struct genlmsghdr* gehdr;
+
+  nlh->nlmsg_len = NLMSG_HDRLEN;
+  nlh->nlmsg_pid = sizeof(buf);
+  gehdr = (struct genlmsghdr*)ynl_nlmsg_put_extra_header(nlh, GENL_HDRLEN);
+  gehdr->cmd = cmd;
+  put(nlh);
+
+  return {buf + NLMSG_HDRLEN, buf + nlh->nlmsg_len};
+}
+
+/* page-pool-get reply body, attributes which don't apply left out */
+static std::vector<__u8> pool_body(const pool& pp) {
+  return genl_body(NETDEV_CMD_PAGE_POOL_GET, [&](struct nlmsghdr* nlh) {
+    ynl_attr_put_uint(nlh, NETDEV_A_PAGE_POOL_ID, pp.id);
+    if (pp.ifindex) {
+      ynl_attr_put_u32(nlh, NETDEV_A_PAGE_POOL_IFINDEX, pp.ifindex);
+    }
+    if (pp.napi_id) {
+      ynl_attr_put_uint(nlh, NETDEV_A_PAGE_POOL_NAPI_ID, pp.napi_id);
+    }
+    ynl_attr_put_uint(nlh, NETDEV_A_PAGE_POOL_INFLIGHT, pp.inflight);
+    ynl_attr_put_uint(nlh, NETDEV_A_PAGE_POOL_INFLIGHT_MEM, pp.inflight << 12);
+    if (pp.detach_time) {
+      ynl_attr_put_uint(nlh, NETDEV_A_PAGE_POOL_DETACH_TIME, pp.detach_time);
+    }
+  });
+}
+
+/* page-pool-stats-get reply body, recycled into the ring */
+static std::vector<__u8> stats_body(const counters& st) {
+  return genl_body(NETDEV_CMD_PAGE_POOL_STATS_GET, [&](struct nlmsghdr* nlh) {
+    struct nlattr* info;
+
+    info = ynl_attr_nest_start(nlh, NETDEV_A_PAGE_POOL_STATS_INFO);
+    ynl_attr_put_uint(nlh, NETDEV_A_PAGE_POOL_ID, st.id);
+    ynl_attr_nest_end(nlh, info);
+    ynl_attr_put_uint(
+        nlh, NETDEV_A_PAGE_POOL_STATS_ALLOC_FAST, st.recycled + st.released);
+    ynl_attr_put_uint(nlh, NETDEV_A_PAGE_POOL_STATS_RECYCLE_RING, st.recycled);
+    ynl_attr_put_uint(
+        nlh, NETDEV_A_PAGE_POOL_STATS_RECYCLE_RELEASED_REFCNT, st.released);
+  });
+}
+
+static ynl_cpp::netdev_page_pool_get_rsp ntf(const pool& pp) {
+  ynl_cpp::netdev_page_pool_get_rsp rsp;
+
+  rsp.id = pp.id;
+  if (pp.ifindex) {
+    rsp.ifindex = pp.ifindex;
+  }
+  if (pp.napi_id) {
+    rsp.napi_id = pp.napi_id;
+  }
+  rsp.inflight = pp.inflight;
+  if (pp.detach_time) {
+    rsp.detach_time = pp.detach_time;
+  }
+  return rsp;
+}
+
+int main() {
+  page_pool_monitor mon;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_netdev_family(), &yerr);
+  if (!ys) {
+    printf("skip: %s\n", yerr.msg);
+    return 0;
+  }
+  fake_kernel kernel(ys);
+  struct ynl_sock* sock = ys;
+
+  /* An attached pool, one draining after its netdev went away, one done */
+  kernel.dump(
+      kernel.seq(0),
+      sock->family_id,
+      {pool_body({1, 2, 100, 10, 0}),
+       pool_body({2, 0, 0, 5, 1000}),
+       pool_body({3, 0, 0, 0, 1000})});
+  /* Counters of a pool created since are left for its notification */
+  kernel.dump(
+      kernel.seq(1),
+      sock->family_id,
+      {stats_body({1, 30, 10}), stats_body({9, 1, 1})});
+  CHECK(mon.load(ys));
+  CHECK(kernel.sent().size() == 2);
+  CHECK(mon.size() == 3 && mon.resyncs() == 1 && mon.has_stats());
+  CHECK(!mon.find(9));
+
+  const ynl_cpp::page_pool_entry* pp = mon.find(1);
+  CHECK(pp && pp->ifindex == 2 && pp->napi_id == 100);
+  CHECK(pp && pp->inflight == 10 && pp->inflight_mem == 10 << 12);
+  CHECK(pp && !pp->leaking() && pp->has_stats);
+  CHECK(pp && pp->stats.recycle_ring == 30 && pp->stats.alloc_fast == 40);
+  CHECK(pp && pp->stats.recycle_ratio() == 0.75);
+  pp = mon.find(2);
+  CHECK(pp && pp->ifindex == 0 && pp->leaking() && !pp->has_stats);
+  CHECK(pp && pp->stats.recycle_ratio() == -1);
+  CHECK(mon.find(3) && !mon.find(3)->leaking());
+
+  std::vector<__u64> leaks;
+  mon.for_each_leak([&](const auto& e) { leaks.push_back(e.id); });
+  CHECK(leaks == std::vector<__u64>({2}));
+
+  /* Notifications: a new pool, pool 1 moved to another NAPI, 3 gone */
+  mon.apply(ntf({4, 3, 200, 1, 0}), false);
+  mon.apply(ntf({1, 2, 101, 8, 0}), false);
+  mon.apply(ntf({3, 0, 0, 0, 0}), true);
+  CHECK(mon.size() == 3 && !mon.find(3));
+  pp = mon.find(1);
+  CHECK(pp && pp->napi_id == 101 && pp->inflight == 8);
+  CHECK(pp && pp->has_stats && pp->stats.recycle_ring == 30);
+
+  /* Counters of the interval, then the draining pool is asked for */
+  kernel.dump(
+      kernel.seq(0),
+      sock->family_id,
+      {stats_body({1, 40, 20}), stats_body({4, 5, 0})});
+  std::vector<__u8> drained = pool_body({2, 0, 0, 2, 1000});
+  kernel.reply(kernel.seq(1), sock->family_id, drained.data(), drained.size());
+  kernel.ack(kernel.seq(1), 0);
+  CHECK(mon.refresh(ys));
+  CHECK(kernel.sent().size() == 2);
+  pp = mon.find(1);
+  CHECK(pp && pp->stats.recycle_ratio() == 40.0 / 60);
+  CHECK(pp && pp->recent_recycle_ratio() == 0.5);
+  pp = mon.find(4);
+  CHECK(pp && pp->has_stats && pp->recent_recycle_ratio() == 1);
+  CHECK(mon.find(2) && mon.find(2)->inflight == 2);
+
+  /* All its pages are back, the pool is gone */
+  kernel.dump(kernel.seq(0), sock->family_id, {stats_body({1, 40, 20})});
+  kernel.ack(kernel.seq(1), ENOENT);
+  CHECK(mon.refresh(ys));
+  CHECK(!mon.find(2) && mon.size() == 2);
+  pp = mon.find(1);
+  CHECK(pp && pp->recent_recycle_ratio() == -1);
+  kernel.sent();
+
+  /* A resync drops what disappeared and keeps the counters */
+  kernel.dump(kernel.seq(0), sock->family_id, {pool_body({1, 2, 101, 8, 0})});
+  kernel.dump(kernel.seq(1), sock->family_id, {});
+  CHECK(mon.load(ys));
+  CHECK(mon.size() == 1 && mon.resyncs() == 2);
+  pp = mon.find(1);
+  CHECK(pp && pp->has_stats && pp->stats.recycle_ring == 40);
+  kernel.sent();
+
+  /* Without CONFIG_PAGE_POOL_STATS the stats are asked for only once */
+  page_pool_monitor bare;
+  kernel.dump(kernel.seq(0), sock->family_id, {pool_body({1, 2, 100, 1, 0})});
+  kernel.ack(kernel.seq(1), EOPNOTSUPP);
+  CHECK(bare.load(ys));
+  CHECK(!bare.has_stats() && bare.size() == 1);
+  CHECK(kernel.sent().size() == 2);
+  CHECK(bare.refresh(ys));
+  CHECK(kernel.sent().empty());
+
+  return check_failures ? 1 : 0;
+}
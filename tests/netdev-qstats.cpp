@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+
+#include <ynl.hpp>
+
+#include "netdev-qstats.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/genetlink.h>
+#include <linux/netdev.h>
+
+/*
+ * qstats_sampler on replayed qstats-get dumps: deltas of unchanged queues,
+ * counters reset in between, and queues coming and going, per queue and
+ * summed per device and queue type.
+ */
+
+using ynl_cpp::qstats_col;
+using ynl_cpp::qstats_sampler;
+
+struct queue {
+  __u32 ifindex;
+  __u32 type;
+  __u32 id;
+  __u64 rx_packets;
+  __u64 tx_packets;
+};
+
+/* qstats-get dump reply body of one queue */
+static std::vector<__u8> qstats_body(const queue& q) {
+  alignas(NLMSG_ALIGNTO) __u8 buf[256] = {};
+  struct nlmsghdr* nlh = (struct nlmsghdr*)buf;
+  struct genlmsghdr* gehdr;
+
+  nlh->nlmsg_len = NLMSG_HDRLEN;
+  nlh->nlmsg_pid = sizeof(buf);
+  gehdr = (struct genlmsghdr*)ynl_nlmsg_put_extra_header(nlh, GENL_HDRLEN);
+  gehdr->cmd = NETDEV_CMD_QSTATS_GET;
+  ynl_attr_put_u32(nlh, NETDEV_A_QSTATS_IFINDEX, q.ifindex);
+  ynl_attr_put_u32(nlh, NETDEV_A_QSTATS_QUEUE_TYPE, q.type);
+  ynl_attr_put_u32(nlh, NETDEV_A_QSTATS_QUEUE_ID, q.id);
+  if (q.type == NETDEV_QUEUE_TYPE_RX) {
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_RX_PACKETS, q.rx_packets);
+  } else {
+    ynl_attr_put_uint(nlh, NETDEV_A_QSTATS_TX_PACKETS, q.tx_packets);
+  }
+
+  return {buf + NLMSG_HDRLEN, buf + nlh->nlmsg_len};
+}
+
+static bool sample(
+    fake_kernel& kernel,
+    struct ynl_sock* sock,
+    ynl_cpp::ynl_socket& ys,
+    qstats_sampler& qs,
+    const std::vector<queue>& queues) {
+  std::vector<std::vector<__u8>> bodies;
+
+  for (const auto& q : queues) {
+    bodies.push_back(qstats_body(q));
+  }
+  kernel.dump(kernel.seq(0), sock->family_id, bodies);
+  return qs.sample(ys).has_value();
+}
+
+int main() {
+  const unsigned int rx = qstats_col(NETDEV_A_QSTATS_RX_PACKETS);
+  const unsigned int tx = qstats_col(NETDEV_A_QSTATS_TX_PACKETS);
+  std::vector<queue> queues;
+  qstats_sampler qs;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_netdev_family(), &yerr);
+  if (!ys) {
+    printf("skip: %s\n", yerr.msg);
+    return 0;
+  }
+  fake_kernel kernel(ys);
+  struct ynl_sock* sock = ys;
+
+  /* Device 2 with 5 queue pairs, an odd count, device 3 with one */
+  for (__u32 i = 0; i < 5; i++) {
+    queues.push_back({2, NETDEV_QUEUE_TYPE_RX, i, 1000 * i, 0});
+  }
+  for (__u32 i = 0; i < 5; i++) {
+    queues.push_back({2, NETDEV_QUEUE_TYPE_TX, i, 0, 2000 * i});
+  }
+  queues.push_back({3, NETDEV_QUEUE_TYPE_RX, 0, 7, 0});
+  queues.push_back({3, NETDEV_QUEUE_TYPE_TX, 0, 0, 9});
+
+  CHECK(sample(kernel, sock, ys, qs, queues));
+  auto sent = kernel.sent();
+  CHECK(sent.size() == 1);
+  if (sent.size() == 1) {
+    const struct nlmsghdr* nlh = (const struct nlmsghdr*)sent[0].data();
+    const struct nlattr* attr;
+    bool scoped = false;
+
+    CHECK(nlh->nlmsg_flags & NLM_F_DUMP);
+    ynl_attr_for_each(attr, nlh, GENL_HDRLEN) {
+      scoped |= ynl_attr_type(attr) == NETDEV_A_QSTATS_SCOPE &&
+          ynl_attr_get_uint(attr) == NETDEV_QSTATS_SCOPE_QUEUE;
+    }
+    CHECK(scoped);
+  }
+  CHECK(qs.samples() == 1 && qs.cur().size() == 12);
+  for (size_t i = 0; i < qs.cur().size(); i++) {
+    CHECK(qs.flags[i] == qstats_sampler::QSTATS_NEW);
+    CHECK(qs.delta[rx][i] == 0 && qs.delta[tx][i] == 0);
+  }
+  CHECK(qs.cur().present_any == ((1U << rx) | (1U << tx)));
+
+  /* Same queues, 10 more packets each, rx queue 3 of device 2 reset */
+  for (auto& q : queues) {
+    q.rx_packets += q.type == NETDEV_QUEUE_TYPE_RX ? 10 : 0;
+    q.tx_packets += q.type == NETDEV_QUEUE_TYPE_TX ? 10 : 0;
+  }
+  queues[3].rx_packets = 4;
+  CHECK(sample(kernel, sock, ys, qs, queues));
+  CHECK(qs.samples() == 2 && qs.removed.empty());
+  for (size_t i = 0; i < queues.size(); i++) {
+    __u64 want = i == 3 ? 4 : 10;
+
+    if (queues[i].type == NETDEV_QUEUE_TYPE_RX) {
+      CHECK(qs.delta[rx][i] == want && qs.delta[tx][i] == 0);
+    } else {
+      CHECK(qs.delta[tx][i] == want && qs.delta[rx][i] == 0);
+    }
+    CHECK(qs.flags[i] == (i == 3 ? qstats_sampler::QSTATS_RESET : 0));
+  }
+  CHECK(qs.dev_ifindex == std::vector<__u32>({2, 3}));
+  CHECK(qs.dev_delta[rx].size() == 2);
+  if (qs.dev_delta[rx].size() == 2) {
+    CHECK(qs.dev_delta[rx][0] == 44 && qs.dev_delta[tx][0] == 50);
+    CHECK(qs.dev_delta[rx][1] == 10 && qs.dev_delta[tx][1] == 10);
+  }
+  CHECK(qs.type_delta[NETDEV_QUEUE_TYPE_RX][rx] == 54);
+  CHECK(qs.type_delta[NETDEV_QUEUE_TYPE_TX][tx] == 60);
+  CHECK(qs.type_delta[NETDEV_QUEUE_TYPE_RX][tx] == 0);
+  CHECK(qs.interval() > 0);
+
+  /* Device 3 first, tx queue 4 of device 2 gone, an rx queue 5 added */
+  std::vector<queue> moved = {queues[10], queues[11]};
+  moved.insert(moved.end(), queues.begin(), queues.begin() + 5);
+  moved.push_back({2, NETDEV_QUEUE_TYPE_RX, 5, 500, 0});
+  moved.insert(moved.end(), queues.begin() + 5, queues.begin() + 9);
+  for (auto& q : moved) {
+    q.rx_packets += q.type == NETDEV_QUEUE_TYPE_RX ? 1 : 0;
+    q.tx_packets += q.type == NETDEV_QUEUE_TYPE_TX ? 1 : 0;
+  }
+  CHECK(sample(kernel, sock, ys, qs, moved));
+  CHECK(qs.cur().size() == 12);
+  CHECK(qs.removed == std::vector<size_t>({9}));
+  for (size_t i = 0; i < moved.size(); i++) {
+    const auto& q = moved[i];
+    unsigned int col = q.type == NETDEV_QUEUE_TYPE_RX ? rx : tx;
+    bool added = q.type == NETDEV_QUEUE_TYPE_RX && q.id == 5;
+
+    CHECK(qs.flags[i] == (added ? qstats_sampler::QSTATS_NEW : 0));
+    CHECK(qs.delta[col][i] == (added ? 0 : 1));
+    CHECK(qs.cur().find(q.ifindex, q.type, q.id) == i);
+  }
+  CHECK(!qs.cur().find(2, NETDEV_QUEUE_TYPE_TX, 4));
+  CHECK(qs.dev_ifindex == std::vector<__u32>({3, 2}));
+  if (qs.dev_delta[rx].size() == 2) {
+    CHECK(qs.dev_delta[rx][1] == 5 && qs.dev_delta[tx][1] == 4);
+  }
+
+  /* A reply missing its queue id fails the sample */
+  std::vector<std::vector<__u8>> bad = {qstats_body(queues[0])};
+  bad[0].resize(bad[0].size() - 2 * NLA_HDRLEN - 2 * sizeof(__u32));
+  kernel.dump(kernel.seq(0), sock->family_id, bad);
+  CHECK(!qs.sample(ys));
+  CHECK(qs.samples() == 3);
+
+  return check_failures ? 1 : 0;
+}
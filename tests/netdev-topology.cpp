@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+
+#include <ynl.hpp>
+
+#include "netdev-topology.hpp"
+#include "ynl-fake-kernel.hpp"
+
+/*
+ * napi_topology from hand made queue and NAPI records: queues are found
+ * by device, type and id for any id, NAPIs by id and IRQ, the rows link
+ * up, and begin() replaces the rows of one device only.
+ */
+
+using ynl_cpp::napi_topology;
+
+static void add_queue(
+    napi_topology& topo,
+    __u32 ifindex,
+    netdev_queue_type type,
+    __u32 id,
+    __u32 napi_id) {
+  ynl_cpp::netdev_queue_get_rsp q;
+
+  q.ifindex = ifindex;
+  q.type = type;
+  q.id = id;
+  if (napi_id) {
+    q.napi_id = napi_id;
+  }
+  topo.add_queue(q);
+}
+
+static void
+add_napi(napi_topology& topo, __u32 ifindex, __u32 id, __u32 irq) {
+  ynl_cpp::netdev_napi_get_rsp n;
+
+  n.ifindex = ifindex;
+  n.id = id;
+  if (irq != napi_topology::none) {
+    n.irq = irq;
+  }
+  topo.add_napi(n);
+}
+
+/* Device @ifindex with @n rx / tx queue pairs, each pair on one NAPI */
+static void add_dev(napi_topology& topo, __u32 ifindex, __u32 n) {
+  for (__u32 i = 0; i < n; i++) {
+    __u32 napi_id = ifindex * 1000 + i;
+
+    add_napi(topo, ifindex, napi_id, ifindex * 100 + i);
+    add_queue(topo, ifindex, NETDEV_QUEUE_TYPE_RX, i, napi_id);
+    add_queue(topo, ifindex, NETDEV_QUEUE_TYPE_TX, i, napi_id);
+  }
+}
+
+/* Every row is found at its own index */
+static void check_indexes(const napi_topology& topo) {
+  for (size_t i = 0; i < topo.queues.id.size(); i++) {
+    auto row = topo.find_queue(
+        topo.queues.ifindex[i], topo.queues.type[i], topo.queues.id[i]);
+
+    CHECK(row && *row == i);
+  }
+  for (size_t n = 0; n < topo.napis.id.size(); n++) {
+    auto row = topo.find_napi(topo.napis.id[n]);
+
+    CHECK(row && *row == n);
+  }
+  for (size_t d = 0; d < topo.devs.ifindex.size(); d++) {
+    auto row = topo.find_dev(topo.devs.ifindex[d]);
+
+    CHECK(row && *row == d);
+  }
+}
+
+int main() {
+  napi_topology topo;
+
+  topo.annotate = [](__u32 irq, ynl_cpp::napi_placement& where) {
+    where.cpu = irq % 8;
+  };
+
+  /* Added out of order, more rows than the initial index size */
+  add_dev(topo, 3, 100);
+  add_dev(topo, 2, 4);
+  /* Queue ids with the top bit set, rx and tx apart */
+  add_napi(topo, 4, 1u << 31, napi_topology::none);
+  add_queue(topo, 4, NETDEV_QUEUE_TYPE_RX, 1u << 31, 1u << 31);
+  add_queue(topo, 4, NETDEV_QUEUE_TYPE_TX, 1u << 31, 0);
+  add_queue(topo, 4, NETDEV_QUEUE_TYPE_TX, 0, 0);
+  topo.build();
+
+  CHECK(topo.queues.id.size() == 211);
+  CHECK(topo.napis.id.size() == 105);
+  CHECK(topo.devs.ifindex.size() == 3);
+  check_indexes(topo);
+
+  auto rx = topo.find_queue(4, NETDEV_QUEUE_TYPE_RX, 1u << 31);
+  auto tx = topo.find_queue(4, NETDEV_QUEUE_TYPE_TX, 1u << 31);
+  auto tx0 = topo.find_queue(4, NETDEV_QUEUE_TYPE_TX, 0);
+  CHECK(rx && tx && tx0 && *rx != *tx && *tx != *tx0);
+  CHECK(rx && topo.queues.napi[*rx] != napi_topology::none);
+  CHECK(tx && topo.queues.napi[*tx] == napi_topology::none);
+  CHECK(!topo.find_queue(4, NETDEV_QUEUE_TYPE_RX, 0));
+
+  /* Queue -> NAPI -> IRQ and back */
+  auto q = topo.find_queue(3, NETDEV_QUEUE_TYPE_TX, 42);
+  CHECK(q);
+  if (q) {
+    __u32 n = topo.queues.napi[*q];
+
+    CHECK(n != napi_topology::none && topo.napis.id[n] == 3042);
+    CHECK(topo.napis.irq[n] == 342);
+    CHECK(topo.napis.where[n].cpu == 342 % 8);
+    CHECK(topo.find_irq(342) && *topo.find_irq(342) == n);
+    CHECK(topo.napis.queue_off[n + 1] - topo.napis.queue_off[n] == 2);
+    for (__u32 r = topo.napis.queue_off[n]; r < topo.napis.queue_off[n + 1];
+         r++) {
+      CHECK(topo.queues.id[topo.queues.row[r]] == 42);
+    }
+  }
+  CHECK(!topo.find_irq(napi_topology::none));
+  CHECK(!topo.find_irq(12345));
+
+  /* Device ranges */
+  auto d = topo.find_dev(2);
+  CHECK(d);
+  if (d) {
+    CHECK(topo.devs.queue_end[*d] - topo.devs.queue_begin[*d] == 8);
+    CHECK(topo.devs.napi_end[*d] - topo.devs.napi_begin[*d] == 4);
+  }
+
+  /* Device 3 re-dumped with fewer queues, the others are kept */
+  topo.begin(3);
+  add_dev(topo, 3, 2);
+  topo.build();
+  CHECK(topo.queues.id.size() == 8 + 4 + 3);
+  CHECK(topo.napis.id.size() == 4 + 2 + 1);
+  CHECK(topo.find_queue(3, NETDEV_QUEUE_TYPE_RX, 1));
+  CHECK(!topo.find_queue(3, NETDEV_QUEUE_TYPE_RX, 2));
+  CHECK(!topo.find_napi(3042) && !topo.find_irq(342));
+  CHECK(topo.find_queue(2, NETDEV_QUEUE_TYPE_TX, 3));
+  check_indexes(topo);
+
+  /* Device 4 gone */
+  topo.begin(4);
+  topo.build();
+  CHECK(!topo.find_dev(4));
+  CHECK(!topo.find_queue(4, NETDEV_QUEUE_TYPE_RX, 1u << 31));
+  CHECK(topo.devs.ifindex.size() == 2);
+  check_indexes(topo);
+
+  return check_failures ? 1 : 0;
+}
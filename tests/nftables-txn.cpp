@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <arpa/inet.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <ynl.hpp>
+
+#include "nftables-txn.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/netfilter.h>
+#include <linux/netfilter/nfnetlink.h>
+
+/*
+ * nft_transaction against a fake kernel: failures index the messages of
+ * the transaction, extack offsets are mapped back to the element they
+ * point into, counting across add_setelems() calls, errors of the batch
+ * framing fail the whole commit, and a retried commit is framed once.
+ */
+
+/* 192.168.x.y, bytes which no attribute header of the message has */
+static __be32 elem_addr(size_t k) {
+  return htonl(0xc0a80000 | k);
+}
+
+static std::vector<ynl_cpp::nftables_setelem_attrs>
+make_elems(size_t n, size_t first) {
+  std::vector<ynl_cpp::nftables_setelem_attrs> elems(n);
+
+  for (size_t i = 0; i < n; i++) {
+    __be32 addr = elem_addr(first + i);
+
+    elems[i].key.emplace();
+    elems[i].key->value.assign((__u8*)&addr, (__u8*)&addr + sizeof(addr));
+  }
+  return elems;
+}
+
+/* Message of the batch holding element @k, and the offset of its key */
+static bool find_elem(
+    ynl_cpp::msg_batch& batch,
+    size_t k,
+    size_t& index,
+    __u32& offs) {
+  __be32 addr = elem_addr(k);
+
+  for (index = 1; index < batch.size(); index++) {
+    struct nlmsghdr* nlh = batch.msg(index);
+    void* at = memmem(nlh, nlh->nlmsg_len, &addr, sizeof(addr));
+
+    if (at) {
+      offs = (char*)at - (char*)nlh;
+      return true;
+    }
+  }
+  return false;
+}
+
+int main() {
+  size_t first_msgs, index[3];
+  __u32 offs[3];
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_nftables_family(), &yerr);
+  if (!ys) {
+    printf("skip: %s\n", yerr.msg);
+    return 0;
+  }
+  fake_kernel kernel(ys);
+  ynl_cpp::nft_transaction txn(ys);
+
+  /* Enough elements for several messages, then a few more */
+  auto msgs = txn.add_setelems(NFPROTO_IPV4, "t", "s", make_elems(5000, 0));
+  CHECK(msgs && *msgs > 1);
+  first_msgs = msgs ? *msgs : 0;
+  msgs = txn.add_setelems(NFPROTO_IPV4, "t", "s2", make_elems(10, 5000));
+  CHECK(msgs && *msgs == 1);
+  CHECK(txn.batch().size() == 1 + first_msgs + 1);
+
+  CHECK(find_elem(txn.batch(), 4900, index[0], offs[0]));
+  CHECK(find_elem(txn.batch(), 5003, index[1], offs[1]));
+  CHECK(find_elem(txn.batch(), 10, index[2], offs[2]));
+  CHECK(index[0] == first_msgs && index[1] == first_msgs + 1);
+  CHECK(index[2] == 1);
+
+  kernel.ack(kernel.seq(index[0]), EEXIST, offs[0]);
+  kernel.ack(kernel.seq(index[1]), EINVAL, offs[1]);
+  kernel.ack(kernel.seq(index[2]), ENOENT);
+
+  auto failures = txn.commit(0x1234);
+  CHECK(failures && failures->size() == 3);
+  if (failures && failures->size() == 3) {
+    for (size_t i = 0; i < 3; i++) {
+      CHECK((*failures)[i].index == index[i]);
+    }
+    CHECK(txn.failed_elem((*failures)[0]) == 4900);
+    CHECK(txn.failed_elem((*failures)[1]) == 5003);
+    /* No extack offset, no element */
+    CHECK(txn.failed_elem((*failures)[2]) == SIZE_MAX);
+  }
+
+  /* One send() holding the framed transaction, with the genid patched */
+  auto sent = kernel.sent();
+  /* batch-end is only added for the send */
+  CHECK(sent.size() == txn.batch().size() + 1);
+  if (sent.size() == txn.batch().size() + 1) {
+    const struct nlmsghdr* begin = (const struct nlmsghdr*)sent[0].data();
+    const struct nlmsghdr* end = (const struct nlmsghdr*)sent.back().data();
+    const struct nlattr* attr;
+    __be32 genid = 0;
+
+    CHECK(begin->nlmsg_type == NFNL_MSG_BATCH_BEGIN);
+    CHECK(end->nlmsg_type == NFNL_MSG_BATCH_END);
+    ynl_attr_for_each(attr, begin, sizeof(struct nfgenmsg)) {
+      if (ynl_attr_type(attr) == ynl_cpp::NFTABLES_A_BATCH_ATTRS_GENID) {
+        genid = ynl_attr_get_u32(attr);
+      }
+    }
+    CHECK(genid == htonl(0x1234));
+  }
+
+  /* A framing error, e.g. a changed genid, fails the commit */
+  txn.clear();
+  txn.add_setelems(NFPROTO_IPV4, "t", "s", make_elems(1, 0));
+  kernel.ack(kernel.seq(0), ERESTART);
+
+  failures = txn.commit(0x1234);
+  CHECK(!failures);
+  CHECK(!failures && failures.error().sys_errno() == ERESTART);
+  kernel.sent();
+
+  /* Retried with the new genid, framed once again */
+  failures = txn.commit(0x1235);
+  CHECK(failures && failures->empty());
+  sent = kernel.sent();
+  CHECK(sent.size() == 3);
+  if (sent.size() == 3) {
+    const struct nlmsghdr* end = (const struct nlmsghdr*)sent[2].data();
+
+    CHECK(end->nlmsg_type == NFNL_MSG_BATCH_END);
+  }
+  CHECK(txn.batch().size() == 2);
+
+  return check_failures ? 1 : 0;
+}
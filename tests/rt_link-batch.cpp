@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <errno.h>
+#include <stdio.h>
+
+#include <ynl.hpp>
+
+#include "rt_link-user.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/rtnetlink.h>
+
+#include <map>
+
+/*
+ * msg_batch against a fake kernel: answers are matched to the messages
+ * they belong to by sequence number, answers to earlier batches are
+ * ignored, missing ACKs or replies fail the call, and no send() gets more
+ * answers than the receive buffer holds.
+ */
+
+static void add_getlinks(ynl_cpp::msg_batch& batch, int n) {
+  for (int i = 0; i < n; i++) {
+    struct nlmsghdr* nlh = batch.msg_start(RTM_GETLINK, 0);
+    struct ifinfomsg* ifi;
+
+    ifi = (struct ifinfomsg*)ynl_nlmsg_put_extra_header(nlh, sizeof(*ifi));
+    ifi->ifi_index = 100 + i;
+    batch.msg_end(nlh, nullptr, sizeof(*ifi));
+  }
+}
+
+int main() {
+  ynl_error yerr;
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_rt_link_family(), &yerr);
+  if (!ys) {
+    printf("skip: %s\n", yerr.msg);
+    return 0;
+  }
+  fake_kernel kernel(ys);
+
+  /* Only failing messages are answered, in any order */
+  {
+    ynl_cpp::msg_batch batch(ys);
+
+    add_getlinks(batch, 10);
+    kernel.ack(kernel.seq(7), ENODEV);
+    kernel.ack(kernel.seq(0) - 1, EINVAL); /* an earlier batch's */
+    kernel.ack(kernel.seq(3), EINVAL);
+
+    auto failures = batch.send();
+    CHECK(failures);
+    CHECK(failures && failures->size() == 2);
+    if (failures && failures->size() == 2) {
+      CHECK((*failures)[0].index == 7);
+      CHECK((*failures)[0].err.sys_errno() == ENODEV);
+      CHECK((*failures)[1].index == 3);
+      CHECK((*failures)[1].err.sys_errno() == EINVAL);
+    }
+
+    auto sent = kernel.sent();
+    CHECK(sent.size() == 10);
+    for (size_t i = 0; i < sent.size(); i++) {
+      const struct nlmsghdr* nlh = (const struct nlmsghdr*)sent[i].data();
+
+      CHECK(nlh->nlmsg_seq == kernel.seq(0) - 10 + i);
+      CHECK(!(nlh->nlmsg_flags & NLM_F_ACK));
+    }
+
+    /* The next batch gets new sequence numbers */
+    batch.clear();
+    add_getlinks(batch, 4);
+    kernel.ack(kernel.seq(0) - 7, EINVAL); /* message 3 above */
+    kernel.ack(kernel.seq(1), EPERM);
+
+    failures = batch.send();
+    CHECK(failures && failures->size() == 1);
+    if (failures && failures->size() == 1) {
+      CHECK((*failures)[0].index == 1);
+      CHECK((*failures)[0].err.sys_errno() == EPERM);
+    }
+    kernel.sent();
+  }
+
+  /* With @ack every message is answered, a missing ACK fails the call */
+  {
+    ynl_cpp::msg_batch batch(ys, true);
+
+    add_getlinks(batch, 3);
+    kernel.ack(kernel.seq(0), 0);
+    kernel.ack(kernel.seq(1), EBUSY);
+    kernel.ack(kernel.seq(2), 0);
+
+    auto failures = batch.send();
+    CHECK(failures && failures->size() == 1);
+    if (failures && failures->size() == 1) {
+      CHECK((*failures)[0].index == 1);
+    }
+    CHECK(kernel.sent().size() == 3);
+
+    batch.clear();
+    add_getlinks(batch, 3);
+    kernel.ack(kernel.seq(0), 0);
+    kernel.ack(kernel.seq(2), 0);
+
+    failures = batch.send();
+    CHECK(!failures);
+    CHECK(!failures && failures.error().code() == YNL_ERROR_EXPECT_ACK);
+    kernel.sent();
+  }
+
+  /* More failures than the receive buffer holds at once, every one counts */
+  {
+    ynl_cpp::msg_batch batch(ys);
+    const size_t n = 600;
+
+    add_getlinks(batch, n);
+    kernel.answer([](const struct nlmsghdr*) { return ENODEV; });
+
+    auto failures = batch.send();
+    CHECK(failures && failures->size() == n);
+    if (failures && failures->size() == n) {
+      for (size_t i = 0; i < n; i++) {
+        CHECK((*failures)[i].index == i);
+      }
+    }
+    CHECK(kernel.dropped() == 0);
+    CHECK(kernel.sends() > 1);
+    kernel.sent();
+
+    /* Likewise for the ACKs of an @ack batch */
+    ynl_cpp::msg_batch acked(ys, true);
+
+    add_getlinks(acked, n);
+    kernel.answer([](const struct nlmsghdr* nlh) {
+      const struct ifinfomsg* ifi =
+          (const struct ifinfomsg*)ynl_nlmsg_data(nlh);
+
+      return ifi->ifi_index == 100 + 450 ? EPERM : 0;
+    });
+
+    failures = acked.send();
+    CHECK(failures && failures->size() == 1);
+    if (failures && failures->size() == 1) {
+      CHECK((*failures)[0].index == 450);
+    }
+    CHECK(kernel.dropped() == 0);
+    kernel.answer(nullptr);
+    kernel.sent();
+  }
+
+  /* Replies are handed over with the index of their request */
+  {
+    ynl_cpp::msg_batch batch(ys);
+    std::map<size_t, int> replies;
+    auto reply = [&](size_t index, const struct nlmsghdr* nlh) {
+      const struct ifinfomsg* ifi =
+          (const struct ifinfomsg*)ynl_nlmsg_data(nlh);
+
+      replies[index] = ifi->ifi_index;
+      return true;
+    };
+
+    add_getlinks(batch, 4);
+    for (int i : {3, 0, 2}) {
+      struct ifinfomsg ifi = {};
+
+      ifi.ifi_index = 100 + i;
+      kernel.reply(kernel.seq(i), RTM_NEWLINK, &ifi, sizeof(ifi));
+    }
+    kernel.ack(kernel.seq(1), ENODEV);
+
+    auto failures = batch.send_recv(reply);
+    CHECK(failures && failures->size() == 1);
+    if (failures && failures->size() == 1) {
+      CHECK((*failures)[0].index == 1);
+    }
+    CHECK(replies.size() == 3);
+    for (const auto& [index, ifindex] : replies) {
+      CHECK(ifindex == 100 + (int)index);
+    }
+    kernel.sent();
+
+    /* A message neither answered nor failed */
+    batch.clear();
+    add_getlinks(batch, 2);
+    {
+      struct ifinfomsg ifi = {};
+
+      kernel.reply(kernel.seq(1), RTM_NEWLINK, &ifi, sizeof(ifi));
+    }
+
+    failures = batch.send_recv(reply);
+    CHECK(!failures);
+    CHECK(!failures && failures.error().code() == YNL_ERROR_INV_RESP);
+    kernel.sent();
+  }
+
+  return check_failures ? 1 : 0;
+}
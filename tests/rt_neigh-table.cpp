@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+
+#include <atomic>
+#include <thread>
+
+#include <ynl.hpp>
+
+#include "rt_neigh-table.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/neighbour.h>
+#include <sys/socket.h>
+
+/*
+ * neigh_table fed with neighbours directly: churn through far more
+ * neighbours than the table has slots while readers look up the ones
+ * which stay, the tombstones are dropped in place rather than piling up
+ * retired tables, and no reader ever misses a neighbour.
+ */
+
+using ynl_cpp::neigh_entry;
+using ynl_cpp::rt_neigh_getneigh_rsp;
+
+static rt_neigh_getneigh_rsp neigh(__u32 ifindex, __u32 addr) {
+  rt_neigh_getneigh_rsp rsp;
+
+  rsp._hdr.family = AF_INET;
+  rsp._hdr.ifindex = ifindex;
+  rsp._hdr.state = NUD_REACHABLE;
+  rsp.dst.assign((__u8*)&addr, (__u8*)&addr + sizeof(addr));
+  rsp.lladdr = {0x02, 0, 0, 0, 0, 1};
+  return rsp;
+}
+
+int main() {
+  const __u32 pinned = 16, window = 100, churn = 200000;
+  std::atomic<size_t> misses{0}, scans{0};
+  std::atomic<bool> done{false};
+  ynl_cpp::neigh_table tbl;
+  size_t empty = tbl.footprint();
+
+  for (__u32 i = 0; i < pinned; i++) {
+    tbl.apply(neigh(1, i), false);
+  }
+
+  std::thread reader([&]() {
+    while (!done.load()) {
+      size_t seen = 0;
+
+      for (__u32 i = 0; i < pinned; i++) {
+        if (!tbl.lookup(1, AF_INET, &i)) {
+          misses++;
+        }
+      }
+      tbl.for_each([&](const neigh_entry& e) { seen += e.ifindex == 1; });
+      if (seen != pinned) {
+        misses++;
+      }
+      scans++;
+    }
+  });
+
+  /* A window of neighbours coming and going on device 2 */
+  for (__u32 i = 0; i < churn; i++) {
+    tbl.apply(neigh(2, i), false);
+    if (i >= window) {
+      tbl.apply(neigh(2, i - window), true);
+    }
+  }
+  done = true;
+  reader.join();
+
+  CHECK(misses == 0);
+  CHECK(scans > 0);
+  CHECK(tbl.size() == pinned + window);
+  CHECK(tbl.footprint() == empty);
+  __u32 addr = churn - 1;
+  CHECK(tbl.lookup(2, AF_INET, &addr));
+  addr = churn - window - 1;
+  CHECK(!tbl.lookup(2, AF_INET, &addr));
+
+  /* Tombstones from before the last rehash are gone */
+  CHECK(!tbl.changes_since(0, [](const neigh_entry&) {}));
+  auto gen = tbl.generation();
+  tbl.apply(neigh(2, churn - 1), true);
+  size_t changes = 0;
+  auto next = tbl.changes_since(gen, [&](const neigh_entry& e) {
+    CHECK(e.deleted && e.ifindex == 2);
+    changes++;
+  });
+  CHECK(next && *next == tbl.generation() && changes == 1);
+
+  /*
+   * Growing retires the outgrown tables, which add up to less than the
+   * current one. Once sized for the neighbours, churn retires no more.
+   */
+  for (__u32 i = 0; i < 4000; i++) {
+    tbl.apply(neigh(3, i), false);
+  }
+  size_t grown = 0;
+  for (int round = 0; round < 2; round++) {
+    for (__u32 i = 0; i < churn; i++) {
+      tbl.apply(neigh(4, i), false);
+      tbl.apply(neigh(4, i), true);
+    }
+    CHECK(!round || tbl.footprint() == grown);
+    grown = tbl.footprint();
+  }
+  /* Some 4100 neighbours fit in 32768 slots, 32 times the initial ones */
+  CHECK(grown > empty && grown < 2 * 32 * empty);
+  size_t live = 0;
+  tbl.for_each([&](const neigh_entry&) { live++; });
+  CHECK(live == tbl.size());
+  CHECK(tbl.size() == pinned + window - 1 + 4000);
+
+  return check_failures ? 1 : 0;
+}
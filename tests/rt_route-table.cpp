@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <arpa/inet.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <ynl.hpp>
+
+#include "rt_route-table.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/rtnetlink.h>
+
+/*
+ * route_table on replayed getroute dumps: the request, single and multi
+ * path routes with their metrics in the columns and pools, and a
+ * malformed route leaving the columns consistent.
+ */
+
+using ynl_cpp::route_table;
+
+struct nexthop {
+  const char* gateway;
+  __u32 oif;
+  __u8 hops;
+};
+
+/* RTM_NEWROUTE body, IPv4 unless @af says otherwise */
+struct route {
+  __u8 af{AF_INET};
+  const char* dst{nullptr};
+  __u8 dst_len{0};
+  const char* gateway{nullptr};
+  __u32 oif{0};
+  __u32 priority{0};
+  __u32 table{RT_TABLE_MAIN};
+  std::vector<nexthop> nexthops;
+  __u32 mtu{0};
+  /* a last RTA_DST longer than any address */
+  bool bad_dst{false};
+};
+
+static void put_addr(struct nlmsghdr* nlh, __u16 type, __u8 af, const char* a) {
+  __u8 buf[16];
+
+  inet_pton(af, a, buf);
+  ynl_attr_put(nlh, type, buf, af == AF_INET ? 4 : 16);
+}
+
+static std::vector<__u8> route_body(const route& r) {
+  alignas(NLMSG_ALIGNTO) __u8 buf[1024] = {};
+  struct nlmsghdr* nlh = (struct nlmsghdr*)buf;
+  struct rtmsg* rtm;
+
+  nlh->nlmsg_len = NLMSG_HDRLEN;
+  nlh->nlmsg_pid = sizeof(buf);
+  rtm = (struct rtmsg*)ynl_nlmsg_put_extra_header(nlh, sizeof(*rtm));
+  rtm->rtm_family = r.af;
+  rtm->rtm_dst_len = r.dst_len;
+  rtm->rtm_protocol = RTPROT_STATIC;
+  rtm->rtm_scope = RT_SCOPE_UNIVERSE;
+  rtm->rtm_type = RTN_UNICAST;
+  rtm->rtm_table = r.table < 256 ? r.table : RT_TABLE_COMPAT;
+  ynl_attr_put_u32(nlh, RTA_TABLE, r.table);
+  if (r.dst) {
+    put_addr(nlh, RTA_DST, r.af, r.dst);
+  }
+  if (r.gateway) {
+    put_addr(nlh, RTA_GATEWAY, r.af, r.gateway);
+  }
+  if (r.oif) {
+    ynl_attr_put_u32(nlh, RTA_OIF, r.oif);
+  }
+  if (r.priority) {
+    ynl_attr_put_u32(nlh, RTA_PRIORITY, r.priority);
+  }
+  if (!r.nexthops.empty()) {
+    __u8 mp[256] = {};
+    size_t len = 0;
+
+    for (const auto& nh : r.nexthops) {
+      struct rtnexthop* rtnh = (struct rtnexthop*)(mp + len);
+      struct rtattr* rta = (struct rtattr*)RTNH_DATA(rtnh);
+
+      rtnh->rtnh_len = RTNH_LENGTH(RTA_LENGTH(4));
+      rtnh->rtnh_hops = nh.hops;
+      rtnh->rtnh_ifindex = nh.oif;
+      rta->rta_type = RTA_GATEWAY;
+      rta->rta_len = RTA_LENGTH(4);
+      inet_pton(AF_INET, nh.gateway, RTA_DATA(rta));
+      len += RTNH_ALIGN(rtnh->rtnh_len);
+    }
+    ynl_attr_put(nlh, RTA_MULTIPATH, mp, len);
+  }
+  if (r.mtu) {
+    struct nlattr* metrics = ynl_attr_nest_start(nlh, RTA_METRICS);
+
+    ynl_attr_put_u32(nlh, RTAX_MTU, r.mtu);
+    ynl_attr_put_str(nlh, RTAX_CC_ALGO, "bbr");
+    ynl_attr_nest_end(nlh, metrics);
+  }
+  /* Last, after the pools were filled */
+  if (r.bad_dst) {
+    __u8 addr[20] = {};
+
+    ynl_attr_put(nlh, RTA_DST, addr, sizeof(addr));
+  }
+
+  return {buf + NLMSG_HDRLEN, buf + nlh->nlmsg_len};
+}
+
+static bool addr_is(const ynl_cpp::route_addr& addr, __u8 af, const char* a) {
+  ynl_cpp::route_addr want = {};
+
+  inet_pton(af, a, want.bytes);
+  return !memcmp(&addr, &want, sizeof(want));
+}
+
+/* Every column holds one entry per route */
+static bool consistent(const route_table& t) {
+  size_t n = t.size();
+
+  return t.dst_len.size() == n && t.protocol.size() == n &&
+      t.scope.size() == n && t.type.size() == n && t.table.size() == n &&
+      t.dst.size() == n && t.gateway.size() == n && t.oif.size() == n &&
+      t.priority.size() == n && t.nh_off.size() == n + 1 &&
+      t.metric_off.size() == n + 1 && t.nh_off.back() == t.nh_pool.size() &&
+      t.metric_off.back() == t.metric_pool.size();
+}
+
+int main() {
+  route_table routes;
+  ynl_error yerr;
+
+  ynl_cpp::ynl_socket ys(ynl_cpp::get_ynl_rt_route_family(), &yerr);
+  if (!ys) {
+    printf("skip: %s\n", yerr.msg);
+    return 0;
+  }
+  fake_kernel kernel(ys);
+
+  route single;
+  single.dst = "10.0.0.0";
+  single.dst_len = 8;
+  single.gateway = "192.168.1.1";
+  single.oif = 2;
+  single.priority = 100;
+
+  route multi;
+  multi.nexthops = {{"192.168.1.1", 2, 0}, {"192.168.2.1", 3, 2}};
+  multi.mtu = 1400;
+
+  route v6;
+  v6.af = AF_INET6;
+  v6.dst = "2001:db8::";
+  v6.dst_len = 32;
+  v6.gateway = "fe80::1";
+  v6.oif = 4;
+  v6.table = 1000;
+
+  routes.reserve(16, 2);
+  kernel.dump(
+      kernel.seq(0),
+      RTM_NEWROUTE,
+      {route_body(single), route_body(multi), route_body(v6)});
+  CHECK(routes.dump(ys, AF_INET6));
+
+  auto sent = kernel.sent();
+  CHECK(sent.size() == 1);
+  if (sent.size() == 1) {
+    const struct nlmsghdr* nlh = (const struct nlmsghdr*)sent[0].data();
+    const struct rtmsg* rtm = (const struct rtmsg*)NLMSG_DATA(nlh);
+
+    CHECK(nlh->nlmsg_type == RTM_GETROUTE);
+    CHECK(nlh->nlmsg_flags & NLM_F_DUMP);
+    CHECK(nlh->nlmsg_len == NLMSG_LENGTH(sizeof(*rtm)));
+    CHECK(rtm->rtm_family == AF_INET6);
+  }
+
+  CHECK(routes.size() == 3 && consistent(routes));
+  if (routes.size() != 3) {
+    return 1;
+  }
+  CHECK(addr_is(routes.dst[0], AF_INET, "10.0.0.0"));
+  CHECK(addr_is(routes.gateway[0], AF_INET, "192.168.1.1"));
+  CHECK(routes.dst_len[0] == 8 && routes.oif[0] == 2);
+  CHECK(routes.priority[0] == 100 && routes.table[0] == RT_TABLE_MAIN);
+  CHECK(routes.protocol[0] == RTPROT_STATIC);
+  CHECK(routes.nexthops(0).empty() && routes.metrics(0).empty());
+
+  auto nhs = routes.nexthops(1);
+  CHECK(nhs.size() == 2 && routes.oif[1] == 0);
+  if (nhs.size() == 2) {
+    CHECK(addr_is(nhs[0].gateway, AF_INET, "192.168.1.1"));
+    CHECK(nhs[0].oif == 2 && nhs[0].weight == 1);
+    CHECK(addr_is(nhs[1].gateway, AF_INET, "192.168.2.1"));
+    CHECK(nhs[1].oif == 3 && nhs[1].weight == 3);
+  }
+  /* The congestion control name is not a u32, skipped */
+  auto metrics = routes.metrics(1);
+  CHECK(metrics.size() == 1);
+  if (metrics.size() == 1) {
+    CHECK(metrics[0].type == RTAX_MTU && metrics[0].value == 1400);
+  }
+
+  CHECK(routes.family[2] == AF_INET6 && routes.table[2] == 1000);
+  CHECK(addr_is(routes.dst[2], AF_INET6, "2001:db8::"));
+  CHECK(addr_is(routes.gateway[2], AF_INET6, "fe80::1"));
+
+  /* A re-dump replaces the routes */
+  kernel.dump(kernel.seq(0), RTM_NEWROUTE, {route_body(v6)});
+  CHECK(routes.dump(ys));
+  CHECK(routes.size() == 1 && routes.family[0] == AF_INET6);
+  CHECK(consistent(routes) && routes.nh_pool.empty());
+  kernel.sent();
+
+  /* A malformed route fails the dump, the routes before it stay whole */
+  route bad = multi;
+  bad.bad_dst = true;
+  kernel.dump(
+      kernel.seq(0),
+      RTM_NEWROUTE,
+      {route_body(multi), route_body(bad), route_body(single)});
+  CHECK(!routes.dump(ys));
+  CHECK(routes.size() == 1 && consistent(routes));
+  CHECK(routes.nexthops(0).size() == 2 && routes.metrics(0).size() == 1);
+  kernel.sent();
+
+  return check_failures ? 1 : 0;
+}
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <stdio.h>
+
+#include <ynl.hpp>
+
+#include "tc-stats.hpp"
+#include "ynl-fake-kernel.hpp"
+
+#include <linux/gen_stats.h>
+#include <linux/pkt_sched.h>
+#include <linux/rtnetlink.h>
+
+/*
+ * tc_stats_table on hand made messages: objects are told apart by type,
+ * device, handle and parent, as the per queue children of mq all have
+ * handle 0:, a re-dumped object overwrites its row and begin() drops the
+ * rows of a device.
+ */
+
+static std::vector<__u8> tc_msg(
+    __u16 type,
+    __u32 ifindex,
+    __u32 handle,
+    __u32 parent,
+    const char* kind,
+    __u64 bytes) {
+  std::vector<__u8> buf(256);
+  struct nlmsghdr* nlh = ynl_nlmsg_put_header(buf.data());
+  struct gnet_stats_basic basic = {};
+  struct tcmsg* tcm;
+  struct nlattr* nest;
+
+  nlh->nlmsg_type = type;
+  nlh->nlmsg_pid = buf.size();
+  tcm = (struct tcmsg*)ynl_nlmsg_put_extra_header(nlh, sizeof(*tcm));
+  tcm->tcm_ifindex = ifindex;
+  tcm->tcm_handle = handle;
+  tcm->tcm_parent = parent;
+  ynl_attr_put_str(nlh, TCA_KIND, kind);
+  nest = ynl_attr_nest_start(nlh, TCA_STATS2);
+  basic.bytes = bytes;
+  basic.packets = bytes / 100;
+  ynl_attr_put(nlh, TCA_STATS_BASIC, &basic, sizeof(basic));
+  ynl_attr_nest_end(nlh, nest);
+
+  buf.resize(nlh->nlmsg_len);
+  return buf;
+}
+
+static bool
+add(ynl_cpp::tc_stats_table& table, const std::vector<__u8>& msg) {
+  return table.add((const struct nlmsghdr*)msg.data());
+}
+
+/* Bytes of the object, 0 if it isn't found */
+static __u64 find_bytes(
+    const ynl_cpp::tc_stats_table& table,
+    __u16 type,
+    __u32 ifindex,
+    __u32 handle,
+    __u32 parent) {
+  auto row = table.find(type, ifindex, handle, parent);
+
+  return row ? table.bytes[*row] : 0;
+}
+
+int main() {
+  const __u32 mq = 0x10000; /* 1: */
+  ynl_cpp::tc_stats_table table;
+
+  /* mq 1: and its per queue children on two devices, and a class */
+  for (__u32 ifindex : {2, 3}) {
+    __u64 base = ifindex * 100000;
+
+    CHECK(add(table, tc_msg(RTM_NEWQDISC, ifindex, mq, TC_H_ROOT, "mq", base)));
+    for (__u32 q = 1; q <= 4; q++) {
+      auto msg = tc_msg(RTM_NEWQDISC, ifindex, 0, mq + q, "pfifo", base + q);
+
+      CHECK(add(table, msg));
+    }
+  }
+  CHECK(add(table, tc_msg(RTM_NEWTCLASS, 2, mq, TC_H_ROOT, "mq", 7)));
+  CHECK(table.size() == 11);
+
+  for (__u32 ifindex : {2, 3}) {
+    __u64 base = ifindex * 100000;
+
+    CHECK(find_bytes(table, RTM_NEWQDISC, ifindex, mq, TC_H_ROOT) == base);
+    for (__u32 q = 1; q <= 4; q++) {
+      CHECK(find_bytes(table, RTM_NEWQDISC, ifindex, 0, mq + q) == base + q);
+    }
+  }
+  CHECK(find_bytes(table, RTM_NEWTCLASS, 2, mq, TC_H_ROOT) == 7);
+  CHECK(!table.find(RTM_NEWQDISC, 2, 0, mq + 5));
+  CHECK(!table.find(RTM_NEWTCLASS, 3, mq, TC_H_ROOT));
+  CHECK(table.kinds.size() == 3);
+
+  /* Dumped again, the row is overwritten */
+  CHECK(add(table, tc_msg(RTM_NEWQDISC, 2, 0, mq + 2, "pfifo", 9)));
+  CHECK(table.size() == 11);
+  CHECK(find_bytes(table, RTM_NEWQDISC, 2, 0, mq + 2) == 9);
+
+  /* A device re-dumped with fewer queues, its other rows are gone */
+  table.begin(3);
+  CHECK(table.size() == 6);
+  CHECK(add(table, tc_msg(RTM_NEWQDISC, 3, mq, TC_H_ROOT, "mq", 1)));
+  CHECK(add(table, tc_msg(RTM_NEWQDISC, 3, 0, mq + 1, "pfifo", 2)));
+  CHECK(table.size() == 8);
+  CHECK(find_bytes(table, RTM_NEWQDISC, 3, 0, mq + 1) == 2);
+  CHECK(!table.find(RTM_NEWQDISC, 3, 0, mq + 2));
+  CHECK(find_bytes(table, RTM_NEWQDISC, 2, 0, mq + 4) == 200004);
+  CHECK(find_bytes(table, RTM_NEWTCLASS, 2, mq, TC_H_ROOT) == 7);
+  for (size_t i = 0; i < table.size(); i++) {
+    auto row = table.find(
+        table.msg_type[i],
+        table.ifindex[i],
+        table.handle[i],
+        table.parent[i]);
+
+    CHECK(row && *row == i);
+  }
+
+  /* Truncated tcmsg */
+  {
+    auto msg = tc_msg(RTM_NEWQDISC, 2, 0, mq + 1, "pfifo", 1);
+    struct nlmsghdr* nlh = (struct nlmsghdr*)msg.data();
+
+    nlh->nlmsg_len = NLMSG_HDRLEN + sizeof(struct tcmsg) - 1;
+    CHECK(!add(table, msg));
+    CHECK(table.size() == 8);
+  }
+
+  /* Past the initial index size, and after clear() */
+  for (int round = 0; round < 2; round++) {
+    table.clear();
+    CHECK(!table.find(RTM_NEWQDISC, 2, 0, mq + 1));
+    for (__u32 q = 1; q <= 3000; q++) {
+      add(table, tc_msg(RTM_NEWQDISC, 4, 0, mq + q, "fq", q));
+    }
+    CHECK(table.size() == 3000);
+    for (__u32 q = 1; q <= 3000; q++) {
+      CHECK(find_bytes(table, RTM_NEWQDISC, 4, 0, mq + q) == q);
+    }
+  }
+
+  return check_failures ? 1 : 0;
+}
@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __YNL_CPP_TESTS_FAKE_KERNEL_H
+#define __YNL_CPP_TESTS_FAKE_KERNEL_H 1
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <functional>
+#include <vector>
+
+#include <ynl.hpp>
+
+#include <linux/netlink.h>
+
+/* Checks count their failures, a test exits with 1 if any failed */
+inline int check_failures;
+
+#define CHECK(cond)                                                          \
+  do {                                                                       \
+    if (!(cond)) {                                                           \
+      fprintf(stderr, "%s:%d: failed: %s\n", __FILE__, __LINE__, #cond);     \
+      check_failures++;                                                      \
+    }                                                                        \
+  } while (0)
+
+/* Tests link with --wrap=send, so fake_kernel sees each send() */
+extern "C" ssize_t __real_send(int fd, const void* buf, size_t len, int flags);
+extern "C" ssize_t __wrap_send(int fd, const void* buf, size_t len, int flags);
+
+/**
+ * class fake_kernel - stand-in for the kernel end of a ynl_socket
+ *
+ * Moves the socket onto one end of a socketpair, the other end plays the
+ * kernel: what the library sends is read back with sent(), the answers
+ * queued with ack() and reply() are what it receives. Batches collect the
+ * answers without blocking right after send(), which the kernel has
+ * queued by then, so answers are queued before the call under test.
+ *
+ * Batches spanning several send() calls are answered with answer(), from
+ * within each send() like the kernel does. Like the kernel it drops the
+ * answers which don't fit in the receive buffer, about 1 KiB each.
+ */
+class fake_kernel {
+ public:
+  explicit fake_kernel(struct ynl_sock* ys) : ys_(ys) {
+    int fds[2];
+
+    if (socketpair(AF_UNIX, SOCK_DGRAM, 0, fds) < 0) {
+      perror("socketpair");
+      _exit(1);
+    }
+    dup2(fds[0], ys_->socket);
+    close(fds[0]);
+    peer_ = fds[1];
+    current_ = this;
+  }
+
+  ~fake_kernel() {
+    current_ = nullptr;
+    close(peer_);
+  }
+
+  /*
+   * Answer messages as they are sent, @fn returns the error to fail one
+   * with, or 0 to ACK it if it asks for an ACK. An empty @fn stops.
+   */
+  void answer(std::function<int(const struct nlmsghdr*)> fn) {
+    answer_ = std::move(fn);
+  }
+
+  /* send() calls since the last sent() */
+  size_t sends() const {
+    return sends_;
+  }
+
+  /* Answers which didn't fit in the receive buffer */
+  size_t dropped() const {
+    return dropped_;
+  }
+
+  /* Sequence number of message @i of the next batch */
+  __u32 seq(size_t i) const {
+    return ys_->seq + 1 + i;
+  }
+
+  /* Fail the message with @seq with @err, extack pointing at @attr_offs */
+  void ack(__u32 seq, int err, __u32 attr_offs = 0) {
+    struct {
+      struct nlmsghdr nlh;
+      struct nlmsgerr err;
+      struct nlattr attr;
+      __u32 offs;
+    } msg = {};
+    size_t len = sizeof(msg);
+
+    msg.nlh.nlmsg_type = NLMSG_ERROR;
+    msg.nlh.nlmsg_flags = NLM_F_CAPPED;
+    msg.nlh.nlmsg_seq = seq;
+    msg.err.error = -err;
+    msg.err.msg.nlmsg_seq = seq;
+    if (attr_offs) {
+      msg.nlh.nlmsg_flags |= NLM_F_ACK_TLVS;
+      msg.attr.nla_type = NLMSGERR_ATTR_OFFS;
+      msg.attr.nla_len = sizeof(msg.attr) + sizeof(msg.offs);
+      msg.offs = attr_offs;
+    } else {
+      len -= sizeof(msg.attr) + sizeof(msg.offs);
+    }
+    msg.nlh.nlmsg_len = len;
+    queue(&msg, len);
+  }
+
+  /* Answer the message with @seq with a @type message carrying @data */
+  void reply(__u32 seq, __u16 type, const void* data, size_t len) {
+    std::vector<__u8> msg(NLMSG_SPACE(len));
+    struct nlmsghdr* nlh = (struct nlmsghdr*)msg.data();
+
+    nlh->nlmsg_len = NLMSG_LENGTH(len);
+    nlh->nlmsg_type = type;
+    nlh->nlmsg_seq = seq;
+    memcpy(NLMSG_DATA(nlh), data, len);
+    queue(msg.data(), msg.size());
+  }
+
+  /* Answer the dump with @seq with a @type message per body, then done */
+  void dump(
+      __u32 seq,
+      __u16 type,
+      const std::vector<std::vector<__u8>>& bodies) {
+    std::vector<__u8> buf;
+    int done = 0;
+    auto put = [&](__u16 msg_type, const void* data, size_t len) {
+      size_t off = buf.size();
+      struct nlmsghdr* nlh;
+
+      buf.resize(off + NLMSG_SPACE(len));
+      nlh = (struct nlmsghdr*)&buf[off];
+      nlh->nlmsg_len = NLMSG_LENGTH(len);
+      nlh->nlmsg_type = msg_type;
+      nlh->nlmsg_flags = NLM_F_MULTI;
+      nlh->nlmsg_seq = seq;
+      memcpy(NLMSG_DATA(nlh), data, len);
+    };
+
+    for (const auto& body : bodies) {
+      put(type, body.data(), body.size());
+    }
+    put(NLMSG_DONE, &done, sizeof(done));
+    queue(buf.data(), buf.size());
+  }
+
+  /* Messages sent since the last call, one per element */
+  std::vector<std::vector<__u8>> sent() {
+    std::vector<std::vector<__u8>> msgs;
+    std::vector<__u8> buf(1 << 20);
+    ssize_t len;
+
+    while ((len = recv(peer_, buf.data(), buf.size(), MSG_DONTWAIT)) > 0) {
+      const struct nlmsghdr* nlh = (const struct nlmsghdr*)buf.data();
+      int rem = len;
+
+      for (; NLMSG_OK(nlh, rem); nlh = NLMSG_NEXT(nlh, rem)) {
+        const __u8* data = (const __u8*)nlh;
+
+        msgs.emplace_back(data, data + nlh->nlmsg_len);
+      }
+    }
+    sends_ = 0;
+    return msgs;
+  }
+
+  /* Called for every send() of the process */
+  static void on_send(int fd, const void* buf, size_t len) {
+    fake_kernel* k = current_;
+
+    if (!k || fd != k->ys_->socket) {
+      return;
+    }
+    k->sends_++;
+    if (k->answer_) {
+      k->answer_sent(buf, len);
+    }
+  }
+
+ private:
+  void answer_sent(const void* buf, size_t len) {
+    const struct nlmsghdr* nlh = (const struct nlmsghdr*)buf;
+    socklen_t optlen = sizeof(int);
+    int rem = len, rcvbuf = 0;
+    size_t room;
+
+    /* The library drains its answers after each send() */
+    getsockopt(ys_->socket, SOL_SOCKET, SO_RCVBUF, &rcvbuf, &optlen);
+    room = rcvbuf / 1024;
+    for (; NLMSG_OK(nlh, rem); nlh = NLMSG_NEXT(nlh, rem)) {
+      int err;
+
+      /* Dumps are answered with dump() */
+      if ((nlh->nlmsg_flags & NLM_F_DUMP) == NLM_F_DUMP) {
+        continue;
+      }
+      err = answer_(nlh);
+
+      if (!err && !(nlh->nlmsg_flags & NLM_F_ACK)) {
+        continue;
+      }
+      if (!room) {
+        dropped_++;
+        continue;
+      }
+      room--;
+      ack(nlh->nlmsg_seq, err);
+    }
+  }
+
+  void queue(const void* msg, size_t len) {
+    /* Never block, the library only reads after its send() */
+    if (send(peer_, msg, len, MSG_DONTWAIT) != (ssize_t)len) {
+      perror("send");
+      _exit(1);
+    }
+  }
+
+  inline static fake_kernel* current_;
+
+  struct ynl_sock* ys_;
+  int peer_;
+  std::function<int(const struct nlmsghdr*)> answer_;
+  size_t sends_{0};
+  size_t dropped_{0};
+};
+
+/* Each test is a single translation unit */
+ssize_t __wrap_send(int fd, const void* buf, size_t len, int flags) {
+  ssize_t ret = __real_send(fd, buf, len, flags);
+
+  if (ret >= 0) {
+    fake_kernel::on_send(fd, buf, len);
+  }
+  return ret;
+}
+
+#endif
@@ -20,3 +20,12 @@ for hdr in $(cat Makefile.deps | sed -n 's/.*,\([^,]*\.h\))/\1/p'); do
 done
 
 cp -rv ${KSRC}/Documentation/netlink Documentation/
+
+# Local fixes and backports, until the kernel has them
+for patch in patches/*.patch; do
+    if git apply --reverse --check $patch 2>/dev/null; then
+        echo "$patch: already applied, can be dropped"
+        continue
+    fi
+    git apply -v $patch || exit 1
+done
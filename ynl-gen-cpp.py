@@ -111,6 +111,17 @@ class Type(SpecAttr):
     def is_recursive_for_op(self, ri):
         return self.is_recursive() and not ri.op
 
+    def is_fixed_size(self):
+        """Encoded size doesn't depend on the value, put can skip checks"""
+        return False
+
+    def max_put_len(self):
+        """
+        Upper bound of the encoded size of the attribute, as a list of
+        terms to be summed up (ints or C expressions), None if unbounded.
+        """
+        return None
+
     def presence_type(self):
         return "bit"
 
@@ -188,11 +199,15 @@ class Type(SpecAttr):
             ri.cw.p(f"if ({var}.{self.c_name}.size() > 0)")
         ri.cw.p(f"{line};")
 
+    def _put_sfx(self, ri):
+        return "_unchecked" if ri.put_unchecked and self.is_fixed_size() else ""
+
     def _attr_put_simple(self, ri, var, put_type):
+        fn = f"ynl_attr_put_{put_type}{self._put_sfx(ri)}"
         if self.presence_type() == "len":
-            line = f"ynl_attr_put_{put_type}(nlh, {self.enum_name}, {var}.{self.c_name}.data())"
+            line = f"{fn}(nlh, {self.enum_name}, {var}.{self.c_name}.data())"
         else:
-            line = f"ynl_attr_put_{put_type}(nlh, {self.enum_name}, {var}.{self.c_name}.value())"
+            line = f"{fn}(nlh, {self.enum_name}, {var}.{self.c_name}.value())"
         self._attr_put_line(ri, var, line)
 
     def attr_put(self, ri, var):
@@ -201,6 +216,10 @@ class Type(SpecAttr):
     def _attr_get(self, ri, var):
         raise Exception(f"Attr get not implemented for class type {self.type}")
 
+    def _attr_check(self):
+        """C condition which is true for a malformed attr, and the attr kind"""
+        raise Exception(f"Attr check not implemented for class type {self.type}")
+
     def attr_get(self, ri, var, first):
         lines, init_lines, local_vars = self._attr_get(ri, var)
         if type(lines) is str:
@@ -215,9 +234,11 @@ class Type(SpecAttr):
                 ri.cw.p(local)
             ri.cw.nl()
 
-        if not self.is_multi_val():
-            ri.cw.p("if (ynl_attr_validate(yarg, attr))")
-            ri.cw.p("return YNL_PARSE_CB_ERROR;")
+        check = None if self.is_multi_val() else self._attr_check()
+        if check:
+            cond, kind = check
+            ri.cw.p(f"if ({cond})")
+            ri.cw.p(f'return ynl_attr_invalid(yarg, attr, "{kind}");')
 
         if init_lines:
             ri.cw.nl()
@@ -281,7 +302,8 @@ class TypeScalar(Type):
         if "byte-order" in attr:
             self.byte_order_comment = f" /* {attr['byte-order']} */"
 
-        if "enum" in self.attr:
+        # Ranges only feed kernel policies, which classic families don't have
+        if "enum" in self.attr and not family.is_classic():
             enum = self.family.consts[self.attr["enum"]]
             low, high = enum.value_range()
             if "min" not in self.checks:
@@ -352,6 +374,16 @@ class TypeScalar(Type):
     def _attr_typol(self):
         return f".type = YNL_PT_U{c_upper(self.type[1:])}, "
 
+    def is_fixed_size(self):
+        return True
+
+    def max_put_len(self):
+        if self.type in {"uint", "sint"}:
+            size = 8
+        else:
+            size = int(self.type[1:]) // 8
+        return [nla_size(size)]
+
     def arg_member(self, ri):
         return [
             f"std::optional<{self.type_name}> {self.c_name}{self.byte_order_comment}"
@@ -367,6 +399,13 @@ class TypeScalar(Type):
             None,
         )
 
+    def _attr_check(self):
+        if self.type in {"uint", "sint"}:
+            cond = "ynl_attr_data_len(attr) != sizeof(__u32) && ynl_attr_data_len(attr) != sizeof(__u64)"
+        else:
+            cond = f"ynl_attr_data_len(attr) != sizeof(__{self.type})"
+        return cond, self.type
+
     def _setter_lines(self, ri, member, presence):
         return [f"{member} = {self.c_name};"]
 
@@ -384,11 +423,23 @@ class TypeFlag(Type):
     def _attr_typol(self):
         return ".type = YNL_PT_FLAG, "
 
+    def is_fixed_size(self):
+        return True
+
+    def max_put_len(self):
+        return [nla_size(0)]
+
     def attr_put(self, ri, var):
-        self._attr_put_line(ri, var, f"ynl_attr_put(nlh, {self.enum_name}, NULL, 0)")
+        self._attr_put_line(
+            ri, var, f"ynl_attr_put{self._put_sfx(ri)}(nlh, {self.enum_name}, NULL, 0)"
+        )
 
     def _attr_get(self, ri, var):
-        return [], None, None
+        return [f"{var}->{self.c_name} = true;"], None, None
+
+    def _attr_check(self):
+        # Let flags grow into real attrs, why not..
+        return None
 
     def _setter_lines(self, ri, member, presence):
         return []
@@ -426,6 +477,18 @@ class TypeString(Type):
         spec = self._attr_policy(policy)
         cw.p(f"\t[{self.enum_name}] = {spec},")
 
+    def max_put_len(self):
+        if "exact-len" in self.checks:
+            max_len = self.get_limit("exact-len")
+        elif "max-len" in self.checks:
+            max_len = self.get_limit("max-len")
+        else:
+            return None
+        # Plus the NUL terminator
+        if isinstance(max_len, int):
+            return [nla_size(max_len + 1)]
+        return [f"NLA_HDRLEN + NLA_ALIGN({max_len} + 1)"]
+
     def attr_put(self, ri, var):
         self._attr_put_simple(ri, var, "str")
 
@@ -438,6 +501,9 @@ class TypeString(Type):
             None,
         )
 
+    def _attr_check(self):
+        return "!ynl_attr_str_valid(attr)", "string"
+
     def _setter_lines(self, ri, member, presence):
         return [
             f"{member} = {self.c_name};",
@@ -473,6 +539,14 @@ class TypeBinary(Type):
             mem += ", }"
         return mem
 
+    def max_put_len(self):
+        if "exact-len" not in self.checks:
+            return None
+        exact_len = self.get_limit("exact-len")
+        if isinstance(exact_len, int):
+            return [nla_size(exact_len)]
+        return [f"NLA_HDRLEN + NLA_ALIGN({exact_len})"]
+
     def attr_put(self, ri, var):
         self._attr_put_line(
             ri,
@@ -492,6 +566,9 @@ class TypeBinary(Type):
             None,
         )
 
+    def _attr_check(self):
+        return None
+
     def _setter_lines(self, ri, member, presence):
         return [
             f"free({member});",
@@ -501,6 +578,13 @@ class TypeBinary(Type):
         ]
 
 
+class TypeRawNest(TypeBinary):
+    """Sub-messages and scalar indexed-arrays, kept as the raw nest payload"""
+
+    def _attr_check(self):
+        return NEST_CHECK, self.type
+
+
 class TypeBitfield32(Type):
     def _complex_member_type(self, ri):
         return "struct nla_bitfield32"
@@ -515,8 +599,14 @@ class TypeBitfield32(Type):
         mask = enum.get_mask(as_flags=True)
         return f"NLA_POLICY_BITFIELD32({mask})"
 
+    def is_fixed_size(self):
+        return True
+
+    def max_put_len(self):
+        return [nla_size(8)]
+
     def attr_put(self, ri, var):
-        line = f"ynl_attr_put(nlh, {self.enum_name}, &(*{var}.{self.c_name}), sizeof(struct nla_bitfield32))"
+        line = f"ynl_attr_put{self._put_sfx(ri)}(nlh, {self.enum_name}, &(*{var}.{self.c_name}), sizeof(struct nla_bitfield32))"
         self._attr_put_line(ri, var, line)
 
     def _attr_get(self, ri, var):
@@ -526,6 +616,9 @@ class TypeBitfield32(Type):
             None,
         )
 
+    def _attr_check(self):
+        return "ynl_attr_data_len(attr) != sizeof(struct nla_bitfield32)", "bitfield32"
+
     def _setter_lines(self, ri, member, presence):
         return [f"memcpy(&{member}, {self.c_name}, sizeof(struct nla_bitfield32));"]
 
@@ -540,17 +633,29 @@ class TypeNest(Type):
     def _attr_typol(self):
         return f".type = YNL_PT_NEST, .nest = &{self.nested_render_name}_nest, "
 
+    def _attr_check(self):
+        return NEST_CHECK, "nest"
+
     def _attr_policy(self, policy):
         return "NLA_POLICY_NESTED(" + self.nested_render_name + "_nl_policy)"
 
+    def max_put_len(self):
+        struct = self.family.pure_nested_structs[self.nested_attrs]
+        if struct.recursive:
+            return None
+        terms = struct_max_put_len(struct)
+        if terms is None:
+            return None
+        return [nla_size(0)] + terms
+
     def attr_put(self, ri, var):
-        # at = "" if self.is_recursive_for_op(ri) else "&"
-        at = ""
+        # Recursive nests are vectors of at most one element
+        at = "[0]" if self.is_recursive_for_op(ri) else ".value()"
         self._attr_put_line(
             ri,
             var,
             f"{self.nested_render_name}_put(nlh, "
-            + f"{self.enum_name}, {at}{var}.{self.c_name}.value())",
+            + f"{self.enum_name}, {var}.{self.c_name}{at})",
         )
 
     def _attr_get(self, ri, var):
@@ -558,10 +663,17 @@ class TypeNest(Type):
             f"if ({self.nested_render_name}_parse(&parg, attr))",
             "return YNL_PARSE_CB_ERROR;",
         ]
+        # Engage the optional, its storage is not an object until then
         init_lines = [
             f"parg.rsp_policy = &{self.nested_render_name}_nest;",
-            f"parg.data = &{var}->{self.c_name};",
+            f"parg.data = &{var}->{self.c_name}.emplace();",
         ]
+        if self.is_recursive_for_op(ri):
+            init_lines = [
+                f"parg.rsp_policy = &{self.nested_render_name}_nest;",
+                f"{var}->{self.c_name}.resize(1);",
+                f"parg.data = {var}->{self.c_name}.data();",
+            ]
         return get_lines, init_lines, None
 
 
@@ -583,6 +695,10 @@ class TypeMultiAttr(Type):
         elif self.attr["type"] in scalars:
             scalar_pfx = "__" if ri.ku_space == "user" else ""
             return scalar_pfx + self.attr["type"]
+        elif self.attr["type"] == "string":
+            return "std::string"
+        elif self.attr["type"] == "binary":
+            return "std::vector<__u8>"
         else:
             raise Exception(f"Sub-type {self.attr['type']} not supported yet")
 
@@ -610,6 +726,17 @@ class TypeMultiAttr(Type):
                 f"{self.nested_render_name}_put(nlh, "
                 + f"{self.enum_name}, {var}.{self.c_name}[i])",
             )
+        elif self.attr["type"] == "string":
+            ri.cw.p(f"for (unsigned int i = 0; i < {var}.{self.c_name}.size(); i++)")
+            ri.cw.p(
+                f"ynl_attr_put_str(nlh, {self.enum_name}, {var}.{self.c_name}[i].c_str());"
+            )
+        elif self.attr["type"] == "binary":
+            ri.cw.p(f"for (unsigned int i = 0; i < {var}.{self.c_name}.size(); i++)")
+            ri.cw.p(
+                f"ynl_attr_put(nlh, {self.enum_name}, {var}.{self.c_name}[i].data(), "
+                + f"{var}.{self.c_name}[i].size());"
+            )
         else:
             raise Exception(
                 f"Put of MultiAttr sub-type {self.attr['type']} not supported yet"
@@ -646,12 +773,15 @@ class TypeArrayNest(Type):
     def _attr_typol(self):
         return f".type = YNL_PT_NEST, .nest = &{self.nested_render_name}_nest, "
 
+    def _attr_check(self):
+        return NEST_CHECK, "nest"
+
     def _attr_get(self, ri, var):
         local_vars = ["const struct nlattr *attr2;"]
         get_lines = [
             f"attr_{self.c_name} = attr;",
             "ynl_attr_for_each_nested(attr2, attr)",
-            f"\t{var}->n_{self.c_name}++;",
+            f"\tn_{self.c_name}++;",
         ]
         return get_lines, None, local_vars
 
@@ -663,14 +793,18 @@ class TypeNestTypeValue(Type):
     def _attr_typol(self):
         return f".type = YNL_PT_NEST, .nest = &{self.nested_render_name}_nest, "
 
+    def _attr_check(self):
+        return NEST_CHECK, "nest"
+
     def _attr_get(self, ri, var):
         prev = "attr"
         tv_args = ""
         get_lines = []
         local_vars = []
+        # Engage the optional, its storage is not an object until then
         init_lines = [
             f"parg.rsp_policy = &{self.nested_render_name}_nest;",
-            f"parg.data = &{var}->{self.c_name};",
+            f"parg.data = &{var}->{self.c_name}.emplace();",
         ]
         if "type-value" in self.attr:
             tv_names = [c_lower(x) for x in self.attr["type-value"]]
@@ -678,7 +812,7 @@ class TypeNestTypeValue(Type):
             local_vars += [f'__u32 {", ".join(tv_names)};']
             for level in self.attr["type-value"]:
                 level = c_lower(level)
-                get_lines += [f"attr_{level} = ynl_attr_data({prev});"]
+                get_lines += [f"attr_{level} = (const struct nlattr *)ynl_attr_data({prev});"]
                 get_lines += [f"{level} = ynl_attr_type(attr_{level});"]
                 prev = "attr_" + level
 
@@ -688,6 +822,33 @@ class TypeNestTypeValue(Type):
         return get_lines, init_lines, local_vars
 
 
+# Empty nests are fine, otherwise there must be room for at least one attr
+NEST_CHECK = "ynl_attr_data_len(attr) && ynl_attr_data_len(attr) < sizeof(struct nlattr)"
+
+
+def nla_size(payload):
+    """Encoded size of an attribute (header + aligned payload)"""
+    return 4 + ((payload + 3) & ~3)
+
+
+def struct_max_put_len(struct):
+    terms = []
+    for _, attr in struct.member_list():
+        if attr.type in {"unused", "pad"}:
+            continue
+        attr_terms = attr.max_put_len()
+        if attr_terms is None:
+            return None
+        terms += attr_terms
+    return terms
+
+
+def len_terms_to_expr(terms):
+    total = sum([x for x in terms if isinstance(x, int)])
+    exprs = [x for x in terms if not isinstance(x, int)]
+    return " + ".join(exprs + [str(total)])
+
+
 class Struct:
     def __init__(self, family, space_name, type_list=None, inherited=None):
         self.family = family
@@ -722,6 +883,13 @@ class Struct:
         self.attrs = dict()
         if type_list is not None:
             for t in type_list:
+                # Classic ops list fixed header members along with attrs
+                if family.is_classic() and t not in self.attr_set:
+                    continue
+                # and some list an attribute twice
+                if t in self.attrs:
+                    continue
+                self.attrs[t] = self.attr_set[t]
                 self.attr_list.append(
                     (t, self.attr_set[t]),
                 )
@@ -843,6 +1011,10 @@ class AttrSet(SpecAttrSet):
         if self.c_name == self.family.c_name:
             self.c_name = ""
 
+    def _nests_root_set(self, elem):
+        ops = self.family.yaml["operations"]["list"]
+        return elem["nested-attributes"] in {op.get("attribute-set") for op in ops}
+
     def new_attr(self, elem, value):
         if elem["type"] in scalars:
             t = TypeScalar(self.family, self, elem, value)
@@ -858,15 +1030,22 @@ class AttrSet(SpecAttrSet):
             t = TypeBinary(self.family, self, elem, value)
         elif elem["type"] == "bitfield32":
             t = TypeBitfield32(self.family, self, elem, value)
+        elif elem["type"] == "nest" and self._nests_root_set(elem):
+            # e.g. rt-link's prop-list, parsing it would need a second struct
+            # type for the same set, keep it raw instead
+            elem = {k: v for k, v in elem.items() if k != "nested-attributes"}
+            t = TypeRawNest(self.family, self, elem, value)
         elif elem["type"] == "nest":
             t = TypeNest(self.family, self, elem, value)
         elif elem["type"] == "indexed-array" and "sub-type" in elem:
             if elem["sub-type"] == "nest":
                 t = TypeArrayNest(self.family, self, elem, value)
             else:
-                raise Exception(f'new_attr: unsupported sub-type {elem["sub-type"]}')
+                t = TypeRawNest(self.family, self, elem, value)
         elif elem["type"] == "nest-type-value":
             t = TypeNestTypeValue(self.family, self, elem, value)
+        elif elem["type"] == "sub-message":
+            t = TypeRawNest(self.family, self, elem, value)
         else:
             raise Exception(f"No typed class for type {elem['type']}")
 
@@ -895,7 +1074,10 @@ class Operation(SpecOperation):
     def resolve(self):
         self.resolve_up(super())
 
-        if not self.is_async:
+        if self.family.is_classic():
+            # No op enum in classic families, code uses the raw message IDs
+            self.enum_name = c_upper(self.name)
+        elif not self.is_async:
             self.enum_name = self.family.op_prefix + c_upper(self.name)
         else:
             self.enum_name = self.family.async_op_prefix + c_upper(self.name)
@@ -934,9 +1116,14 @@ class Family(SpecFamily):
 
         if "uapi-header" in self.yaml:
             self.uapi_header = self.yaml["uapi-header"]
+        elif self.yaml.get("protocol") == "netlink-raw":
+            # Rendered by render_classic_uapi()
+            self.uapi_header = None
         else:
             self.uapi_header = f"linux/{c_lower(self.name)}.h"
-        if self.uapi_header.startswith("linux/") and self.uapi_header.endswith(".h"):
+        if not self.uapi_header:
+            self.uapi_header_name = self.name
+        elif self.uapi_header.startswith("linux/") and self.uapi_header.endswith(".h"):
             self.uapi_header_name = self.uapi_header[6:-2]
         else:
             self.uapi_header_name = self.name
@@ -948,8 +1135,9 @@ class Family(SpecFamily):
             "genetlink",
             "genetlink-c",
             "genetlink-legacy",
+            "netlink-raw",
         }:
-            raise Exception("Codegen only supported for genetlink")
+            raise Exception("Codegen only supported for genetlink and netlink-raw")
 
         self.c_name = c_lower(self.name)
         if "name-prefix" in self.yaml["operations"]:
@@ -988,6 +1176,23 @@ class Family(SpecFamily):
         if self.kernel_policy == "global":
             self._load_global_policy()
 
+    def is_classic(self):
+        return self.proto == "netlink-raw"
+
+    def is_rtnetlink(self):
+        return self.is_classic() and self.yaml.get("protonum") == 0
+
+    def classic_msg(self, value):
+        """
+        Message type as C, rtnetlink ops are named after their RTM_* type.
+        Replies which no request of the family uses stay numeric.
+        """
+        if self.is_rtnetlink():
+            for op in self.ops.values():
+                if op.req_value == value:
+                    return "RTM_" + c_upper(op.name)
+        return f"{value}"
+
     def new_enum(self, elem):
         return EnumSet(self, elem)
 
@@ -999,8 +1204,8 @@ class Family(SpecFamily):
 
     def _mark_notify(self):
         for op in self.msgs.values():
-            if "notify" in op:
-                self.ops[op["notify"]].mark_has_ntf()
+            if "notify" in op and ntf_reply_op(self, op):
+                ntf_reply_op(self, op).mark_has_ntf()
 
     # Fake a 'do' equivalent of all events, so that we can render their response parsing
     def _mock_up_events(self):
@@ -1017,9 +1222,9 @@ class Family(SpecFamily):
             rsp_attrs = set()
             for op_mode in ["do", "dump"]:
                 if op_mode in op and "request" in op[op_mode]:
-                    req_attrs.update(set(op[op_mode]["request"]["attributes"]))
+                    req_attrs.update(set(op[op_mode]["request"].get("attributes", [])))
                 if op_mode in op and "reply" in op[op_mode]:
-                    rsp_attrs.update(set(op[op_mode]["reply"]["attributes"]))
+                    rsp_attrs.update(set(op[op_mode]["reply"].get("attributes", [])))
             if "event" in op:
                 rsp_attrs.update(set(op["event"]["attributes"]))
 
@@ -1188,9 +1393,19 @@ class RenderInfo:
         self.op_mode = op_mode
         self.op = op
 
+        # Generate puts without overflow checks, see print_req_put()
+        self.put_unchecked = False
+
         self.fixed_hdr = None
         if op and op.fixed_header:
-            self.fixed_hdr = "struct " + c_lower(op.fixed_header)
+            self.fixed_hdr = "struct " + classic_struct_name(op.fixed_header)
+
+        # Ops may come with a different fixed header than the family default
+        self.fixed_hdr_len = "yarg->ys->family->hdr_len"
+        self.own_hdr_len = None
+        if op and op.fixed_header != family.fixed_header:
+            self.own_hdr_len = family_hdr_len(family, op.fixed_header)
+            self.fixed_hdr_len = self.own_hdr_len
 
         # 'do' and 'dump' response parsing is identical
         self.type_consistent = True
@@ -1198,7 +1413,9 @@ class RenderInfo:
             if "do" in op:
                 if ("reply" in op["do"]) != ("reply" in op["dump"]):
                     self.type_consistent = False
-                elif "reply" in op["do"] and op["do"]["reply"] != op["dump"]["reply"]:
+                elif "reply" in op["do"] and op["do"]["reply"].get(
+                    "attributes"
+                ) != op["dump"]["reply"].get("attributes"):
                     self.type_consistent = False
             else:
                 self.type_consistent = False
@@ -1224,7 +1441,7 @@ class RenderInfo:
             if op:
                 type_list = []
                 if op_dir in op[op_mode]:
-                    type_list = op[op_mode][op_dir]["attributes"]
+                    type_list = op[op_mode][op_dir].get("attributes", [])
                 self.struct[op_dir] = Struct(family, self.attr_set, type_list=type_list)
         if op_mode == "event":
             self.struct["reply"] = Struct(
@@ -1513,32 +1730,88 @@ def type_name(ri, direction, deref=False):
     return f"{op_prefix(ri, direction, deref=deref)}"
 
 
-def print_prototype(ri, direction, terminate=True, doc=None):
-    suffix = ";" if terminate else ""
-
+def op_fname(ri):
     fname = ri.op.render_name
     if ri.op_mode == "dump":
         fname += "_dump"
+    return fname
+
+
+def print_prototype(
+    ri, direction, terminate=True, doc=None, expected=False, tmpl=False, prepare=False
+):
+    suffix = ";" if terminate else ""
+
+    fname = op_fname(ri)
+    if prepare:
+        fname += "_prepare"
+    elif expected:
+        fname += "_ex"
 
     args = ["ynl_cpp::ynl_socket&  ys"]
-    if "request" in ri.op[ri.op_mode]:
+    if tmpl:
+        args.append("ynl_cpp::request_template& tmpl")
+    elif "request" in ri.op[ri.op_mode]:
         args.append(
             f"{type_name(ri, direction)}& " + f"{direction_to_suffix[direction][1:]}"
         )
 
+    if expected and not prepare and "reply" in ri.op[ri.op_mode]:
+        default = " = nullptr" if terminate else ""
+        args.append(f"const ynl_cpp::projection *proj{default}")
+
     ret = "int"
     if "reply" in ri.op[ri.op_mode]:
         ret = f"std::unique_ptr<{type_name(ri, rdir(direction))}>"
+    if prepare:
+        ret = "ynl_cpp::result<ynl_cpp::request_template>"
+    elif expected:
+        ret = f"ynl_cpp::result<{ret if ret != 'int' else 'void'}>"
 
     ri.cw.write_func_prot(ret, fname, args, doc=doc, suffix=suffix)
 
 
+def _print_op_prototypes(ri, doc=None):
+    print_prototype(ri, "request", doc=doc)
+    print_prototype(ri, "request", expected=True)
+    if "request" not in ri.op[ri.op_mode]:
+        return
+    # Prebuilt request flavour, for requests issued over and over again
+    print_prototype(ri, "request", prepare=True)
+    print_prototype(ri, "request", tmpl=True)
+    print_prototype(ri, "request", expected=True, tmpl=True)
+    if op_batchable(ri):
+        # Batched flavour, encodes into a ynl_cpp::msg_batch
+        print_batch_prototype(ri)
+
+
 def print_req_prototype(ri):
-    print_prototype(ri, "request", doc=ri.op["doc"])
+    _print_op_prototypes(ri, doc=ri.op["doc"])
 
 
 def print_dump_prototype(ri):
-    print_prototype(ri, "request")
+    _print_op_prototypes(ri)
+
+
+def print_expected_wrapper(ri, tmpl=False):
+    """Classic nullptr / -1 flavour of a call, implemented on top of _ex()"""
+    if tmpl:
+        args = "ys, tmpl"
+    elif "request" in ri.op[ri.op_mode]:
+        args = "ys, req"
+    else:
+        args = "ys"
+
+    print_prototype(ri, "request", terminate=False, tmpl=tmpl)
+    ri.cw.block_start()
+    ri.cw.p(f"auto ret = {op_fname(ri)}_ex({args});")
+    if "reply" in ri.op[ri.op_mode]:
+        ri.cw.p("if (!ret)")
+        ri.cw.p("return nullptr;")
+        ri.cw.p("return std::move(*ret);")
+    else:
+        ri.cw.p("return ret ? 0 : -1;")
+    ri.cw.block_end()
 
 
 def put_typol_fwd(cw, struct):
@@ -1547,6 +1820,13 @@ def put_typol_fwd(cw, struct):
 
 def put_typol(cw, struct):
     type_max = struct.attr_set.max_name
+    if struct.family.is_classic():
+        # No MAX constant is rendered for classic families, see
+        # render_classic_uapi()
+        attr_set = struct.attr_set
+        if attr_set.subset_of:
+            attr_set = struct.family.attr_sets[attr_set.subset_of]
+        type_max = max([attr.value for attr in attr_set.attrs.values()], default=0)
     cw.block_start(
         line=f"static std::array<ynl_policy_attr,{type_max} + 1> {struct.render_name}_policy = []()"
     )
@@ -1591,17 +1871,24 @@ def put_op_name_fwd(family, cw):
 def put_op_name(family, cw):
     map_name = f"{family.c_name}_op_strmap"
     max_num = "0"
+    max_val = 0
     for op_name, op in family.msgs.items():
         if op.rsp_value:
             # Make sure we don't add duplicated entries, if multiple commands
             # produce the same response in legacy families.
             if family.rsp_by_value[op.rsp_value] != op:
                 continue
+            # Ops need not be listed in value order (e.g. OVS)
+            if op.rsp_value < max_val:
+                continue
+            max_val = op.rsp_value
 
             if op.req_value == op.rsp_value:
                 max_num = f"{op.enum_name}"
             else:
                 max_num = f"{op.rsp_value}"
+    if family.is_classic():
+        max_num = family.classic_msg(max(family.rsp_by_value))
 
     cw.block_start(
         line=f"static constexpr std::array<std::string_view, {max_num} + 1> {map_name} = []()"
@@ -1614,8 +1901,10 @@ def put_op_name(family, cw):
             if family.rsp_by_value[op.rsp_value] != op:
                 continue
 
-            if op.req_value == op.rsp_value:
+            if op.req_value == op.rsp_value and not family.is_classic():
                 cw.p(f'arr[{op.enum_name}] = "{op_name}";')
+            elif family.is_classic():
+                cw.p(f'arr[{family.classic_msg(op.rsp_value)}] = "{op_name}";')
             else:
                 cw.p(f'arr[{op.rsp_value}] = "{op_name}";')
     cw.p("return arr;")
@@ -1633,6 +1922,14 @@ def put_enum_to_str_fwd(family, cw, enum):
 def put_enum_to_str(family, cw, enum):
     map_name = f"{enum.render_name}_strmap"
     max_num = "0"
+
+    # Sparse enums (e.g. negative values stored as u32) would need huge maps
+    if enum.type != "flags" and any(
+        e.value < 0 or e.value > 255 for e in enum.entries.values()
+    ):
+        put_enum_to_str_switch(cw, enum)
+        return
+
     for entry in enum.entries.values():
         max_num = f"{entry.value}"
     cw.block_start(
@@ -1648,6 +1945,21 @@ def put_enum_to_str(family, cw, enum):
     _put_enum_to_str_helper(cw, enum.render_name, map_name, "value", enum=enum)
 
 
+def put_enum_to_str_switch(cw, enum):
+    cw.write_func_prot(
+        "std::string_view", f"{enum.render_name}_str", [enum.user_type + " value"]
+    )
+    cw.block_start()
+    cw.block_start(line="switch ((__u32)value)")
+    for entry in enum.entries.values():
+        cw.p(f"case {entry.value & 0xffffffff:#x}:")
+        cw.p(f'return "{entry.name}";')
+    cw.block_end()
+    cw.p('return "";')
+    cw.block_end()
+    cw.nl()
+
+
 def put_req_nested_prototype(ri, struct, suffix=";"):
     func_args = [
         "struct nlmsghdr *nlh",
@@ -1682,18 +1994,15 @@ def _multi_parse(ri, struct, init_lines, local_vars):
     else:
         if ri.fixed_hdr:
             local_vars += ["void *hdr;"]
-        iter_line = "ynl_attr_for_each(attr, nlh, yarg->ys->family->hdr_len)"
+        iter_line = f"ynl_attr_for_each(attr, nlh, {ri.fixed_hdr_len})"
 
     array_nests = set()
     multi_attrs = set()
     needs_parg = False
     for arg, aspec in struct.member_list():
-        if aspec["type"] == "indexed-array" and "sub-type" in aspec:
-            if aspec["sub-type"] == "nest":
-                local_vars.append(f"const struct nlattr *attr_{aspec.c_name};")
-                array_nests.add(arg)
-            else:
-                raise Exception(f'Not supported sub-type {aspec["sub-type"]}')
+        if aspec["type"] == "indexed-array" and aspec.get("sub-type") == "nest":
+            local_vars.append(f"const struct nlattr *attr_{aspec.c_name};")
+            array_nests.add(arg)
         if "multi-attr" in aspec:
             multi_attrs.add(arg)
         needs_parg |= "nested-attributes" in aspec
@@ -1719,7 +2028,10 @@ def _multi_parse(ri, struct, init_lines, local_vars):
         ri.cw.p(f"dst->{arg} = {arg};")
 
     if ri.fixed_hdr:
-        ri.cw.p("hdr = ynl_nlmsg_data_offset(nlh, sizeof(struct genlmsghdr));")
+        if ri.family.is_classic():
+            ri.cw.p("hdr = ynl_nlmsg_data(nlh);")
+        else:
+            ri.cw.p("hdr = ynl_nlmsg_data_offset(nlh, sizeof(struct genlmsghdr));")
         ri.cw.p(f"memcpy(&dst->_hdr, hdr, sizeof({ri.fixed_hdr}));")
     for anest in sorted(all_multi):
         aspec = struct[anest]
@@ -1732,6 +2044,11 @@ def _multi_parse(ri, struct, init_lines, local_vars):
     ri.cw.block_start(line=iter_line)
     ri.cw.p("unsigned int type = ynl_attr_type(attr);")
     ri.cw.nl()
+    if not struct.nested:
+        # Caller may only want a subset of the top level attrs
+        ri.cw.p("if (!ynl_attr_projected(yarg, type))")
+        ri.cw.p("continue;")
+        ri.cw.nl()
 
     first = True
     for _, arg in struct.member_list():
@@ -1777,6 +2094,16 @@ def _multi_parse(ri, struct, init_lines, local_vars):
             ri.cw.p("return YNL_PARSE_CB_ERROR;")
         elif aspec.type in scalars:
             ri.cw.p(f"dst->{aspec.c_name}[i] = ynl_attr_get_{aspec.type}(attr);")
+        elif aspec.type == "string":
+            ri.cw.p("if (!ynl_attr_str_valid(attr))")
+            ri.cw.p('return ynl_attr_invalid(yarg, attr, "string");')
+            ri.cw.p(f"dst->{aspec.c_name}[i].assign(ynl_attr_get_str(attr));")
+        elif aspec.type == "binary":
+            ri.cw.p("__u8 *data = (__u8*)ynl_attr_data(attr);")
+            ri.cw.nl()
+            ri.cw.p(
+                f"dst->{aspec.c_name}[i].assign(data, data + ynl_attr_data_len(attr));"
+            )
         else:
             raise Exception("Nest parsing type not supported yet")
         ri.cw.p("i++;")
@@ -1841,129 +2168,297 @@ def parse_rsp_msg(ri, deref=False):
         ri.cw.nl()
 
 
-def print_req(ri):
-    ret_ok = "0"
-    ret_err = "-1"
+def msg_hdr_len_terms(ri):
+    terms = ["NLMSG_HDRLEN"]
+    if not ri.family.is_classic():
+        terms += ["GENL_HDRLEN"]
+    if ri.fixed_hdr:
+        terms += [f"NLMSG_ALIGN(sizeof({ri.fixed_hdr}))"]
+    return terms
+
+
+def print_req_max_len(ri):
+    if "request" not in ri.op[ri.op_mode]:
+        return
+    terms = struct_max_put_len(ri.struct["request"])
+    if terms is None:
+        return
+
+    ri.cw.p(f"/* Upper bound of the encoded request size, for sizing buffers */")
+    ri.cw.p(
+        f"inline constexpr size_t {op_prefix(ri, 'request')}_max_len = "
+        + f"{len_terms_to_expr(msg_hdr_len_terms(ri) + terms)};"
+    )
+    ri.cw.nl()
+
+
+def print_req_put(ri):
+    """Encode the request object (fixed header and attributes) into nlh"""
+    direction = "request"
+    local_vars = []
+    if ri.fixed_hdr:
+        local_vars += ["size_t hdr_len;", "void *hdr;"]
+
+    # Fixed size attributes go first, without overflow checks. Their total
+    # is bounded at build time so they always fit in a fresh message.
+    fixed = []
+    others = []
+    for _, attr in ri.struct["request"].member_list():
+        if attr.is_fixed_size():
+            fixed.append(attr)
+        else:
+            others.append(attr)
+
+    ri.cw.write_func_prot(
+        "static void",
+        f"{op_fname(ri)}_put",
+        ["struct nlmsghdr *nlh", f"{type_name(ri, direction)}& req"],
+    )
+    ri.cw.block_start()
+    ri.cw.write_func_lvar(local_vars)
+
+    if fixed:
+        terms = msg_hdr_len_terms(ri)
+        for attr in fixed:
+            terms += attr.max_put_len()
+        ri.cw.p(f"static_assert({len_terms_to_expr(terms)} <= YNL_SOCKET_BUFFER_SIZE);")
+        ri.cw.nl()
+
+    if ri.fixed_hdr:
+        ri.cw.p("hdr_len = sizeof(req._hdr);")
+        ri.cw.p("hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);")
+        ri.cw.p("memcpy(hdr, &req._hdr, hdr_len);")
+        ri.cw.nl()
+
+    ri.put_unchecked = True
+    for attr in fixed:
+        attr.attr_put(ri, "req")
+    ri.put_unchecked = False
+    for attr in others:
+        attr.attr_put(ri, "req")
+    ri.cw.block_end()
+    ri.cw.nl()
+
+
+def print_msg_start(ri):
+    if ri.family.is_classic():
+        msg = ri.family.classic_msg(ri.op.req_value)
+        if ri.op_mode == "dump":
+            ri.cw.p(f"nlh = ynl_msg_start_dump(ys, {msg});")
+        elif "request" in ri.op[ri.op_mode]:
+            ri.cw.p(f"nlh = ynl_msg_start_req(ys, {msg}, req._nlmsg_flags);")
+        else:
+            ri.cw.p(f"nlh = ynl_msg_start_req(ys, {msg}, 0);")
+    else:
+        start = (
+            "ynl_gemsg_start_dump" if ri.op_mode == "dump" else "ynl_gemsg_start_req"
+        )
+        ri.cw.p(f"nlh = {start}(ys, {ri.nl.get_family_id()}, {ri.op.enum_name}, 1);")
+    if "request" in ri.op[ri.op_mode]:
+        ri.cw.p(f"{op_fname(ri)}_put(nlh, req);")
+    ri.cw.nl()
+
+
+def op_rsp_cmd(ri):
+    if ri.op.value is not None and not ri.family.is_classic():
+        return ri.op.enum_name
+    if ri.family.is_classic():
+        return ri.family.classic_msg(ri.op.rsp_value)
+    return ri.op.rsp_value
+
+
+def print_req_hdr_len(ri):
+    if ri.own_hdr_len:
+        ri.cw.p(f"((struct ynl_sock*)ys)->req_hdr_len = {ri.own_hdr_len};")
+
+
+def print_req_exec(ri):
     direction = "request"
     local_vars = [
         "struct ynl_req_state yrs = { .yarg = { .ys = ys, }, };",
-        "struct nlmsghdr *nlh;",
         "int err;",
     ]
 
     if "reply" in ri.op[ri.op_mode]:
-        ret_ok = "rsp"
-        ret_err = "NULL"
         local_vars += [f"std::unique_ptr<{type_name(ri, rdir(direction))}> rsp;"]
+        ret = f"std::unique_ptr<{type_name(ri, rdir(direction))}>"
+    else:
+        ret = "void"
 
-    if ri.fixed_hdr:
-        local_vars += ["size_t hdr_len;", "void *hdr;"]
+    args = ["ynl_cpp::ynl_socket&  ys", "struct nlmsghdr *nlh"]
+    if "reply" in ri.op[ri.op_mode]:
+        args.append("const ynl_cpp::projection *proj")
 
-    print_prototype(ri, direction, terminate=False)
+    ri.cw.write_func_prot(
+        f"static ynl_cpp::result<{ret}>",
+        f"{op_fname(ri)}_exec",
+        args,
+    )
     ri.cw.block_start()
     ri.cw.write_func_lvar(local_vars)
 
-    ri.cw.p(
-        f"nlh = ynl_gemsg_start_req(ys, {ri.nl.get_family_id()}, {ri.op.enum_name}, 1);"
-    )
-
     ri.cw.p(
         f"((struct ynl_sock*)ys)->req_policy = &{ri.struct['request'].render_name}_nest;"
     )
+    print_req_hdr_len(ri)
     if "reply" in ri.op[ri.op_mode]:
         ri.cw.p(f"yrs.yarg.rsp_policy = &{ri.struct['reply'].render_name}_nest;")
     ri.cw.nl()
 
-    if ri.fixed_hdr:
-        ri.cw.p("hdr_len = sizeof(req->_hdr);")
-        ri.cw.p("hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);")
-        ri.cw.p("memcpy(hdr, &req->_hdr, hdr_len);")
-        ri.cw.nl()
-
-    for _, attr in ri.struct["request"].member_list():
-        attr.attr_put(ri, "req")
-    ri.cw.nl()
-
     if "reply" in ri.op[ri.op_mode]:
         ri.cw.p(f"rsp.reset(new {type_name(ri, rdir(direction))}());")
         ri.cw.p("yrs.yarg.data = rsp.get();")
+        ri.cw.p("yrs.yarg.proj = proj ? proj->words() : nullptr;")
         ri.cw.p(f"yrs.cb = {op_prefix(ri, 'reply')}_parse;")
-        if ri.op.value is not None:
-            ri.cw.p(f"yrs.rsp_cmd = {ri.op.enum_name};")
-        else:
-            ri.cw.p(f"yrs.rsp_cmd = {ri.op.rsp_value};")
+        ri.cw.p(f"yrs.rsp_cmd = {op_rsp_cmd(ri)};")
         ri.cw.nl()
     ri.cw.p("err = ynl_exec(ys, nlh, &yrs);")
     ri.cw.p("if (err < 0)")
-    if "reply" in ri.op[ri.op_mode]:
-        ri.cw.p("return nullptr;")
-    else:
-        ri.cw.p("return -1;")
-    ri.cw.nl()
-
-    ri.cw.p(f"return {ret_ok};")
+    ri.cw.p("return std::unexpected(ynl_cpp::error(ys));")
     ri.cw.nl()
 
+    if "reply" in ri.op[ri.op_mode]:
+        ri.cw.p("return rsp;")
+    else:
+        ri.cw.p("return {};")
     ri.cw.block_end()
+    ri.cw.nl()
 
 
-def print_dump(ri):
+def print_dump_exec(ri):
     direction = "request"
-    print_prototype(ri, direction, terminate=False)
-    ri.cw.block_start()
-    local_vars = [
-        "struct ynl_dump_no_alloc_state yds = {};",
-        "struct nlmsghdr *nlh;",
-        "int err;",
-    ]
+    ret = f"std::unique_ptr<{type_name(ri, rdir(direction))}>"
 
-    if ri.fixed_hdr:
-        local_vars += ["size_t hdr_len;", "void *hdr;"]
-
-    ri.cw.write_func_lvar(local_vars)
+    ri.cw.write_func_prot(
+        f"static ynl_cpp::result<{ret}>",
+        f"{op_fname(ri)}_exec",
+        [
+            "ynl_cpp::ynl_socket&  ys",
+            "struct nlmsghdr *nlh",
+            "const ynl_cpp::projection *proj",
+        ],
+    )
+    ri.cw.block_start()
+    ri.cw.write_func_lvar(["struct ynl_dump_no_alloc_state yds = {};", "int err;"])
 
     ri.cw.p(f"auto ret = std::make_unique<{type_name(ri, rdir(direction))}>();")
-
     ri.cw.p("yds.yarg.ys = ys;")
     ri.cw.p(f"yds.yarg.rsp_policy = &{ri.struct['reply'].render_name}_nest;")
     ri.cw.p("yds.yarg.data = ret.get();")
+    ri.cw.p("yds.yarg.proj = proj ? proj->words() : nullptr;")
     ri.cw.p(
         f"yds.alloc_cb = [](void* arg)->void*{{return &(static_cast<{type_name(ri, rdir(direction))}*>(arg)->objs.emplace_back());}};"
     )
 
     ri.cw.p(f"yds.cb = {op_prefix(ri, 'reply', deref=True)}_parse;")
-    if ri.op.value is not None:
-        ri.cw.p(f"yds.rsp_cmd = {ri.op.enum_name};")
-    else:
-        ri.cw.p(f"yds.rsp_cmd = {ri.op.rsp_value};")
-    ri.cw.nl()
-    ri.cw.p(
-        f"nlh = ynl_gemsg_start_dump(ys, {ri.nl.get_family_id()}, {ri.op.enum_name}, 1);"
-    )
-
-    if ri.fixed_hdr:
-        ri.cw.p("hdr_len = sizeof(req->_hdr);")
-        ri.cw.p("hdr = ynl_nlmsg_put_extra_header(nlh, hdr_len);")
-        ri.cw.p("memcpy(hdr, &req->_hdr, hdr_len);")
-        ri.cw.nl()
-
+    ri.cw.p(f"yds.rsp_cmd = {op_rsp_cmd(ri)};")
     if "request" in ri.op[ri.op_mode]:
         ri.cw.p(
             f"((struct ynl_sock*)ys)->req_policy = &{ri.struct['request'].render_name}_nest;"
         )
-        ri.cw.nl()
-        for _, attr in ri.struct["request"].member_list():
-            attr.attr_put(ri, "req")
+        print_req_hdr_len(ri)
     ri.cw.nl()
 
     ri.cw.p("err = ynl_exec_dump_no_alloc(ys, nlh, &yds);")
     ri.cw.p("if (err < 0)")
-    ri.cw.p("return nullptr;")
+    ri.cw.p("return std::unexpected(ynl_cpp::error(ys));")
     ri.cw.nl()
 
     ri.cw.p("return ret;")
+    ri.cw.block_end()
+    ri.cw.nl()
+
+
+def print_op_entry_points(ri):
+    """Public entry points, all built on the static _put() / _exec() helpers"""
+    direction = "request"
+    has_req = "request" in ri.op[ri.op_mode]
+    proj = ", proj" if "reply" in ri.op[ri.op_mode] else ""
+
+    print_prototype(ri, direction, terminate=False, expected=True)
+    ri.cw.block_start()
+    ri.cw.write_func_lvar("struct nlmsghdr *nlh;")
+    print_msg_start(ri)
+    ri.cw.p(f"return {op_fname(ri)}_exec(ys, nlh{proj});")
+    ri.cw.block_end()
+    ri.cw.nl()
+
+    print_expected_wrapper(ri)
+    ri.cw.nl()
+
+    if not has_req:
+        return
+
+    print_prototype(ri, direction, terminate=False, prepare=True)
+    ri.cw.block_start()
+    ri.cw.write_func_lvar("struct nlmsghdr *nlh;")
+    print_msg_start(ri)
+    if ri.own_hdr_len:
+        ri.cw.p(
+            f"return ynl_cpp::request_template::capture(ys, nlh, {ri.own_hdr_len});"
+        )
+    else:
+        ri.cw.p("return ynl_cpp::request_template::capture(ys, nlh);")
+    ri.cw.block_end()
     ri.cw.nl()
+
+    print_prototype(ri, direction, terminate=False, expected=True, tmpl=True)
+    ri.cw.block_start()
+    ri.cw.p(f"return {op_fname(ri)}_exec(ys, ynl_msg_reuse(ys, tmpl.nlh()){proj});")
     ri.cw.block_end()
+    ri.cw.nl()
+
+    print_expected_wrapper(ri, tmpl=True)
+
+    if op_batchable(ri):
+        ri.cw.nl()
+        print_batch(ri)
+
+
+def op_batchable(ri):
+    """Requests without a reply can be sent in bulk, only errors come back"""
+    return ri.op_mode == "do" and "reply" not in ri.op[ri.op_mode]
+
+
+def print_batch_prototype(ri, terminate=True):
+    ri.cw.write_func_prot(
+        "ynl_cpp::result<size_t>",
+        f"{op_fname(ri)}_batch",
+        ["ynl_cpp::msg_batch& batch", f"{type_name(ri, 'request')}& req"],
+        suffix=";" if terminate else "",
+    )
+
+
+def print_batch(ri):
+    print_batch_prototype(ri, terminate=False)
+    ri.cw.block_start()
+    ri.cw.write_func_lvar("struct nlmsghdr *nlh;")
+    if ri.family.is_classic():
+        msg = ri.family.classic_msg(ri.op.req_value)
+        ri.cw.p(f"nlh = batch.msg_start({msg}, req._nlmsg_flags);")
+    else:
+        ri.cw.p(f"nlh = batch.gemsg_start({ri.op.enum_name}, 1);")
+    ri.cw.p(f"{op_fname(ri)}_put(nlh, req);")
+    args = f"nlh, &{ri.struct['request'].render_name}_nest"
+    if ri.own_hdr_len:
+        args += f", {ri.own_hdr_len}"
+    ri.cw.p(f"return batch.msg_end({args});")
+    ri.cw.block_end()
+    ri.cw.nl()
+
+
+def print_req(ri):
+    if "request" in ri.op[ri.op_mode]:
+        print_req_put(ri)
+    print_req_exec(ri)
+    print_op_entry_points(ri)
+
+
+def print_dump(ri):
+    if "request" in ri.op[ri.op_mode]:
+        print_req_put(ri)
+    print_dump_exec(ri)
+    print_op_entry_points(ri)
 
 
 def _print_type(ri, direction, struct):
@@ -1976,8 +2471,13 @@ def _print_type(ri, direction, struct):
 
     ri.cw.block_start(line=f"struct {ri.family.c_name}{suffix}")
 
+    if req_has_nlmsg_flags(ri, direction):
+        # NLM_F_CREATE, NLM_F_EXCL, NLM_F_REPLACE etc.
+        ri.cw.p("__u16 _nlmsg_flags{};")
+        ri.cw.nl()
+
     if ri.fixed_hdr:
-        ri.cw.p(ri.fixed_hdr + " _hdr;")
+        ri.cw.p(ri.fixed_hdr + " _hdr{};")
         ri.cw.nl()
 
     for arg in struct.inherited:
@@ -2010,8 +2510,16 @@ def print_parse_prototype(ri, direction, terminate=True):
     )
 
 
+def req_has_nlmsg_flags(ri, direction):
+    return ri.family.is_classic() and ri.op_mode == "do" and direction == "request"
+
+
 def print_req_type(ri):
-    if len(ri.struct["request"].attr_list) == 0:
+    if (
+        len(ri.struct["request"].attr_list) == 0
+        and not ri.fixed_hdr
+        and not req_has_nlmsg_flags(ri, "request")
+    ):
         return
     print_type(ri, "request")
 
@@ -2030,6 +2538,16 @@ def print_wrapped_type(ri):
     ri.cw.block_start(line=f"struct {type_name(ri, 'reply')}")
     if ri.op_mode == "dump":
         ri.cw.p(f"std::list<{type_name(ri, 'reply', deref=True)}> objs;")
+    elif ri.op_mode in ("notify", "event"):
+        # Same layout as struct ynl_ntf_base_type
+        ri.cw.p("__u16 family;")
+        ri.cw.p("__u8 cmd;")
+        ri.cw.p("int nsid;")
+        ri.cw.p("struct ynl_ntf_base_type *next;")
+        ri.cw.p("void (*free)(struct ynl_ntf_base_type *ntf);")
+        ri.cw.p(
+            f"{type_name(ri, 'reply', deref=True)} obj __attribute__((aligned(8)));"
+        )
     ri.cw.block_end(line=";")
     ri.cw.nl()
 
@@ -2079,15 +2597,67 @@ def policy_should_be_static(family):
     return family.kernel_policy == "split" or kernel_can_gen_family_struct(family)
 
 
+def ntf_reply_op(family, ntf_op):
+    """
+    Op whose reply describes the notification. Classic deletion
+    notifications point at a do without a reply, the kernel sends them
+    in the same format as the creation, so borrow the reply of an op
+    with the same attribute set and fixed header.
+    """
+    op = family.ops[ntf_op["notify"]]
+    if "reply" in op.get("do", {}):
+        return op
+    if not family.is_classic():
+        return None
+    for other in family.ops.values():
+        if (
+            "reply" in other.get("do", {})
+            and other["attribute-set"] == op["attribute-set"]
+            and other.fixed_header == op.fixed_header
+        ):
+            return other
+    return None
+
+
+def ntf_id(family, op):
+    return family.classic_msg(op.rsp_value) if family.is_classic() else op.enum_name
+
+
 def _render_user_ntf_entry(ri, op):
-    ri.cw.block_start(line=f"arr[{op.enum_name}] = ")
-    # ri.cw.p(f".alloc_sz\t= sizeof({type_name(ri, 'event')}),")
+    ri.cw.block_start(line=f"arr[{ntf_id(ri.family, op)}] = ")
     ri.cw.p(f".cb\t\t= {op_prefix(ri, 'reply', deref=True)}_parse,")
     ri.cw.p(f".policy\t\t= &{ri.struct['reply'].render_name}_nest,")
-    # ri.cw.p(f".free\t\t= (void *){op_prefix(ri, 'notify')}_free,")
+    ri.cw.p(f".alloc_sz\t= sizeof({type_name(ri, 'reply')}),")
+    ri.cw.p(f".free\t\t= {type_name(ri, 'reply')}_free,")
+    ri.cw.p(f".init\t\t= {type_name(ri, 'reply')}_init,")
     ri.cw.block_end(line=";")
 
 
+def print_ntf_type_free(ri):
+    name = type_name(ri, "reply")
+
+    ri.cw.p(f"static_assert(ynl_cpp::ntf_layout_matches<{name}>());")
+    ri.cw.nl()
+    ri.cw.write_func_prot(
+        "static void *", f"{name}_init", ["struct ynl_ntf_base_type *ntf"]
+    )
+    ri.cw.block_start()
+    ri.cw.p(f"return &(new (ntf) {name}())->obj;")
+    ri.cw.block_end()
+    ri.cw.nl()
+
+    ri.cw.write_func_prot(
+        "static void", f"{name}_free", ["struct ynl_ntf_base_type *ntf"]
+    )
+    ri.cw.block_start()
+    ri.cw.p(f"{name} *rsp = ({name} *)ntf;")
+    ri.cw.nl()
+    ri.cw.p(f"rsp->~{name}();")
+    ri.cw.p("::free(rsp);")
+    ri.cw.block_end()
+    ri.cw.nl()
+
+
 def render_user_family(family, cw, prototype):
     symbol = f"const struct ynl_family ynl_{family.c_name}_family"
     proto = f"const struct ynl_family& get_ynl_{family.c_name}_family()"
@@ -2095,17 +2665,26 @@ def render_user_family(family, cw, prototype):
         cw.p(f"{proto};")
         return
 
-    if family.ntfs:
+    ntfs = {
+        k: v
+        for k, v in family.ntfs.items()
+        if "notify" not in v or ntf_reply_op(family, v)
+    }
+    if ntfs:
         max_num = "0"
-        for ntf_op_name, ntf_op in family.ntfs.items():
-            max_num = ntf_op.enum_name
+        for ntf_op_name, ntf_op in ntfs.items():
+            max_num = ntf_id(family, ntf_op)
+        if family.is_classic():
+            max_num = family.classic_msg(
+                max(ntf_op.rsp_value for ntf_op in ntfs.values())
+            )
         cw.block_start(
-            line=f"static constexpr std::array<ynl_ntf_info, {max_num} + 1> {family['name']}_ntf_info = []()"
+            line=f"static constexpr std::array<ynl_ntf_info, {max_num} + 1> {family.c_name}_ntf_info = []()"
         )
         cw.p(f"std::array<ynl_ntf_info, {max_num} + 1> arr{{}};")
-        for ntf_op_name, ntf_op in family.ntfs.items():
+        for ntf_op_name, ntf_op in ntfs.items():
             if "notify" in ntf_op:
-                op = family.ops[ntf_op["notify"]]
+                op = ntf_reply_op(family, ntf_op)
                 ri = RenderInfo(cw, family, "user", op, "notify")
             elif "event" in ntf_op:
                 ri = RenderInfo(cw, family, "user", ntf_op, "event")
@@ -2121,17 +2700,27 @@ def render_user_family(family, cw, prototype):
         cw.block_end(line="();")
         cw.nl()
 
+    if family.is_classic() and family.mcgrps["list"]:
+        cw.block_start(
+            line=f"static const struct ynl_mcast_grp {family.c_name}_mcast_groups[] ="
+        )
+        for grp in family.mcgrps["list"]:
+            cw.p(f'{{ "{grp["name"]}", {grp["value"]} }},')
+        cw.block_end(line=";")
+        cw.nl()
+
     cw.block_start(f"{symbol} = ")
     cw.p(f'.name\t\t= "{family.c_name}",')
-    if family.fixed_header:
-        cw.p(
-            f".hdr_len\t= sizeof(struct genlmsghdr) + sizeof(struct {c_lower(family.fixed_header)}),"
-        )
-    else:
-        cw.p(".hdr_len\t= sizeof(struct genlmsghdr),")
-    if family.ntfs:
-        cw.p(f".ntf_info\t= {family['name']}_ntf_info.data(),")
-        cw.p(f".ntf_info_size\t= {family['name']}_ntf_info.size(),")
+    cw.p(f".hdr_len\t= {family_hdr_len(family, family.fixed_header)},")
+    if ntfs:
+        cw.p(f".ntf_info\t= {family.c_name}_ntf_info.data(),")
+        cw.p(f".ntf_info_size\t= {family.c_name}_ntf_info.size(),")
+    if family.is_classic():
+        cw.p(".is_classic\t= true,")
+        cw.p(f".classic_id\t= {family.yaml['protonum']},")
+        if family.mcgrps["list"]:
+            cw.p(f".mcast_groups\t= {family.c_name}_mcast_groups,")
+            cw.p(f".n_mcast_groups\t= std::size({family.c_name}_mcast_groups),")
     cw.block_end(line=";")
 
     cw.block_start(f"{proto}")
@@ -2139,6 +2728,123 @@ def render_user_family(family, cw, prototype):
     cw.block_end(line=";")
 
 
+# Struct names which uapi headers #define to something else (linux/pkt_cls.h
+# has tc_gen expand to the common members of action parameters)
+_CLASSIC_STRUCT_RENAMES = {
+    "tc-gen": "tc-gen-parms",
+}
+
+
+def classic_struct_name(name):
+    return c_lower(_CLASSIC_STRUCT_RENAMES.get(name, name))
+
+
+_CLASSIC_MEMBER_TYPES = {
+    "u8": "__u8",
+    "u16": "__u16",
+    "u32": "__u32",
+    "u64": "__u64",
+    "s8": "__s8",
+    "s16": "__s16",
+    "s32": "__s32",
+    "s64": "__s64",
+}
+
+
+def _classic_structs(family):
+    """Struct definitions used as fixed headers or attribute payloads, in dependency order"""
+    defs = {d["name"]: d for d in family["definitions"] if d["type"] == "struct"}
+    todo = []
+
+    if "fixed-header" in family["operations"]:
+        todo.append(family["operations"]["fixed-header"])
+    for op in family["operations"]["list"]:
+        if "fixed-header" in op:
+            todo.append(op["fixed-header"])
+    for attr_set in family["attribute-sets"]:
+        for attr in attr_set.get("attributes", []):
+            if "struct" in attr:
+                todo.append(attr["struct"])
+    for msg in family.get("sub-messages", []):
+        for fmt in msg["formats"]:
+            if "fixed-header" in fmt:
+                todo.append(fmt["fixed-header"])
+
+    # Depth first, so that structs are defined before they are embedded
+    used = []
+
+    def visit(name):
+        if name in used or name not in defs:
+            return
+        for member in defs[name]["members"]:
+            if "struct" in member:
+                visit(member["struct"])
+        used.append(name)
+
+    for name in todo:
+        visit(name)
+
+    return [defs[name] for name in used]
+
+
+def render_classic_uapi(family, cw):
+    """
+    netlink-raw specs do not come with a uapi header which would match the
+    names used by the generated code, render the constants and structs here.
+    Only attribute values are rendered, MAX / CNT constants would collide
+    with the kernel headers' macros.
+    """
+    cw.p("/* Definitions */")
+    for const in family.consts.values():
+        if not isinstance(const, EnumSet):
+            continue
+        cw.block_start(line=f"enum {const.enum_name or ''}".rstrip())
+        for entry in const.entries.values():
+            cw.p(f"{entry.c_name} = {entry.user_value()},")
+        cw.block_end(line=";")
+        cw.nl()
+
+    for definition in _classic_structs(family):
+        cw.block_start(line=f"struct {classic_struct_name(definition['name'])}")
+        n_pad = 0
+        for member in definition["members"]:
+            name = c_lower(member["name"])
+            if member["type"] == "pad":
+                cw.p(f"__u8 {name}{n_pad or ''}[{member.get('len', 1)}];")
+                n_pad += 1
+            elif member["type"] == "binary" and "struct" in member:
+                cw.p(f"struct {classic_struct_name(member['struct'])} {name};")
+            elif member["type"] == "binary":
+                cw.p(f"__u8 {name}[{member['len']}];")
+            elif member.get("byte-order") == "big-endian":
+                cw.p(f"__be{member['type'][1:]} {name};")
+            else:
+                cw.p(f"{_CLASSIC_MEMBER_TYPES[member['type']]} {name};")
+        cw.block_end(line=";")
+        cw.nl()
+
+    cw.p("/* Attributes */")
+    for attr_set in family.attr_sets.values():
+        if attr_set.subset_of:
+            continue
+        cw.block_start(line="enum")
+        for attr in attr_set.attrs.values():
+            cw.p(f"{attr.enum_name} = {attr.value},")
+        cw.block_end(line=";")
+        cw.nl()
+
+
+def family_hdr_len(family, fixed_header):
+    """Length of the headers in front of the attributes, as a C expression"""
+    if family.is_classic():
+        if not fixed_header:
+            return "0"
+        return f"sizeof(struct {classic_struct_name(fixed_header)})"
+    if not fixed_header:
+        return "sizeof(struct genlmsghdr)"
+    return f"sizeof(struct genlmsghdr) + sizeof(struct {c_lower(fixed_header)})"
+
+
 def family_contains_bitfield32(family):
     for _, attr_set in family.attr_sets.items():
         if attr_set.subset_of:
@@ -2159,6 +2865,167 @@ def find_kernel_root(full_path):
             return full_path, sub_path[:-1]
 
 
+# Must match enum ynl_cpp::dyn_type in lib/ynl-dyn.hpp
+_BLOB_TYPES = {
+    "unused": 0,
+    "pad": 0,
+    "flag": 1,
+    "u8": 2,
+    "u16": 3,
+    "u32": 4,
+    "u64": 5,
+    "s8": 6,
+    "s16": 7,
+    "s32": 8,
+    "s64": 9,
+    "uint": 10,
+    "sint": 11,
+    "string": 12,
+    "binary": 13,
+    "nest": 14,
+    "indexed-array": 15,
+    "nest-type-value": 16,
+    "bitfield32": 17,
+    "sub-message": 13,
+}
+
+_BLOB_MAGIC = 0x424C4E59  # "YNLB"
+_BLOB_VERSION = 2
+_BLOB_NONE = 0xFFFF
+
+
+class BlobWriter:
+    """Little endian encoder of the binary spec format read by lib/ynl-dyn.cpp"""
+
+    def __init__(self):
+        self.buf = bytearray()
+
+    def u8(self, val):
+        self.buf += int(val).to_bytes(1, "little")
+
+    def u16(self, val):
+        self.buf += int(val).to_bytes(2, "little")
+
+    def u32(self, val):
+        self.buf += int(val).to_bytes(4, "little")
+
+    def str(self, val):
+        data = val.encode()
+        self.u16(len(data))
+        self.buf += data
+
+
+def _blob_struct_size(defs, name):
+    size = 0
+    for member in defs[name]["members"]:
+        if "struct" in member:
+            size += _blob_struct_size(defs, member["struct"])
+        elif member["type"] in ("pad", "binary"):
+            size += member.get("len", 1)
+        else:
+            size += int(member["type"][1:]) // 8
+    return size
+
+
+def render_blob(family, out_file):
+    """
+    Compile the spec into the binary form loaded by ynl_cpp::dyn_family,
+    so that families can be used at runtime without generated code.
+    Enums, docs and sub-message formats are not carried over, values of
+    enums and sub-messages are exposed as numbers and raw bytes.
+    """
+    defs = {d["name"]: d for d in family["definitions"] if d["type"] == "struct"}
+    structs = [d["name"] for d in _classic_structs(family)]
+    if family.fixed_header and family.fixed_header not in structs:
+        structs.append(family.fixed_header)
+    struct_idx = {name: i for i, name in enumerate(structs)}
+    sets = [name for name, aset in family.attr_sets.items()]
+    set_idx = {name: i for i, name in enumerate(sets)}
+
+    w = BlobWriter()
+    w.u32(_BLOB_MAGIC)
+    w.u16(_BLOB_VERSION)
+    w.u16(0)
+    w.str(family.name)
+    w.u8(1 if family.is_classic() else 0)
+    w.u8(family.yaml.get("protonum", 16))
+    w.u8(family.yaml.get("version", 1))
+
+    w.u16(len(structs))
+    for name in structs:
+        w.str(name)
+        members = defs[name]["members"]
+        w.u16(len(members))
+        offset = 0
+        for member in members:
+            if "struct" in member:
+                size = _blob_struct_size(defs, member["struct"])
+                mtype = "binary"
+            elif member["type"] in ("pad", "binary"):
+                size = member.get("len", 1)
+                mtype = member["type"]
+            else:
+                size = int(member["type"][1:]) // 8
+                mtype = member["type"]
+            w.str(member["name"])
+            w.u8(_BLOB_TYPES[mtype])
+            w.u8(member.get("byte-order") == "big-endian")
+            w.u16(offset)
+            w.u16(size)
+            offset += size
+    w.u16(struct_idx.get(family.fixed_header, _BLOB_NONE))
+
+    w.u16(len(sets))
+    for name in sets:
+        aset = family.attr_sets[name]
+        w.str(name)
+        w.u16(len(aset.attrs))
+        for attr in aset.attrs.values():
+            flags = 0
+            if attr.byte_order == "big-endian":
+                flags |= 1
+            if attr.is_multi:
+                flags |= 2
+            nested = attr.yaml.get("nested-attributes")
+            length = attr.len or 0
+            if attr.type == "nest-type-value":
+                length = len(attr.yaml["type-value"])
+            w.str(attr.name)
+            w.u16(attr.value)
+            w.u8(_BLOB_TYPES[attr.type])
+            w.u8(flags)
+            w.u8(_BLOB_TYPES.get(attr.sub_type, 0) if attr.type == "indexed-array" else 0)
+            w.u16(set_idx[nested] if nested else _BLOB_NONE)
+            w.u16(int(length))
+
+    ops = [op for op in family.ops.values() if op.is_call]
+    w.u16(len(ops))
+    for op in ops:
+        modes = 0
+        if "do" in op:
+            modes |= 1
+            if "reply" in op["do"]:
+                modes |= 4
+        if "dump" in op:
+            modes |= 2
+        rsp_value = op.rsp_value if op.rsp_value is not None else op.req_value
+        w.str(op.name)
+        w.u32(op.req_value)
+        w.u32(rsp_value)
+        w.u16(set_idx[op["attribute-set"]] if "attribute-set" in op else _BLOB_NONE)
+        w.u16(struct_idx.get(op.fixed_header, _BLOB_NONE))
+        w.u8(modes)
+
+    grps = family.mcgrps["list"]
+    w.u16(len(grps))
+    for grp in grps:
+        w.str(grp["name"])
+        w.u32(grp.get("value", 0))
+
+    with open(out_file, "wb") as fp:
+        fp.write(w.buf)
+
+
 def main():
     parser = argparse.ArgumentParser(description="Netlink simple parsing generator")
     parser.add_argument("--mode", dest="mode", type=str, required=True)
@@ -2176,7 +3043,7 @@ def main():
     parser.add_argument("-o", dest="out_file", type=str, default=None)
     args = parser.parse_args()
 
-    if args.header is None:
+    if args.header is None and args.mode != "blob":
         parser.error("--header or --source is required")
 
     exclude_ops = [re.compile(expr) for expr in args.exclude_op]
@@ -2194,6 +3061,10 @@ def main():
         os.sys.exit(1)
         return
 
+    if args.mode == "blob":
+        render_blob(parsed, args.out_file)
+        return
+
     supported_models = ["unified"]
     if args.mode in ["user"]:
         supported_models += ["directional"]
@@ -2248,22 +3119,28 @@ def main():
         cw.nl()
         cw.p("#include <array>")
     cw.nl()
-    headers = [parsed.uapi_header]
+    headers = [parsed.uapi_header] if parsed.uapi_header else []
     for definition in parsed["definitions"]:
         if "header" in definition:
             headers.append(definition["header"])
+    if not headers and args.header:
+        headers.append("linux/netlink.h")
     for one in headers:
         cw.p(f"#include <{one}>")
     cw.nl()
 
     if not args.header:
         cw.p("#include <linux/genetlink.h>")
+        if parsed.is_rtnetlink():
+            cw.p("#include <linux/rtnetlink.h>")
         cw.nl()
         for one in args.user_header:
             cw.p(f'#include "{one}"')
 
     cw.p("namespace ynl_cpp {")
     if args.header:
+        if not parsed.uapi_header:
+            render_classic_uapi(parsed, cw)
         render_user_family(parsed, cw, True)
     cw.nl()
 
@@ -2277,10 +3154,30 @@ def main():
         cw.nl()
 
         cw.p("/* Common nested types */")
+        # Recursive nests are held in vectors, which may use incomplete types
+        has_recursive_nests = False
+        for struct in parsed.pure_nested_structs.values():
+            if struct.recursive:
+                cw.p(f"struct {struct.render_name};")
+                has_recursive_nests = True
+        if has_recursive_nests:
+            cw.nl()
         for attr_set, struct in parsed.pure_nested_structs.items():
             ri = RenderInfo(cw, parsed, args.mode, "", "", attr_set)
             print_type_full(ri, struct)
 
+        # For requests built by hand, e.g. in batches
+        cw.p("/* Policies and nested encoders */")
+        for name in parsed.pure_nested_structs:
+            put_typol_fwd(cw, Struct(parsed, name))
+        for name in parsed.root_sets:
+            put_typol_fwd(cw, Struct(parsed, name))
+        for attr_set, struct in parsed.pure_nested_structs.items():
+            if struct.request:
+                ri = RenderInfo(cw, parsed, args.mode, "", "", attr_set)
+                put_req_nested_prototype(ri, struct)
+        cw.nl()
+
         for op_name, op in parsed.ops.items():
             cw.p(f"/* ============== {op.enum_name} ============== */")
 
@@ -2289,6 +3186,7 @@ def main():
                 ri = RenderInfo(cw, parsed, args.mode, op, "do")
                 print_req_type(ri)
                 cw.nl()
+                print_req_max_len(ri)
                 print_rsp_type(ri)
                 cw.nl()
                 print_req_prototype(ri)
@@ -2298,6 +3196,7 @@ def main():
                 cw.p(f"/* {op.enum_name} - dump */")
                 ri = RenderInfo(cw, parsed, args.mode, op, "dump")
                 print_req_type(ri)
+                print_req_max_len(ri)
                 if not ri.type_consistent:
                     print_rsp_type(ri)
                 print_wrapped_type(ri)
@@ -2388,6 +3287,7 @@ def main():
                     raise Exception(
                         f"Only notifications with consistent types supported ({op.name})"
                     )
+                print_ntf_type_free(ri)
 
         for op_name, op in parsed.ntfs.items():
             if "event" in op:
@@ -2397,6 +3297,7 @@ def main():
                 parse_rsp_msg(ri)
 
                 ri = RenderInfo(cw, parsed, args.mode, op, "event")
+                print_ntf_type_free(ri)
         cw.nl()
         render_user_family(parsed, cw, False)
 